@@ -0,0 +1,44 @@
+// NOTE: layouts match ClusteredLighting.h, the lists are rebuilt on the CPU every frame
+struct ClusterLight
+{
+    float3 position;
+    float range;
+    float3 color;
+    float spotScale; // NOTE: 0 for point lights, the cone term is then always 1
+    float3 direction;
+    float spotOffset;
+};
+
+StructuredBuffer<ClusterLight> clusterLights : register(t8);
+StructuredBuffer<uint> clusterLightIndices : register(t9);
+StructuredBuffer<uint2> clusterRanges : register(t10); // NOTE: offset, count into clusterLightIndices
+
+cbuffer ClusterData : register(b4)
+{
+    float2 clusterProjectionScale;
+    float clusterSliceScale;
+    float clusterSliceBias;
+    uint3 clusterGridSize;
+    uint clusterLightCount;
+}
+
+uint2 GetClusterRange(float3 viewPos)
+{
+    // NOTE: tiles in NDC, slices exponential in view depth, same split the CPU culls with
+    const float2 ndc = viewPos.xy * clusterProjectionScale / viewPos.z;
+    const uint2 tile = min(uint2(saturate(ndc * 0.5 + 0.5) * clusterGridSize.xy), clusterGridSize.xy - 1);
+    const uint slice = min(uint(max(log(viewPos.z) * clusterSliceScale + clusterSliceBias, 0.0)), clusterGridSize.z - 1);
+
+    return clusterRanges[tile.x + clusterGridSize.x * (tile.y + clusterGridSize.y * slice)];
+}
+
+// NOTE: inverse square falloff windowed to reach zero at the light's range
+float GetLightAttenuation(ClusterLight light, float3 toLight, float3 L)
+{
+    const float distanceSq = dot(toLight, toLight);
+    const float ratio = distanceSq / (light.range * light.range);
+    const float window = saturate(1.0 - ratio * ratio);
+    const float cone = saturate(dot(light.direction, -L) * light.spotScale + light.spotOffset);
+
+    return window * window * cone * cone / max(distanceSq, 0.0001);
+}
@@ -0,0 +1,27 @@
+// NOTE: immediate mode debug lines (DebugDraw.h), one stream of pre-transformed world space vertices per frame
+cbuffer DebugData : register(b0)
+{
+    matrix viewProjectionMatrix;
+}
+
+struct VertexData
+{
+    float3 position : POSITION;
+    uint color : COLOR; // NOTE: RGBA8, red in the low byte
+};
+
+struct VertexShaderOutput
+{
+    float4 color : COLOR;
+    float4 position : SV_POSITION;
+};
+
+VertexShaderOutput DebugVertexShader(VertexData IN)
+{
+    VertexShaderOutput OUT;
+
+    OUT.position = mul(float4(IN.position, 1.0f), viewProjectionMatrix);
+    OUT.color = float4((IN.color >> uint4(0, 8, 16, 24)) & 0xff) / 255.0f;
+
+    return OUT;
+}
@@ -1,40 +1,44 @@
+// NOTE: permutation feature, miter joins cost a second normalize and a divide per vertex. Off by default
+#ifndef MITER_JOIN
+#define MITER_JOIN 0
+#endif
+
 #include "CommonConstantBuffers.hlsl"
 
+// NOTE: every polyline's points back to back, the draw's range is firstPoint and pointCount
+StructuredBuffer<float3> linePoints : register(t0);
+
 cbuffer ShaderData : register(b3)
 {
+    float4 lineColor;
     float thickness;
-    int miter;
+    uint firstPoint;
+    uint pointCount;
 }
 
-struct VertexData
-{
-    float3 position : POSITION;
-    float3 previous : POSITION2;
-    float3 next : POSITION3;
-    float3 direction : DIRECTION;
-};
-
 struct VertexShaderOutput
 {
 	float4 color : COLOR;
 	float4 position : SV_POSITION;
 };
 
-VertexShaderOutput LineVertexShader(VertexData IN)
+float3 FetchPoint(uint index)
 {
-    VertexShaderOutput OUT;
+    return linePoints[firstPoint + index];
+}
 
-    //float3 previousWorld = mul(float4(IN.previous, 1.0f), modelMatrix);
-    //float3 currentWorld = mul(float4(IN.position, 1.0f), modelMatrix);
-    //float3 nextWorld = mul(float4(IN.next, 1.0f), modelMatrix);
+// NOTE: one instance per segment drawn as a 4 vertex strip, vertices 0/1 sit on the segment's start point and 2/3
+// on its end point. No vertex buffer, the neighbours come out of linePoints so a point costs 12 bytes
+VertexShaderOutput LineVertexShader(uint vertexId : SV_VertexID, uint instanceId : SV_InstanceID)
+{
+    VertexShaderOutput OUT;
 
-    //float4 previousProjected = mul(float4(previousWorld, 1.0), viewProjectionMatrix);
-    //float4 currentProjected = mul(float4(currentWorld, 1.0), viewProjectionMatrix);
-    //float4 nextProjected = mul(float4(nextWorld, 1.0), viewProjectionMatrix);
+    const uint index = instanceId + (vertexId >> 1);
+    const uint last = pointCount - 1;
 
-    float4 previousProjected = mul(float4(IN.previous, 1.0f), modelViewProjectionMatrix);
-    float4 currentProjected = mul(float4(IN.position, 1.0f), modelViewProjectionMatrix);
-    float4 nextProjected = mul(float4(IN.next, 1.0f), modelViewProjectionMatrix);
+    float4 previousProjected = mul(float4(FetchPoint(index > 0 ? index - 1 : 0), 1.0f), modelViewProjectionMatrix);
+    float4 currentProjected = mul(float4(FetchPoint(index), 1.0f), modelViewProjectionMatrix);
+    float4 nextProjected = mul(float4(FetchPoint(min(index + 1, last)), 1.0f), modelViewProjectionMatrix);
 
     const float aspectRatio = clientData[2];
     const float2 aspectVec = float2(aspectRatio, 1.0f);
@@ -43,8 +47,6 @@ VertexShaderOutput LineVertexShader(VertexData IN)
     float2 previousScreen = (previousProjected.xy / previousProjected.w) * aspectVec;
     float2 nextScreen = (nextProjected.xy / nextProjected.w) * aspectVec;
 
-    // OUT.color = float4((currentScreen.x+1.0)/2.0, (currentScreen.y+1.0)/2.0f, 0.0, 1.0);
-
     float len = thickness;
 
     // NOTE: starting point uses (next - current)
@@ -57,27 +59,27 @@ VertexShaderOutput LineVertexShader(VertexData IN)
         // NOTE: somewhere in middle, needs a join
         // NOTE: get dir from (C - B) and (B - A)
         float2 dirA = normalize(currentScreen - previousScreen);
-        if (miter == 1) {
-            float2 dirB = normalize(nextScreen - currentScreen);
+#if MITER_JOIN
+        float2 dirB = normalize(nextScreen - currentScreen);
 
-            float2 tangent = normalize(dirA + dirB);
-            float2 perp = float2(-dirA.y, dirA.x);
-            float2 miter = float2(-tangent.y, tangent.x);
-            dir = tangent;
-            len = thickness / dot(miter, perp);
-        } else {
-            dir = dirA;
-        }
+        float2 tangent = normalize(dirA + dirB);
+        float2 perp = float2(-dirA.y, dirA.x);
+        float2 miter = float2(-tangent.y, tangent.x);
+        dir = tangent;
+        len = thickness / dot(miter, perp);
+#else
+        dir = dirA;
+#endif
     }
 
     float2 normal = normalize(float2(-dir.y, dir.x));
     normal *= len * 0.5f;
     normal.x /= aspectRatio;
 
-    const float orientation = IN.direction[0];
+    const float orientation = (vertexId & 1) ? 1.0f : -1.0f;
     const float2 offset = normal * orientation;
     OUT.position = currentProjected + float4(offset.xy, 0.0, 0.0);
-    OUT.color = float4(0.9, 0.9, 0.9, 1.0);
+    OUT.color = lineColor;
 
     return OUT;
 }
\ No newline at end of file
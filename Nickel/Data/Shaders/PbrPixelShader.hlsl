@@ -1,10 +1,22 @@
+// NOTE: permutation features, the cooker compiles every combination listed in ShaderPermutations.cpp. The
+// defaults are the full-featured variant, the one FxCompile builds
+#ifndef HAS_NORMAL_MAP
+#define HAS_NORMAL_MAP 1
+#endif
+#ifndef HAS_EMISSIVE_MAP
+#define HAS_EMISSIVE_MAP 1
+#endif
+#ifndef HAS_AO_MAP
+#define HAS_AO_MAP 1
+#endif
+
 Texture2D albedoTex : register(t0);
 Texture2D normalTex : register(t1);
 Texture2D metalRoughnessTex : register(t2);
 Texture2D aoTex : register(t3);
 Texture2D emissionTex : register(t4);
 
-TextureCube irradianceMap : register(t5);
+// NOTE: t5 was the irradiance cube map, diffuse IBL comes from SphericalHarmonics.hlsl now
 TextureCube radianceMap : register(t6);
 
 Texture2D brdfLUT : register(t7);
@@ -13,11 +25,11 @@ SamplerState sampleType : register(s0);
 
 #include "PbrHelper.hlsl"
 #include "CommonConstantBuffers.hlsl"
+#include "ClusteredLighting.hlsl"
+#include "SphericalHarmonics.hlsl"
 
 cbuffer ShaderData : register(b3)
 {
-    float4 lightPositions[4];
-    float4 lightColors[4];
     float4 albedoFactor;
     float metallicFactor;
     float roughnessFactor;
@@ -31,9 +43,11 @@ struct PixelShaderInput
     float2 uv : TEXCOORD0;
 };
 
+#if HAS_NORMAL_MAP
 float3 GetNormalFromMap(float3 normal, float3 worldPos, float2 uv) {
-    float3 tangentNormal = normalTex.Sample(sampleType, uv).rgb;
-    tangentNormal = normalize(tangentNormal * 2.0 - 1.0);
+    // NOTE: z is rebuilt from xy, cooked normal maps are BC5 and only store those
+    float2 tangentXY = normalTex.Sample(sampleType, uv).rg * 2.0 - 1.0;
+    float3 tangentNormal = float3(tangentXY, sqrt(saturate(1.0 - dot(tangentXY, tangentXY))));
 
     float3 Q1 = ddx(worldPos);
     float3 Q2 = ddy(worldPos);
@@ -52,6 +66,7 @@ float3 GetNormalFromMap(float3 normal, float3 worldPos, float2 uv) {
 
     return normalize(mul(tangentNormal, TBN));
 }
+#endif
 
 float4 PbrPixelShader(PixelShaderInput IN) : SV_TARGET
 {
@@ -59,24 +74,40 @@ float4 PbrPixelShader(PixelShaderInput IN) : SV_TARGET
     const float2 metalRoughnessTexel = metalRoughnessTex.Sample(sampleType, IN.uv).rg;
     const float metallic = metalRoughnessTexel.r;
     const float roughness = metalRoughnessTexel.g;
+#if HAS_AO_MAP
     const float ao = aoTex.Sample(sampleType, IN.uv).r;
+#else
+    const float ao = aoFactor;
+#endif
+#if HAS_EMISSIVE_MAP
     const float3 emissionTexel = pow(emissionTex.Sample(sampleType, IN.uv).rgb, 2.2);
+#else
+    const float3 emissionTexel = float3(0.0, 0.0, 0.0);
+#endif
 
+#if HAS_NORMAL_MAP
     float3 N = GetNormalFromMap(normalize(IN.normalWS), IN.worldPos, IN.uv);
+#else
+    float3 N = normalize(IN.normalWS);
+#endif
     float3 V = normalize(eyePos - IN.worldPos);
     float3 R = reflect(-V, N);
 
     float3 F0 = lerp(float3(0.04, 0.04, 0.04), albedoTexel.rgb, metallic);
 
-    // reflectance equation
+    // reflectance equation, over the lights culled into this pixel's cluster
+    const float3 viewPos = mul(float4(IN.worldPos, 1.0), viewMatrix).xyz;
+    const uint2 cluster = GetClusterRange(viewPos);
+
     float3 Lo = float3(0.0, 0.0, 0.0);
-    for (int i = 0; i < 4; ++i) {
+    for (uint i = 0; i < cluster.y; ++i) {
+        const ClusterLight light = clusterLights[clusterLightIndices[cluster.x + i]];
+
         // calculate per-light radiance
-        float3 L = normalize(lightPositions[i].xyz - IN.worldPos);
+        float3 toLight = light.position - IN.worldPos;
+        float3 L = normalize(toLight);
         float3 H = normalize(V + L);
-        float distance = length(lightPositions[i].xyz - IN.worldPos);
-        float attenuation = 1.0 / (distance * distance);
-        float3 radiance = lightColors[i].xyz * attenuation;
+        float3 radiance = light.color * GetLightAttenuation(light, toLight, L);
 
         // cook-torrance brdf
         float NDF = DistributionGGX(N, H, roughness);
@@ -108,15 +139,17 @@ float4 PbrPixelShader(PixelShaderInput IN) : SV_TARGET
     // ambient lighting (we now use IBL as the ambient term)
     float3 F = FresnelSchlickRoughness(max(dot(N, V), 0.0), F0, roughness);
 
-    float3 prefilteredColor = radianceMap.Sample(sampleType, R).rgb; // roughness * MAX_REFLECTION_LOD
+    // mip m of the radiance map is prefiltered for roughness m / (mips - 1), see EnvironmentPrefilter.h
+    uint radianceSize, radianceHeight, radianceMips;
+    radianceMap.GetDimensions(0, radianceSize, radianceHeight, radianceMips);
+    float3 prefilteredColor = radianceMap.SampleLevel(sampleType, R, roughness * (radianceMips - 1)).rgb;
     const float2 brdfLutUv = float2(max(dot(N, V), 0.0), roughness);
     float2 brdf = brdfLUT.Sample(sampleType, brdfLutUv).rg;
     float3 specular = prefilteredColor * (F * brdf.x + brdf.y);
 
-    // float3 ambient =  // texture(irradianceMap, N).rgb;
     float3 kS = FresnelSchlick(max(dot(N, V), 0.0), F0);
     float3 kD = 1.0 - kS;
-    float3 irradiance = irradianceMap.Sample(sampleType, N).rgb;
+    float3 irradiance = EvaluateIrradianceSH(N);
     float3 diffuse = irradiance * albedoTexel;
     float3 ambient = (kD * diffuse + specular) * ao;
     //float3 ambient = float3(0.13, 0.13, 0.13) * albedoTexel.rgb * ao;
@@ -0,0 +1,22 @@
+// NOTE: layout matches IrradianceShaderData in SphericalHarmonics.h, order 2 SH of the environment's irradiance over
+// pi with the basis constants already folded into the coefficients. Rebuilt on the CPU when the environment changes
+cbuffer IrradianceSH : register(b5)
+{
+    float4 irradianceSH[9];
+}
+
+float3 EvaluateIrradianceSH(float3 n)
+{
+    float3 result = irradianceSH[0].rgb;
+    result += irradianceSH[1].rgb * n.y;
+    result += irradianceSH[2].rgb * n.z;
+    result += irradianceSH[3].rgb * n.x;
+    result += irradianceSH[4].rgb * (n.x * n.y);
+    result += irradianceSH[5].rgb * (n.y * n.z);
+    result += irradianceSH[6].rgb * (3.0 * n.z * n.z - 1.0);
+    result += irradianceSH[7].rgb * (n.x * n.z);
+    result += irradianceSH[8].rgb * (n.x * n.x - n.y * n.y);
+
+    // NOTE: the truncated series rings below zero opposite very bright lights
+    return max(result, 0.0);
+}
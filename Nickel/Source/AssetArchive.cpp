@@ -0,0 +1,179 @@
+#include "AssetArchive.h"
+#include "Lz4.h"
+#include <algorithm>
+#include <filesystem>
+#include <vector>
+
+namespace Nickel {
+	namespace {
+		struct Mount {
+			AssetArchive archive;
+			std::string prefix; // NOTE: normalized mount point with a trailing '/', empty for the working directory
+		};
+
+		// NOTE: only changed at startup and shutdown, read from any thread in between
+		std::vector<std::unique_ptr<Mount>> mounts;
+
+		auto InRange(u64 first, u64 count, u64 size) -> bool {
+			return first <= size && count <= size - first;
+		}
+
+		auto IsOrdered(const AssetArchiveFormat::Entry& entry, u64 hash, std::string_view entryPath, std::string_view path) -> bool {
+			return entry.pathHash != hash ? entry.pathHash < hash : entryPath < path;
+		}
+
+		// NOTE: the archive holding 'path' and the entry, searched from the last mount
+		auto FindMounted(const std::string& path) -> std::pair<const AssetArchive*, const AssetArchiveFormat::Entry*> {
+			if (mounts.empty())
+				return {};
+
+			const auto normalized = NormalizeAssetPath(path);
+			for (auto it = mounts.rbegin(); it != mounts.rend(); ++it) {
+				const auto& mount = **it;
+				if (!normalized.starts_with(mount.prefix))
+					continue;
+
+				if (const auto entry = mount.archive.Find(std::string_view(normalized).substr(mount.prefix.size())); entry != nullptr)
+					return { &mount.archive, entry };
+			}
+
+			return {};
+		}
+	}
+
+	auto AssetArchive::Open(const char* archivePath) -> bool {
+		Assert(!file.IsOpen());
+		if (!file.Open(archivePath))
+			return false;
+
+		using namespace AssetArchiveFormat;
+		const auto data = file.Data();
+		auto fail = [&](const char* reason) {
+			Logger::Error(std::string("[AssetArchive]: ") + archivePath + " " + reason);
+			file.Close();
+			return false;
+		};
+
+		if (data.size() < sizeof(Header))
+			return fail("is too small to be an asset archive");
+
+		const auto header = reinterpret_cast<const Header*>(data.data());
+		if (header->magic != Magic || header->version != Version)
+			return fail("isn't an asset archive of this version, re-pack it");
+		if (header->fileSize != data.size())
+			return fail("is truncated");
+
+		if (header->entriesOffset % alignof(Entry) != 0 || !InRange(header->entriesOffset, static_cast<u64>(header->entryCount) * sizeof(Entry), data.size()))
+			return fail("has its index outside the file");
+		entries = std::span{ reinterpret_cast<const Entry*>(data.data() + header->entriesOffset), header->entryCount };
+
+		if (header->stringsSize == 0 || !InRange(header->stringsOffset, header->stringsSize, data.size()) || data[header->stringsOffset + header->stringsSize - 1] != 0)
+			return fail("has a broken string pool");
+		strings = reinterpret_cast<const char*>(data.data() + header->stringsOffset);
+
+		// NOTE: everything below is trusted after this, lookups and reads index without checks
+		for (u32 i = 0; i < entries.size(); i++) {
+			const auto& entry = entries[i];
+			if (!InRange(entry.path, static_cast<u64>(entry.pathLength) + 1, header->stringsSize) || strings[entry.path + entry.pathLength] != 0)
+				return fail("has a broken path");
+			if (!InRange(entry.dataOffset, entry.storedSize, data.size()) || entry.compression > Compression::Lz4 ||
+				(entry.compression == Compression::None && entry.storedSize != entry.size))
+				return fail("has a broken entry");
+			if (entry.pathHash != HashPath(GetPath(entry)) || (i > 0 && !IsOrdered(entries[i - 1], entry.pathHash, GetPath(entries[i - 1]), GetPath(entry))))
+				return fail("has an unsorted index");
+		}
+
+		path = archivePath;
+		return true;
+	}
+
+	auto AssetArchive::Close() -> void {
+		file.Close();
+		entries = {};
+		strings = nullptr;
+	}
+
+	auto AssetArchive::Find(std::string_view assetPath) const -> const AssetArchiveFormat::Entry* {
+		const u64 hash = AssetArchiveFormat::HashPath(assetPath);
+		const auto it = std::lower_bound(entries.begin(), entries.end(), hash, [&](const AssetArchiveFormat::Entry& entry, u64) {
+			return IsOrdered(entry, hash, GetPath(entry), assetPath);
+		});
+
+		return it != entries.end() && it->pathHash == hash && GetPath(*it) == assetPath ? &*it : nullptr;
+	}
+
+	auto AssetArchive::Read(const AssetArchiveFormat::Entry& entry, AssetData& data) const -> bool {
+		data.file.Close();
+		data.decompressed.reset();
+
+		const auto stored = file.Data().subspan(entry.dataOffset, entry.storedSize);
+		if (entry.compression == AssetArchiveFormat::Compression::None) {
+			data.bytes = stored;
+			return true;
+		}
+
+		data.decompressed = std::make_unique_for_overwrite<u8[]>(entry.size);
+		if (!Lz4::Decompress(stored, std::span{ data.decompressed.get(), entry.size })) {
+			Logger::Error("[AssetArchive]: " + std::string(GetPath(entry)) + " in " + path + " is corrupt");
+			data.decompressed.reset();
+			data.bytes = {};
+			return false;
+		}
+
+		data.bytes = std::span{ data.decompressed.get(), entry.size };
+		return true;
+	}
+
+	auto AssetArchive::Prefetch() const -> void {
+		file.Prefetch();
+	}
+
+	auto NormalizeAssetPath(std::string_view path) -> std::string {
+		std::string separated(path);
+		std::replace(separated.begin(), separated.end(), '\\', '/');
+		auto normalized = std::filesystem::path(separated).lexically_normal().generic_string();
+		return normalized == "." ? std::string() : normalized;
+	}
+
+	auto MountAssetArchive(const char* archivePath, const char* mountPoint) -> bool {
+		auto mount = std::make_unique<Mount>();
+		if (!mount->archive.Open(archivePath))
+			return false;
+
+		mount->prefix = NormalizeAssetPath(mountPoint);
+		if (!mount->prefix.empty() && !mount->prefix.ends_with('/'))
+			mount->prefix += '/';
+
+		mount->archive.Prefetch();
+		Logger::Info(std::string("[AssetArchive]: mounted ") + archivePath + " (" + std::to_string(mount->archive.GetEntries().size()) + " assets) on " + mountPoint);
+		mounts.push_back(std::move(mount));
+		return true;
+	}
+
+	auto UnmountAssetArchives() -> void {
+		mounts.clear();
+	}
+
+	auto ReadAsset(const std::string& path, AssetData& data) -> bool {
+		if (const auto [archive, entry] = FindMounted(path); entry != nullptr)
+			return archive->Read(*entry, data);
+
+		data.decompressed.reset();
+		if (!data.file.Open(path.c_str())) {
+			data.bytes = {};
+			return false;
+		}
+
+		data.bytes = data.file.Data();
+		return true;
+	}
+
+	auto AssetExists(const std::string& path) -> bool {
+		std::error_code error;
+		return FindMounted(path).second != nullptr || std::filesystem::exists(path, error);
+	}
+
+	auto IsPackedAsset(const std::string& path) -> bool {
+		return FindMounted(path).second != nullptr;
+	}
+}
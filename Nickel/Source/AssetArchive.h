@@ -0,0 +1,58 @@
+#pragma once
+
+#include "AssetArchiveFormat.h"
+#include "MappedFile.h"
+#include <memory>
+#include <string>
+#include <string_view>
+
+// Assets out of a single packed file instead of the loose files under Data/. The archive is mapped once, lookups
+// binary search its sorted hash index and stored entries are spans into the mapping, so loading them costs no open,
+// no read and no copy. Compressed entries are decompressed into a buffer of their own. Mounting an archive puts it in
+// front of a directory: ReadAsset looks paths under that directory up in the archive first and falls back to the
+// loose file when the archive doesn't have it, the loaders don't know which one they got.
+namespace Nickel {
+	constexpr const char* AssetArchivePath = "Data.pak";
+	constexpr const char* AssetMountPoint = "Data";
+
+	// NOTE: an asset's bytes, out of a mounted archive's mapping, a decompressed copy or a mapped loose file. The span
+	// stays valid when this is moved
+	struct AssetData {
+		std::span<const u8> bytes;
+		std::unique_ptr<u8[]> decompressed;
+		MappedFile file;
+	};
+
+	class AssetArchive {
+	public:
+		auto Open(const char* archivePath) -> bool; // NOTE: validates the index against the mapping once, lookups don't check again
+		auto Close() -> void;
+
+		auto Find(std::string_view path) const -> const AssetArchiveFormat::Entry*; // NOTE: relative to the packed directory, nullptr when missing
+		auto Read(const AssetArchiveFormat::Entry& entry, AssetData& data) const -> bool; // NOTE: false (logged) when a compressed entry is corrupt
+		auto Prefetch() const -> void; // NOTE: has the OS read the whole archive in, sequentially and in the background
+
+		inline auto GetEntries() const -> std::span<const AssetArchiveFormat::Entry> { return entries; }
+		inline auto GetPath(const AssetArchiveFormat::Entry& entry) const -> std::string_view { return { strings + entry.path, entry.pathLength }; }
+		inline auto IsOpen() const -> bool { return file.IsOpen(); }
+
+	private:
+		MappedFile file;
+		std::string path;
+		std::span<const AssetArchiveFormat::Entry> entries;
+		const char* strings = nullptr;
+	};
+
+	// NOTE: '/' separators, "." and ".." resolved, the form archive paths are stored in
+	auto NormalizeAssetPath(std::string_view path) -> std::string;
+
+	// NOTE: at startup, before anything loads. Paths under 'mountPoint' go to the archive first, mounts made later are
+	// searched first. Starts reading the archive in the background, a cold start is then one sequential read
+	auto MountAssetArchive(const char* archivePath, const char* mountPoint) -> bool;
+	auto UnmountAssetArchives() -> void; // NOTE: no asset read from an archive may be alive
+
+	// NOTE: any thread. From a mounted archive or the loose file, logs and returns false when neither has it
+	auto ReadAsset(const std::string& path, AssetData& data) -> bool;
+	auto AssetExists(const std::string& path) -> bool;
+	auto IsPackedAsset(const std::string& path) -> bool; // NOTE: in a mounted archive, ReadAsset opens no file for it
+}
@@ -0,0 +1,50 @@
+#pragma once
+
+#include "platform.h"
+#include <string_view>
+
+// On-disk layout of the asset archive, written by AssetPacker and mapped as-is by AssetArchive. Little endian. The
+// header and the entry table come first, then the string pool with the entries' paths, then every entry's data
+// aligned to DataAlignment in path order, so a directory's files sit next to each other in the file. Offsets are
+// from the start of the file. Paths are relative to the packed directory with '/' separators, matched exactly.
+namespace Nickel::AssetArchiveFormat {
+	constexpr u32 Magic = 'N' | ('P' << 8) | ('A' << 16) | ('K' << 24);
+	constexpr u32 Version = 1;
+	constexpr u64 DataAlignment = 64; // NOTE: typed reads out of the mapping are aligned and every entry starts a cache line
+
+	enum class Compression : u8 {
+		None, // NOTE: read straight out of the mapping
+		Lz4   // NOTE: a single LZ4 block, only used where it saves at least an eighth
+	};
+
+	struct Header {
+		u32 magic;
+		u32 version;
+		u64 fileSize;
+		u32 entryCount;
+		u32 entriesOffset; // NOTE: sorted by path hash then path, looked up with a binary search
+		u32 stringsOffset;
+		u32 stringsSize;
+	};
+
+	struct Entry {
+		u64 pathHash;
+		u64 dataOffset;
+		u64 storedSize; // NOTE: in the archive
+		u64 size; // NOTE: once decompressed
+		u32 path; // NOTE: offset into the string pool, NUL-terminated
+		u32 pathLength;
+		Compression compression;
+		u8 padding[7];
+	};
+
+	static_assert(sizeof(Header) == 32 && sizeof(Entry) == 48);
+
+	// NOTE: FNV-1a, part of the format, changing it needs a new version
+	constexpr auto HashPath(std::string_view path) -> u64 {
+		u64 hash = 0xcbf29ce484222325ull;
+		for (const char c : path)
+			hash = (hash ^ static_cast<u8>(c)) * 0x100000001b3ull;
+		return hash;
+	}
+}
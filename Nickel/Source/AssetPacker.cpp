@@ -0,0 +1,187 @@
+#include "AssetPacker.h"
+#include "Lz4.h"
+#include "MappedFile.h"
+#include "Threading.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace Nickel::AssetPacker {
+	namespace {
+		constexpr const char* SkippedDirectory = "Cache"; // NOTE: what the engine writes at runtime, see TextureCacheDir
+
+		struct SourceFile {
+			std::string path; // NOTE: relative, '/' separators
+			MappedFile file;
+			std::vector<u8> compressed; // NOTE: empty when stored as is
+		};
+
+		auto AlignUp(u64 value, u64 alignment) -> u64 {
+			return (value + alignment - 1) / alignment * alignment;
+		}
+	}
+
+	auto Pack(const char* sourceDir, const char* archivePath, PackStats* stats) -> bool {
+		namespace fs = std::filesystem;
+		using namespace AssetArchiveFormat;
+		const auto start = std::chrono::steady_clock::now();
+
+		std::error_code error;
+		const auto root = fs::path(sourceDir);
+		const auto output = fs::absolute(archivePath, error);
+		std::vector<SourceFile> sources;
+		for (auto it = fs::recursive_directory_iterator(root, error); !error && it != fs::recursive_directory_iterator(); it.increment(error)) {
+			if (it->is_directory(error) && it->path().filename() == SkippedDirectory) {
+				it.disable_recursion_pending();
+				continue;
+			}
+
+			// NOTE: empty files can't be mapped and nothing loads them, the archive being written isn't packed into itself
+			if (!it->is_regular_file(error) || it->file_size(error) == 0 || fs::absolute(it->path(), error) == output)
+				continue;
+
+			sources.push_back(SourceFile{ .path = it->path().lexically_relative(root).generic_string() });
+		}
+
+		if (error) {
+			Logger::Error(std::string("[AssetPacker]: failed to list ") + sourceDir + ": " + error.message());
+			return false;
+		}
+
+		std::sort(sources.begin(), sources.end(), [](const SourceFile& a, const SourceFile& b) { return a.path < b.path; });
+
+		std::atomic<u32> failed = 0;
+		const u32 count = static_cast<u32>(sources.size());
+		if (count > 0) {
+			ParallelForChunks(count, count, [&](u32, u32 begin, u32 end) {
+				for (u32 i = begin; i < end; i++) {
+					auto& source = sources[i];
+					if (!source.file.Open((root / source.path).string().c_str())) {
+						failed.fetch_add(1, std::memory_order_relaxed);
+						continue;
+					}
+
+					const auto bytes = source.file.Data();
+					source.compressed.resize(Lz4::GetCompressBound(bytes.size()));
+					const u64 size = Lz4::Compress(bytes, source.compressed);
+					if (size == 0 || size > bytes.size() - bytes.size() / 8)
+						source.compressed = {};
+					else
+						source.compressed.resize(size);
+				}
+			});
+		}
+
+		if (failed.load() > 0)
+			return false;
+
+		// NOTE: header, index and paths first, then the data in path order, every entry aligned
+		std::vector<Entry> entries(count);
+		std::string strings;
+		const u64 entriesOffset = sizeof(Header);
+		for (u32 i = 0; i < count; i++) {
+			entries[i] = Entry{
+				.pathHash = HashPath(sources[i].path),
+				.path = static_cast<u32>(strings.size()),
+				.pathLength = static_cast<u32>(sources[i].path.size())
+			};
+			strings += sources[i].path;
+			strings += '\0';
+		}
+		strings += '\0'; // NOTE: never empty, the reader requires a NUL-terminated pool
+
+		const u64 stringsOffset = entriesOffset + count * sizeof(Entry);
+		u64 offset = AlignUp(stringsOffset + strings.size(), DataAlignment);
+		u32 compressedCount = 0;
+		u64 sourceBytes = 0;
+		for (u32 i = 0; i < count; i++) {
+			const auto& source = sources[i];
+			const bool compressed = !source.compressed.empty();
+			auto& entry = entries[i];
+			entry.dataOffset = offset;
+			entry.size = source.file.Data().size();
+			entry.storedSize = compressed ? source.compressed.size() : entry.size;
+			entry.compression = compressed ? Compression::Lz4 : Compression::None;
+			offset = AlignUp(offset + entry.storedSize, DataAlignment);
+			compressedCount += compressed;
+			sourceBytes += entry.size;
+		}
+
+		const u64 fileSize = count > 0 ? entries.back().dataOffset + entries.back().storedSize : stringsOffset + strings.size();
+		if (stringsOffset + strings.size() > ~0u) {
+			Logger::Error(std::string("[AssetPacker]: too many paths under ") + sourceDir);
+			return false;
+		}
+
+		std::vector<Entry> index = entries;
+		std::sort(index.begin(), index.end(), [&](const Entry& a, const Entry& b) {
+			if (a.pathHash != b.pathHash)
+				return a.pathHash < b.pathHash;
+			return std::strcmp(strings.data() + a.path, strings.data() + b.path) < 0;
+		});
+
+		const Header header{
+			.magic = Magic,
+			.version = Version,
+			.fileSize = fileSize,
+			.entryCount = count,
+			.entriesOffset = static_cast<u32>(entriesOffset),
+			.stringsOffset = static_cast<u32>(stringsOffset),
+			.stringsSize = static_cast<u32>(strings.size())
+		};
+
+		auto temporaryPath = fs::path(archivePath);
+		temporaryPath += ".tmp";
+		{
+			std::ofstream file(temporaryPath, std::ios::binary | std::ios::trunc);
+			const auto write = [&](const void* bytes, u64 size) { file.write(static_cast<const char*>(bytes), static_cast<std::streamsize>(size)); };
+			const char padding[DataAlignment] = {};
+
+			write(&header, sizeof(header));
+			write(index.data(), index.size() * sizeof(Entry));
+			write(strings.data(), strings.size());
+			u64 written = stringsOffset + strings.size();
+			for (u32 i = 0; i < count && file; i++) {
+				write(padding, entries[i].dataOffset - written);
+				const auto& source = sources[i];
+				if (source.compressed.empty())
+					write(source.file.Data().data(), entries[i].storedSize);
+				else
+					write(source.compressed.data(), entries[i].storedSize);
+				written = entries[i].dataOffset + entries[i].storedSize;
+			}
+
+			if (!file) {
+				Logger::Error("[AssetPacker]: failed to write " + temporaryPath.string());
+				return false;
+			}
+		}
+
+		fs::rename(temporaryPath, archivePath, error);
+		if (error) {
+			Logger::Error(std::string("[AssetPacker]: failed to replace ") + archivePath + ": " + error.message());
+			return false;
+		}
+
+		const f64 milliseconds = std::chrono::duration<f64, std::milli>(std::chrono::steady_clock::now() - start).count();
+		Logger::Info(std::string("[AssetPacker]: packed ") + std::to_string(count) + " files (" + std::to_string(sourceBytes >> 10) + " KB, " +
+			std::to_string(compressedCount) + " compressed) into " + archivePath + " (" + std::to_string(fileSize >> 10) + " KB)");
+
+		if (stats != nullptr) {
+			*stats = PackStats{
+				.files = count,
+				.compressed = compressedCount,
+				.sourceBytes = sourceBytes,
+				.archiveBytes = fileSize,
+				.milliseconds = milliseconds
+			};
+		}
+
+		return true;
+	}
+}
@@ -0,0 +1,20 @@
+#pragma once
+
+#include "AssetArchiveFormat.h"
+
+// Builds the asset archive AssetArchive mounts from a directory, every regular file under it becomes an entry named
+// by its path relative to that directory. Cache directories hold what the engine writes at runtime and are left out.
+// Files are compressed with LZ4 on the job system and stored compressed only when that saves at least an eighth, so
+// JPEG and PNG stay as they are and are read straight out of the mapping. The archive is written to a temporary file
+// and renamed over the old one, a failed pack leaves the old archive intact.
+namespace Nickel::AssetPacker {
+	struct PackStats {
+		u32 files;
+		u32 compressed;
+		u64 sourceBytes;
+		u64 archiveBytes;
+		f64 milliseconds;
+	};
+
+	auto Pack(const char* sourceDir, const char* archivePath, PackStats* stats = nullptr) -> bool;
+}
@@ -0,0 +1,488 @@
+#include "AsyncFileIO.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <deque>
+
+#if defined(_WIN32)
+#include <Windows.h>
+#else
+#include <cerrno>
+#include <fcntl.h>
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace Nickel {
+	namespace {
+		// NOTE: a single OS read is capped below 2 GB on both platforms, longer ranges go out in pieces
+		constexpr u64 MaxReadSize = 1ull << 30;
+
+		using Clock = std::chrono::steady_clock;
+
+		struct Request {
+#if defined(_WIN32)
+			OVERLAPPED overlapped; // NOTE: first, the OVERLAPPED a completion carries is the request
+#endif
+			const AsyncFile* file;
+			u64 offset;
+			u8* destination;
+			u64 size;
+			u64 done; // NOTE: read so far, short reads are issued again for the rest
+			u64 userData;
+			Clock::time_point issued; // NOTE: when it got a slot, the wait for one isn't latency
+		};
+
+#if !defined(_WIN32)
+		// NOTE: no liburing, the three syscalls are all it wraps that's needed here
+		auto IoUringSetup(u32 entries, io_uring_params* params) -> int {
+			return static_cast<int>(syscall(__NR_io_uring_setup, entries, params));
+		}
+
+		auto IoUringEnter(int ring, u32 toSubmit, u32 minComplete, u32 flags) -> int {
+			return static_cast<int>(syscall(__NR_io_uring_enter, ring, toSubmit, minComplete, flags, nullptr, 0));
+		}
+
+		auto IoUringRegister(int ring, u32 opcode, void* arg, u32 count) -> int {
+			return static_cast<int>(syscall(__NR_io_uring_register, ring, opcode, arg, count));
+		}
+#endif
+	}
+
+	struct AsyncFileReader::Queue {
+		std::vector<Request> slots; // NOTE: never resized, the OS holds pointers into it while reads are in flight
+		std::vector<u32> freeSlots;
+		std::deque<Request> waiting; // NOTE: queued, not given a slot yet
+		std::vector<IoCompletion> finished; // NOTE: reaped, handed out by the next Poll
+		u32 inFlight = 0;
+#if defined(_WIN32)
+		HANDLE port = nullptr; // NOTE: null for blocking reads
+#else
+		int ring = -1; // NOTE: -1 for blocking reads
+		u8* sqMapping = nullptr;
+		u64 sqMappingSize = 0;
+		u8* cqMapping = nullptr; // NOTE: the same as sqMapping when the kernel maps both rings at once
+		u64 cqMappingSize = 0;
+		io_uring_sqe* sqes = nullptr;
+		u64 sqesSize = 0;
+		u32* sqTail = nullptr;
+		u32 sqMask = 0;
+		u32* sqArray = nullptr;
+		u32* cqHead = nullptr;
+		u32* cqTail = nullptr;
+		u32 cqMask = 0;
+		io_uring_cqe* cqes = nullptr;
+		u32 unsubmitted = 0; // NOTE: written to the submission ring, not consumed by the kernel yet
+#endif
+
+		~Queue() {
+#if defined(_WIN32)
+			if (port != nullptr)
+				CloseHandle(port);
+#else
+			if (sqes != nullptr)
+				munmap(sqes, sqesSize);
+			if (cqMapping != nullptr && cqMapping != sqMapping)
+				munmap(cqMapping, cqMappingSize);
+			if (sqMapping != nullptr)
+				munmap(sqMapping, sqMappingSize);
+			if (ring >= 0)
+				close(ring);
+#endif
+		}
+
+#if defined(_WIN32)
+		auto CreatePort() -> bool {
+			port = CreateIoCompletionPort(INVALID_HANDLE_VALUE, nullptr, 0, 1);
+			return port != nullptr;
+		}
+#else
+		auto CreateRing(u32 entries) -> bool {
+			io_uring_params params{};
+			ring = IoUringSetup(entries, &params);
+			if (ring < 0)
+				return false;
+
+			sqMappingSize = params.sq_off.array + params.sq_entries * sizeof(u32);
+			cqMappingSize = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+			const bool singleMapping = (params.features & IORING_FEAT_SINGLE_MMAP) != 0;
+			if (singleMapping)
+				sqMappingSize = cqMappingSize = std::max(sqMappingSize, cqMappingSize);
+
+			const auto map = [&](u64 size, u64 offset) -> u8* {
+				void* view = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring, static_cast<off_t>(offset));
+				return view == MAP_FAILED ? nullptr : static_cast<u8*>(view);
+			};
+
+			sqMapping = map(sqMappingSize, IORING_OFF_SQ_RING);
+			if (sqMapping == nullptr)
+				return false;
+			cqMapping = singleMapping ? sqMapping : map(cqMappingSize, IORING_OFF_CQ_RING);
+			if (cqMapping == nullptr)
+				return false;
+			sqesSize = params.sq_entries * sizeof(io_uring_sqe);
+			sqes = reinterpret_cast<io_uring_sqe*>(map(sqesSize, IORING_OFF_SQES));
+			if (sqes == nullptr)
+				return false;
+
+			sqTail = reinterpret_cast<u32*>(sqMapping + params.sq_off.tail);
+			sqMask = *reinterpret_cast<u32*>(sqMapping + params.sq_off.ring_mask);
+			sqArray = reinterpret_cast<u32*>(sqMapping + params.sq_off.array);
+			cqHead = reinterpret_cast<u32*>(cqMapping + params.cq_off.head);
+			cqTail = reinterpret_cast<u32*>(cqMapping + params.cq_off.tail);
+			cqMask = *reinterpret_cast<u32*>(cqMapping + params.cq_off.ring_mask);
+			cqes = reinterpret_cast<io_uring_cqe*>(cqMapping + params.cq_off.cqes);
+
+			// NOTE: io_uring came in 5.1 with vectored reads only, IORING_OP_READ and the probe both came in 5.6
+			constexpr u32 ProbeOps = 256;
+			std::vector<u8> probeStorage(sizeof(io_uring_probe) + ProbeOps * sizeof(io_uring_probe_op));
+			auto probe = reinterpret_cast<io_uring_probe*>(probeStorage.data());
+			if (IoUringRegister(ring, IORING_REGISTER_PROBE, probe, ProbeOps) < 0 || probe->last_op < IORING_OP_READ)
+				return false;
+
+			return (probe->ops[IORING_OP_READ].flags & IO_URING_OP_SUPPORTED) != 0;
+		}
+#endif
+
+		auto IsBlocking() const -> bool {
+#if defined(_WIN32)
+			return port == nullptr;
+#else
+			return ring < 0;
+#endif
+		}
+
+		auto Finish(u32 slot, bool failed) -> void {
+			const auto& request = slots[slot];
+			finished.push_back(IoCompletion{
+				.userData = request.userData,
+				.bytes = request.done,
+				.milliseconds = std::chrono::duration<f64, std::milli>(Clock::now() - request.issued).count(),
+				.failed = failed
+			});
+			freeSlots.push_back(slot);
+			inFlight--;
+		}
+
+		// NOTE: 'result' is the bytes the OS read, negative on an error. Zero means the file ended early
+		auto Complete(u32 slot, i64 result) -> void {
+			auto& request = slots[slot];
+			if (result <= 0) {
+				Finish(slot, true);
+				return;
+			}
+
+			request.done += static_cast<u64>(result);
+			if (request.done < request.size)
+				Issue(slot);
+			else
+				Finish(slot, false);
+		}
+
+		// NOTE: the rest of the slot's range, or as much of it as one OS read takes
+		auto Issue(u32 slot) -> void {
+			auto& request = slots[slot];
+			const u64 offset = request.offset + request.done;
+			u8* destination = request.destination + request.done;
+			const u32 size = static_cast<u32>(std::min(request.size - request.done, MaxReadSize));
+
+#if defined(_WIN32)
+			request.overlapped = {};
+			request.overlapped.Offset = static_cast<DWORD>(offset);
+			request.overlapped.OffsetHigh = static_cast<DWORD>(offset >> 32);
+			// NOTE: a read that completes right away still posts its completion, there's a single path for both
+			if (!ReadFile(request.file->handle, destination, size, nullptr, &request.overlapped) && GetLastError() != ERROR_IO_PENDING) {
+				Finish(slot, true);
+				return;
+			}
+
+			if (port == nullptr) {
+				DWORD read = 0;
+				const bool succeeded = GetOverlappedResult(request.file->handle, &request.overlapped, &read, TRUE);
+				Complete(slot, succeeded ? static_cast<i64>(read) : -1);
+			}
+#else
+			if (ring < 0) {
+				ssize_t result;
+				do {
+					result = pread(request.file->descriptor, destination, size, static_cast<off_t>(offset));
+				} while (result < 0 && errno == EINTR);
+				Complete(slot, result);
+				return;
+			}
+
+			// NOTE: the only writer of the submission ring, the release publishes the entry with the tail
+			const u32 tail = std::atomic_ref(*sqTail).load(std::memory_order_relaxed);
+			const u32 index = tail & sqMask;
+			auto& sqe = sqes[index];
+			std::memset(&sqe, 0, sizeof(sqe));
+			sqe.opcode = IORING_OP_READ;
+			sqe.fd = request.file->descriptor;
+			sqe.off = offset;
+			sqe.addr = reinterpret_cast<u64>(destination);
+			sqe.len = size;
+			sqe.user_data = slot;
+			sqArray[index] = index;
+			std::atomic_ref(*sqTail).store(tail + 1, std::memory_order_release);
+			unsubmitted++;
+#endif
+		}
+
+		// NOTE: hands what Issue wrote to the kernel, a single syscall for the whole batch
+		auto Flush() -> void {
+#if !defined(_WIN32)
+			while (unsubmitted > 0) {
+				const int submitted = IoUringEnter(ring, unsubmitted, 0, 0);
+				if (submitted < 0 && errno == EINTR)
+					continue;
+				if (submitted <= 0) {
+					// NOTE: out of kernel resources, the entries stay in the ring for the next flush
+					if (errno != EAGAIN && errno != EBUSY)
+						Logger::Error(std::string("[AsyncFileIO]: io_uring_enter failed: ") + std::strerror(errno));
+					return;
+				}
+
+				unsubmitted -= static_cast<u32>(submitted);
+			}
+#endif
+		}
+
+		auto Reap(bool wait) -> void {
+			if (IsBlocking())
+				return;
+
+#if defined(_WIN32)
+			OVERLAPPED_ENTRY entries[64];
+			ULONG count = 0;
+			do {
+				if (!GetQueuedCompletionStatusEx(port, entries, static_cast<ULONG>(std::size(entries)), &count, wait && inFlight > 0 ? INFINITE : 0, FALSE))
+					return;
+				wait = false;
+
+				for (ULONG i = 0; i < count; i++) {
+					auto request = reinterpret_cast<Request*>(entries[i].lpOverlapped);
+					DWORD read = 0;
+					const bool succeeded = GetOverlappedResult(request->file->handle, &request->overlapped, &read, FALSE);
+					Complete(static_cast<u32>(request - slots.data()), succeeded ? static_cast<i64>(read) : -1);
+				}
+			} while (count == std::size(entries));
+#else
+			u32 head = std::atomic_ref(*cqHead).load(std::memory_order_relaxed);
+			u32 tail = std::atomic_ref(*cqTail).load(std::memory_order_acquire);
+			while (head == tail && wait && inFlight > 0) {
+				const int submitted = IoUringEnter(ring, unsubmitted, 1, IORING_ENTER_GETEVENTS);
+				if (submitted < 0 && errno != EINTR) {
+					Logger::Error(std::string("[AsyncFileIO]: io_uring_enter failed: ") + std::strerror(errno));
+					return;
+				}
+
+				unsubmitted -= static_cast<u32>(std::max(submitted, 0));
+				tail = std::atomic_ref(*cqTail).load(std::memory_order_acquire);
+			}
+
+			// NOTE: the completion ring is twice the submission ring and at most a slot per entry is in flight, it can't overflow
+			for (; head != tail; head++) {
+				const auto& cqe = cqes[head & cqMask];
+				Complete(static_cast<u32>(cqe.user_data), cqe.res);
+			}
+			std::atomic_ref(*cqHead).store(head, std::memory_order_release);
+#endif
+		}
+	};
+
+	AsyncFile::~AsyncFile() {
+		Close();
+	}
+
+	AsyncFile::AsyncFile(AsyncFile&& other) noexcept {
+		*this = std::move(other);
+	}
+
+	auto AsyncFile::operator=(AsyncFile&& other) noexcept -> AsyncFile& {
+		if (this != &other) {
+			Close();
+			size = std::exchange(other.size, 0);
+#if defined(_WIN32)
+			handle = std::exchange(other.handle, nullptr);
+#else
+			descriptor = std::exchange(other.descriptor, -1);
+#endif
+		}
+
+		return *this;
+	}
+
+	auto AsyncFile::Close() -> void {
+		if (!IsOpen())
+			return;
+
+#if defined(_WIN32)
+		CloseHandle(handle);
+		handle = nullptr;
+#else
+		close(descriptor);
+		descriptor = -1;
+#endif
+		size = 0;
+	}
+
+	AsyncFileReader::AsyncFileReader() = default;
+
+	AsyncFileReader::~AsyncFileReader() {
+		Shutdown();
+	}
+
+	auto AsyncFileReader::Init(u32 queueDepth, IoBackend requested) -> void {
+		Assert(queue == nullptr && queueDepth > 0);
+		const auto createQueue = [&]() {
+			queue = std::make_unique<Queue>();
+			queue->slots.resize(queueDepth);
+			for (u32 slot = queueDepth; slot > 0; slot--)
+				queue->freeSlots.push_back(slot - 1);
+		};
+
+		createQueue();
+		backend = IoBackend::Blocking;
+#if defined(_WIN32)
+		if (requested == IoBackend::CompletionPort && queue->CreatePort())
+			backend = IoBackend::CompletionPort;
+#else
+		if (requested == IoBackend::IoUring && queue->CreateRing(queueDepth))
+			backend = IoBackend::IoUring;
+		else if (requested == IoBackend::IoUring)
+			createQueue(); // NOTE: a half set up ring is torn down with the old queue
+#endif
+
+		if (backend != requested) {
+			const char* names[] = { "blocking reads", "io_uring", "an I/O completion port" };
+			Logger::Warn(std::string("[AsyncFileIO]: ") + names[static_cast<u32>(requested)] + " isn't available, reads block on the submitting thread");
+		}
+	}
+
+	auto AsyncFileReader::Shutdown() -> void {
+		if (queue == nullptr)
+			return;
+
+		queue->waiting.clear();
+		while (queue->inFlight > 0)
+			queue->Reap(true);
+		queue.reset();
+	}
+
+	auto AsyncFileReader::Open(const char* path, AsyncFile& file) -> bool {
+		Assert(queue != nullptr);
+		file.Close();
+
+#if defined(_WIN32)
+		HANDLE handle = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_OVERLAPPED, nullptr);
+		if (handle == INVALID_HANDLE_VALUE) {
+			Logger::Error(std::string("[AsyncFileIO]: failed to open ") + path);
+			return false;
+		}
+
+		LARGE_INTEGER fileSize;
+		if (!GetFileSizeEx(handle, &fileSize)) {
+			Logger::Error(std::string("[AsyncFileIO]: failed to read the size of ") + path);
+			CloseHandle(handle);
+			return false;
+		}
+
+		if (queue->port != nullptr && CreateIoCompletionPort(handle, queue->port, 0, 0) == nullptr) {
+			Logger::Error(std::string("[AsyncFileIO]: failed to attach ") + path + " to the completion port");
+			CloseHandle(handle);
+			return false;
+		}
+
+		file.handle = handle;
+		file.size = static_cast<u64>(fileSize.QuadPart);
+#else
+		const int descriptor = open(path, O_RDONLY | O_CLOEXEC);
+		if (descriptor < 0) {
+			Logger::Error(std::string("[AsyncFileIO]: failed to open ") + path);
+			return false;
+		}
+
+		struct stat fileStat;
+		if (fstat(descriptor, &fileStat) != 0) {
+			Logger::Error(std::string("[AsyncFileIO]: failed to read the size of ") + path);
+			close(descriptor);
+			return false;
+		}
+
+		file.descriptor = descriptor;
+		file.size = static_cast<u64>(fileStat.st_size);
+#endif
+
+		return true;
+	}
+
+	auto AsyncFileReader::QueueRead(const AsyncFile& file, u64 offset, std::span<u8> destination, u64 userData) -> void {
+		Assert(queue != nullptr && file.IsOpen());
+		const auto request = Request{ .file = &file, .offset = offset, .destination = destination.data(), .size = destination.size(), .userData = userData };
+		if (destination.empty()) {
+			queue->finished.push_back(IoCompletion{ .userData = userData });
+			return;
+		}
+
+		queue->waiting.push_back(request);
+	}
+
+	auto AsyncFileReader::Submit() -> u32 {
+		Assert(queue != nullptr);
+		u32 issued = 0;
+		while (!queue->waiting.empty() && !queue->freeSlots.empty()) {
+			const u32 slot = queue->freeSlots.back();
+			queue->freeSlots.pop_back();
+			queue->slots[slot] = queue->waiting.front();
+			queue->waiting.pop_front();
+			queue->slots[slot].issued = Clock::now();
+			queue->inFlight++;
+			queue->Issue(slot);
+			issued++;
+		}
+
+		// NOTE: short reads Reap issued again go out with the batch
+		queue->Flush();
+		stats.batches += issued > 0 ? 1 : 0;
+		return issued;
+	}
+
+	auto AsyncFileReader::Poll(std::vector<IoCompletion>& completions, bool wait) -> u32 {
+		Assert(queue != nullptr);
+		Submit();
+		queue->Reap(wait && queue->finished.empty());
+		// NOTE: the slots just freed go to the reads waiting for one
+		Submit();
+
+		for (const auto& completion : queue->finished) {
+			stats.reads++;
+			stats.failed += completion.failed ? 1 : 0;
+			stats.bytes += completion.bytes;
+			stats.milliseconds += completion.milliseconds;
+		}
+
+		const u32 count = static_cast<u32>(queue->finished.size());
+		completions.insert(completions.end(), queue->finished.begin(), queue->finished.end());
+		queue->finished.clear();
+		return count;
+	}
+
+	auto AsyncFileReader::GetBackendName() const -> const char* {
+		switch (backend) {
+			case IoBackend::IoUring:
+				return "io_uring";
+			case IoBackend::CompletionPort:
+				return "completion port";
+			default:
+				return "blocking";
+		}
+	}
+
+	auto AsyncFileReader::GetPendingCount() const -> u32 {
+		return queue != nullptr ? queue->inFlight + static_cast<u32>(queue->waiting.size()) : 0;
+	}
+}
@@ -0,0 +1,106 @@
+#pragma once
+
+#include "platform.h"
+#include <memory>
+#include <vector>
+
+// Reads many file ranges at once instead of one blocking read after another. Reads are queued, handed to the OS in a
+// batch by Submit and picked up by Poll as they complete, in whatever order the device finishes them. On Linux the
+// queue is an io_uring set up with raw syscalls, a batch costs a single io_uring_enter. On Windows the files are
+// opened for overlapped I/O and complete on an I/O completion port. Where io_uring isn't available (kernels before
+// 5.6, seccomp profiles that block it) reads are done with pread when they are submitted, callers don't see the
+// difference. At most the queue depth is in flight, the rest waits for a slot and goes out as earlier reads complete.
+namespace Nickel {
+	enum class IoBackend : u8 {
+		Blocking,
+		IoUring,
+		CompletionPort
+	};
+
+#if defined(_WIN32)
+	constexpr IoBackend DefaultIoBackend = IoBackend::CompletionPort;
+#else
+	constexpr IoBackend DefaultIoBackend = IoBackend::IoUring;
+#endif
+
+	// NOTE: a file opened by AsyncFileReader::Open, it has to outlive every read queued on it
+	class AsyncFile {
+	public:
+		AsyncFile() = default;
+		~AsyncFile();
+
+		AsyncFile(const AsyncFile&) = delete;
+		auto operator=(const AsyncFile&) -> AsyncFile& = delete;
+		AsyncFile(AsyncFile&& other) noexcept;
+		auto operator=(AsyncFile&& other) noexcept -> AsyncFile&;
+
+		auto Close() -> void;
+
+		inline auto GetSize() const -> u64 { return size; }
+#if defined(_WIN32)
+		inline auto IsOpen() const -> bool { return handle != nullptr; }
+#else
+		inline auto IsOpen() const -> bool { return descriptor >= 0; }
+#endif
+
+	private:
+		friend class AsyncFileReader;
+
+		u64 size = 0;
+#if defined(_WIN32)
+		void* handle = nullptr; // NOTE: HANDLE opened for overlapped reads
+#else
+		int descriptor = -1;
+#endif
+	};
+
+	struct IoCompletion {
+		u64 userData;
+		u64 bytes; // NOTE: the requested size, unless the read failed
+		f64 milliseconds; // NOTE: from being handed to the OS to the Poll that saw it complete
+		bool failed; // NOTE: an OS error or the file ended before the range did
+	};
+
+	struct AsyncReadStats {
+		u64 reads; // NOTE: completed, failures included
+		u64 failed;
+		u64 bytes;
+		u64 batches; // NOTE: submissions to the OS, one syscall each with io_uring
+		f64 milliseconds; // NOTE: latency summed over the reads
+	};
+
+	// NOTE: single threaded, the thread that queues the reads polls for them
+	class AsyncFileReader {
+	public:
+		AsyncFileReader();
+		~AsyncFileReader(); // NOTE: waits for the reads in flight, the OS writes into their buffers until they complete
+
+		AsyncFileReader(const AsyncFileReader&) = delete;
+		auto operator=(const AsyncFileReader&) -> AsyncFileReader& = delete;
+
+		// NOTE: falls back to Blocking (logged) when 'backend' can't be set up. 'queueDepth' is the most reads in flight
+		auto Init(u32 queueDepth = 64, IoBackend backend = DefaultIoBackend) -> void;
+		auto Open(const char* path, AsyncFile& file) -> bool; // NOTE: logs and returns false when the file can't be opened
+
+		// NOTE: 'destination' is written until the read completes. Nothing reaches the OS before Submit or Poll
+		auto QueueRead(const AsyncFile& file, u64 offset, std::span<u8> destination, u64 userData) -> void;
+		auto Submit() -> u32; // NOTE: the reads handed to the OS, as many as there are free slots
+		// NOTE: appends the reads that completed since the last call, submits the reads waiting for a slot. 'wait'
+		// blocks until at least one completes, unless nothing is pending. Returns the number appended
+		auto Poll(std::vector<IoCompletion>& completions, bool wait = false) -> u32;
+
+		inline auto GetBackend() const -> IoBackend { return backend; }
+		auto GetBackendName() const -> const char*;
+		auto GetPendingCount() const -> u32; // NOTE: queued and in flight
+		inline auto GetStats() const -> const AsyncReadStats& { return stats; }
+
+	private:
+		struct Queue; // NOTE: the slots and the OS queue, platform specific
+
+		auto Shutdown() -> void;
+
+		IoBackend backend = IoBackend::Blocking;
+		std::unique_ptr<Queue> queue;
+		AsyncReadStats stats{};
+	};
+}
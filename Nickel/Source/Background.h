@@ -9,96 +9,61 @@ namespace Nickel {
 	};
 
 	class Background {
-		const std::string texturePath = "Data/Textures/skybox/irradianceCubemap/output_pmrem"; // /galaxy2048.jpg
+		// NOTE: an equirectangular panorama (e.g. galaxy2048.jpg or an .hdr) converted to cube faces on load, empty uses the six pre-split faces
+		const std::string panoramaPath = "";
 
-		DXLayer::ShaderProgram shaderProgram;
-		Material material;
-
-		DXLayer::ShaderProgram irradianceshaderProgram;
-		Material irradianceMaterial;
+		ProgramHandle shaderProgram;
+		MaterialHandle material;
 
 	public:
-		DXLayer::TextureDX11 texture;
+		Texture texture;
 		DescribedMesh skyboxMesh;
 
-		inline auto Create(ID3D11Device1* device) {
-			shaderProgram.Create(device, std::span{ g_BackgroundVertexShader }, std::span{ g_BackgroundPixelShader });
-			material = CreateMaterial(device);
-			texture = CreateCubemapTexture(device, texturePath);
-			material.textures[0] = texture;
+		inline auto Create(const PlatformInterface& gfx, ShaderLibrary& shaders, PipelineCache& pipelineCache, MaterialSystem& materials) {
+			shaderProgram = shaders.GetProgram(gfx, "Background");
+			texture = CreateCubemapTexture(panoramaPath);
+			material = CreateMaterial(gfx, pipelineCache, materials);
 
-			skyboxMesh = CreateSkyboxMesh(device);
+			skyboxMesh = CreateSkyboxMesh(gfx);
 			skyboxMesh.material = material;
 		};
 
-		inline auto Bind(ID3D11DeviceContext1* cmd) -> void {
-			irradianceMaterial.program->Bind(cmd);
-			//irradianceMaterial.pixelConstantBuffer.Set
-			/*
-			irradianceShader.use();
-			irradianceShader.setInt("environmentMap", 0);
-			irradianceShader.setMat4("projection", captureProjection);
-			glActiveTexture(GL_TEXTURE0);
-			glBindTexture(GL_TEXTURE_CUBE_MAP, envCubemap);
-
-			glViewport(0, 0, 32, 32); // don't forget to configure the viewport to the capture dimensions.
-			glBindFramebuffer(GL_FRAMEBUFFER, captureFBO);
-			for (unsigned int i = 0; i < 6; ++i) {
-				irradianceShader.setMat4("view", captureViews[i]);
-				glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_CUBE_MAP_POSITIVE_X + i, irradianceMap, 0);
-				glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
-
-				renderCube();
-			}
-			glBindFramebuffer(GL_FRAMEBUFFER, 0);
-			*/
-		}
-
 	private:
-		inline auto CreateCubemapTexture(ID3D11Device1* device, const std::string& path) -> DXLayer::TextureDX11 {
+		inline auto CreateCubemapTexture(const std::string& path) -> Texture {
 			const auto rm = ResourceManager::GetInstance();
-			/*
-			LoadedImageData imgs[6] {
-				rm->LoadHDRImageData(path + "_posx.hdr"),
-				rm->LoadHDRImageData(path + "_negx.hdr"),
-				rm->LoadHDRImageData(path + "_posy.hdr"),
-				rm->LoadHDRImageData(path + "_negy.hdr"),
-				rm->LoadHDRImageData(path + "_posz.hdr"),
-				rm->LoadHDRImageData(path + "_negz.hdr")
-			};
-			*/
-
-			const wchar_t* files[6] = {
-				L"Data/Textures/skybox/irradianceCubemap/output_iem_posx.hdr",
-				L"Data/Textures/skybox/irradianceCubemap/output_iem_negx.hdr",
-				L"Data/Textures/skybox/irradianceCubemap/output_iem_posy.hdr",
-				L"Data/Textures/skybox/irradianceCubemap/output_iem_negy.hdr",
-				L"Data/Textures/skybox/irradianceCubemap/output_iem_posz.hdr",
-				L"Data/Textures/skybox/irradianceCubemap/output_iem_negz.hdr"
+			if (!path.empty())
+				return Texture{ .texture = rm->LoadEquirectCubeMap(path), .sampler = rm->GetDefaultSampler() };
+
+			const std::string files[6] = {
+				"Data/Textures/skybox/irradianceCubemap/output_iem_posx.hdr",
+				"Data/Textures/skybox/irradianceCubemap/output_iem_negx.hdr",
+				"Data/Textures/skybox/irradianceCubemap/output_iem_posy.hdr",
+				"Data/Textures/skybox/irradianceCubemap/output_iem_negy.hdr",
+				"Data/Textures/skybox/irradianceCubemap/output_iem_posz.hdr",
+				"Data/Textures/skybox/irradianceCubemap/output_iem_negz.hdr"
 			};
-			
-			auto result = DXLayer::CreateCubeMap(device, files);
-			//for (u32 i = 0; i < ArrayCount(imgs); i++)
-				//stbi_image_free(imgs[i].data);
 
-			return result;
+			return Texture{ .texture = rm->LoadCubeMapAsync(files), .sampler = rm->GetDefaultSampler() };
 		}
 
-		inline auto CreateMaterial(ID3D11Device1* device) -> Material {
-			auto rasterizerDesc = DXLayer::GetDefaultRasterizerDescription();
-			rasterizerDesc.CullMode = D3D11_CULL_MODE::D3D11_CULL_NONE;
-
-			return Material{
-				.program = &shaderProgram,
-				.pipelineState = PipelineState{
-					.rasterizerState = DXLayer::CreateRasterizerState(device, rasterizerDesc),
-					.depthStencilState = DXLayer::CreateDepthStencilState(device, true, D3D11_DEPTH_WRITE_MASK_ZERO, D3D11_COMPARISON_LESS_EQUAL, false)
+		inline auto CreateMaterial(const PlatformInterface& gfx, PipelineCache& pipelineCache, MaterialSystem& materials) -> MaterialHandle {
+			const auto materialTemplate = materials.CreateTemplate(gfx, pipelineCache, MaterialTemplateDesc{
+				.pipeline = PipelineStateDesc{
+					.program = shaderProgram,
+					.rasterizer = RasterizerDesc{ .cullMode = CullMode::None },
+					.depthStencil = DepthStencilDesc{ .depthTest = true, .depthWrite = false, .depthFunc = ComparisonFunc::LessEqual }
 				},
-				.textures = std::vector<DXLayer::TextureDX11>(1)
-			};
+				.textureCount = 1
+			});
+
+			return materials.CreateInstance(gfx, MaterialInstanceDesc{
+				.materialTemplate = materialTemplate,
+				.textures = std::span{ &texture.texture, 1 },
+				.samplers = std::span{ &texture.sampler, 1 }
+			});
 		}
 
-		inline auto CreateSkyboxMesh(ID3D11Device1* device) -> DescribedMesh {
+		inline auto CreateSkyboxMesh(const PlatformInterface& gfx) -> DescribedMesh {
 			const float side = 0.5f;
 			auto vertexData = std::vector<VertexPos>(8);
 			vertexData[0] = VertexPos{ .Position = {-side,-side,-side} };
@@ -134,8 +99,8 @@ namespace Nickel {
 				}
 			};
 			
-			skybox.gpuData.indexBuffer.Create(device, std::span{ indices });
-			skybox.gpuData.vertexBuffer.Create<VertexPos>(device, std::span(vertexData), false);
+			skybox.gpuData.indexBuffer.Create(gfx, std::span{ indices });
+			skybox.gpuData.vertexBuffer.Create<VertexPos>(gfx, std::span(vertexData), false);
 
 			return skybox;
 		}
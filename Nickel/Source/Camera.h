@@ -2,7 +2,7 @@
 
 #include "platform.h"
 #include "Math.h"
-#include "Renderer/DirectXIncludes.h"
+#include <DirectXMath.h>
 
 namespace Nickel {
 	class Camera {
@@ -0,0 +1,220 @@
+#include "FileWatcher.h"
+#include <algorithm>
+#include <cstring>
+#include <filesystem>
+#include <unordered_map>
+
+#if defined(_WIN32)
+#include <Windows.h>
+#else
+#include <cerrno>
+#include <sys/inotify.h>
+#include <unistd.h>
+#endif
+
+namespace Nickel {
+	namespace {
+		using Clock = std::chrono::steady_clock;
+
+		// NOTE: long enough to cover the steps of a save, short enough not to show in the reload time
+		constexpr auto SettleTime = std::chrono::milliseconds(50);
+
+		struct Settling {
+			Clock::time_point firstSeen;
+			Clock::time_point lastSeen;
+		};
+	}
+
+	struct FileWatcher::State {
+		std::string root; // NOTE: as given, without a trailing separator
+		std::unordered_map<std::string, Settling> settling;
+#if defined(_WIN32)
+		HANDLE directory = INVALID_HANDLE_VALUE;
+		OVERLAPPED overlapped{};
+		alignas(DWORD) u8 buffer[64 << 10]; // NOTE: the most ReadDirectoryChangesW fills on a network share too
+#else
+		int inotify = -1;
+		std::unordered_map<int, std::string> directories; // NOTE: watch descriptor to the directory's path
+#endif
+
+		~State() {
+#if defined(_WIN32)
+			if (directory != INVALID_HANDLE_VALUE) {
+				// NOTE: the buffer is written until the cancelled read completes
+				DWORD bytes = 0;
+				CancelIoEx(directory, &overlapped);
+				GetOverlappedResult(directory, &overlapped, &bytes, TRUE);
+				CloseHandle(directory);
+			}
+#else
+			if (inotify >= 0)
+				close(inotify);
+#endif
+		}
+
+		auto Touch(const std::string& path, Clock::time_point now) -> void {
+			const auto [it, inserted] = settling.try_emplace(path, Settling{ .firstSeen = now, .lastSeen = now });
+			it->second.lastSeen = now;
+		}
+
+#if defined(_WIN32)
+		auto Issue() -> bool {
+			overlapped = {};
+			return ReadDirectoryChangesW(directory, buffer, sizeof(buffer), TRUE, FILE_NOTIFY_CHANGE_FILE_NAME | FILE_NOTIFY_CHANGE_LAST_WRITE | FILE_NOTIFY_CHANGE_SIZE,
+				nullptr, &overlapped, nullptr);
+		}
+
+		auto ReadEvents(Clock::time_point now) -> void {
+			DWORD bytes = 0;
+			while (GetOverlappedResult(directory, &overlapped, &bytes, FALSE)) {
+				if (bytes == 0)
+					Logger::Warn("[FileWatcher]: too many changes at once under " + root + ", some were missed");
+
+				for (DWORD offset = 0; bytes > 0;) {
+					const auto info = reinterpret_cast<const FILE_NOTIFY_INFORMATION*>(buffer + offset);
+					if (info->Action == FILE_ACTION_ADDED || info->Action == FILE_ACTION_MODIFIED || info->Action == FILE_ACTION_RENAMED_NEW_NAME) {
+						const int wideLength = static_cast<int>(info->FileNameLength / sizeof(WCHAR));
+						std::string name(WideCharToMultiByte(CP_UTF8, 0, info->FileName, wideLength, nullptr, 0, nullptr, nullptr), '\0');
+						WideCharToMultiByte(CP_UTF8, 0, info->FileName, wideLength, name.data(), static_cast<int>(name.size()), nullptr, nullptr);
+						std::replace(name.begin(), name.end(), '\\', '/');
+						Touch(root + '/' + name, now);
+					}
+
+					if (info->NextEntryOffset == 0)
+						break;
+					offset += info->NextEntryOffset;
+				}
+
+				if (!Issue()) {
+					Logger::Error("[FileWatcher]: stopped watching " + root + ", ReadDirectoryChangesW failed");
+					return;
+				}
+			}
+		}
+#else
+		// NOTE: the directory and every directory below it. 'touchFiles' for a tree that appeared, its files were
+		// written before there was a watch to see them
+		auto AddTree(const std::string& path, bool touchFiles, Clock::time_point now) -> bool {
+			if (!AddDirectory(path))
+				return false;
+
+			std::error_code error;
+			for (auto it = std::filesystem::recursive_directory_iterator(path, error); !error && it != std::filesystem::recursive_directory_iterator(); it.increment(error)) {
+				if (it->is_directory(error))
+					AddDirectory(it->path().generic_string());
+				else if (touchFiles)
+					Touch(it->path().generic_string(), now);
+			}
+
+			return true;
+		}
+
+		auto AddDirectory(const std::string& path) -> bool {
+			const int watch = inotify_add_watch(inotify, path.c_str(), IN_CLOSE_WRITE | IN_MOVED_TO | IN_CREATE | IN_ONLYDIR);
+			if (watch < 0) {
+				Logger::Warn("[FileWatcher]: can't watch " + path + ": " + std::strerror(errno));
+				return false;
+			}
+
+			directories[watch] = path;
+			return true;
+		}
+
+		auto ReadEvents(Clock::time_point now) -> void {
+			alignas(inotify_event) char events[16 << 10];
+			for (;;) {
+				const ssize_t size = read(inotify, events, sizeof(events));
+				if (size <= 0)
+					return;
+
+				for (ssize_t offset = 0; offset < size;) {
+					const auto event = reinterpret_cast<const inotify_event*>(events + offset);
+					offset += sizeof(inotify_event) + event->len;
+
+					if ((event->mask & IN_Q_OVERFLOW) != 0) {
+						Logger::Warn("[FileWatcher]: too many changes at once under " + root + ", some were missed");
+						continue;
+					}
+
+					const auto directory = directories.find(event->wd);
+					if (directory == directories.end())
+						continue;
+					if ((event->mask & IN_IGNORED) != 0) {
+						directories.erase(directory);
+						continue;
+					}
+					if (event->len == 0)
+						continue;
+
+					// NOTE: a file created empty is reported when it's closed after writing, only directories matter here
+					const auto path = directory->second + '/' + event->name;
+					if ((event->mask & IN_ISDIR) != 0)
+						AddTree(path, true, now);
+					else if ((event->mask & (IN_CLOSE_WRITE | IN_MOVED_TO)) != 0)
+						Touch(path, now);
+				}
+			}
+		}
+#endif
+	};
+
+	FileWatcher::FileWatcher() = default;
+
+	FileWatcher::~FileWatcher() = default;
+
+	auto FileWatcher::Watch(const char* directory) -> bool {
+		Stop();
+		auto watch = std::make_unique<State>();
+		watch->root = std::filesystem::path(directory).generic_string();
+		while (watch->root.size() > 1 && watch->root.ends_with('/'))
+			watch->root.pop_back();
+
+#if defined(_WIN32)
+		watch->directory = CreateFileA(directory, FILE_LIST_DIRECTORY, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE, nullptr, OPEN_EXISTING,
+			FILE_FLAG_BACKUP_SEMANTICS | FILE_FLAG_OVERLAPPED, nullptr);
+		if (watch->directory == INVALID_HANDLE_VALUE || !watch->Issue()) {
+			Logger::Error(std::string("[FileWatcher]: can't watch ") + directory);
+			return false;
+		}
+#else
+		watch->inotify = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+		if (watch->inotify < 0) {
+			Logger::Error(std::string("[FileWatcher]: inotify isn't available: ") + std::strerror(errno));
+			return false;
+		}
+
+		if (!watch->AddTree(watch->root, false, Clock::now()))
+			return false;
+#endif
+
+		Logger::Info(std::string("[FileWatcher]: watching ") + directory + " for changes");
+		state = std::move(watch);
+		return true;
+	}
+
+	auto FileWatcher::Stop() -> void {
+		state.reset();
+	}
+
+	auto FileWatcher::Poll(std::vector<FileChange>& changes) -> u32 {
+		if (state == nullptr)
+			return 0;
+
+		const auto now = Clock::now();
+		state->ReadEvents(now);
+
+		u32 count = 0;
+		for (auto it = state->settling.begin(); it != state->settling.end();) {
+			if (now - it->second.lastSeen < SettleTime) {
+				++it;
+				continue;
+			}
+
+			changes.push_back(FileChange{ .path = it->first, .firstSeen = it->second.firstSeen });
+			it = state->settling.erase(it);
+			count++;
+		}
+
+		return count;
+	}
+}
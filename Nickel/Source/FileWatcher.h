@@ -0,0 +1,42 @@
+#pragma once
+
+#include "platform.h"
+#include <chrono>
+#include <memory>
+#include <string>
+#include <vector>
+
+// Reports the files that changed under a directory tree, for hot reloading. On Linux every directory gets an inotify
+// watch and new directories get theirs as they appear, on Windows one ReadDirectoryChangesW covers the whole tree.
+// Both are polled, nothing runs between two polls. Editors save in several steps (truncate and write, or write a
+// temporary file and rename it over the old one), so a file is reported once it has been quiet for a few tens of
+// milliseconds, once per burst of events.
+namespace Nickel {
+	struct FileChange {
+		std::string path; // NOTE: the watched directory joined with the path below it, '/' separators
+		std::chrono::steady_clock::time_point firstSeen; // NOTE: the burst's first event
+	};
+
+	class FileWatcher {
+	public:
+		FileWatcher();
+		~FileWatcher();
+
+		FileWatcher(const FileWatcher&) = delete;
+		auto operator=(const FileWatcher&) -> FileWatcher& = delete;
+
+		auto Watch(const char* directory) -> bool; // NOTE: logs and returns false when it can't be watched
+		auto Stop() -> void;
+
+		// NOTE: appends the files written, created or renamed into place that settled since the last call. Never
+		// blocks, returns the number appended
+		auto Poll(std::vector<FileChange>& changes) -> u32;
+
+		inline auto IsWatching() const -> bool { return state != nullptr; }
+
+	private:
+		struct State; // NOTE: the OS watch and the changes still settling, platform specific
+
+		std::unique_ptr<State> state;
+	};
+}
@@ -0,0 +1,871 @@
+#include "GltfLoader.h"
+#include "AssetArchive.h"
+#include "Threading.h"
+#include <algorithm>
+#include <cctype>
+#include <charconv>
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include <filesystem>
+#include <string_view>
+#include <vector>
+
+namespace Nickel::Gltf {
+	namespace {
+		constexpr u32 MaxDepth = 64; // NOTE: of JSON nesting and of the node hierarchy, deeper files are rejected instead of overflowing the stack
+
+		constexpr u32 GlbMagic = 0x46546C67; // NOTE: "glTF"
+		constexpr u32 GlbChunkJson = 0x4E4F534A; // NOTE: "JSON"
+		constexpr u32 GlbChunkBin = 0x004E4942; // NOTE: "BIN\0"
+
+		constexpr u32 ModeTriangles = 4;
+
+		enum class ComponentType : u32 {
+			Byte = 5120,
+			UnsignedByte = 5121,
+			Short = 5122,
+			UnsignedShort = 5123,
+			UnsignedInt = 5125,
+			Float = 5126
+		};
+
+		struct JsonValue {
+			enum class Type : u8 { Null, Bool, Number, String, Array, Object };
+
+			Type type = Type::Null;
+			bool boolean = false;
+			f64 number = 0.0;
+			std::string string;
+			std::vector<JsonValue> items; // NOTE: array elements or object members
+			std::vector<std::string> keys; // NOTE: the object members' names, same order as 'items'
+
+			auto Find(std::string_view key) const -> const JsonValue* {
+				if (type != Type::Object)
+					return nullptr;
+
+				for (u32 i = 0; i < keys.size(); i++) {
+					if (keys[i] == key)
+						return &items[i];
+				}
+
+				return nullptr;
+			}
+
+			auto At(u64 index) const -> const JsonValue* {
+				return type == Type::Array && index < items.size() ? &items[index] : nullptr;
+			}
+
+			inline auto IsObject() const -> bool { return type == Type::Object; }
+			inline auto IsArray() const -> bool { return type == Type::Array; }
+		};
+
+		// NOTE: recursive descent over the whole text, a glTF's JSON is small next to its buffers
+		class JsonParser {
+		public:
+			JsonParser(std::string_view text) : cursor(text.data()), end(text.data() + text.size()) {}
+
+			auto Parse(JsonValue& value) -> bool {
+				if (!ParseValue(value, 0))
+					return false;
+
+				SkipWhitespace();
+				return cursor == end;
+			}
+
+		private:
+			auto SkipWhitespace() -> void {
+				while (cursor < end && (*cursor == ' ' || *cursor == '\t' || *cursor == '\n' || *cursor == '\r'))
+					cursor++;
+			}
+
+			auto Consume(std::string_view literal) -> bool {
+				if (static_cast<u64>(end - cursor) < literal.size() || std::string_view(cursor, literal.size()) != literal)
+					return false;
+
+				cursor += literal.size();
+				return true;
+			}
+
+			auto ParseValue(JsonValue& value, u32 depth) -> bool {
+				SkipWhitespace();
+				if (cursor == end || depth > MaxDepth)
+					return false;
+
+				switch (*cursor) {
+					case '{': return ParseObject(value, depth);
+					case '[': return ParseArray(value, depth);
+					case '"':
+						value.type = JsonValue::Type::String;
+						return ParseString(value.string);
+					case 't':
+						value.type = JsonValue::Type::Bool;
+						value.boolean = true;
+						return Consume("true");
+					case 'f':
+						value.type = JsonValue::Type::Bool;
+						return Consume("false");
+					case 'n':
+						return Consume("null");
+					default:
+						return ParseNumber(value);
+				}
+			}
+
+			auto ParseObject(JsonValue& value, u32 depth) -> bool {
+				value.type = JsonValue::Type::Object;
+				cursor++;
+				SkipWhitespace();
+				if (cursor < end && *cursor == '}') {
+					cursor++;
+					return true;
+				}
+
+				while (true) {
+					SkipWhitespace();
+					if (cursor == end || *cursor != '"' || !ParseString(value.keys.emplace_back()))
+						return false;
+
+					SkipWhitespace();
+					if (cursor == end || *cursor++ != ':' || !ParseValue(value.items.emplace_back(), depth + 1))
+						return false;
+
+					SkipWhitespace();
+					if (cursor == end)
+						return false;
+					if (*cursor == '}') {
+						cursor++;
+						return true;
+					}
+					if (*cursor++ != ',')
+						return false;
+				}
+			}
+
+			auto ParseArray(JsonValue& value, u32 depth) -> bool {
+				value.type = JsonValue::Type::Array;
+				cursor++;
+				SkipWhitespace();
+				if (cursor < end && *cursor == ']') {
+					cursor++;
+					return true;
+				}
+
+				while (true) {
+					if (!ParseValue(value.items.emplace_back(), depth + 1))
+						return false;
+
+					SkipWhitespace();
+					if (cursor == end)
+						return false;
+					if (*cursor == ']') {
+						cursor++;
+						return true;
+					}
+					if (*cursor++ != ',')
+						return false;
+				}
+			}
+
+			auto ParseHex(u32& codePoint) -> bool {
+				if (end - cursor < 4)
+					return false;
+
+				const auto [next, error] = std::from_chars(cursor, cursor + 4, codePoint, 16);
+				if (error != std::errc{} || next != cursor + 4)
+					return false;
+
+				cursor += 4;
+				return true;
+			}
+
+			auto ParseString(std::string& string) -> bool {
+				cursor++;
+				while (cursor < end && *cursor != '"') {
+					if (*cursor != '\\') {
+						string.push_back(*cursor++);
+						continue;
+					}
+
+					if (++cursor == end)
+						return false;
+
+					switch (*cursor++) {
+						case '"': string.push_back('"'); break;
+						case '\\': string.push_back('\\'); break;
+						case '/': string.push_back('/'); break;
+						case 'b': string.push_back('\b'); break;
+						case 'f': string.push_back('\f'); break;
+						case 'n': string.push_back('\n'); break;
+						case 'r': string.push_back('\r'); break;
+						case 't': string.push_back('\t'); break;
+						case 'u': {
+							u32 codePoint;
+							if (!ParseHex(codePoint))
+								return false;
+
+							// NOTE: a surrogate pair is two escapes, a lone surrogate is kept as is
+							if (codePoint >= 0xD800 && codePoint < 0xDC00 && end - cursor >= 6 && cursor[0] == '\\' && cursor[1] == 'u') {
+								cursor += 2;
+								u32 low;
+								if (!ParseHex(low))
+									return false;
+								if (low >= 0xDC00 && low < 0xE000)
+									codePoint = 0x10000 + ((codePoint - 0xD800) << 10) + (low - 0xDC00);
+							}
+
+							AppendUtf8(string, codePoint);
+							break;
+						}
+						default:
+							return false;
+					}
+				}
+
+				if (cursor == end)
+					return false;
+
+				cursor++;
+				return true;
+			}
+
+			static auto AppendUtf8(std::string& string, u32 codePoint) -> void {
+				if (codePoint < 0x80) {
+					string.push_back(static_cast<char>(codePoint));
+				} else if (codePoint < 0x800) {
+					string.push_back(static_cast<char>(0xC0 | (codePoint >> 6)));
+					string.push_back(static_cast<char>(0x80 | (codePoint & 0x3F)));
+				} else if (codePoint < 0x10000) {
+					string.push_back(static_cast<char>(0xE0 | (codePoint >> 12)));
+					string.push_back(static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F)));
+					string.push_back(static_cast<char>(0x80 | (codePoint & 0x3F)));
+				} else {
+					string.push_back(static_cast<char>(0xF0 | (codePoint >> 18)));
+					string.push_back(static_cast<char>(0x80 | ((codePoint >> 12) & 0x3F)));
+					string.push_back(static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F)));
+					string.push_back(static_cast<char>(0x80 | (codePoint & 0x3F)));
+				}
+			}
+
+			auto ParseNumber(JsonValue& value) -> bool {
+				value.type = JsonValue::Type::Number;
+				const auto [next, error] = std::from_chars(cursor, end, value.number);
+				if (error != std::errc{} || next == cursor)
+					return false;
+
+				cursor = next;
+				return true;
+			}
+
+			const char* cursor;
+			const char* end;
+		};
+
+		// NOTE: 'fallback' when the member is missing, -1 when it isn't a non-negative integer so the bounds checks
+		// reject it
+		auto GetIndex(const JsonValue& object, std::string_view key, i64 fallback = -1) -> i64 {
+			const auto value = object.Find(key);
+			if (value == nullptr)
+				return fallback;
+			if (value->type != JsonValue::Type::Number || value->number < 0.0 || value->number != std::floor(value->number) || value->number > 9.0e15)
+				return -1;
+
+			return static_cast<i64>(value->number);
+		}
+
+		auto GetString(const JsonValue& object, std::string_view key) -> std::string_view {
+			const auto value = object.Find(key);
+			return value != nullptr && value->type == JsonValue::Type::String ? std::string_view(value->string) : std::string_view();
+		}
+
+		auto GetComponentSize(ComponentType type) -> u32 {
+			switch (type) {
+				case ComponentType::Byte:
+				case ComponentType::UnsignedByte: return 1;
+				case ComponentType::Short:
+				case ComponentType::UnsignedShort: return 2;
+				case ComponentType::UnsignedInt:
+				case ComponentType::Float: return 4;
+				default: return 0;
+			}
+		}
+
+		auto GetComponentCount(std::string_view type) -> u32 {
+			if (type == "SCALAR") return 1;
+			if (type == "VEC2") return 2;
+			if (type == "VEC3") return 3;
+			if (type == "VEC4") return 4;
+			return 0; // NOTE: matrices, never a vertex attribute this loader reads
+		}
+
+		auto DecodeBase64(std::string_view text, std::vector<u8>& bytes) -> bool {
+			bytes.reserve(text.size() / 4 * 3);
+			u32 bits = 0, bitCount = 0;
+			for (const char c : text) {
+				u32 value;
+				if (c >= 'A' && c <= 'Z') value = c - 'A';
+				else if (c >= 'a' && c <= 'z') value = c - 'a' + 26;
+				else if (c >= '0' && c <= '9') value = c - '0' + 52;
+				else if (c == '+' || c == '-') value = 62;
+				else if (c == '/' || c == '_') value = 63;
+				else if (c == '=') break;
+				else return false;
+
+				bits = (bits << 6) | value;
+				bitCount += 6;
+				if (bitCount >= 8) {
+					bitCount -= 8;
+					bytes.push_back(static_cast<u8>(bits >> bitCount));
+				}
+			}
+
+			return true;
+		}
+
+		// NOTE: relative URIs are percent encoded, "my%20model.bin" is a file with a space in its name
+		auto DecodeUri(std::string_view uri) -> std::string {
+			std::string path;
+			path.reserve(uri.size());
+			for (u64 i = 0; i < uri.size(); i++) {
+				u32 value;
+				if (uri[i] == '%' && i + 2 < uri.size() && std::from_chars(uri.data() + i + 1, uri.data() + i + 3, value, 16).ptr == uri.data() + i + 3) {
+					path.push_back(static_cast<char>(value));
+					i += 2;
+				} else {
+					path.push_back(uri[i]);
+				}
+			}
+
+			return path;
+		}
+
+		// NOTE: an accessor's elements inside their mapped buffer, bounds already checked
+		struct Accessor {
+			const u8* data = nullptr;
+			u32 count = 0;
+			u32 stride = 0;
+			u32 components = 0;
+			ComponentType componentType = ComponentType::Float;
+			bool normalized = false;
+
+			inline auto IsValid() const -> bool { return data != nullptr; }
+
+			// NOTE: 'n' components of element 'i' as floats, normalized integers are mapped to [0, 1] or [-1, 1] as the
+			// spec says, the others converted as they are
+			auto Read(u32 i, f32* values, u32 n) const -> void {
+				const u8* element = data + static_cast<u64>(i) * stride;
+				if (componentType == ComponentType::Float) {
+					std::memcpy(values, element, n * sizeof(f32));
+					return;
+				}
+
+				for (u32 c = 0; c < n; c++) {
+					switch (componentType) {
+						case ComponentType::Byte: {
+							const auto value = static_cast<i8>(element[c]);
+							values[c] = normalized ? std::max(value / 127.0f, -1.0f) : value;
+							break;
+						}
+						case ComponentType::UnsignedByte:
+							values[c] = normalized ? element[c] / 255.0f : element[c];
+							break;
+						case ComponentType::Short: {
+							i16 value;
+							std::memcpy(&value, element + c * 2, sizeof(value));
+							values[c] = normalized ? std::max(value / 32767.0f, -1.0f) : value;
+							break;
+						}
+						case ComponentType::UnsignedShort: {
+							u16 value;
+							std::memcpy(&value, element + c * 2, sizeof(value));
+							values[c] = normalized ? value / 65535.0f : value;
+							break;
+						}
+						default: {
+							u32 value;
+							std::memcpy(&value, element + c * 4, sizeof(value));
+							values[c] = static_cast<f32>(value);
+							break;
+						}
+					}
+				}
+			}
+
+			auto ReadIndex(u32 i) const -> u32 {
+				const u8* element = data + static_cast<u64>(i) * stride;
+				switch (componentType) {
+					case ComponentType::UnsignedByte:
+						return element[0];
+					case ComponentType::UnsignedShort: {
+						u16 value;
+						std::memcpy(&value, element, sizeof(value));
+						return value;
+					}
+					default: {
+						u32 value;
+						std::memcpy(&value, element, sizeof(value));
+						return value;
+					}
+				}
+			}
+
+			inline auto GetBytes() const -> u64 {
+				return count > 0 ? static_cast<u64>(count - 1) * stride + components * GetComponentSize(componentType) : 0;
+			}
+		};
+
+		struct Primitive {
+			Accessor positions;
+			Accessor normals; // NOTE: generated when invalid
+			Accessor uvs; // NOTE: zero when invalid
+			Accessor indices; // NOTE: sequential when invalid
+			u32 indexCount;
+		};
+
+		class Document {
+		public:
+			Document(const std::string& path) : path(path) {}
+
+			auto Load() -> ImportResult {
+				if (!ReadAsset(path, file))
+					return ImportResult::Failed;
+
+				const auto bytes = file.bytes;
+				std::string_view json;
+				std::span<const u8> binChunk;
+				if (bytes.size() >= 12 && ReadU32(bytes, 0) == GlbMagic) {
+					if (!ReadGlb(bytes, json, binChunk))
+						return ImportResult::Failed;
+				} else {
+					json = std::string_view(reinterpret_cast<const char*>(bytes.data()), bytes.size());
+				}
+
+				if (!JsonParser(json).Parse(root) || !root.IsObject())
+					return Fail("the JSON is malformed");
+
+				if (const auto asset = root.Find("asset"); asset == nullptr || !GetString(*asset, "version").starts_with("2."))
+					return Fail("only glTF 2.0 is supported");
+
+				// NOTE: quantized attributes are plain normalized or integer accessors, read like any other
+				if (const auto required = root.Find("extensionsRequired"); required != nullptr && required->IsArray()) {
+					for (const auto& extension : required->items) {
+						if (extension.string != "KHR_mesh_quantization")
+							return Unsupported("requires " + extension.string);
+					}
+				}
+
+				return LoadBuffers(binChunk);
+			}
+
+			// NOTE: the primitives of every mesh the default scene's nodes reference, in depth first order, the same
+			// order assimp lists them in. Files without scenes have every mesh once
+			auto CollectPrimitives(std::vector<Primitive>& primitives) -> ImportResult {
+				const auto meshes = root.Find("meshes");
+				if (meshes == nullptr || !meshes->IsArray())
+					return ImportResult::Loaded;
+
+				const auto scenes = root.Find("scenes");
+				if (scenes == nullptr || !scenes->IsArray() || scenes->items.empty()) {
+					for (u32 i = 0; i < meshes->items.size(); i++) {
+						if (const auto result = AddMesh(i, primitives); result != ImportResult::Loaded)
+							return result;
+					}
+
+					return ImportResult::Loaded;
+				}
+
+				const auto scene = scenes->At(GetIndex(root, "scene", 0));
+				if (scene == nullptr)
+					return Fail("the default scene doesn't exist");
+
+				const auto nodes = scene->Find("nodes");
+				if (nodes == nullptr)
+					return ImportResult::Loaded;
+
+				for (const auto& node : nodes->items) {
+					if (const auto result = AddNode(node.type == JsonValue::Type::Number ? static_cast<i64>(node.number) : -1, 0, primitives); result != ImportResult::Loaded)
+						return result;
+				}
+
+				return ImportResult::Loaded;
+			}
+
+			auto GetBufferBytes() const -> u64 {
+				u64 bytes = 0;
+				for (const auto& buffer : decodedBuffers)
+					bytes += buffer.size();
+				return bytes;
+			}
+
+			inline auto GetBufferPaths() const -> const std::vector<std::string>& { return bufferPaths; }
+
+		private:
+			static auto ReadU32(std::span<const u8> bytes, u64 offset) -> u32 {
+				u32 value;
+				std::memcpy(&value, bytes.data() + offset, sizeof(value));
+				return value;
+			}
+
+			auto ReadGlb(std::span<const u8> bytes, std::string_view& json, std::span<const u8>& binChunk) -> bool {
+				if (ReadU32(bytes, 4) != 2 || ReadU32(bytes, 8) > bytes.size()) {
+					Fail("the GLB header is invalid");
+					return false;
+				}
+
+				// NOTE: the JSON chunk comes first, an optional BIN chunk after it, unknown chunks are skipped
+				const u64 length = ReadU32(bytes, 8);
+				for (u64 offset = 12; offset + 8 <= length;) {
+					const u64 chunkLength = ReadU32(bytes, offset);
+					const u32 chunkType = ReadU32(bytes, offset + 4);
+					if (offset + 8 + chunkLength > length) {
+						Fail("a GLB chunk runs past the end of the file");
+						return false;
+					}
+
+					const auto chunk = bytes.subspan(offset + 8, chunkLength);
+					if (chunkType == GlbChunkJson && json.empty())
+						json = std::string_view(reinterpret_cast<const char*>(chunk.data()), chunk.size());
+					else if (chunkType == GlbChunkBin && binChunk.empty())
+						binChunk = chunk;
+
+					offset += 8 + ((chunkLength + 3) & ~3ull);
+				}
+
+				if (json.empty()) {
+					Fail("the GLB has no JSON chunk");
+					return false;
+				}
+
+				return true;
+			}
+
+			auto LoadBuffers(std::span<const u8> binChunk) -> ImportResult {
+				const auto buffers = root.Find("buffers");
+				if (buffers == nullptr)
+					return ImportResult::Loaded;
+
+				const auto directory = std::filesystem::path(path).parent_path();
+				bufferData.resize(buffers->items.size());
+				for (u32 i = 0; i < buffers->items.size(); i++) {
+					const auto& buffer = buffers->items[i];
+					const i64 length = GetIndex(buffer, "byteLength");
+					if (length < 0)
+						return Fail("buffer " + std::to_string(i) + " has no byte length");
+
+					std::span<const u8> bytes;
+					const auto uri = GetString(buffer, "uri");
+					if (uri.empty()) {
+						bytes = binChunk; // NOTE: only the first buffer of a GLB may leave it out
+					} else if (uri.starts_with("data:")) {
+						const u64 base64 = uri.find(";base64,");
+						if (base64 == std::string_view::npos || !DecodeBase64(uri.substr(base64 + 8), decodedBuffers.emplace_back()))
+							return Fail("buffer " + std::to_string(i) + " has an invalid data URI");
+						bytes = decodedBuffers.back();
+					} else {
+						const auto bufferPath = (directory / DecodeUri(uri)).string();
+						if (!ReadAsset(bufferPath, files.emplace_back()))
+							return Fail("buffer " + std::to_string(i) + " can't be read");
+						bytes = files.back().bytes;
+						bufferPaths.push_back(bufferPath);
+					}
+
+					// NOTE: a GLB's BIN chunk is padded to 4 bytes, the buffer is what the JSON says
+					if (bytes.size() < static_cast<u64>(length))
+						return Fail("buffer " + std::to_string(i) + " is shorter than its byte length");
+					bufferData[i] = bytes.first(length);
+				}
+
+				return ImportResult::Loaded;
+			}
+
+			auto AddNode(i64 index, u32 depth, std::vector<Primitive>& primitives) -> ImportResult {
+				const auto nodes = root.Find("nodes");
+				const auto node = nodes != nullptr ? nodes->At(index) : nullptr;
+				if (node == nullptr || depth > MaxDepth)
+					return Fail("the node hierarchy is invalid");
+
+				if (node->Find("mesh") != nullptr) {
+					if (const auto result = AddMesh(GetIndex(*node, "mesh"), primitives); result != ImportResult::Loaded)
+						return result;
+				}
+
+				if (const auto children = node->Find("children"); children != nullptr) {
+					for (const auto& child : children->items) {
+						if (const auto result = AddNode(child.type == JsonValue::Type::Number ? static_cast<i64>(child.number) : -1, depth + 1, primitives); result != ImportResult::Loaded)
+							return result;
+					}
+				}
+
+				return ImportResult::Loaded;
+			}
+
+			auto AddMesh(i64 index, std::vector<Primitive>& primitives) -> ImportResult {
+				const auto meshes = root.Find("meshes");
+				const auto mesh = meshes != nullptr ? meshes->At(index) : nullptr;
+				const auto meshPrimitives = mesh != nullptr ? mesh->Find("primitives") : nullptr;
+				if (meshPrimitives == nullptr || !meshPrimitives->IsArray())
+					return Fail("mesh " + std::to_string(index) + " is invalid");
+
+				for (const auto& source : meshPrimitives->items) {
+					if (GetIndex(source, "mode", ModeTriangles) != ModeTriangles)
+						return Unsupported("mesh " + std::to_string(index) + " isn't made of triangle lists");
+
+					const auto attributes = source.Find("attributes");
+					if (attributes == nullptr || attributes->Find("POSITION") == nullptr)
+						return Fail("a primitive of mesh " + std::to_string(index) + " has no positions");
+
+					auto& primitive = primitives.emplace_back();
+					if (const auto result = ResolveAccessor(GetIndex(*attributes, "POSITION"), 3, primitive.positions); result != ImportResult::Loaded)
+						return result;
+
+					const auto vertexCount = primitive.positions.count;
+					if (attributes->Find("NORMAL") != nullptr) {
+						if (const auto result = ResolveAccessor(GetIndex(*attributes, "NORMAL"), 3, primitive.normals); result != ImportResult::Loaded)
+							return result;
+					}
+					if (attributes->Find("TEXCOORD_0") != nullptr) {
+						if (const auto result = ResolveAccessor(GetIndex(*attributes, "TEXCOORD_0"), 2, primitive.uvs); result != ImportResult::Loaded)
+							return result;
+					}
+					if ((primitive.normals.IsValid() && primitive.normals.count != vertexCount) || (primitive.uvs.IsValid() && primitive.uvs.count != vertexCount))
+						return Fail("the attributes of a primitive of mesh " + std::to_string(index) + " differ in count");
+
+					primitive.indexCount = vertexCount;
+					if (source.Find("indices") != nullptr) {
+						if (const auto result = ResolveAccessor(GetIndex(source, "indices"), 1, primitive.indices); result != ImportResult::Loaded)
+							return result;
+
+						const auto type = primitive.indices.componentType;
+						if (type != ComponentType::UnsignedByte && type != ComponentType::UnsignedShort && type != ComponentType::UnsignedInt)
+							return Fail("the indices of mesh " + std::to_string(index) + " aren't unsigned integers");
+						primitive.indexCount = primitive.indices.count;
+					}
+
+					if (primitive.indexCount % 3 != 0)
+						return Fail("a primitive of mesh " + std::to_string(index) + " has a partial triangle");
+				}
+
+				return ImportResult::Loaded;
+			}
+
+			// NOTE: at least 'components' components per element, extra ones (a VEC4 where a VEC3 is read) are skipped
+			auto ResolveAccessor(i64 index, u32 components, Accessor& accessor) -> ImportResult {
+				const auto accessors = root.Find("accessors");
+				const auto source = accessors != nullptr ? accessors->At(index) : nullptr;
+				if (source == nullptr)
+					return Fail("accessor " + std::to_string(index) + " doesn't exist");
+
+				if (source->Find("sparse") != nullptr)
+					return Unsupported("accessor " + std::to_string(index) + " is sparse");
+				if (source->Find("bufferView") == nullptr)
+					return Unsupported("accessor " + std::to_string(index) + " has no buffer view");
+
+				const auto viewIndex = GetIndex(*source, "bufferView");
+				const auto views = root.Find("bufferViews");
+				const auto view = views != nullptr ? views->At(viewIndex) : nullptr;
+				if (view == nullptr)
+					return Fail("buffer view " + std::to_string(viewIndex) + " doesn't exist");
+
+				const auto bufferIndex = GetIndex(*view, "buffer");
+				if (bufferIndex < 0 || static_cast<u64>(bufferIndex) >= bufferData.size())
+					return Fail("buffer " + std::to_string(bufferIndex) + " doesn't exist");
+
+				const auto componentType = static_cast<ComponentType>(GetIndex(*source, "componentType"));
+				const u32 componentSize = GetComponentSize(componentType);
+				const u32 componentCount = GetComponentCount(GetString(*source, "type"));
+				if (componentSize == 0 || componentCount < components)
+					return Fail("accessor " + std::to_string(index) + " has the wrong type");
+
+				const i64 count = GetIndex(*source, "count");
+				const i64 accessorOffset = GetIndex(*source, "byteOffset", 0);
+				const i64 viewOffset = GetIndex(*view, "byteOffset", 0);
+				const i64 viewLength = GetIndex(*view, "byteLength");
+				const u64 elementSize = static_cast<u64>(componentCount) * componentSize;
+				const i64 stride = GetIndex(*view, "byteStride", static_cast<i64>(elementSize));
+				if (count < 0 || count > ~0u || accessorOffset < 0 || viewOffset < 0 || viewLength < 0 || stride < static_cast<i64>(elementSize) || stride > 252)
+					return Fail("accessor " + std::to_string(index) + " is malformed");
+
+				const auto buffer = bufferData[bufferIndex];
+				const u64 bytes = count > 0 ? static_cast<u64>(count - 1) * stride + elementSize : 0;
+				if (static_cast<u64>(viewOffset) + viewLength > buffer.size() || static_cast<u64>(accessorOffset) + bytes > static_cast<u64>(viewLength))
+					return Fail("accessor " + std::to_string(index) + " runs past its buffer");
+
+				const auto normalized = source->Find("normalized");
+				accessor = Accessor{
+					.data = buffer.data() + viewOffset + accessorOffset,
+					.count = static_cast<u32>(count),
+					.stride = static_cast<u32>(stride),
+					.components = componentCount,
+					.componentType = componentType,
+					.normalized = normalized != nullptr && normalized->boolean
+				};
+
+				return ImportResult::Loaded;
+			}
+
+			auto Fail(const std::string& reason) -> ImportResult {
+				Logger::Error("[Gltf]: " + path + ": " + reason);
+				return ImportResult::Failed;
+			}
+
+			auto Unsupported(const std::string& reason) -> ImportResult {
+				Logger::Info("[Gltf]: " + path + " " + reason + ", not supported natively");
+				return ImportResult::Unsupported;
+			}
+
+			std::string path;
+			AssetData file;
+			JsonValue root;
+			std::vector<AssetData> files; // NOTE: external buffers
+			std::vector<std::string> bufferPaths;
+			std::vector<std::vector<u8>> decodedBuffers; // NOTE: data URIs
+			std::vector<std::span<const u8>> bufferData; // NOTE: per buffer, pointing into the above or the GLB
+		};
+
+		// NOTE: smooth normals weighted by triangle area, from the already converted positions and winding so they
+		// come out in the converted space
+		auto GenerateNormals(std::span<MeshVertex> vertices, std::span<const u32> indices) -> void {
+			for (auto& vertex : vertices)
+				vertex.normal = {};
+
+			for (u64 i = 0; i + 2 < indices.size(); i += 3) {
+				const auto& a = vertices[indices[i]].position;
+				const auto& b = vertices[indices[i + 1]].position;
+				const auto& c = vertices[indices[i + 2]].position;
+				const f32 ux = b.x - a.x, uy = b.y - a.y, uz = b.z - a.z;
+				const f32 vx = c.x - a.x, vy = c.y - a.y, vz = c.z - a.z;
+				const Vec3 normal = { uy * vz - uz * vy, uz * vx - ux * vz, ux * vy - uy * vx };
+				for (u32 corner = 0; corner < 3; corner++) {
+					auto& sum = vertices[indices[i + corner]].normal;
+					sum = { sum.x + normal.x, sum.y + normal.y, sum.z + normal.z };
+				}
+			}
+
+			for (auto& vertex : vertices) {
+				auto& normal = vertex.normal;
+				const f32 length = std::sqrt(normal.x * normal.x + normal.y * normal.y + normal.z * normal.z);
+				normal = length > 0.0f ? Vec3{ normal.x / length, normal.y / length, normal.z / length } : Vec3{ 0.0f, 1.0f, 0.0f };
+			}
+		}
+
+		// NOTE: straight from the mapped buffers into the upload layout in the assimp path's space: z negated on
+		// positions and normals and every triangle's winding reversed, uvs as stored. False on an index past the
+		// vertices, returns the bounding radius through 'radius'
+		auto WritePrimitive(const Primitive& primitive, MeshVertex* vertices, u32* indices, f32& radius) -> bool {
+			const u32 vertexCount = primitive.positions.count;
+			f32 radiusSquared = 0.0f;
+			for (u32 i = 0; i < vertexCount; i++) {
+				auto& vertex = vertices[i];
+				primitive.positions.Read(i, &vertex.position.x, 3);
+				vertex.position.z = -vertex.position.z;
+				if (primitive.normals.IsValid()) {
+					primitive.normals.Read(i, &vertex.normal.x, 3);
+					vertex.normal.z = -vertex.normal.z;
+				}
+				if (primitive.uvs.IsValid())
+					primitive.uvs.Read(i, &vertex.uv.x, 2);
+				else
+					vertex.uv = {};
+
+				const auto& p = vertex.position;
+				radiusSquared = std::max(radiusSquared, p.x * p.x + p.y * p.y + p.z * p.z);
+			}
+
+			if (primitive.indices.IsValid()) {
+				u32 largest = 0;
+				for (u32 i = 0; i < primitive.indexCount; i += 3) {
+					const u32 a = primitive.indices.ReadIndex(i), b = primitive.indices.ReadIndex(i + 1), c = primitive.indices.ReadIndex(i + 2);
+					indices[i] = c;
+					indices[i + 1] = b;
+					indices[i + 2] = a;
+					largest = std::max({ largest, a, b, c });
+				}
+
+				if (primitive.indexCount > 0 && largest >= vertexCount)
+					return false;
+			} else {
+				for (u32 i = 0; i < primitive.indexCount; i += 3) {
+					indices[i] = i + 2;
+					indices[i + 1] = i + 1;
+					indices[i + 2] = i;
+				}
+			}
+
+			if (!primitive.normals.IsValid())
+				GenerateNormals(std::span{ vertices, vertexCount }, std::span<const u32>{ indices, primitive.indexCount });
+
+			radius = std::sqrt(radiusSquared);
+			return true;
+		}
+	}
+
+	auto IsGltfPath(const std::string& path) -> bool {
+		auto extension = std::filesystem::path(path).extension().string();
+		std::transform(extension.begin(), extension.end(), extension.begin(), [](char c) { return static_cast<char>(std::tolower(static_cast<u8>(c))); });
+		return extension == ".gltf" || extension == ".glb";
+	}
+
+	auto Import(const std::string& path, ImportedModel& model) -> ImportResult {
+		const auto start = std::chrono::steady_clock::now();
+
+		Document document(path);
+		if (const auto result = document.Load(); result != ImportResult::Loaded)
+			return result;
+
+		std::vector<Primitive> primitives;
+		if (const auto result = document.CollectPrimitives(primitives); result != ImportResult::Loaded)
+			return result;
+
+		const auto parsed = std::chrono::steady_clock::now();
+
+		// NOTE: the same arena layout as the assimp path, the vertices of every submesh first, then the indices
+		std::vector<u64> vertexOffsets(primitives.size() + 1), indexOffsets(primitives.size() + 1);
+		u64 sceneBytes = document.GetBufferBytes();
+		for (u32 i = 0; i < primitives.size(); i++) {
+			const auto& primitive = primitives[i];
+			vertexOffsets[i + 1] = vertexOffsets[i] + primitive.positions.count;
+			indexOffsets[i + 1] = indexOffsets[i] + primitive.indexCount;
+			sceneBytes += primitive.positions.GetBytes() + primitive.normals.GetBytes() + primitive.uvs.GetBytes() + primitive.indices.GetBytes();
+		}
+
+		const u64 arenaBytes = vertexOffsets.back() * sizeof(MeshVertex) + indexOffsets.back() * sizeof(u32);
+		auto arena = std::make_unique_for_overwrite<u8[]>(arenaBytes);
+		const auto vertices = reinterpret_cast<MeshVertex*>(arena.get());
+		const auto indices = reinterpret_cast<u32*>(vertices + vertexOffsets.back());
+
+		std::vector<ImportedSubmesh> submeshes(primitives.size());
+		std::vector<u8> written(primitives.size());
+		const u32 primitiveCount = static_cast<u32>(primitives.size());
+		if (primitiveCount > 0) {
+			ParallelForChunks(primitiveCount, std::min(GetWorkerCount(), primitiveCount), [&](u32, u32 begin, u32 end) {
+				for (u32 i = begin; i < end; i++) {
+					auto& submesh = submeshes[i];
+					submesh.vertices = std::span{ vertices + vertexOffsets[i], primitives[i].positions.count };
+					submesh.indices = std::span{ indices + indexOffsets[i], primitives[i].indexCount };
+					written[i] = WritePrimitive(primitives[i], vertices + vertexOffsets[i], indices + indexOffsets[i], submesh.boundingRadius);
+				}
+			});
+		}
+
+		if (std::find(written.begin(), written.end(), 0) != written.end()) {
+			Logger::Error("[Gltf]: " + path + ": an index is past the vertices of its primitive");
+			return ImportResult::Failed;
+		}
+
+		const auto converted = std::chrono::steady_clock::now();
+		model.arena = std::move(arena);
+		model.submeshes = std::move(submeshes);
+		model.files = { path };
+		model.files.insert(model.files.end(), document.GetBufferPaths().begin(), document.GetBufferPaths().end());
+		model.stats = ModelImportStats{
+			.importer = ModelImporter::Native,
+			.parseMilliseconds = std::chrono::duration<f64, std::milli>(parsed - start).count(),
+			.sceneBytes = sceneBytes,
+			.convertMilliseconds = std::chrono::duration<f64, std::milli>(converted - parsed).count(),
+			.arenaBytes = arenaBytes,
+			.peakBytes = sceneBytes + arenaBytes
+		};
+
+		return ImportResult::Loaded;
+	}
+}
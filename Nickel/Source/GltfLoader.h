@@ -0,0 +1,21 @@
+#pragma once
+
+#include "Mesh.h"
+#include <string>
+
+// Reads glTF 2.0 meshes without assimp, from a .gltf with its .bin buffers (or base64 data URIs) and from a .glb. The
+// JSON is parsed once, the buffers come through ReadAsset (mapped, or out of the asset archive) and every accessor is
+// read in place from them while the vertices are written into the model's arena, nothing is copied into an
+// intermediate scene. The result is what the assimp path gives for the same file: the submeshes in scene graph order
+// with node transforms ignored, converted to the engine's left handed space (z negated, winding flipped, uvs as
+// stored). Only what a file lacks is generated, normals from the triangles and indices for non-indexed primitives.
+namespace Nickel::Gltf {
+	enum class ImportResult : u8 {
+		Loaded,
+		Failed,     // NOTE: logged, the file is missing or malformed
+		Unsupported // NOTE: valid glTF this loader doesn't read (required extensions, sparse accessors, points and lines), assimp can import it
+	};
+
+	auto IsGltfPath(const std::string& path) -> bool; // NOTE: by extension, .gltf or .glb
+	auto Import(const std::string& path, ImportedModel& model) -> ImportResult; // NOTE: any thread
+}
@@ -1,18 +1,19 @@
 #pragma once
-#include "Renderer/DX11Layer.h"
+#include "Renderer/RendererPlatformInterface.h"
 
 namespace Nickel::Renderer {
     struct IndexBuffer {
-        std::unique_ptr<ID3D11Buffer, DxDeleter> buffer;
-        // ID3D11Buffer* buffer;
+        BufferHandle buffer;
         u32 offset;
 
-        inline void Create(ID3D11Device1* device, std::span<u32> indexData) {
-            Assert(buffer.get() == nullptr);
-            auto data = D3D11_SUBRESOURCE_DATA{ .pSysMem = indexData.data() };
-            auto rawBuffer = DXLayer::CreateIndexBuffer(device, (sizeof(indexData[0]) * indexData.size()), &data);
-            //buffer = rawBuffer;
-            buffer = std::unique_ptr<ID3D11Buffer, DxDeleter>(rawBuffer);
+        inline void Create(const PlatformInterface& gfx, std::span<const u32> indexData) {
+            Assert(!buffer.IsValid());
+            const auto desc = BufferDesc{
+                .type = BufferType::Index,
+                .size = static_cast<u32>(sizeof(indexData[0]) * indexData.size())
+            };
+
+            buffer = gfx.CreateBuffer(desc, indexData.data());
             offset = 0;
         }
     };
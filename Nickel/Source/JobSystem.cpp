@@ -0,0 +1,359 @@
+#include "JobSystem.h"
+
+namespace Nickel {
+	namespace {
+		thread_local const JobSystem* currentSystem = nullptr;
+		thread_local u32 currentThread = 0;
+
+		constexpr u32 IdleSpins = 64; // NOTE: yields before a worker goes to sleep, jobs often come in bursts
+	}
+
+	auto JobSystem::Deque::Push(Job* job) -> bool {
+		const i64 b = bottom.load(std::memory_order_relaxed);
+		const i64 t = top.load(std::memory_order_acquire);
+		if (b - t >= Capacity)
+			return false;
+
+		buffer[b & (Capacity - 1)].store(job, std::memory_order_relaxed);
+		std::atomic_thread_fence(std::memory_order_release);
+		bottom.store(b + 1, std::memory_order_relaxed);
+		return true;
+	}
+
+	auto JobSystem::Deque::Pop() -> Job* {
+		const i64 b = bottom.load(std::memory_order_relaxed) - 1;
+		bottom.store(b, std::memory_order_relaxed);
+		std::atomic_thread_fence(std::memory_order_seq_cst);
+		i64 t = top.load(std::memory_order_relaxed);
+
+		if (t > b) {
+			bottom.store(b + 1, std::memory_order_relaxed);
+			return nullptr;
+		}
+
+		Job* job = buffer[b & (Capacity - 1)].load(std::memory_order_relaxed);
+		if (t == b) {
+			// NOTE: the last job, a thief may be taking it at the same time
+			if (!top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+				job = nullptr;
+			bottom.store(b + 1, std::memory_order_relaxed);
+		}
+
+		return job;
+	}
+
+	auto JobSystem::Deque::Steal() -> Job* {
+		i64 t = top.load(std::memory_order_acquire);
+		std::atomic_thread_fence(std::memory_order_seq_cst);
+		const i64 b = bottom.load(std::memory_order_acquire);
+		if (t >= b)
+			return nullptr;
+
+		Job* job = buffer[t & (Capacity - 1)].load(std::memory_order_relaxed);
+		if (!top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+			return nullptr;
+
+		return job;
+	}
+
+	JobSystem::JobSystem(u32 threadCount) {
+		threadCount = std::max(threadCount, 1u);
+		mainThreadId = std::this_thread::get_id();
+
+		threads.reserve(threadCount);
+		for (u32 i = 0; i < threadCount; i++)
+			threads.push_back(std::make_unique<ThreadState>());
+
+		workers.reserve(threadCount - 1);
+		for (u32 i = 1; i < threadCount; i++)
+			workers.emplace_back([this, i]() { WorkerMain(i); });
+	}
+
+	JobSystem::~JobSystem() {
+		stopping.store(true);
+		{
+			std::lock_guard lock(sleepMutex);
+		}
+		wake.notify_all();
+
+		for (auto& worker : workers)
+			worker.join();
+
+		const auto leftover = externalJobs.size() + mainThreadJobs.size() + backgroundJobs.size();
+		if (leftover > 0)
+			Logger::Warn("[JobSystem]: " + std::to_string(leftover) + " jobs never ran");
+
+		for (auto* jobs : { &externalJobs, &mainThreadJobs, &backgroundJobs }) {
+			for (Job* job : *jobs)
+				delete job;
+		}
+	}
+
+	auto JobSystem::Get() -> JobSystem& {
+		static JobSystem system(std::max(GetWorkerCount(), 2u));
+		return system;
+	}
+
+	auto JobSystem::GetThreadIndex() const -> u32 {
+		if (currentSystem == this)
+			return currentThread;
+
+		return std::this_thread::get_id() == mainThreadId ? 0 : InvalidThread;
+	}
+
+	auto JobSystem::IsMainThread() const -> bool {
+		return std::this_thread::get_id() == mainThreadId;
+	}
+
+	auto JobSystem::GetStats() const -> JobStats {
+		JobStats stats{ .mainThreadJobsRun = mainThreadJobsRun.load(std::memory_order_relaxed) };
+		for (const auto& thread : threads) {
+			stats.jobsRun += thread->jobsRun.load(std::memory_order_relaxed);
+			stats.jobsStolen += thread->jobsStolen.load(std::memory_order_relaxed);
+			stats.inlineRuns += thread->inlineRuns.load(std::memory_order_relaxed);
+		}
+
+		return stats;
+	}
+
+	auto JobSystem::AllocateJob() -> Job* {
+		const u32 threadIdx = GetThreadIndex();
+		auto& thread = *threads[threadIdx];
+
+		Job* job = &thread.jobs[thread.nextJob++ % JobPoolSize];
+		// NOTE: the ring wrapped around onto a job that's still queued, held back or running. Waiting for it could wait
+		// on the job calling this, one that creates more jobs than the ring holds before its Wait, so the caller takes
+		// one from the heap instead
+		if (job->inFlight.load(std::memory_order_acquire))
+			return nullptr;
+
+		job->inFlight.store(true, std::memory_order_relaxed);
+		return job;
+	}
+
+	auto JobSystem::Submit(Job* job, JobCounter* dependency) -> void {
+		if (dependency == nullptr) {
+			Schedule(job);
+			return;
+		}
+
+		Job* head = dependency->held.load();
+		do {
+			job->next = head;
+		} while (!dependency->held.compare_exchange_weak(head, job));
+
+		// NOTE: the counter may have reached zero before the job was on the list, nobody else would release it then
+		if (dependency->value.load() == 0)
+			ReleaseHeld(*dependency);
+	}
+
+	auto JobSystem::Schedule(Job* job) -> void {
+		if (job->mainThread) {
+			std::lock_guard lock(externalMutex);
+			mainThreadJobs.push_back(job);
+			mainThreadJobCount.fetch_add(1);
+			return;
+		}
+
+		if (job->background) {
+			{
+				std::lock_guard lock(externalMutex);
+				backgroundJobs.push_back(job);
+				backgroundJobCount.fetch_add(1);
+			}
+			queuedJobs.fetch_add(1);
+			WakeWorkers();
+			return;
+		}
+
+		const u32 threadIdx = GetThreadIndex();
+		if (threadIdx == InvalidThread) {
+			{
+				std::lock_guard lock(externalMutex);
+				externalJobs.push_back(job);
+				externalJobCount.fetch_add(1);
+			}
+			queuedJobs.fetch_add(1);
+			WakeWorkers();
+			return;
+		}
+
+		auto& thread = *threads[threadIdx];
+		if (!thread.deque.Push(job)) {
+			thread.inlineRuns.fetch_add(1, std::memory_order_relaxed);
+			Execute(*job);
+			return;
+		}
+
+		queuedJobs.fetch_add(1);
+		WakeWorkers();
+	}
+
+	auto JobSystem::Execute(Job& job) -> void {
+		JobCounter* signal = job.signal;
+		job.run(job);
+
+		// NOTE: the slot can be reused as soon as it's released, nothing of the job is touched after this
+		if (job.heapAllocated)
+			delete &job;
+		else
+			job.inFlight.store(false, std::memory_order_release);
+
+		if (signal != nullptr)
+			Release(*signal);
+	}
+
+	auto JobSystem::Release(JobCounter& counter) -> void {
+		counter.releasing.fetch_add(1);
+		if (counter.value.fetch_sub(1) == 1)
+			ReleaseHeld(counter);
+		counter.releasing.fetch_sub(1);
+	}
+
+	auto JobSystem::ReleaseHeld(JobCounter& counter) -> void {
+		Job* job = counter.held.exchange(nullptr);
+		while (job != nullptr) {
+			Job* next = job->next;
+			Schedule(job);
+			job = next;
+		}
+	}
+
+	auto JobSystem::FindJob(u32 threadIdx) -> Job* {
+		auto& self = *threads[threadIdx];
+		if (Job* job = self.deque.Pop()) {
+			queuedJobs.fetch_sub(1);
+			return job;
+		}
+
+		if (externalJobCount.load(std::memory_order_relaxed) > 0) {
+			std::lock_guard lock(externalMutex);
+			if (!externalJobs.empty()) {
+				Job* job = externalJobs.back();
+				externalJobs.pop_back();
+				externalJobCount.fetch_sub(1);
+				queuedJobs.fetch_sub(1);
+				return job;
+			}
+		}
+
+		// NOTE: starts at the last deque that had work, a thread spawning a burst of jobs usually has more
+		const u32 threadCount = GetThreadCount();
+		for (u32 i = 0; i < threadCount; i++) {
+			const u32 victim = (self.nextVictim + i) % threadCount;
+			if (victim == threadIdx)
+				continue;
+
+			if (Job* job = threads[victim]->deque.Steal()) {
+				self.nextVictim = victim;
+				self.jobsStolen.fetch_add(1, std::memory_order_relaxed);
+				queuedJobs.fetch_sub(1);
+				return job;
+			}
+		}
+
+		return nullptr;
+	}
+
+	auto JobSystem::TryRunMainThreadJob() -> bool {
+		if (mainThreadJobCount.load(std::memory_order_relaxed) == 0)
+			return false;
+
+		Job* job = nullptr;
+		{
+			std::lock_guard lock(externalMutex);
+			if (mainThreadJobs.empty())
+				return false;
+			job = mainThreadJobs.front();
+			mainThreadJobs.erase(mainThreadJobs.begin());
+			mainThreadJobCount.fetch_sub(1);
+		}
+
+		Execute(*job);
+		mainThreadJobsRun.fetch_add(1, std::memory_order_relaxed);
+		return true;
+	}
+
+	auto JobSystem::TryRunJob(u32 threadIdx, bool background) -> bool {
+		if (threadIdx == 0 && IsMainThread() && TryRunMainThreadJob())
+			return true;
+
+		Job* job = FindJob(threadIdx);
+		if (job == nullptr && background && backgroundJobCount.load(std::memory_order_relaxed) > 0) {
+			std::lock_guard lock(externalMutex);
+			if (!backgroundJobs.empty()) {
+				job = backgroundJobs.front();
+				backgroundJobs.erase(backgroundJobs.begin());
+				backgroundJobCount.fetch_sub(1);
+				queuedJobs.fetch_sub(1);
+			}
+		}
+
+		if (job == nullptr)
+			return false;
+
+		Execute(*job);
+		threads[threadIdx]->jobsRun.fetch_add(1, std::memory_order_relaxed);
+		return true;
+	}
+
+	auto JobSystem::Wait(JobCounter& counter) -> void {
+		const u32 threadIdx = GetThreadIndex();
+		while (!counter.IsDone()) {
+			if (threadIdx == InvalidThread || !TryRunJob(threadIdx))
+				std::this_thread::yield();
+		}
+	}
+
+	auto JobSystem::RunMainThreadJobs() -> u32 {
+		Assert(IsMainThread());
+
+		std::vector<Job*> jobs;
+		{
+			std::lock_guard lock(externalMutex);
+			jobs.swap(mainThreadJobs);
+			mainThreadJobCount.store(0);
+		}
+
+		// NOTE: jobs queued while these run wait for the next call, a job that queues itself can't spin forever
+		for (Job* job : jobs)
+			Execute(*job);
+
+		mainThreadJobsRun.fetch_add(jobs.size(), std::memory_order_relaxed);
+		return static_cast<u32>(jobs.size());
+	}
+
+	auto JobSystem::WakeWorkers() -> void {
+		if (sleepingWorkers.load() == 0)
+			return;
+
+		{
+			std::lock_guard lock(sleepMutex);
+		}
+		wake.notify_one();
+	}
+
+	auto JobSystem::WorkerMain(u32 threadIdx) -> void {
+		currentSystem = this;
+		currentThread = threadIdx;
+
+		u32 idle = 0;
+		while (!stopping.load(std::memory_order_relaxed)) {
+			if (TryRunJob(threadIdx, true)) {
+				idle = 0;
+				continue;
+			}
+
+			if (++idle < IdleSpins) {
+				std::this_thread::yield();
+				continue;
+			}
+
+			idle = 0;
+			std::unique_lock lock(sleepMutex);
+			sleepingWorkers.fetch_add(1);
+			wake.wait(lock, [this]() { return stopping.load() || queuedJobs.load() > 0; });
+			sleepingWorkers.fetch_sub(1);
+		}
+	}
+}
@@ -0,0 +1,282 @@
+#pragma once
+
+#include "platform.h"
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <span>
+#include <thread>
+#include <vector>
+
+// Work-stealing job scheduler. Every thread of a JobSystem (the thread that created it plus the workers) owns a
+// Chase-Lev deque: it pushes and pops its own jobs at the bottom, idle threads steal from the top of the others.
+// A job decrements its JobCounter when it finishes, waiting on a counter runs other jobs instead of blocking, and a job
+// can be held back until another counter reaches zero. Jobs that must run on the main thread (device calls) are queued
+// separately and only run from RunMainThreadJobs or while the main thread waits, background jobs (asset decoding) go to
+// a shared queue that only idle workers take from.
+namespace Nickel {
+	inline auto GetWorkerCount() -> u32 {
+		const u32 hardwareThreads = std::thread::hardware_concurrency();
+		return hardwareThreads > 0 ? hardwareThreads : 1;
+	}
+
+	struct Job;
+
+	// NOTE: number of unfinished jobs, zero once everything it was passed to is done. Has to outlive those jobs, wait on
+	// it before it goes out of scope
+	class JobCounter {
+	public:
+		JobCounter() = default;
+		JobCounter(const JobCounter&) = delete;
+		auto operator=(const JobCounter&) -> JobCounter& = delete;
+
+		// NOTE: the finishing job may still be releasing held back jobs when the value hits zero, done waits for that too
+		inline auto IsDone() const -> bool { return value.load() == 0 && releasing.load() == 0; }
+		inline auto GetValue() const -> u32 { return value.load(std::memory_order_relaxed); }
+
+	private:
+		friend class JobSystem;
+
+		std::atomic<u32> value = 0;
+		std::atomic<u32> releasing = 0;
+		std::atomic<Job*> held = nullptr; // NOTE: intrusive list of jobs waiting for zero
+	};
+
+	constexpr u32 JobSize = 128;
+
+	struct alignas(64) Job {
+		static constexpr u32 PayloadSize = JobSize - 32;
+
+		auto (*run)(Job& job) -> void; // NOTE: calls and destroys the callable in the payload
+		JobCounter* signal;
+		Job* next; // NOTE: link in a counter's held list
+		std::atomic<bool> inFlight;
+		bool heapAllocated; // NOTE: not from a thread's ring (outside the system, a queued kind or the ring was busy), deleted after running
+		bool mainThread;
+		bool background;
+		alignas(16) u8 payload[PayloadSize];
+	};
+	static_assert(sizeof(Job) == JobSize);
+
+	struct JobStats {
+		u64 jobsRun;
+		u64 jobsStolen;
+		u64 mainThreadJobsRun;
+		u64 inlineRuns; // NOTE: pushes that found the deque full and ran the job right away
+	};
+
+	class JobSystem {
+	public:
+		// NOTE: threadCount includes the calling thread, it becomes the main thread of this system
+		explicit JobSystem(u32 threadCount = GetWorkerCount());
+		~JobSystem();
+		JobSystem(const JobSystem&) = delete;
+		auto operator=(const JobSystem&) -> JobSystem& = delete;
+
+		// NOTE: created on first use by the thread that calls it, which should be the main thread. Always has a worker,
+		// even on a single core, so background jobs progress while the main thread renders
+		static auto Get() -> JobSystem&;
+
+		// NOTE: runs fn() on any thread. 'signal' is incremented now and decremented when fn returns, with a 'dependency'
+		// the job doesn't start before that counter reaches zero
+		template <typename Fn>
+		auto Run(Fn&& fn, JobCounter* signal = nullptr, JobCounter* dependency = nullptr) -> void;
+
+		// NOTE: for device calls and anything else tied to the main thread
+		template <typename Fn>
+		auto RunOnMainThread(Fn&& fn, JobCounter* signal = nullptr) -> void;
+
+		// NOTE: long running work like asset decoding, first in first out. Only idle workers pick these up, never a thread
+		// that is waiting, so a frame's Wait can't end up decoding a texture. Needs at least one worker
+		template <typename Fn>
+		auto RunBackground(Fn&& fn, JobCounter* signal = nullptr) -> void;
+
+		auto Wait(JobCounter& counter) -> void; // NOTE: runs other jobs until the counter is done, never sleeps
+		auto RunMainThreadJobs() -> u32; // NOTE: main thread only, returns how many ran. Once per frame
+
+		// NOTE: splits [0, count) into at most 'chunkCount' contiguous ranges and runs fn(chunkIndex, begin, end) for
+		// each, the calling thread takes the first chunk. Chunk boundaries are deterministic so callers can index
+		// per-chunk output.
+		template <typename Fn>
+		auto ParallelForChunks(u32 count, u32 chunkCount, Fn&& fn) -> void;
+
+		// NOTE: fn(T&) for every item, ranges above 'granularity' items are split in halves that idle threads steal
+		template <typename T, typename Fn>
+		auto ParallelFor(std::span<T> items, u32 granularity, Fn&& fn) -> void;
+
+		inline auto GetThreadCount() const -> u32 { return static_cast<u32>(threads.size()); }
+		auto IsMainThread() const -> bool;
+		auto GetStats() const -> JobStats;
+
+	private:
+		static constexpr u32 InvalidThread = ~0u;
+
+		// NOTE: Le, Pop, Cohen, Zappa Nardelli, "Correct and Efficient Work-Stealing for Weak Memory Models", with a
+		// fixed capacity. The owner pushes and pops at the bottom, thieves take from the top
+		class Deque {
+		public:
+			static constexpr i64 Capacity = 4096;
+
+			auto Push(Job* job) -> bool; // NOTE: owner only, false when full
+			auto Pop() -> Job*; // NOTE: owner only
+			auto Steal() -> Job*;
+
+		private:
+			alignas(64) std::atomic<i64> top = 0;
+			alignas(64) std::atomic<i64> bottom = 0;
+			alignas(64) std::atomic<Job*> buffer[Capacity];
+		};
+
+		// NOTE: jobs come from a ring per thread, a slot is reused once the job that had it finished. Jobs created while
+		// the next slot is still taken go to the heap
+		static constexpr u32 JobPoolSize = 2048;
+
+		struct alignas(64) ThreadState {
+			Deque deque;
+			std::unique_ptr<Job[]> jobs = std::make_unique<Job[]>(JobPoolSize);
+			u32 nextJob = 0;
+			u32 nextVictim = 0;
+			std::atomic<u64> jobsRun = 0;
+			std::atomic<u64> jobsStolen = 0;
+			std::atomic<u64> inlineRuns = 0;
+		};
+
+		template <typename Fn>
+		static auto RunPayload(Job& job) -> void {
+			auto* fn = std::launder(reinterpret_cast<Fn*>(job.payload));
+			(*fn)();
+			fn->~Fn();
+		}
+
+		enum class Queue : u8 {
+			Any,
+			MainThread,
+			Background
+		};
+
+		template <typename Fn>
+		auto CreateJob(Fn&& fn, JobCounter* signal, Queue queue) -> Job*;
+
+		auto AllocateJob() -> Job*; // NOTE: nullptr when the thread's next ring slot is still in use
+		auto Submit(Job* job, JobCounter* dependency) -> void;
+		auto Schedule(Job* job) -> void;
+		auto Execute(Job& job) -> void;
+		auto Release(JobCounter& counter) -> void; // NOTE: one job of the counter finished
+		auto ReleaseHeld(JobCounter& counter) -> void;
+		auto TryRunMainThreadJob() -> bool;
+		auto FindJob(u32 threadIdx) -> Job*;
+		auto TryRunJob(u32 threadIdx, bool background = false) -> bool; // NOTE: background jobs only from a worker's idle loop
+		auto WakeWorkers() -> void;
+		auto WorkerMain(u32 threadIdx) -> void;
+		auto GetThreadIndex() const -> u32;
+
+		template <typename T, typename Fn>
+		auto ParallelForRange(std::span<T> items, u32 granularity, Fn& fn, JobCounter& counter) -> void;
+
+		std::vector<std::unique_ptr<ThreadState>> threads; // NOTE: 0 is the main thread
+		std::vector<std::thread> workers;
+		std::thread::id mainThreadId;
+
+		std::mutex externalMutex;
+		std::vector<Job*> externalJobs; // NOTE: from threads outside the system
+		std::vector<Job*> mainThreadJobs;
+		std::vector<Job*> backgroundJobs; // NOTE: oldest first
+		std::atomic<u32> externalJobCount = 0;
+		std::atomic<u32> backgroundJobCount = 0;
+		std::atomic<u32> mainThreadJobCount = 0;
+		std::atomic<u64> mainThreadJobsRun = 0;
+
+		std::atomic<i64> queuedJobs = 0; // NOTE: jobs in deques, the external or the background list, sleeping workers wait for it
+		std::atomic<u32> sleepingWorkers = 0;
+		std::mutex sleepMutex;
+		std::condition_variable wake;
+		std::atomic<bool> stopping = false;
+	};
+
+	template <typename Fn>
+	auto JobSystem::CreateJob(Fn&& fn, JobCounter* signal, Queue queue) -> Job* {
+		using Callable = std::decay_t<Fn>;
+		static_assert(sizeof(Callable) <= Job::PayloadSize, "job captures too much, capture by reference or pass a pointer to the data");
+		static_assert(alignof(Callable) <= 16, "job callable is over-aligned");
+
+		// NOTE: main thread and background jobs can sit in their queue for a long time, they'd pin a ring slot
+		bool heapAllocated = queue != Queue::Any || GetThreadIndex() == InvalidThread;
+		Job* job = heapAllocated ? nullptr : AllocateJob();
+		if (job == nullptr) {
+			job = new Job{};
+			heapAllocated = true;
+		}
+		job->run = &RunPayload<Callable>;
+		job->signal = signal;
+		job->next = nullptr;
+		job->heapAllocated = heapAllocated;
+		job->mainThread = queue == Queue::MainThread;
+		job->background = queue == Queue::Background;
+		new (job->payload) Callable(std::forward<Fn>(fn));
+
+		if (signal != nullptr)
+			signal->value.fetch_add(1);
+
+		return job;
+	}
+
+	template <typename Fn>
+	auto JobSystem::Run(Fn&& fn, JobCounter* signal, JobCounter* dependency) -> void {
+		Submit(CreateJob(std::forward<Fn>(fn), signal, Queue::Any), dependency);
+	}
+
+	template <typename Fn>
+	auto JobSystem::RunOnMainThread(Fn&& fn, JobCounter* signal) -> void {
+		Submit(CreateJob(std::forward<Fn>(fn), signal, Queue::MainThread), nullptr);
+	}
+
+	template <typename Fn>
+	auto JobSystem::RunBackground(Fn&& fn, JobCounter* signal) -> void {
+		Submit(CreateJob(std::forward<Fn>(fn), signal, Queue::Background), nullptr);
+	}
+
+	template <typename Fn>
+	auto JobSystem::ParallelForChunks(u32 count, u32 chunkCount, Fn&& fn) -> void {
+		if (count == 0 || chunkCount == 0)
+			return;
+
+		chunkCount = std::min(chunkCount, count);
+		const u32 chunkSize = (count + chunkCount - 1) / chunkCount;
+
+		JobCounter counter;
+		for (u32 chunkIdx = 1; chunkIdx < chunkCount; chunkIdx++) {
+			const u32 begin = chunkIdx * chunkSize;
+			const u32 end = std::min(begin + chunkSize, count);
+			if (begin >= end)
+				break;
+			Run([&fn, chunkIdx, begin, end]() { fn(chunkIdx, begin, end); }, &counter);
+		}
+
+		fn(0u, 0u, std::min(chunkSize, count));
+		Wait(counter);
+	}
+
+	template <typename T, typename Fn>
+	auto JobSystem::ParallelFor(std::span<T> items, u32 granularity, Fn&& fn) -> void {
+		JobCounter counter;
+		ParallelForRange(items, std::max(granularity, 1u), fn, counter);
+		Wait(counter);
+	}
+
+	template <typename T, typename Fn>
+	auto JobSystem::ParallelForRange(std::span<T> items, u32 granularity, Fn& fn, JobCounter& counter) -> void {
+		// NOTE: the second half goes to the deque first, thieves take the oldest and so the largest ranges
+		while (items.size() > granularity) {
+			const auto half = items.size() / 2;
+			const auto second = items.subspan(half);
+			Run([this, second, granularity, &fn, &counter]() { ParallelForRange(second, granularity, fn, counter); }, &counter);
+			items = items.first(half);
+		}
+
+		for (auto& item : items)
+			fn(item);
+	}
+}
@@ -6,7 +6,7 @@
 #pragma warning(pop)
 
 namespace Nickel {
-    static class Logger {
+    class Logger {
     public:
         static void Init();
 
@@ -0,0 +1,169 @@
+#include "Lz4.h"
+#include <algorithm>
+#include <cstring>
+#include <memory>
+
+namespace Nickel::Lz4 {
+	namespace {
+		constexpr u32 MinMatch = 4;
+		constexpr u64 LastLiterals = 5; // NOTE: the format ends every block with at least this many literals
+		constexpr u64 MatchSearchLimit = 12; // NOTE: and no match starts this close to the end
+		constexpr u32 MaxOffset = 65535;
+		constexpr u32 HashBits = 16;
+
+		inline auto Read32(const u8* p) -> u32 {
+			u32 value;
+			std::memcpy(&value, p, sizeof(value));
+			return value;
+		}
+
+		inline auto Hash(u32 sequence) -> u32 {
+			return (sequence * 2654435761u) >> (32 - HashBits);
+		}
+
+		// NOTE: the 255, 255, ..., rest tail of a length that didn't fit its 4 bits
+		inline auto WriteLength(u8*& out, u64 length) -> void {
+			for (; length >= 255; length -= 255)
+				*out++ = 255;
+			*out++ = static_cast<u8>(length);
+		}
+
+		inline auto ReadLength(const u8*& in, const u8* end, u64& length) -> bool {
+			u8 byte;
+			do {
+				if (in == end)
+					return false;
+				byte = *in++;
+				length += byte;
+			} while (byte == 255);
+
+			return true;
+		}
+
+		// NOTE: token, literal length, literals, then the match when there is one. False when it doesn't fit
+		auto WriteSequence(u8*& out, const u8* outEnd, const u8* literals, u64 literalCount, u32 offset, u64 matchLength) -> bool {
+			const u64 worstCase = 1 + literalCount / 255 + 1 + literalCount + 2 + matchLength / 255 + 1;
+			if (static_cast<u64>(outEnd - out) < worstCase)
+				return false;
+
+			u8* token = out++;
+			*token = static_cast<u8>(std::min<u64>(literalCount, 15) << 4);
+			if (literalCount >= 15)
+				WriteLength(out, literalCount - 15);
+
+			std::memcpy(out, literals, literalCount);
+			out += literalCount;
+			if (matchLength == 0)
+				return true;
+
+			*out++ = static_cast<u8>(offset);
+			*out++ = static_cast<u8>(offset >> 8);
+			const u64 length = matchLength - MinMatch;
+			*token |= static_cast<u8>(std::min<u64>(length, 15));
+			if (length >= 15)
+				WriteLength(out, length - 15);
+
+			return true;
+		}
+	}
+
+	auto Compress(std::span<const u8> source, std::span<u8> destination) -> u64 {
+		const u8* const begin = source.data();
+		const u8* const end = begin + source.size();
+		u8* out = destination.data();
+		const u8* const outEnd = out + destination.size();
+
+		const u8* anchor = begin;
+		if (source.size() > MatchSearchLimit) {
+			// NOTE: positions + 1 so a zeroed table means empty
+			const auto table = std::make_unique<u32[]>(1ull << HashBits);
+			const u8* const searchEnd = end - MatchSearchLimit;
+			const u8* const matchEnd = end - LastLiterals;
+			u32 misses = 0;
+
+			for (const u8* p = begin; p < searchEnd;) {
+				const u32 sequence = Read32(p);
+				u32& slot = table[Hash(sequence)];
+				const u8* candidate = slot != 0 ? begin + slot - 1 : nullptr;
+				slot = static_cast<u32>(p - begin) + 1;
+
+				if (candidate == nullptr || p - candidate > MaxOffset || Read32(candidate) != sequence) {
+					p += 1 + (misses++ >> 6); // NOTE: step further through data that doesn't compress
+					continue;
+				}
+
+				misses = 0;
+				const u8* start = p;
+				while (start > anchor && candidate > begin && start[-1] == candidate[-1]) {
+					start--;
+					candidate--;
+				}
+
+				const u8* matched = p + MinMatch;
+				const u8* reference = candidate + (p - start) + MinMatch;
+				while (matched < matchEnd && *matched == *reference) {
+					matched++;
+					reference++;
+				}
+
+				if (!WriteSequence(out, outEnd, anchor, start - anchor, static_cast<u32>(start - candidate), matched - start))
+					return 0;
+
+				anchor = p = matched;
+			}
+		}
+
+		if (!WriteSequence(out, outEnd, anchor, end - anchor, 0, 0))
+			return 0;
+
+		return out - destination.data();
+	}
+
+	auto Decompress(std::span<const u8> source, std::span<u8> destination) -> bool {
+		const u8* in = source.data();
+		const u8* const inEnd = in + source.size();
+		u8* out = destination.data();
+		u8* const outEnd = out + destination.size();
+
+		while (in < inEnd) {
+			const u8 token = *in++;
+			u64 literalCount = token >> 4;
+			if (literalCount == 15 && !ReadLength(in, inEnd, literalCount))
+				return false;
+			if (static_cast<u64>(inEnd - in) < literalCount || static_cast<u64>(outEnd - out) < literalCount)
+				return false;
+
+			std::memcpy(out, in, literalCount);
+			in += literalCount;
+			out += literalCount;
+			if (in == inEnd)
+				return out == outEnd; // NOTE: the last sequence has literals only
+
+			if (inEnd - in < 2)
+				return false;
+			const u32 offset = in[0] | (in[1] << 8);
+			in += 2;
+			if (offset == 0 || offset > static_cast<u64>(out - destination.data()))
+				return false;
+
+			u64 matchLength = token & 15;
+			if (matchLength == 15 && !ReadLength(in, inEnd, matchLength))
+				return false;
+			matchLength += MinMatch;
+			if (static_cast<u64>(outEnd - out) < matchLength)
+				return false;
+
+			// NOTE: an offset shorter than the match repeats the bytes just written, they have to be copied in order
+			const u8* match = out - offset;
+			if (offset >= matchLength) {
+				std::memcpy(out, match, matchLength);
+				out += matchLength;
+			} else {
+				for (u64 i = 0; i < matchLength; i++)
+					*out++ = *match++;
+			}
+		}
+
+		return false;
+	}
+}
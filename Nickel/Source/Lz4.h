@@ -0,0 +1,17 @@
+#pragma once
+
+#include "platform.h"
+
+// LZ4 block format (no frame header or checksums, the sizes live in whatever stores the block), compatible with the
+// reference implementation in both directions. The compressor is the greedy single-probe one, it trades ratio for
+// packing speed; decompression speed is the same for any compressor. Decompression checks every length and offset
+// against both buffers, a corrupt block fails instead of reading or writing out of bounds.
+namespace Nickel::Lz4 {
+	// NOTE: the most a block of 'size' bytes can grow to, incompressible data gets a little bigger
+	constexpr auto GetCompressBound(u64 size) -> u64 { return size + size / 255 + 16; }
+
+	// NOTE: bytes written, 0 when they don't fit in 'destination'. GetCompressBound always fits
+	auto Compress(std::span<const u8> source, std::span<u8> destination) -> u64;
+	// NOTE: false unless the block decompresses to exactly destination.size() bytes
+	auto Decompress(std::span<const u8> source, std::span<u8> destination) -> bool;
+}
@@ -0,0 +1,125 @@
+#include "MappedFile.h"
+
+#if defined(_WIN32)
+#include <Windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace Nickel {
+	MappedFile::~MappedFile() {
+		Close();
+	}
+
+	MappedFile::MappedFile(MappedFile&& other) noexcept {
+		*this = std::move(other);
+	}
+
+	auto MappedFile::operator=(MappedFile&& other) noexcept -> MappedFile& {
+		if (this != &other) {
+			Close();
+			data = std::exchange(other.data, nullptr);
+			size = std::exchange(other.size, 0);
+#if defined(_WIN32)
+			mapping = std::exchange(other.mapping, nullptr);
+#endif
+		}
+
+		return *this;
+	}
+
+	auto MappedFile::Open(const char* path) -> bool {
+		Close();
+
+#if defined(_WIN32)
+		HANDLE file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+		if (file == INVALID_HANDLE_VALUE) {
+			Logger::Error(std::string("[MappedFile]: failed to open ") + path);
+			return false;
+		}
+
+		LARGE_INTEGER fileSize;
+		if (!GetFileSizeEx(file, &fileSize) || fileSize.QuadPart == 0) {
+			Logger::Error(std::string("[MappedFile]: ") + path + " is empty or its size couldn't be read");
+			CloseHandle(file);
+			return false;
+		}
+
+		// NOTE: the mapping keeps the file alive, the file handle isn't needed past this point
+		HANDLE fileMapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+		CloseHandle(file);
+		if (fileMapping == nullptr) {
+			Logger::Error(std::string("[MappedFile]: failed to create a mapping for ") + path);
+			return false;
+		}
+
+		const void* view = MapViewOfFile(fileMapping, FILE_MAP_READ, 0, 0, 0);
+		if (view == nullptr) {
+			Logger::Error(std::string("[MappedFile]: failed to map ") + path);
+			CloseHandle(fileMapping);
+			return false;
+		}
+
+		mapping = fileMapping;
+		data = static_cast<const u8*>(view);
+		size = static_cast<u64>(fileSize.QuadPart);
+#else
+		const int file = open(path, O_RDONLY | O_CLOEXEC);
+		if (file < 0) {
+			Logger::Error(std::string("[MappedFile]: failed to open ") + path);
+			return false;
+		}
+
+		struct stat fileStat;
+		if (fstat(file, &fileStat) != 0 || fileStat.st_size == 0) {
+			Logger::Error(std::string("[MappedFile]: ") + path + " is empty or its size couldn't be read");
+			close(file);
+			return false;
+		}
+
+		// NOTE: the mapping keeps the file alive, the descriptor isn't needed past this point
+		void* view = mmap(nullptr, static_cast<size_t>(fileStat.st_size), PROT_READ, MAP_PRIVATE, file, 0);
+		close(file);
+		if (view == MAP_FAILED) {
+			Logger::Error(std::string("[MappedFile]: failed to map ") + path);
+			return false;
+		}
+
+		data = static_cast<const u8*>(view);
+		size = static_cast<u64>(fileStat.st_size);
+#endif
+
+		return true;
+	}
+
+	auto MappedFile::Prefetch() const -> void {
+		if (data == nullptr)
+			return;
+
+#if defined(_WIN32)
+		WIN32_MEMORY_RANGE_ENTRY range{ .VirtualAddress = const_cast<u8*>(data), .NumberOfBytes = static_cast<SIZE_T>(size) };
+		PrefetchVirtualMemory(GetCurrentProcess(), 1, &range, 0);
+#else
+		madvise(const_cast<u8*>(data), static_cast<size_t>(size), MADV_WILLNEED);
+#endif
+	}
+
+	auto MappedFile::Close() -> void {
+		if (data == nullptr)
+			return;
+
+#if defined(_WIN32)
+		UnmapViewOfFile(data);
+		CloseHandle(mapping);
+		mapping = nullptr;
+#else
+		munmap(const_cast<u8*>(data), static_cast<size_t>(size));
+#endif
+
+		data = nullptr;
+		size = 0;
+	}
+}
\ No newline at end of file
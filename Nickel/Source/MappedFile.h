@@ -0,0 +1,32 @@
+#pragma once
+
+#include "platform.h"
+
+namespace Nickel {
+	// Read-only view of a whole file. The file is mapped instead of read, pages are only faulted in when touched
+	// and the memory is shared with the OS file cache. The view stays valid until Close or destruction.
+	class MappedFile {
+	public:
+		MappedFile() = default;
+		~MappedFile();
+
+		MappedFile(const MappedFile&) = delete;
+		auto operator=(const MappedFile&) -> MappedFile& = delete;
+		MappedFile(MappedFile&& other) noexcept;
+		auto operator=(MappedFile&& other) noexcept -> MappedFile&;
+
+		auto Open(const char* path) -> bool; // NOTE: logs and returns false when the file is missing, empty or can't be mapped
+		auto Close() -> void;
+		auto Prefetch() const -> void; // NOTE: a hint, the OS starts reading the whole file in and this returns right away
+
+		inline auto IsOpen() const -> bool { return data != nullptr; }
+		inline auto Data() const -> std::span<const u8> { return std::span{ data, static_cast<size_t>(size) }; }
+
+	private:
+		const u8* data = nullptr;
+		u64 size = 0;
+#if defined(_WIN32)
+		void* mapping = nullptr; // NOTE: HANDLE of the file mapping object, the file handle is closed right after mapping
+#endif
+	};
+}
\ No newline at end of file
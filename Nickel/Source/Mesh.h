@@ -1,8 +1,11 @@
 #pragma once
-#include <d3d11.h>
+#include <memory>
+#include <span>
+#include <string>
 #include <vector>
 #include "platform.h"
 #include "Math.h"
+#include "Renderer/RendererTypes.h"
 
 namespace Nickel {
 	struct LoadedVertex {
@@ -19,7 +22,45 @@ namespace Nickel {
 		std::vector<u32> i = std::vector<u32>();
 	};
 
+	// NOTE: the vertex layout imported models are uploaded in, the same as VertexPosUV so the buffers are created
+	// straight from the import
+	struct MeshVertex {
+		Vec3 position;
+		Vec3 normal;
+		Vec2 uv;
+	};
+
+	struct ImportedSubmesh {
+		std::span<const MeshVertex> vertices; // NOTE: both point into the model's arena
+		std::span<const u32> indices;
+		f32 boundingRadius; // NOTE: around the mesh's origin, unscaled
+	};
+
+	enum class ModelImporter : u8 {
+		Auto, // NOTE: glTF and GLB natively, assimp for everything else and for glTF features the native loader lacks
+		Native,
+		Assimp
+	};
+
+	struct ModelImportStats {
+		ModelImporter importer; // NOTE: the one that produced the model, never Auto
+		f64 parseMilliseconds; // NOTE: reading the file, for assimp with its post-processing
+		u64 sceneBytes; // NOTE: the source vertex and index data held for the conversion, assimp's arrays or the mapped glTF buffers
+		f64 convertMilliseconds; // NOTE: writing the arena
+		u64 arenaBytes;
+		u64 peakBytes; // NOTE: the scene and the arena are both alive during the conversion, nothing after it
+	};
+
+	// NOTE: every submesh of a file in a single allocation, written once from the importer's source and only moved after
+	// that. The submeshes' spans stay valid when the model is moved
+	struct ImportedModel {
+		std::unique_ptr<u8[]> arena;
+		std::vector<ImportedSubmesh> submeshes;
+		std::vector<std::string> files; // NOTE: every file the import read, the model's own first, what hot reload watches
+		ModelImportStats stats;
+	};
+
 	class Model {
-		D3D11_PRIMITIVE_TOPOLOGY topologyType;
+		Renderer::PrimitiveTopology topologyType;
 	};
 }
\ No newline at end of file
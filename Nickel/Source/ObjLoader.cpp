@@ -1,11 +1,13 @@
 #include "ObjLoader.h"
+#include <cstdio>
 
 using namespace Nickel;
 
 namespace Nickel {
-	auto ObjLoader::DEBUG_ReadEntireFile(LPCSTR Filename) -> ObjFileMemory { // todo move this to appropriate location
+	auto ObjLoader::DEBUG_ReadEntireFile(const char* Filename) -> ObjFileMemory { // todo move this to appropriate location
 		ObjFileMemory result = {};
 
+#if defined(_WIN32)
 		HANDLE fileHandle = CreateFileA(Filename, GENERIC_READ, FILE_SHARE_READ, 0, OPEN_EXISTING, 0, 0);
 		if (fileHandle != INVALID_HANDLE_VALUE) {
 			LARGE_INTEGER FileSize;
@@ -36,6 +38,28 @@ namespace Nickel {
 		} else {
 			Logger::Error("Failed to create file: file handle is INVALID_HANDLE_VALUE");
 		}
+#else
+		FILE* file = fopen(Filename, "rb");
+		if (file != nullptr) {
+			fseek(file, 0, SEEK_END);
+			const long fileSize = ftell(file);
+			fseek(file, 0, SEEK_SET);
+
+			// NOTE: never freed, same as the VirtualAlloc path above
+			result.data = fileSize > 0 ? malloc(fileSize) : nullptr;
+			if (result.data && fread(result.data, 1, fileSize, file) == static_cast<size_t>(fileSize)) {
+				result.size = static_cast<u64>(fileSize);
+			} else {
+				free(result.data);
+				result.data = nullptr;
+				Logger::Error("Failed to read file");
+			}
+
+			fclose(file);
+		} else {
+			Logger::Error(std::string("Failed to open file: ") + Filename);
+		}
+#endif
 
 		return result;
 	}
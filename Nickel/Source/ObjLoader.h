@@ -3,7 +3,9 @@
 //#include <iostream>
 //#include <string>
 #include <array>
+#if defined(_WIN32)
 #include <Windows.h>
+#endif
 #include <clocale>  /* tolower */
 #include <stdlib.h> /* strtod */
 #include "Mesh.h"
@@ -43,7 +45,7 @@ namespace Nickel {
 
 		public:
 			ObjLoader() {}
-			auto DEBUG_ReadEntireFile(LPCSTR Filename) -> ObjFileMemory;
+			auto DEBUG_ReadEntireFile(const char* Filename) -> ObjFileMemory;
 			auto LoadObjMesh(const ObjFileMemory& file, MeshData& modelData) -> void;
 	};
 }
\ No newline at end of file
@@ -1,3497 +0,0 @@
-#if 0
-//
-// Generated by Microsoft (R) HLSL Shader Compiler 10.1
-//
-//
-//
-// Input signature:
-//
-// Name                 Index   Mask Register SysValue  Format   Used
-// -------------------- ----- ------ -------- -------- ------- ------
-// WORLD_POSITION           0   xyz         0     NONE   float   xyz 
-// NORMAL                   0   xyz         1     NONE   float   xyz 
-// COLOR                    0   xyzw        2     NONE   float   xyz 
-// VIEW                     0   xyz         3     NONE   float   xyz 
-// LIGHT                    0   xyz         4     NONE   float   xyz 
-//
-//
-// Output signature:
-//
-// Name                 Index   Mask Register SysValue  Format   Used
-// -------------------- ----- ------ -------- -------- ------- ------
-// SV_TARGET                0   xyzw        0   TARGET   float   xyzw
-//
-//
-// Level9 shader bytecode:
-//
-    ps_2_x
-    def c0, 0.100000001, 0, -0, -1
-    def c1, 100, -97, 0.5, 0
-    dcl t0.xyz  // IN<0,1,2>
-    dcl t1.xyz  // IN<3,4,5>
-    dcl t2  // IN<6,7,8,9>
-    dcl t3.xyz  // IN<10,11,12>
-    dcl t4.xyz  // IN<13,14,15>
-
-#line 12 "E:\Projects\Nickel\Nickel\Data\Shaders\SimplePixelShader.hlsl"
-    mov r0.xyz, t1  // ::n<0,1,2>
-
-#line 16
-    mov r1.xyz, -t0
-    add r1.xyz, r1, t3
-    dp3 r0.w, r1, r1
-    rsq r0.w, r0.w
-    mul r1.xyz, r0.w, r1  // ::v<0,1,2>
-    mov r2.xyz, -t0
-    add r2.xyz, r2, t4
-    dp3 r0.w, r2, r2
-    rsq r0.w, r0.w
-    mul r2.xyz, r0.w, r2  // ::l<0,1,2>
-    mul r3.xyz, t2, c0.x
-    add r3.xyz, r3, c0.yyxw  // ::cool<0,1,2>
-    add r4.xyz, r3, c0.z
-    cmp r3.xyz, r4, r3, c0.y
-    add r4.xyz, r3, c0.w
-    cmp r3.xyz, r4, -c0.w, r3  // ::cool<0,1,2>
-    mov r4.xyz, t2  // ::warm<0,1,2>
-
-#line 26
-    mov r5.xyz, -r2
-    dp3 r0.w, r5, r0
-    add r0.w, r0.w, r0.w
-    mov r0.w, -r0.w
-    mul r6.xyz, r0.w, r0
-    add r5.xyz, r5, r6  // ::r<0,1,2>
-    dp3 r0.w, r5, r1
-    mul r0.w, r0.w, c1.x
-    add r0.w, r0.w, c1.y
-    add r2.w, r0.w, c0.z
-    cmp r0.w, r2.w, r0.w, c0.y
-    add r2.w, r0.w, c0.w
-    cmp r0.w, r2.w, -c0.w, r0.w  // ::spec<0>
-    dp3 r3.w, r0, r2
-    add r3.w, r3.w, -c0.w
-    mul r3.w, r3.w, c1.z  // ::t<0>
-    mov r3.w, -r3.w
-    add r3.w, r3.w, -c0.w
-    mov r0.xyz, -r4
-    add r0.xyz, r0, r3
-    mul r0.xyz, r0, r3.w
-    add r0.xyz, r0, r4
-    mov r0.w, -r0.w
-    add r0.w, r0.w, -c0.w
-    add r0.xyz, r0, c0.w
-    mul r0.xyz, r0, r0.w
-    add r0.xyz, r0, -c0.w  // ::color<0,1,2>
-    mov r0.xyz, r0  // ::SimplePixelShader<0,1,2>
-    mov r0.w, -c0.w  // ::SimplePixelShader<3>
-
-#line 10
-    mov oC0, r0  // ::SimplePixelShader<0,1,2,3>
-
-// approximately 48 instruction slots used
-ps_4_0
-dcl_input_ps linear v0.xyz
-dcl_input_ps linear v1.xyz
-dcl_input_ps linear v2.xyz
-dcl_input_ps linear v3.xyz
-dcl_input_ps linear v4.xyz
-dcl_output o0.xyzw
-dcl_temps 8
-//
-// Initial variable locations:
-//   v0.x <- IN.worldPos.x; v0.y <- IN.worldPos.y; v0.z <- IN.worldPos.z; 
-//   v1.x <- IN.normal.x; v1.y <- IN.normal.y; v1.z <- IN.normal.z; 
-//   v2.x <- IN.color.x; v2.y <- IN.color.y; v2.z <- IN.color.z; v2.w <- IN.color.w; 
-//   v3.x <- IN.eyeVec.x; v3.y <- IN.eyeVec.y; v3.z <- IN.eyeVec.z; 
-//   v4.x <- IN.lightVec.x; v4.y <- IN.lightVec.y; v4.z <- IN.lightVec.z; 
-//   o0.x <- <SimplePixelShader return value>.x; o0.y <- <SimplePixelShader return value>.y; o0.z <- <SimplePixelShader return value>.z; o0.w <- <SimplePixelShader return value>.w
-//
-#line 12 "E:\Projects\Nickel\Nickel\Data\Shaders\SimplePixelShader.hlsl"
-mov r0.xyz, v1.xyzx  // r0.x <- n.x; r0.y <- n.y; r0.z <- n.z
-
-#line 16
-mov r1.xyz, -v0.xyzx
-add r1.xyz, r1.xyzx, v3.xyzx
-dp3 r0.w, r1.xyzx, r1.xyzx
-rsq r0.w, r0.w
-mul r1.xyz, r0.wwww, r1.xyzx  // r1.x <- v.x; r1.y <- v.y; r1.z <- v.z
-
-#line 17
-mov r2.xyz, -v0.xyzx
-add r2.xyz, r2.xyzx, v4.xyzx
-dp3 r0.w, r2.xyzx, r2.xyzx
-rsq r0.w, r0.w
-mul r2.xyz, r0.wwww, r2.xyzx  // r2.x <- l.x; r2.y <- l.y; r2.z <- l.z
-
-#line 19
-mul r3.xyz, v2.xyzx, l(0.100000, 0.100000, 0.100000, 0.000000)
-add r3.xyz, r3.xyzx, l(0.000000, 0.000000, 0.100000, 0.000000)  // r3.x <- cool.x; r3.y <- cool.y; r3.z <- cool.z
-
-#line 20
-max r3.xyz, r3.xyzx, l(0.000000, 0.000000, 0.000000, 0.000000)
-min r3.xyz, r3.xyzx, l(1.000000, 1.000000, 1.000000, 0.000000)  // r3.x <- cool.x; r3.y <- cool.y; r3.z <- cool.z
-
-#line 22
-mov r4.xyz, v2.xyzx  // r4.x <- warm.x; r4.y <- warm.y; r4.z <- warm.z
-
-#line 23
-mov r5.xyz, l(1.000000,1.000000,1.000000,0)  // r5.x <- highlight.x; r5.y <- highlight.y; r5.z <- highlight.z
-
-#line 26
-mov r6.xyz, -r2.xyzx
-dp3 r0.w, r6.xyzx, r0.xyzx
-add r0.w, r0.w, r0.w
-mov r0.w, -r0.w
-mul r7.xyz, r0.wwww, r0.xyzx
-add r6.xyz, r6.xyzx, r7.xyzx  // r6.x <- r.x; r6.y <- r.y; r6.z <- r.z
-
-#line 27
-dp3 r0.w, r6.xyzx, r1.xyzx
-mul r0.w, r0.w, l(100.000000)
-mov r1.x, l(-97.000000)
-add r0.w, r0.w, r1.x
-max r0.w, r0.w, l(0.000000)
-min r0.w, r0.w, l(1.000000)  // r0.w <- spec
-
-#line 28
-dp3 r0.x, r0.xyzx, r2.xyzx
-add r0.x, r0.x, l(1.000000)
-div r0.x, r0.x, l(2.000000)  // r0.x <- t
-
-#line 29
-mov r0.x, -r0.x
-add r0.x, r0.x, l(1.000000)
-mov r1.xyz, -r4.xyzx
-add r1.xyz, r1.xyzx, r3.xyzx
-mul r0.xyz, r0.xxxx, r1.xyzx
-add r0.xyz, r0.xyzx, r4.xyzx
-mov r0.w, -r0.w
-add r0.w, r0.w, l(1.000000)
-mov r1.xyz, -r5.xyzx
-add r0.xyz, r0.xyzx, r1.xyzx
-mul r0.xyz, r0.xyzx, r0.wwww
-add r0.xyz, r0.xyzx, r5.xyzx  // r0.x <- color.x; r0.y <- color.y; r0.z <- color.z
-
-#line 31
-mov o0.xyz, r0.xyzx
-mov o0.w, l(1.000000)
-ret 
-// Approximately 47 instruction slots used
-#endif
-
-const BYTE g_SimplePixelShader[] =
-{
-     68,  88,  66,  67,  76,  89, 
-    215, 182, 160, 131,  60, 128, 
-     80, 150,  68, 207, 205,  74, 
-     33,  15,   1,   0,   0,   0, 
-    156,  77,   0,   0,   7,   0, 
-      0,   0,  60,   0,   0,   0, 
-    160,   8,   0,   0, 232,  13, 
-      0,   0, 240,  75,   0,   0, 
-    108,  76,   0,   0, 184,  76, 
-      0,   0, 104,  77,   0,   0, 
-     65, 111, 110,  57,  92,   8, 
-      0,   0,  92,   8,   0,   0, 
-      0,   2, 255, 255,  56,   8, 
-      0,   0,  36,   0,   0,   0, 
-      0,   0,  36,   0,   0,   0, 
-     36,   0,   0,   0,  36,   0, 
-      0,   0,  36,   0,   0,   0, 
-     36,   0,   1,   2, 255, 255, 
-    254, 255,  58,   1,  68,  66, 
-     85,  71,  40,   0,   0,   0, 
-    188,   4,   0,   0,   0,   0, 
-      0,   0,   1,   0,   0,   0, 
-    104,   0,   0,   0,  55,   0, 
-      0,   0, 108,   0,   0,   0, 
-     11,   0,   0,   0, 224,   3, 
-      0,   0,  36,   2,   0,   0, 
-     69,  58,  92,  80, 114, 111, 
-    106, 101,  99, 116, 115,  92, 
-     78, 105,  99, 107, 101, 108, 
-     92,  78, 105,  99, 107, 101, 
-    108,  92,  68,  97, 116,  97, 
-     92,  83, 104,  97, 100, 101, 
-    114, 115,  92,  83, 105, 109, 
-    112, 108, 101,  80, 105, 120, 
-    101, 108,  83, 104,  97, 100, 
-    101, 114,  46, 104, 108, 115, 
-    108,   0, 171, 171,  40,   0, 
-      0,   0,   0,   0, 255, 255, 
-    240,   4,   0,   0,   0,   0, 
-    255, 255,   8,   5,   0,   0, 
-      0,   0, 255, 255,  32,   5, 
-      0,   0,   0,   0, 255, 255, 
-     44,   5,   0,   0,   0,   0, 
-    255, 255,  56,   5,   0,   0, 
-      0,   0, 255, 255,  68,   5, 
-      0,   0,   0,   0, 255, 255, 
-     80,   5,   0,   0,  12,   0, 
-      0,   0,  92,   5,   0,   0, 
-     16,   0,   0,   0, 104,   5, 
-      0,   0,  16,   0,   0,   0, 
-    116,   5,   0,   0,  16,   0, 
-      0,   0, 132,   5,   0,   0, 
-     16,   0,   0,   0, 148,   5, 
-      0,   0,  16,   0,   0,   0, 
-    160,   5,   0,   0,  17,   0, 
-      0,   0, 176,   5,   0,   0, 
-     17,   0,   0,   0, 188,   5, 
-      0,   0,  17,   0,   0,   0, 
-    204,   5,   0,   0,  17,   0, 
-      0,   0, 220,   5,   0,   0, 
-     17,   0,   0,   0, 232,   5, 
-      0,   0,  19,   0,   0,   0, 
-    248,   5,   0,   0,  19,   0, 
-      0,   0,   8,   6,   0,   0, 
-     20,   0,   0,   0,  24,   6, 
-      0,   0,  20,   0,   0,   0, 
-     40,   6,   0,   0,  20,   0, 
-      0,   0,  60,   6,   0,   0, 
-     20,   0,   0,   0,  76,   6, 
-      0,   0,  22,   0,   0,   0, 
-     96,   6,   0,   0,  26,   0, 
-      0,   0, 108,   6,   0,   0, 
-     26,   0,   0,   0, 120,   6, 
-      0,   0,  26,   0,   0,   0, 
-    136,   6,   0,   0,  26,   0, 
-      0,   0, 152,   6,   0,   0, 
-     26,   0,   0,   0, 164,   6, 
-      0,   0,  26,   0,   0,   0, 
-    180,   6,   0,   0,  27,   0, 
-      0,   0, 196,   6,   0,   0, 
-     27,   0,   0,   0, 212,   6, 
-      0,   0,  27,   0,   0,   0, 
-    228,   6,   0,   0,  27,   0, 
-      0,   0, 244,   6,   0,   0, 
-     27,   0,   0,   0,   4,   7, 
-      0,   0,  27,   0,   0,   0, 
-     24,   7,   0,   0,  27,   0, 
-      0,   0,  40,   7,   0,   0, 
-     28,   0,   0,   0,  60,   7, 
-      0,   0,  28,   0,   0,   0, 
-     76,   7,   0,   0,  28,   0, 
-      0,   0,  92,   7,   0,   0, 
-     29,   0,   0,   0, 108,   7, 
-      0,   0,  29,   0,   0,   0, 
-    120,   7,   0,   0,  29,   0, 
-      0,   0, 136,   7,   0,   0, 
-     29,   0,   0,   0, 148,   7, 
-      0,   0,  29,   0,   0,   0, 
-    164,   7,   0,   0,  29,   0, 
-      0,   0, 180,   7,   0,   0, 
-     29,   0,   0,   0, 196,   7, 
-      0,   0,  29,   0,   0,   0, 
-    208,   7,   0,   0,  29,   0, 
-      0,   0, 224,   7,   0,   0, 
-     29,   0,   0,   0, 240,   7, 
-      0,   0,  29,   0,   0,   0, 
-      0,   8,   0,   0,  31,   0, 
-      0,   0,  16,   8,   0,   0, 
-     31,   0,   0,   0,  28,   8, 
-      0,   0,  10,   0,   0,   0, 
-     40,   8,   0,   0,  83, 105, 
-    109, 112, 108, 101,  80, 105, 
-    120, 101, 108,  83, 104,  97, 
-    100, 101, 114,   0,  73,  78, 
-      0, 119, 111, 114, 108, 100, 
-     80, 111, 115,   0, 171, 171, 
-      1,   0,   3,   0,   1,   0, 
-      3,   0,   1,   0,   0,   0, 
-      0,   0,   0,   0, 110, 111, 
-    114, 109,  97, 108,   0,  99, 
-    111, 108, 111, 114,   0, 171, 
-    171, 171,   1,   0,   3,   0, 
-      1,   0,   4,   0,   1,   0, 
-      0,   0,   0,   0,   0,   0, 
-    101, 121, 101,  86, 101,  99, 
-      0, 108, 105, 103, 104, 116, 
-     86, 101,  99,   0,  57,   2, 
-      0,   0,  68,   2,   0,   0, 
-     84,   2,   0,   0,  68,   2, 
-      0,   0,  91,   2,   0,   0, 
-    100,   2,   0,   0, 116,   2, 
-      0,   0,  68,   2,   0,   0, 
-    123,   2,   0,   0,  68,   2, 
-      0,   0,   5,   0,   0,   0, 
-      1,   0,  16,   0,   1,   0, 
-      5,   0, 132,   2,   0,   0, 
-      2,   0,   0,   0,   0,   0, 
-      1,   0,   2,   0, 255, 255, 
-      3,   0,   0,   0,   3,   0, 
-      4,   0,   5,   0, 255, 255, 
-      4,   0,   0,   0,   6,   0, 
-      7,   0,   8,   0,   9,   0, 
-      5,   0,   0,   0,  10,   0, 
-     11,   0,  12,   0, 255, 255, 
-      6,   0,   0,   0,  13,   0, 
-     14,   0,  15,   0, 255, 255, 
-      1,   0,   3,   0,   1,   0, 
-      4,   0,   1,   0,   0,   0, 
-      0,   0,   0,   0,  52,   0, 
-      0,   0,   0,   0,   1,   0, 
-      2,   0, 255, 255,  53,   0, 
-      0,   0, 255, 255, 255, 255, 
-    255, 255,   3,   0,  54,   0, 
-      0,   0,   0,   0,   1,   0, 
-      2,   0,   3,   0,  51,   0, 
-      0,   0,   0,   0,   1,   0, 
-      2,   0, 255, 255,  99, 111, 
-    111, 108,   0, 171, 171, 171, 
-     19,   0,   0,   0,   0,   0, 
-      1,   0,   2,   0, 255, 255, 
-     23,   0,   0,   0,   0,   0, 
-      1,   0,   2,   0, 255, 255, 
-    108,   0, 171, 171,  17,   0, 
-      0,   0,   0,   0,   1,   0, 
-      2,   0, 255, 255, 110,   0, 
-    171, 171,   7,   0,   0,   0, 
-      0,   0,   1,   0,   2,   0, 
-    255, 255, 114,   0, 171, 171, 
-     30,   0,   0,   0,   0,   0, 
-      1,   0,   2,   0, 255, 255, 
-    115, 112, 101,  99,   0, 171, 
-    171, 171,   0,   0,   3,   0, 
-      1,   0,   1,   0,   1,   0, 
-      0,   0,   0,   0,   0,   0, 
-     37,   0,   0,   0, 255, 255, 
-    255, 255, 255, 255,   0,   0, 
-    116,   0, 171, 171,  40,   0, 
-      0,   0, 255, 255, 255, 255, 
-    255, 255,   0,   0, 118,   0, 
-    171, 171,  12,   0,   0,   0, 
-      0,   0,   1,   0,   2,   0, 
-    255, 255, 119,  97, 114, 109, 
-      0, 171, 171, 171,  24,   0, 
-      0,   0,   0,   0,   1,   0, 
-      2,   0, 255, 255,  36,   2, 
-      0,   0,  54,   2,   0,   0, 
-    172,   2,   0,   0,   5,   0, 
-      0,   0, 188,   2,   0,   0, 
-      0,   0,   0,   0,  36,   2, 
-      0,   0, 248,   2,   0,   0, 
-      3,   0,   0,   0,   8,   3, 
-      0,   0,   0,   0,   0,   0, 
-     91,   2,   0,   0,  68,   2, 
-      0,   0,   1,   0,   0,   0, 
-     44,   3,   0,   0,   0,   0, 
-      0,   0,  56,   3,   0,   0, 
-     68,   2,   0,   0,   2,   0, 
-      0,   0,  64,   3,   0,   0, 
-      0,   0,   0,   0,  88,   3, 
-      0,   0,  68,   2,   0,   0, 
-      1,   0,   0,   0,  92,   3, 
-      0,   0,   0,   0,   0,   0, 
-    104,   3,   0,   0,  68,   2, 
-      0,   0,   1,   0,   0,   0, 
-    108,   3,   0,   0,   0,   0, 
-      0,   0, 120,   3,   0,   0, 
-     68,   2,   0,   0,   1,   0, 
-      0,   0, 124,   3,   0,   0, 
-      0,   0,   0,   0, 136,   3, 
-      0,   0, 144,   3,   0,   0, 
-      1,   0,   0,   0, 160,   3, 
-      0,   0,   0,   0,   0,   0, 
-    172,   3,   0,   0, 144,   3, 
-      0,   0,   1,   0,   0,   0, 
-    176,   3,   0,   0,   0,   0, 
-      0,   0, 188,   3,   0,   0, 
-     68,   2,   0,   0,   1,   0, 
-      0,   0, 192,   3,   0,   0, 
-      0,   0,   0,   0, 204,   3, 
-      0,   0,  68,   2,   0,   0, 
-      1,   0,   0,   0, 212,   3, 
-      0,   0,  77, 105,  99, 114, 
-    111, 115, 111, 102, 116,  32, 
-     40,  82,  41,  32,  72,  76, 
-     83,  76,  32,  83, 104,  97, 
-    100, 101, 114,  32,  67, 111, 
-    109, 112, 105, 108, 101, 114, 
-     32,  49,  48,  46,  49,   0, 
-     81,   0,   0,   5,   0,   0, 
-     15, 160, 205, 204, 204,  61, 
-      0,   0,   0,   0,   0,   0, 
-      0, 128,   0,   0, 128, 191, 
-     81,   0,   0,   5,   1,   0, 
-     15, 160,   0,   0, 200,  66, 
-      0,   0, 194, 194,   0,   0, 
-      0,  63,   0,   0,   0,   0, 
-     31,   0,   0,   2,   0,   0, 
-      0, 128,   0,   0,   7, 176, 
-     31,   0,   0,   2,   0,   0, 
-      0, 128,   1,   0,   7, 176, 
-     31,   0,   0,   2,   0,   0, 
-      0, 128,   2,   0,  15, 176, 
-     31,   0,   0,   2,   0,   0, 
-      0, 128,   3,   0,   7, 176, 
-     31,   0,   0,   2,   0,   0, 
-      0, 128,   4,   0,   7, 176, 
-      1,   0,   0,   2,   0,   0, 
-      7, 128,   1,   0, 228, 176, 
-      1,   0,   0,   2,   1,   0, 
-      7, 128,   0,   0, 228, 177, 
-      2,   0,   0,   3,   1,   0, 
-      7, 128,   1,   0, 228, 128, 
-      3,   0, 228, 176,   8,   0, 
-      0,   3,   0,   0,   8, 128, 
-      1,   0, 228, 128,   1,   0, 
-    228, 128,   7,   0,   0,   2, 
-      0,   0,   8, 128,   0,   0, 
-    255, 128,   5,   0,   0,   3, 
-      1,   0,   7, 128,   0,   0, 
-    255, 128,   1,   0, 228, 128, 
-      1,   0,   0,   2,   2,   0, 
-      7, 128,   0,   0, 228, 177, 
-      2,   0,   0,   3,   2,   0, 
-      7, 128,   2,   0, 228, 128, 
-      4,   0, 228, 176,   8,   0, 
-      0,   3,   0,   0,   8, 128, 
-      2,   0, 228, 128,   2,   0, 
-    228, 128,   7,   0,   0,   2, 
-      0,   0,   8, 128,   0,   0, 
-    255, 128,   5,   0,   0,   3, 
-      2,   0,   7, 128,   0,   0, 
-    255, 128,   2,   0, 228, 128, 
-      5,   0,   0,   3,   3,   0, 
-      7, 128,   2,   0, 228, 176, 
-      0,   0,   0, 160,   2,   0, 
-      0,   3,   3,   0,   7, 128, 
-      3,   0, 228, 128,   0,   0, 
-    197, 160,   2,   0,   0,   3, 
-      4,   0,   7, 128,   3,   0, 
-    228, 128,   0,   0, 170, 160, 
-     88,   0,   0,   4,   3,   0, 
-      7, 128,   4,   0, 228, 128, 
-      3,   0, 228, 128,   0,   0, 
-     85, 160,   2,   0,   0,   3, 
-      4,   0,   7, 128,   3,   0, 
-    228, 128,   0,   0, 255, 160, 
-     88,   0,   0,   4,   3,   0, 
-      7, 128,   4,   0, 228, 128, 
-      0,   0, 255, 161,   3,   0, 
-    228, 128,   1,   0,   0,   2, 
-      4,   0,   7, 128,   2,   0, 
-    228, 176,   1,   0,   0,   2, 
-      5,   0,   7, 128,   2,   0, 
-    228, 129,   8,   0,   0,   3, 
-      0,   0,   8, 128,   5,   0, 
-    228, 128,   0,   0, 228, 128, 
-      2,   0,   0,   3,   0,   0, 
-      8, 128,   0,   0, 255, 128, 
-      0,   0, 255, 128,   1,   0, 
-      0,   2,   0,   0,   8, 128, 
-      0,   0, 255, 129,   5,   0, 
-      0,   3,   6,   0,   7, 128, 
-      0,   0, 255, 128,   0,   0, 
-    228, 128,   2,   0,   0,   3, 
-      5,   0,   7, 128,   5,   0, 
-    228, 128,   6,   0, 228, 128, 
-      8,   0,   0,   3,   0,   0, 
-      8, 128,   5,   0, 228, 128, 
-      1,   0, 228, 128,   5,   0, 
-      0,   3,   0,   0,   8, 128, 
-      0,   0, 255, 128,   1,   0, 
-      0, 160,   2,   0,   0,   3, 
-      0,   0,   8, 128,   0,   0, 
-    255, 128,   1,   0,  85, 160, 
-      2,   0,   0,   3,   2,   0, 
-      8, 128,   0,   0, 255, 128, 
-      0,   0, 170, 160,  88,   0, 
-      0,   4,   0,   0,   8, 128, 
-      2,   0, 255, 128,   0,   0, 
-    255, 128,   0,   0,  85, 160, 
-      2,   0,   0,   3,   2,   0, 
-      8, 128,   0,   0, 255, 128, 
-      0,   0, 255, 160,  88,   0, 
-      0,   4,   0,   0,   8, 128, 
-      2,   0, 255, 128,   0,   0, 
-    255, 161,   0,   0, 255, 128, 
-      8,   0,   0,   3,   3,   0, 
-      8, 128,   0,   0, 228, 128, 
-      2,   0, 228, 128,   2,   0, 
-      0,   3,   3,   0,   8, 128, 
-      3,   0, 255, 128,   0,   0, 
-    255, 161,   5,   0,   0,   3, 
-      3,   0,   8, 128,   3,   0, 
-    255, 128,   1,   0, 170, 160, 
-      1,   0,   0,   2,   3,   0, 
-      8, 128,   3,   0, 255, 129, 
-      2,   0,   0,   3,   3,   0, 
-      8, 128,   3,   0, 255, 128, 
-      0,   0, 255, 161,   1,   0, 
-      0,   2,   0,   0,   7, 128, 
-      4,   0, 228, 129,   2,   0, 
-      0,   3,   0,   0,   7, 128, 
-      0,   0, 228, 128,   3,   0, 
-    228, 128,   5,   0,   0,   3, 
-      0,   0,   7, 128,   0,   0, 
-    228, 128,   3,   0, 255, 128, 
-      2,   0,   0,   3,   0,   0, 
-      7, 128,   0,   0, 228, 128, 
-      4,   0, 228, 128,   1,   0, 
-      0,   2,   0,   0,   8, 128, 
-      0,   0, 255, 129,   2,   0, 
-      0,   3,   0,   0,   8, 128, 
-      0,   0, 255, 128,   0,   0, 
-    255, 161,   2,   0,   0,   3, 
-      0,   0,   7, 128,   0,   0, 
-    228, 128,   0,   0, 255, 160, 
-      5,   0,   0,   3,   0,   0, 
-      7, 128,   0,   0, 228, 128, 
-      0,   0, 255, 128,   2,   0, 
-      0,   3,   0,   0,   7, 128, 
-      0,   0, 228, 128,   0,   0, 
-    255, 161,   1,   0,   0,   2, 
-      0,   0,   7, 128,   0,   0, 
-    228, 128,   1,   0,   0,   2, 
-      0,   0,   8, 128,   0,   0, 
-    255, 161,   1,   0,   0,   2, 
-      0,   8,  15, 128,   0,   0, 
-    228, 128, 255, 255,   0,   0, 
-     83,  72,  68,  82,  64,   5, 
-      0,   0,  64,   0,   0,   0, 
-     80,   1,   0,   0,  98,  16, 
-      0,   3, 114,  16,  16,   0, 
-      0,   0,   0,   0,  98,  16, 
-      0,   3, 114,  16,  16,   0, 
-      1,   0,   0,   0,  98,  16, 
-      0,   3, 114,  16,  16,   0, 
-      2,   0,   0,   0,  98,  16, 
-      0,   3, 114,  16,  16,   0, 
-      3,   0,   0,   0,  98,  16, 
-      0,   3, 114,  16,  16,   0, 
-      4,   0,   0,   0, 101,   0, 
-      0,   3, 242,  32,  16,   0, 
-      0,   0,   0,   0, 104,   0, 
-      0,   2,   8,   0,   0,   0, 
-     54,   0,   0,   5, 114,   0, 
-     16,   0,   0,   0,   0,   0, 
-     70,  18,  16,   0,   1,   0, 
-      0,   0,  54,   0,   0,   6, 
-    114,   0,  16,   0,   1,   0, 
-      0,   0,  70,  18,  16, 128, 
-     65,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   7, 
-    114,   0,  16,   0,   1,   0, 
-      0,   0,  70,   2,  16,   0, 
-      1,   0,   0,   0,  70,  18, 
-     16,   0,   3,   0,   0,   0, 
-     16,   0,   0,   7, 130,   0, 
-     16,   0,   0,   0,   0,   0, 
-     70,   2,  16,   0,   1,   0, 
-      0,   0,  70,   2,  16,   0, 
-      1,   0,   0,   0,  68,   0, 
-      0,   5, 130,   0,  16,   0, 
-      0,   0,   0,   0,  58,   0, 
-     16,   0,   0,   0,   0,   0, 
-     56,   0,   0,   7, 114,   0, 
-     16,   0,   1,   0,   0,   0, 
-    246,  15,  16,   0,   0,   0, 
-      0,   0,  70,   2,  16,   0, 
-      1,   0,   0,   0,  54,   0, 
-      0,   6, 114,   0,  16,   0, 
-      2,   0,   0,   0,  70,  18, 
-     16, 128,  65,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   7, 114,   0,  16,   0, 
-      2,   0,   0,   0,  70,   2, 
-     16,   0,   2,   0,   0,   0, 
-     70,  18,  16,   0,   4,   0, 
-      0,   0,  16,   0,   0,   7, 
-    130,   0,  16,   0,   0,   0, 
-      0,   0,  70,   2,  16,   0, 
-      2,   0,   0,   0,  70,   2, 
-     16,   0,   2,   0,   0,   0, 
-     68,   0,   0,   5, 130,   0, 
-     16,   0,   0,   0,   0,   0, 
-     58,   0,  16,   0,   0,   0, 
-      0,   0,  56,   0,   0,   7, 
-    114,   0,  16,   0,   2,   0, 
-      0,   0, 246,  15,  16,   0, 
-      0,   0,   0,   0,  70,   2, 
-     16,   0,   2,   0,   0,   0, 
-     56,   0,   0,  10, 114,   0, 
-     16,   0,   3,   0,   0,   0, 
-     70,  18,  16,   0,   2,   0, 
-      0,   0,   2,  64,   0,   0, 
-    205, 204, 204,  61, 205, 204, 
-    204,  61, 205, 204, 204,  61, 
-      0,   0,   0,   0,   0,   0, 
-      0,  10, 114,   0,  16,   0, 
-      3,   0,   0,   0,  70,   2, 
-     16,   0,   3,   0,   0,   0, 
-      2,  64,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-    205, 204, 204,  61,   0,   0, 
-      0,   0,  52,   0,   0,  10, 
-    114,   0,  16,   0,   3,   0, 
-      0,   0,  70,   2,  16,   0, 
-      3,   0,   0,   0,   2,  64, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-     51,   0,   0,  10, 114,   0, 
-     16,   0,   3,   0,   0,   0, 
-     70,   2,  16,   0,   3,   0, 
-      0,   0,   2,  64,   0,   0, 
-      0,   0, 128,  63,   0,   0, 
-    128,  63,   0,   0, 128,  63, 
-      0,   0,   0,   0,  54,   0, 
-      0,   5, 114,   0,  16,   0, 
-      4,   0,   0,   0,  70,  18, 
-     16,   0,   2,   0,   0,   0, 
-     54,   0,   0,   8, 114,   0, 
-     16,   0,   5,   0,   0,   0, 
-      2,  64,   0,   0,   0,   0, 
-    128,  63,   0,   0, 128,  63, 
-      0,   0, 128,  63,   0,   0, 
-      0,   0,  54,   0,   0,   6, 
-    114,   0,  16,   0,   6,   0, 
-      0,   0,  70,   2,  16, 128, 
-     65,   0,   0,   0,   2,   0, 
-      0,   0,  16,   0,   0,   7, 
-    130,   0,  16,   0,   0,   0, 
-      0,   0,  70,   2,  16,   0, 
-      6,   0,   0,   0,  70,   2, 
-     16,   0,   0,   0,   0,   0, 
-      0,   0,   0,   7, 130,   0, 
-     16,   0,   0,   0,   0,   0, 
-     58,   0,  16,   0,   0,   0, 
-      0,   0,  58,   0,  16,   0, 
-      0,   0,   0,   0,  54,   0, 
-      0,   6, 130,   0,  16,   0, 
-      0,   0,   0,   0,  58,   0, 
-     16, 128,  65,   0,   0,   0, 
-      0,   0,   0,   0,  56,   0, 
-      0,   7, 114,   0,  16,   0, 
-      7,   0,   0,   0, 246,  15, 
-     16,   0,   0,   0,   0,   0, 
-     70,   2,  16,   0,   0,   0, 
-      0,   0,   0,   0,   0,   7, 
-    114,   0,  16,   0,   6,   0, 
-      0,   0,  70,   2,  16,   0, 
-      6,   0,   0,   0,  70,   2, 
-     16,   0,   7,   0,   0,   0, 
-     16,   0,   0,   7, 130,   0, 
-     16,   0,   0,   0,   0,   0, 
-     70,   2,  16,   0,   6,   0, 
-      0,   0,  70,   2,  16,   0, 
-      1,   0,   0,   0,  56,   0, 
-      0,   7, 130,   0,  16,   0, 
-      0,   0,   0,   0,  58,   0, 
-     16,   0,   0,   0,   0,   0, 
-      1,  64,   0,   0,   0,   0, 
-    200,  66,  54,   0,   0,   5, 
-     18,   0,  16,   0,   1,   0, 
-      0,   0,   1,  64,   0,   0, 
-      0,   0, 194, 194,   0,   0, 
-      0,   7, 130,   0,  16,   0, 
-      0,   0,   0,   0,  58,   0, 
-     16,   0,   0,   0,   0,   0, 
-     10,   0,  16,   0,   1,   0, 
-      0,   0,  52,   0,   0,   7, 
-    130,   0,  16,   0,   0,   0, 
-      0,   0,  58,   0,  16,   0, 
-      0,   0,   0,   0,   1,  64, 
-      0,   0,   0,   0,   0,   0, 
-     51,   0,   0,   7, 130,   0, 
-     16,   0,   0,   0,   0,   0, 
-     58,   0,  16,   0,   0,   0, 
-      0,   0,   1,  64,   0,   0, 
-      0,   0, 128,  63,  16,   0, 
-      0,   7,  18,   0,  16,   0, 
-      0,   0,   0,   0,  70,   2, 
-     16,   0,   0,   0,   0,   0, 
-     70,   2,  16,   0,   2,   0, 
-      0,   0,   0,   0,   0,   7, 
-     18,   0,  16,   0,   0,   0, 
-      0,   0,  10,   0,  16,   0, 
-      0,   0,   0,   0,   1,  64, 
-      0,   0,   0,   0, 128,  63, 
-     14,   0,   0,   7,  18,   0, 
-     16,   0,   0,   0,   0,   0, 
-     10,   0,  16,   0,   0,   0, 
-      0,   0,   1,  64,   0,   0, 
-      0,   0,   0,  64,  54,   0, 
-      0,   6,  18,   0,  16,   0, 
-      0,   0,   0,   0,  10,   0, 
-     16, 128,  65,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   7,  18,   0,  16,   0, 
-      0,   0,   0,   0,  10,   0, 
-     16,   0,   0,   0,   0,   0, 
-      1,  64,   0,   0,   0,   0, 
-    128,  63,  54,   0,   0,   6, 
-    114,   0,  16,   0,   1,   0, 
-      0,   0,  70,   2,  16, 128, 
-     65,   0,   0,   0,   4,   0, 
-      0,   0,   0,   0,   0,   7, 
-    114,   0,  16,   0,   1,   0, 
-      0,   0,  70,   2,  16,   0, 
-      1,   0,   0,   0,  70,   2, 
-     16,   0,   3,   0,   0,   0, 
-     56,   0,   0,   7, 114,   0, 
-     16,   0,   0,   0,   0,   0, 
-      6,   0,  16,   0,   0,   0, 
-      0,   0,  70,   2,  16,   0, 
-      1,   0,   0,   0,   0,   0, 
-      0,   7, 114,   0,  16,   0, 
-      0,   0,   0,   0,  70,   2, 
-     16,   0,   0,   0,   0,   0, 
-     70,   2,  16,   0,   4,   0, 
-      0,   0,  54,   0,   0,   6, 
-    130,   0,  16,   0,   0,   0, 
-      0,   0,  58,   0,  16, 128, 
-     65,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   7, 
-    130,   0,  16,   0,   0,   0, 
-      0,   0,  58,   0,  16,   0, 
-      0,   0,   0,   0,   1,  64, 
-      0,   0,   0,   0, 128,  63, 
-     54,   0,   0,   6, 114,   0, 
-     16,   0,   1,   0,   0,   0, 
-     70,   2,  16, 128,  65,   0, 
-      0,   0,   5,   0,   0,   0, 
-      0,   0,   0,   7, 114,   0, 
-     16,   0,   0,   0,   0,   0, 
-     70,   2,  16,   0,   0,   0, 
-      0,   0,  70,   2,  16,   0, 
-      1,   0,   0,   0,  56,   0, 
-      0,   7, 114,   0,  16,   0, 
-      0,   0,   0,   0,  70,   2, 
-     16,   0,   0,   0,   0,   0, 
-    246,  15,  16,   0,   0,   0, 
-      0,   0,   0,   0,   0,   7, 
-    114,   0,  16,   0,   0,   0, 
-      0,   0,  70,   2,  16,   0, 
-      0,   0,   0,   0,  70,   2, 
-     16,   0,   5,   0,   0,   0, 
-     54,   0,   0,   5, 114,  32, 
-     16,   0,   0,   0,   0,   0, 
-     70,   2,  16,   0,   0,   0, 
-      0,   0,  54,   0,   0,   5, 
-    130,  32,  16,   0,   0,   0, 
-      0,   0,   1,  64,   0,   0, 
-      0,   0, 128,  63,  62,   0, 
-      0,   1,  83,  80,  68,  66, 
-      0,  62,   0,   0,  77, 105, 
-     99, 114, 111, 115, 111, 102, 
-    116,  32,  67,  47,  67,  43, 
-     43,  32,  77,  83,  70,  32, 
-     55,  46,  48,  48,  13,  10, 
-     26,  68,  83,   0,   0,   0, 
-      0,   2,   0,   0,   2,   0, 
-      0,   0,  31,   0,   0,   0, 
-    164,   0,   0,   0,   0,   0, 
-      0,   0,  30,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-    192, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255,  56,   0,   0, 128, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255,   5,   0, 
-      0,   0,  32,   0,   0,   0, 
-     60,   0,   0,   0,   0,   0, 
-      0,   0, 255, 255, 255, 255, 
-      0,   0,   0,   0,   6,   0, 
-      0,   0,   5,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      3,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0, 148,  46,  49,   1, 
-     13, 146,  50,  97,   1,   0, 
-      0,   0, 162, 150, 113, 141, 
-    195,  32, 180,  71, 153, 110, 
-    206, 110, 127,  41, 119,  80, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   1,   0,   0,   0, 
-      1,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0, 220,  81, 
-     51,   1,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,  78,  46, 
-    119, 111, 114, 108, 100,  80, 
-    111, 115,  41,  59,  10,   9, 
-    102, 108, 111,  97, 116,  51, 
-     32, 108,  32,  61,  32, 110, 
-    111, 114, 109,  97, 108, 105, 
-    122, 101,  40,  73,  78,  46, 
-    108, 105, 103, 104, 116,  86, 
-    101,  99,  32,  45,  32,  73, 
-     78,  46, 119, 111, 114, 108, 
-    100,  80, 111, 115,  41,  59, 
-     10,  10,   9, 102, 108, 111, 
-     97, 116,  51,  32,  99, 111, 
-    111, 108,  32,  61,  32, 102, 
-    108, 111,  97, 116,  51,  40, 
-     48,  46,  48,  44,  32,  48, 
-     46,  48,  44,  32,  48,  46, 
-     49,  41,  32,  43,  32,  48, 
-     46,  49,  42,  73,  78,  46, 
-     99, 111, 108, 111, 114,  46, 
-    114, 103,  98,  59,  10,   9, 
-     99, 111, 111, 108,  32,  61, 
-     32, 115,  97, 116, 117, 114, 
-     97, 116, 101,  40,  99, 111, 
-    111, 108,  41,  59,  10,  10, 
-      9, 102, 108, 111,  97, 116, 
-     51,  32, 119,  97, 114, 109, 
-     32,  61,  32,  73,  78,  46, 
-     99, 111, 108, 111, 114,  46, 
-    114, 103,  98,  59,  10,   9, 
-    102, 108, 111,  97, 116,  51, 
-     32, 104, 105, 103, 104, 108, 
-    105, 103, 104, 116,  32,  61, 
-     32, 102, 108, 111,  97, 116, 
-     51,  40,  49,  46,  48,  44, 
-     32,  49,  46,  48,  44,  32, 
-     49,  46,  48,  41,  59,  10, 
-     10,   9,  47,  47, 102, 108, 
-    111,  97, 116,  51,  32, 114, 
-     32,  61,  32,  50,  46,  48, 
-     42, 100, 111, 116,  40, 110, 
-     44, 108,  41,  42, 110,  45, 
-    108,  59,  10,   9, 102, 108, 
-    111,  97, 116,  51,  32, 114, 
-     32,  61,  32, 114, 101, 102, 
-    108, 101,  99, 116,  40,  45, 
-    108,  44,  32, 110,  41,  59, 
-     10,   9, 102, 108, 111,  97, 
-    116,  32, 115, 112, 101,  99, 
-     32,  61,  32, 115,  97, 116, 
-    117, 114,  97, 116, 101,  40, 
-     49,  48,  48,  46,  48,  42, 
-    100, 111, 116,  40, 114,  44, 
-    118,  41,  32,  45,  32,  57, 
-     55,  46,  48,  41,  59,  10, 
-      9, 102, 108, 111,  97, 116, 
-     32, 116,  32,  61,  32,  40, 
-    100, 111, 116,  40, 110,  44, 
-     32, 108,  41,  32,  43,  32, 
-     49,  46,  48,  41,  32,  47, 
-     32,  50,  46,  48,  59,  10, 
-      9, 102, 108, 111,  97, 116, 
-     51,  32,  99, 111, 108, 111, 
-    114,  32,  61,  32, 108, 101, 
-    114, 112,  40, 104, 105, 103, 
-    104, 108, 105, 103, 104, 116, 
-     44,  32, 108, 101, 114, 112, 
-     40, 119,  97, 114, 109,  44, 
-     32,  99, 111, 111, 108,  44, 
-     32,  49,  46,  48,  45, 116, 
-     41,  44,  32,  49,  46,  48, 
-     45,  32, 115, 112, 101,  99, 
-     41,  59,  10,  10,  32,  32, 
-     32,  32, 114, 101, 116, 117, 
-    114, 110,  32, 102, 108, 111, 
-     97, 116,  52,  40,  99, 111, 
-    108, 111, 114,  44,  32,  49, 
-     46,  48, 102,  41,  59,  10, 
-     10,   9,  47,  47, 114, 101, 
-    116, 117, 114, 110,  32, 102, 
-    108, 111,  97, 116,  52,  40, 
-     73,  78,  46, 118, 105, 101, 
-    119,  44,  32,  49,  46,  48, 
-    102,  41,  59,  10,   9,  47, 
-     47, 114, 101, 116, 117, 114, 
-    110,  32,  73,  78,  46,  99, 
-     76, 232,   3,   0, 198,  90, 
-      0,   0,  30, 179,   3,   0, 
-     47,  63,   0,   0,  38, 247, 
-      2,   0, 233, 240,   2,   0, 
-     39,  82,   3,   0,   0,  16, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0, 115, 116, 114, 117, 
-     99, 116,  32,  80, 105, 120, 
-    101, 108,  83, 104,  97, 100, 
-    101, 114,  73, 110, 112, 117, 
-    116,  10, 123,  10,   9, 102, 
-    108, 111,  97, 116,  51,  32, 
-    119, 111, 114, 108, 100,  80, 
-    111, 115,  32,  58,  32,  87, 
-     79,  82,  76,  68,  95,  80, 
-     79,  83,  73,  84,  73,  79, 
-     78,  59,  10,   9, 102, 108, 
-    111,  97, 116,  51,  32, 110, 
-    111, 114, 109,  97, 108,  32, 
-     58,  32,  78,  79,  82,  77, 
-     65,  76,  59,  10,  32,  32, 
-     32,  32, 102, 108, 111,  97, 
-    116,  52,  32,  99, 111, 108, 
-    111, 114,  32,  58,  32,  67, 
-     79,  76,  79,  82,  59,  10, 
-      9, 102, 108, 111,  97, 116, 
-     51,  32, 101, 121, 101,  86, 
-    101,  99,  32,  58,  32,  86, 
-     73,  69,  87,  59,  10,   9, 
-    102, 108, 111,  97, 116,  51, 
-     32, 108, 105, 103, 104, 116, 
-     86, 101,  99,  32,  58,  32, 
-     76,  73,  71,  72,  84,  59, 
-     10, 125,  59,  10,  10, 102, 
-    108, 111,  97, 116,  52,  32, 
-     83, 105, 109, 112, 108, 101, 
-     80, 105, 120, 101, 108,  83, 
-    104,  97, 100, 101, 114,  40, 
-     32,  80, 105, 120, 101, 108, 
-     83, 104,  97, 100, 101, 114, 
-     73, 110, 112, 117, 116,  32, 
-     73,  78,  32,  41,  32,  58, 
-     32,  83,  86,  95,  84,  65, 
-     82,  71,  69,  84,  10, 123, 
-     10,   9, 102, 108, 111,  97, 
-    116,  51,  32, 110,  32,  61, 
-     32, 102, 108, 111,  97, 116, 
-     51,  40,  73,  78,  46, 110, 
-    111, 114, 109,  97, 108,  46, 
-    120,  44,  32,  73,  78,  46, 
-    110, 111, 114, 109,  97, 108, 
-     46, 121,  44,  32,  73,  78, 
-     46, 110, 111, 114, 109,  97, 
-    108,  46, 122,  41,  59,  10, 
-      9,  47,  47, 102, 108, 111, 
-     97, 116,  51,  32, 118,  32, 
-     61,  32,  73,  78,  46, 101, 
-    121, 101,  86, 101,  99,  59, 
-     10,   9,  47,  47, 102, 108, 
-    111,  97, 116,  51,  32, 108, 
-     32,  61,  32,  73,  78,  46, 
-    108, 105, 103, 104, 116,  86, 
-    101,  99,  59,  10,  10,   9, 
-    102, 108, 111,  97, 116,  51, 
-     32, 118,  32,  61,  32, 110, 
-    111, 114, 109,  97, 108, 105, 
-    122, 101,  40,  73,  78,  46, 
-    101, 121, 101,  86, 101,  99, 
-     32,  45,  32,  73,  78,  46, 
-    119, 111, 114, 108, 100,  80, 
-    111, 115,  41,  59,  10,   9, 
-    102, 108, 111,  97, 116,  51, 
-     32, 108,  32,  61,  32, 110, 
-    111, 114, 109,  97, 108, 105, 
-    122, 101,  40,  73,  78,  46, 
-    108, 105, 103, 104, 116,  86, 
-    101,  99,  32,  45,  32,  73, 
-     78,  46, 119, 111, 114, 108, 
-    100,  80, 111, 115,  41,  59, 
-     10,  10,   9, 102, 108, 111, 
-     97, 116,  51,  32,  99, 111, 
-    111, 108,  32,  61,  32, 102, 
-    108, 111,  97, 116,  51,  40, 
-     48,  46,  48,  44,  32,  48, 
-     46,  48,  44,  32,  48,  46, 
-     49,  41,  32,  43,  32,  48, 
-     46,  49,  42,  73,  78,  46, 
-     99, 111, 108, 111, 114,  46, 
-    114, 103,  98,  59,  10,   9, 
-     99, 111, 111, 108,  32,  61, 
-     32, 115,  97, 116, 117, 114, 
-     97, 116, 101,  40,  99, 111, 
-    111, 108,  41,  59,  10,  10, 
-      9, 102, 108, 111,  97, 116, 
-     51,  32, 119,  97, 114, 109, 
-     32,  61,  32,  73,  78,  46, 
-     99, 111, 108, 111, 114,  46, 
-    114, 103,  98,  59,  10,   9, 
-    102, 108, 111,  97, 116,  51, 
-     32, 104, 105, 103, 104, 108, 
-    105, 103, 104, 116,  32,  61, 
-     32, 102, 108, 111,  97, 116, 
-     51,  40,  49,  46,  48,  44, 
-     32,  49,  46,  48,  44,  32, 
-     49,  46,  48,  41,  59,  10, 
-     10,   9,  47,  47, 102, 108, 
-    111,  97, 116,  51,  32, 114, 
-     32,  61,  32,  50,  46,  48, 
-     42, 100, 111, 116,  40, 110, 
-     44, 108,  41,  42, 110,  45, 
-    108,  59,  10,   9, 102, 108, 
-    111,  97, 116,  51,  32, 114, 
-     32,  61,  32, 114, 101, 102, 
-    108, 101,  99, 116,  40,  45, 
-    108,  44,  32, 110,  41,  59, 
-     10,   9, 102, 108, 111,  97, 
-    116,  32, 115, 112, 101,  99, 
-     32,  61,  32, 115,  97, 116, 
-    117, 114,  97, 116, 101,  40, 
-     49,  48,  48,  46,  48,  42, 
-    100, 111, 116,  40, 114,  44, 
-    118,  41,  32,  45,  32,  57, 
-     55,  46,  48,  41,  59,  10, 
-      9, 102, 108, 111,  97, 116, 
-     32, 116,  32,  61,  32,  40, 
-    100, 111, 116,  40, 110,  44, 
-     32, 108,  41,  32,  43,  32, 
-     49,  46,  48,  41,  32,  47, 
-     32,  50,  46,  48,  59,  10, 
-      9, 102, 108, 111,  97, 116, 
-     51,  32,  99, 111, 108, 111, 
-    114,  32,  61,  32, 108, 101, 
-    114, 112,  40, 104, 105, 103, 
-    104, 108, 105, 103, 104, 116, 
-     44,  32, 108, 101, 114, 112, 
-     40, 119,  97, 114, 109,  44, 
-     32,  99, 111, 111, 108,  44, 
-     32,  49,  46,  48,  45, 116, 
-     41,  44,  32,  49,  46,  48, 
-     45,  32, 115, 112, 101,  99, 
-     41,  59,  10,  10,  32,  32, 
-     32,  32, 114, 101, 116, 117, 
-    114, 110,  32, 102, 108, 111, 
-     97, 116,  52,  40,  99, 111, 
-    108, 111, 114,  44,  32,  49, 
-     46,  48, 102,  41,  59,  10, 
-     10,   9,  47,  47, 114, 101, 
-    116, 117, 114, 110,  32, 102, 
-    108, 111,  97, 116,  52,  40, 
-     73,  78,  46, 118, 105, 101, 
-    119,  44,  32,  49,  46,  48, 
-    102,  41,  59,  10,   9,  47, 
-     47, 114, 101, 116, 117, 114, 
-    110,  32,  73,  78,  46,  99, 
-    111, 108, 111, 114,  59,  10, 
-      9,  47,  47, 114, 101, 116, 
-    117, 114, 110,  32, 102, 108, 
-    111,  97, 116,  52,  40,  49, 
-     46,  48,  44,  32,  48,  46, 
-     53,  44,  32,  48,  46,  48, 
-     44,  32,  49,  46,  48, 102, 
-     41,  59,  10, 125,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-    254, 239, 254, 239,   1,   0, 
-      0,   0,  35,   4,   0,   0, 
-      0,  69,  58,  92,  80, 114, 
-    111, 106, 101,  99, 116, 115, 
-     92,  78, 105,  99, 107, 101, 
-    108,  92,  78, 105,  99, 107, 
-    101, 108,  92,  68,  97, 116, 
-     97,  92,  83, 104,  97, 100, 
-    101, 114, 115,  92,  83, 105, 
-    109, 112, 108, 101,  80, 105, 
-    120, 101, 108,  83, 104,  97, 
-    100, 101, 114,  46, 104, 108, 
-    115, 108,   0,   0, 101,  58, 
-     92, 112, 114, 111, 106, 101, 
-     99, 116, 115,  92, 110, 105, 
-     99, 107, 101, 108,  92, 110, 
-    105,  99, 107, 101, 108,  92, 
-    100,  97, 116,  97,  92, 115, 
-    104,  97, 100, 101, 114, 115, 
-     92, 115, 105, 109, 112, 108, 
-    101, 112, 105, 120, 101, 108, 
-    115, 104,  97, 100, 101, 114, 
-     46, 104, 108, 115, 108,   0, 
-    115, 116, 114, 117,  99, 116, 
-     32,  80, 105, 120, 101, 108, 
-     83, 104,  97, 100, 101, 114, 
-     73, 110, 112, 117, 116,  10, 
-    123,  10,   9, 102, 108, 111, 
-     97, 116,  51,  32, 119, 111, 
-    114, 108, 100,  80, 111, 115, 
-     32,  58,  32,  87,  79,  82, 
-     76,  68,  95,  80,  79,  83, 
-     73,  84,  73,  79,  78,  59, 
-     10,   9, 102, 108, 111,  97, 
-    116,  51,  32, 110, 111, 114, 
-    109,  97, 108,  32,  58,  32, 
-     78,  79,  82,  77,  65,  76, 
-     59,  10,  32,  32,  32,  32, 
-    102, 108, 111,  97, 116,  52, 
-     32,  99, 111, 108, 111, 114, 
-     32,  58,  32,  67,  79,  76, 
-     79,  82,  59,  10,   9, 102, 
-    108, 111,  97, 116,  51,  32, 
-    101, 121, 101,  86, 101,  99, 
-     32,  58,  32,  86,  73,  69, 
-     87,  59,  10,   9, 102, 108, 
-    111,  97, 116,  51,  32, 108, 
-    105, 103, 104, 116,  86, 101, 
-     99,  32,  58,  32,  76,  73, 
-     71,  72,  84,  59,  10, 125, 
-     59,  10,  10, 102, 108, 111, 
-     97, 116,  52,  32,  83, 105, 
-    109, 112, 108, 101,  80, 105, 
-    120, 101, 108,  83, 104,  97, 
-    100, 101, 114,  40,  32,  80, 
-    105, 120, 101, 108,  83, 104, 
-     97, 100, 101, 114,  73, 110, 
-    112, 117, 116,  32,  73,  78, 
-     32,  41,  32,  58,  32,  83, 
-     86,  95,  84,  65,  82,  71, 
-     69,  84,  10, 123,  10,   9, 
-    102, 108, 111,  97, 116,  51, 
-     32, 110,  32,  61,  32, 102, 
-    108, 111,  97, 116,  51,  40, 
-     73,  78,  46, 110, 111, 114, 
-    109,  97, 108,  46, 120,  44, 
-     32,  73,  78,  46, 110, 111, 
-    114, 109,  97, 108,  46, 121, 
-     44,  32,  73,  78,  46, 110, 
-    111, 114, 109,  97, 108,  46, 
-    122,  41,  59,  10,   9,  47, 
-     47, 102, 108, 111,  97, 116, 
-     51,  32, 118,  32,  61,  32, 
-     73,  78,  46, 101, 121, 101, 
-     86, 101,  99,  59,  10,   9, 
-     47,  47, 102, 108, 111,  97, 
-    116,  51,  32, 108,  32,  61, 
-     32,  73,  78,  46, 108, 105, 
-    103, 104, 116,  86, 101,  99, 
-     59,  10,  10,   9, 102, 108, 
-    111,  97, 116,  51,  32, 118, 
-     32,  61,  32, 110, 111, 114, 
-    109,  97, 108, 105, 122, 101, 
-     40,  73,  78,  46, 101, 121, 
-    101,  86, 101,  99,  32,  45, 
-     32,  73,  27, 226,  48,   1, 
-    128,   0,   0,   0, 161, 184, 
-    217, 199,   9, 161, 215,   1, 
-      1,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      1,   0,   0,   0,   2,   0, 
-      0,   0,   1,   0,   0,   0, 
-      1,   0,   0,   0,   0,   0, 
-      0,   0,  64,   0,   0,   0, 
-     40,   0,   0,   0,  27, 226, 
-     48,   1, 251, 159, 253, 199, 
-    164,   3,   0,   0,   1,   0, 
-      0,   0,  63,   0,   0,   0, 
-     64,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   4,   0, 
-      0,   0,  66,   0,  60,  17, 
-     16,   1,   0,   0,   0,   1, 
-     10,   0,   1,   0, 173,   2, 
-     97,  74,  10,   0,   1,   0, 
-    173,   2,  97,  74,  77, 105, 
-     99, 114, 111, 115, 111, 102, 
-    116,  32,  40,  82,  41,  32, 
-     72,  76,  83,  76,  32,  83, 
-    104,  97, 100, 101, 114,  32, 
-     67, 111, 109, 112, 105, 108, 
-    101, 114,  32,  49,  48,  46, 
-     49,   0,   0,   0,  74,   0, 
-     61,  17,   1, 104, 108, 115, 
-    108,  70, 108,  97, 103, 115, 
-      0,  48, 120,  53,   0, 104, 
-    108, 115, 108,  84,  97, 114, 
-    103, 101, 116,   0, 112, 115, 
-     95,  52,  95,  48,  95, 108, 
-    101, 118, 101, 108,  95,  57, 
-     95,  51,   0, 104, 108, 115, 
-    108,  69, 110, 116, 114, 121, 
-      0,  83, 105, 109, 112, 108, 
-    101,  80, 105, 120, 101, 108, 
-     83, 104,  97, 100, 101, 114, 
-      0,   0,  58,   0,  16,  17, 
-      0,   0,   0,   0, 100,   7, 
-      0,   0,   0,   0,   0,   0, 
-    232,   4,   0,   0,   0,   0, 
-      0,   0, 232,   4,   0,   0, 
-      6,  16,   0,   0,  88,   0, 
-      0,   0,   1,   0, 160,  83, 
-    105, 109, 112, 108, 101,  80, 
-    105, 120, 101, 108,  83, 104, 
-     97, 100, 101, 114,   0,   0, 
-      0,   0,  42,   0,  62,  17, 
-      3,  16,   0,   0,   9,   0, 
-     73,  78,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,  22,   0, 
-     80,  17,   1,   0,   5,   0, 
-      0,   0,   4,   0,  88,   0, 
-      0,   0,   1,   0, 232,   4, 
-      0,   0,   0,   0,  22,   0, 
-     80,  17,   1,   0,   5,   0, 
-      4,   0,   4,   0,  88,   0, 
-      0,   0,   1,   0, 232,   4, 
-      4,   0,   0,   0,  22,   0, 
-     80,  17,   1,   0,   5,   0, 
-      8,   0,   4,   0,  88,   0, 
-      0,   0,   1,   0, 232,   4, 
-      8,   0,   0,   0,  22,   0, 
-     80,  17,   1,   0,   5,   0, 
-     12,   0,   4,   0,  88,   0, 
-      0,   0,   1,   0, 232,   4, 
-     16,   0,   0,   0,  22,   0, 
-     80,  17,   1,   0,   5,   0, 
-     16,   0,   4,   0,  88,   0, 
-      0,   0,   1,   0, 232,   4, 
-     20,   0,   0,   0,  22,   0, 
-     80,  17,   1,   0,   5,   0, 
-     20,   0,   4,   0,  88,   0, 
-      0,   0,   1,   0, 232,   4, 
-     24,   0,   0,   0,  22,   0, 
-     80,  17,   1,   0,   5,   0, 
-     24,   0,   4,   0,  88,   0, 
-      0,   0,   1,   0, 232,   4, 
-     32,   0,   0,   0,  22,   0, 
-     80,  17,   1,   0,   5,   0, 
-     28,   0,   4,   0,  88,   0, 
-      0,   0,   1,   0, 232,   4, 
-     36,   0,   0,   0,  22,   0, 
-     80,  17,   1,   0,   5,   0, 
-     32,   0,   4,   0,  88,   0, 
-      0,   0,   1,   0, 232,   4, 
-     40,   0,   0,   0,  22,   0, 
-     80,  17,   1,   0,   5,   0, 
-     36,   0,   4,   0,  88,   0, 
-      0,   0,   1,   0, 232,   4, 
-     44,   0,   0,   0,  22,   0, 
-     80,  17,   1,   0,   5,   0, 
-     40,   0,   4,   0,  88,   0, 
-      0,   0,   1,   0, 232,   4, 
-     48,   0,   0,   0,  22,   0, 
-     80,  17,   1,   0,   5,   0, 
-     44,   0,   4,   0,  88,   0, 
-      0,   0,   1,   0, 232,   4, 
-     52,   0,   0,   0,  22,   0, 
-     80,  17,   1,   0,   5,   0, 
-     48,   0,   4,   0,  88,   0, 
-      0,   0,   1,   0, 232,   4, 
-     56,   0,   0,   0,  22,   0, 
-     80,  17,   1,   0,   5,   0, 
-     52,   0,   4,   0,  88,   0, 
-      0,   0,   1,   0, 232,   4, 
-     64,   0,   0,   0,  22,   0, 
-     80,  17,   1,   0,   5,   0, 
-     56,   0,   4,   0,  88,   0, 
-      0,   0,   1,   0, 232,   4, 
-     68,   0,   0,   0,  22,   0, 
-     80,  17,   1,   0,   5,   0, 
-     60,   0,   4,   0,  88,   0, 
-      0,   0,   1,   0, 232,   4, 
-     72,   0,   0,   0,  70,   0, 
-     62,  17,   5,  16,   0,   0, 
-    136,   0,  60,  83, 105, 109, 
-    112, 108, 101,  80, 105, 120, 
-    101, 108,  83, 104,  97, 100, 
-    101, 114,  32, 114, 101, 116, 
-    117, 114, 110,  32, 118,  97, 
-    108, 117, 101,  62,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,  22,   0, 
-     80,  17,   2,   0,   5,   0, 
-      0,   0,   4,   0,  88,   0, 
-      0,   0,   1,   0, 232,   4, 
-      0,   0,   0,   0,  22,   0, 
-     80,  17,   2,   0,   5,   0, 
-      4,   0,   4,   0,  88,   0, 
-      0,   0,   1,   0, 232,   4, 
-      4,   0,   0,   0,  22,   0, 
-     80,  17,   2,   0,   5,   0, 
-      8,   0,   4,   0,  88,   0, 
-      0,   0,   1,   0, 232,   4, 
-      8,   0,   0,   0,  22,   0, 
-     80,  17,   2,   0,   5,   0, 
-     12,   0,   4,   0,  88,   0, 
-      0,   0,   1,   0, 232,   4, 
-     12,   0,   0,   0,  42,   0, 
-     62,  17,   0,  16,   0,   0, 
-      8,   0, 110,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-     22,   0,  80,  17,   0,   0, 
-      5,   0,   0,   0,   4,   0, 
-    108,   0,   0,   0,   1,   0, 
-     48,   3,   0,   0,   0,   0, 
-     22,   0,  80,  17,   0,   0, 
-      5,   0,   4,   0,   4,   0, 
-    108,   0,   0,   0,   1,   0, 
-    236,   3,   4,   0,   0,   0, 
-     22,   0,  80,  17,   0,   0, 
-      5,   0,   8,   0,   4,   0, 
-    108,   0,   0,   0,   1,   0, 
-    236,   3,   8,   0,   0,   0, 
-     42,   0,  62,  17,   0,  16, 
-      0,   0,   8,   0, 118,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,  22,   0,  80,  17, 
-      0,   0,   5,   0,   0,   0, 
-      4,   0, 236,   0,   0,   0, 
-      1,   0,  64,   2,  16,   0, 
-      0,   0,  22,   0,  80,  17, 
-      0,   0,   5,   0,   4,   0, 
-      4,   0, 236,   0,   0,   0, 
-      1,   0,  52,   3,  20,   0, 
-      0,   0,  22,   0,  80,  17, 
-      0,   0,   5,   0,   8,   0, 
-      4,   0, 236,   0,   0,   0, 
-      1,   0,  52,   3,  24,   0, 
-      0,   0,  42,   0,  62,  17, 
-      0,  16,   0,   0,   8,   0, 
-    108,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,  22,   0, 
-     80,  17,   0,   0,   5,   0, 
-      0,   0,   4,   0, 108,   1, 
-      0,   0,   1,   0, 212,   3, 
-     32,   0,   0,   0,  22,   0, 
-     80,  17,   0,   0,   5,   0, 
-      4,   0,   4,   0, 108,   1, 
-      0,   0,   1,   0, 212,   3, 
-     36,   0,   0,   0,  22,   0, 
-     80,  17,   0,   0,   5,   0, 
-      8,   0,   4,   0, 108,   1, 
-      0,   0,   1,   0, 212,   3, 
-     40,   0,   0,   0,  42,   0, 
-     62,  17,   0,  16,   0,   0, 
-      8,   0,  99, 111, 111, 108, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-     26,   0,  80,  17,   0,   0, 
-      5,   0,   0,   0,   4,   0, 
-    188,   1,   0,   0,   1,   0, 
-    132,   3,  40,   0,  40,   0, 
-     48,   0,   0,   0,  26,   0, 
-     80,  17,   0,   0,   5,   0, 
-      4,   0,   4,   0, 188,   1, 
-      0,   0,   1,   0, 132,   3, 
-     40,   0,  40,   0,  52,   0, 
-      0,   0,  26,   0,  80,  17, 
-      0,   0,   5,   0,   8,   0, 
-      4,   0, 188,   1,   0,   0, 
-      1,   0, 132,   3,  40,   0, 
-     40,   0,  56,   0,   0,   0, 
-     42,   0,  62,  17,   0,  16, 
-      0,   0,   8,   0, 119,  97, 
-    114, 109,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,  22,   0,  80,  17, 
-      0,   0,   5,   0,   0,   0, 
-      4,   0,  32,   2,   0,   0, 
-      1,   0,  32,   3,  64,   0, 
-      0,   0,  22,   0,  80,  17, 
-      0,   0,   5,   0,   4,   0, 
-      4,   0,  32,   2,   0,   0, 
-      1,   0,  32,   3,  68,   0, 
-      0,   0,  22,   0,  80,  17, 
-      0,   0,   5,   0,   8,   0, 
-      4,   0,  32,   2,   0,   0, 
-      1,   0,  32,   3,  72,   0, 
-      0,   0,  50,   0,  62,  17, 
-      0,  16,   0,   0,   8,   0, 
-    104, 105, 103, 104, 108, 105, 
-    103, 104, 116,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-     22,   0,  80,  17,   0,   0, 
-      5,   0,   0,   0,   4,   0, 
-     64,   2,   0,   0,   1,   0, 
-      0,   3,  80,   0,   0,   0, 
-     22,   0,  80,  17,   0,   0, 
-      5,   0,   4,   0,   4,   0, 
-     64,   2,   0,   0,   1,   0, 
-      0,   3,  84,   0,   0,   0, 
-     22,   0,  80,  17,   0,   0, 
-      5,   0,   8,   0,   4,   0, 
-     64,   2,   0,   0,   1,   0, 
-      0,   3,  88,   0,   0,   0, 
-     42,   0,  62,  17,   0,  16, 
-      0,   0,   8,   0, 114,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,  22,   0,  80,  17, 
-      0,   0,   5,   0,   0,   0, 
-      4,   0, 224,   2,   0,   0, 
-      1,   0,  96,   2,  96,   0, 
-      0,   0,  22,   0,  80,  17, 
-      0,   0,   5,   0,   4,   0, 
-      4,   0, 224,   2,   0,   0, 
-      1,   0,  96,   2, 100,   0, 
-      0,   0,  22,   0,  80,  17, 
-      0,   0,   5,   0,   8,   0, 
-      4,   0, 224,   2,   0,   0, 
-      1,   0,  96,   2, 104,   0, 
-      0,   0,  42,   0,  62,  17, 
-     64,   0,   0,   0,   0,   0, 
-    115, 112, 101,  99,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,  22,   0, 
-     80,  17,   0,   0,   1,   0, 
-      0,   0,   4,   0, 128,   3, 
-      0,   0,   1,   0,  12,   1, 
-     12,   0,   0,   0,  42,   0, 
-     62,  17,  64,   0,   0,   0, 
-      0,   0, 116,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-     22,   0,  80,  17,   0,   0, 
-      1,   0,   0,   0,   4,   0, 
-    212,   3,   0,   0,   1,   0, 
-     24,   0,   0,   0,   0,   0, 
-     46,   0,  62,  17,   0,  16, 
-      0,   0,   8,   0,  99, 111, 
-    108, 111, 114,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-     22,   0,  80,  17,   0,   0, 
-      5,   0,   0,   0,   4,   0, 
-     20,   5,   0,   0,   1,   0, 
-     44,   0,   0,   0,   0,   0, 
-     22,   0,  80,  17,   0,   0, 
-      5,   0,   4,   0,   4,   0, 
-     20,   5,   0,   0,   1,   0, 
-     44,   0,   4,   0,   0,   0, 
-     22,   0,  80,  17,   0,   0, 
-      5,   0,   8,   0,   4,   0, 
-     20,   5,   0,   0,   1,   0, 
-     44,   0,   8,   0,   0,   0, 
-      2,   0,   6,   0, 244,   0, 
-      0,   0,  24,   0,   0,   0, 
-      1,   0,   0,   0,  16,   1, 
-    219,  75, 125, 124, 185, 158, 
-     98, 121, 185,  62, 170, 174, 
-    133,   5, 198, 199,   0,   0, 
-    242,   0,   0,   0, 128,   4, 
-      0,   0,   0,   0,   0,   0, 
-      1,   0,   1,   0,  64,   5, 
-      0,   0,   0,   0,   0,   0, 
-     94,   0,   0,   0, 116,   4, 
-      0,   0,  88,   0,   0,   0, 
-     12,   0,   0, 128,  88,   0, 
-      0,   0,  12,   0,   0,   0, 
-    108,   0,   0,   0,  16,   0, 
-      0, 128, 108,   0,   0,   0, 
-     16,   0,   0,   0, 132,   0, 
-      0,   0,  16,   0,   0, 128, 
-    132,   0,   0,   0,  16,   0, 
-      0,   0, 160,   0,   0,   0, 
-     16,   0,   0, 128, 160,   0, 
-      0,   0,  16,   0,   0,   0, 
-    188,   0,   0,   0,  16,   0, 
-      0, 128, 188,   0,   0,   0, 
-     16,   0,   0,   0, 208,   0, 
-      0,   0,  16,   0,   0, 128, 
-    208,   0,   0,   0,  16,   0, 
-      0,   0, 236,   0,   0,   0, 
-     17,   0,   0, 128, 236,   0, 
-      0,   0,  17,   0,   0,   0, 
-      4,   1,   0,   0,  17,   0, 
-      0, 128,   4,   1,   0,   0, 
-     17,   0,   0,   0,  32,   1, 
-      0,   0,  17,   0,   0, 128, 
-     32,   1,   0,   0,  17,   0, 
-      0,   0,  60,   1,   0,   0, 
-     17,   0,   0, 128,  60,   1, 
-      0,   0,  17,   0,   0,   0, 
-     80,   1,   0,   0,  17,   0, 
-      0, 128,  80,   1,   0,   0, 
-     17,   0,   0,   0, 108,   1, 
-      0,   0,  19,   0,   0, 128, 
-    108,   1,   0,   0,  19,   0, 
-      0,   0, 148,   1,   0,   0, 
-     19,   0,   0, 128, 148,   1, 
-      0,   0,  19,   0,   0,   0, 
-    188,   1,   0,   0,  20,   0, 
-      0, 128, 188,   1,   0,   0, 
-     20,   0,   0,   0, 228,   1, 
-      0,   0,  20,   0,   0, 128, 
-    228,   1,   0,   0,  20,   0, 
-      0,   0,  12,   2,   0,   0, 
-     22,   0,   0, 128,  12,   2, 
-      0,   0,  22,   0,   0,   0, 
-     32,   2,   0,   0,  23,   0, 
-      0, 128,  32,   2,   0,   0, 
-     23,   0,   0,   0,  64,   2, 
-      0,   0,  26,   0,   0, 128, 
-     64,   2,   0,   0,  26,   0, 
-      0,   0,  88,   2,   0,   0, 
-     26,   0,   0, 128,  88,   2, 
-      0,   0,  26,   0,   0,   0, 
-    116,   2,   0,   0,  26,   0, 
-      0, 128, 116,   2,   0,   0, 
-     26,   0,   0,   0, 144,   2, 
-      0,   0,  26,   0,   0, 128, 
-    144,   2,   0,   0,  26,   0, 
-      0,   0, 168,   2,   0,   0, 
-     26,   0,   0, 128, 168,   2, 
-      0,   0,  26,   0,   0,   0, 
-    196,   2,   0,   0,  26,   0, 
-      0, 128, 196,   2,   0,   0, 
-     26,   0,   0,   0, 224,   2, 
-      0,   0,  27,   0,   0, 128, 
-    224,   2,   0,   0,  27,   0, 
-      0,   0, 252,   2,   0,   0, 
-     27,   0,   0, 128, 252,   2, 
-      0,   0,  27,   0,   0,   0, 
-     24,   3,   0,   0,  27,   0, 
-      0, 128,  24,   3,   0,   0, 
-     27,   0,   0,   0,  44,   3, 
-      0,   0,  27,   0,   0, 128, 
-     44,   3,   0,   0,  27,   0, 
-      0,   0,  72,   3,   0,   0, 
-     27,   0,   0, 128,  72,   3, 
-      0,   0,  27,   0,   0,   0, 
-    100,   3,   0,   0,  27,   0, 
-      0, 128, 100,   3,   0,   0, 
-     27,   0,   0,   0, 128,   3, 
-      0,   0,  28,   0,   0, 128, 
-    128,   3,   0,   0,  28,   0, 
-      0,   0, 156,   3,   0,   0, 
-     28,   0,   0, 128, 156,   3, 
-      0,   0,  28,   0,   0,   0, 
-    184,   3,   0,   0,  28,   0, 
-      0, 128, 184,   3,   0,   0, 
-     28,   0,   0,   0, 212,   3, 
-      0,   0,  29,   0,   0, 128, 
-    212,   3,   0,   0,  29,   0, 
-      0,   0, 236,   3,   0,   0, 
-     29,   0,   0, 128, 236,   3, 
-      0,   0,  29,   0,   0,   0, 
-      8,   4,   0,   0,  29,   0, 
-      0, 128,   8,   4,   0,   0, 
-     29,   0,   0,   0,  32,   4, 
-      0,   0,  29,   0,   0, 128, 
-     32,   4,   0,   0,  29,   0, 
-      0,   0,  60,   4,   0,   0, 
-     29,   0,   0, 128,  60,   4, 
-      0,   0,  29,   0,   0,   0, 
-     88,   4,   0,   0,  29,   0, 
-      0, 128,  88,   4,   0,   0, 
-     29,   0,   0,   0, 116,   4, 
-      0,   0,  29,   0,   0, 128, 
-    116,   4,   0,   0,  29,   0, 
-      0,   0, 140,   4,   0,   0, 
-     29,   0,   0, 128, 140,   4, 
-      0,   0,  29,   0,   0,   0, 
-    168,   4,   0,   0,  29,   0, 
-      0, 128, 168,   4,   0,   0, 
-     29,   0,   0,   0, 192,   4, 
-      0,   0,  29,   0,   0, 128, 
-    192,   4,   0,   0,  29,   0, 
-      0,   0, 220,   4,   0,   0, 
-     29,   0,   0, 128, 220,   4, 
-      0,   0,  29,   0,   0,   0, 
-    248,   4,   0,   0,  29,   0, 
-      0, 128, 248,   4,   0,   0, 
-     29,   0,   0,   0,  20,   5, 
-      0,   0,  31,   0,   0, 128, 
-     20,   5,   0,   0,  31,   0, 
-      0,   0,  40,   5,   0,   0, 
-     31,   0,   0, 128,  40,   5, 
-      0,   0,  31,   0,   0,   0, 
-     60,   5,   0,   0,  31,   0, 
-      0, 128,  60,   5,   0,   0, 
-     31,   0,   0,   0,   2,   0, 
-     58,   0,   9,   0,  57,   0, 
-      2,   0,  47,   0,  23,   0, 
-     45,   0,   2,   0,  47,   0, 
-     23,   0,  45,   0,   2,   0, 
-     47,   0,  13,   0,  46,   0, 
-      2,   0,  47,   0,  13,   0, 
-     46,   0,   2,   0,  47,   0, 
-     13,   0,  46,   0,   2,   0, 
-     49,   0,  23,   0,  47,   0, 
-      2,   0,  49,   0,  23,   0, 
-     47,   0,   2,   0,  49,   0, 
-     13,   0,  48,   0,   2,   0, 
-     49,   0,  13,   0,  48,   0, 
-      2,   0,  49,   0,  13,   0, 
-     48,   0,   2,   0,  56,   0, 
-     40,   0,  55,   0,   2,   0, 
-     56,   0,  16,   0,  55,   0, 
-      2,   0,  23,   0,   9,   0, 
-     22,   0,   2,   0,  23,   0, 
-      9,   0,  22,   0,   2,   0, 
-     28,   0,   9,   0,  27,   0, 
-      2,   0,  42,   0,   9,   0, 
-     41,   0,   2,   0,  27,   0, 
-     21,   0,  22,   0,   2,   0, 
-     27,   0,  13,   0,  26,   0, 
-      2,   0,  27,   0,  13,   0, 
-     26,   0,   2,   0,  27,   0, 
-     13,   0,  26,   0,   2,   0, 
-     27,   0,  13,   0,  26,   0, 
-      2,   0,  27,   0,  13,   0, 
-     26,   0,   2,   0,  46,   0, 
-     30,   0,  37,   0,   2,   0, 
-     46,   0,  24,   0,  37,   0, 
-      2,   0,  46,   0,  24,   0, 
-     44,   0,   2,   0,  46,   0, 
-     24,   0,  44,   0,   2,   0, 
-     46,   0,  15,   0,  45,   0, 
-      2,   0,  46,   0,  15,   0, 
-     45,   0,   2,   0,  35,   0, 
-     13,   0,  21,   0,   2,   0, 
-     35,   0,  13,   0,  27,   0, 
-      2,   0,  35,   0,  12,   0, 
-     34,   0,   2,   0,  68,   0, 
-     50,   0,  54,   0,   2,   0, 
-     68,   0,  50,   0,  54,   0, 
-      2,   0,  68,   0,  33,   0, 
-     55,   0,   2,   0,  68,   0, 
-     33,   0,  55,   0,   2,   0, 
-     68,   0,  33,   0,  55,   0, 
-      2,   0,  68,   0,  33,   0, 
-     55,   0,   2,   0,  68,   0, 
-     58,   0,  66,   0,   2,   0, 
-     68,   0,  58,   0,  66,   0, 
-      2,   0,  68,   0,  17,   0, 
-     67,   0,   2,   0,  68,   0, 
-     17,   0,  67,   0,   2,   0, 
-     68,   0,  17,   0,  67,   0, 
-      2,   0,  68,   0,  17,   0, 
-     67,   0,   5,   0,  31,   0, 
-      5,   0,  31,   0,   5,   0, 
-     31,   0,   5,   0,  31,   0, 
-      5,   0,  31,   0,   5,   0, 
-     31,   0, 246,   0,   0,   0, 
-      4,   0,   0,   0,   0,   0, 
-      0,   0,   4,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-     11, 202,  49,   1,  56,   0, 
-      0,   0,   0,  16,   0,   0, 
-      7,  16,   0,   0, 228,   0, 
-      0,   0,  10,   0, 255, 255, 
-      4,   0,   0,   0, 255, 255, 
-      3,   0,   0,   0,   0,   0, 
-     28,   0,   0,   0,  28,   0, 
-      0,   0,   8,   0,   0,   0, 
-     36,   0,   0,   0,   0,   0, 
-      0,   0,  22,   0,  27,  21, 
-     64,   0,   0,   0,   3,   0, 
-      0,   0,  12,   0, 102, 108, 
-    111,  97, 116,  51,   0, 243, 
-    242, 241,  22,   0,  27,  21, 
-     64,   0,   0,   0,   4,   0, 
-      0,   0,  16,   0, 102, 108, 
-    111,  97, 116,  52,   0, 243, 
-    242, 241,  98,   0,   3,  18, 
-     13,  21,   3,   0,   0,  16, 
-      0,   0,   0,   0, 119, 111, 
-    114, 108, 100,  80, 111, 115, 
-      0, 241,  13,  21,   3,   0, 
-      0,  16,   0,   0,  12,   0, 
-    110, 111, 114, 109,  97, 108, 
-      0, 243, 242, 241,  13,  21, 
-      3,   0,   1,  16,   0,   0, 
-     24,   0,  99, 111, 108, 111, 
-    114,   0,  13,  21,   3,   0, 
-      0,  16,   0,   0,  40,   0, 
-    101, 121, 101,  86, 101,  99, 
-      0, 243, 242, 241,  13,  21, 
-      3,   0,   0,  16,   0,   0, 
-     52,   0, 108, 105, 103, 104, 
-    116,  86, 101,  99,   0, 241, 
-     38,   0,   5,  21,   5,   0, 
-      0,   0,   2,  16,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,  64,   0,  80, 105, 
-    120, 101, 108,  83, 104,  97, 
-    100, 101, 114,  73, 110, 112, 
-    117, 116,   0, 241,  10,   0, 
-      1,  18,   1,   0,   0,   0, 
-      3,  16,   0,   0,  10,   0, 
-     24,  21,   1,  16,   0,   0, 
-      1,   0,   1,   0,  14,   0, 
-      8,  16,   5,  16,   0,   0, 
-     23,   0,   1,   0,   4,  16, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,  11, 202,  49,   1, 
-     56,   0,   0,   0,   0,  16, 
-      0,   0,   0,  16,   0,   0, 
-      0,   0,   0,   0,  11,   0, 
-    255, 255,   4,   0,   0,   0, 
-    255, 255,   3,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0, 111, 108, 
-    111, 114,  59,  10,   9,  47, 
-     47, 114, 101, 116, 117, 114, 
-    110,  32, 102, 108, 111,  97, 
-    116,  52,  40,  49,  46,  48, 
-     44,  32,  48,  46,  53,  44, 
-     32,  48,  46,  48,  44,  32, 
-     49,  46,  48, 102,  41,  59, 
-     10, 125,   0,   7,   0,   0, 
-      0,   1,   0,   0,   0,  63, 
-      0,   0,   0,  64,   0,   0, 
-      0, 126,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   4, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-     68,  51,  68,  83,  72,  68, 
-     82,   0,  64,   5,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-     32,   0,   0,  96,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0, 255, 255, 255, 255, 
-     26,   9,  47, 241,   8,   0, 
-      0,   0,   8,   2,   0,   0, 
-      1,   0,   0,   0,   1,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   1,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-     30,   0,  37,  17,   0,   0, 
-      0,   0, 148,   0,   0,   0, 
-      1,   0,  83, 105, 109, 112, 
-    108, 101,  80, 105, 120, 101, 
-    108,  83, 104,  97, 100, 101, 
-    114,   0,  26,   9,  47, 241, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,  16,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-    255, 255, 255, 255,  26,   9, 
-     47, 241,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0, 255, 255, 
-    255, 255, 119,   9,  49,   1, 
-      1,   0,   0,   0,  13,   0, 
-      0, 142,  14,   0,  63,  92, 
-     15,   0,   0,   0,  88,   0, 
-      0,   0,  32,   0,   0,   0, 
-     44,   0,   0,   0,  76,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,  22,   0, 
-      0,   0,  25,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      1,   0,   0,   0,   0,   0, 
-      0,   0,  64,   5,   0,   0, 
-     32,   0,   0,  96,   0,   0, 
-    119,  80,   0,   0,   0,   0, 
-      0,   0,   0,   0,   2,   0, 
-      9,   0, 104,   7,   0,   0, 
-      0,   0,   0,   0, 180,   4, 
-      0,   0,   1,   0,   0,   0, 
-      8, 232, 218,   2,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-     83, 105, 109, 112, 108, 101, 
-     80, 105, 120, 101, 108,  83, 
-    104,  97, 100, 101, 114,   0, 
-    110, 111, 110, 101,   0,   0, 
-     45, 186,  46, 241,   1,   0, 
-      0,   0,   0,   0,   0,   0, 
-     64,   5,   0,   0,  32,   0, 
-      0,  96,   0,   0, 119,  80, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   2,   0,   2,   0, 
-      7,   0,   0,   0,   0,   0, 
-      1,   0, 255, 255, 255, 255, 
-      0,   0,   0,   0,  64,   5, 
-      0,   0,   8,   2,   0,   0, 
-      0,   0,   0,   0, 255, 255, 
-    255, 255,   0,   0,   0,   0, 
-    255, 255, 255, 255,   1,   0, 
-      1,   0,   0,   0,   1,   0, 
-      0,   0,   0,   0,  69,  58, 
-     92,  80, 114, 111, 106, 101, 
-     99, 116, 115,  92,  78, 105, 
-     99, 107, 101, 108,  92,  78, 
-    105,  99, 107, 101, 108,  92, 
-     68,  97, 116,  97,  92,  83, 
-    104,  97, 100, 101, 114, 115, 
-     92,  83, 105, 109, 112, 108, 
-    101,  80, 105, 120, 101, 108, 
-     83, 104,  97, 100, 101, 114, 
-     46, 104, 108, 115, 108,   0, 
-      0,   0, 254, 239, 254, 239, 
-      1,   0,   0,   0,   1,   0, 
-      0,   0,   0,   1,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255,  12,   0, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-    148,  46,  49,   1,  13, 146, 
-     50,  97,   1,   0,   0,   0, 
-    162, 150, 113, 141, 195,  32, 
-    180,  71, 153, 110, 206, 110, 
-    127,  41, 119,  80, 107,   0, 
-      0,   0,  47,  76, 105, 110, 
-    107,  73, 110, 102, 111,   0, 
-     47, 110,  97, 109, 101, 115, 
-      0,  47, 115, 114,  99,  47, 
-    104, 101,  97, 100, 101, 114, 
-     98, 108, 111,  99, 107,   0, 
-     47, 115, 114,  99,  47, 102, 
-    105, 108, 101, 115,  47, 101, 
-     58,  92, 112, 114, 111, 106, 
-    101,  99, 116, 115,  92, 110, 
-    105,  99, 107, 101, 108,  92, 
-    110, 105,  99, 107, 101, 108, 
-     92, 100,  97, 116,  97,  92, 
-    115, 104,  97, 100, 101, 114, 
-    115,  92, 115, 105, 109, 112, 
-    108, 101, 112, 105, 120, 101, 
-    108, 115, 104,  97, 100, 101, 
-    114,  46, 104, 108, 115, 108, 
-      0,   4,   0,   0,   0,   6, 
-      0,   0,   0,   1,   0,   0, 
-      0,  27,   0,   0,   0,   0, 
-      0,   0,   0,  34,   0,   0, 
-      0,   8,   0,   0,   0,  17, 
-      0,   0,   0,   7,   0,   0, 
-      0,  10,   0,   0,   0,   6, 
-      0,   0,   0,   0,   0,   0, 
-      0,   5,   0,   0,   0,   0, 
-      0,   0,   0, 220,  81,  51, 
-      1,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,  16,   0,   0,   0, 
-     32,   0,   0,   0, 199,   0, 
-      0,   0,  28,   1,   0,   0, 
-     95,   1,   0,   0,  56,   0, 
-      0,   0,   0,   0,   0,   0, 
-     83,   4,   0,   0, 128,   0, 
-      0,   0, 164,   3,   0,   0, 
-     36,  12,   0,   0,  36,   0, 
-      0,   0,   0,   0,   0,   0, 
-     40,   0,   0,   0,  32,   2, 
-      0,   0,  44,   0,   0,   0, 
-     32,   0,   0,   0,   3,   0, 
-      0,   0,  28,   0,   0,   0, 
-     19,   0,   0,   0,  27,   0, 
-      0,   0,  20,   0,   0,   0, 
-     10,   0,   0,   0,   6,   0, 
-      0,   0,  21,   0,   0,   0, 
-     11,   0,   0,   0,   8,   0, 
-      0,   0,   9,   0,   0,   0, 
-     12,   0,   0,   0,  13,   0, 
-      0,   0,  14,   0,   0,   0, 
-     15,   0,   0,   0,  16,   0, 
-      0,   0,  17,   0,   0,   0, 
-     18,   0,   0,   0,   7,   0, 
-      0,   0,  22,   0,   0,   0, 
-     23,   0,   0,   0,  24,   0, 
-      0,   0,  26,   0,   0,   0, 
-     25,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,  29,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-     83,  84,  65,  84, 116,   0, 
-      0,   0,  47,   0,   0,   0, 
-      8,   0,   0,   0,   0,   0, 
-      0,   0,   6,   0,   0,   0, 
-     41,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      1,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      5,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,  82,  68, 
-     69,  70,  68,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-     28,   0,   0,   0,   0,   4, 
-    255, 255,   5,   1,   0,   0, 
-     28,   0,   0,   0,  77, 105, 
-     99, 114, 111, 115, 111, 102, 
-    116,  32,  40,  82,  41,  32, 
-     72,  76,  83,  76,  32,  83, 
-    104,  97, 100, 101, 114,  32, 
-     67, 111, 109, 112, 105, 108, 
-    101, 114,  32,  49,  48,  46, 
-     49,   0,  73,  83,  71,  78, 
-    168,   0,   0,   0,   5,   0, 
-      0,   0,   8,   0,   0,   0, 
-    128,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      3,   0,   0,   0,   0,   0, 
-      0,   0,   7,   7,   0,   0, 
-    143,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      3,   0,   0,   0,   1,   0, 
-      0,   0,   7,   7,   0,   0, 
-    150,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      3,   0,   0,   0,   2,   0, 
-      0,   0,  15,   7,   0,   0, 
-    156,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      3,   0,   0,   0,   3,   0, 
-      0,   0,   7,   7,   0,   0, 
-    161,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      3,   0,   0,   0,   4,   0, 
-      0,   0,   7,   7,   0,   0, 
-     87,  79,  82,  76,  68,  95, 
-     80,  79,  83,  73,  84,  73, 
-     79,  78,   0,  78,  79,  82, 
-     77,  65,  76,   0,  67,  79, 
-     76,  79,  82,   0,  86,  73, 
-     69,  87,   0,  76,  73,  71, 
-     72,  84,   0, 171,  79,  83, 
-     71,  78,  44,   0,   0,   0, 
-      1,   0,   0,   0,   8,   0, 
-      0,   0,  32,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   3,   0,   0,   0, 
-      0,   0,   0,   0,  15,   0, 
-      0,   0,  83,  86,  95,  84, 
-     65,  82,  71,  69,  84,   0, 
-    171, 171
-};
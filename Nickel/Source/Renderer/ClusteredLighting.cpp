@@ -0,0 +1,356 @@
+#include "ClusteredLighting.h"
+#include "../Camera.h"
+#include "../Threading.h"
+#include <algorithm>
+#include <bit>
+#include <chrono>
+#include <cmath>
+#include <cstring>
+
+#if defined(_M_X64) || defined(__x86_64__)
+#define NICKEL_CLUSTER_SSE 1
+#include <immintrin.h> // NOTE: SSE2 is part of x64, no runtime dispatch needed
+#endif
+
+namespace Nickel::Renderer {
+	namespace {
+		struct Box {
+			f32 min[3];
+			f32 max[3];
+		};
+
+		// NOTE: padding entries never pass a test, their distance to any box overflows to infinity
+		constexpr f32 PaddingCenter = 1e30f;
+
+		auto SpanBox(f32 tileMin, f32 tileMax, f32 z0, f32 z1, f32& outMin, f32& outMax) -> void {
+			// NOTE: a tile edge is a plane through the eye, its x (or y) grows linearly with depth
+			outMin = std::min(tileMin * z0, tileMin * z1);
+			outMax = std::max(tileMax * z0, tileMax * z1);
+		}
+
+#if defined(NICKEL_CLUSTER_SSE)
+		// NOTE: sphere vs AABB for 4 spheres, bit i set when sphere i overlaps
+		auto OverlapMask(const f32* x, const f32* y, const f32* z, const f32* radius, const Box& box) -> u32 {
+			const __m128 zero = _mm_setzero_ps();
+			const auto axisDistance = [&](const f32* center, u32 axis) {
+				const __m128 c = _mm_loadu_ps(center);
+				const __m128 below = _mm_sub_ps(_mm_set1_ps(box.min[axis]), c);
+				const __m128 above = _mm_sub_ps(c, _mm_set1_ps(box.max[axis]));
+				const __m128 d = _mm_max_ps(_mm_max_ps(below, above), zero);
+				return _mm_mul_ps(d, d);
+			};
+
+			const __m128 distanceSq = _mm_add_ps(_mm_add_ps(axisDistance(x, 0), axisDistance(y, 1)), axisDistance(z, 2));
+			const __m128 r = _mm_loadu_ps(radius);
+			return static_cast<u32>(_mm_movemask_ps(_mm_cmple_ps(distanceSq, _mm_mul_ps(r, r))));
+		}
+#else
+		auto OverlapMask(const f32* x, const f32* y, const f32* z, const f32* radius, const Box& box) -> u32 {
+			u32 mask = 0;
+			for (u32 i = 0; i < 4; i++) {
+				const f32 center[3] = { x[i], y[i], z[i] };
+				f32 distanceSq = 0.0f;
+				for (u32 axis = 0; axis < 3; axis++) {
+					const f32 d = std::max(std::max(box.min[axis] - center[axis], center[axis] - box.max[axis]), 0.0f);
+					distanceSq += d * d;
+				}
+
+				if (distanceSq <= radius[i] * radius[i])
+					mask |= 1u << i;
+			}
+
+			return mask;
+		}
+#endif
+
+		auto ToMilliseconds(std::chrono::steady_clock::duration duration) -> f64 {
+			return std::chrono::duration<f64, std::milli>(duration).count();
+		}
+	}
+
+	auto MakeClusterView(const Camera& camera) -> ClusterView {
+		DirectX::XMFLOAT4X4 view;
+		DirectX::XMFLOAT4X4 projection;
+		DirectX::XMStoreFloat4x4(&view, camera.viewMatrix);
+		DirectX::XMStoreFloat4x4(&projection, camera.projectionMatrix);
+
+		ClusterView result{};
+		std::memcpy(result.viewMatrix, view.m, sizeof(result.viewMatrix));
+		result.projectionScale[0] = projection._11;
+		result.projectionScale[1] = projection._22;
+		result.nearClip = camera.nearClip;
+		result.farClip = camera.farClip;
+		return result;
+	}
+
+	auto ClusteredLighting::SphereList::Reset(u32 capacity) -> void {
+		for (auto* values : { &x, &y, &z, &radius }) {
+			values->clear();
+			values->reserve(capacity + 3);
+		}
+
+		light.clear();
+		light.reserve(capacity + 3);
+		count = 0;
+	}
+
+	auto ClusteredLighting::SphereList::Push(f32 px, f32 py, f32 pz, f32 r, u32 index) -> void {
+		x.push_back(px);
+		y.push_back(py);
+		z.push_back(pz);
+		radius.push_back(r);
+		light.push_back(index);
+		count++;
+	}
+
+	auto ClusteredLighting::SphereList::Pad() -> void {
+		while (x.size() % 4 != 0) {
+			x.push_back(PaddingCenter);
+			y.push_back(PaddingCenter);
+			z.push_back(PaddingCenter);
+			radius.push_back(0.0f);
+			light.push_back(0);
+		}
+	}
+
+	ClusteredLighting::ClusteredLighting(const ClusterGridDesc& desc) : grid(desc) {
+		Assert(grid.tilesX > 0 && grid.tilesY > 0 && grid.slices > 0);
+	}
+
+	auto ClusteredLighting::Clear() -> void {
+		lights.clear();
+		bounds.clear();
+	}
+
+	auto ClusteredLighting::AddPointLight(const PointLight& light) -> void {
+		Assert(light.range > 0.0f);
+
+		lights.push_back(ClusterLight{
+			.position = { light.position.x, light.position.y, light.position.z },
+			.range = light.range,
+			.color = { light.color.x, light.color.y, light.color.z },
+			.spotScale = 0.0f,
+			.direction = { 0.0f, 0.0f, 0.0f },
+			.spotOffset = 1.0f
+		});
+		bounds.push_back(Vec4{ light.position.x, light.position.y, light.position.z, light.range });
+	}
+
+	auto ClusteredLighting::AddSpotLight(const SpotLight& light) -> void {
+		Assert(light.range > 0.0f);
+		Assert(light.outerAngle > 0.0f && light.outerAngle < 1.5707963f && light.innerAngle <= light.outerAngle);
+
+		const f32 cosOuter = std::cos(light.outerAngle);
+		const f32 cosInner = std::cos(light.innerAngle);
+		const f32 spotScale = 1.0f / std::max(cosInner - cosOuter, 1e-4f);
+
+		lights.push_back(ClusterLight{
+			.position = { light.position.x, light.position.y, light.position.z },
+			.range = light.range,
+			.color = { light.color.x, light.color.y, light.color.z },
+			.spotScale = spotScale,
+			.direction = { light.direction.x, light.direction.y, light.direction.z },
+			.spotOffset = -cosOuter * spotScale
+		});
+
+		// NOTE: smallest sphere around the cone, wide cones are bounded by their cap, narrow ones by the
+		// sphere through the apex and the rim
+		const f32 sinOuter = std::sin(light.outerAngle);
+		const bool wide = light.outerAngle > 0.78539816f;
+		const f32 centerDistance = wide ? light.range * cosOuter : light.range / (2.0f * cosOuter);
+		const f32 radius = wide ? light.range * sinOuter : centerDistance;
+		const Vec3 center = light.position + light.direction * centerDistance;
+		bounds.push_back(Vec4{ center.x, center.y, center.z, radius });
+	}
+
+	auto ClusteredLighting::Cull(const ClusterView& view) -> void {
+		const auto start = std::chrono::steady_clock::now();
+		Assert(view.nearClip > 0.0f && view.farClip > view.nearClip);
+
+		const u32 lightCount = static_cast<u32>(lights.size());
+		const u32 clusterCount = grid.tilesX * grid.tilesY * grid.slices;
+		clusters.assign(clusterCount, ClusterRange{});
+
+		// NOTE: exponential slices, every slice has the same depth ratio so far clusters don't get thin
+		const f32 depthRatio = std::log(view.farClip / view.nearClip);
+		shaderData = ClusterShaderData{
+			.projectionScale = { view.projectionScale[0], view.projectionScale[1] },
+			.sliceScale = grid.slices / depthRatio,
+			.sliceBias = -(grid.slices * std::log(view.nearClip)) / depthRatio,
+			.gridSize = { grid.tilesX, grid.tilesY, grid.slices },
+			.lightCount = lightCount
+		};
+
+		tileX.resize(grid.tilesX + 1);
+		for (u32 i = 0; i <= grid.tilesX; i++)
+			tileX[i] = (-1.0f + 2.0f * i / grid.tilesX) / view.projectionScale[0];
+
+		tileY.resize(grid.tilesY + 1);
+		for (u32 i = 0; i <= grid.tilesY; i++)
+			tileY[i] = (-1.0f + 2.0f * i / grid.tilesY) / view.projectionScale[1];
+
+		sliceZ.resize(grid.slices + 1);
+		for (u32 i = 0; i <= grid.slices; i++)
+			sliceZ[i] = view.nearClip * std::exp(depthRatio * i / grid.slices);
+
+		// NOTE: bounding spheres to view space, lights completely in front of the near or behind the far plane are dropped here
+		const auto& m = view.viewMatrix;
+		viewLights.Reset(lightCount);
+		for (u32 i = 0; i < lightCount; i++) {
+			const auto& b = bounds[i];
+			const f32 z = b.x * m[0][2] + b.y * m[1][2] + b.z * m[2][2] + m[3][2];
+			if (z + b.w < view.nearClip || z - b.w > view.farClip)
+				continue;
+
+			const f32 x = b.x * m[0][0] + b.y * m[1][0] + b.z * m[2][0] + m[3][0];
+			const f32 y = b.x * m[0][1] + b.y * m[1][1] + b.z * m[2][1] + m[3][1];
+			viewLights.Push(x, y, z, b.w, i);
+		}
+		viewLights.Pad();
+
+		const u32 chunkCount = std::min(GetWorkerCount(), grid.slices);
+		chunks.resize(chunkCount);
+		for (auto& chunk : chunks)
+			chunk.indices.clear();
+
+		if (viewLights.count > 0)
+			ParallelForChunks(grid.slices, chunkCount, [this](u32 chunkIdx, u32 begin, u32 end) { CullSlices(chunkIdx, begin, end); });
+
+		// NOTE: chunks cover consecutive slices in order, so their lists concatenate into the final one
+		u32 indexCount = 0;
+		for (const auto& chunk : chunks)
+			indexCount += static_cast<u32>(chunk.indices.size());
+
+		lightIndices.resize(indexCount);
+		const u32 clustersPerSlice = grid.tilesX * grid.tilesY;
+		const u32 slicesPerChunk = (grid.slices + chunkCount - 1) / chunkCount;
+		u32 base = 0;
+		for (u32 c = 0; c < chunkCount; c++) {
+			const auto& chunk = chunks[c];
+			if (!chunk.indices.empty())
+				std::memcpy(lightIndices.data() + base, chunk.indices.data(), chunk.indices.size() * sizeof(u32));
+
+			const u32 first = c * slicesPerChunk * clustersPerSlice;
+			const u32 last = std::min((c + 1) * slicesPerChunk, grid.slices) * clustersPerSlice;
+			for (u32 i = first; i < last; i++)
+				clusters[i].offset += base;
+
+			base += static_cast<u32>(chunk.indices.size());
+		}
+
+		stats = ClusterStats{ .lightCount = lightCount, .clusterCount = clusterCount, .indexCount = indexCount };
+		for (const auto& cluster : clusters) {
+			stats.occupiedClusters += cluster.count > 0 ? 1 : 0;
+			stats.maxLightsPerCluster = std::max(stats.maxLightsPerCluster, cluster.count);
+		}
+		stats.cullMilliseconds = ToMilliseconds(std::chrono::steady_clock::now() - start);
+	}
+
+	auto ClusteredLighting::CullSlices(u32 chunkIdx, u32 begin, u32 end) -> void {
+		auto& out = chunks[chunkIdx];
+		auto& sliceLights = out.sliceLights;
+		auto& rowLights = out.rowLights;
+
+		// NOTE: hierarchical, the whole slice first, then each row of tiles, then the cells of the row. Every level
+		// only tests what survived the level above, so empty space is rejected in a few tests per light.
+		const auto filter = [](const SphereList& in, const Box& box, SphereList& result) {
+			result.Reset(in.count);
+			for (u32 i = 0; i < in.x.size(); i += 4) {
+				u32 mask = OverlapMask(&in.x[i], &in.y[i], &in.z[i], &in.radius[i], box);
+				while (mask != 0) {
+					const u32 lane = i + std::countr_zero(mask);
+					result.Push(in.x[lane], in.y[lane], in.z[lane], in.radius[lane], in.light[lane]);
+					mask &= mask - 1;
+				}
+			}
+			result.Pad();
+		};
+
+		for (u32 slice = begin; slice < end; slice++) {
+			const f32 z0 = sliceZ[slice];
+			const f32 z1 = sliceZ[slice + 1];
+
+			Box sliceBox{ .min = { 0.0f, 0.0f, z0 }, .max = { 0.0f, 0.0f, z1 } };
+			SpanBox(tileX.front(), tileX.back(), z0, z1, sliceBox.min[0], sliceBox.max[0]);
+			SpanBox(tileY.front(), tileY.back(), z0, z1, sliceBox.min[1], sliceBox.max[1]);
+
+			const u32 sliceFirst = slice * grid.tilesY * grid.tilesX;
+			filter(viewLights, sliceBox, sliceLights);
+			if (sliceLights.count == 0) {
+				for (u32 i = 0; i < grid.tilesX * grid.tilesY; i++)
+					clusters[sliceFirst + i].offset = static_cast<u32>(out.indices.size());
+				continue;
+			}
+
+			for (u32 row = 0; row < grid.tilesY; row++) {
+				Box rowBox = sliceBox;
+				SpanBox(tileY[row], tileY[row + 1], z0, z1, rowBox.min[1], rowBox.max[1]);
+				filter(sliceLights, rowBox, rowLights);
+
+				for (u32 column = 0; column < grid.tilesX; column++) {
+					auto& cluster = clusters[sliceFirst + row * grid.tilesX + column];
+					cluster.offset = static_cast<u32>(out.indices.size());
+					if (rowLights.count == 0)
+						continue;
+
+					Box cellBox = rowBox;
+					SpanBox(tileX[column], tileX[column + 1], z0, z1, cellBox.min[0], cellBox.max[0]);
+					for (u32 i = 0; i < rowLights.x.size(); i += 4) {
+						u32 mask = OverlapMask(&rowLights.x[i], &rowLights.y[i], &rowLights.z[i], &rowLights.radius[i], cellBox);
+						while (mask != 0) {
+							out.indices.push_back(rowLights.light[i + std::countr_zero(mask)]);
+							mask &= mask - 1;
+						}
+					}
+
+					cluster.count = static_cast<u32>(out.indices.size()) - cluster.offset;
+				}
+			}
+		}
+	}
+
+	auto ClusteredLighting::Upload(const PlatformInterface& gfx) -> void {
+		// NOTE: grows by powers of two and never shrinks, a light count that wobbles doesn't recreate buffers every frame
+		const auto ensure = [&](BufferHandle& buffer, u32& capacity, u32 count, u32 stride) {
+			count = std::max(count, 1u);
+			if (buffer.IsValid() && count <= capacity)
+				return;
+
+			if (buffer.IsValid())
+				gfx.DestroyBuffer(buffer);
+
+			capacity = std::bit_ceil(count);
+			buffer = gfx.CreateBuffer(BufferDesc{ .type = BufferType::Structured, .usage = BufferUsage::Dynamic, .size = capacity * stride, .stride = stride }, nullptr);
+		};
+
+		ensure(lightBuffer, lightCapacity, static_cast<u32>(lights.size()), sizeof(ClusterLight));
+		ensure(indexBuffer, indexCapacity, static_cast<u32>(lightIndices.size()), sizeof(u32));
+		ensure(rangeBuffer, rangeCapacity, static_cast<u32>(clusters.size()), sizeof(ClusterRange));
+		if (!constantBuffer.IsValid())
+			constantBuffer = gfx.CreateBuffer(BufferDesc{ .type = BufferType::Constant, .size = sizeof(ClusterShaderData) }, nullptr);
+
+		if (!lights.empty())
+			gfx.UpdateBuffer(lightBuffer, lights.data(), static_cast<u32>(lights.size() * sizeof(ClusterLight)));
+		if (!lightIndices.empty())
+			gfx.UpdateBuffer(indexBuffer, lightIndices.data(), static_cast<u32>(lightIndices.size() * sizeof(u32)));
+		if (!clusters.empty())
+			gfx.UpdateBuffer(rangeBuffer, clusters.data(), static_cast<u32>(clusters.size() * sizeof(ClusterRange)));
+		UpdateBuffer(gfx, constantBuffer, shaderData);
+	}
+
+	auto ClusteredLighting::Bind(CommandList& list) const -> void {
+		list.SetShaderBuffer(ShaderStage::Pixel, ClusterLightSlot, lightBuffer);
+		list.SetShaderBuffer(ShaderStage::Pixel, ClusterLightIndexSlot, indexBuffer);
+		list.SetShaderBuffer(ShaderStage::Pixel, ClusterRangeSlot, rangeBuffer);
+		list.SetConstantBuffer(ShaderStage::Pixel, ClusterConstantSlot, constantBuffer);
+	}
+
+	auto ClusteredLighting::Release(const PlatformInterface& gfx) -> void {
+		for (auto buffer : { lightBuffer, indexBuffer, rangeBuffer, constantBuffer })
+			if (buffer.IsValid())
+				gfx.DestroyBuffer(buffer);
+
+		lightBuffer = indexBuffer = rangeBuffer = constantBuffer = {};
+		lightCapacity = indexCapacity = rangeCapacity = 0;
+	}
+}
@@ -0,0 +1,155 @@
+#pragma once
+
+#include "RendererPlatformInterface.h"
+#include "CommandList.h"
+#include "../Math.h"
+#include <vector>
+
+namespace Nickel {
+	class Camera;
+}
+
+// Clustered forward lighting. The view frustum is split into a froxel grid (screen tiles times exponential depth
+// slices), every frame the lights are culled into a list per cluster on the CPU and the lists are uploaded as
+// structured buffers. The PBR pixel shader finds its cluster from the view space position and only shades the
+// lights in that list, see ClusteredLighting.hlsl.
+namespace Nickel::Renderer {
+	// NOTE: texture slots after the PBR material's table, plus one constant buffer after the material parameters
+	constexpr u32 ClusterLightSlot = 8;
+	constexpr u32 ClusterLightIndexSlot = 9;
+	constexpr u32 ClusterRangeSlot = 10;
+	constexpr u32 ClusterConstantSlot = 4;
+
+	struct PointLight {
+		Vec3 position;
+		f32 range; // NOTE: the light falls off to zero here, nothing past it is affected
+		Vec3 color;
+	};
+
+	struct SpotLight {
+		Vec3 position;
+		f32 range;
+		Vec3 color;
+		Vec3 direction; // NOTE: normalized
+		f32 innerAngle; // NOTE: half angles in radians, full intensity inside the inner cone
+		f32 outerAngle;
+	};
+
+	// NOTE: one element of StructuredBuffer<ClusterLight>, the cone term is saturate(dot(dir, -L) * spotScale + spotOffset),
+	// point lights have scale 0 and offset 1
+	struct ClusterLight {
+		f32 position[3];
+		f32 range;
+		f32 color[3];
+		f32 spotScale;
+		f32 direction[3];
+		f32 spotOffset;
+	};
+	static_assert(sizeof(ClusterLight) == 48, "has to match ClusterLight in ClusteredLighting.hlsl");
+
+	// NOTE: offset and count into the light index list, one per cluster
+	struct ClusterRange {
+		u32 offset;
+		u32 count;
+	};
+
+	struct alignas(16) ClusterShaderData {
+		f32 projectionScale[2];
+		f32 sliceScale; // NOTE: slice = log(viewZ) * sliceScale + sliceBias
+		f32 sliceBias;
+		u32 gridSize[3];
+		u32 lightCount;
+	};
+	static_assert(sizeof(ClusterShaderData) == 32, "has to match the ClusterData cbuffer");
+
+	struct ClusterGridDesc {
+		u32 tilesX = 16;
+		u32 tilesY = 9;
+		u32 slices = 24;
+	};
+
+	// NOTE: what the grid is built from, row vector matrices like DirectXMath
+	struct ClusterView {
+		f32 viewMatrix[4][4];
+		f32 projectionScale[2]; // NOTE: _11 and _22 of the perspective projection
+		f32 nearClip;
+		f32 farClip;
+	};
+
+	auto MakeClusterView(const Camera& camera) -> ClusterView;
+
+	struct ClusterStats {
+		u32 lightCount;
+		u32 clusterCount;
+		u32 occupiedClusters;
+		u32 indexCount;
+		u32 maxLightsPerCluster;
+		f64 cullMilliseconds;
+	};
+
+	class ClusteredLighting {
+	public:
+		ClusteredLighting() = default;
+		explicit ClusteredLighting(const ClusterGridDesc& desc);
+
+		auto Clear() -> void; // NOTE: drops the lights, once per frame before adding them again
+		auto AddPointLight(const PointLight& light) -> void;
+		auto AddSpotLight(const SpotLight& light) -> void;
+
+		// NOTE: multithreaded over depth slices, only touches CPU memory so it can run without a device
+		auto Cull(const ClusterView& view) -> void;
+
+		auto Upload(const PlatformInterface& gfx) -> void; // NOTE: creates or grows the buffers, once per frame after Cull
+		auto Bind(CommandList& list) const -> void; // NOTE: pixel stage, read-only, safe from recording workers
+		auto Release(const PlatformInterface& gfx) -> void;
+
+		inline auto GetStats() const -> const ClusterStats& { return stats; }
+		inline auto GetGrid() const -> const ClusterGridDesc& { return grid; }
+		inline auto GetClusters() const -> std::span<const ClusterRange> { return clusters; }
+		inline auto GetLightIndices() const -> std::span<const u32> { return lightIndices; }
+		inline auto GetLights() const -> std::span<const ClusterLight> { return lights; }
+
+	private:
+		// NOTE: bounding spheres in view space, structure of arrays padded to a multiple of 4 for the SIMD tests
+		struct SphereList {
+			std::vector<f32> x, y, z, radius;
+			std::vector<u32> light;
+			u32 count = 0;
+
+			auto Reset(u32 capacity) -> void;
+			auto Push(f32 px, f32 py, f32 pz, f32 r, u32 index) -> void;
+			auto Pad() -> void;
+		};
+
+		struct ChunkOutput {
+			SphereList sliceLights;
+			SphereList rowLights;
+			std::vector<u32> indices;
+		};
+
+		auto CullSlices(u32 chunkIdx, u32 begin, u32 end) -> void;
+
+		ClusterGridDesc grid;
+		std::vector<ClusterLight> lights;
+		std::vector<Vec4> bounds; // NOTE: world space bounding sphere per light, center and radius
+
+		SphereList viewLights;
+		std::vector<f32> tileX; // NOTE: tile boundaries as view space x/z and y/z, tilesX + 1 and tilesY + 1 entries
+		std::vector<f32> tileY;
+		std::vector<f32> sliceZ; // NOTE: slices + 1 view space depths
+		std::vector<ChunkOutput> chunks;
+
+		std::vector<ClusterRange> clusters;
+		std::vector<u32> lightIndices;
+		ClusterShaderData shaderData{};
+		ClusterStats stats{};
+
+		BufferHandle lightBuffer;
+		BufferHandle indexBuffer;
+		BufferHandle rangeBuffer;
+		BufferHandle constantBuffer;
+		u32 lightCapacity = 0;
+		u32 indexCapacity = 0;
+		u32 rangeCapacity = 0;
+	};
+}
@@ -0,0 +1,314 @@
+#include "CommandList.h"
+
+namespace Nickel::Renderer {
+	namespace {
+		constexpr auto AlignCommandSize(u32 size) -> u32 {
+			return (size + (CommandAlignment - 1)) & ~(CommandAlignment - 1);
+		}
+
+		constexpr auto StageIndex(ShaderStage stage) -> u32 {
+			return static_cast<u32>(stage);
+		}
+
+		enum StateBit : u32 {
+			StateProgram          = 1 << 0,
+			StateRasterizer       = 1 << 1,
+			StateDepthStencil     = 1 << 2,
+			StatePipelineContents = StateProgram | StateRasterizer | StateDepthStencil,
+			StateVertexResources  = 1 << 3,
+			StatePixelResources   = 1 << 4
+		};
+
+		constexpr auto ResourceStateBit(ShaderStage stage) -> u32 {
+			return stage == ShaderStage::Vertex ? StateVertexResources : StatePixelResources;
+		}
+	}
+
+	template <typename CmdT>
+	auto CommandList::Push(CommandType type, u32 payloadSize) -> CmdT* {
+		const u32 size = AlignCommandSize(sizeof(CmdT) + payloadSize);
+		Assert(size <= UINT16_MAX);
+
+		const u64 offset = data.size();
+		data.resize(offset + size);
+
+		auto cmd = reinterpret_cast<CmdT*>(data.data() + offset);
+		cmd->header = CommandHeader{ .type = type, .pad = 0, .size = static_cast<u16>(size) };
+
+		stats.commandCount++;
+		stats.bytesUsed = data.size();
+
+		return cmd;
+	}
+
+	auto CommandList::Reset() -> void {
+		data.clear();
+		stats = {};
+		InvalidateCachedState();
+	}
+
+	auto CommandList::InvalidateCachedState() -> void {
+		cached = {};
+	}
+
+	auto CommandList::SetRenderTarget(RenderTargetHandle color, DepthTargetHandle depth) -> void {
+		if (cached.color == color && cached.depth == depth && (color.IsValid() || depth.IsValid())) {
+			stats.redundantStateSkips++;
+			return;
+		}
+
+		auto cmd = Push<CmdSetRenderTarget>(CommandType::SetRenderTarget);
+		cmd->color = color;
+		cmd->depth = depth;
+
+		cached.color = color;
+		cached.depth = depth;
+	}
+
+	auto CommandList::SetViewport(const Viewport& viewport) -> void {
+		auto cmd = Push<CmdSetViewport>(CommandType::SetViewport);
+		cmd->viewport = viewport;
+	}
+
+	auto CommandList::Clear(u32 clearFlags, const f32 color[4], f32 depth, u8 stencil) -> void {
+		auto cmd = Push<CmdClear>(CommandType::Clear);
+		cmd->flags = clearFlags;
+		std::memcpy(cmd->color, color, sizeof(cmd->color));
+		cmd->depth = depth;
+		cmd->stencil = stencil;
+	}
+
+	auto CommandList::SetProgram(ProgramHandle program) -> void {
+		if ((cached.unknownState & StateProgram) == 0 && cached.program == program) {
+			stats.redundantStateSkips++;
+			return;
+		}
+
+		Push<CmdSetProgram>(CommandType::SetProgram)->program = program;
+		cached.program = program;
+		cached.pipeline = {};
+		cached.unknownState &= ~StateProgram;
+	}
+
+	auto CommandList::SetPipeline(PipelineHandle pipeline) -> void {
+		if (cached.pipeline == pipeline && pipeline.IsValid()) {
+			stats.redundantStateSkips++;
+			return;
+		}
+
+		Push<CmdSetPipeline>(CommandType::SetPipeline)->pipeline = pipeline;
+
+		// NOTE: the list only sees the handle, the next individual bind of any of the pipeline's states has to go through
+		cached.pipeline = pipeline;
+		cached.unknownState |= StatePipelineContents;
+	}
+
+	auto CommandList::SetRasterizerState(RasterizerStateHandle state) -> void {
+		if ((cached.unknownState & StateRasterizer) == 0 && cached.rasterizerState == state) {
+			stats.redundantStateSkips++;
+			return;
+		}
+
+		Push<CmdSetRasterizerState>(CommandType::SetRasterizerState)->state = state;
+		cached.rasterizerState = state;
+		cached.pipeline = {};
+		cached.unknownState &= ~StateRasterizer;
+	}
+
+	auto CommandList::SetDepthStencilState(DepthStencilStateHandle state, u32 stencilRef) -> void {
+		if ((cached.unknownState & StateDepthStencil) == 0 && cached.depthStencilState == state && cached.stencilRef == stencilRef) {
+			stats.redundantStateSkips++;
+			return;
+		}
+
+		auto cmd = Push<CmdSetDepthStencilState>(CommandType::SetDepthStencilState);
+		cmd->state = state;
+		cmd->stencilRef = stencilRef;
+
+		cached.depthStencilState = state;
+		cached.stencilRef = stencilRef;
+		cached.pipeline = {};
+		cached.unknownState &= ~StateDepthStencil;
+	}
+
+	auto CommandList::SetTopology(PrimitiveTopology topology) -> void {
+		if (cached.topologySet && cached.topology == topology) {
+			stats.redundantStateSkips++;
+			return;
+		}
+
+		Push<CmdSetTopology>(CommandType::SetTopology)->topology = topology;
+		cached.topology = topology;
+		cached.topologySet = true;
+	}
+
+	auto CommandList::SetVertexBuffer(BufferHandle buffer, u32 stride, u32 offset) -> void {
+		if (cached.vertexBuffer == buffer && cached.vertexStride == stride && cached.vertexOffset == offset) {
+			stats.redundantStateSkips++;
+			return;
+		}
+
+		auto cmd = Push<CmdSetVertexBuffer>(CommandType::SetVertexBuffer);
+		cmd->buffer = buffer;
+		cmd->stride = stride;
+		cmd->offset = offset;
+
+		cached.vertexBuffer = buffer;
+		cached.vertexStride = stride;
+		cached.vertexOffset = offset;
+	}
+
+	auto CommandList::SetIndexBuffer(BufferHandle buffer, IndexFormat format, u32 offset) -> void {
+		// NOTE: format/offset are not cached - index buffers are always bound whole with the mesh's own format
+		if (cached.indexBuffer == buffer && offset == 0) {
+			stats.redundantStateSkips++;
+			return;
+		}
+
+		auto cmd = Push<CmdSetIndexBuffer>(CommandType::SetIndexBuffer);
+		cmd->buffer = buffer;
+		cmd->format = format;
+		cmd->offset = offset;
+
+		cached.indexBuffer = offset == 0 ? buffer : BufferHandle{};
+	}
+
+	auto CommandList::SetTextures(ShaderStage stage, u32 startSlot, std::span<const TextureHandle> textures) -> void {
+		Assert(startSlot + textures.size() <= MaxBindSlots);
+
+		// NOTE: after a texture table the slot contents are unknown until the next table, so nothing can be filtered
+		auto& slots = cached.textures[StageIndex(stage)];
+		bool changed = (cached.unknownState & ResourceStateBit(stage)) != 0;
+		for (u32 i = 0; i < textures.size(); i++)
+			changed |= !(slots[startSlot + i] == textures[i]) || cached.shaderBuffers[StageIndex(stage)][startSlot + i].IsValid();
+
+		if (!changed) {
+			stats.redundantStateSkips++;
+			return;
+		}
+
+		const u32 payloadSize = static_cast<u32>(textures.size_bytes());
+		auto cmd = Push<CmdSetTextures>(CommandType::SetTextures, payloadSize);
+		cmd->stage = stage;
+		cmd->startSlot = static_cast<u8>(startSlot);
+		cmd->count = static_cast<u8>(textures.size());
+		std::memcpy(reinterpret_cast<u8*>(cmd) + sizeof(CmdSetTextures), textures.data(), payloadSize);
+
+		for (u32 i = 0; i < textures.size(); i++) {
+			slots[startSlot + i] = textures[i];
+			cached.shaderBuffers[StageIndex(stage)][startSlot + i] = {};
+		}
+
+		cached.textureTables[StageIndex(stage)] = {};
+	}
+
+	auto CommandList::SetSamplers(ShaderStage stage, u32 startSlot, std::span<const SamplerHandle> samplers) -> void {
+		Assert(startSlot + samplers.size() <= MaxBindSlots);
+
+		auto& slots = cached.samplers[StageIndex(stage)];
+		bool changed = (cached.unknownState & ResourceStateBit(stage)) != 0;
+		for (u32 i = 0; i < samplers.size(); i++)
+			changed |= !(slots[startSlot + i] == samplers[i]);
+
+		if (!changed) {
+			stats.redundantStateSkips++;
+			return;
+		}
+
+		const u32 payloadSize = static_cast<u32>(samplers.size_bytes());
+		auto cmd = Push<CmdSetSamplers>(CommandType::SetSamplers, payloadSize);
+		cmd->stage = stage;
+		cmd->startSlot = static_cast<u8>(startSlot);
+		cmd->count = static_cast<u8>(samplers.size());
+		std::memcpy(reinterpret_cast<u8*>(cmd) + sizeof(CmdSetSamplers), samplers.data(), payloadSize);
+
+		for (u32 i = 0; i < samplers.size(); i++)
+			slots[startSlot + i] = samplers[i];
+
+		cached.textureTables[StageIndex(stage)] = {};
+	}
+
+	auto CommandList::SetTextureTable(ShaderStage stage, TextureTableHandle table) -> void {
+		auto& bound = cached.textureTables[StageIndex(stage)];
+		if (bound == table && table.IsValid()) {
+			stats.redundantStateSkips++;
+			return;
+		}
+
+		auto cmd = Push<CmdSetTextureTable>(CommandType::SetTextureTable);
+		cmd->stage = stage;
+		cmd->table = table;
+
+		bound = table;
+		cached.unknownState |= ResourceStateBit(stage);
+	}
+
+	auto CommandList::SetConstantBuffer(ShaderStage stage, u32 slot, BufferHandle buffer) -> void {
+		Assert(slot < MaxBindSlots);
+
+		auto& bound = cached.constantBuffers[StageIndex(stage)][slot];
+		if (bound == buffer) {
+			stats.redundantStateSkips++;
+			return;
+		}
+
+		auto cmd = Push<CmdSetConstantBuffer>(CommandType::SetConstantBuffer);
+		cmd->stage = stage;
+		cmd->slot = static_cast<u8>(slot);
+		cmd->buffer = buffer;
+
+		bound = buffer;
+	}
+
+	auto CommandList::SetShaderBuffer(ShaderStage stage, u32 slot, BufferHandle buffer) -> void {
+		Assert(slot < MaxBindSlots);
+
+		// NOTE: a texture bind to the same slot replaces the buffer on the context, the cache has to forget it then
+		auto& bound = cached.shaderBuffers[StageIndex(stage)][slot];
+		if ((cached.unknownState & ResourceStateBit(stage)) == 0 && bound == buffer && buffer.IsValid()) {
+			stats.redundantStateSkips++;
+			return;
+		}
+
+		auto cmd = Push<CmdSetShaderBuffer>(CommandType::SetShaderBuffer);
+		cmd->stage = stage;
+		cmd->slot = static_cast<u8>(slot);
+		cmd->buffer = buffer;
+
+		bound = buffer;
+		cached.textures[StageIndex(stage)][slot] = {};
+		cached.textureTables[StageIndex(stage)] = {};
+	}
+
+	auto CommandList::UpdateBuffer(BufferHandle buffer, const void* src, u32 size) -> void {
+		Assert(src != nullptr && size > 0);
+
+		auto cmd = Push<CmdUpdateBuffer>(CommandType::UpdateBuffer, size);
+		cmd->buffer = buffer;
+		cmd->dataSize = size;
+		std::memcpy(reinterpret_cast<u8*>(cmd) + sizeof(CmdUpdateBuffer), src, size);
+	}
+
+	auto CommandList::Draw(u32 vertexCount, u32 startVertex) -> void {
+		auto cmd = Push<CmdDraw>(CommandType::Draw);
+		cmd->vertexCount = vertexCount;
+		cmd->startVertex = startVertex;
+		stats.drawCount++;
+	}
+
+	auto CommandList::DrawIndexed(u32 indexCount, u32 startIndex, i32 baseVertex) -> void {
+		auto cmd = Push<CmdDrawIndexed>(CommandType::DrawIndexed);
+		cmd->indexCount = indexCount;
+		cmd->startIndex = startIndex;
+		cmd->baseVertex = baseVertex;
+		stats.drawCount++;
+	}
+
+	auto CommandList::DrawInstanced(u32 vertexCount, u32 instanceCount, u32 startVertex) -> void {
+		auto cmd = Push<CmdDrawInstanced>(CommandType::DrawInstanced);
+		cmd->vertexCount = vertexCount;
+		cmd->instanceCount = instanceCount;
+		cmd->startVertex = startVertex;
+		stats.drawCount++;
+	}
+}
\ No newline at end of file
@@ -0,0 +1,312 @@
+#pragma once
+
+#include "RendererTypes.h"
+#include "../Threading.h"
+#include <vector>
+#include <span>
+#include <cstring>
+
+namespace Nickel::Renderer {
+	enum class CommandType : u8 {
+		SetRenderTarget,
+		SetViewport,
+		Clear,
+		SetProgram,
+		SetPipeline,
+		SetRasterizerState,
+		SetDepthStencilState,
+		SetTopology,
+		SetVertexBuffer,
+		SetIndexBuffer,
+		SetTextures,
+		SetSamplers,
+		SetTextureTable,
+		SetConstantBuffer,
+		SetShaderBuffer,
+		UpdateBuffer,
+		Draw,
+		DrawIndexed,
+		DrawInstanced,
+
+		Count
+	};
+
+	// NOTE: every command starts with this header, 'size' covers header + payload and is always a multiple of CommandAlignment
+	struct CommandHeader {
+		CommandType type;
+		u8 pad;
+		u16 size;
+	};
+
+	constexpr u32 CommandAlignment = 4;
+	constexpr u32 MaxBindSlots = 16;
+
+	struct CmdSetRenderTarget {
+		CommandHeader header;
+		RenderTargetHandle color;
+		DepthTargetHandle depth;
+	};
+
+	struct CmdSetViewport {
+		CommandHeader header;
+		Viewport viewport;
+	};
+
+	struct CmdClear {
+		CommandHeader header;
+		u32 flags; // ClearFlag
+		f32 color[4];
+		f32 depth;
+		u32 stencil;
+	};
+
+	struct CmdSetProgram {
+		CommandHeader header;
+		ProgramHandle program;
+	};
+
+	struct CmdSetPipeline {
+		CommandHeader header;
+		PipelineHandle pipeline;
+	};
+
+	struct CmdSetRasterizerState {
+		CommandHeader header;
+		RasterizerStateHandle state;
+	};
+
+	struct CmdSetDepthStencilState {
+		CommandHeader header;
+		DepthStencilStateHandle state;
+		u32 stencilRef;
+	};
+
+	struct CmdSetTopology {
+		CommandHeader header;
+		PrimitiveTopology topology;
+	};
+
+	struct CmdSetVertexBuffer {
+		CommandHeader header;
+		BufferHandle buffer;
+		u32 stride;
+		u32 offset;
+	};
+
+	struct CmdSetIndexBuffer {
+		CommandHeader header;
+		BufferHandle buffer;
+		IndexFormat format;
+		u32 offset;
+	};
+
+	// NOTE: followed by 'count' TextureHandles
+	struct CmdSetTextures {
+		CommandHeader header;
+		ShaderStage stage;
+		u8 startSlot;
+		u8 count;
+	};
+
+	// NOTE: followed by 'count' SamplerHandles
+	struct CmdSetSamplers {
+		CommandHeader header;
+		ShaderStage stage;
+		u8 startSlot;
+		u8 count;
+	};
+
+	struct CmdSetTextureTable {
+		CommandHeader header;
+		ShaderStage stage;
+		TextureTableHandle table;
+	};
+
+	struct CmdSetConstantBuffer {
+		CommandHeader header;
+		ShaderStage stage;
+		u8 slot;
+		BufferHandle buffer;
+	};
+
+	// NOTE: structured buffers share the texture slots (t registers) of a stage
+	struct CmdSetShaderBuffer {
+		CommandHeader header;
+		ShaderStage stage;
+		u8 slot;
+		BufferHandle buffer;
+	};
+
+	// NOTE: followed by 'dataSize' bytes that replace the whole buffer contents
+	struct CmdUpdateBuffer {
+		CommandHeader header;
+		BufferHandle buffer;
+		u32 dataSize;
+	};
+
+	struct CmdDraw {
+		CommandHeader header;
+		u32 vertexCount;
+		u32 startVertex;
+	};
+
+	struct CmdDrawIndexed {
+		CommandHeader header;
+		u32 indexCount;
+		u32 startIndex;
+		i32 baseVertex;
+	};
+
+	struct CmdDrawInstanced {
+		CommandHeader header;
+		u32 vertexCount; // NOTE: per instance
+		u32 instanceCount;
+		u32 startVertex;
+	};
+
+	struct CommandListStats {
+		u32 commandCount;
+		u32 drawCount;
+		u32 redundantStateSkips;
+		u64 bytesUsed;
+	};
+
+	// Linear, backend-neutral stream of render commands. A list is recorded by exactly one thread;
+	// record different views/passes/chunks into separate lists and replay them in order.
+	// Recording filters out state that is already set in the same list, so replay never sees redundant binds.
+	class CommandList {
+	public:
+		CommandList() = default;
+		explicit CommandList(u64 initialCapacity) { data.reserve(initialCapacity); }
+
+		auto Reset() -> void; // NOTE: keeps the allocation, so steady-state recording doesn't touch the heap
+
+		auto SetRenderTarget(RenderTargetHandle color, DepthTargetHandle depth) -> void;
+		auto SetViewport(const Viewport& viewport) -> void;
+		auto Clear(u32 clearFlags, const f32 color[4], f32 depth, u8 stencil) -> void;
+		auto SetProgram(ProgramHandle program) -> void;
+		auto SetPipeline(PipelineHandle pipeline) -> void; // NOTE: replaces program, rasterizer and depth stencil state
+		auto SetRasterizerState(RasterizerStateHandle state) -> void;
+		auto SetDepthStencilState(DepthStencilStateHandle state, u32 stencilRef = 1) -> void;
+		auto SetTopology(PrimitiveTopology topology) -> void;
+		auto SetVertexBuffer(BufferHandle buffer, u32 stride, u32 offset = 0) -> void;
+		auto SetIndexBuffer(BufferHandle buffer, IndexFormat format = IndexFormat::U32, u32 offset = 0) -> void;
+		auto SetTextures(ShaderStage stage, u32 startSlot, std::span<const TextureHandle> textures) -> void;
+		auto SetSamplers(ShaderStage stage, u32 startSlot, std::span<const SamplerHandle> samplers) -> void;
+		auto SetTextureTable(ShaderStage stage, TextureTableHandle table) -> void; // NOTE: replaces the table's texture and sampler slots
+		auto SetConstantBuffer(ShaderStage stage, u32 slot, BufferHandle buffer) -> void;
+		auto SetShaderBuffer(ShaderStage stage, u32 slot, BufferHandle buffer) -> void; // NOTE: structured buffer into a texture slot
+		auto UpdateBuffer(BufferHandle buffer, const void* src, u32 size) -> void;
+		auto Draw(u32 vertexCount, u32 startVertex = 0) -> void;
+		auto DrawIndexed(u32 indexCount, u32 startIndex = 0, i32 baseVertex = 0) -> void;
+		auto DrawInstanced(u32 vertexCount, u32 instanceCount, u32 startVertex = 0) -> void; // NOTE: SV_InstanceID counts from 0
+
+		template <typename T>
+		inline auto UpdateBuffer(BufferHandle buffer, const T& value) -> void {
+			UpdateBuffer(buffer, std::addressof(value), sizeof(T));
+		}
+
+		inline auto Data() const -> std::span<const u8> { return { data.data(), data.size() }; }
+		inline auto IsEmpty() const -> bool { return data.empty(); }
+		inline auto GetStats() const -> const CommandListStats& { return stats; }
+
+	private:
+		template <typename CmdT>
+		auto Push(CommandType type, u32 payloadSize = 0) -> CmdT*;
+
+		auto InvalidateCachedState() -> void;
+
+		std::vector<u8> data;
+		CommandListStats stats{};
+
+		// NOTE: shadow of what the replayed context will have bound at this point of the stream
+		struct {
+			RenderTargetHandle color;
+			DepthTargetHandle depth;
+			ProgramHandle program;
+			PipelineHandle pipeline;
+			RasterizerStateHandle rasterizerState;
+			DepthStencilStateHandle depthStencilState;
+			u32 stencilRef;
+			u32 unknownState; // NOTE: StateBit mask of state a pipeline or texture table overwrote with values this list can't see
+			PrimitiveTopology topology;
+			bool topologySet;
+			BufferHandle vertexBuffer;
+			u32 vertexStride, vertexOffset;
+			BufferHandle indexBuffer;
+			BufferHandle constantBuffers[2][MaxBindSlots];
+			BufferHandle shaderBuffers[2][MaxBindSlots];
+			TextureHandle textures[2][MaxBindSlots];
+			SamplerHandle samplers[2][MaxBindSlots];
+			TextureTableHandle textureTables[2];
+		} cached{};
+	};
+
+	// Walks a recorded stream; visitor is called as visitor(const CmdXXX&, [payload span]) for each command type
+	template <typename Visitor>
+	auto ForEachCommand(const CommandList& list, Visitor&& visitor) -> void {
+		const auto stream = list.Data();
+		u64 offset = 0;
+		while (offset < stream.size()) {
+			const u8* at = stream.data() + offset;
+			CommandHeader header;
+			std::memcpy(&header, at, sizeof(header));
+			Assert(header.size >= sizeof(CommandHeader));
+
+			switch (header.type) {
+				case CommandType::SetRenderTarget:      visitor(*reinterpret_cast<const CmdSetRenderTarget*>(at)); break;
+				case CommandType::SetViewport:          visitor(*reinterpret_cast<const CmdSetViewport*>(at)); break;
+				case CommandType::Clear:                visitor(*reinterpret_cast<const CmdClear*>(at)); break;
+				case CommandType::SetProgram:           visitor(*reinterpret_cast<const CmdSetProgram*>(at)); break;
+				case CommandType::SetPipeline:          visitor(*reinterpret_cast<const CmdSetPipeline*>(at)); break;
+				case CommandType::SetRasterizerState:   visitor(*reinterpret_cast<const CmdSetRasterizerState*>(at)); break;
+				case CommandType::SetDepthStencilState: visitor(*reinterpret_cast<const CmdSetDepthStencilState*>(at)); break;
+				case CommandType::SetTopology:          visitor(*reinterpret_cast<const CmdSetTopology*>(at)); break;
+				case CommandType::SetVertexBuffer:      visitor(*reinterpret_cast<const CmdSetVertexBuffer*>(at)); break;
+				case CommandType::SetIndexBuffer:       visitor(*reinterpret_cast<const CmdSetIndexBuffer*>(at)); break;
+				case CommandType::SetTextureTable:      visitor(*reinterpret_cast<const CmdSetTextureTable*>(at)); break;
+				case CommandType::SetConstantBuffer:    visitor(*reinterpret_cast<const CmdSetConstantBuffer*>(at)); break;
+				case CommandType::SetShaderBuffer:      visitor(*reinterpret_cast<const CmdSetShaderBuffer*>(at)); break;
+				case CommandType::Draw:                 visitor(*reinterpret_cast<const CmdDraw*>(at)); break;
+				case CommandType::DrawIndexed:          visitor(*reinterpret_cast<const CmdDrawIndexed*>(at)); break;
+				case CommandType::DrawInstanced:        visitor(*reinterpret_cast<const CmdDrawInstanced*>(at)); break;
+
+				case CommandType::SetTextures: {
+					const auto& cmd = *reinterpret_cast<const CmdSetTextures*>(at);
+					visitor(cmd, std::span{ reinterpret_cast<const TextureHandle*>(at + sizeof(CmdSetTextures)), cmd.count });
+				} break;
+
+				case CommandType::SetSamplers: {
+					const auto& cmd = *reinterpret_cast<const CmdSetSamplers*>(at);
+					visitor(cmd, std::span{ reinterpret_cast<const SamplerHandle*>(at + sizeof(CmdSetSamplers)), cmd.count });
+				} break;
+
+				case CommandType::UpdateBuffer: {
+					const auto& cmd = *reinterpret_cast<const CmdUpdateBuffer*>(at);
+					visitor(cmd, std::span{ at + sizeof(CmdUpdateBuffer), cmd.dataSize });
+				} break;
+
+				default: {
+					Logger::Error("[CommandList]: Unknown command type in stream");
+					Assert(false);
+					return;
+				}
+			}
+
+			offset += header.size;
+		}
+	}
+
+	// Records 'itemCount' items into 'lists' in parallel, list i gets a contiguous range of items so replaying
+	// the lists in order keeps submission order identical to single-threaded recording.
+	// recordFn(CommandList& list, u32 begin, u32 end) is expected to set all state its draws depend on.
+	template <typename RecordFn>
+	auto RecordParallel(std::span<CommandList> lists, u32 itemCount, RecordFn&& recordFn) -> void {
+		for (auto& list : lists)
+			list.Reset();
+
+		ParallelForChunks(itemCount, static_cast<u32>(lists.size()), [&](u32 chunkIdx, u32 begin, u32 end) {
+			recordFn(lists[chunkIdx], begin, end);
+		});
+	}
+}
\ No newline at end of file
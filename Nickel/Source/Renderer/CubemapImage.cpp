@@ -0,0 +1,119 @@
+#include "CubemapImage.h"
+#include "../Threading.h"
+#include <algorithm>
+#include <cmath>
+
+namespace Nickel::Renderer {
+	auto CubemapImage::IsValid() const -> bool {
+		if (size == 0)
+			return false;
+
+		for (const auto& face : faces)
+			if (face.size() != static_cast<u64>(size) * size * 4)
+				return false;
+
+		return true;
+	}
+
+	auto CubeFaceDirection(u32 face, f32 u, f32 v) -> Vec3 {
+		// NOTE: inverse of the D3D face selection, the software backend's SampleCube maps these back to (face, u, v)
+		switch (face) {
+			case 0:  return Vec3{ 1.0f, -v, -u };
+			case 1:  return Vec3{ -1.0f, -v, u };
+			case 2:  return Vec3{ u, 1.0f, v };
+			case 3:  return Vec3{ u, -1.0f, -v };
+			case 4:  return Vec3{ u, -v, 1.0f };
+			default: return Vec3{ -u, -v, -1.0f };
+		}
+	}
+
+	auto SampleCubemap(const CubemapImage& image, const Vec3& direction, f32 (&out)[4]) -> void {
+		const f32 ax = std::abs(direction.x);
+		const f32 ay = std::abs(direction.y);
+		const f32 az = std::abs(direction.z);
+
+		// NOTE: same face selection as SampleCube, the inverse of CubeFaceDirection
+		u32 face;
+		f32 sc, tc, ma;
+		if (ax >= ay && ax >= az) {
+			face = direction.x >= 0.0f ? 0 : 1;
+			sc = direction.x >= 0.0f ? -direction.z : direction.z;
+			tc = -direction.y;
+			ma = ax;
+		} else if (ay >= az) {
+			face = direction.y >= 0.0f ? 2 : 3;
+			sc = direction.x;
+			tc = direction.y >= 0.0f ? direction.z : -direction.z;
+			ma = ay;
+		} else {
+			face = direction.z >= 0.0f ? 4 : 5;
+			sc = direction.z >= 0.0f ? direction.x : -direction.x;
+			tc = -direction.y;
+			ma = az;
+		}
+
+		if (!(ma > 0.0f)) {
+			out[0] = out[1] = out[2] = out[3] = 0.0f;
+			return;
+		}
+
+		const f32 last = static_cast<f32>(image.size - 1);
+		const f32 x = std::clamp((sc / ma + 1.0f) * 0.5f * static_cast<f32>(image.size) - 0.5f, 0.0f, last);
+		const f32 y = std::clamp((tc / ma + 1.0f) * 0.5f * static_cast<f32>(image.size) - 0.5f, 0.0f, last);
+		const u32 x0 = static_cast<u32>(x);
+		const u32 y0 = static_cast<u32>(y);
+		const u32 x1 = std::min(x0 + 1, image.size - 1);
+		const u32 y1 = std::min(y0 + 1, image.size - 1);
+		const f32 fx = x - static_cast<f32>(x0);
+		const f32 fy = y - static_cast<f32>(y0);
+
+		const f32* a = image.Texel(face, x0, y0);
+		const f32* b = image.Texel(face, x1, y0);
+		const f32* c = image.Texel(face, x0, y1);
+		const f32* d = image.Texel(face, x1, y1);
+		for (u32 i = 0; i < 4; i++) {
+			const f32 top = a[i] + (b[i] - a[i]) * fx;
+			const f32 bottom = c[i] + (d[i] - c[i]) * fx;
+			out[i] = top + (bottom - top) * fy;
+		}
+	}
+
+	auto DownsampleCubemap(const CubemapImage& image) -> CubemapImage {
+		Assert(image.IsValid() && image.size > 1);
+
+		CubemapImage result;
+		result.size = image.size / 2;
+		for (auto& face : result.faces)
+			face.resize(static_cast<u64>(result.size) * result.size * 4);
+
+		const u32 rowCount = result.size * CubeFaceCount;
+		ParallelForChunks(rowCount, std::min(GetWorkerCount(), rowCount), [&](u32, u32 begin, u32 end) {
+			for (u32 row = begin; row < end; row++) {
+				const u32 face = row / result.size;
+				const u32 y = row % result.size;
+				f32* out = result.faces[face].data() + static_cast<u64>(y) * result.size * 4;
+				for (u32 x = 0; x < result.size; x++, out += 4) {
+					const f32* a = image.Texel(face, x * 2, y * 2);
+					const f32* b = image.Texel(face, x * 2 + 1, y * 2);
+					const f32* c = image.Texel(face, x * 2, y * 2 + 1);
+					const f32* d = image.Texel(face, x * 2 + 1, y * 2 + 1);
+					for (u32 i = 0; i < 4; i++)
+						out[i] = (a[i] + b[i] + c[i] + d[i]) * 0.25f;
+				}
+			}
+		});
+
+		return result;
+	}
+
+	auto BuildMipChain(const CubemapImage& image, u32 minSize) -> std::vector<CubemapImage> {
+		Assert(image.IsValid());
+
+		std::vector<CubemapImage> chain;
+		chain.push_back(image);
+		while (chain.back().size / 2 >= std::max(minSize, 1u))
+			chain.push_back(DownsampleCubemap(chain.back()));
+
+		return chain;
+	}
+}
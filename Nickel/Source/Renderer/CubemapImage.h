@@ -0,0 +1,30 @@
+#pragma once
+
+#include "RendererTypes.h"
+#include "../Math.h"
+#include <vector>
+
+// Cube maps on the CPU, what the environment lighting tools read and write before anything reaches the GPU.
+// Texels are RGBA32F like the cube maps ResourceManager uploads, faces are in D3D order +X -X +Y -Y +Z -Z.
+namespace Nickel::Renderer {
+	constexpr u32 CubeFaceCount = 6;
+
+	struct CubemapImage {
+		u32 size = 0; // NOTE: faces are square
+		std::vector<f32> faces[CubeFaceCount]; // NOTE: size * size RGBA texels each, rows top to bottom
+
+		auto IsValid() const -> bool;
+		inline auto Texel(u32 face, u32 x, u32 y) const -> const f32* { return faces[face].data() + (static_cast<u64>(y) * size + x) * 4; }
+	};
+
+	// NOTE: face coordinates in [-1, 1], u to the right and v down the face like the texel rows, not normalized
+	auto CubeFaceDirection(u32 face, f32 u, f32 v) -> Vec3;
+
+	// NOTE: bilinear within the face the direction points at, edges clamped like the software backend's SampleCube.
+	// The direction doesn't have to be normalized
+	auto SampleCubemap(const CubemapImage& image, const Vec3& direction, f32 (&out)[4]) -> void;
+	// NOTE: 2x2 box filter, the next mip of every face
+	auto DownsampleCubemap(const CubemapImage& image) -> CubemapImage;
+	// NOTE: the image followed by its box filtered mips down to minSize, what CreateCubeMap uploads as a mip chain
+	auto BuildMipChain(const CubemapImage& image, u32 minSize = 1) -> std::vector<CubemapImage>;
+}
@@ -144,7 +144,7 @@ namespace Nickel::Renderer::DXLayer {
 		return { device, deviceCtx };
 	}
 
-	auto CreateSwapChain(HWND windowHandle, ID3D11Device1* device, int clientWidth, int clientHeight) -> IDXGISwapChain1* {
+	auto CreateSwapChain(HWND windowHandle, ID3D11Device1* device, int clientWidth, int clientHeight, UINT sampleCount) -> IDXGISwapChain1* {
 		DXGI_SWAP_CHAIN_DESC1 swapChainDesc1 = { 0 };
 
 		swapChainDesc1.Stereo = FALSE;
@@ -153,8 +153,8 @@ namespace Nickel::Renderer::DXLayer {
 		swapChainDesc1.Height = clientHeight;
 		swapChainDesc1.Format = DXGI_FORMAT_R8G8B8A8_UNORM;
 		swapChainDesc1.BufferUsage = DXGI_USAGE_RENDER_TARGET_OUTPUT;
-		swapChainDesc1.SampleDesc.Count = 4; // TODO use MSAA_LEVEL;
-		swapChainDesc1.SampleDesc.Quality = GetHighestQualitySampleLevel(device, DXGI_FORMAT_R8G8B8A8_UNORM);
+		swapChainDesc1.SampleDesc.Count = sampleCount;
+		swapChainDesc1.SampleDesc.Quality = 0; // NOTE: see CreateTexture
 		swapChainDesc1.SwapEffect = DXGI_SWAP_EFFECT::DXGI_SWAP_EFFECT_DISCARD; // TODO: DXGI_SWAP_EFFECT::DXGI_SWAP_EFFECT_FLIP_SEQUENTIAL;
 
 		DXGI_SWAP_CHAIN_FULLSCREEN_DESC swapChainFullscreenDesc = { 0 };
@@ -301,8 +301,9 @@ namespace Nickel::Renderer::DXLayer {
 		return rasterizerDesc;
 	}
 
-	auto CreateTexture(ID3D11Device1* device, UINT width, UINT height, DXGI_FORMAT format, UINT bindFlags, UINT mipLevels = 1) -> ID3D11Texture2D* {
+	auto CreateTexture(ID3D11Device1* device, UINT width, UINT height, DXGI_FORMAT format, UINT bindFlags, UINT mipLevels, UINT sampleCount) -> ID3D11Texture2D* {
 		Assert(device != nullptr);
+		Assert(sampleCount == 1 || mipLevels == 1);
 		auto textureDesc = D3D11_TEXTURE2D_DESC{
 			.Width = width,
 			.Height = height,
@@ -316,14 +317,10 @@ namespace Nickel::Renderer::DXLayer {
 			.MiscFlags{}
 		};
 
-		if (mipLevels == 1) {
-			textureDesc.SampleDesc.Count = 4; // TODO: match depth stencil count and quality with swap chain settings
-			textureDesc.SampleDesc.Quality = GetHighestQualitySampleLevel(device, format);
-		}
-		else {
-			textureDesc.SampleDesc.Count = 1;
-			textureDesc.SampleDesc.Quality = 0;
-		}
+		// NOTE: count and quality have to match the swap chain's for targets bound together with it, quality 0 is the
+		// one level every format supporting the count has (highest levels differ between color and depth formats)
+		textureDesc.SampleDesc.Count = sampleCount;
+		textureDesc.SampleDesc.Quality = 0;
 
 		ID3D11Texture2D* texture = nullptr;
 		ASSERT_ERROR_RESULT(device->CreateTexture2D(&textureDesc, nullptr, &texture));
@@ -337,8 +334,8 @@ namespace Nickel::Renderer::DXLayer {
 		return result;
 	}
 
-	auto CreateDepthStencilTexture(ID3D11Device1* device, UINT width, UINT height) -> ID3D11Texture2D* {
-		return CreateTexture(device, width, height, DXGI_FORMAT::DXGI_FORMAT_D24_UNORM_S8_UINT, D3D11_BIND_FLAG::D3D11_BIND_DEPTH_STENCIL, 1);
+	auto CreateDepthStencilTexture(ID3D11Device1* device, UINT width, UINT height, UINT sampleCount) -> ID3D11Texture2D* {
+		return CreateTexture(device, width, height, DXGI_FORMAT::DXGI_FORMAT_D24_UNORM_S8_UINT, D3D11_BIND_FLAG::D3D11_BIND_DEPTH_STENCIL, 1, sampleCount);
 	}
 
 	auto CreateDepthStencilView(ID3D11Device1* device, ID3D11Resource* depthStencilTexture) -> ID3D11DepthStencilView* {
@@ -359,7 +356,7 @@ namespace Nickel::Renderer::DXLayer {
 		return result;
 	}
 
-	auto CreateBuffer(ID3D11Device1* device, D3D11_USAGE usage, UINT bindFlags, UINT byteWidthSize, UINT cpuAccessFlags, UINT miscFlags, D3D11_SUBRESOURCE_DATA* initialData) -> ID3D11Buffer* {
+	auto CreateBuffer(ID3D11Device1* device, D3D11_USAGE usage, UINT bindFlags, UINT byteWidthSize, UINT cpuAccessFlags, UINT miscFlags, D3D11_SUBRESOURCE_DATA* initialData, UINT structureByteStride) -> ID3D11Buffer* {
 		Assert(device != nullptr);
 
 		D3D11_BUFFER_DESC bufferDesc = { 0 };
@@ -368,7 +365,7 @@ namespace Nickel::Renderer::DXLayer {
 		bufferDesc.ByteWidth = byteWidthSize;
 		bufferDesc.CPUAccessFlags = cpuAccessFlags; // D3D11_CPU_ACCESS_FLAG;
 		bufferDesc.MiscFlags = miscFlags;           // D3D11_RESOURCE_MISC_FLAG
-		// bufferDesc.StructureByteStride
+		bufferDesc.StructureByteStride = structureByteStride;
 
 		ID3D11Buffer* newBuffer = nullptr;
 		ASSERT_ERROR_RESULT(device->CreateBuffer(&bufferDesc, initialData, &newBuffer));
@@ -467,86 +464,4 @@ namespace Nickel::Renderer::DXLayer {
 	auto SetRenderTarget(const ID3D11DeviceContext1& cmdQueue, ID3D11RenderTargetView* const* colorTarget, ID3D11DepthStencilView* depthTarget) -> void {
 		NoConst(cmdQueue).OMSetRenderTargets(1, colorTarget, depthTarget);
 	}
-
-	auto GetDefaultSamplerState(ID3D11Device1* device) -> ID3D11SamplerState* {
-		D3D11_SAMPLER_DESC desc;
-		ZeroMemory(&desc, sizeof(D3D11_SAMPLER_DESC));
-
-		D3D11_TEXTURE_ADDRESS_MODE addressMode = D3D11_TEXTURE_ADDRESS_MODE::D3D11_TEXTURE_ADDRESS_WRAP;
-		desc.AddressU = addressMode;
-		desc.AddressV = addressMode;
-		desc.AddressW = addressMode;
-		desc.ComparisonFunc = D3D11_COMPARISON_FUNC::D3D11_COMPARISON_ALWAYS;
-		desc.Filter = D3D11_FILTER::D3D11_FILTER_MIN_MAG_MIP_LINEAR; //D3D11_FILTER::D3D11_FILTER_COMPARISON_MIN_MAG_MIP_POINT;
-		desc.MaxAnisotropy = 0;
-		desc.MaxLOD = FLT_MAX;
-		desc.MinLOD = FLT_MIN;
-		desc.MipLODBias = 0;
-
-		return DXLayer::CreateSamplerState(device, desc);
-	}
-
-	auto CreateCubeMap(ID3D11Device1* device, std::span<const wchar_t*, 6> imgData) -> DXLayer::TextureDX11 {
-		DirectX::TexMetadata meta[6];
-		DirectX::ScratchImage imgsData[6];
-		for (int i = 0; i < 6; i++) {
-			DirectX::LoadFromHDRFile(imgData[i], &meta[i], imgsData[i]);
-		}
-		
-		//TexMetadata m;
-		//ScratchImage image;
-		// auto x = LoadFromHDRFile(szFile, &m, image);
-
-		//const u32 imgWidth = imgData[0].width;
-		//const u32 imgHeight = imgData[0].height;
-		//for (const auto& img : imgData)
-			//Assert(img.width == imgWidth && img.height == imgHeight);
-		
-		auto texDesc = D3D11_TEXTURE2D_DESC{
-			.Width = static_cast<u32>(meta[0].width),
-			.Height = static_cast<u32>(meta[0].height),
-			.MipLevels = 1,
-			.ArraySize = 6,
-			.Format = meta->format,
-			.SampleDesc = DXGI_SAMPLE_DESC{
-				.Count = 1,
-				.Quality = 0,
-			},
-			.Usage = D3D11_USAGE_DEFAULT,
-			.BindFlags = D3D11_BIND_SHADER_RESOURCE,
-			.CPUAccessFlags = 0,
-			.MiscFlags = D3D11_RESOURCE_MISC_TEXTURECUBE
-		};
-
-		D3D11_SUBRESOURCE_DATA pData[6];
-		const auto texelSize = sizeof(imgsData[0].GetPixels()[0]);
-
-		for (int cubeMapFaceIdx = 0; cubeMapFaceIdx < 6; cubeMapFaceIdx++) {
-			pData[cubeMapFaceIdx].pSysMem = imgsData[cubeMapFaceIdx].GetPixels();
-			auto pitch = imgsData[cubeMapFaceIdx].GetImages()[0].rowPitch;
-			pData[cubeMapFaceIdx].SysMemPitch = pitch;
-			pData[cubeMapFaceIdx].SysMemSlicePitch = 0;
-		}
-
-		ID3D11Texture2D* cubeTexture;
-		ASSERT_ERROR_RESULT(device->CreateTexture2D(&texDesc, &pData[0], &cubeTexture));
-
-		auto resourceViewDesc = D3D11_SHADER_RESOURCE_VIEW_DESC{
-			.Format = texDesc.Format,
-			.ViewDimension = D3D11_SRV_DIMENSION_TEXTURECUBE,
-			.TextureCube = D3D11_TEXCUBE_SRV{
-				.MostDetailedMip = 0,
-				.MipLevels = texDesc.MipLevels
-			}
-		};
-
-		ID3D11ShaderResourceView* srv;
-		ASSERT_ERROR_RESULT(device->CreateShaderResourceView(cubeTexture, &resourceViewDesc, &srv));
-
-		return DXLayer::TextureDX11{
-			.resource = cubeTexture,
-			.srv = srv,
-			.samplerState = GetDefaultSamplerState(device)
-		};
-	}
 }
@@ -0,0 +1,189 @@
+#include "DebugDraw.h"
+#include <algorithm>
+#include <bit>
+#include <cmath>
+
+using namespace DirectX;
+
+namespace Nickel::Renderer {
+	namespace {
+		// NOTE: corners of the [-1, 1] cube (z [0, 1] for frustums), bit 0 is x, bit 1 y, bit 2 z
+		constexpr u8 BoxEdges[12][2] = {
+			{ 0, 1 }, { 2, 3 }, { 4, 5 }, { 6, 7 }, // NOTE: along x
+			{ 0, 2 }, { 1, 3 }, { 4, 6 }, { 5, 7 }, // NOTE: along y
+			{ 0, 4 }, { 1, 5 }, { 2, 6 }, { 3, 7 }  // NOTE: along z
+		};
+
+		auto TransformCorners(const XMMATRIX& transform, f32 minZ, Vec3 (&corners)[8]) -> void {
+			for (u32 i = 0; i < 8; i++) {
+				const auto corner = XMVector3TransformCoord(XMVectorSet(i & 1 ? 1.0f : -1.0f, i & 2 ? 1.0f : -1.0f, i & 4 ? 1.0f : minZ, 1.0f), transform);
+				corners[i] = Vec3{ XMVectorGetX(corner), XMVectorGetY(corner), XMVectorGetZ(corner) };
+			}
+		}
+	}
+
+	auto DebugDraw::Create(const PlatformInterface& gfx, ShaderLibrary& shaders, PipelineCache& pipelineCache) -> bool {
+		const auto program = shaders.GetProgram(gfx, "Debug");
+		if (!program.IsValid()) {
+			Logger::Error("[DebugDraw]: no debug program, debug primitives won't be drawn");
+			return false;
+		}
+
+		// NOTE: lines have no facing, and neither mode writes depth so overlapping primitives don't hide each other
+		const auto rasterizer = RasterizerDesc{ .cullMode = CullMode::None };
+		pipelines[(u32)DebugDepth::Test] = pipelineCache.AcquirePipeline(gfx, PipelineStateDesc{
+			.program = program,
+			.rasterizer = rasterizer,
+			.depthStencil = DepthStencilDesc{ .depthWrite = false, .depthFunc = ComparisonFunc::LessEqual }
+		});
+		pipelines[(u32)DebugDepth::Overlay] = pipelineCache.AcquirePipeline(gfx, PipelineStateDesc{
+			.program = program,
+			.rasterizer = rasterizer,
+			.depthStencil = DepthStencilDesc{ .depthTest = false, .depthWrite = false }
+		});
+
+		constantBuffer = gfx.CreateBuffer(BufferDesc{ .type = BufferType::Constant, .size = sizeof(Constants) }, nullptr);
+		return true;
+	}
+
+	auto DebugDraw::Release(const PlatformInterface& gfx, PipelineCache& pipelineCache) -> void {
+		for (auto& pipeline : pipelines) {
+			if (pipeline.IsValid())
+				pipelineCache.Release(gfx, pipeline);
+			pipeline = {};
+		}
+
+		for (auto buffer : { vertexBuffer, constantBuffer })
+			if (buffer.IsValid())
+				gfx.DestroyBuffer(buffer);
+
+		vertexBuffer = constantBuffer = {};
+		vertexCapacity = 0;
+		Clear();
+	}
+
+	auto DebugDraw::Push(DebugDepth depth, const Vec3& from, const Vec3& to, u32 color) -> void {
+		auto& stream = vertices[(u32)depth];
+		stream.push_back(DebugVertex{ { from.x, from.y, from.z }, color });
+		stream.push_back(DebugVertex{ { to.x, to.y, to.z }, color });
+	}
+
+	auto DebugDraw::Line(const Vec3& from, const Vec3& to, u32 color, DebugDepth depth) -> void {
+		Push(depth, from, to, color);
+	}
+
+	auto DebugDraw::Box(const Vec3& min, const Vec3& max, u32 color, DebugDepth depth) -> void {
+		Vec3 corners[8];
+		for (u32 i = 0; i < 8; i++)
+			corners[i] = Vec3{ i & 1 ? max.x : min.x, i & 2 ? max.y : min.y, i & 4 ? max.z : min.z };
+
+		for (const auto& edge : BoxEdges)
+			Push(depth, corners[edge[0]], corners[edge[1]], color);
+	}
+
+	auto DebugDraw::Box(const XMMATRIX& transform, u32 color, DebugDepth depth) -> void {
+		Vec3 corners[8];
+		TransformCorners(transform, -1.0f, corners);
+		for (const auto& edge : BoxEdges)
+			Push(depth, corners[edge[0]], corners[edge[1]], color);
+	}
+
+	auto DebugDraw::Sphere(const Vec3& center, f32 radius, u32 color, u32 segments, DebugDepth depth) -> void {
+		segments = std::max(segments, 3u);
+		const f32 step = 2.0f * 3.14159265f / static_cast<f32>(segments);
+
+		f32 previousSin = 0.0f;
+		f32 previousCos = radius;
+		for (u32 i = 1; i <= segments; i++) {
+			const f32 s = std::sin(step * static_cast<f32>(i)) * radius;
+			const f32 c = std::cos(step * static_cast<f32>(i)) * radius;
+			Push(depth, center + Vec3{ previousCos, previousSin, 0.0f }, center + Vec3{ c, s, 0.0f }, color);
+			Push(depth, center + Vec3{ previousCos, 0.0f, previousSin }, center + Vec3{ c, 0.0f, s }, color);
+			Push(depth, center + Vec3{ 0.0f, previousCos, previousSin }, center + Vec3{ 0.0f, c, s }, color);
+			previousSin = s;
+			previousCos = c;
+		}
+	}
+
+	auto DebugDraw::Frustum(const XMMATRIX& viewProjection, u32 color, DebugDepth depth) -> void {
+		// NOTE: clip space corners back into world space, D3D depth runs from 0 at the near plane to 1 at the far one
+		Vec3 corners[8];
+		TransformCorners(XMMatrixInverse(nullptr, viewProjection), 0.0f, corners);
+		for (const auto& edge : BoxEdges)
+			Push(depth, corners[edge[0]], corners[edge[1]], color);
+	}
+
+	auto DebugDraw::Axes(const Vec3& origin, f32 size, DebugDepth depth) -> void {
+		Push(depth, origin, origin + Vec3{ size, 0.0f, 0.0f }, DebugColor::Red);
+		Push(depth, origin, origin + Vec3{ 0.0f, size, 0.0f }, DebugColor::Green);
+		Push(depth, origin, origin + Vec3{ 0.0f, 0.0f, size }, DebugColor::Blue);
+	}
+
+	auto DebugDraw::Grid(const Vec3& center, f32 halfExtent, u32 cellCount, u32 color, DebugDepth depth) -> void {
+		cellCount = std::max(cellCount, 1u);
+		const f32 cellSize = 2.0f * halfExtent / static_cast<f32>(cellCount);
+		for (u32 i = 0; i <= cellCount; i++) {
+			const f32 offset = -halfExtent + cellSize * static_cast<f32>(i);
+			Push(depth, center + Vec3{ offset, 0.0f, -halfExtent }, center + Vec3{ offset, 0.0f, halfExtent }, color);
+			Push(depth, center + Vec3{ -halfExtent, 0.0f, offset }, center + Vec3{ halfExtent, 0.0f, offset }, color);
+		}
+	}
+
+	auto DebugDraw::Clear() -> void {
+		for (auto& stream : vertices)
+			stream.clear();
+	}
+
+	auto DebugDraw::Upload(const PlatformInterface& gfx, const XMMATRIX& viewProjection) -> void {
+		u32 vertexCount = 0;
+		for (u32 i = 0; i < (u32)DebugDepth::Count; i++) {
+			drawCounts[i] = static_cast<u32>(vertices[i].size());
+			stats.lineCount[i] = drawCounts[i] / 2;
+			vertexCount += drawCounts[i];
+		}
+
+		if (vertexCount == 0 || !constantBuffer.IsValid())
+			return;
+
+		// NOTE: grows by powers of two and never shrinks, like the clustered light lists
+		if (vertexCount > vertexCapacity) {
+			if (vertexBuffer.IsValid())
+				gfx.DestroyBuffer(vertexBuffer);
+
+			vertexCapacity = std::bit_ceil(vertexCount);
+			vertexBuffer = gfx.CreateBuffer(BufferDesc{ .type = BufferType::Vertex, .usage = BufferUsage::Dynamic, .size = vertexCapacity * static_cast<u32>(sizeof(DebugVertex)), .stride = sizeof(DebugVertex) }, nullptr);
+			stats.vertexCapacity = vertexCapacity;
+		}
+
+		// NOTE: the streams go back to back so both modes draw out of the one buffer written here
+		if (vertices[(u32)DebugDepth::Overlay].empty()) {
+			gfx.UpdateBuffer(vertexBuffer, vertices[0].data(), vertexCount * static_cast<u32>(sizeof(DebugVertex)));
+		} else {
+			auto& stream = vertices[(u32)DebugDepth::Test];
+			const auto& overlay = vertices[(u32)DebugDepth::Overlay];
+			stream.insert(stream.end(), overlay.begin(), overlay.end());
+			gfx.UpdateBuffer(vertexBuffer, stream.data(), vertexCount * static_cast<u32>(sizeof(DebugVertex)));
+			stream.resize(drawCounts[(u32)DebugDepth::Test]);
+		}
+
+		UpdateBuffer(gfx, constantBuffer, Constants{ .viewProjectionMatrix = XMMatrixTranspose(viewProjection) });
+	}
+
+	auto DebugDraw::Draw(CommandList& list) const -> void {
+		if (!vertexBuffer.IsValid() || drawCounts[0] + drawCounts[1] == 0)
+			return;
+
+		list.SetTopology(PrimitiveTopology::LineList);
+		list.SetVertexBuffer(vertexBuffer, sizeof(DebugVertex));
+		list.SetConstantBuffer(ShaderStage::Vertex, 0, constantBuffer);
+
+		u32 startVertex = 0;
+		for (u32 i = 0; i < (u32)DebugDepth::Count; i++) {
+			if (drawCounts[i] != 0 && pipelines[i].IsValid()) {
+				list.SetPipeline(pipelines[i]);
+				list.Draw(drawCounts[i], startVertex);
+			}
+			startVertex += drawCounts[i];
+		}
+	}
+}
@@ -0,0 +1,84 @@
+#pragma once
+
+#include "RendererPlatformInterface.h"
+#include "CommandList.h"
+#include "PipelineCache.h"
+#include "ShaderLibrary.h"
+#include "../Math.h"
+#include <DirectXMath.h>
+#include <vector>
+
+// Immediate mode debug drawing. Primitives are expanded into line list vertices on the CPU and appended to one
+// stream per depth mode, Upload writes both streams into a single dynamic vertex buffer and Draw records one draw
+// per mode, so thousands of primitives still cost two draws. Everything is dropped again with Clear.
+namespace Nickel::Renderer {
+	// NOTE: RGBA8 with red in the low byte, what DebugVertexShader.hlsl unpacks
+	constexpr auto PackColor(f32 r, f32 g, f32 b, f32 a = 1.0f) -> u32 {
+		const auto channel = [](f32 value) { return static_cast<u32>((value < 0.0f ? 0.0f : value > 1.0f ? 1.0f : value) * 255.0f + 0.5f); };
+		return channel(r) | (channel(g) << 8) | (channel(b) << 16) | (channel(a) << 24);
+	}
+
+	namespace DebugColor {
+		constexpr u32 White  = PackColor(1.0f, 1.0f, 1.0f);
+		constexpr u32 Gray   = PackColor(0.5f, 0.5f, 0.5f);
+		constexpr u32 Red    = PackColor(1.0f, 0.0f, 0.0f);
+		constexpr u32 Green  = PackColor(0.0f, 1.0f, 0.0f);
+		constexpr u32 Blue   = PackColor(0.0f, 0.0f, 1.0f);
+		constexpr u32 Yellow = PackColor(1.0f, 1.0f, 0.0f);
+		constexpr u32 Cyan   = PackColor(0.0f, 1.0f, 1.0f);
+	}
+
+	enum class DebugDepth : u8 {
+		Test,    // NOTE: hidden behind scene geometry, doesn't write depth
+		Overlay, // NOTE: always on top
+		Count
+	};
+
+	struct DebugVertex {
+		f32 position[3];
+		u32 color;
+	};
+	static_assert(sizeof(DebugVertex) == 16, "has to match VertexData in DebugVertexShader.hlsl");
+
+	struct DebugDrawStats {
+		u32 lineCount[(u32)DebugDepth::Count]; // NOTE: of the last Upload
+		u32 vertexCapacity;
+	};
+
+	class DebugDraw {
+	public:
+		auto Create(const PlatformInterface& gfx, ShaderLibrary& shaders, PipelineCache& pipelineCache) -> bool;
+		auto Release(const PlatformInterface& gfx, PipelineCache& pipelineCache) -> void;
+
+		// NOTE: not thread safe, primitives are gathered on one thread before recording starts
+		auto Line(const Vec3& from, const Vec3& to, u32 color, DebugDepth depth = DebugDepth::Test) -> void;
+		auto Box(const Vec3& min, const Vec3& max, u32 color, DebugDepth depth = DebugDepth::Test) -> void;
+		auto Box(const DirectX::XMMATRIX& transform, u32 color, DebugDepth depth = DebugDepth::Test) -> void; // NOTE: the [-1, 1] cube transformed
+		auto Sphere(const Vec3& center, f32 radius, u32 color, u32 segments = 24, DebugDepth depth = DebugDepth::Test) -> void; // NOTE: three great circles
+		auto Frustum(const DirectX::XMMATRIX& viewProjection, u32 color, DebugDepth depth = DebugDepth::Test) -> void;
+		auto Axes(const Vec3& origin, f32 size, DebugDepth depth = DebugDepth::Test) -> void; // NOTE: x red, y green, z blue
+		auto Grid(const Vec3& center, f32 halfExtent, u32 cellCount, u32 color, DebugDepth depth = DebugDepth::Test) -> void; // NOTE: on the xz plane
+
+		auto Clear() -> void; // NOTE: once per frame, any time after Upload, the draws only read the GPU copy
+		auto Upload(const PlatformInterface& gfx, const DirectX::XMMATRIX& viewProjection) -> void; // NOTE: creates or grows the buffer, once per frame before recording
+		auto Draw(CommandList& list) const -> void; // NOTE: into the bound targets, read-only so any recording worker can call it
+
+		inline auto GetStats() const -> const DebugDrawStats& { return stats; }
+
+	private:
+		auto Push(DebugDepth depth, const Vec3& from, const Vec3& to, u32 color) -> void;
+
+		struct Constants {
+			DirectX::XMMATRIX viewProjectionMatrix;
+		};
+
+		std::vector<DebugVertex> vertices[(u32)DebugDepth::Count];
+
+		PipelineHandle pipelines[(u32)DebugDepth::Count];
+		BufferHandle vertexBuffer;
+		BufferHandle constantBuffer;
+		u32 vertexCapacity = 0;
+		u32 drawCounts[(u32)DebugDepth::Count]{}; // NOTE: vertices per mode in the uploaded buffer, Test first
+		DebugDrawStats stats{};
+	};
+}
@@ -0,0 +1,205 @@
+#include "D3D11CommandReplay.h"
+#include "../../ShaderProgram.h"
+
+namespace Nickel::Renderer::DXLayer {
+	auto ToD3DTopology(PrimitiveTopology topology) -> D3D11_PRIMITIVE_TOPOLOGY {
+		switch (topology) {
+			case PrimitiveTopology::TriangleList:  return D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST;
+			case PrimitiveTopology::TriangleStrip: return D3D11_PRIMITIVE_TOPOLOGY_TRIANGLESTRIP;
+			case PrimitiveTopology::LineList:      return D3D11_PRIMITIVE_TOPOLOGY_LINELIST;
+			case PrimitiveTopology::LineStrip:     return D3D11_PRIMITIVE_TOPOLOGY_LINESTRIP;
+			case PrimitiveTopology::PointList:     return D3D11_PRIMITIVE_TOPOLOGY_POINTLIST;
+		}
+
+		Assert(false);
+		return D3D11_PRIMITIVE_TOPOLOGY_UNDEFINED;
+	}
+
+	auto FromD3DTopology(D3D11_PRIMITIVE_TOPOLOGY topology) -> PrimitiveTopology {
+		switch (topology) {
+			case D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST:  return PrimitiveTopology::TriangleList;
+			case D3D11_PRIMITIVE_TOPOLOGY_TRIANGLESTRIP: return PrimitiveTopology::TriangleStrip;
+			case D3D11_PRIMITIVE_TOPOLOGY_LINELIST:      return PrimitiveTopology::LineList;
+			case D3D11_PRIMITIVE_TOPOLOGY_LINESTRIP:     return PrimitiveTopology::LineStrip;
+			case D3D11_PRIMITIVE_TOPOLOGY_POINTLIST:     return PrimitiveTopology::PointList;
+			default: {
+				Logger::Error("[CommandList]: Unsupported D3D11 primitive topology");
+				Assert(false);
+			}
+		}
+
+		return PrimitiveTopology::TriangleList;
+	}
+
+	namespace {
+		struct Replayer {
+			ID3D11DeviceContext1* ctx;
+			const ResourceTable& table;
+
+			auto operator()(const CmdSetRenderTarget& cmd) -> void {
+				ID3D11RenderTargetView* renderTarget = table.Get(cmd.color);
+				ctx->OMSetRenderTargets(renderTarget != nullptr ? 1 : 0, &renderTarget, table.Get(cmd.depth));
+			}
+
+			auto operator()(const CmdSetViewport& cmd) -> void {
+				const auto& v = cmd.viewport;
+				const auto viewport = D3D11_VIEWPORT{ .TopLeftX = v.x, .TopLeftY = v.y, .Width = v.width, .Height = v.height, .MinDepth = v.minDepth, .MaxDepth = v.maxDepth };
+				ctx->RSSetViewports(1, &viewport);
+			}
+
+			auto operator()(const CmdClear& cmd) -> void {
+				ID3D11RenderTargetView* renderTarget = nullptr;
+				ID3D11DepthStencilView* depthTarget = nullptr;
+				ctx->OMGetRenderTargets(1, &renderTarget, &depthTarget);
+
+				Clear(CmdQueue{ .queue = ctx }, cmd.flags, renderTarget, depthTarget, cmd.color, cmd.depth, static_cast<UINT8>(cmd.stencil));
+
+				SafeRelease(renderTarget); // NOTE: OMGetRenderTargets adds references
+				SafeRelease(depthTarget);
+			}
+
+			auto operator()(const CmdSetProgram& cmd) -> void {
+				auto program = table.Get(cmd.program);
+				Assert(program != nullptr);
+				program->Bind(ctx);
+			}
+
+			auto operator()(const CmdSetPipeline& cmd) -> void {
+				auto pipeline = table.Get(cmd.pipeline);
+				Assert(pipeline != nullptr);
+
+				auto program = table.Get(pipeline->program);
+				Assert(program != nullptr);
+				program->Bind(ctx);
+
+				ctx->RSSetState(pipeline->rasterizerState.Get());
+				ctx->OMSetDepthStencilState(pipeline->depthStencilState.Get(), pipeline->stencilRef);
+			}
+
+			auto operator()(const CmdSetRasterizerState& cmd) -> void {
+				ctx->RSSetState(table.Get(cmd.state));
+			}
+
+			auto operator()(const CmdSetDepthStencilState& cmd) -> void {
+				ctx->OMSetDepthStencilState(table.Get(cmd.state), cmd.stencilRef);
+			}
+
+			auto operator()(const CmdSetTopology& cmd) -> void {
+				ctx->IASetPrimitiveTopology(ToD3DTopology(cmd.topology));
+			}
+
+			auto operator()(const CmdSetVertexBuffer& cmd) -> void {
+				SetVertexBuffer(*ctx, table.Get(cmd.buffer), cmd.stride, cmd.offset);
+			}
+
+			auto operator()(const CmdSetIndexBuffer& cmd) -> void {
+				const auto format = cmd.format == IndexFormat::U16 ? DXGI_FORMAT_R16_UINT : DXGI_FORMAT_R32_UINT;
+				SetIndexBuffer(*ctx, table.Get(cmd.buffer), format, cmd.offset);
+			}
+
+			auto operator()(const CmdSetTextures& cmd, std::span<const TextureHandle> textures) -> void {
+				ID3D11ShaderResourceView* srvs[MaxBindSlots];
+				for (u32 i = 0; i < textures.size(); i++)
+					srvs[i] = table.Get(textures[i]);
+
+				if (cmd.stage == ShaderStage::Vertex)
+					ctx->VSSetShaderResources(cmd.startSlot, cmd.count, srvs);
+				else
+					ctx->PSSetShaderResources(cmd.startSlot, cmd.count, srvs);
+			}
+
+			auto operator()(const CmdSetSamplers& cmd, std::span<const SamplerHandle> samplers) -> void {
+				ID3D11SamplerState* states[MaxBindSlots];
+				for (u32 i = 0; i < samplers.size(); i++)
+					states[i] = table.Get(samplers[i]);
+
+				if (cmd.stage == ShaderStage::Vertex)
+					ctx->VSSetSamplers(cmd.startSlot, cmd.count, states);
+				else
+					ctx->PSSetSamplers(cmd.startSlot, cmd.count, states);
+			}
+
+			auto operator()(const CmdSetTextureTable& cmd) -> void {
+				auto textureTable = table.Get(cmd.table);
+				Assert(textureTable != nullptr);
+
+				if (cmd.stage == ShaderStage::Vertex) {
+					ctx->VSSetShaderResources(0, textureTable->textureCount, textureTable->srvs);
+					ctx->VSSetSamplers(0, textureTable->samplerCount, textureTable->samplers);
+				} else {
+					ctx->PSSetShaderResources(0, textureTable->textureCount, textureTable->srvs);
+					ctx->PSSetSamplers(0, textureTable->samplerCount, textureTable->samplers);
+				}
+			}
+
+			auto operator()(const CmdSetConstantBuffer& cmd) -> void {
+				Assert(cmd.slot < D3D11_COMMONSHADER_CONSTANT_BUFFER_HW_SLOT_COUNT);
+				ID3D11Buffer* buffer = table.Get(cmd.buffer);
+
+				if (cmd.stage == ShaderStage::Vertex)
+					ctx->VSSetConstantBuffers(cmd.slot, 1, &buffer);
+				else
+					ctx->PSSetConstantBuffers(cmd.slot, 1, &buffer);
+			}
+
+			auto operator()(const CmdSetShaderBuffer& cmd) -> void {
+				ID3D11ShaderResourceView* srv = table.GetView(cmd.buffer);
+
+				if (cmd.stage == ShaderStage::Vertex)
+					ctx->VSSetShaderResources(cmd.slot, 1, &srv);
+				else
+					ctx->PSSetShaderResources(cmd.slot, 1, &srv);
+			}
+
+			auto operator()(const CmdUpdateBuffer& cmd, std::span<const u8> bytes) -> void {
+				ctx->UpdateSubresource1(table.Get(cmd.buffer), 0, nullptr, bytes.data(), 0, 0, 0);
+			}
+
+			auto operator()(const CmdDraw& cmd) -> void {
+				ctx->Draw(cmd.vertexCount, cmd.startVertex);
+			}
+
+			auto operator()(const CmdDrawIndexed& cmd) -> void {
+				ctx->DrawIndexed(cmd.indexCount, cmd.startIndex, cmd.baseVertex);
+			}
+
+			auto operator()(const CmdDrawInstanced& cmd) -> void {
+				ctx->DrawInstanced(cmd.vertexCount, cmd.instanceCount, cmd.startVertex, 0);
+			}
+		};
+	}
+
+	auto ReplayCommandList(ID3D11DeviceContext1* ctx, const ResourceTable& table, const CommandList& list) -> void {
+		Assert(ctx != nullptr);
+		ForEachCommand(list, Replayer{ .ctx = ctx, .table = table });
+	}
+
+	auto ExecuteCommandListsDeferred(ID3D11Device1* device, ID3D11DeviceContext1* immediateCtx, const ResourceTable& table, std::span<const CommandList> lists, DeferredContextPool& pool) -> void {
+		Assert(device != nullptr);
+		Assert(immediateCtx != nullptr);
+
+		while (pool.contexts.size() < lists.size()) {
+			ComPtr<ID3D11DeviceContext1> deferredCtx;
+			ASSERT_ERROR_RESULT(device->CreateDeferredContext1(0, deferredCtx.GetAddressOf()));
+			pool.contexts.push_back(deferredCtx);
+		}
+
+		auto recorded = std::vector<ID3D11CommandList*>(lists.size(), nullptr);
+		ParallelFor(static_cast<u32>(lists.size()), [&](u32 i) {
+			if (lists[i].IsEmpty())
+				return;
+
+			auto deferredCtx = pool.contexts[i].Get();
+			ReplayCommandList(deferredCtx, table, lists[i]);
+			ASSERT_ERROR_RESULT(deferredCtx->FinishCommandList(FALSE, &recorded[i]));
+		});
+
+		for (auto& commandList : recorded) {
+			if (commandList == nullptr)
+				continue;
+
+			immediateCtx->ExecuteCommandList(commandList, TRUE);
+			SafeRelease(commandList);
+		}
+	}
+}
\ No newline at end of file
@@ -0,0 +1,20 @@
+#pragma once
+
+#include "../CommandList.h"
+#include "D3D11ResourceTable.h"
+
+namespace Nickel::Renderer::DXLayer {
+	struct DeferredContextPool {
+		std::vector<ComPtr<ID3D11DeviceContext1>> contexts;
+	};
+
+	auto ToD3DTopology(PrimitiveTopology topology) -> D3D11_PRIMITIVE_TOPOLOGY;
+	auto FromD3DTopology(D3D11_PRIMITIVE_TOPOLOGY topology) -> PrimitiveTopology;
+
+	// Translates a recorded stream into calls on 'ctx' (immediate or deferred context)
+	auto ReplayCommandList(ID3D11DeviceContext1* ctx, const ResourceTable& table, const CommandList& list) -> void;
+
+	// Replays every list on its own deferred context in parallel, then executes the resulting
+	// ID3D11CommandLists on the immediate context in list order. Immediate context state is preserved.
+	auto ExecuteCommandListsDeferred(ID3D11Device1* device, ID3D11DeviceContext1* immediateCtx, const ResourceTable& table, std::span<const CommandList> lists, DeferredContextPool& pool) -> void;
+}
\ No newline at end of file
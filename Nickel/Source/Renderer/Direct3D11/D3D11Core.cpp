@@ -1,16 +1,420 @@
 #include "D3D11Core.h"
+#include "D3D11CommandReplay.h"
 
 namespace Nickel::Renderer::DXLayer::Core {
-namespace {
-	
-}
+	namespace {
+		struct CoreState {
+			ComPtr<ID3D11Device1> device;
+			ComPtr<ID3D11DeviceContext1> context;
+			ComPtr<ID3D11Debug> debug;
+			ComPtr<IDXGISwapChain1> swapChain;
 
-auto Init() -> bool {
-	// TODO: get adapter, check max feature level, create ID3D11Device etc
-	return true;
-}
+			ResourceTable resources;
+			RenderTargetHandle backbuffer;
 
-auto Shutdown() -> void {
+			DeferredContextPool deferredContexts;
+			bool useDeferredContexts = false;
+		};
 
-}
+		CoreState core;
+
+		auto ToDXGIFormat(TextureFormat format) -> DXGI_FORMAT {
+			switch (format) {
+				case TextureFormat::RGBA8_UNORM:  return DXGI_FORMAT_R8G8B8A8_UNORM;
+				case TextureFormat::RGBA16_FLOAT: return DXGI_FORMAT_R16G16B16A16_FLOAT;
+				case TextureFormat::RGBA32_FLOAT: return DXGI_FORMAT_R32G32B32A32_FLOAT;
+				case TextureFormat::RG16_FLOAT:   return DXGI_FORMAT_R16G16_FLOAT;
+				case TextureFormat::R32_FLOAT:    return DXGI_FORMAT_R32_FLOAT;
+				case TextureFormat::BC1_UNORM:    return DXGI_FORMAT_BC1_UNORM;
+				case TextureFormat::BC5_UNORM:    return DXGI_FORMAT_BC5_UNORM;
+				case TextureFormat::BC7_UNORM:    return DXGI_FORMAT_BC7_UNORM;
+			}
+
+			Assert(false);
+			return DXGI_FORMAT_UNKNOWN;
+		}
+
+		auto ToD3DBindFlag(BufferType type) -> UINT {
+			switch (type) {
+				case BufferType::Vertex:     return D3D11_BIND_VERTEX_BUFFER;
+				case BufferType::Index:      return D3D11_BIND_INDEX_BUFFER;
+				case BufferType::Constant:   return D3D11_BIND_CONSTANT_BUFFER;
+				case BufferType::Structured: return D3D11_BIND_SHADER_RESOURCE;
+			}
+
+			Assert(false);
+			return 0;
+		}
+
+		auto ToD3DFilter(TextureFilter filter) -> D3D11_FILTER {
+			switch (filter) {
+				case TextureFilter::Point:       return D3D11_FILTER_MIN_MAG_MIP_POINT;
+				case TextureFilter::Linear:      return D3D11_FILTER_MIN_MAG_MIP_LINEAR;
+				case TextureFilter::Anisotropic: return D3D11_FILTER_ANISOTROPIC;
+			}
+
+			Assert(false);
+			return D3D11_FILTER_MIN_MAG_MIP_LINEAR;
+		}
+
+		auto ToD3DAddressMode(TextureAddressMode mode) -> D3D11_TEXTURE_ADDRESS_MODE {
+			switch (mode) {
+				case TextureAddressMode::Wrap:   return D3D11_TEXTURE_ADDRESS_WRAP;
+				case TextureAddressMode::Clamp:  return D3D11_TEXTURE_ADDRESS_CLAMP;
+				case TextureAddressMode::Mirror: return D3D11_TEXTURE_ADDRESS_MIRROR;
+			}
+
+			Assert(false);
+			return D3D11_TEXTURE_ADDRESS_WRAP;
+		}
+
+		auto ToD3DCullMode(CullMode mode) -> D3D11_CULL_MODE {
+			switch (mode) {
+				case CullMode::None:  return D3D11_CULL_NONE;
+				case CullMode::Front: return D3D11_CULL_FRONT;
+				case CullMode::Back:  return D3D11_CULL_BACK;
+			}
+
+			Assert(false);
+			return D3D11_CULL_BACK;
+		}
+
+		auto ToD3DComparisonFunc(ComparisonFunc func) -> D3D11_COMPARISON_FUNC {
+			switch (func) {
+				case ComparisonFunc::Never:        return D3D11_COMPARISON_NEVER;
+				case ComparisonFunc::Less:         return D3D11_COMPARISON_LESS;
+				case ComparisonFunc::Equal:        return D3D11_COMPARISON_EQUAL;
+				case ComparisonFunc::LessEqual:    return D3D11_COMPARISON_LESS_EQUAL;
+				case ComparisonFunc::Greater:      return D3D11_COMPARISON_GREATER;
+				case ComparisonFunc::NotEqual:     return D3D11_COMPARISON_NOT_EQUAL;
+				case ComparisonFunc::GreaterEqual: return D3D11_COMPARISON_GREATER_EQUAL;
+				case ComparisonFunc::Always:       return D3D11_COMPARISON_ALWAYS;
+			}
+
+			Assert(false);
+			return D3D11_COMPARISON_LESS;
+		}
+	}
+
+	auto Init(const PlatformInitDesc& desc) -> bool {
+		Assert(desc.windowHandle != nullptr);
+
+		auto [baseDevice, baseDeviceCtx] = CreateDevice();
+		if (baseDevice == nullptr)
+			return false;
+
+		ASSERT_ERROR_RESULT(baseDevice->QueryInterface(core.device.GetAddressOf()));
+		core.device->GetImmediateContext1(core.context.GetAddressOf());
+		SafeRelease(baseDeviceCtx);
+		SafeRelease(baseDevice);
+
+		if constexpr (_DEBUG) {
+			core.debug.Attach(EnableDebug(*core.device.Get(), false));
+			ASSERT_ERROR_RESULT(core.debug->ReportLiveDeviceObjects(D3D11_RLDO_FLAGS::D3D11_RLDO_SUMMARY | D3D11_RLDO_FLAGS::D3D11_RLDO_DETAIL));
+		}
+
+		core.swapChain.Attach(CreateSwapChain(static_cast<HWND>(desc.windowHandle), core.device.Get(), desc.width, desc.height, desc.sampleCount));
+
+		// back buffer for swap chain
+		ComPtr<ID3D11Texture2D> backBufferTexture;
+		ASSERT_ERROR_RESULT(core.swapChain->GetBuffer(0, __uuidof(ID3D11Texture2D), reinterpret_cast<void**>(backBufferTexture.GetAddressOf())));
+
+		ComPtr<ID3D11RenderTargetView> renderTargetView;
+		ASSERT_ERROR_RESULT(core.device->CreateRenderTargetView(backBufferTexture.Get(), nullptr, renderTargetView.GetAddressOf()));
+		core.backbuffer = core.resources.renderTargets.Allocate(renderTargetView);
+
+		core.useDeferredContexts = desc.parallelSubmission;
+
+		return true;
+	}
+
+	auto Shutdown() -> void {
+		if (core.context != nullptr)
+			core.context->ClearState();
+
+		core.resources.programs.ForEachAlive([](ProgramHandle, ShaderProgram& program) {
+			program.Release();
+		});
+
+		core = CoreState{};
+	}
+
+	auto CreateBuffer(const BufferDesc& desc, const void* initialData) -> BufferHandle {
+		Assert(desc.size > 0);
+
+		const bool dynamic = desc.usage == BufferUsage::Dynamic;
+		const auto usage = dynamic ? D3D11_USAGE_DYNAMIC : D3D11_USAGE_DEFAULT;
+		const UINT cpuAccessFlags = dynamic ? D3D11_CPU_ACCESS_WRITE : 0;
+
+		const bool structured = desc.type == BufferType::Structured;
+		Assert(!structured || (desc.stride > 0 && desc.size % desc.stride == 0));
+		const UINT miscFlags = structured ? D3D11_RESOURCE_MISC_BUFFER_STRUCTURED : 0;
+
+		auto data = D3D11_SUBRESOURCE_DATA{ .pSysMem = initialData };
+		ComPtr<ID3D11Buffer> buffer;
+		buffer.Attach(DXLayer::CreateBuffer(core.device.Get(), usage, ToD3DBindFlag(desc.type), desc.size, cpuAccessFlags, miscFlags, initialData != nullptr ? &data : nullptr, structured ? desc.stride : 0));
+
+		// NOTE: structured buffers are only ever read through a view over every element
+		ComPtr<ID3D11ShaderResourceView> srv;
+		if (structured) {
+			const auto srvDesc = D3D11_SHADER_RESOURCE_VIEW_DESC{
+				.Format = DXGI_FORMAT_UNKNOWN,
+				.ViewDimension = D3D11_SRV_DIMENSION_BUFFER,
+				.Buffer = D3D11_BUFFER_SRV{ .FirstElement = 0, .NumElements = desc.size / desc.stride }
+			};
+			ASSERT_ERROR_RESULT(core.device->CreateShaderResourceView(buffer.Get(), &srvDesc, srv.GetAddressOf()));
+		}
+
+		return core.resources.buffers.Allocate(BufferD3D11{ .buffer = buffer, .srv = srv, .desc = desc });
+	}
+
+	auto UpdateBuffer(BufferHandle handle, const void* data, u32 size) -> void {
+		auto buffer = core.resources.buffers.Get(handle);
+		Assert(buffer != nullptr);
+		Assert(size <= buffer->desc.size);
+
+		if (buffer->desc.usage == BufferUsage::Dynamic) {
+			D3D11_MAPPED_SUBRESOURCE mapped;
+			ASSERT_ERROR_RESULT(core.context->Map(buffer->buffer.Get(), 0, D3D11_MAP_WRITE_DISCARD, 0, &mapped));
+			std::memcpy(mapped.pData, data, size);
+			core.context->Unmap(buffer->buffer.Get(), 0);
+			return;
+		}
+
+		// NOTE: constant buffers can only be updated as a whole
+		if (buffer->desc.type == BufferType::Constant || size == buffer->desc.size) {
+			core.context->UpdateSubresource1(buffer->buffer.Get(), 0, nullptr, data, 0, 0, 0);
+		} else {
+			const auto box = D3D11_BOX{ .left = 0, .top = 0, .front = 0, .right = size, .bottom = 1, .back = 1 };
+			core.context->UpdateSubresource1(buffer->buffer.Get(), 0, &box, data, 0, 0, 0);
+		}
+	}
+
+	auto DestroyBuffer(BufferHandle buffer) -> void {
+		const bool freed = core.resources.buffers.Free(buffer);
+		Assert(freed);
+	}
+
+	auto CreateTexture(const TextureDesc& desc, std::span<const SubresourceData> initialData) -> TextureHandle {
+		const bool isCube = desc.type == TextureType::TextureCube;
+		Assert(!isCube || desc.arraySize == 6);
+		Assert(initialData.empty() || initialData.size() == desc.mipLevels * desc.arraySize);
+
+		const auto format = ToDXGIFormat(desc.format);
+		auto texDesc = D3D11_TEXTURE2D_DESC{
+			.Width = desc.width,
+			.Height = desc.height,
+			.MipLevels = desc.mipLevels,
+			.ArraySize = desc.arraySize,
+			.Format = format,
+			.SampleDesc = DXGI_SAMPLE_DESC{
+				.Count = 1,
+				.Quality = 0,
+			},
+			.Usage = D3D11_USAGE_DEFAULT,
+			.BindFlags = D3D11_BIND_SHADER_RESOURCE,
+			.CPUAccessFlags = 0,
+			.MiscFlags = isCube ? static_cast<UINT>(D3D11_RESOURCE_MISC_TEXTURECUBE) : 0u
+		};
+
+		auto subresources = std::vector<D3D11_SUBRESOURCE_DATA>(initialData.size());
+		for (u64 i = 0; i < initialData.size(); i++)
+			subresources[i] = D3D11_SUBRESOURCE_DATA{ .pSysMem = initialData[i].data, .SysMemPitch = initialData[i].rowPitch, .SysMemSlicePitch = 0 };
+
+		ComPtr<ID3D11Texture2D> texture;
+		ASSERT_ERROR_RESULT(core.device->CreateTexture2D(&texDesc, subresources.empty() ? nullptr : subresources.data(), texture.GetAddressOf()));
+
+		auto srvDesc = D3D11_SHADER_RESOURCE_VIEW_DESC{ .Format = format };
+		if (isCube) {
+			srvDesc.ViewDimension = D3D11_SRV_DIMENSION_TEXTURECUBE;
+			srvDesc.TextureCube = D3D11_TEXCUBE_SRV{ .MostDetailedMip = 0, .MipLevels = desc.mipLevels };
+		} else {
+			srvDesc.ViewDimension = D3D11_SRV_DIMENSION_TEXTURE2D;
+			srvDesc.Texture2D = D3D11_TEX2D_SRV{ .MostDetailedMip = 0, .MipLevels = desc.mipLevels };
+		}
+
+		ComPtr<ID3D11ShaderResourceView> srv;
+		ASSERT_ERROR_RESULT(core.device->CreateShaderResourceView(texture.Get(), &srvDesc, srv.GetAddressOf()));
+
+		return core.resources.textures.Allocate(TextureD3D11{ .resource = texture, .srv = srv, .desc = desc });
+	}
+
+	auto DestroyTexture(TextureHandle texture) -> void {
+		const bool freed = core.resources.textures.Free(texture);
+		Assert(freed);
+	}
+
+	auto CreateSampler(const SamplerDesc& desc) -> SamplerHandle {
+		D3D11_SAMPLER_DESC samplerDesc;
+		ZeroMemory(&samplerDesc, sizeof(D3D11_SAMPLER_DESC));
+
+		const auto addressMode = ToD3DAddressMode(desc.addressMode);
+		samplerDesc.AddressU = addressMode;
+		samplerDesc.AddressV = addressMode;
+		samplerDesc.AddressW = addressMode;
+		samplerDesc.ComparisonFunc = D3D11_COMPARISON_FUNC::D3D11_COMPARISON_ALWAYS;
+		samplerDesc.Filter = ToD3DFilter(desc.filter);
+		samplerDesc.MaxAnisotropy = desc.maxAnisotropy;
+		samplerDesc.MaxLOD = FLT_MAX;
+		samplerDesc.MinLOD = FLT_MIN;
+		samplerDesc.MipLODBias = 0;
+
+		ComPtr<ID3D11SamplerState> sampler;
+		sampler.Attach(CreateSamplerState(core.device.Get(), samplerDesc));
+
+		return core.resources.samplers.Allocate(sampler);
+	}
+
+	auto DestroySampler(SamplerHandle sampler) -> void {
+		const bool freed = core.resources.samplers.Free(sampler);
+		Assert(freed);
+	}
+
+	auto CreateTextureTable(const TextureTableDesc& desc) -> TextureTableHandle {
+		Assert(desc.textures.size() <= MaxBindSlots && desc.samplers.size() <= MaxBindSlots);
+
+		TextureTableD3D11 table{};
+		table.textureCount = static_cast<u32>(desc.textures.size());
+		table.samplerCount = static_cast<u32>(desc.samplers.size());
+
+		for (u32 i = 0; i < table.textureCount; i++) {
+			table.views[i] = core.resources.Get(desc.textures[i]);
+			table.srvs[i] = table.views[i].Get();
+		}
+
+		for (u32 i = 0; i < table.samplerCount; i++) {
+			table.samplerStates[i] = core.resources.Get(desc.samplers[i]);
+			table.samplers[i] = table.samplerStates[i].Get();
+		}
+
+		return core.resources.textureTables.Allocate(std::move(table));
+	}
+
+	auto DestroyTextureTable(TextureTableHandle table) -> void {
+		const bool freed = core.resources.textureTables.Free(table);
+		Assert(freed);
+	}
+
+	auto CreateRasterizerState(const RasterizerDesc& desc) -> RasterizerStateHandle {
+		auto rasterizerDesc = GetDefaultRasterizerDescription();
+		rasterizerDesc.CullMode = ToD3DCullMode(desc.cullMode);
+		rasterizerDesc.FillMode = desc.fillMode == FillMode::Wireframe ? D3D11_FILL_WIREFRAME : D3D11_FILL_SOLID;
+		rasterizerDesc.FrontCounterClockwise = desc.frontCounterClockwise ? TRUE : FALSE;
+		rasterizerDesc.DepthClipEnable = desc.depthClip ? TRUE : FALSE;
+
+		ComPtr<ID3D11RasterizerState> state;
+		state.Attach(DXLayer::CreateRasterizerState(core.device.Get(), rasterizerDesc));
+
+		return core.resources.rasterizerStates.Allocate(state);
+	}
+
+	auto DestroyRasterizerState(RasterizerStateHandle state) -> void {
+		const bool freed = core.resources.rasterizerStates.Free(state);
+		Assert(freed);
+	}
+
+	auto CreateDepthStencilState(const DepthStencilDesc& desc) -> DepthStencilStateHandle {
+		const auto writeMask = desc.depthWrite ? D3D11_DEPTH_WRITE_MASK_ALL : D3D11_DEPTH_WRITE_MASK_ZERO;
+
+		ComPtr<ID3D11DepthStencilState> state;
+		state.Attach(DXLayer::CreateDepthStencilState(core.device.Get(), desc.depthTest, writeMask, ToD3DComparisonFunc(desc.depthFunc), desc.stencilTest));
+
+		return core.resources.depthStencilStates.Allocate(state);
+	}
+
+	auto DestroyDepthStencilState(DepthStencilStateHandle state) -> void {
+		const bool freed = core.resources.depthStencilStates.Free(state);
+		Assert(freed);
+	}
+
+	auto CreateProgram(const ProgramDesc& desc) -> ProgramHandle {
+		ShaderProgram program;
+		program.Create(core.device.Get(), desc.vertexShaderBytecode, desc.pixelShaderBytecode, desc.inputSignature);
+
+		return core.resources.programs.Allocate(program);
+	}
+
+	auto DestroyProgram(ProgramHandle handle) -> void {
+		auto program = core.resources.programs.Get(handle);
+		Assert(program != nullptr);
+
+		program->Release();
+		core.resources.programs.Free(handle);
+	}
+
+	auto CreatePipeline(const PipelineDesc& desc) -> PipelineHandle {
+		Assert(core.resources.programs.IsAlive(desc.program));
+
+		return core.resources.pipelines.Allocate(PipelineD3D11{
+			.program = desc.program,
+			.rasterizerState = core.resources.Get(desc.rasterizerState),
+			.depthStencilState = core.resources.Get(desc.depthStencilState),
+			.stencilRef = desc.stencilRef
+		});
+	}
+
+	auto DestroyPipeline(PipelineHandle pipeline) -> void {
+		const bool freed = core.resources.pipelines.Free(pipeline);
+		Assert(freed);
+	}
+
+	auto CreateRenderTarget(const RenderTargetDesc& desc) -> RenderTargetHandle {
+		ComPtr<ID3D11Texture2D> texture;
+		texture.Attach(DXLayer::CreateTexture(core.device.Get(), desc.width, desc.height, ToDXGIFormat(desc.format), D3D11_BIND_RENDER_TARGET | D3D11_BIND_SHADER_RESOURCE, 1, desc.sampleCount));
+		Assert(texture != nullptr);
+
+		// NOTE: the view keeps the texture alive
+		ComPtr<ID3D11RenderTargetView> view;
+		ASSERT_ERROR_RESULT(core.device->CreateRenderTargetView(texture.Get(), nullptr, view.GetAddressOf()));
+
+		return core.resources.renderTargets.Allocate(view);
+	}
+
+	auto DestroyRenderTarget(RenderTargetHandle target) -> void {
+		Assert(target != core.backbuffer);
+		const bool freed = core.resources.renderTargets.Free(target);
+		Assert(freed);
+	}
+
+	auto CreateDepthTarget(const DepthTargetDesc& desc) -> DepthTargetHandle {
+		ComPtr<ID3D11Texture2D> texture;
+		texture.Attach(CreateDepthStencilTexture(core.device.Get(), desc.width, desc.height, desc.sampleCount));
+		Assert(texture != nullptr);
+
+		ComPtr<ID3D11DepthStencilView> view;
+		view.Attach(CreateDepthStencilView(core.device.Get(), texture.Get()));
+
+		return core.resources.depthTargets.Allocate(DepthTargetD3D11{ .texture = texture, .view = view });
+	}
+
+	auto DestroyDepthTarget(DepthTargetHandle target) -> void {
+		const bool freed = core.resources.depthTargets.Free(target);
+		Assert(freed);
+	}
+
+	auto GetBackbuffer() -> RenderTargetHandle {
+		return core.backbuffer;
+	}
+
+	auto Submit(std::span<const CommandList> lists) -> void {
+		if (core.useDeferredContexts) {
+			ExecuteCommandListsDeferred(core.device.Get(), core.context.Get(), core.resources, lists, core.deferredContexts);
+			return;
+		}
+
+		for (const auto& list : lists)
+			ReplayCommandList(core.context.Get(), core.resources, list);
+	}
+
+	auto Present() -> void {
+		core.swapChain->Present(1, 0);
+	}
+
+	auto GetDevice() -> ID3D11Device1* {
+		return core.device.Get();
+	}
+
+	auto GetContext() -> ID3D11DeviceContext1* {
+		return core.context.Get();
+	}
 }
\ No newline at end of file
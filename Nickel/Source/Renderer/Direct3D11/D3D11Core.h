@@ -1,6 +1,49 @@
 #pragma once
 
+#include "../RendererPlatformInterface.h"
+
+struct ID3D11Device1;
+struct ID3D11DeviceContext1;
+
 namespace Nickel::Renderer::DXLayer::Core {
-	auto Init() -> bool;
+	auto Init(const PlatformInitDesc& desc) -> bool;
 	auto Shutdown() -> void;
+
+	auto CreateBuffer(const BufferDesc& desc, const void* initialData) -> BufferHandle;
+	auto UpdateBuffer(BufferHandle buffer, const void* data, u32 size) -> void;
+	auto DestroyBuffer(BufferHandle buffer) -> void;
+
+	auto CreateTexture(const TextureDesc& desc, std::span<const SubresourceData> initialData) -> TextureHandle;
+	auto DestroyTexture(TextureHandle texture) -> void;
+
+	auto CreateSampler(const SamplerDesc& desc) -> SamplerHandle;
+	auto DestroySampler(SamplerHandle sampler) -> void;
+
+	auto CreateTextureTable(const TextureTableDesc& desc) -> TextureTableHandle;
+	auto DestroyTextureTable(TextureTableHandle table) -> void;
+
+	auto CreateRasterizerState(const RasterizerDesc& desc) -> RasterizerStateHandle;
+	auto DestroyRasterizerState(RasterizerStateHandle state) -> void;
+
+	auto CreateDepthStencilState(const DepthStencilDesc& desc) -> DepthStencilStateHandle;
+	auto DestroyDepthStencilState(DepthStencilStateHandle state) -> void;
+
+	auto CreateProgram(const ProgramDesc& desc) -> ProgramHandle;
+	auto DestroyProgram(ProgramHandle program) -> void;
+
+	auto CreatePipeline(const PipelineDesc& desc) -> PipelineHandle;
+	auto DestroyPipeline(PipelineHandle pipeline) -> void;
+
+	auto CreateRenderTarget(const RenderTargetDesc& desc) -> RenderTargetHandle;
+	auto DestroyRenderTarget(RenderTargetHandle target) -> void;
+	auto CreateDepthTarget(const DepthTargetDesc& desc) -> DepthTargetHandle;
+	auto DestroyDepthTarget(DepthTargetHandle target) -> void;
+	auto GetBackbuffer() -> RenderTargetHandle;
+
+	auto Submit(std::span<const CommandList> lists) -> void;
+	auto Present() -> void;
+
+	// NOTE: D3D11 specific, for code that has to talk to the device directly (ImGui backend)
+	auto GetDevice() -> ID3D11Device1*;
+	auto GetContext() -> ID3D11DeviceContext1*;
 }
\ No newline at end of file
@@ -0,0 +1,70 @@
+#pragma once
+
+#include "../DX11Layer.h"
+#include "../HandlePool.h"
+#include "../../ShaderProgram.h"
+
+namespace Nickel::Renderer::DXLayer {
+	struct BufferD3D11 {
+		ComPtr<ID3D11Buffer> buffer;
+		ComPtr<ID3D11ShaderResourceView> srv; // NOTE: structured buffers only
+		BufferDesc desc;
+	};
+
+	struct TextureD3D11 {
+		ComPtr<ID3D11Resource> resource;
+		ComPtr<ID3D11ShaderResourceView> srv;
+		TextureDesc desc;
+	};
+
+	struct DepthTargetD3D11 {
+		ComPtr<ID3D11Texture2D> texture;
+		ComPtr<ID3D11DepthStencilView> view;
+	};
+
+	// NOTE: holds its own references to the states, so a pipeline stays bindable after the caller destroys them
+	struct PipelineD3D11 {
+		ProgramHandle program;
+		ComPtr<ID3D11RasterizerState> rasterizerState;
+		ComPtr<ID3D11DepthStencilState> depthStencilState;
+		u32 stencilRef;
+	};
+
+	// NOTE: views and samplers are packed at creation so binding is a single call per array, the references keep them alive
+	struct TextureTableD3D11 {
+		ComPtr<ID3D11ShaderResourceView> views[MaxBindSlots];
+		ComPtr<ID3D11SamplerState> samplerStates[MaxBindSlots];
+		ID3D11ShaderResourceView* srvs[MaxBindSlots];
+		ID3D11SamplerState* samplers[MaxBindSlots];
+		u32 textureCount;
+		u32 samplerCount;
+	};
+
+	// Owns every D3D11 object created through the platform interface. Creation/destruction happens on the
+	// main thread, lookups are read-only and safe from any thread replaying command lists.
+	class ResourceTable {
+	public:
+		inline auto Get(BufferHandle h)            const -> ID3D11Buffer*             { auto r = buffers.Get(h);            return r != nullptr ? r->buffer.Get() : nullptr; }
+		inline auto GetView(BufferHandle h)        const -> ID3D11ShaderResourceView* { auto r = buffers.Get(h);            return r != nullptr ? r->srv.Get() : nullptr; }
+		inline auto Get(TextureHandle h)           const -> ID3D11ShaderResourceView* { auto r = textures.Get(h);           return r != nullptr ? r->srv.Get() : nullptr; }
+		inline auto Get(SamplerHandle h)           const -> ID3D11SamplerState*       { auto r = samplers.Get(h);           return r != nullptr ? r->Get() : nullptr; }
+		inline auto Get(TextureTableHandle h)      const -> const TextureTableD3D11*  { return textureTables.Get(h); }
+		inline auto Get(ProgramHandle h)           const -> const ShaderProgram*      { return programs.Get(h); }
+		inline auto Get(PipelineHandle h)          const -> const PipelineD3D11*      { return pipelines.Get(h); }
+		inline auto Get(RasterizerStateHandle h)   const -> ID3D11RasterizerState*    { auto r = rasterizerStates.Get(h);   return r != nullptr ? r->Get() : nullptr; }
+		inline auto Get(DepthStencilStateHandle h) const -> ID3D11DepthStencilState*  { auto r = depthStencilStates.Get(h); return r != nullptr ? r->Get() : nullptr; }
+		inline auto Get(RenderTargetHandle h)      const -> ID3D11RenderTargetView*   { auto r = renderTargets.Get(h);      return r != nullptr ? r->Get() : nullptr; }
+		inline auto Get(DepthTargetHandle h)       const -> ID3D11DepthStencilView*   { auto r = depthTargets.Get(h);       return r != nullptr ? r->view.Get() : nullptr; }
+
+		HandlePool<BufferHandle, BufferD3D11> buffers;
+		HandlePool<TextureHandle, TextureD3D11> textures;
+		HandlePool<SamplerHandle, ComPtr<ID3D11SamplerState>> samplers;
+		HandlePool<TextureTableHandle, TextureTableD3D11> textureTables;
+		HandlePool<ProgramHandle, ShaderProgram> programs;
+		HandlePool<PipelineHandle, PipelineD3D11> pipelines;
+		HandlePool<RasterizerStateHandle, ComPtr<ID3D11RasterizerState>> rasterizerStates;
+		HandlePool<DepthStencilStateHandle, ComPtr<ID3D11DepthStencilState>> depthStencilStates;
+		HandlePool<RenderTargetHandle, ComPtr<ID3D11RenderTargetView>> renderTargets;
+		HandlePool<DepthTargetHandle, DepthTargetD3D11> depthTargets;
+	};
+}
\ No newline at end of file
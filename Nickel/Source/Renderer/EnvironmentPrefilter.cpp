@@ -0,0 +1,303 @@
+#include "EnvironmentPrefilter.h"
+#include "TextureCache.h"
+#include "ImageDecoder.h"
+#include "../Threading.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <sstream>
+
+namespace Nickel::Renderer {
+	namespace {
+		constexpr f32 Pi = 3.14159265359f;
+		constexpr u32 RadianceCacheTag = 1; // NOTE: bump when the filtering changes, old cache files become misses
+		constexpr u32 BrdfLutCacheTag = 1;
+
+		// NOTE: a tangent space direction with its weight and the source mip it reads, the same for every texel of a mip
+		struct LobeSample {
+			f32 x, y, z;
+			f32 weight;
+			f32 lod;
+		};
+
+		auto Hammersley(u32 i, u32 count, f32& u, f32& v) -> void {
+			u = static_cast<f32>(i) / static_cast<f32>(count);
+			u32 bits = i;
+			bits = (bits << 16u) | (bits >> 16u);
+			bits = ((bits & 0x55555555u) << 1u) | ((bits & 0xAAAAAAAAu) >> 1u);
+			bits = ((bits & 0x33333333u) << 2u) | ((bits & 0xCCCCCCCCu) >> 2u);
+			bits = ((bits & 0x0F0F0F0Fu) << 4u) | ((bits & 0xF0F0F0F0u) >> 4u);
+			bits = ((bits & 0x00FF00FFu) << 8u) | ((bits & 0xFF00FF00u) >> 8u);
+			v = static_cast<f32>(bits) * 2.3283064365386963e-10f; // NOTE: radical inverse, bits / 2^32
+		}
+
+		// NOTE: half vector around +Z distributed like D(h) * NdotH, alpha is roughness squared like DistributionGGX
+		auto ImportanceSampleGGX(f32 u, f32 v, f32 alpha, f32 (&h)[3]) -> void {
+			const f32 phi = 2.0f * Pi * u;
+			const f32 cosTheta = std::sqrt((1.0f - v) / (1.0f + (alpha * alpha - 1.0f) * v));
+			const f32 sinTheta = std::sqrt(std::max(1.0f - cosTheta * cosTheta, 0.0f));
+			h[0] = sinTheta * std::cos(phi);
+			h[1] = sinTheta * std::sin(phi);
+			h[2] = cosTheta;
+		}
+
+		// NOTE: with N = V = R the pdf of the reflected direction is D / 4. Reading the source at the mip whose texels
+		// cover the solid angle of one sample hides the undersampling, +1 biases towards blur over noise
+		auto BuildLobe(f32 roughness, u32 sampleCount, u32 sourceSize) -> std::vector<LobeSample> {
+			const f32 alpha = roughness * roughness;
+			const f32 alpha2 = alpha * alpha;
+			const f32 texelSolidAngle = 4.0f * Pi / (static_cast<f32>(CubeFaceCount) * static_cast<f32>(sourceSize) * static_cast<f32>(sourceSize));
+
+			std::vector<LobeSample> lobe;
+			lobe.reserve(sampleCount);
+			for (u32 i = 0; i < sampleCount; i++) {
+				f32 u, v, h[3];
+				Hammersley(i, sampleCount, u, v);
+				ImportanceSampleGGX(u, v, alpha, h);
+
+				const f32 NdotL = 2.0f * h[2] * h[2] - 1.0f;
+				if (NdotL <= 0.0f)
+					continue;
+
+				const f32 denominator = h[2] * h[2] * (alpha2 - 1.0f) + 1.0f;
+				const f32 pdf = alpha2 / (Pi * denominator * denominator) * 0.25f;
+				const f32 sampleSolidAngle = 1.0f / (static_cast<f32>(sampleCount) * pdf + 1e-4f);
+				lobe.push_back(LobeSample{
+					.x = 2.0f * h[2] * h[0],
+					.y = 2.0f * h[2] * h[1],
+					.z = NdotL,
+					.weight = NdotL,
+					.lod = std::max(0.5f * std::log2(sampleSolidAngle / texelSolidAngle) + 1.0f, 0.0f)
+				});
+			}
+
+			return lobe;
+		}
+
+		auto SampleChain(const std::vector<CubemapImage>& chain, const Vec3& direction, f32 lod, f32 (&out)[4]) -> void {
+			const f32 last = static_cast<f32>(chain.size() - 1);
+			lod = std::min(lod, last);
+			const u32 mip0 = static_cast<u32>(lod);
+			SampleCubemap(chain[mip0], direction, out);
+
+			const f32 t = lod - static_cast<f32>(mip0);
+			if (t == 0.0f)
+				return;
+
+			f32 next[4];
+			SampleCubemap(chain[mip0 + 1], direction, next);
+			for (u32 i = 0; i < 4; i++)
+				out[i] += (next[i] - out[i]) * t;
+		}
+
+		auto FilterMip(const std::vector<CubemapImage>& chain, const std::vector<LobeSample>& lobe, CubemapImage& mip) -> void {
+			const u32 rowCount = mip.size * CubeFaceCount;
+			const f32 texel = 2.0f / static_cast<f32>(mip.size);
+			ParallelForChunks(rowCount, std::min(GetWorkerCount(), rowCount), [&](u32, u32 begin, u32 end) {
+				for (u32 row = begin; row < end; row++) {
+					const u32 face = row / mip.size;
+					const u32 y = row % mip.size;
+					const f32 v = (static_cast<f32>(y) + 0.5f) * texel - 1.0f;
+					for (u32 x = 0; x < mip.size; x++) {
+						const f32 u = (static_cast<f32>(x) + 0.5f) * texel - 1.0f;
+						const Vec3 d = CubeFaceDirection(face, u, v);
+						const f32 invLength = 1.0f / std::sqrt(d.x * d.x + d.y * d.y + d.z * d.z);
+						const f32 n[3] = { d.x * invLength, d.y * invLength, d.z * invLength };
+
+						// NOTE: any tangent frame works, the lobe is rotationally symmetric around N
+						const f32 up[3] = { std::abs(n[2]) < 0.999f ? 0.0f : 1.0f, 0.0f, std::abs(n[2]) < 0.999f ? 1.0f : 0.0f };
+						f32 t[3] = { up[1] * n[2] - up[2] * n[1], up[2] * n[0] - up[0] * n[2], up[0] * n[1] - up[1] * n[0] };
+						const f32 invTangentLength = 1.0f / std::sqrt(t[0] * t[0] + t[1] * t[1] + t[2] * t[2]);
+						t[0] *= invTangentLength; t[1] *= invTangentLength; t[2] *= invTangentLength;
+						const f32 b[3] = { n[1] * t[2] - n[2] * t[1], n[2] * t[0] - n[0] * t[2], n[0] * t[1] - n[1] * t[0] };
+
+						f32 sum[4] = {};
+						f32 weight = 0.0f;
+						for (const auto& sample : lobe) {
+							const Vec3 l = {
+								t[0] * sample.x + b[0] * sample.y + n[0] * sample.z,
+								t[1] * sample.x + b[1] * sample.y + n[1] * sample.z,
+								t[2] * sample.x + b[2] * sample.y + n[2] * sample.z
+							};
+
+							f32 color[4];
+							SampleChain(chain, l, sample.lod, color);
+							for (u32 i = 0; i < 3; i++)
+								sum[i] += color[i] * sample.weight;
+							weight += sample.weight;
+						}
+
+						f32* out = mip.faces[face].data() + (static_cast<u64>(y) * mip.size + x) * 4;
+						const f32 invWeight = weight > 0.0f ? 1.0f / weight : 0.0f;
+						out[0] = sum[0] * invWeight;
+						out[1] = sum[1] * invWeight;
+						out[2] = sum[2] * invWeight;
+						out[3] = 1.0f;
+					}
+				}
+			});
+		}
+
+		auto HashValue(u64 hash, u32 value) -> u64 {
+			return HashBytes(std::span{ reinterpret_cast<const u8*>(&value), sizeof(value) }, hash);
+		}
+
+		auto CachePath(const std::filesystem::path& cacheDir, const char* name, u64 key) -> std::filesystem::path {
+			std::stringstream fileName;
+			fileName << name << '_' << std::hex << key << ".ntex";
+			return cacheDir / fileName.str();
+		}
+
+		auto ToMilliseconds(std::chrono::steady_clock::duration duration) -> f64 {
+			return std::chrono::duration<f64, std::milli>(duration).count();
+		}
+	}
+
+	auto GetPrefilterMipCount(u32 size, const PrefilterDesc& desc) -> u32 {
+		u32 count = 1;
+		while ((size >> count) >= std::max(desc.minSize, 1u))
+			count++;
+
+		return count;
+	}
+
+	auto PrefilterGGX(const CubemapImage& environment, const PrefilterDesc& desc) -> std::vector<CubemapImage> {
+		Assert(environment.IsValid());
+		Assert(desc.sampleCount > 0);
+
+		// NOTE: box filtered source mips down to 1x1, what the wide lobes read instead of thousands of texels
+		const auto chain = BuildMipChain(environment);
+
+		const u32 mipCount = GetPrefilterMipCount(environment.size, desc);
+		std::vector<CubemapImage> mips(mipCount);
+		mips[0] = environment; // NOTE: roughness 0 is a mirror, the lobe is a single texel
+
+		for (u32 m = 1; m < mipCount; m++) {
+			auto& mip = mips[m];
+			mip.size = environment.size >> m;
+			for (auto& face : mip.faces)
+				face.resize(static_cast<u64>(mip.size) * mip.size * 4);
+
+			const f32 roughness = static_cast<f32>(m) / static_cast<f32>(mipCount - 1);
+			FilterMip(chain, BuildLobe(roughness, desc.sampleCount, environment.size), mip);
+		}
+
+		return mips;
+	}
+
+	auto IntegrateBrdfLut(const BrdfLutDesc& desc) -> std::vector<u16> {
+		Assert(desc.size > 0 && desc.sampleCount > 0);
+
+		std::vector<u16> texels(static_cast<u64>(desc.size) * desc.size * 2);
+		ParallelForChunks(desc.size, std::min(GetWorkerCount(), desc.size), [&](u32, u32 begin, u32 end) {
+			for (u32 y = begin; y < end; y++) {
+				const f32 roughness = (static_cast<f32>(y) + 0.5f) / static_cast<f32>(desc.size);
+				const f32 alpha = roughness * roughness;
+				const f32 k = alpha / 2.0f; // NOTE: the IBL remapping of Schlick-GGX, analytic lights use (r + 1)^2 / 8
+
+				for (u32 x = 0; x < desc.size; x++) {
+					const f32 NdotV = (static_cast<f32>(x) + 0.5f) / static_cast<f32>(desc.size);
+					const f32 view[3] = { std::sqrt(1.0f - NdotV * NdotV), 0.0f, NdotV };
+					const f32 geometryV = NdotV / (NdotV * (1.0f - k) + k);
+
+					f32 scale = 0.0f;
+					f32 bias = 0.0f;
+					for (u32 i = 0; i < desc.sampleCount; i++) {
+						f32 u, v, h[3];
+						Hammersley(i, desc.sampleCount, u, v);
+						ImportanceSampleGGX(u, v, alpha, h);
+
+						const f32 VdotH = view[0] * h[0] + view[1] * h[1] + view[2] * h[2];
+						const f32 NdotL = 2.0f * VdotH * h[2] - view[2];
+						if (NdotL <= 0.0f)
+							continue;
+
+						const f32 NdotH = std::max(h[2], 0.0f);
+						const f32 geometry = geometryV * NdotL / (NdotL * (1.0f - k) + k);
+						const f32 visibility = geometry * std::max(VdotH, 0.0f) / (NdotH * NdotV);
+						const f32 fresnel = std::pow(1.0f - std::max(VdotH, 0.0f), 5.0f);
+						scale += (1.0f - fresnel) * visibility;
+						bias += fresnel * visibility;
+					}
+
+					u16* out = texels.data() + (static_cast<u64>(y) * desc.size + x) * 2;
+					out[0] = FloatToHalf(scale / static_cast<f32>(desc.sampleCount));
+					out[1] = FloatToHalf(bias / static_cast<f32>(desc.sampleCount));
+				}
+			}
+		});
+
+		return texels;
+	}
+
+	auto CreateRadianceMap(const PlatformInterface& gfx, const CubemapImage& environment, const std::filesystem::path& cacheDir, const PrefilterDesc& desc, PrefilterStats* stats) -> TextureHandle {
+		Assert(environment.IsValid());
+		const auto start = std::chrono::steady_clock::now();
+
+		u64 key = HashValue(HashValue(HashValue(HashValue(HashSeed, RadianceCacheTag), environment.size), desc.sampleCount), desc.minSize);
+		for (const auto& face : environment.faces)
+			key = HashBytes(std::span{ reinterpret_cast<const u8*>(face.data()), face.size() * sizeof(f32) }, key);
+
+		const auto path = CachePath(cacheDir, "radiance", key);
+		const u32 mipCount = GetPrefilterMipCount(environment.size, desc);
+		auto texture = LoadCachedTexture(gfx, path, key);
+		const bool cached = texture.IsValid();
+		if (!cached) {
+			const auto mips = PrefilterGGX(environment, desc);
+
+			// NOTE: halves the upload and the cache file, the prefiltered values are far inside the half range
+			std::vector<std::vector<u16>> halfTexels;
+			std::vector<SubresourceData> data;
+			halfTexels.reserve(CubeFaceCount * mipCount);
+			data.reserve(CubeFaceCount * mipCount);
+			for (u32 face = 0; face < CubeFaceCount; face++) {
+				for (const auto& mip : mips) {
+					auto& texels = halfTexels.emplace_back(mip.faces[face].size());
+					ConvertFloatToHalf(mip.faces[face].data(), texels.data(), texels.size());
+					data.push_back(SubresourceData{ .data = texels.data(), .rowPitch = mip.size * 4 * static_cast<u32>(sizeof(u16)) });
+				}
+			}
+
+			const auto textureDesc = TextureDesc{
+				.type = TextureType::TextureCube,
+				.format = TextureFormat::RGBA16_FLOAT,
+				.width = environment.size,
+				.height = environment.size,
+				.mipLevels = mipCount,
+				.arraySize = CubeFaceCount
+			};
+			texture = gfx.CreateTexture(textureDesc, data);
+			StoreCachedTexture(path, key, textureDesc, data);
+		}
+
+		if (stats != nullptr)
+			*stats = PrefilterStats{ .mipCount = mipCount, .milliseconds = ToMilliseconds(std::chrono::steady_clock::now() - start), .cached = cached };
+
+		return texture;
+	}
+
+	auto CreateBrdfLut(const PlatformInterface& gfx, const std::filesystem::path& cacheDir, const BrdfLutDesc& desc, PrefilterStats* stats) -> TextureHandle {
+		const auto start = std::chrono::steady_clock::now();
+
+		const u64 key = HashValue(HashValue(HashValue(HashSeed, BrdfLutCacheTag), desc.size), desc.sampleCount);
+		const auto path = CachePath(cacheDir, "brdf_lut", key);
+		auto texture = LoadCachedTexture(gfx, path, key);
+		const bool cached = texture.IsValid();
+		if (!cached) {
+			const auto texels = IntegrateBrdfLut(desc);
+			const auto textureDesc = TextureDesc{
+				.format = TextureFormat::RG16_FLOAT,
+				.width = desc.size,
+				.height = desc.size
+			};
+			const SubresourceData data[] = { { .data = texels.data(), .rowPitch = desc.size * 2 * static_cast<u32>(sizeof(u16)) } };
+			texture = gfx.CreateTexture(textureDesc, std::span{ data });
+			StoreCachedTexture(path, key, textureDesc, std::span{ data });
+		}
+
+		if (stats != nullptr)
+			*stats = PrefilterStats{ .mipCount = 1, .milliseconds = ToMilliseconds(std::chrono::steady_clock::now() - start), .cached = cached };
+
+		return texture;
+	}
+}
@@ -0,0 +1,39 @@
+#pragma once
+
+#include "CubemapImage.h"
+#include "RendererPlatformInterface.h"
+#include <filesystem>
+#include <vector>
+
+// Specular image based lighting, the split sum approximation. The environment is convolved with the GGX lobe once per
+// mip, roughness going from 0 at mip 0 to 1 at the last mip, and the BRDF's scale and bias over (NdotV, roughness)
+// are integrated into a lookup table. Both are importance sampled on the CPU (threads over rows) and kept in the
+// texture cache, so an environment is prefiltered once and every later run maps the result from disk.
+namespace Nickel::Renderer {
+	struct PrefilterDesc {
+		u32 sampleCount = 256; // NOTE: per texel, the source mip chain keeps low counts free of fireflies
+		u32 minSize = 8;       // NOTE: size of the last mip, smaller faces turn the roughest lobes blocky
+	};
+
+	struct BrdfLutDesc {
+		u32 size = 128;
+		u32 sampleCount = 512;
+	};
+
+	struct PrefilterStats {
+		u32 mipCount;
+		f64 milliseconds;
+		bool cached; // NOTE: loaded from the texture cache, nothing was filtered
+	};
+
+	// NOTE: mips down to desc.minSize, mip 0 is the environment itself
+	auto GetPrefilterMipCount(u32 size, const PrefilterDesc& desc) -> u32;
+	// NOTE: one image per mip, the roughness of mip m is m / (mipCount - 1)
+	auto PrefilterGGX(const CubemapImage& environment, const PrefilterDesc& desc = {}) -> std::vector<CubemapImage>;
+	// NOTE: RG16F texels, scale in r and bias in g, x is NdotV and rows go down with roughness
+	auto IntegrateBrdfLut(const BrdfLutDesc& desc = {}) -> std::vector<u16>;
+
+	// NOTE: RGBA16F cube map with the prefiltered mip chain, rebuilt when the environment or the desc changes
+	auto CreateRadianceMap(const PlatformInterface& gfx, const CubemapImage& environment, const std::filesystem::path& cacheDir, const PrefilterDesc& desc = {}, PrefilterStats* stats = nullptr) -> TextureHandle;
+	auto CreateBrdfLut(const PlatformInterface& gfx, const std::filesystem::path& cacheDir, const BrdfLutDesc& desc = {}, PrefilterStats* stats = nullptr) -> TextureHandle;
+}
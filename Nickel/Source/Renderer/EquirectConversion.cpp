@@ -0,0 +1,328 @@
+#include "EquirectConversion.h"
+#include "../Threading.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+
+#if defined(_M_X64) || defined(__x86_64__)
+#define NICKEL_EQUIRECT_SSE 1
+#include <immintrin.h> // NOTE: SSE2 is part of x64, no runtime dispatch needed
+#endif
+
+namespace Nickel::Renderer {
+	namespace {
+		constexpr f32 Pi = 3.14159265359f;
+		constexpr u32 TileSize = 32;
+
+		// NOTE: face u/v to unnormalized direction, linear in u so a row only adds the u axis per texel
+		struct FaceAxes {
+			f32 constant[3];
+			f32 u[3];
+			f32 v[3];
+		};
+
+		auto GetFaceAxes(u32 face) -> FaceAxes {
+			const Vec3 origin = CubeFaceDirection(face, 0.0f, 0.0f);
+			const Vec3 du = CubeFaceDirection(face, 1.0f, 0.0f) - origin;
+			const Vec3 dv = CubeFaceDirection(face, 0.0f, 1.0f) - origin;
+			return FaceAxes{ { origin.x, origin.y, origin.z }, { du.x, du.y, du.z }, { dv.x, dv.y, dv.z } };
+		}
+
+		// NOTE: panorama texels per radian, directions map to texel coordinates with texel centers at +0.5
+		struct SourceScale {
+			f32 x; // NOTE: width / 2pi
+			f32 y; // NOTE: height / pi
+			f32 width;
+			f32 height;
+		};
+
+		// NOTE: what one row of a tile reads, the top left tap of every texel and the fractions towards the next one
+		struct RowTaps {
+			i32 x[TileSize];
+			i32 y[TileSize];
+			f32 tx[TileSize];
+			f32 ty[TileSize];
+		};
+
+		auto ComputeTap(const SourceScale& scale, f32 dx, f32 dy, f32 dz, RowTaps& taps, u32 i) -> void {
+			const f32 longitude = std::atan2(dz, dx);
+			const f32 latitude = std::atan2(dy, std::sqrt(dx * dx + dz * dz));
+			const f32 sx = longitude * scale.x + 0.5f * scale.width - 0.5f;
+			const f32 sy = 0.5f * scale.height - latitude * scale.y - 0.5f;
+			const f32 fx = std::floor(sx);
+			const f32 fy = std::floor(sy);
+			taps.x[i] = static_cast<i32>(fx);
+			taps.y[i] = static_cast<i32>(fy);
+			taps.tx[i] = sx - fx;
+			taps.ty[i] = sy - fy;
+		}
+
+		inline auto WrapColumn(i32 x, i32 width) -> u32 {
+			// NOTE: the filters reach at most 2 texels past the seam
+			return static_cast<u32>(x < 0 ? x + width : (x >= width ? x - width : x));
+		}
+
+		inline auto ClampRow(i32 y, i32 height) -> u32 {
+			return static_cast<u32>(std::clamp(y, 0, height - 1));
+		}
+
+		// NOTE: Catmull-Rom weights of the taps at -1, 0, 1, 2 for a fraction t
+		inline auto CatmullRomWeights(f32 t, f32 (&w)[4]) -> void {
+			const f32 t2 = t * t;
+			const f32 t3 = t2 * t;
+			w[0] = 0.5f * (-t3 + 2.0f * t2 - t);
+			w[1] = 0.5f * (3.0f * t3 - 5.0f * t2 + 2.0f);
+			w[2] = 0.5f * (-3.0f * t3 + 4.0f * t2 + t);
+			w[3] = 0.5f * (t3 - t2);
+		}
+
+		inline auto TexelAt(const EquirectImage& panorama, u32 x, u32 y) -> const f32* {
+			return panorama.texels.data() + (static_cast<u64>(y) * panorama.width + x) * 4;
+		}
+
+#if defined(NICKEL_EQUIRECT_SSE)
+		// NOTE: atan2 with a degree 11 minimax polynomial on [0, 1] and octant fix ups, max error ~2e-6 rad. That's
+		// under 1/300 of a texel for an 8K panorama
+		auto Atan2SSE(__m128 y, __m128 x) -> __m128 {
+			const __m128 signMask = _mm_set1_ps(-0.0f);
+			const __m128 ax = _mm_andnot_ps(signMask, x);
+			const __m128 ay = _mm_andnot_ps(signMask, y);
+			const __m128 high = _mm_max_ps(ax, ay);
+			const __m128 low = _mm_min_ps(ax, ay);
+			const __m128 a = _mm_div_ps(low, _mm_max_ps(high, _mm_set1_ps(1e-30f)));
+			const __m128 s = _mm_mul_ps(a, a);
+
+			__m128 r = _mm_set1_ps(-0.01172120f);
+			r = _mm_add_ps(_mm_mul_ps(r, s), _mm_set1_ps(0.05265332f));
+			r = _mm_add_ps(_mm_mul_ps(r, s), _mm_set1_ps(-0.11643287f));
+			r = _mm_add_ps(_mm_mul_ps(r, s), _mm_set1_ps(0.19354346f));
+			r = _mm_add_ps(_mm_mul_ps(r, s), _mm_set1_ps(-0.33262347f));
+			r = _mm_add_ps(_mm_mul_ps(r, s), _mm_set1_ps(0.99997726f));
+			r = _mm_mul_ps(r, a);
+
+			// NOTE: |y| > |x| mirrors around pi/4, x < 0 around pi/2, then the sign of y
+			const __m128 steep = _mm_cmpgt_ps(ay, ax);
+			r = _mm_or_ps(_mm_and_ps(steep, _mm_sub_ps(_mm_set1_ps(0.5f * Pi), r)), _mm_andnot_ps(steep, r));
+			const __m128 negativeX = _mm_cmplt_ps(x, _mm_setzero_ps());
+			r = _mm_or_ps(_mm_and_ps(negativeX, _mm_sub_ps(_mm_set1_ps(Pi), r)), _mm_andnot_ps(negativeX, r));
+			return _mm_xor_ps(r, _mm_and_ps(signMask, y));
+		}
+
+		// NOTE: coordinates never go below -0.5, truncating them shifted positive floors without SSE4.1
+		auto FloorSSE(__m128 v, __m128i& integer) -> __m128 {
+			constexpr i32 Offset = 8;
+			integer = _mm_sub_epi32(_mm_cvttps_epi32(_mm_add_ps(v, _mm_set1_ps(static_cast<f32>(Offset)))), _mm_set1_epi32(Offset));
+			return _mm_cvtepi32_ps(integer);
+		}
+
+		// NOTE: 4 texels of a tile row per iteration, returns the first texel it didn't do
+		auto ComputeTapsSSE(const SourceScale& scale, const FaceAxes& axes, f32 u0, f32 v, f32 texel, u32 count, RowTaps& taps) -> u32 {
+			const u32 simdCount = count & ~3u;
+
+			__m128 base[3];
+			__m128 axisU[3];
+			for (u32 axis = 0; axis < 3; axis++) {
+				base[axis] = _mm_set1_ps(axes.constant[axis] + axes.v[axis] * v);
+				axisU[axis] = _mm_set1_ps(axes.u[axis]);
+			}
+
+			const __m128 scaleX = _mm_set1_ps(scale.x);
+			const __m128 scaleY = _mm_set1_ps(scale.y);
+			const __m128 offsetX = _mm_set1_ps(0.5f * scale.width - 0.5f);
+			const __m128 offsetY = _mm_set1_ps(0.5f * scale.height - 0.5f);
+			const __m128 texelStep = _mm_set1_ps(4.0f * texel);
+			__m128 u = _mm_setr_ps(u0, u0 + texel, u0 + 2.0f * texel, u0 + 3.0f * texel);
+
+			for (u32 x = 0; x < simdCount; x += 4) {
+				const __m128 dx = _mm_add_ps(base[0], _mm_mul_ps(axisU[0], u));
+				const __m128 dy = _mm_add_ps(base[1], _mm_mul_ps(axisU[1], u));
+				const __m128 dz = _mm_add_ps(base[2], _mm_mul_ps(axisU[2], u));
+
+				const __m128 longitude = Atan2SSE(dz, dx);
+				const __m128 latitude = Atan2SSE(dy, _mm_sqrt_ps(_mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dz, dz))));
+				const __m128 sx = _mm_add_ps(_mm_mul_ps(longitude, scaleX), offsetX);
+				const __m128 sy = _mm_sub_ps(offsetY, _mm_mul_ps(latitude, scaleY));
+
+				__m128i ix, iy;
+				const __m128 fx = FloorSSE(sx, ix);
+				const __m128 fy = FloorSSE(sy, iy);
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(taps.x + x), ix);
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(taps.y + x), iy);
+				_mm_storeu_ps(taps.tx + x, _mm_sub_ps(sx, fx));
+				_mm_storeu_ps(taps.ty + x, _mm_sub_ps(sy, fy));
+
+				u = _mm_add_ps(u, texelStep);
+			}
+
+			return simdCount;
+		}
+
+		// NOTE: the 4 channels of a texel are one vector, the taps are blended as a whole
+		inline auto LoadTexel(const EquirectImage& panorama, u32 x, u32 y) -> __m128 {
+			return _mm_loadu_ps(TexelAt(panorama, x, y));
+		}
+
+		auto FilterBilinear(const EquirectImage& panorama, i32 x0, i32 y0, f32 tx, f32 ty, f32* out) -> void {
+			const i32 width = static_cast<i32>(panorama.width);
+			const i32 height = static_cast<i32>(panorama.height);
+			const u32 xa = WrapColumn(x0, width), xb = WrapColumn(x0 + 1, width);
+			const u32 ya = ClampRow(y0, height), yb = ClampRow(y0 + 1, height);
+
+			const __m128 wx = _mm_set1_ps(tx);
+			const __m128 a = LoadTexel(panorama, xa, ya);
+			const __m128 b = LoadTexel(panorama, xb, ya);
+			const __m128 c = LoadTexel(panorama, xa, yb);
+			const __m128 d = LoadTexel(panorama, xb, yb);
+			const __m128 top = _mm_add_ps(a, _mm_mul_ps(_mm_sub_ps(b, a), wx));
+			const __m128 bottom = _mm_add_ps(c, _mm_mul_ps(_mm_sub_ps(d, c), wx));
+			_mm_storeu_ps(out, _mm_add_ps(top, _mm_mul_ps(_mm_sub_ps(bottom, top), _mm_set1_ps(ty))));
+		}
+
+		auto FilterBicubic(const EquirectImage& panorama, i32 x0, i32 y0, f32 tx, f32 ty, f32* out) -> void {
+			const i32 width = static_cast<i32>(panorama.width);
+			const i32 height = static_cast<i32>(panorama.height);
+
+			f32 wx[4], wy[4];
+			CatmullRomWeights(tx, wx);
+			CatmullRomWeights(ty, wy);
+
+			u32 columns[4];
+			for (i32 i = 0; i < 4; i++)
+				columns[i] = WrapColumn(x0 - 1 + i, width);
+
+			__m128 sum = _mm_setzero_ps();
+			for (i32 j = 0; j < 4; j++) {
+				const u32 row = ClampRow(y0 - 1 + j, height);
+				__m128 line = _mm_mul_ps(LoadTexel(panorama, columns[0], row), _mm_set1_ps(wx[0]));
+				for (u32 i = 1; i < 4; i++)
+					line = _mm_add_ps(line, _mm_mul_ps(LoadTexel(panorama, columns[i], row), _mm_set1_ps(wx[i])));
+				sum = _mm_add_ps(sum, _mm_mul_ps(line, _mm_set1_ps(wy[j])));
+			}
+
+			// NOTE: the negative lobes ring below zero next to a bright sun, HDR texels must not go negative
+			_mm_storeu_ps(out, _mm_max_ps(sum, _mm_setzero_ps()));
+		}
+#else
+		auto FilterBilinear(const EquirectImage& panorama, i32 x0, i32 y0, f32 tx, f32 ty, f32* out) -> void {
+			const i32 width = static_cast<i32>(panorama.width);
+			const i32 height = static_cast<i32>(panorama.height);
+			const u32 xa = WrapColumn(x0, width), xb = WrapColumn(x0 + 1, width);
+			const u32 ya = ClampRow(y0, height), yb = ClampRow(y0 + 1, height);
+
+			const f32* a = TexelAt(panorama, xa, ya);
+			const f32* b = TexelAt(panorama, xb, ya);
+			const f32* c = TexelAt(panorama, xa, yb);
+			const f32* d = TexelAt(panorama, xb, yb);
+			for (u32 i = 0; i < 4; i++) {
+				const f32 top = a[i] + (b[i] - a[i]) * tx;
+				const f32 bottom = c[i] + (d[i] - c[i]) * tx;
+				out[i] = top + (bottom - top) * ty;
+			}
+		}
+
+		auto FilterBicubic(const EquirectImage& panorama, i32 x0, i32 y0, f32 tx, f32 ty, f32* out) -> void {
+			const i32 width = static_cast<i32>(panorama.width);
+			const i32 height = static_cast<i32>(panorama.height);
+
+			f32 wx[4], wy[4];
+			CatmullRomWeights(tx, wx);
+			CatmullRomWeights(ty, wy);
+
+			f32 sum[4] = {};
+			for (i32 j = 0; j < 4; j++) {
+				const u32 row = ClampRow(y0 - 1 + j, height);
+				for (i32 i = 0; i < 4; i++) {
+					const f32* texel = TexelAt(panorama, WrapColumn(x0 - 1 + i, width), row);
+					const f32 weight = wx[i] * wy[j];
+					for (u32 c = 0; c < 4; c++)
+						sum[c] += texel[c] * weight;
+				}
+			}
+
+			for (u32 c = 0; c < 4; c++)
+				out[c] = std::max(sum[c], 0.0f); // NOTE: the negative lobes ring below zero next to a bright sun
+		}
+#endif
+
+		// NOTE: square tiles of all faces spread over the workers. A tile reads a compact patch of the panorama, whole
+		// rows of the +Y and -Y faces would sweep across all of it
+		template <EquirectFilter Filter>
+		auto ConvertTiles(const EquirectImage& panorama, const SourceScale& scale, CubemapImage& image) -> void {
+			FaceAxes axes[CubeFaceCount];
+			for (u32 face = 0; face < CubeFaceCount; face++)
+				axes[face] = GetFaceAxes(face);
+
+			const u32 tilesPerSide = (image.size + TileSize - 1) / TileSize;
+			const u32 tileCount = tilesPerSide * tilesPerSide * CubeFaceCount;
+			const f32 texel = 2.0f / static_cast<f32>(image.size);
+			ParallelForChunks(tileCount, std::min(GetWorkerCount(), tileCount), [&](u32, u32 begin, u32 end) {
+				RowTaps taps;
+				for (u32 tile = begin; tile < end; tile++) {
+					const u32 face = tile / (tilesPerSide * tilesPerSide);
+					const u32 x0 = (tile % tilesPerSide) * TileSize;
+					const u32 y0 = (tile / tilesPerSide % tilesPerSide) * TileSize;
+					const u32 width = std::min(TileSize, image.size - x0);
+					const u32 height = std::min(TileSize, image.size - y0);
+					const auto& a = axes[face];
+
+					for (u32 y = y0; y < y0 + height; y++) {
+						const f32 v = (static_cast<f32>(y) + 0.5f) * texel - 1.0f;
+						const f32 u0 = (static_cast<f32>(x0) + 0.5f) * texel - 1.0f;
+
+						u32 x = 0;
+#if defined(NICKEL_EQUIRECT_SSE)
+						x = ComputeTapsSSE(scale, a, u0, v, texel, width, taps);
+#endif
+						for (; x < width; x++) {
+							const f32 u = u0 + static_cast<f32>(x) * texel;
+							ComputeTap(scale, a.constant[0] + a.u[0] * u + a.v[0] * v, a.constant[1] + a.u[1] * u + a.v[1] * v, a.constant[2] + a.u[2] * u + a.v[2] * v, taps, x);
+						}
+
+						f32* out = image.faces[face].data() + (static_cast<u64>(y) * image.size + x0) * 4;
+						for (x = 0; x < width; x++, out += 4) {
+							if constexpr (Filter == EquirectFilter::Bicubic)
+								FilterBicubic(panorama, taps.x[x], taps.y[x], taps.tx[x], taps.ty[x], out);
+							else
+								FilterBilinear(panorama, taps.x[x], taps.y[x], taps.tx[x], taps.ty[x], out);
+						}
+					}
+				}
+			});
+		}
+
+		auto ToMilliseconds(std::chrono::steady_clock::duration duration) -> f64 {
+			return std::chrono::duration<f64, std::milli>(duration).count();
+		}
+	}
+
+	auto ConvertEquirectToCubemap(const EquirectImage& panorama, const EquirectConversionDesc& desc, EquirectConversionStats* stats) -> CubemapImage {
+		if (!panorama.IsValid()) {
+			Logger::Error("[EquirectConversion]: can't convert an empty or malformed panorama");
+			return {};
+		}
+
+		const auto start = std::chrono::steady_clock::now();
+
+		CubemapImage image;
+		image.size = desc.faceSize > 0 ? desc.faceSize : std::max(panorama.width / 4, 1u);
+		for (auto& face : image.faces)
+			face.resize(static_cast<u64>(image.size) * image.size * 4);
+
+		const SourceScale scale = {
+			.x = static_cast<f32>(panorama.width) / (2.0f * Pi),
+			.y = static_cast<f32>(panorama.height) / Pi,
+			.width = static_cast<f32>(panorama.width),
+			.height = static_cast<f32>(panorama.height)
+		};
+
+		if (desc.filter == EquirectFilter::Bicubic)
+			ConvertTiles<EquirectFilter::Bicubic>(panorama, scale, image);
+		else
+			ConvertTiles<EquirectFilter::Bilinear>(panorama, scale, image);
+
+		if (stats != nullptr)
+			*stats = EquirectConversionStats{ .texelCount = static_cast<u64>(image.size) * image.size * CubeFaceCount, .milliseconds = ToMilliseconds(std::chrono::steady_clock::now() - start) };
+
+		return image;
+	}
+}
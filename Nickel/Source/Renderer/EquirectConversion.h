@@ -0,0 +1,35 @@
+#pragma once
+
+#include "CubemapImage.h"
+#include <vector>
+
+// Import of equirectangular (latitude/longitude) panoramas into cube maps. Every output texel's direction is turned
+// into panorama coordinates and filtered there, 4 texels of a row at a time with SSE, rows of all faces spread over the
+// workers. Longitude wraps around the seam, latitude clamps at the poles. +X looks at the middle of the panorama,
+// +Y at its top row.
+namespace Nickel::Renderer {
+	struct EquirectImage {
+		u32 width = 0;
+		u32 height = 0;
+		std::vector<f32> texels; // NOTE: RGBA32F, rows top to bottom
+
+		inline auto IsValid() const -> bool { return width > 0 && height > 0 && texels.size() == static_cast<u64>(width) * height * 4; }
+	};
+
+	enum class EquirectFilter : u8 {
+		Bilinear,
+		Bicubic // NOTE: Catmull-Rom over 4x4 texels, sharper when the faces sample the panorama near 1:1
+	};
+
+	struct EquirectConversionDesc {
+		u32 faceSize = 0; // NOTE: 0 picks width / 4, the faces then match the panorama's resolution at the equator
+		EquirectFilter filter = EquirectFilter::Bilinear;
+	};
+
+	struct EquirectConversionStats {
+		u64 texelCount; // NOTE: cube map texels written
+		f64 milliseconds;
+	};
+
+	auto ConvertEquirectToCubemap(const EquirectImage& panorama, const EquirectConversionDesc& desc = {}, EquirectConversionStats* stats = nullptr) -> CubemapImage;
+}
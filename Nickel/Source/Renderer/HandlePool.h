@@ -0,0 +1,100 @@
+#pragma once
+
+#include "RendererTypes.h"
+#include <vector>
+
+namespace Nickel::Renderer {
+	// NOTE: handle id = generation << HandleIndexBits | slot index, slot 0 is never handed out so id 0 stays invalid
+	constexpr u32 HandleIndexBits = 20;
+	constexpr u32 HandleIndexMask = (1u << HandleIndexBits) - 1;
+	constexpr u32 HandleGenerationMask = (1u << (32 - HandleIndexBits)) - 1;
+
+	// Owns backend objects behind generational handles. A freed slot bumps its generation,
+	// so stale handles are detected instead of silently aliasing a newer object.
+	template <typename HandleT, typename T>
+	class HandlePool {
+	public:
+		auto Allocate(T value) -> HandleT {
+			u32 index;
+			if (!freeList.empty()) {
+				index = freeList.back();
+				freeList.pop_back();
+			} else {
+				index = static_cast<u32>(slots.size());
+				Assert(index <= HandleIndexMask);
+				slots.emplace_back();
+			}
+
+			auto& slot = slots[index];
+			slot.value = std::move(value);
+			slot.alive = true;
+			liveCount++;
+
+			return HandleT{ (slot.generation << HandleIndexBits) | index };
+		}
+
+		// NOTE: returns false for invalid or already freed handles
+		auto Free(HandleT handle) -> bool {
+			auto slot = Find(handle);
+			if (slot == nullptr)
+				return false;
+
+			slot->value = T{};
+			slot->alive = false;
+			slot->generation = (slot->generation + 1) & HandleGenerationMask;
+			if (slot->generation == 0)
+				slot->generation = 1;
+
+			freeList.push_back(handle.id & HandleIndexMask);
+			liveCount--;
+
+			return true;
+		}
+
+		inline auto IsAlive(HandleT handle) const -> bool { return Find(handle) != nullptr; }
+
+		inline auto Get(HandleT handle) -> T* {
+			auto slot = Find(handle);
+			return slot != nullptr ? &slot->value : nullptr;
+		}
+
+		inline auto Get(HandleT handle) const -> const T* {
+			auto slot = Find(handle);
+			return slot != nullptr ? &slot->value : nullptr;
+		}
+
+		inline auto LiveCount() const -> u32 { return liveCount; }
+
+		template <typename Fn>
+		auto ForEachAlive(Fn&& fn) -> void {
+			for (u32 i = 1; i < slots.size(); i++)
+				if (slots[i].alive)
+					fn(HandleT{ (slots[i].generation << HandleIndexBits) | i }, slots[i].value);
+		}
+
+	private:
+		struct Slot {
+			T value{};
+			u32 generation = 1;
+			bool alive = false;
+		};
+
+		auto Find(HandleT handle) const -> const Slot* {
+			const u32 index = handle.id & HandleIndexMask;
+			const u32 generation = handle.id >> HandleIndexBits;
+			if (index == 0 || index >= slots.size())
+				return nullptr;
+
+			const auto& slot = slots[index];
+			return slot.alive && slot.generation == generation ? &slot : nullptr;
+		}
+
+		inline auto Find(HandleT handle) -> Slot* {
+			return const_cast<Slot*>(static_cast<const HandlePool*>(this)->Find(handle));
+		}
+
+		std::vector<Slot> slots = std::vector<Slot>(1);
+		std::vector<u32> freeList;
+		u32 liveCount = 0;
+	};
+}
\ No newline at end of file
@@ -0,0 +1,478 @@
+#include "ImageDecoder.h"
+#include "../AssetArchive.h"
+#include "../Threading.h"
+#include "../stb/stb_image.h"
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <chrono>
+#include <climits>
+#include <cmath>
+#include <cstring>
+#include <mutex>
+#include <new>
+#include <vector>
+
+#if defined(_M_X64) || defined(__x86_64__)
+#define NICKEL_IMAGE_SSE 1
+#include <immintrin.h> // NOTE: SSE2 is part of x64, no runtime dispatch needed
+#endif
+
+namespace Nickel::Renderer {
+	namespace {
+		constexpr u64 MaxRetainedBytes = 256ull << 20; // NOTE: a startup's worth of RGBA8 4K textures
+		constexpr u32 MinRowsPerChunk = 32;
+
+		struct FreeBuffer {
+			u8* data;
+			u64 capacity;
+		};
+
+		struct BufferPool {
+			std::mutex mutex;
+			std::vector<FreeBuffer> buffers;
+			ImageBufferPoolStats stats{};
+
+			~BufferPool() {
+				for (const auto& buffer : buffers)
+					::operator delete(buffer.data, std::align_val_t{ 64 });
+			}
+		};
+
+		auto GetPool() -> BufferPool& {
+			static BufferPool pool;
+			return pool;
+		}
+
+		// NOTE: the smallest free buffer that fits without wasting more than half of it
+		auto AcquireBuffer(u64 size, u64& capacity) -> u8* {
+			auto& pool = GetPool();
+			{
+				std::lock_guard lock(pool.mutex);
+				auto best = pool.buffers.end();
+				for (auto it = pool.buffers.begin(); it != pool.buffers.end(); ++it) {
+					if (it->capacity >= size && it->capacity / 2 <= size && (best == pool.buffers.end() || it->capacity < best->capacity))
+						best = it;
+				}
+
+				if (best != pool.buffers.end()) {
+					const auto buffer = *best;
+					*best = pool.buffers.back();
+					pool.buffers.pop_back();
+					pool.stats.retainedBytes -= buffer.capacity;
+					pool.stats.reuses++;
+					capacity = buffer.capacity;
+					return buffer.data;
+				}
+
+				pool.stats.allocations++;
+			}
+
+			capacity = size;
+			return static_cast<u8*>(::operator new(size, std::align_val_t{ 64 }));
+		}
+
+		auto ReleaseBuffer(u8* data, u64 capacity) -> void {
+			auto& pool = GetPool();
+			{
+				std::lock_guard lock(pool.mutex);
+				if (pool.stats.retainedBytes + capacity <= MaxRetainedBytes) {
+					pool.buffers.push_back(FreeBuffer{ data, capacity });
+					pool.stats.retainedBytes += capacity;
+					return;
+				}
+			}
+
+			::operator delete(data, std::align_val_t{ 64 });
+		}
+
+		auto GetSRGBToLinearTable() -> const std::array<f32, 256>& {
+			static const std::array<f32, 256> table = []() {
+				std::array<f32, 256> result;
+				for (u32 i = 0; i < 256; i++) {
+					const f32 c = i / 255.0f;
+					result[i] = c <= 0.04045f ? c / 12.92f : std::pow((c + 0.055f) / 1.055f, 2.4f);
+				}
+				return result;
+			}();
+
+			return table;
+		}
+
+		// NOTE: gray, gray + alpha and RGB to RGBA, RGBA is copied
+		auto ToRGBA(const u8* source, u32 channels, u8* rgba, u32 count) -> void {
+			switch (channels) {
+				case 1:
+					for (u32 i = 0; i < count; i++) {
+						rgba[i * 4 + 0] = rgba[i * 4 + 1] = rgba[i * 4 + 2] = source[i];
+						rgba[i * 4 + 3] = 255;
+					}
+					break;
+				case 2:
+					for (u32 i = 0; i < count; i++) {
+						rgba[i * 4 + 0] = rgba[i * 4 + 1] = rgba[i * 4 + 2] = source[i * 2];
+						rgba[i * 4 + 3] = source[i * 2 + 1];
+					}
+					break;
+				case 3:
+					ExpandRGBToRGBA(source, rgba, count);
+					break;
+				default:
+					std::memcpy(rgba, source, static_cast<u64>(count) * 4);
+					break;
+			}
+		}
+
+		auto ToRGBA(const f32* source, u32 channels, f32* rgba, u32 count) -> void {
+			switch (channels) {
+				case 1:
+					for (u32 i = 0; i < count; i++) {
+						rgba[i * 4 + 0] = rgba[i * 4 + 1] = rgba[i * 4 + 2] = source[i];
+						rgba[i * 4 + 3] = 1.0f;
+					}
+					break;
+				case 2:
+					for (u32 i = 0; i < count; i++) {
+						rgba[i * 4 + 0] = rgba[i * 4 + 1] = rgba[i * 4 + 2] = source[i * 2];
+						rgba[i * 4 + 3] = source[i * 2 + 1];
+					}
+					break;
+				case 3:
+					ExpandRGBToRGBA(source, rgba, count);
+					break;
+				default:
+					std::memcpy(rgba, source, static_cast<u64>(count) * 4 * sizeof(f32));
+					break;
+			}
+		}
+
+		// NOTE: what stb_image returned, in the file's channel count. Exactly one of the pointers is set
+		struct SourceImage {
+			const u8* ldr;
+			const f32* hdr;
+			u32 channels;
+		};
+
+		auto ConvertRows(const SourceImage& source, DecodedImage& image, u32 begin, u32 end) -> void {
+			const u32 width = image.width;
+			const u64 sourcePitch = static_cast<u64>(width) * source.channels;
+			std::vector<u8> bytes;
+			std::vector<f32> floats;
+
+			for (u32 y = begin; y < end; y++) {
+				u8* destination = image.texels.Data() + static_cast<u64>(y) * image.GetRowPitch();
+
+				if (source.ldr != nullptr) {
+					const u8* row = source.ldr + y * sourcePitch;
+					if (image.format == TextureFormat::RGBA8_UNORM) {
+						ToRGBA(row, source.channels, destination, width);
+						continue;
+					}
+
+					const u8* rgba = row;
+					if (source.channels != 4) {
+						bytes.resize(static_cast<u64>(width) * 4);
+						ToRGBA(row, source.channels, bytes.data(), width);
+						rgba = bytes.data();
+					}
+
+					if (image.format == TextureFormat::RGBA32_FLOAT) {
+						ConvertSRGBToLinear(rgba, reinterpret_cast<f32*>(destination), width);
+					} else {
+						floats.resize(static_cast<u64>(width) * 4);
+						ConvertSRGBToLinear(rgba, floats.data(), width);
+						ConvertFloatToHalf(floats.data(), reinterpret_cast<u16*>(destination), static_cast<u64>(width) * 4);
+					}
+					continue;
+				}
+
+				const f32* row = source.hdr + y * sourcePitch;
+				if (image.format == TextureFormat::RGBA32_FLOAT) {
+					ToRGBA(row, source.channels, reinterpret_cast<f32*>(destination), width);
+					continue;
+				}
+
+				floats.resize(static_cast<u64>(width) * 4);
+				ToRGBA(row, source.channels, floats.data(), width);
+				if (image.format == TextureFormat::RGBA16_FLOAT) {
+					ConvertFloatToHalf(floats.data(), reinterpret_cast<u16*>(destination), static_cast<u64>(width) * 4);
+				} else {
+					for (u64 i = 0; i < floats.size(); i++)
+						destination[i] = static_cast<u8>(std::clamp(floats[i], 0.0f, 1.0f) * 255.0f + 0.5f);
+				}
+			}
+		}
+	}
+
+	ImageBuffer::ImageBuffer(u64 size) : size(size) {
+		data = AcquireBuffer(size, capacity);
+	}
+
+	ImageBuffer::~ImageBuffer() {
+		if (data != nullptr)
+			ReleaseBuffer(data, capacity);
+	}
+
+	ImageBuffer::ImageBuffer(ImageBuffer&& other) noexcept : data(other.data), size(other.size), capacity(other.capacity) {
+		other.data = nullptr;
+		other.size = other.capacity = 0;
+	}
+
+	auto ImageBuffer::operator=(ImageBuffer&& other) noexcept -> ImageBuffer& {
+		if (this != &other) {
+			if (data != nullptr)
+				ReleaseBuffer(data, capacity);
+
+			data = other.data;
+			size = other.size;
+			capacity = other.capacity;
+			other.data = nullptr;
+			other.size = other.capacity = 0;
+		}
+
+		return *this;
+	}
+
+	auto TrimImageBufferPool() -> void {
+		auto& pool = GetPool();
+		std::vector<FreeBuffer> buffers;
+		{
+			std::lock_guard lock(pool.mutex);
+			buffers.swap(pool.buffers);
+			pool.stats.retainedBytes = 0;
+		}
+
+		for (const auto& buffer : buffers)
+			::operator delete(buffer.data, std::align_val_t{ 64 });
+	}
+
+	auto GetImageBufferPoolStats() -> ImageBufferPoolStats {
+		auto& pool = GetPool();
+		std::lock_guard lock(pool.mutex);
+		return pool.stats;
+	}
+
+	auto DecodeImage(std::span<const u8> bytes, TextureFormat format, DecodedImage& image, const std::string& name) -> bool {
+		Assert(format == TextureFormat::RGBA8_UNORM || format == TextureFormat::RGBA16_FLOAT || format == TextureFormat::RGBA32_FLOAT);
+
+		image = {};
+		if (bytes.empty() || bytes.size() > INT_MAX) {
+			Logger::Error("[ImageDecoder]: " + name + " is empty or too large");
+			return false;
+		}
+
+		// NOTE: the failure reason and the flip flag are thread local in stb_image, the gamma settings aren't and
+		// only apply to LDR files loaded as floats or HDR files loaded as bytes, which never happens here
+		// NOTE: JPEGs are asked for RGBA, stb_image converts from YCbCr with SIMD only when it writes 4 channels and that
+		// pass does the expansion for free. Everything else comes in its own channel count and is expanded here
+		const auto length = static_cast<i32>(bytes.size());
+		const bool hdr = stbi_is_hdr_from_memory(bytes.data(), length) != 0;
+		const bool jpeg = bytes.size() >= 2 && bytes[0] == 0xFF && bytes[1] == 0xD8;
+		i32 width, height, channels;
+		void* pixels = hdr
+			? static_cast<void*>(stbi_loadf_from_memory(bytes.data(), length, &width, &height, &channels, 0))
+			: static_cast<void*>(stbi_load_from_memory(bytes.data(), length, &width, &height, &channels, jpeg ? STBI_rgb_alpha : 0));
+		if (pixels == nullptr) {
+			Logger::Error("[ImageDecoder]: failed to decode " + name + ": " + stbi_failure_reason());
+			return false;
+		}
+
+		image.width = static_cast<u32>(width);
+		image.height = static_cast<u32>(height);
+		image.sourceChannels = static_cast<u32>(channels);
+		image.hdr = hdr;
+		image.format = format;
+		image.texels = ImageBuffer(static_cast<u64>(image.GetRowPitch()) * image.height);
+
+		const auto source = SourceImage{
+			.ldr = hdr ? nullptr : static_cast<const u8*>(pixels),
+			.hdr = hdr ? static_cast<const f32*>(pixels) : nullptr,
+			.channels = jpeg ? 4u : image.sourceChannels
+		};
+		const u32 chunkCount = std::min(GetWorkerCount(), std::max(image.height / MinRowsPerChunk, 1u));
+		ParallelForChunks(image.height, chunkCount, [&](u32, u32 begin, u32 end) {
+			ConvertRows(source, image, begin, end);
+		});
+
+		stbi_image_free(pixels);
+		return true;
+	}
+
+	auto DecodeImage(const std::string& path, TextureFormat format, DecodedImage& image) -> bool {
+		AssetData file;
+		if (!ReadAsset(path, file)) {
+			image = {};
+			return false;
+		}
+
+		return DecodeImage(file.bytes, format, image, path);
+	}
+
+	auto DecodeImages(std::span<const std::string> paths, TextureFormat format, std::span<DecodedImage> images, ImageDecodeStats* stats) -> bool {
+		Assert(images.size() >= paths.size());
+		const auto start = std::chrono::steady_clock::now();
+
+		// NOTE: one job per file, a file's rows fan out again inside DecodeImage so a single large image still uses
+		// every worker
+		std::atomic<u32> failed = 0;
+		std::atomic<u64> sourceBytes = 0, decodeMicroseconds = 0;
+		const u32 count = static_cast<u32>(paths.size());
+		if (count > 0) {
+			ParallelForChunks(count, count, [&](u32, u32 begin, u32 end) {
+				for (u32 i = begin; i < end; i++) {
+					const auto imageStart = std::chrono::steady_clock::now();
+					AssetData file;
+					const bool decoded = ReadAsset(paths[i], file) && DecodeImage(file.bytes, format, images[i], paths[i]);
+					if (!decoded) {
+						images[i] = {};
+						failed.fetch_add(1, std::memory_order_relaxed);
+						continue;
+					}
+
+					sourceBytes.fetch_add(file.bytes.size(), std::memory_order_relaxed);
+					decodeMicroseconds.fetch_add(std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - imageStart).count(), std::memory_order_relaxed);
+				}
+			});
+		}
+
+		if (stats != nullptr) {
+			u64 decodedBytes = 0;
+			for (u32 i = 0; i < count; i++)
+				decodedBytes += images[i].texels.Size();
+
+			*stats = ImageDecodeStats{
+				.decoded = count - failed.load(),
+				.failed = failed.load(),
+				.sourceBytes = sourceBytes.load(),
+				.decodedBytes = decodedBytes,
+				.milliseconds = std::chrono::duration<f64, std::milli>(std::chrono::steady_clock::now() - start).count(),
+				.decodeMilliseconds = static_cast<f64>(decodeMicroseconds.load()) / 1000.0
+			};
+		}
+
+		return failed.load() == 0;
+	}
+
+	auto ExpandRGBToRGBA(const u8* rgb, u8* rgba, u64 count) -> void {
+		u64 i = 0;
+#if defined(NICKEL_IMAGE_SSE)
+		// NOTE: four texels per step from one 16 byte load, each texel is the low dword of the load shifted by 3
+		// bytes, its fourth byte (the next texel's red) is replaced by the alpha. The load reads 4 bytes past the
+		// fourth texel, the last texels go through the scalar loop so it never reads past 'rgb'
+		const __m128i colorMask = _mm_set1_epi32(0x00FFFFFF);
+		const __m128i alpha = _mm_set1_epi32(static_cast<i32>(0xFF000000u));
+		for (; i + 6 <= count; i += 4) {
+			const __m128i texels = _mm_loadu_si128(reinterpret_cast<const __m128i*>(rgb + i * 3));
+			const __m128i first = _mm_unpacklo_epi32(texels, _mm_srli_si128(texels, 3));
+			const __m128i second = _mm_unpacklo_epi32(_mm_srli_si128(texels, 6), _mm_srli_si128(texels, 9));
+			const __m128i expanded = _mm_or_si128(_mm_and_si128(_mm_unpacklo_epi64(first, second), colorMask), alpha);
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(rgba + i * 4), expanded);
+		}
+#endif
+		for (; i < count; i++) {
+			rgba[i * 4 + 0] = rgb[i * 3 + 0];
+			rgba[i * 4 + 1] = rgb[i * 3 + 1];
+			rgba[i * 4 + 2] = rgb[i * 3 + 2];
+			rgba[i * 4 + 3] = 255;
+		}
+	}
+
+	auto ExpandRGBToRGBA(const f32* rgb, f32* rgba, u64 count) -> void {
+		u64 i = 0;
+#if defined(NICKEL_IMAGE_SSE)
+		// NOTE: a texel per step, the load takes the next texel's red along and it's replaced by 1. The last texel
+		// goes through the scalar loop
+		const __m128 colorMask = _mm_castsi128_ps(_mm_setr_epi32(-1, -1, -1, 0));
+		const __m128 alpha = _mm_setr_ps(0.0f, 0.0f, 0.0f, 1.0f);
+		for (; i + 1 < count; i++)
+			_mm_storeu_ps(rgba + i * 4, _mm_or_ps(_mm_and_ps(_mm_loadu_ps(rgb + i * 3), colorMask), alpha));
+#endif
+		for (; i < count; i++) {
+			rgba[i * 4 + 0] = rgb[i * 3 + 0];
+			rgba[i * 4 + 1] = rgb[i * 3 + 1];
+			rgba[i * 4 + 2] = rgb[i * 3 + 2];
+			rgba[i * 4 + 3] = 1.0f;
+		}
+	}
+
+	auto ConvertSRGBToLinear(const u8* rgba, f32* linear, u64 count) -> void {
+		// NOTE: a table beats evaluating the curve with SIMD, SSE2 has no gather so this stays scalar
+		const auto& table = GetSRGBToLinearTable();
+		for (u64 i = 0; i < count; i++) {
+			linear[i * 4 + 0] = table[rgba[i * 4 + 0]];
+			linear[i * 4 + 1] = table[rgba[i * 4 + 1]];
+			linear[i * 4 + 2] = table[rgba[i * 4 + 2]];
+			linear[i * 4 + 3] = rgba[i * 4 + 3] / 255.0f;
+		}
+	}
+
+	auto FloatToHalf(f32 value) -> u16 {
+		const u32 bits = std::bit_cast<u32>(value);
+		const u32 sign = (bits >> 16) & 0x8000u;
+		const u32 magnitude = bits & 0x7FFFFFFFu;
+
+		if (magnitude > 0x7F800000u)
+			return static_cast<u16>(sign | 0x7E00u); // NOTE: NaN
+		if (magnitude >= 0x477FF000u)
+			return static_cast<u16>(sign | 0x7BFFu);
+		if (magnitude < 0x33000000u)
+			return static_cast<u16>(sign);
+
+		if (magnitude < 0x38800000u) { // NOTE: below the smallest normal half, the result is denormal
+			const u32 exponent = magnitude >> 23;
+			const u32 mantissa = (magnitude & 0x7FFFFFu) | 0x800000u;
+			const u32 shift = 126 - exponent;
+			u32 half = mantissa >> shift;
+			const u32 remainder = mantissa & ((1u << shift) - 1);
+			const u32 halfway = 1u << (shift - 1);
+			if (remainder > halfway || (remainder == halfway && (half & 1)))
+				half++;
+			return static_cast<u16>(sign | half);
+		}
+
+		u32 half = (magnitude - 0x38000000u) >> 13; // NOTE: rebias the exponent from 127 to 15
+		const u32 remainder = magnitude & 0x1FFFu;
+		if (remainder > 0x1000u || (remainder == 0x1000u && (half & 1)))
+			half++;
+		return static_cast<u16>(sign | half);
+	}
+
+	auto ConvertFloatToHalf(const f32* values, u16* halves, u64 count) -> void {
+		u64 i = 0;
+#if defined(NICKEL_IMAGE_SSE)
+		// NOTE: the same rules as FloatToHalf, every case computed and the right one selected per lane. Normals round
+		// to nearest even by adding 0xFFF plus the lowest kept bit before truncating, denormals by adding a float
+		// whose exponent puts the half's lowest bit at the float's, which the FPU rounds to nearest even
+		const __m128i one = _mm_set1_epi32(1);
+		const __m128i rebias = _mm_set1_epi32(static_cast<i32>(0xC8000FFFu)); // NOTE: (15 - 127) << 23, plus 0xFFF
+		const __m128i magic = _mm_set1_epi32(((127 - 15) + (23 - 10) + 1) << 23);
+		const __m128i smallestNormal = _mm_set1_epi32(0x38800000);
+		const __m128i largest = _mm_set1_epi32(0x477FEFFF);
+		const __m128i infinity = _mm_set1_epi32(0x7F800000);
+		for (; i + 4 <= count; i += 4) {
+			const __m128i bits = _mm_castps_si128(_mm_loadu_ps(values + i));
+			const __m128i sign = _mm_and_si128(_mm_srli_epi32(bits, 16), _mm_set1_epi32(0x8000));
+			const __m128i magnitude = _mm_and_si128(bits, _mm_set1_epi32(0x7FFFFFFF));
+
+			const __m128i odd = _mm_and_si128(_mm_srli_epi32(magnitude, 13), one);
+			const __m128i normal = _mm_srli_epi32(_mm_add_epi32(_mm_add_epi32(magnitude, rebias), odd), 13);
+			const __m128i denormal = _mm_sub_epi32(_mm_castps_si128(_mm_add_ps(_mm_castsi128_ps(magnitude), _mm_castsi128_ps(magic))), magic);
+
+			const __m128i isDenormal = _mm_cmplt_epi32(magnitude, smallestNormal);
+			const __m128i isLarge = _mm_cmpgt_epi32(magnitude, largest);
+			const __m128i isNaN = _mm_cmpgt_epi32(magnitude, infinity);
+			__m128i half = _mm_or_si128(_mm_and_si128(isDenormal, denormal), _mm_andnot_si128(isDenormal, normal));
+			half = _mm_or_si128(_mm_and_si128(isLarge, _mm_set1_epi32(0x7BFF)), _mm_andnot_si128(isLarge, half));
+			half = _mm_or_si128(_mm_and_si128(isNaN, _mm_set1_epi32(0x7E00)), _mm_andnot_si128(isNaN, half));
+			half = _mm_or_si128(half, sign);
+
+			// NOTE: sign extended from 16 bits so the saturating pack keeps the bits as they are
+			half = _mm_srai_epi32(_mm_slli_epi32(half, 16), 16);
+			_mm_storel_epi64(reinterpret_cast<__m128i*>(halves + i), _mm_packs_epi32(half, half));
+		}
+#endif
+		for (; i < count; i++)
+			halves[i] = FloatToHalf(values[i]);
+	}
+}
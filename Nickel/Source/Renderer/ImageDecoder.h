@@ -0,0 +1,82 @@
+#pragma once
+
+#include "RendererTypes.h"
+#include <span>
+#include <string>
+
+// Image decoding that's safe on any thread. stb_image is only called through its from-memory functions with the
+// file's own channel count, so nothing reads or writes its global settings (the HDR/LDR gamma), and the files come
+// through ReadAsset, mapped or out of the asset archive instead of read. The conversion to what's asked for (RGB to
+// RGBA, sRGB bytes to linear floats, floats to halves) is done here over rows in parallel, with SSE2 where the target
+// has it. Texels land in buffers from a pool shared by every decode, so a burst of loads at startup reuses the same
+// few allocations instead of faulting in fresh pages for each image.
+namespace Nickel::Renderer {
+	// NOTE: texels of a decoded image, given back to the pool on destruction
+	class ImageBuffer {
+	public:
+		ImageBuffer() = default;
+		explicit ImageBuffer(u64 size);
+		~ImageBuffer();
+
+		ImageBuffer(const ImageBuffer&) = delete;
+		auto operator=(const ImageBuffer&) -> ImageBuffer& = delete;
+		ImageBuffer(ImageBuffer&& other) noexcept;
+		auto operator=(ImageBuffer&& other) noexcept -> ImageBuffer&;
+
+		inline auto Data() const -> u8* { return data; }
+		inline auto Size() const -> u64 { return size; }
+
+	private:
+		u8* data = nullptr;
+		u64 size = 0;
+		u64 capacity = 0;
+	};
+
+	struct ImageBufferPoolStats {
+		u64 allocations; // NOTE: buffers the pool had to allocate, the rest were reused
+		u64 reuses;
+		u64 retainedBytes; // NOTE: free buffers kept for the next decode
+	};
+
+	// NOTE: frees the buffers the pool keeps, call once a batch of loads is done
+	auto TrimImageBufferPool() -> void;
+	auto GetImageBufferPoolStats() -> ImageBufferPoolStats;
+
+	struct DecodedImage {
+		u32 width = 0;
+		u32 height = 0;
+		u32 sourceChannels = 0; // NOTE: in the file, the texels are always RGBA
+		bool hdr = false; // NOTE: the file stores floats (Radiance HDR)
+		TextureFormat format = TextureFormat::RGBA8_UNORM;
+		ImageBuffer texels; // NOTE: tightly packed rows
+
+		inline auto IsValid() const -> bool { return texels.Data() != nullptr; }
+		inline auto GetRowPitch() const -> u32 { return width * GetTexelSize(format); }
+	};
+
+	struct ImageDecodeStats {
+		u32 decoded;
+		u32 failed;
+		u64 sourceBytes;
+		u64 decodedBytes;
+		f64 milliseconds; // NOTE: wall clock for the whole batch
+		f64 decodeMilliseconds; // NOTE: summed over the images, above the wall clock time when they ran in parallel
+	};
+
+	// NOTE: 'format' is RGBA8_UNORM, RGBA16_FLOAT or RGBA32_FLOAT. LDR files asked for as floats are converted from
+	// sRGB to linear, HDR files asked for as RGBA8 are clamped to [0, 1]. Logs and returns false on failure
+	auto DecodeImage(std::span<const u8> bytes, TextureFormat format, DecodedImage& image, const std::string& name = "image") -> bool;
+	auto DecodeImage(const std::string& path, TextureFormat format, DecodedImage& image) -> bool;
+	// NOTE: every file at once on the job system, false when any failed, the others are decoded anyway
+	auto DecodeImages(std::span<const std::string> paths, TextureFormat format, std::span<DecodedImage> images, ImageDecodeStats* stats = nullptr) -> bool;
+
+	// NOTE: the conversion kernels, 'count' texels each. Exposed for the loaders that already hold texels
+	auto ExpandRGBToRGBA(const u8* rgb, u8* rgba, u64 count) -> void;
+	auto ExpandRGBToRGBA(const f32* rgb, f32* rgba, u64 count) -> void;
+	auto ConvertSRGBToLinear(const u8* rgba, f32* linear, u64 count) -> void; // NOTE: alpha is linear already
+
+	// NOTE: round to nearest even, saturates at the largest half instead of overflowing to infinity, a hot sun texel
+	// would otherwise turn every mip it's filtered into into infinities. NaN stays NaN
+	auto FloatToHalf(f32 value) -> u16;
+	auto ConvertFloatToHalf(const f32* values, u16* halves, u64 count) -> void; // NOTE: 'count' floats, not texels
+}
@@ -0,0 +1,144 @@
+#include "MaterialSystem.h"
+#include <algorithm>
+
+namespace Nickel::Renderer {
+	auto MaterialSystem::CreateTemplate(const PlatformInterface& gfx, PipelineCache& pipelineCache, const MaterialTemplateDesc& desc) -> MaterialTemplateHandle {
+		if (desc.parameterSize % 16 != 0 || desc.textureCount > MaxBindSlots) {
+			Logger::Error("[MaterialSystem]: template parameter size has to be a multiple of 16 and textures have to fit the bind slots");
+			return {};
+		}
+
+		const auto pipeline = pipelineCache.AcquirePipeline(gfx, desc.pipeline);
+		if (!pipeline.IsValid())
+			return {};
+
+		return templates.Allocate(Template{
+			.pipeline = pipeline,
+			.parameterStage = desc.parameterStage,
+			.parameterSlot = desc.parameterSlot,
+			.parameterSize = desc.parameterSize,
+			.textureCount = desc.textureCount
+		});
+	}
+
+	auto MaterialSystem::CreateInstance(const PlatformInterface& gfx, const MaterialInstanceDesc& desc) -> MaterialHandle {
+		const auto materialTemplate = templates.Get(desc.materialTemplate);
+		if (materialTemplate == nullptr) {
+			Logger::Error("[MaterialSystem]: instance created from a destroyed or unknown template");
+			return {};
+		}
+
+		if (desc.textures.size() != materialTemplate->textureCount) {
+			Logger::Error("[MaterialSystem]: instance texture count doesn't match its template");
+			return {};
+		}
+
+		auto instance = Instance{
+			.materialTemplate = desc.materialTemplate,
+			.pipeline = materialTemplate->pipeline,
+			.parameterStage = materialTemplate->parameterStage,
+			.parameterSlot = materialTemplate->parameterSlot,
+			.dirty = false
+		};
+
+		if (!desc.textures.empty()) {
+			instance.textures.assign(desc.textures.begin(), desc.textures.end());
+			instance.samplers.assign(desc.samplers.begin(), desc.samplers.end());
+			instance.textureTable = gfx.CreateTextureTable(TextureTableDesc{ .textures = instance.textures, .samplers = instance.samplers });
+		}
+
+		if (materialTemplate->parameterSize > 0) {
+			instance.parameters = std::vector<u8>(materialTemplate->parameterSize);
+			if (desc.parameters != nullptr)
+				std::memcpy(instance.parameters.data(), desc.parameters, materialTemplate->parameterSize);
+
+			instance.parameterBuffer = gfx.CreateBuffer(BufferDesc{ .type = BufferType::Constant, .size = materialTemplate->parameterSize }, instance.parameters.data());
+		}
+
+		return instances.Allocate(std::move(instance));
+	}
+
+	auto MaterialSystem::DestroyInstance(const PlatformInterface& gfx, MaterialHandle material) -> void {
+		auto instance = instances.Get(material);
+		if (instance == nullptr) {
+			Logger::Error("[MaterialSystem]: destroying a destroyed or unknown material");
+			return;
+		}
+
+		if (instance->textureTable.IsValid())
+			gfx.DestroyTextureTable(instance->textureTable);
+		if (instance->parameterBuffer.IsValid())
+			gfx.DestroyBuffer(instance->parameterBuffer);
+
+		std::erase(dirtyInstances, material);
+		instances.Free(material);
+	}
+
+	auto MaterialSystem::SetParameters(MaterialHandle material, const void* data, u32 size) -> void {
+		auto instance = instances.Get(material);
+		Assert(instance != nullptr);
+		Assert(size == instance->parameters.size());
+
+		if (std::memcmp(instance->parameters.data(), data, size) == 0)
+			return;
+
+		std::memcpy(instance->parameters.data(), data, size);
+		if (!instance->dirty) {
+			instance->dirty = true;
+			dirtyInstances.push_back(material);
+		}
+	}
+
+	auto MaterialSystem::ReplaceTexture(const PlatformInterface& gfx, TextureHandle from, TextureHandle to) -> u32 {
+		u32 replaced = 0;
+		instances.ForEachAlive([&](MaterialHandle, Instance& instance) {
+			if (std::find(instance.textures.begin(), instance.textures.end(), from) == instance.textures.end())
+				return;
+
+			std::replace(instance.textures.begin(), instance.textures.end(), from, to);
+			gfx.DestroyTextureTable(instance.textureTable);
+			instance.textureTable = gfx.CreateTextureTable(TextureTableDesc{ .textures = instance.textures, .samplers = instance.samplers });
+			replaced++;
+		});
+
+		return replaced;
+	}
+
+	auto MaterialSystem::UploadDirty(const PlatformInterface& gfx) -> u32 {
+		const u32 uploads = static_cast<u32>(dirtyInstances.size());
+		for (const auto material : dirtyInstances) {
+			auto instance = instances.Get(material);
+			gfx.UpdateBuffer(instance->parameterBuffer, instance->parameters.data(), static_cast<u32>(instance->parameters.size()));
+			instance->dirty = false;
+		}
+
+		dirtyInstances.clear();
+		return uploads;
+	}
+
+	auto MaterialSystem::Bind(CommandList& list, MaterialHandle material) const -> void {
+		const auto instance = instances.Get(material);
+		Assert(instance != nullptr);
+
+		list.SetPipeline(instance->pipeline);
+		if (instance->textureTable.IsValid())
+			list.SetTextureTable(ShaderStage::Pixel, instance->textureTable);
+		if (instance->parameterBuffer.IsValid())
+			list.SetConstantBuffer(instance->parameterStage, instance->parameterSlot, instance->parameterBuffer);
+	}
+
+	auto MaterialSystem::Release(const PlatformInterface& gfx, PipelineCache& pipelineCache) -> void {
+		instances.ForEachAlive([&](MaterialHandle, Instance& instance) {
+			if (instance.textureTable.IsValid())
+				gfx.DestroyTextureTable(instance.textureTable);
+			if (instance.parameterBuffer.IsValid())
+				gfx.DestroyBuffer(instance.parameterBuffer);
+		});
+
+		templates.ForEachAlive([&](MaterialTemplateHandle, Template& materialTemplate) {
+			pipelineCache.Release(gfx, materialTemplate.pipeline);
+		});
+
+		*this = MaterialSystem{};
+	}
+}
\ No newline at end of file
@@ -0,0 +1,81 @@
+#pragma once
+
+#include "PipelineCache.h"
+#include "HandlePool.h"
+#include <vector>
+
+namespace Nickel::Renderer {
+	using MaterialTemplateHandle = Handle<struct MaterialTemplateTag>;
+	using MaterialHandle         = Handle<struct MaterialTag>;
+
+	// NOTE: what every instance of a material shares - the pipeline and the shape of its parameters and textures
+	struct MaterialTemplateDesc {
+		PipelineStateDesc pipeline;
+		ShaderStage parameterStage = ShaderStage::Pixel;
+		u32 parameterSlot = 3;  // NOTE: slots below are the renderer's per application/frame/object buffers
+		u32 parameterSize = 0;  // NOTE: bytes, multiple of 16, 0 for templates without parameters
+		u32 textureCount = 0;   // NOTE: instances have to provide exactly this many textures
+	};
+
+	struct MaterialInstanceDesc {
+		MaterialTemplateHandle materialTemplate;
+		std::span<const TextureHandle> textures;  // NOTE: pixel shader slots [0, textureCount)
+		std::span<const SamplerHandle> samplers;
+		const void* parameters = nullptr;          // NOTE: initial parameter block, parameterSize bytes, zeroed when null
+	};
+
+	// Materials are split into templates and instances. An instance owns an immutable texture table and a
+	// parameter block that only reaches the GPU when it changed, so binding a material in a draw is the pipeline,
+	// one table and one constant buffer no matter how many textures it has. Meshes reference instances by handle.
+	class MaterialSystem {
+	public:
+		auto CreateTemplate(const PlatformInterface& gfx, PipelineCache& pipelineCache, const MaterialTemplateDesc& desc) -> MaterialTemplateHandle;
+		auto CreateInstance(const PlatformInterface& gfx, const MaterialInstanceDesc& desc) -> MaterialHandle;
+		auto DestroyInstance(const PlatformInterface& gfx, MaterialHandle material) -> void;
+
+		// NOTE: only marks the instance dirty when the bytes actually differ from the current block
+		auto SetParameters(MaterialHandle material, const void* data, u32 size) -> void;
+
+		template <typename T>
+		inline auto SetParameters(MaterialHandle material, const T& parameters) -> void {
+			SetParameters(material, std::addressof(parameters), sizeof(T));
+		}
+
+		// NOTE: swaps a texture for another in every instance that binds it and rebuilds their tables, for placeholders
+		// whose data finished loading. Returns the number of instances touched
+		auto ReplaceTexture(const PlatformInterface& gfx, TextureHandle from, TextureHandle to) -> u32;
+
+		auto UploadDirty(const PlatformInterface& gfx) -> u32; // NOTE: once per frame before recording, returns the number of uploads
+		auto Bind(CommandList& list, MaterialHandle material) const -> void; // NOTE: read-only, safe from recording workers
+
+		inline auto IsValid(MaterialHandle material) const -> bool { return instances.IsAlive(material); }
+
+		auto Release(const PlatformInterface& gfx, PipelineCache& pipelineCache) -> void; // NOTE: destroys all instances and templates
+
+	private:
+		struct Template {
+			PipelineHandle pipeline;
+			ShaderStage parameterStage;
+			u32 parameterSlot;
+			u32 parameterSize;
+			u32 textureCount;
+		};
+
+		struct Instance {
+			MaterialTemplateHandle materialTemplate;
+			PipelineHandle pipeline; // NOTE: copied from the template so Bind needs a single lookup
+			TextureTableHandle textureTable;
+			std::vector<TextureHandle> textures; // NOTE: what the table was built from, kept to rebuild it
+			std::vector<SamplerHandle> samplers;
+			BufferHandle parameterBuffer;
+			ShaderStage parameterStage;
+			u32 parameterSlot;
+			std::vector<u8> parameters; // NOTE: CPU copy of the block, compared against on SetParameters
+			bool dirty;
+		};
+
+		HandlePool<MaterialTemplateHandle, Template> templates;
+		HandlePool<MaterialHandle, Instance> instances;
+		std::vector<MaterialHandle> dirtyInstances;
+	};
+}
\ No newline at end of file
@@ -0,0 +1,634 @@
+#include "NullCore.h"
+#include "../HandlePool.h"
+#include <bit>
+
+namespace Nickel::Renderer::Null::Core {
+	namespace {
+		struct NullTexture {
+			TextureDesc desc;
+			u64 size;
+		};
+
+		struct NullTextureTable {
+			std::vector<TextureHandle> textures;
+			std::vector<SamplerHandle> samplers;
+		};
+
+		struct NullProgram {
+			u64 vertexShaderSize;
+			u64 pixelShaderSize;
+		};
+
+		struct CoreState {
+			HandlePool<BufferHandle, BufferDesc> buffers;
+			HandlePool<TextureHandle, NullTexture> textures;
+			HandlePool<SamplerHandle, SamplerDesc> samplers;
+			HandlePool<TextureTableHandle, NullTextureTable> textureTables;
+			HandlePool<ProgramHandle, NullProgram> programs;
+			HandlePool<PipelineHandle, PipelineDesc> pipelines;
+			HandlePool<RasterizerStateHandle, RasterizerDesc> rasterizerStates;
+			HandlePool<DepthStencilStateHandle, DepthStencilDesc> depthStencilStates;
+			HandlePool<RenderTargetHandle, RenderTargetDesc> renderTargets;
+			HandlePool<DepthTargetHandle, DepthTargetDesc> depthTargets;
+
+			RenderTargetHandle backbuffer;
+			bool initialized = false;
+
+			Stats stats{};
+		};
+
+		CoreState core;
+
+		constexpr u32 MaxConstantBufferSize = 64 * 1024;
+		constexpr u32 MaxConstantBufferSlots = 14;
+
+		auto Fail(const std::string& message) -> void {
+			core.stats.validationErrors++;
+			Logger::Error("[Null]: " + message);
+		}
+
+		auto CalculateTextureSize(const TextureDesc& desc) -> u64 {
+			u64 size = 0;
+			for (u32 mip = 0; mip < desc.mipLevels; mip++) {
+				const u64 rowPitch = GetRowPitch(desc.format, std::max(1u, desc.width >> mip));
+				size += rowPitch * GetRowCount(desc.format, std::max(1u, desc.height >> mip));
+			}
+
+			return size * desc.arraySize;
+		}
+
+		auto CountPrimitives(PrimitiveTopology topology, u32 vertexCount) -> u32 {
+			switch (topology) {
+				case PrimitiveTopology::TriangleList:  return vertexCount / 3;
+				case PrimitiveTopology::TriangleStrip: return vertexCount >= 3 ? vertexCount - 2 : 0;
+				case PrimitiveTopology::LineList:      return vertexCount / 2;
+				case PrimitiveTopology::LineStrip:     return vertexCount >= 2 ? vertexCount - 1 : 0;
+				case PrimitiveTopology::PointList:     return vertexCount;
+			}
+
+			return 0;
+		}
+
+		auto UpdateLiveCounts() -> void {
+			auto& s = core.stats;
+			s.liveBuffers            = core.buffers.LiveCount();
+			s.liveTextures           = core.textures.LiveCount();
+			s.liveSamplers           = core.samplers.LiveCount();
+			s.liveTextureTables      = core.textureTables.LiveCount();
+			s.livePrograms           = core.programs.LiveCount();
+			s.livePipelines          = core.pipelines.LiveCount();
+			s.liveRasterizerStates   = core.rasterizerStates.LiveCount();
+			s.liveDepthStencilStates = core.depthStencilStates.LiveCount();
+			s.liveRenderTargets      = core.renderTargets.LiveCount() - (core.backbuffer.IsValid() ? 1 : 0);
+			s.liveDepthTargets       = core.depthTargets.LiveCount();
+		}
+
+		template <typename HandleT, typename T>
+		auto Release(HandlePool<HandleT, T>& pool, HandleT handle, const char* what) -> void {
+			if (!pool.Free(handle))
+				Fail(std::string("destroying invalid or already destroyed ") + what);
+
+			UpdateLiveCounts();
+		}
+
+		// NOTE: mirrors the state a real context would have while the list is replayed, command lists start with cleared state
+		struct Validator {
+			FrameStats& frame;
+
+			ProgramHandle program;
+			BufferHandle vertexBuffer;
+			BufferHandle indexBuffer;
+			IndexFormat indexFormat = IndexFormat::U32;
+			u32 indexOffset = 0;
+			PrimitiveTopology topology = PrimitiveTopology::TriangleList;
+			bool hasTarget = false;
+			bool hasViewport = false;
+
+			template <typename HandleT, typename T>
+			auto Check(const HandlePool<HandleT, T>& pool, HandleT handle, const char* what) -> bool {
+				if (!handle.IsValid())
+					return true; // NOTE: binding null is allowed and unbinds the slot
+
+				if (!pool.IsAlive(handle)) {
+					Fail(std::string("command references a destroyed or unknown ") + what);
+					return false;
+				}
+
+				return true;
+			}
+
+			auto operator()(const CmdSetRenderTarget& cmd) -> void {
+				frame.stateChanges++;
+				const bool colorValid = Check(core.renderTargets, cmd.color, "render target");
+				const bool depthValid = Check(core.depthTargets, cmd.depth, "depth target");
+				hasTarget = (cmd.color.IsValid() && colorValid) || (cmd.depth.IsValid() && depthValid);
+
+				const auto color = colorValid ? core.renderTargets.Get(cmd.color) : nullptr;
+				const auto depth = depthValid ? core.depthTargets.Get(cmd.depth) : nullptr;
+				if (color != nullptr && depth != nullptr) {
+					if (color->width != depth->width || color->height != depth->height)
+						Fail("render target and depth target sizes differ");
+					if (color->sampleCount != std::max(1u, depth->sampleCount))
+						Fail("render target and depth target sample counts differ");
+				}
+			}
+
+			auto operator()(const CmdSetViewport& cmd) -> void {
+				frame.stateChanges++;
+				const auto& v = cmd.viewport;
+				if (v.width <= 0.0f || v.height <= 0.0f || v.minDepth < 0.0f || v.maxDepth > 1.0f || v.minDepth > v.maxDepth)
+					Fail("invalid viewport");
+
+				hasViewport = true;
+			}
+
+			auto operator()(const CmdClear&) -> void {
+				frame.clears++;
+				if (!hasTarget)
+					Fail("clear without a render target bound");
+			}
+
+			auto operator()(const CmdSetProgram& cmd) -> void {
+				frame.stateChanges++;
+				program = Check(core.programs, cmd.program, "program") ? cmd.program : ProgramHandle{};
+			}
+
+			auto operator()(const CmdSetPipeline& cmd) -> void {
+				frame.stateChanges++;
+				program = {};
+				if (!Check(core.pipelines, cmd.pipeline, "pipeline") || !cmd.pipeline.IsValid())
+					return;
+
+				// NOTE: backends keep the pipeline's states alive, only the program has to outlive it
+				const auto& desc = *core.pipelines.Get(cmd.pipeline);
+				program = Check(core.programs, desc.program, "program") ? desc.program : ProgramHandle{};
+			}
+
+			auto operator()(const CmdSetRasterizerState& cmd) -> void {
+				frame.stateChanges++;
+				Check(core.rasterizerStates, cmd.state, "rasterizer state");
+			}
+
+			auto operator()(const CmdSetDepthStencilState& cmd) -> void {
+				frame.stateChanges++;
+				Check(core.depthStencilStates, cmd.state, "depth stencil state");
+			}
+
+			auto operator()(const CmdSetTopology& cmd) -> void {
+				frame.stateChanges++;
+				topology = cmd.topology;
+			}
+
+			auto operator()(const CmdSetVertexBuffer& cmd) -> void {
+				frame.stateChanges++;
+				vertexBuffer = {};
+				if (!Check(core.buffers, cmd.buffer, "vertex buffer") || !cmd.buffer.IsValid())
+					return;
+
+				const auto& desc = *core.buffers.Get(cmd.buffer);
+				if (desc.type != BufferType::Vertex)
+					Fail("buffer bound as vertex buffer was not created as one");
+				else if (desc.stride != 0 && desc.stride != cmd.stride)
+					Fail("vertex buffer bound with a stride that differs from its creation stride");
+
+				vertexBuffer = cmd.buffer;
+			}
+
+			auto operator()(const CmdSetIndexBuffer& cmd) -> void {
+				frame.stateChanges++;
+				indexBuffer = {};
+				if (!Check(core.buffers, cmd.buffer, "index buffer") || !cmd.buffer.IsValid())
+					return;
+
+				if (core.buffers.Get(cmd.buffer)->type != BufferType::Index)
+					Fail("buffer bound as index buffer was not created as one");
+
+				indexBuffer = cmd.buffer;
+				indexFormat = cmd.format;
+				indexOffset = cmd.offset;
+			}
+
+			auto operator()(const CmdSetTextures&, std::span<const TextureHandle> textures) -> void {
+				frame.stateChanges++;
+				for (const auto& texture : textures)
+					Check(core.textures, texture, "texture");
+			}
+
+			auto operator()(const CmdSetSamplers&, std::span<const SamplerHandle> samplers) -> void {
+				frame.stateChanges++;
+				for (const auto& sampler : samplers)
+					Check(core.samplers, sampler, "sampler");
+			}
+
+			auto operator()(const CmdSetTextureTable& cmd) -> void {
+				frame.stateChanges++;
+				if (!Check(core.textureTables, cmd.table, "texture table") || !cmd.table.IsValid())
+					return;
+
+				// NOTE: tables don't own their textures, a table can outlive what it references
+				const auto& table = *core.textureTables.Get(cmd.table);
+				for (const auto& texture : table.textures)
+					Check(core.textures, texture, "texture");
+				for (const auto& sampler : table.samplers)
+					Check(core.samplers, sampler, "sampler");
+			}
+
+			auto operator()(const CmdSetConstantBuffer& cmd) -> void {
+				frame.stateChanges++;
+				if (cmd.slot >= MaxConstantBufferSlots)
+					Fail("constant buffer slot out of range");
+
+				if (Check(core.buffers, cmd.buffer, "constant buffer") && cmd.buffer.IsValid() && core.buffers.Get(cmd.buffer)->type != BufferType::Constant)
+					Fail("buffer bound as constant buffer was not created as one");
+			}
+
+			auto operator()(const CmdSetShaderBuffer& cmd) -> void {
+				frame.stateChanges++;
+				if (cmd.slot >= MaxBindSlots)
+					Fail("shader buffer slot out of range");
+
+				if (Check(core.buffers, cmd.buffer, "shader buffer") && cmd.buffer.IsValid() && core.buffers.Get(cmd.buffer)->type != BufferType::Structured)
+					Fail("buffer bound as shader buffer was not created as a structured buffer");
+			}
+
+			auto operator()(const CmdUpdateBuffer& cmd, std::span<const u8> bytes) -> void {
+				frame.bufferUpdates++;
+				frame.bufferUploadBytes += bytes.size();
+
+				if (!Check(core.buffers, cmd.buffer, "buffer") || !cmd.buffer.IsValid())
+					return;
+
+				const auto& desc = *core.buffers.Get(cmd.buffer);
+				if (bytes.size() > desc.size)
+					Fail("buffer update is larger than the buffer");
+				else if (desc.type == BufferType::Constant && bytes.size() != desc.size)
+					Fail("constant buffers have to be updated as a whole");
+			}
+
+			auto ValidateDrawState() -> bool {
+				bool valid = true;
+				if (!program.IsValid()) {
+					Fail("draw without a program bound");
+					valid = false;
+				}
+
+				if (!hasTarget) {
+					Fail("draw without a render target bound");
+					valid = false;
+				}
+
+				if (!hasViewport) {
+					Fail("draw without a viewport set");
+					valid = false;
+				}
+
+				return valid;
+			}
+
+			auto operator()(const CmdDraw& cmd) -> void {
+				frame.draws++;
+				if (!ValidateDrawState())
+					return;
+
+				if (vertexBuffer.IsValid()) {
+					const auto& desc = *core.buffers.Get(vertexBuffer);
+					if (desc.stride != 0 && static_cast<u64>(cmd.startVertex + cmd.vertexCount) * desc.stride > desc.size)
+						Fail("draw reads past the end of the vertex buffer");
+				}
+
+				frame.primitives += CountPrimitives(topology, cmd.vertexCount);
+			}
+
+			auto operator()(const CmdDrawIndexed& cmd) -> void {
+				frame.draws++;
+				if (!ValidateDrawState())
+					return;
+
+				if (!indexBuffer.IsValid()) {
+					Fail("indexed draw without an index buffer bound");
+					return;
+				}
+
+				const u64 indexSize = indexFormat == IndexFormat::U16 ? 2 : 4;
+				const u64 lastByte = indexOffset + (static_cast<u64>(cmd.startIndex) + cmd.indexCount) * indexSize;
+				if (lastByte > core.buffers.Get(indexBuffer)->size)
+					Fail("indexed draw reads past the end of the index buffer");
+
+				frame.primitives += CountPrimitives(topology, cmd.indexCount);
+			}
+
+			auto operator()(const CmdDrawInstanced& cmd) -> void {
+				frame.draws++;
+				if (!ValidateDrawState())
+					return;
+
+				// NOTE: the vertex buffer is optional, instanced programs usually fetch their data by SV_InstanceID
+				if (vertexBuffer.IsValid()) {
+					const auto& desc = *core.buffers.Get(vertexBuffer);
+					if (desc.stride != 0 && static_cast<u64>(cmd.startVertex + cmd.vertexCount) * desc.stride > desc.size)
+						Fail("draw reads past the end of the vertex buffer");
+				}
+
+				frame.primitives += CountPrimitives(topology, cmd.vertexCount) * cmd.instanceCount;
+			}
+		};
+
+		auto Accumulate(FrameStats& into, const FrameStats& from) -> void {
+			into.commandLists      += from.commandLists;
+			into.commands          += from.commands;
+			into.draws             += from.draws;
+			into.primitives        += from.primitives;
+			into.stateChanges      += from.stateChanges;
+			into.clears            += from.clears;
+			into.bufferUpdates     += from.bufferUpdates;
+			into.bufferUploadBytes += from.bufferUploadBytes;
+		}
+	}
+
+	auto Init(const PlatformInitDesc& desc) -> bool {
+		if (desc.width == 0 || desc.height == 0) {
+			Logger::Error("[Null]: Init called with an empty backbuffer");
+			return false;
+		}
+
+		core = CoreState{};
+		core.backbuffer = core.renderTargets.Allocate(RenderTargetDesc{ .width = desc.width, .height = desc.height, .sampleCount = std::max(1u, desc.sampleCount) });
+		core.initialized = true;
+
+		return true;
+	}
+
+	auto Shutdown() -> void {
+		UpdateLiveCounts();
+		const auto& s = core.stats;
+		const u32 leaked = s.liveBuffers + s.liveTextures + s.liveSamplers + s.liveTextureTables + s.livePrograms + s.livePipelines + s.liveRasterizerStates + s.liveDepthStencilStates + s.liveRenderTargets + s.liveDepthTargets;
+		if (leaked > 0)
+			Logger::Warn("[Null]: " + std::to_string(leaked) + " resources still alive at shutdown");
+
+		// NOTE: stats stay readable after shutdown so benchmarks can report them
+		const auto stats = core.stats;
+		core = CoreState{};
+		core.stats = stats;
+	}
+
+	auto CreateBuffer(const BufferDesc& desc, const void* initialData) -> BufferHandle {
+		Assert(core.initialized);
+
+		if (desc.size == 0) {
+			Fail("buffer created with size 0");
+			return {};
+		}
+
+		switch (desc.type) {
+			case BufferType::Vertex: {
+				if (desc.stride == 0 || desc.size % desc.stride != 0)
+					Fail("vertex buffer size isn't a multiple of its stride");
+			} break;
+
+			case BufferType::Index: {
+				if (desc.size % 2 != 0)
+					Fail("index buffer size isn't a multiple of the index size");
+			} break;
+
+			case BufferType::Constant: {
+				if (desc.size % 16 != 0 || desc.size > MaxConstantBufferSize)
+					Fail("constant buffer size has to be a multiple of 16 and at most 64KB");
+				if (desc.usage == BufferUsage::Dynamic && initialData != nullptr)
+					Logger::Warn("[Null]: dynamic constant buffer created with initial data");
+			} break;
+
+			case BufferType::Structured: {
+				if (desc.stride == 0 || desc.stride % 4 != 0 || desc.size % desc.stride != 0)
+					Fail("structured buffer size isn't a multiple of its element stride, or the stride isn't a multiple of 4");
+			} break;
+		}
+
+		auto handle = core.buffers.Allocate(desc);
+		core.stats.bufferMemory += desc.size;
+		UpdateLiveCounts();
+
+		return handle;
+	}
+
+	auto UpdateBuffer(BufferHandle buffer, const void* data, u32 size) -> void {
+		auto desc = core.buffers.Get(buffer);
+		if (desc == nullptr) {
+			Fail("updating a destroyed or unknown buffer");
+			return;
+		}
+
+		if (data == nullptr || size == 0 || size > desc->size)
+			Fail("invalid buffer update");
+		else if (desc->type == BufferType::Constant && size != desc->size)
+			Fail("constant buffers have to be updated as a whole");
+
+		core.stats.currentFrame.bufferUpdates++;
+		core.stats.currentFrame.bufferUploadBytes += size;
+	}
+
+	auto DestroyBuffer(BufferHandle buffer) -> void {
+		if (auto desc = core.buffers.Get(buffer))
+			core.stats.bufferMemory -= desc->size;
+
+		Release(core.buffers, buffer, "buffer");
+	}
+
+	auto CreateTexture(const TextureDesc& desc, std::span<const SubresourceData> initialData) -> TextureHandle {
+		Assert(core.initialized);
+
+		if (desc.width == 0 || desc.height == 0 || desc.mipLevels == 0 || desc.arraySize == 0) {
+			Fail("texture created with an empty dimension");
+			return {};
+		}
+
+		if (desc.type == TextureType::TextureCube && (desc.arraySize != 6 || desc.width != desc.height))
+			Fail("cube maps need 6 square faces");
+
+		// NOTE: D3D11 wants whole blocks at the top mip, the mips below may be smaller
+		if (IsBlockCompressed(desc.format) && (desc.width % 4 != 0 || desc.height % 4 != 0))
+			Fail("block compressed textures need a size that's a multiple of 4");
+
+		const u32 maxMips = 32 - static_cast<u32>(std::countl_zero(std::max(desc.width, desc.height)));
+		if (desc.mipLevels > maxMips)
+			Fail("texture has more mips than its size allows");
+
+		if (!initialData.empty()) {
+			if (initialData.size() != desc.mipLevels * desc.arraySize)
+				Fail("texture initial data needs one entry per subresource");
+
+			for (u64 i = 0; i < initialData.size(); i++) {
+				const u32 mip = static_cast<u32>(i % desc.mipLevels);
+				const u32 minPitch = GetRowPitch(desc.format, std::max(1u, desc.width >> mip));
+				if (initialData[i].data == nullptr || initialData[i].rowPitch < minPitch)
+					Fail("texture subresource has no data or a too small row pitch");
+			}
+		}
+
+		const u64 size = CalculateTextureSize(desc);
+		auto handle = core.textures.Allocate(NullTexture{ .desc = desc, .size = size });
+		core.stats.textureMemory += size;
+		UpdateLiveCounts();
+
+		return handle;
+	}
+
+	auto DestroyTexture(TextureHandle texture) -> void {
+		if (auto t = core.textures.Get(texture))
+			core.stats.textureMemory -= t->size;
+
+		Release(core.textures, texture, "texture");
+	}
+
+	auto CreateSampler(const SamplerDesc& desc) -> SamplerHandle {
+		if (desc.maxAnisotropy == 0 || desc.maxAnisotropy > 16)
+			Fail("sampler anisotropy has to be in [1, 16]");
+
+		auto handle = core.samplers.Allocate(desc);
+		UpdateLiveCounts();
+		return handle;
+	}
+
+	auto DestroySampler(SamplerHandle sampler) -> void {
+		Release(core.samplers, sampler, "sampler");
+	}
+
+	auto CreateTextureTable(const TextureTableDesc& desc) -> TextureTableHandle {
+		if (desc.textures.size() > MaxBindSlots || desc.samplers.size() > MaxBindSlots) {
+			Fail("texture table has more entries than bind slots");
+			return {};
+		}
+
+		for (const auto& texture : desc.textures)
+			if (!core.textures.IsAlive(texture))
+				Fail("texture table created with a destroyed or unknown texture");
+
+		for (const auto& sampler : desc.samplers)
+			if (!core.samplers.IsAlive(sampler))
+				Fail("texture table created with a destroyed or unknown sampler");
+
+		auto handle = core.textureTables.Allocate(NullTextureTable{
+			.textures = std::vector<TextureHandle>(desc.textures.begin(), desc.textures.end()),
+			.samplers = std::vector<SamplerHandle>(desc.samplers.begin(), desc.samplers.end())
+		});
+		UpdateLiveCounts();
+		return handle;
+	}
+
+	auto DestroyTextureTable(TextureTableHandle table) -> void {
+		Release(core.textureTables, table, "texture table");
+	}
+
+	auto CreateRasterizerState(const RasterizerDesc& desc) -> RasterizerStateHandle {
+		auto handle = core.rasterizerStates.Allocate(desc);
+		UpdateLiveCounts();
+		return handle;
+	}
+
+	auto DestroyRasterizerState(RasterizerStateHandle state) -> void {
+		Release(core.rasterizerStates, state, "rasterizer state");
+	}
+
+	auto CreateDepthStencilState(const DepthStencilDesc& desc) -> DepthStencilStateHandle {
+		auto handle = core.depthStencilStates.Allocate(desc);
+		UpdateLiveCounts();
+		return handle;
+	}
+
+	auto DestroyDepthStencilState(DepthStencilStateHandle state) -> void {
+		Release(core.depthStencilStates, state, "depth stencil state");
+	}
+
+	auto CreateProgram(const ProgramDesc& desc) -> ProgramHandle {
+		if (desc.vertexShaderBytecode.empty() || desc.pixelShaderBytecode.empty()) {
+			Fail("program created without vertex or pixel shader bytecode");
+			return {};
+		}
+
+		auto handle = core.programs.Allocate(NullProgram{ .vertexShaderSize = desc.vertexShaderBytecode.size(), .pixelShaderSize = desc.pixelShaderBytecode.size() });
+		UpdateLiveCounts();
+		return handle;
+	}
+
+	auto DestroyProgram(ProgramHandle program) -> void {
+		Release(core.programs, program, "program");
+	}
+
+	auto CreatePipeline(const PipelineDesc& desc) -> PipelineHandle {
+		if (!core.programs.IsAlive(desc.program)) {
+			Fail("pipeline created with a destroyed or unknown program");
+			return {};
+		}
+
+		if ((desc.rasterizerState.IsValid() && !core.rasterizerStates.IsAlive(desc.rasterizerState))
+			|| (desc.depthStencilState.IsValid() && !core.depthStencilStates.IsAlive(desc.depthStencilState)))
+			Fail("pipeline created with a destroyed or unknown state");
+
+		auto handle = core.pipelines.Allocate(desc);
+		UpdateLiveCounts();
+		return handle;
+	}
+
+	auto DestroyPipeline(PipelineHandle pipeline) -> void {
+		Release(core.pipelines, pipeline, "pipeline");
+	}
+
+	auto CreateRenderTarget(const RenderTargetDesc& desc) -> RenderTargetHandle {
+		if (desc.width == 0 || desc.height == 0 || desc.sampleCount == 0) {
+			Fail("render target created with an empty dimension or no samples");
+			return {};
+		}
+
+		auto handle = core.renderTargets.Allocate(desc);
+		UpdateLiveCounts();
+		return handle;
+	}
+
+	auto DestroyRenderTarget(RenderTargetHandle target) -> void {
+		if (target == core.backbuffer) {
+			Fail("destroying the backbuffer");
+			return;
+		}
+
+		Release(core.renderTargets, target, "render target");
+	}
+
+	auto CreateDepthTarget(const DepthTargetDesc& desc) -> DepthTargetHandle {
+		if (desc.width == 0 || desc.height == 0) {
+			Fail("depth target created with an empty dimension");
+			return {};
+		}
+
+		auto handle = core.depthTargets.Allocate(desc);
+		UpdateLiveCounts();
+		return handle;
+	}
+
+	auto DestroyDepthTarget(DepthTargetHandle target) -> void {
+		Release(core.depthTargets, target, "depth target");
+	}
+
+	auto GetBackbuffer() -> RenderTargetHandle {
+		return core.backbuffer;
+	}
+
+	auto Submit(std::span<const CommandList> lists) -> void {
+		auto& frame = core.stats.currentFrame;
+		for (const auto& list : lists) {
+			frame.commandLists++;
+			frame.commands += list.GetStats().commandCount;
+			ForEachCommand(list, Validator{ .frame = frame });
+		}
+	}
+
+	auto Present() -> void {
+		auto& s = core.stats;
+		Accumulate(s.total, s.currentFrame);
+		s.lastFrame = s.currentFrame;
+		s.currentFrame = {};
+		s.frameCount++;
+	}
+
+	auto GetStats() -> const Stats& {
+		return core.stats;
+	}
+}
\ No newline at end of file
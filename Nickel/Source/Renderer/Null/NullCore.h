@@ -0,0 +1,80 @@
+#pragma once
+
+#include "../RendererPlatformInterface.h"
+
+// Headless backend: no GPU, no window. Resources only exist as bookkeeping, submitted command lists are
+// validated against that bookkeeping and counted, so the whole frame path can run in benchmarks and CI.
+namespace Nickel::Renderer::Null::Core {
+	struct FrameStats {
+		u32 commandLists;
+		u32 commands;
+		u32 draws;
+		u32 primitives;
+		u32 stateChanges; // NOTE: everything that isn't a draw, clear or buffer update
+		u32 clears;
+		u32 bufferUpdates;
+		u64 bufferUploadBytes;
+	};
+
+	struct Stats {
+		u64 frameCount;
+		FrameStats lastFrame;    // NOTE: stats of the last presented frame
+		FrameStats currentFrame; // NOTE: accumulates until Present
+		FrameStats total;
+
+		u32 liveBuffers;
+		u32 liveTextures;
+		u32 liveSamplers;
+		u32 liveTextureTables;
+		u32 livePrograms;
+		u32 livePipelines;
+		u32 liveRasterizerStates;
+		u32 liveDepthStencilStates;
+		u32 liveRenderTargets; // NOTE: without the backbuffer
+		u32 liveDepthTargets;
+
+		u64 bufferMemory;
+		u64 textureMemory;
+
+		u32 validationErrors;
+	};
+
+	auto Init(const PlatformInitDesc& desc) -> bool;
+	auto Shutdown() -> void;
+
+	auto CreateBuffer(const BufferDesc& desc, const void* initialData) -> BufferHandle;
+	auto UpdateBuffer(BufferHandle buffer, const void* data, u32 size) -> void;
+	auto DestroyBuffer(BufferHandle buffer) -> void;
+
+	auto CreateTexture(const TextureDesc& desc, std::span<const SubresourceData> initialData) -> TextureHandle;
+	auto DestroyTexture(TextureHandle texture) -> void;
+
+	auto CreateSampler(const SamplerDesc& desc) -> SamplerHandle;
+	auto DestroySampler(SamplerHandle sampler) -> void;
+
+	auto CreateTextureTable(const TextureTableDesc& desc) -> TextureTableHandle;
+	auto DestroyTextureTable(TextureTableHandle table) -> void;
+
+	auto CreateRasterizerState(const RasterizerDesc& desc) -> RasterizerStateHandle;
+	auto DestroyRasterizerState(RasterizerStateHandle state) -> void;
+
+	auto CreateDepthStencilState(const DepthStencilDesc& desc) -> DepthStencilStateHandle;
+	auto DestroyDepthStencilState(DepthStencilStateHandle state) -> void;
+
+	auto CreateProgram(const ProgramDesc& desc) -> ProgramHandle;
+	auto DestroyProgram(ProgramHandle program) -> void;
+
+	auto CreatePipeline(const PipelineDesc& desc) -> PipelineHandle;
+	auto DestroyPipeline(PipelineHandle pipeline) -> void;
+
+	auto CreateRenderTarget(const RenderTargetDesc& desc) -> RenderTargetHandle;
+	auto DestroyRenderTarget(RenderTargetHandle target) -> void;
+	auto CreateDepthTarget(const DepthTargetDesc& desc) -> DepthTargetHandle;
+	auto DestroyDepthTarget(DepthTargetHandle target) -> void;
+	auto GetBackbuffer() -> RenderTargetHandle;
+
+	auto Submit(std::span<const CommandList> lists) -> void;
+	auto Present() -> void;
+
+	auto GetStats() -> const Stats&;
+}
\ No newline at end of file
@@ -0,0 +1,9 @@
+#pragma once
+
+namespace Nickel::Renderer {
+	struct PlatformInterface;
+
+	namespace Null {
+		auto GetPlatformInterface(PlatformInterface& platformInterface) -> void;
+	}
+}
\ No newline at end of file
@@ -0,0 +1,171 @@
+#include "PipelineCache.h"
+#include <string>
+
+namespace Nickel::Renderer {
+	namespace {
+		constexpr auto HashCombine(std::size_t seed, u64 value) -> std::size_t {
+			return seed ^ (static_cast<std::size_t>(value) + 0x9e3779b97f4a7c15ull + (seed << 6) + (seed >> 2));
+		}
+	}
+
+	// NOTE: hashes go field by field, the descriptions have padding that isn't guaranteed to be zeroed
+	auto PipelineCache::DescHash::operator()(const SamplerDesc& desc) const -> std::size_t {
+		std::size_t hash = static_cast<std::size_t>(desc.filter);
+		hash = HashCombine(hash, static_cast<u64>(desc.addressMode));
+		return HashCombine(hash, desc.maxAnisotropy);
+	}
+
+	auto PipelineCache::DescHash::operator()(const RasterizerDesc& desc) const -> std::size_t {
+		std::size_t hash = static_cast<std::size_t>(desc.cullMode);
+		hash = HashCombine(hash, static_cast<u64>(desc.fillMode));
+		hash = HashCombine(hash, desc.frontCounterClockwise);
+		return HashCombine(hash, desc.depthClip);
+	}
+
+	auto PipelineCache::DescHash::operator()(const DepthStencilDesc& desc) const -> std::size_t {
+		std::size_t hash = static_cast<std::size_t>(desc.depthTest);
+		hash = HashCombine(hash, desc.depthWrite);
+		hash = HashCombine(hash, static_cast<u64>(desc.depthFunc));
+		return HashCombine(hash, desc.stencilTest);
+	}
+
+	auto PipelineCache::DescHash::operator()(const PipelineStateDesc& desc) const -> std::size_t {
+		std::size_t hash = desc.program.id;
+		hash = HashCombine(hash, (*this)(desc.rasterizer));
+		hash = HashCombine(hash, (*this)(desc.depthStencil));
+		return HashCombine(hash, desc.stencilRef);
+	}
+
+	template <typename DescT, typename HandleT, typename CreateFn>
+	auto PipelineCache::Acquire(Table<DescT, HandleT>& table, const DescT& desc, CreateFn&& create) -> HandleT {
+		if (auto it = table.entries.find(desc); it != table.entries.end()) {
+			it->second.refCount++;
+			hits++;
+			return it->second.handle;
+		}
+
+		misses++;
+		const HandleT handle = create();
+		if (!handle.IsValid())
+			return handle; // NOTE: the backend already reported why
+
+		table.entries.emplace(desc, typename Table<DescT, HandleT>::Entry{ .handle = handle, .refCount = 1 });
+		table.descs.emplace(handle.id, desc);
+
+		return handle;
+	}
+
+	template <typename DescT, typename HandleT>
+	auto PipelineCache::Unreference(Table<DescT, HandleT>& table, HandleT handle, const char* what, DescT& released) -> bool {
+		const auto descIt = table.descs.find(handle.id);
+		if (descIt == table.descs.end()) {
+			Logger::Error(std::string("[PipelineCache]: releasing a ") + what + " that wasn't acquired from the cache");
+			Assert(false);
+			return false;
+		}
+
+		auto entryIt = table.entries.find(descIt->second);
+		Assert(entryIt != table.entries.end() && entryIt->second.refCount > 0);
+		if (--entryIt->second.refCount > 0)
+			return false;
+
+		released = descIt->second;
+		table.entries.erase(entryIt);
+		table.descs.erase(descIt);
+
+		return true;
+	}
+
+	auto PipelineCache::AcquireSampler(const PlatformInterface& gfx, const SamplerDesc& desc) -> SamplerHandle {
+		return Acquire(samplers, desc, [&] { return gfx.CreateSampler(desc); });
+	}
+
+	auto PipelineCache::AcquireRasterizerState(const PlatformInterface& gfx, const RasterizerDesc& desc) -> RasterizerStateHandle {
+		return Acquire(rasterizerStates, desc, [&] { return gfx.CreateRasterizerState(desc); });
+	}
+
+	auto PipelineCache::AcquireDepthStencilState(const PlatformInterface& gfx, const DepthStencilDesc& desc) -> DepthStencilStateHandle {
+		return Acquire(depthStencilStates, desc, [&] { return gfx.CreateDepthStencilState(desc); });
+	}
+
+	auto PipelineCache::AcquirePipeline(const PlatformInterface& gfx, const PipelineStateDesc& desc) -> PipelineHandle {
+		if (!desc.program.IsValid()) {
+			Logger::Error("[PipelineCache]: pipeline requested without a program");
+			return {};
+		}
+
+		return Acquire(pipelines, desc, [&] {
+			// NOTE: a live pipeline holds one reference to each of its states, dropped again when the pipeline dies
+			const auto rasterizerState = AcquireRasterizerState(gfx, desc.rasterizer);
+			const auto depthStencilState = AcquireDepthStencilState(gfx, desc.depthStencil);
+			const auto pipeline = gfx.CreatePipeline(PipelineDesc{
+				.program = desc.program,
+				.rasterizerState = rasterizerState,
+				.depthStencilState = depthStencilState,
+				.stencilRef = desc.stencilRef
+			});
+
+			if (!pipeline.IsValid()) {
+				if (rasterizerState.IsValid())
+					Release(gfx, rasterizerState);
+				if (depthStencilState.IsValid())
+					Release(gfx, depthStencilState);
+			}
+
+			return pipeline;
+		});
+	}
+
+	auto PipelineCache::Release(const PlatformInterface& gfx, SamplerHandle sampler) -> void {
+		SamplerDesc released;
+		if (Unreference(samplers, sampler, "sampler", released))
+			gfx.DestroySampler(sampler);
+	}
+
+	auto PipelineCache::Release(const PlatformInterface& gfx, RasterizerStateHandle state) -> void {
+		RasterizerDesc released;
+		if (Unreference(rasterizerStates, state, "rasterizer state", released))
+			gfx.DestroyRasterizerState(state);
+	}
+
+	auto PipelineCache::Release(const PlatformInterface& gfx, DepthStencilStateHandle state) -> void {
+		DepthStencilDesc released;
+		if (Unreference(depthStencilStates, state, "depth stencil state", released))
+			gfx.DestroyDepthStencilState(state);
+	}
+
+	auto PipelineCache::Release(const PlatformInterface& gfx, PipelineHandle pipeline) -> void {
+		PipelineStateDesc released;
+		if (!Unreference(pipelines, pipeline, "pipeline", released))
+			return;
+
+		gfx.DestroyPipeline(pipeline);
+		Release(gfx, rasterizerStates.entries.at(released.rasterizer).handle);
+		Release(gfx, depthStencilStates.entries.at(released.depthStencil).handle);
+	}
+
+	auto PipelineCache::ReleaseAll(const PlatformInterface& gfx) -> void {
+		// NOTE: pipelines first, backends may still point at their states
+		for (const auto& [desc, entry] : pipelines.entries)
+			gfx.DestroyPipeline(entry.handle);
+		for (const auto& [desc, entry] : rasterizerStates.entries)
+			gfx.DestroyRasterizerState(entry.handle);
+		for (const auto& [desc, entry] : depthStencilStates.entries)
+			gfx.DestroyDepthStencilState(entry.handle);
+		for (const auto& [desc, entry] : samplers.entries)
+			gfx.DestroySampler(entry.handle);
+
+		*this = PipelineCache{};
+	}
+
+	auto PipelineCache::GetStats() const -> PipelineCacheStats {
+		return PipelineCacheStats{
+			.hits = hits,
+			.misses = misses,
+			.liveSamplers = static_cast<u32>(samplers.entries.size()),
+			.liveRasterizerStates = static_cast<u32>(rasterizerStates.entries.size()),
+			.liveDepthStencilStates = static_cast<u32>(depthStencilStates.entries.size()),
+			.livePipelines = static_cast<u32>(pipelines.entries.size())
+		};
+	}
+}
\ No newline at end of file
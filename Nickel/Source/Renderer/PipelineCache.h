@@ -0,0 +1,80 @@
+#pragma once
+
+#include "RendererPlatformInterface.h"
+#include <unordered_map>
+
+namespace Nickel::Renderer {
+	struct PipelineStateDesc {
+		ProgramHandle program;
+		RasterizerDesc rasterizer{};
+		DepthStencilDesc depthStencil{};
+		u32 stencilRef = 1;
+		// TODO: blend state
+
+		friend auto operator==(const PipelineStateDesc& a, const PipelineStateDesc& b) -> bool = default;
+	};
+
+	struct PipelineCacheStats {
+		u32 hits;
+		u32 misses;
+		u32 liveSamplers;
+		u32 liveRasterizerStates;
+		u32 liveDepthStencilStates;
+		u32 livePipelines;
+	};
+
+	// Hash-consed state objects: equal descriptions share one backend object. Every Acquire adds a reference that
+	// has to be given back with Release, the backend object is destroyed with the last one. Pipelines bake a program
+	// and its states into one handle, so draws bind a single object. Like the RenderGraph the cache doesn't hold on
+	// to the platform interface, it's passed to every call that may create or destroy something.
+	class PipelineCache {
+	public:
+		auto AcquireSampler(const PlatformInterface& gfx, const SamplerDesc& desc) -> SamplerHandle;
+		auto AcquireRasterizerState(const PlatformInterface& gfx, const RasterizerDesc& desc) -> RasterizerStateHandle;
+		auto AcquireDepthStencilState(const PlatformInterface& gfx, const DepthStencilDesc& desc) -> DepthStencilStateHandle;
+		auto AcquirePipeline(const PlatformInterface& gfx, const PipelineStateDesc& desc) -> PipelineHandle; // NOTE: the program stays owned by the caller
+
+		auto Release(const PlatformInterface& gfx, SamplerHandle sampler) -> void;
+		auto Release(const PlatformInterface& gfx, RasterizerStateHandle state) -> void;
+		auto Release(const PlatformInterface& gfx, DepthStencilStateHandle state) -> void;
+		auto Release(const PlatformInterface& gfx, PipelineHandle pipeline) -> void;
+
+		auto ReleaseAll(const PlatformInterface& gfx) -> void; // NOTE: shutdown, destroys every object no matter how many references are left
+
+		auto GetStats() const -> PipelineCacheStats;
+
+	private:
+		struct DescHash {
+			auto operator()(const SamplerDesc& desc) const -> std::size_t;
+			auto operator()(const RasterizerDesc& desc) const -> std::size_t;
+			auto operator()(const DepthStencilDesc& desc) const -> std::size_t;
+			auto operator()(const PipelineStateDesc& desc) const -> std::size_t;
+		};
+
+		template <typename DescT, typename HandleT>
+		struct Table {
+			struct Entry {
+				HandleT handle;
+				u32 refCount;
+			};
+
+			std::unordered_map<DescT, Entry, DescHash> entries;
+			std::unordered_map<u32, DescT> descs; // NOTE: handle id -> description, so Release only needs the handle
+		};
+
+		template <typename DescT, typename HandleT, typename CreateFn>
+		auto Acquire(Table<DescT, HandleT>& table, const DescT& desc, CreateFn&& create) -> HandleT;
+
+		// NOTE: returns true when the last reference is gone, 'released' then holds the description of the dead object
+		template <typename DescT, typename HandleT>
+		auto Unreference(Table<DescT, HandleT>& table, HandleT handle, const char* what, DescT& released) -> bool;
+
+		Table<SamplerDesc, SamplerHandle> samplers;
+		Table<RasterizerDesc, RasterizerStateHandle> rasterizerStates;
+		Table<DepthStencilDesc, DepthStencilStateHandle> depthStencilStates;
+		Table<PipelineStateDesc, PipelineHandle> pipelines;
+
+		u32 hits = 0;
+		u32 misses = 0;
+	};
+}
\ No newline at end of file
@@ -0,0 +1,111 @@
+#include "Polylines.h"
+#include <algorithm>
+#include <bit>
+
+namespace Nickel::Renderer {
+	static_assert(sizeof(Vec3) == 12, "the point buffer is read as StructuredBuffer<float3>");
+
+	auto Polylines::Create(const PlatformInterface& gfx, ShaderLibrary& shaders, PipelineCache& pipelineCache, PermutationKey key) -> bool {
+		// NOTE: nothing feeds an input layout, bytecode that still declares vertex inputs is from the vertex buffer
+		// version of the shader and would draw with an unbound layout
+		const auto* vertexStage = shaders.FindStage("Line", ShaderStage::Vertex);
+		if (vertexStage != nullptr && !shaders.GetStageInfo(*vertexStage).inputs.empty()) {
+			Logger::Error("[Polylines]: the line vertex shader reads vertex inputs, LineVertexShader.cso is out of date and polylines won't be drawn");
+			return false;
+		}
+
+		const auto program = shaders.GetProgram(gfx, "Line", key);
+		if (!program.IsValid()) {
+			Logger::Error("[Polylines]: no line program, polylines won't be drawn");
+			return false;
+		}
+
+		// NOTE: the strip's winding flips with the segment's screen direction
+		pipeline = pipelineCache.AcquirePipeline(gfx, PipelineStateDesc{
+			.program = program,
+			.rasterizer = RasterizerDesc{ .cullMode = CullMode::None }
+		});
+
+		constantBuffer = gfx.CreateBuffer(BufferDesc{ .type = BufferType::Constant, .size = sizeof(LineShaderData) }, nullptr);
+		return true;
+	}
+
+	auto Polylines::Release(const PlatformInterface& gfx, PipelineCache& pipelineCache) -> void {
+		if (pipeline.IsValid())
+			pipelineCache.Release(gfx, pipeline);
+
+		for (auto buffer : { pointBuffer, constantBuffer })
+			if (buffer.IsValid())
+				gfx.DestroyBuffer(buffer);
+
+		pipeline = {};
+		pointBuffer = constantBuffer = {};
+		pointCapacity = 0;
+		Clear();
+	}
+
+	auto Polylines::Add(std::span<const Vec3> linePoints, const Vec4& color, f32 thickness) -> void {
+		if (linePoints.size() < 2)
+			return;
+
+		polylines.push_back(Polyline{
+			.firstPoint = static_cast<u32>(points.size()),
+			.pointCount = static_cast<u32>(linePoints.size()),
+			.color = color,
+			.thickness = thickness
+		});
+		points.insert(points.end(), linePoints.begin(), linePoints.end());
+		dirty = true;
+	}
+
+	auto Polylines::Clear() -> void {
+		points.clear();
+		polylines.clear();
+		uploadedCount = 0;
+		dirty = false;
+		stats.polylineCount = stats.pointCount = 0;
+	}
+
+	auto Polylines::Upload(const PlatformInterface& gfx) -> void {
+		if (!dirty || !constantBuffer.IsValid())
+			return;
+
+		// NOTE: grows by powers of two and never shrinks, like the clustered light lists
+		const u32 count = static_cast<u32>(points.size());
+		if (count > pointCapacity) {
+			if (pointBuffer.IsValid())
+				gfx.DestroyBuffer(pointBuffer);
+
+			pointCapacity = std::bit_ceil(count);
+			pointBuffer = gfx.CreateBuffer(BufferDesc{ .type = BufferType::Structured, .usage = BufferUsage::Dynamic, .size = pointCapacity * static_cast<u32>(sizeof(Vec3)), .stride = sizeof(Vec3) }, nullptr);
+		}
+
+		gfx.UpdateBuffer(pointBuffer, points.data(), count * static_cast<u32>(sizeof(Vec3)));
+		uploadedCount = static_cast<u32>(polylines.size());
+		dirty = false;
+
+		stats = PolylineStats{ .polylineCount = uploadedCount, .pointCount = count, .pointCapacity = pointCapacity };
+	}
+
+	auto Polylines::Draw(CommandList& list) const -> void {
+		if (!pipeline.IsValid() || !pointBuffer.IsValid() || uploadedCount == 0)
+			return;
+
+		list.SetPipeline(pipeline);
+		list.SetTopology(PrimitiveTopology::TriangleStrip);
+		list.SetShaderBuffer(ShaderStage::Vertex, LinePointSlot, pointBuffer);
+		list.SetConstantBuffer(ShaderStage::Vertex, LineConstantSlot, constantBuffer);
+
+		// NOTE: SV_InstanceID restarts at 0 for every draw on D3D11, so the polyline's offset goes through the cbuffer
+		for (u32 i = 0; i < uploadedCount; i++) {
+			const auto& line = polylines[i];
+			list.UpdateBuffer(constantBuffer, LineShaderData{
+				.color = line.color,
+				.thickness = line.thickness,
+				.firstPoint = line.firstPoint,
+				.pointCount = line.pointCount
+			});
+			list.DrawInstanced(4, line.pointCount - 1);
+		}
+	}
+}
@@ -0,0 +1,67 @@
+#pragma once
+
+#include "RendererPlatformInterface.h"
+#include "CommandList.h"
+#include "PipelineCache.h"
+#include "ShaderLibrary.h"
+#include "ShaderPermutations.h"
+#include "../Math.h"
+#include <span>
+#include <vector>
+
+// Thick screen space polylines. Every point is stored once as a float3 in one structured buffer, a polyline is
+// drawn as one instance per segment and LineVertexShader.hlsl fetches the segment's end points and their
+// neighbours by SV_InstanceID, so there's no vertex buffer and no per vertex duplication: 12 bytes per point
+// instead of the 4 * 48 the expanded strip took.
+namespace Nickel::Renderer {
+	constexpr u32 LinePointSlot = 0;
+	constexpr u32 LineConstantSlot = 3;
+
+	struct alignas(16) LineShaderData {
+		Vec4 color;
+		f32 thickness; // NOTE: in normalized device units
+		u32 firstPoint;
+		u32 pointCount;
+	};
+	static_assert(sizeof(LineShaderData) == 32, "has to match the ShaderData cbuffer in LineVertexShader.hlsl");
+
+	struct PolylineStats {
+		u32 polylineCount;
+		u32 pointCount;
+		u32 pointCapacity;
+	};
+
+	class Polylines {
+	public:
+		auto Create(const PlatformInterface& gfx, ShaderLibrary& shaders, PipelineCache& pipelineCache, PermutationKey key = LinePermutation::Default) -> bool;
+		auto Release(const PlatformInterface& gfx, PipelineCache& pipelineCache) -> void;
+
+		auto Add(std::span<const Vec3> points, const Vec4& color, f32 thickness) -> void; // NOTE: lines with less than 2 points are dropped
+		auto Clear() -> void;
+
+		auto Upload(const PlatformInterface& gfx) -> void; // NOTE: only writes the points when they changed since the last Upload
+		// NOTE: the caller binds the PerApplication, PerFrame and PerObject constant buffers, one instanced draw per polyline
+		auto Draw(CommandList& list) const -> void;
+
+		inline auto GetStats() const -> const PolylineStats& { return stats; }
+
+	private:
+		struct Polyline {
+			u32 firstPoint;
+			u32 pointCount;
+			Vec4 color;
+			f32 thickness;
+		};
+
+		std::vector<Vec3> points;
+		std::vector<Polyline> polylines;
+		bool dirty = false;
+
+		PipelineHandle pipeline;
+		BufferHandle pointBuffer;
+		BufferHandle constantBuffer;
+		u32 pointCapacity = 0;
+		u32 uploadedCount = 0; // NOTE: polylines the point buffer holds, Add after Upload isn't drawn until the next one
+		PolylineStats stats{};
+	};
+}
@@ -0,0 +1,430 @@
+#include "RenderGraph.h"
+#include <algorithm>
+#include <cstdio>
+#include <numeric>
+
+namespace Nickel::Renderer {
+	namespace {
+		auto IsWrite(ResourceState state) -> bool {
+			return state == ResourceState::RenderTarget || state == ResourceState::DepthWrite;
+		}
+
+		auto ToString(ResourceState state) -> const char* {
+			switch (state) {
+				case ResourceState::Undefined:    return "Undefined";
+				case ResourceState::RenderTarget: return "RenderTarget";
+				case ResourceState::DepthWrite:   return "DepthWrite";
+				case ResourceState::ShaderRead:   return "ShaderRead";
+			}
+
+			return "?";
+		}
+
+		auto FormatMiB(u64 bytes) -> std::string {
+			char buffer[32];
+			std::snprintf(buffer, sizeof(buffer), "%.2f MiB", static_cast<f64>(bytes) / (1024.0 * 1024.0));
+			return buffer;
+		}
+	}
+
+	auto RenderPassBuilder::WriteColor(RenderGraphResource resource, LoadOp load, const f32 clearColor[4]) -> void {
+		auto access = RenderGraph::Access{ .resource = resource, .state = ResourceState::RenderTarget, .load = load, .clearColor = {}, .clearDepth = 1.0f };
+		if (clearColor != nullptr)
+			std::copy(clearColor, clearColor + 4, access.clearColor);
+
+		graph.AddAccess(passIdx, access);
+	}
+
+	auto RenderPassBuilder::WriteDepth(RenderGraphResource resource, LoadOp load, f32 clearDepth) -> void {
+		graph.AddAccess(passIdx, RenderGraph::Access{ .resource = resource, .state = ResourceState::DepthWrite, .load = load, .clearColor = {}, .clearDepth = clearDepth });
+	}
+
+	auto RenderPassBuilder::Read(RenderGraphResource resource) -> void {
+		graph.AddAccess(passIdx, RenderGraph::Access{ .resource = resource, .state = ResourceState::ShaderRead, .load = LoadOp::Load, .clearColor = {}, .clearDepth = 1.0f });
+	}
+
+	auto RenderPassBuilder::SetSideEffect() -> void {
+		graph.passes[passIdx].sideEffect = true;
+	}
+
+	auto RenderGraph::Reset() -> void {
+		resources.clear();
+		passes.clear();
+		slots.clear();
+		report = {};
+		compiled = false;
+	}
+
+	auto RenderGraph::AddResource(Resource resource) -> RenderGraphResource {
+		resource.firstUse = -1;
+		resource.lastUse = -1;
+		resource.physicalIdx = -1;
+		resources.push_back(resource);
+		return RenderGraphResource{ static_cast<u32>(resources.size()) };
+	}
+
+	auto RenderGraph::AddAccess(u32 passIdx, Access access) -> void {
+		passes[passIdx].accesses.push_back(access);
+	}
+
+	auto RenderGraph::ImportRenderTarget(const char* name, RenderTargetHandle target, const RenderTargetDesc& desc) -> RenderGraphResource {
+		return AddResource(Resource{
+			.name = name,
+			.desc = TargetDesc{ RenderGraphResourceType::Color, desc.format, desc.width, desc.height, desc.sampleCount },
+			.imported = true,
+			.importedColor = target
+		});
+	}
+
+	auto RenderGraph::ImportDepthTarget(const char* name, DepthTargetHandle target, const DepthTargetDesc& desc) -> RenderGraphResource {
+		return AddResource(Resource{
+			.name = name,
+			.desc = TargetDesc{ RenderGraphResourceType::Depth, TextureFormat::R32_FLOAT, desc.width, desc.height, desc.sampleCount },
+			.imported = true,
+			.importedDepth = target
+		});
+	}
+
+	auto RenderGraph::CreateRenderTarget(const char* name, const RenderTargetDesc& desc) -> RenderGraphResource {
+		return AddResource(Resource{ .name = name, .desc = TargetDesc{ RenderGraphResourceType::Color, desc.format, desc.width, desc.height, desc.sampleCount } });
+	}
+
+	auto RenderGraph::CreateDepthTarget(const char* name, const DepthTargetDesc& desc) -> RenderGraphResource {
+		// NOTE: depth targets have a single backend format, R32_FLOAT just stands in for its 4 bytes per sample
+		return AddResource(Resource{ .name = name, .desc = TargetDesc{ RenderGraphResourceType::Depth, TextureFormat::R32_FLOAT, desc.width, desc.height, desc.sampleCount } });
+	}
+
+	auto RenderGraph::Validate() const -> bool {
+		bool valid = true;
+		auto fail = [&valid](const std::string& message) {
+			Logger::Error("[RenderGraph]: " + message);
+			valid = false;
+		};
+
+		for (const auto& pass : passes) {
+			const Resource* color = nullptr;
+			const Resource* depth = nullptr;
+
+			for (const auto& access : pass.accesses) {
+				if (!access.resource.IsValid() || access.resource.id > resources.size()) {
+					fail(std::string("pass '") + pass.name + "' uses an unknown resource");
+					continue;
+				}
+
+				const auto& resource = resources[access.resource.id - 1];
+				const bool colorType = resource.desc.type == RenderGraphResourceType::Color;
+				if ((access.state == ResourceState::RenderTarget && !colorType) || (access.state == ResourceState::DepthWrite && colorType))
+					fail(std::string("pass '") + pass.name + "' writes '" + resource.name + "' as the wrong kind of target");
+
+				if (access.state == ResourceState::RenderTarget) {
+					if (color != nullptr)
+						fail(std::string("pass '") + pass.name + "' writes more than one color target");
+					color = &resource;
+				}
+
+				if (access.state == ResourceState::DepthWrite) {
+					if (depth != nullptr)
+						fail(std::string("pass '") + pass.name + "' writes more than one depth target");
+					depth = &resource;
+				}
+
+				const auto sameResource = [&access](const Access& other) { return other.resource == access.resource; };
+				if (std::count_if(pass.accesses.begin(), pass.accesses.end(), sameResource) > 1)
+					fail(std::string("pass '") + pass.name + "' uses '" + resource.name + "' more than once");
+			}
+
+			if (color != nullptr && depth != nullptr && (color->desc.width != depth->desc.width || color->desc.height != depth->desc.height || color->desc.sampleCount != depth->desc.sampleCount))
+				fail(std::string("pass '") + pass.name + "' writes color and depth targets of different sizes or sample counts");
+		}
+
+		return valid;
+	}
+
+	// NOTE: walks the passes backwards tracking which resources still have a reader. Imported resources are read
+	// after the frame. A pass survives when it has side effects or writes something that is read later, a write
+	// that doesn't load ends the interest in everything written before it.
+	auto RenderGraph::CullPasses() -> void {
+		auto needed = std::vector<bool>(resources.size());
+		for (u64 i = 0; i < resources.size(); i++)
+			needed[i] = resources[i].imported;
+
+		for (u64 passIdx = passes.size(); passIdx-- > 0;) {
+			auto& pass = passes[passIdx];
+			pass.alive = pass.sideEffect || std::any_of(pass.accesses.begin(), pass.accesses.end(), [&needed](const Access& access) {
+				return IsWrite(access.state) && needed[access.resource.id - 1];
+			});
+
+			if (!pass.alive) {
+				report.culledPassCount++;
+				continue;
+			}
+
+			for (const auto& access : pass.accesses) {
+				if (IsWrite(access.state) && access.load != LoadOp::Load)
+					needed[access.resource.id - 1] = false;
+			}
+
+			for (const auto& access : pass.accesses) {
+				if (!IsWrite(access.state) || access.load == LoadOp::Load)
+					needed[access.resource.id - 1] = true;
+			}
+		}
+	}
+
+	auto RenderGraph::DeriveStates() -> void {
+		auto states = std::vector<ResourceState>(resources.size(), ResourceState::Undefined);
+		auto written = std::vector<bool>(resources.size());
+		for (u64 i = 0; i < resources.size(); i++) {
+			if (!resources[i].imported)
+				continue;
+
+			states[i] = resources[i].desc.type == RenderGraphResourceType::Color ? ResourceState::RenderTarget : ResourceState::DepthWrite;
+			written[i] = true;
+		}
+
+		for (u32 passIdx = 0; passIdx < passes.size(); passIdx++) {
+			auto& pass = passes[passIdx];
+			if (!pass.alive)
+				continue;
+
+			for (const auto& access : pass.accesses) {
+				const u32 r = access.resource.id - 1;
+				auto& resource = resources[r];
+
+				if (IsWrite(access.state)) {
+					const bool derivedClear = access.load == LoadOp::Load && !written[r];
+					if (access.load == LoadOp::Clear || derivedClear) {
+						// NOTE: derived clears use the values the access carries, black / far plane unless given
+						if (access.state == ResourceState::RenderTarget) {
+							pass.clearFlags |= static_cast<u32>(ClearFlag::CLEAR_COLOR);
+							std::copy(std::begin(access.clearColor), std::end(access.clearColor), pass.clearColor);
+						} else {
+							pass.clearFlags |= static_cast<u32>(ClearFlag::CLEAR_DEPTH);
+							pass.clearDepth = access.clearDepth;
+						}
+					}
+
+					if (derivedClear)
+						report.derivedClearCount++;
+
+					written[r] = true;
+				} else if (!written[r]) {
+					Logger::Warn(std::string("[RenderGraph]: pass '") + pass.name + "' reads '" + resource.name + "' before anything wrote it");
+				}
+
+				if (states[r] != access.state) {
+					pass.barriers.push_back(RenderGraphBarrier{ access.resource, states[r], access.state });
+					states[r] = access.state;
+					report.barrierCount++;
+				}
+
+				if (resource.firstUse < 0)
+					resource.firstUse = static_cast<i32>(passIdx);
+				resource.lastUse = static_cast<i32>(passIdx);
+			}
+		}
+	}
+
+	// NOTE: first fit over transients ordered by first use, a slot is reused once its last user ran before
+	auto RenderGraph::AssignPhysical() -> void {
+		auto order = std::vector<u32>();
+		for (u32 i = 0; i < resources.size(); i++)
+			if (!resources[i].imported && resources[i].firstUse >= 0)
+				order.push_back(i);
+
+		std::stable_sort(order.begin(), order.end(), [this](u32 a, u32 b) { return resources[a].firstUse < resources[b].firstUse; });
+
+		const auto targetSize = [](const TargetDesc& desc) -> u64 {
+			const u64 texelSize = desc.type == RenderGraphResourceType::Color ? GetTexelSize(desc.format) : 4;
+			return static_cast<u64>(desc.width) * desc.height * texelSize * std::max(1u, desc.sampleCount);
+		};
+
+		auto slotLastUse = std::vector<i32>();
+		for (const u32 r : order) {
+			auto& resource = resources[r];
+			report.transientCount++;
+			report.transientBytes += targetSize(resource.desc);
+
+			for (u32 slot = 0; slot < slots.size(); slot++) {
+				if (slots[slot] == resource.desc && slotLastUse[slot] < resource.firstUse) {
+					resource.physicalIdx = static_cast<i32>(slot);
+					break;
+				}
+			}
+
+			if (resource.physicalIdx < 0) {
+				resource.physicalIdx = static_cast<i32>(slots.size());
+				slots.push_back(resource.desc);
+				slotLastUse.push_back(-1);
+				report.physicalBytes += targetSize(resource.desc);
+			}
+
+			slotLastUse[resource.physicalIdx] = resource.lastUse;
+		}
+
+		report.physicalCount = static_cast<u32>(slots.size());
+	}
+
+	auto RenderGraph::Compile() -> bool {
+		report = RenderGraphReport{ .passCount = static_cast<u32>(passes.size()) };
+		slots.clear();
+		compiled = false;
+
+		if (!Validate())
+			return false;
+
+		CullPasses();
+		DeriveStates();
+		AssignPhysical();
+
+		compiled = true;
+		return true;
+	}
+
+	auto RenderGraph::Execute(const PlatformInterface& gfx) -> void {
+		if (!compiled)
+			return;
+
+		// NOTE: slots are numbered in first use order, so a graph that doesn't change keeps its backend targets
+		for (u32 slot = 0; slot < slots.size(); slot++) {
+			if (slot == physical.size())
+				physical.push_back(Physical{});
+
+			auto& target = physical[slot];
+			const auto& desc = slots[slot];
+			if ((target.color.IsValid() || target.depth.IsValid()) && target.desc == desc)
+				continue;
+
+			if (target.color.IsValid())
+				gfx.DestroyRenderTarget(target.color);
+			if (target.depth.IsValid())
+				gfx.DestroyDepthTarget(target.depth);
+
+			target = Physical{ .desc = desc };
+			if (desc.type == RenderGraphResourceType::Color)
+				target.color = gfx.CreateRenderTarget(RenderTargetDesc{ .format = desc.format, .width = desc.width, .height = desc.height, .sampleCount = desc.sampleCount });
+			else
+				target.depth = gfx.CreateDepthTarget(DepthTargetDesc{ .width = desc.width, .height = desc.height, .sampleCount = desc.sampleCount });
+		}
+
+		for (u64 slot = slots.size(); slot < physical.size(); slot++) {
+			if (physical[slot].color.IsValid())
+				gfx.DestroyRenderTarget(physical[slot].color);
+			if (physical[slot].depth.IsValid())
+				gfx.DestroyDepthTarget(physical[slot].depth);
+		}
+		physical.resize(slots.size());
+
+		if (setupLists.size() < passes.size()) {
+			setupLists.resize(passes.size());
+			passLists.resize(passes.size());
+		}
+
+		for (u32 passIdx = 0; passIdx < passes.size(); passIdx++) {
+			auto& pass = passes[passIdx];
+			if (!pass.alive)
+				continue;
+
+			RenderTargetHandle color;
+			DepthTargetHandle depth;
+			Viewport viewport{};
+			for (const auto& access : pass.accesses) {
+				const auto& desc = resources[access.resource.id - 1].desc;
+				if (access.state == ResourceState::RenderTarget)
+					color = GetRenderTarget(access.resource);
+				else if (access.state == ResourceState::DepthWrite)
+					depth = GetDepthTarget(access.resource);
+				else
+					continue;
+
+				viewport = Viewport{ .x = 0.0f, .y = 0.0f, .width = static_cast<f32>(desc.width), .height = static_cast<f32>(desc.height) };
+			}
+
+			const bool hasTargets = color.IsValid() || depth.IsValid();
+
+			auto& setup = setupLists[passIdx];
+			setup.Reset();
+			if (hasTargets) {
+				setup.SetRenderTarget(color, depth);
+				setup.SetViewport(viewport);
+				if (pass.clearFlags != 0)
+					setup.Clear(pass.clearFlags, pass.clearColor, pass.clearDepth, 0);
+
+				gfx.Submit(std::span{ &setup, 1 });
+			}
+
+			auto& commands = passLists[passIdx];
+			commands.Reset();
+			if (hasTargets) {
+				commands.SetRenderTarget(color, depth);
+				commands.SetViewport(viewport);
+			}
+			const u32 setupCommands = commands.GetStats().commandCount;
+
+			auto context = RenderPassContext{ .gfx = gfx, .graph = *this, .commands = commands, .colorTarget = color, .depthTarget = depth, .viewport = viewport };
+			if (pass.execute)
+				pass.execute(context);
+
+			if (commands.GetStats().commandCount > setupCommands)
+				gfx.Submit(std::span{ &commands, 1 });
+		}
+	}
+
+	auto RenderGraph::Release(const PlatformInterface& gfx) -> void {
+		for (auto& target : physical) {
+			if (target.color.IsValid())
+				gfx.DestroyRenderTarget(target.color);
+			if (target.depth.IsValid())
+				gfx.DestroyDepthTarget(target.depth);
+		}
+
+		physical.clear();
+		Reset();
+	}
+
+	auto RenderGraph::GetRenderTarget(RenderGraphResource resource) const -> RenderTargetHandle {
+		const auto& r = resources[resource.id - 1];
+		if (r.imported)
+			return r.importedColor;
+
+		return r.physicalIdx >= 0 && r.physicalIdx < static_cast<i32>(physical.size()) ? physical[r.physicalIdx].color : RenderTargetHandle{};
+	}
+
+	auto RenderGraph::GetDepthTarget(RenderGraphResource resource) const -> DepthTargetHandle {
+		const auto& r = resources[resource.id - 1];
+		if (r.imported)
+			return r.importedDepth;
+
+		return r.physicalIdx >= 0 && r.physicalIdx < static_cast<i32>(physical.size()) ? physical[r.physicalIdx].depth : DepthTargetHandle{};
+	}
+
+	auto RenderGraph::FormatReport() const -> std::string {
+		const auto& r = report;
+		std::ostringstream out;
+		out << "render graph: " << r.passCount << " passes (" << r.culledPassCount << " culled), "
+			<< r.transientCount << " transients in " << r.physicalCount << " targets, "
+			<< FormatMiB(r.transientBytes) << " -> " << FormatMiB(r.physicalBytes) << " (saved " << FormatMiB(r.transientBytes - r.physicalBytes) << "), "
+			<< r.barrierCount << " barriers, " << r.derivedClearCount << " derived clears";
+
+		for (u32 passIdx = 0; passIdx < passes.size(); passIdx++) {
+			const auto& pass = passes[passIdx];
+			out << "\n  [" << passIdx << "] " << pass.name;
+			if (!pass.alive) {
+				out << " (culled)";
+				continue;
+			}
+
+			for (const auto& barrier : pass.barriers)
+				out << "\n      " << resources[barrier.resource.id - 1].name << ": " << ToString(barrier.before) << " -> " << ToString(barrier.after);
+		}
+
+		for (const auto& resource : resources) {
+			if (resource.imported || resource.physicalIdx < 0)
+				continue;
+
+			out << "\n  " << resource.name << " -> target " << resource.physicalIdx << ", passes " << resource.firstUse << ".." << resource.lastUse;
+		}
+
+		return out.str();
+	}
+}
\ No newline at end of file
@@ -0,0 +1,177 @@
+#pragma once
+
+#include "RendererPlatformInterface.h"
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace Nickel::Renderer {
+	using RenderGraphResource = Handle<struct RenderGraphResourceTag>; // NOTE: index + 1, only valid until the next Reset
+
+	enum class RenderGraphResourceType : u8 {
+		Color,
+		Depth
+	};
+
+	enum class LoadOp : u8 {
+		Load,    // NOTE: keeps what earlier passes wrote, becomes a clear when nothing wrote it yet this frame
+		Clear,
+		DontCare // NOTE: the pass overwrites every pixel
+	};
+
+	enum class ResourceState : u8 {
+		Undefined,
+		RenderTarget,
+		DepthWrite,
+		ShaderRead
+	};
+
+	struct RenderGraphBarrier {
+		RenderGraphResource resource;
+		ResourceState before;
+		ResourceState after;
+	};
+
+	struct RenderGraphReport {
+		u32 passCount;
+		u32 culledPassCount;
+		u32 transientCount;     // NOTE: transients used by at least one surviving pass
+		u32 physicalCount;      // NOTE: backend targets those transients were packed into
+		u64 transientBytes;     // NOTE: memory every transient would need on its own
+		u64 physicalBytes;      // NOTE: memory actually allocated after aliasing
+		u32 barrierCount;
+		u32 derivedClearCount;  // NOTE: Load on a resource nothing wrote yet this frame
+	};
+
+	class RenderGraph;
+
+	struct RenderPassContext {
+		const PlatformInterface& gfx;
+		const RenderGraph& graph;
+		CommandList& commands; // NOTE: starts with the pass targets and viewport bound, submitted after the pass returns
+
+		RenderTargetHandle colorTarget;
+		DepthTargetHandle depthTarget;
+		Viewport viewport;
+	};
+
+	// Declares what a pass touches, handed to the setup callback of RenderGraph::AddPass.
+	class RenderPassBuilder {
+	public:
+		auto WriteColor(RenderGraphResource resource, LoadOp load = LoadOp::Load, const f32 clearColor[4] = nullptr) -> void;
+		auto WriteDepth(RenderGraphResource resource, LoadOp load = LoadOp::Load, f32 clearDepth = 1.0f) -> void;
+		auto Read(RenderGraphResource resource) -> void; // NOTE: sampled by the pass' shaders
+		auto SetSideEffect() -> void; // NOTE: never culled, for passes whose output leaves the graph some other way
+
+	private:
+		friend class RenderGraph;
+		RenderPassBuilder(RenderGraph& graph, u32 passIdx) : graph(graph), passIdx(passIdx) {}
+
+		RenderGraph& graph;
+		u32 passIdx;
+	};
+
+	// Frame graph: passes are declared every frame with the targets they read and write, Compile culls passes
+	// whose output nobody reads, derives clears and state transitions, and packs transient targets with disjoint
+	// lifetimes into the same backend target. Compile never touches the backend, so graphs can be checked on the CPU.
+	// D3D11 can't place resources in shared heaps, so only transients with identical descriptions alias.
+	class RenderGraph {
+	public:
+		using ExecuteFn = std::function<void(RenderPassContext&)>;
+
+		auto Reset() -> void; // NOTE: keeps the backend targets and allocations for the next frame
+
+		auto ImportRenderTarget(const char* name, RenderTargetHandle target, const RenderTargetDesc& desc) -> RenderGraphResource;
+		auto ImportDepthTarget(const char* name, DepthTargetHandle target, const DepthTargetDesc& desc) -> RenderGraphResource;
+		auto CreateRenderTarget(const char* name, const RenderTargetDesc& desc) -> RenderGraphResource;
+		auto CreateDepthTarget(const char* name, const DepthTargetDesc& desc) -> RenderGraphResource;
+
+		template <typename SetupFn>
+		auto AddPass(const char* name, SetupFn&& setup, ExecuteFn execute) -> void {
+			passes.push_back(Pass{ .name = name, .execute = std::move(execute) });
+			RenderPassBuilder builder(*this, static_cast<u32>(passes.size() - 1));
+			setup(builder);
+		}
+
+		auto Compile() -> bool; // NOTE: logs and returns false for malformed graphs, Execute is a no-op then
+		auto Execute(const PlatformInterface& gfx) -> void;
+		auto Release(const PlatformInterface& gfx) -> void; // NOTE: destroys the backend targets backing transients
+
+		auto GetRenderTarget(RenderGraphResource resource) const -> RenderTargetHandle;
+		auto GetDepthTarget(RenderGraphResource resource) const -> DepthTargetHandle;
+
+		inline auto IsCulled(u32 passIdx) const -> bool { return !passes[passIdx].alive; }
+		inline auto GetBarriers(u32 passIdx) const -> std::span<const RenderGraphBarrier> { return passes[passIdx].barriers; }
+		inline auto GetPhysicalIndex(RenderGraphResource resource) const -> i32 { return resources[resource.id - 1].physicalIdx; }
+		inline auto GetReport() const -> const RenderGraphReport& { return report; }
+		auto FormatReport() const -> std::string;
+
+	private:
+		friend class RenderPassBuilder;
+
+		struct TargetDesc {
+			RenderGraphResourceType type;
+			TextureFormat format;
+			u32 width, height;
+			u32 sampleCount;
+
+			friend auto operator==(const TargetDesc& a, const TargetDesc& b) -> bool = default;
+		};
+
+		struct Resource {
+			const char* name;
+			TargetDesc desc;
+			bool imported;
+			RenderTargetHandle importedColor;
+			DepthTargetHandle importedDepth;
+
+			// NOTE: filled by Compile
+			i32 firstUse, lastUse; // NOTE: surviving pass indices, -1 when unused
+			i32 physicalIdx;
+		};
+
+		struct Access {
+			RenderGraphResource resource;
+			ResourceState state;
+			LoadOp load;
+			f32 clearColor[4];
+			f32 clearDepth;
+		};
+
+		struct Pass {
+			const char* name;
+			ExecuteFn execute;
+			std::vector<Access> accesses;
+			bool sideEffect = false;
+
+			// NOTE: filled by Compile
+			bool alive = false;
+			u32 clearFlags = 0;
+			f32 clearColor[4] = {};
+			f32 clearDepth = 1.0f;
+			std::vector<RenderGraphBarrier> barriers;
+		};
+
+		struct Physical {
+			TargetDesc desc;
+			RenderTargetHandle color;
+			DepthTargetHandle depth;
+		};
+
+		auto AddResource(Resource resource) -> RenderGraphResource;
+		auto AddAccess(u32 passIdx, Access access) -> void;
+		auto Validate() const -> bool;
+		auto CullPasses() -> void;
+		auto DeriveStates() -> void;
+		auto AssignPhysical() -> void;
+
+		std::vector<Resource> resources;
+		std::vector<Pass> passes;
+		std::vector<TargetDesc> slots;       // NOTE: physical targets this frame needs, from Compile
+		std::vector<Physical> physical;      // NOTE: backend targets, kept across frames and recreated when a slot changes
+		std::vector<CommandList> setupLists; // NOTE: one per pass, targets and clears submitted before the pass executes
+		std::vector<CommandList> passLists;
+		RenderGraphReport report{};
+		bool compiled = false;
+	};
+}
\ No newline at end of file
@@ -1,10 +1,60 @@
 #pragma once
 
-#include "renderer.h"
+#include "RendererTypes.h"
+#include "CommandList.h"
 
 namespace Nickel::Renderer {
+	struct PlatformInitDesc {
+		void* windowHandle = nullptr; // NOTE: HWND on Windows, ignored by headless backends
+		u32 width;
+		u32 height;
+		u32 sampleCount = 1; // NOTE: MSAA samples of the backbuffer, ignored by backends that can't multisample
+		bool parallelSubmission = false; // NOTE: replay command lists on worker threads when the backend supports it
+	};
+
+	// Everything the renderer needs from a graphics API. Resources are created up front and referenced
+	// by handle, draws only reach the backend through recorded CommandLists.
 	struct PlatformInterface {
-		auto (*Init)(void) -> bool;
+		auto (*Init)(const PlatformInitDesc& desc) -> bool;
 		auto (*Shutdown)(void) -> void;
+
+		auto (*CreateBuffer)(const BufferDesc& desc, const void* initialData) -> BufferHandle;
+		auto (*UpdateBuffer)(BufferHandle buffer, const void* data, u32 size) -> void;
+		auto (*DestroyBuffer)(BufferHandle buffer) -> void;
+
+		auto (*CreateTexture)(const TextureDesc& desc, std::span<const SubresourceData> initialData) -> TextureHandle;
+		auto (*DestroyTexture)(TextureHandle texture) -> void;
+
+		auto (*CreateSampler)(const SamplerDesc& desc) -> SamplerHandle;
+		auto (*DestroySampler)(SamplerHandle sampler) -> void;
+
+		auto (*CreateTextureTable)(const TextureTableDesc& desc) -> TextureTableHandle;
+		auto (*DestroyTextureTable)(TextureTableHandle table) -> void;
+
+		auto (*CreateRasterizerState)(const RasterizerDesc& desc) -> RasterizerStateHandle;
+		auto (*DestroyRasterizerState)(RasterizerStateHandle state) -> void;
+
+		auto (*CreateDepthStencilState)(const DepthStencilDesc& desc) -> DepthStencilStateHandle;
+		auto (*DestroyDepthStencilState)(DepthStencilStateHandle state) -> void;
+
+		auto (*CreateProgram)(const ProgramDesc& desc) -> ProgramHandle;
+		auto (*DestroyProgram)(ProgramHandle program) -> void;
+
+		auto (*CreatePipeline)(const PipelineDesc& desc) -> PipelineHandle;
+		auto (*DestroyPipeline)(PipelineHandle pipeline) -> void;
+
+		auto (*CreateRenderTarget)(const RenderTargetDesc& desc) -> RenderTargetHandle;
+		auto (*DestroyRenderTarget)(RenderTargetHandle target) -> void;
+		auto (*CreateDepthTarget)(const DepthTargetDesc& desc) -> DepthTargetHandle;
+		auto (*DestroyDepthTarget)(DepthTargetHandle target) -> void;
+		auto (*GetBackbuffer)(void) -> RenderTargetHandle;
+
+		auto (*Submit)(std::span<const CommandList> lists) -> void; // NOTE: lists are executed in order
+		auto (*Present)(void) -> void;
 	};
+
+	template <typename T>
+	inline auto UpdateBuffer(const PlatformInterface& gfx, BufferHandle buffer, const T& data) -> void {
+		gfx.UpdateBuffer(buffer, std::addressof(data), sizeof(T));
+	}
 }
\ No newline at end of file
@@ -0,0 +1,252 @@
+#pragma once
+
+#include "../platform.h"
+
+// NOTE: backend-neutral renderer types - nothing in here may depend on a graphics API header
+namespace Nickel::Renderer {
+	template <typename Tag>
+	struct Handle {
+		u32 id = 0; // NOTE: 0 is reserved as the invalid handle
+
+		inline auto IsValid() const -> bool { return id != 0; }
+		friend auto operator==(const Handle& a, const Handle& b) -> bool = default;
+	};
+
+	using BufferHandle            = Handle<struct BufferTag>;
+	using TextureHandle           = Handle<struct TextureTag>;
+	using SamplerHandle           = Handle<struct SamplerTag>;
+	using ProgramHandle           = Handle<struct ProgramTag>;
+	using RasterizerStateHandle   = Handle<struct RasterizerStateTag>;
+	using DepthStencilStateHandle = Handle<struct DepthStencilStateTag>;
+	using RenderTargetHandle      = Handle<struct RenderTargetTag>;
+	using DepthTargetHandle       = Handle<struct DepthTargetTag>;
+	using PipelineHandle          = Handle<struct PipelineTag>;
+	using TextureTableHandle      = Handle<struct TextureTableTag>;
+
+	enum class ClearFlag {
+		CLEAR_COLOR   = 1 << 0,
+		CLEAR_DEPTH   = 1 << 1,
+		CLEAR_STENCIL = 1 << 2
+	};
+
+	inline ClearFlag operator|(ClearFlag a, ClearFlag b) {
+		return static_cast<ClearFlag>(static_cast<u32>(a) | static_cast<u32>(b));
+	}
+
+	enum class PrimitiveTopology : u8 {
+		TriangleList,
+		TriangleStrip,
+		LineList,
+		LineStrip,
+		PointList
+	};
+
+	enum class IndexFormat : u8 {
+		U16,
+		U32
+	};
+
+	enum class ShaderStage : u8 {
+		Vertex,
+		Pixel
+	};
+
+	using PermutationKey = u32; // NOTE: feature bits of a shader variant, laid out per program in ShaderPermutations.h
+
+	struct Viewport {
+		f32 x, y;
+		f32 width, height;
+		f32 minDepth = 0.0f;
+		f32 maxDepth = 1.0f;
+	};
+
+	// Resource descriptions ---------------------------
+
+	enum class BufferType : u8 {
+		Vertex,
+		Index,
+		Constant,
+		Structured // NOTE: read by shaders as StructuredBuffer<T>, bound to texture slots with SetShaderBuffer
+	};
+
+	enum class BufferUsage : u8 {
+		Default, // NOTE: GPU resident, updated with UpdateBuffer
+		Dynamic  // NOTE: CPU writable every frame
+	};
+
+	struct BufferDesc {
+		BufferType type;
+		BufferUsage usage = BufferUsage::Default;
+		u32 size;
+		u32 stride = 0; // NOTE: vertex buffers and the element size of structured buffers
+	};
+
+	enum class TextureFormat : u8 {
+		RGBA8_UNORM,
+		RGBA16_FLOAT,
+		RGBA32_FLOAT,
+		RG16_FLOAT,
+		R32_FLOAT,
+		BC1_UNORM, // NOTE: block compressed, 4x4 texels per block. RGB, 8 bytes a block
+		BC5_UNORM, // NOTE: two independent channels (normal map XY), 16 bytes a block
+		BC7_UNORM  // NOTE: RGBA, 16 bytes a block
+	};
+
+	enum class TextureType : u8 {
+		Texture2D,
+		TextureCube
+	};
+
+	struct TextureDesc {
+		TextureType type = TextureType::Texture2D;
+		TextureFormat format = TextureFormat::RGBA8_UNORM;
+		u32 width;
+		u32 height;
+		u32 mipLevels = 1;
+		u32 arraySize = 1; // NOTE: 6 for cube maps
+	};
+
+	// NOTE: one entry per subresource, ordered [arraySlice][mip]
+	struct SubresourceData {
+		const void* data;
+		u32 rowPitch;
+	};
+
+	enum class TextureFilter : u8 {
+		Point,
+		Linear,
+		Anisotropic
+	};
+
+	enum class TextureAddressMode : u8 {
+		Wrap,
+		Clamp,
+		Mirror
+	};
+
+	struct SamplerDesc {
+		TextureFilter filter = TextureFilter::Linear;
+		TextureAddressMode addressMode = TextureAddressMode::Wrap;
+		u32 maxAnisotropy = 1;
+
+		friend auto operator==(const SamplerDesc& a, const SamplerDesc& b) -> bool = default;
+	};
+
+	enum class CullMode : u8 {
+		None,
+		Front,
+		Back
+	};
+
+	enum class FillMode : u8 {
+		Solid,
+		Wireframe
+	};
+
+	struct RasterizerDesc {
+		CullMode cullMode = CullMode::Back;
+		FillMode fillMode = FillMode::Solid;
+		bool frontCounterClockwise = false;
+		bool depthClip = true;
+
+		friend auto operator==(const RasterizerDesc& a, const RasterizerDesc& b) -> bool = default;
+	};
+
+	enum class ComparisonFunc : u8 {
+		Never,
+		Less,
+		Equal,
+		LessEqual,
+		Greater,
+		NotEqual,
+		GreaterEqual,
+		Always
+	};
+
+	struct DepthStencilDesc {
+		bool depthTest = true;
+		bool depthWrite = true;
+		ComparisonFunc depthFunc = ComparisonFunc::Less;
+		bool stencilTest = false;
+
+		friend auto operator==(const DepthStencilDesc& a, const DepthStencilDesc& b) -> bool = default;
+	};
+
+	enum class ShaderComponentType : u8 {
+		Uint32,
+		Sint32,
+		Float32
+	};
+
+	// NOTE: one vertex shader input, extracted offline so backends don't have to reflect bytecode to build a layout
+	struct ShaderInputElement {
+		const char* semanticName;
+		u32 semanticIndex;
+		ShaderComponentType componentType;
+		u32 componentCount; // NOTE: 1-4
+	};
+
+	struct ProgramDesc {
+		std::span<const u8> vertexShaderBytecode;
+		std::span<const u8> pixelShaderBytecode;
+		std::span<const ShaderInputElement> inputSignature; // NOTE: empty makes the D3D11 backend reflect the bytecode instead
+		const char* name = nullptr; // NOTE: debug name, the software backend uses it to pick its C++ port of the shaders
+		PermutationKey permutationKey = 0; // NOTE: the variant the bytecode was compiled as, picks the matching C++ port
+	};
+
+	// NOTE: program and fixed-function state bound together by a single SetPipeline, the states stay owned by the caller
+	struct PipelineDesc {
+		ProgramHandle program;
+		RasterizerStateHandle rasterizerState;
+		DepthStencilStateHandle depthStencilState;
+		u32 stencilRef = 1;
+	};
+
+	// NOTE: immutable set of textures bound to slots [0, textures.size()) and samplers to [0, samplers.size()) with one command
+	struct TextureTableDesc {
+		std::span<const TextureHandle> textures;
+		std::span<const SamplerHandle> samplers;
+	};
+
+	struct RenderTargetDesc {
+		TextureFormat format = TextureFormat::RGBA8_UNORM;
+		u32 width;
+		u32 height;
+		u32 sampleCount = 1; // NOTE: has to match the depth target it's bound with
+	};
+
+	struct DepthTargetDesc {
+		u32 width;
+		u32 height;
+		u32 sampleCount = 1;
+	};
+
+	// NOTE: 0 for block compressed formats, their sizes come from GetRowPitch and GetRowCount
+	constexpr auto GetTexelSize(TextureFormat format) -> u32 {
+		switch (format) {
+			case TextureFormat::RGBA8_UNORM:  return 4;
+			case TextureFormat::RGBA16_FLOAT: return 8;
+			case TextureFormat::RGBA32_FLOAT: return 16;
+			case TextureFormat::RG16_FLOAT:   return 4;
+			case TextureFormat::R32_FLOAT:    return 4;
+			default:                          return 0;
+		}
+	}
+
+	constexpr auto IsBlockCompressed(TextureFormat format) -> bool {
+		return format == TextureFormat::BC1_UNORM || format == TextureFormat::BC5_UNORM || format == TextureFormat::BC7_UNORM;
+	}
+
+	constexpr auto GetBlockSize(TextureFormat format) -> u32 {
+		return format == TextureFormat::BC1_UNORM ? 8 : 16;
+	}
+
+	// NOTE: bytes of one tightly packed row, a row of blocks for block compressed formats
+	constexpr auto GetRowPitch(TextureFormat format, u32 width) -> u32 {
+		return IsBlockCompressed(format) ? (width + 3) / 4 * GetBlockSize(format) : width * GetTexelSize(format);
+	}
+
+	constexpr auto GetRowCount(TextureFormat format, u32 height) -> u32 {
+		return IsBlockCompressed(format) ? (height + 3) / 4 : height;
+	}
+}
\ No newline at end of file
@@ -0,0 +1,82 @@
+#pragma once
+
+#include "../platform.h"
+
+// On-disk layout of the cooked shader archive, written by ShaderCooker and mapped as-is by ShaderLibrary.
+// Little endian, every table is 4 byte aligned, offsets are from the start of the file and names are offsets
+// into the NUL-terminated string pool.
+namespace Nickel::Renderer::ShaderArchiveFormat {
+	constexpr u32 Magic = 'N' | ('S' << 8) | ('H' << 16) | ('A' << 24);
+	constexpr u32 Version = 2;
+
+	struct Header {
+		u32 magic;
+		u32 version;
+		u32 fileSize;
+		u32 programCount;
+		u32 programsOffset; // NOTE: sorted by name then permutation key, looked up with a binary search
+		u32 shaderCount;
+		u32 shadersOffset;
+		u32 inputCount;
+		u32 inputsOffset;
+		u32 constantBufferCount;
+		u32 constantBuffersOffset;
+		u32 bindingCount;
+		u32 bindingsOffset;
+		u32 stringsOffset;
+		u32 stringsSize;
+	};
+
+	// NOTE: one entry per compiled variant, variants of a program sit next to each other
+	struct Program {
+		u32 name;
+		u32 permutationKey;
+		u32 vertexShader; // NOTE: indices into the shader table, programs share shaders
+		u32 pixelShader;
+	};
+
+	// NOTE: a shader's inputs, constant buffers and bindings are contiguous ranges of the shared tables
+	struct Shader {
+		u32 name;
+		u32 bytecodeOffset;
+		u32 bytecodeSize;
+		u32 firstInput;
+		u32 inputCount;
+		u32 firstConstantBuffer;
+		u32 constantBufferCount;
+		u32 firstBinding;
+		u32 bindingCount;
+	};
+
+	struct InputElement {
+		u32 semanticName;
+		u32 semanticIndex;
+		u8 componentType; // NOTE: ShaderComponentType
+		u8 componentCount;
+		u16 padding;
+	};
+
+	struct ConstantBuffer {
+		u32 name;
+		u32 slot;
+		u32 size;
+	};
+
+	enum class BindingType : u8 {
+		ConstantBuffer,
+		Texture,
+		Sampler,
+		Other // NOTE: tbuffers, structured buffers, UAVs - recorded so the slot shows up, nothing binds them yet
+	};
+
+	struct ResourceBinding {
+		u32 name;
+		BindingType type;
+		u8 padding[3];
+		u32 slot;
+		u32 count;
+	};
+
+	static_assert(sizeof(Header) == 60 && sizeof(Program) == 16 && sizeof(Shader) == 36);
+	static_assert(sizeof(InputElement) == 12 && sizeof(ConstantBuffer) == 12 && sizeof(ResourceBinding) == 16);
+}
\ No newline at end of file
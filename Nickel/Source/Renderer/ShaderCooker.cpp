@@ -0,0 +1,670 @@
+#include "ShaderCooker.h"
+#include "TextureCache.h"
+#include <algorithm>
+#include <bit>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <unordered_map>
+#if defined(_WIN32)
+#include <d3dcompiler.h>
+#endif
+
+namespace Nickel::Renderer::ShaderCooker {
+	namespace {
+		constexpr auto FourCC(char a, char b, char c, char d) -> u32 {
+			return static_cast<u32>(a) | (static_cast<u32>(b) << 8) | (static_cast<u32>(c) << 16) | (static_cast<u32>(d) << 24);
+		}
+
+		// NOTE: bounds-checked little endian reads, a bad offset clears 'ok' instead of reading past the blob
+		struct BlobReader {
+			std::span<const u8> bytes;
+			bool ok = true;
+
+			auto U32(u64 offset) -> u32 {
+				if (offset + 4 > bytes.size()) {
+					ok = false;
+					return 0;
+				}
+
+				u32 value;
+				std::memcpy(&value, bytes.data() + offset, sizeof(value));
+				return value;
+			}
+
+			auto String(u64 offset) -> std::string {
+				if (offset >= bytes.size()) {
+					ok = false;
+					return {};
+				}
+
+				const auto begin = reinterpret_cast<const char*>(bytes.data() + offset);
+				const auto end = reinterpret_cast<const char*>(bytes.data() + bytes.size());
+				const auto terminator = std::find(begin, end, '\0');
+				if (terminator == end) {
+					ok = false;
+					return {};
+				}
+
+				return std::string(begin, terminator);
+			}
+		};
+
+		auto FindChunk(std::span<const u8> bytecode, u32 fourCC) -> std::span<const u8> {
+			BlobReader container{ bytecode };
+			const u32 chunkCount = container.U32(28);
+			for (u32 i = 0; i < chunkCount && container.ok; i++) {
+				const u64 chunkOffset = container.U32(32 + 4ull * i);
+				const u32 chunkFourCC = container.U32(chunkOffset);
+				const u64 chunkSize = container.U32(chunkOffset + 4);
+				if (!container.ok || chunkOffset + 8 + chunkSize > bytecode.size())
+					return {};
+
+				if (chunkFourCC == fourCC)
+					return bytecode.subspan(chunkOffset + 8, chunkSize);
+			}
+
+			return {};
+		}
+
+		// NOTE: D3D_SHADER_INPUT_TYPE and D3D_CBUFFER_TYPE values, the container stores them as they are
+		constexpr u32 InputTypeConstantBuffer = 0;
+		constexpr u32 InputTypeTexture = 2;
+		constexpr u32 InputTypeSampler = 3;
+		constexpr u32 ConstantBufferTypeCBuffer = 0;
+
+		// NOTE: ISGN - u32 count, u32 unused, then 24 byte elements, names relative to the chunk
+		auto ReflectInputSignature(std::span<const u8> chunk, ShaderReflection& reflection) -> bool {
+			BlobReader reader{ chunk };
+			const u32 count = reader.U32(0);
+			for (u32 i = 0; i < count && reader.ok; i++) {
+				const u64 element = 8 + 24ull * i;
+				const u32 nameOffset = reader.U32(element + 0);
+				const u32 semanticIndex = reader.U32(element + 4);
+				const u32 systemValue = reader.U32(element + 8);
+				const u32 componentType = reader.U32(element + 12);
+				const u32 mask = reader.U32(element + 20) & 0xF;
+				if (systemValue != 0)
+					continue;
+
+				if (componentType < 1 || componentType > 3 || mask == 0) {
+					Logger::Error("[ShaderCooker]: unsupported vertex input component type");
+					return false;
+				}
+
+				reflection.inputs.push_back(ReflectedInput{
+					.semanticName = reader.String(nameOffset),
+					.semanticIndex = semanticIndex,
+					.componentType = static_cast<ShaderComponentType>(componentType - 1), // NOTE: D3D_REGISTER_COMPONENT_UINT32 is 1
+					.componentCount = static_cast<u32>(std::bit_width(mask))
+				});
+			}
+
+			return reader.ok;
+		}
+
+		// NOTE: RDEF - cbuffer count/offset, binding count/offset, then the target version. SM 5.1 grew the
+		// binding entries by a register space and an id, nothing in here is compiled for it yet but it's cheap to handle
+		auto ReflectResources(std::span<const u8> chunk, ShaderReflection& reflection) -> bool {
+			BlobReader reader{ chunk };
+			const u32 constantBufferCount = reader.U32(0);
+			const u32 constantBufferOffset = reader.U32(4);
+			const u32 bindingCount = reader.U32(8);
+			const u32 bindingOffset = reader.U32(12);
+			const u32 version = reader.U32(16) & 0xFFFF;
+			const u32 bindingStride = version >= 0x0501 ? 40 : 32;
+
+			for (u32 i = 0; i < bindingCount && reader.ok; i++) {
+				const u64 binding = bindingOffset + static_cast<u64>(bindingStride) * i;
+				const u32 inputType = reader.U32(binding + 4);
+				auto type = ShaderArchiveFormat::BindingType::Other;
+				if (inputType == InputTypeConstantBuffer)
+					type = ShaderArchiveFormat::BindingType::ConstantBuffer;
+				else if (inputType == InputTypeTexture)
+					type = ShaderArchiveFormat::BindingType::Texture;
+				else if (inputType == InputTypeSampler)
+					type = ShaderArchiveFormat::BindingType::Sampler;
+
+				reflection.bindings.push_back(ReflectedBinding{
+					.name = reader.String(reader.U32(binding + 0)),
+					.type = type,
+					.slot = reader.U32(binding + 20),
+					.count = reader.U32(binding + 24)
+				});
+			}
+
+			// NOTE: the cbuffer descriptions only carry a size, the slot comes from the binding with the same name
+			for (u32 i = 0; i < constantBufferCount && reader.ok; i++) {
+				const u64 constantBuffer = constantBufferOffset + 24ull * i;
+				if (reader.U32(constantBuffer + 20) != ConstantBufferTypeCBuffer)
+					continue;
+
+				auto name = reader.String(reader.U32(constantBuffer + 0));
+				const auto binding = std::find_if(reflection.bindings.begin(), reflection.bindings.end(), [&](const ReflectedBinding& b) {
+					return b.type == ShaderArchiveFormat::BindingType::ConstantBuffer && b.name == name;
+				});
+				if (binding == reflection.bindings.end())
+					continue; // NOTE: declared but optimized out
+
+				reflection.constantBuffers.push_back(ReflectedConstantBuffer{ .name = std::move(name), .slot = binding->slot, .size = reader.U32(constantBuffer + 12) });
+			}
+
+			return reader.ok;
+		}
+
+		auto ReadFile(const std::filesystem::path& path, std::vector<u8>& bytes) -> bool {
+			std::ifstream file(path, std::ios::binary | std::ios::ate);
+			if (!file)
+				return false;
+
+			bytes.resize(static_cast<size_t>(file.tellg()));
+			file.seekg(0);
+			return static_cast<bool>(file.read(reinterpret_cast<char*>(bytes.data()), static_cast<std::streamsize>(bytes.size())));
+		}
+
+		// NOTE: written next to the target and renamed over it, a failed write never leaves a half written file behind
+		auto WriteFile(const std::filesystem::path& path, std::span<const u8> bytes) -> bool {
+			auto temporaryPath = path;
+			temporaryPath += ".tmp";
+			{
+				std::ofstream file(temporaryPath, std::ios::binary | std::ios::trunc);
+				if (!file || !file.write(reinterpret_cast<const char*>(bytes.data()), static_cast<std::streamsize>(bytes.size()))) {
+					Logger::Error("[ShaderCooker]: failed to write " + temporaryPath.string());
+					return false;
+				}
+			}
+
+			std::error_code error;
+			std::filesystem::rename(temporaryPath, path, error);
+			if (error) {
+				Logger::Error("[ShaderCooker]: failed to replace " + path.string() + ": " + error.message());
+				return false;
+			}
+
+			return true;
+		}
+
+		auto ShaderPath(const char* compiledDir, const std::string& shader) -> std::filesystem::path {
+			return std::filesystem::path(compiledDir) / (shader + ".cso");
+		}
+
+		using SourceStamps = std::unordered_map<std::string, u64>;
+
+		// NOTE: "shader hash" per line, a missing or damaged file just has no stamps
+		auto ReadStamps(const char* compiledDir) -> SourceStamps {
+			SourceStamps stamps;
+			std::ifstream file(std::filesystem::path(compiledDir) / SourceStampsName);
+			std::string line;
+			while (std::getline(file, line)) {
+				std::istringstream fields(line.substr(0, line.find('#')));
+				std::string shader;
+				u64 hash;
+				if (fields >> shader >> std::hex >> hash)
+					stamps[shader] = hash;
+			}
+
+			return stamps;
+		}
+
+		auto WriteStamps(const char* compiledDir, const SourceStamps& stamps) -> bool {
+			std::vector<std::pair<std::string, u64>> sorted(stamps.begin(), stamps.end());
+			std::sort(sorted.begin(), sorted.end());
+
+			std::string text = "# FNV-1a of the HLSL each .cso was compiled from, includes and all. Written by the cooker, commit it with the bytecode\n";
+			for (const auto& [shader, hash] : sorted) {
+				char digits[17];
+				std::snprintf(digits, sizeof(digits), "%016llx", static_cast<unsigned long long>(hash));
+				text += shader + " " + digits + "\n";
+			}
+
+			return WriteFile(std::filesystem::path(compiledDir) / SourceStampsName, std::span{ reinterpret_cast<const u8*>(text.data()), text.size() });
+		}
+
+		// NOTE: the file, then every quoted include in the order they appear, each file once. Carriage returns are
+		// skipped so a CRLF checkout hashes the same as an LF one
+		auto HashSource(const std::filesystem::path& path, std::vector<std::filesystem::path>& visited, u64& hash) -> bool {
+			visited.push_back(path);
+			std::vector<u8> bytes;
+			if (!ReadFile(path, bytes))
+				return false;
+
+			bytes.erase(std::remove(bytes.begin(), bytes.end(), static_cast<u8>('\r')), bytes.end());
+			hash = HashBytes(bytes, hash);
+
+			std::istringstream lines(std::string(bytes.begin(), bytes.end()));
+			std::string line;
+			while (std::getline(lines, line)) {
+				const auto directive = line.find_first_not_of(" \t");
+				if (directive == std::string::npos || line.compare(directive, 8, "#include") != 0)
+					continue;
+
+				const auto open = line.find('"', directive);
+				const auto close = open == std::string::npos ? open : line.find('"', open + 1);
+				if (close == std::string::npos)
+					continue; // NOTE: <system> includes aren't part of the tree
+
+				const auto include = path.parent_path() / line.substr(open + 1, close - open - 1);
+				if (std::find(visited.begin(), visited.end(), include) == visited.end() && !HashSource(include, visited, hash))
+					return false;
+			}
+
+			return true;
+		}
+
+		// NOTE: true when <sourceDir>/<shader>.hlsl isn't what the stamp says the bytecode was compiled from. Shipped
+		// data without the sources, or a source that can't be read, has nothing to compare and counts as unchanged
+		auto SourceChanged(const char* sourceDir, const SourceStamps& stamps, const std::string& shader, u64& hash) -> bool {
+			std::vector<std::filesystem::path> visited;
+			hash = HashSeed;
+			if (!HashSource(std::filesystem::path(sourceDir) / (shader + ".hlsl"), visited, hash))
+				return false;
+
+			const auto stamp = stamps.find(shader);
+			return stamp == stamps.end() || stamp->second != hash;
+		}
+
+		auto ProgramVariants(const ProgramSource& source) -> std::vector<PermutationKey> {
+			const auto space = FindPermutationSpace(source.name);
+			if (space == nullptr)
+				return { 0 };
+
+			auto keys = ExpandPermutations(*space);
+			std::sort(keys.begin(), keys.end()); // NOTE: the archive keeps a program's variants in key order
+			return keys;
+		}
+
+		// NOTE: variants matching the default one in a stage reuse the FxCompile output, the others get the stage key appended
+		auto VariantShaderName(const std::string& shader, const PermutationSpace* space, PermutationKey key, ShaderStage stage) -> std::string {
+			if (space == nullptr)
+				return shader;
+
+			const PermutationKey stageKey = GetStageKey(*space, key, stage);
+			if (stageKey == GetStageKey(*space, space->defaultKey, stage))
+				return shader;
+
+			return shader + "." + std::to_string(stageKey);
+		}
+
+#if defined(_WIN32)
+		// NOTE: same settings as FxCompile in the project, the entry point is named after the shader
+		auto CompileVariant(const std::filesystem::path& source, const std::filesystem::path& output, const std::string& entryPoint, ShaderStage stage,
+			const std::vector<std::pair<std::string, std::string>>& defines) -> bool {
+			std::vector<D3D_SHADER_MACRO> macros;
+			for (const auto& [name, value] : defines)
+				macros.push_back(D3D_SHADER_MACRO{ name.c_str(), value.c_str() });
+			macros.push_back(D3D_SHADER_MACRO{ nullptr, nullptr });
+
+			ID3DBlob* code = nullptr;
+			ID3DBlob* messages = nullptr;
+			const HRESULT result = D3DCompileFromFile(source.c_str(), macros.data(), D3D_COMPILE_STANDARD_FILE_INCLUDE, entryPoint.c_str(),
+				stage == ShaderStage::Vertex ? "vs_5_0" : "ps_5_0", D3DCOMPILE_OPTIMIZATION_LEVEL3, 0, &code, &messages);
+
+			if (messages != nullptr) {
+				const std::string text(static_cast<const char*>(messages->GetBufferPointer()), messages->GetBufferSize());
+				SUCCEEDED(result) ? Logger::Warn("[ShaderCooker]: " + text) : Logger::Error("[ShaderCooker]: " + text);
+				messages->Release();
+			}
+
+			if (FAILED(result)) {
+				Logger::Error("[ShaderCooker]: failed to compile " + output.filename().string());
+				return false;
+			}
+
+			const bool written = WriteFile(output, std::span{ static_cast<const u8*>(code->GetBufferPointer()), code->GetBufferSize() });
+			code->Release();
+
+			return written;
+		}
+#endif
+
+		// NOTE: true when the variant's bytecode exists and isn't older than the default variant's, compiling it first
+		// where the compiler is available. Without one a stale variant is dropped, it may not match the C++ side anymore
+		auto PrepareVariant([[maybe_unused]] const char* sourceDir, const char* compiledDir, const std::string& shader, const std::string& variant,
+			[[maybe_unused]] const PermutationSpace& space, [[maybe_unused]] PermutationKey key, [[maybe_unused]] ShaderStage stage) -> bool {
+			if (variant == shader)
+				return true;
+
+			std::error_code variantError, shaderError;
+			const auto path = ShaderPath(compiledDir, variant);
+			const auto variantTime = std::filesystem::last_write_time(path, variantError);
+			const auto shaderTime = std::filesystem::last_write_time(ShaderPath(compiledDir, shader), shaderError);
+			if (!variantError && (shaderError || variantTime >= shaderTime))
+				return true;
+
+#if defined(_WIN32)
+			return CompileVariant(std::filesystem::path(sourceDir) / (shader + ".hlsl"), path, shader, stage, GetDefines(space, key, stage));
+#else
+			return false;
+#endif
+		}
+
+		// NOTE: FxCompile only runs on Windows, bytecode committed without rebuilding it would keep cooking the old shader.
+		// On Windows bytecode that's missing or out of date with its source is compiled again and restamped, elsewhere
+		// it's reported and cooked as it is
+		auto PrepareDefaultShaders([[maybe_unused]] const char* sourceDir, const char* compiledDir, const std::vector<ProgramSource>& sources) -> void {
+			auto stamps = ReadStamps(compiledDir);
+			bool restamped = false;
+			std::vector<std::string> prepared;
+			for (const auto& source : sources) {
+				[[maybe_unused]] const auto space = FindPermutationSpace(source.name);
+				for (const auto& [shader, stage] : { std::pair{ source.vertexShader, ShaderStage::Vertex }, std::pair{ source.pixelShader, ShaderStage::Pixel } }) {
+					if (std::find(prepared.begin(), prepared.end(), shader) != prepared.end())
+						continue;
+					prepared.push_back(shader);
+
+					u64 hash;
+					std::error_code error;
+					const auto path = ShaderPath(compiledDir, shader);
+					const bool changed = SourceChanged(sourceDir, stamps, shader, hash);
+#if defined(_WIN32)
+					if ((changed || !std::filesystem::exists(path, error)) && std::filesystem::exists(std::filesystem::path(sourceDir) / (shader + ".hlsl"), error) &&
+						CompileVariant(std::filesystem::path(sourceDir) / (shader + ".hlsl"), path, shader, stage,
+							space != nullptr ? GetDefines(*space, space->defaultKey, stage) : std::vector<std::pair<std::string, std::string>>{})) {
+						stamps[shader] = hash;
+						restamped = true;
+					}
+#else
+					if (changed && std::filesystem::exists(path, error))
+						Logger::Error("[ShaderCooker]: " + path.string() + " wasn't compiled from the current " + shader + ".hlsl, rebuild it with FxCompile and commit it with " + SourceStampsName);
+#endif
+				}
+			}
+
+			if (restamped)
+				WriteStamps(compiledDir, stamps);
+		}
+
+		struct CookedShader {
+			std::string name;
+			std::vector<u8> bytecode;
+			ShaderReflection reflection;
+		};
+
+		class StringPool {
+		public:
+			auto Add(const std::string& string) -> u32 {
+				if (const auto it = offsets.find(string); it != offsets.end())
+					return it->second;
+
+				const u32 offset = static_cast<u32>(bytes.size());
+				bytes.insert(bytes.end(), string.begin(), string.end());
+				bytes.push_back(0);
+				offsets.emplace(string, offset);
+
+				return offset;
+			}
+
+			std::vector<u8> bytes;
+
+		private:
+			std::unordered_map<std::string, u32> offsets;
+		};
+
+		template <typename T>
+		auto Append(std::vector<u8>& out, std::span<const T> items) -> void {
+			const auto bytes = std::as_bytes(items);
+			out.insert(out.end(), reinterpret_cast<const u8*>(bytes.data()), reinterpret_cast<const u8*>(bytes.data()) + bytes.size());
+		}
+
+		auto AlignTo(std::vector<u8>& out, size_t alignment) -> void {
+			out.resize((out.size() + alignment - 1) / alignment * alignment, 0);
+		}
+	}
+
+	auto ParseManifest(const char* manifestPath, std::vector<ProgramSource>& programs) -> bool {
+		std::ifstream manifest(manifestPath);
+		if (!manifest) {
+			Logger::Error(std::string("[ShaderCooker]: failed to open manifest ") + manifestPath);
+			return false;
+		}
+
+		programs.clear();
+		std::string line;
+		for (u32 lineNumber = 1; std::getline(manifest, line); lineNumber++) {
+			line = line.substr(0, line.find('#'));
+			std::istringstream fields(line);
+
+			ProgramSource program;
+			if (!(fields >> program.name))
+				continue; // NOTE: blank or comment
+
+			std::string flag, extra;
+			if (!(fields >> program.vertexShader >> program.pixelShader) || ((fields >> flag) && flag != "optional") || (fields >> extra)) {
+				Logger::Error(std::string("[ShaderCooker]: ") + manifestPath + ":" + std::to_string(lineNumber) + " isn't 'name vertexShader pixelShader [optional]'");
+				return false;
+			}
+			program.optional = !flag.empty();
+
+			programs.push_back(std::move(program));
+		}
+
+		return true;
+	}
+
+	auto ReflectBytecode(std::span<const u8> bytecode, ShaderReflection& reflection) -> bool {
+		reflection = {};
+
+		BlobReader container{ bytecode };
+		if (container.U32(0) != FourCC('D', 'X', 'B', 'C') || container.U32(24) != bytecode.size()) {
+			Logger::Error("[ShaderCooker]: bytecode isn't a DXBC container");
+			return false;
+		}
+
+		const auto resources = FindChunk(bytecode, FourCC('R', 'D', 'E', 'F'));
+		if (!resources.empty() && !ReflectResources(resources, reflection)) {
+			Logger::Error("[ShaderCooker]: broken resource definitions");
+			return false;
+		}
+
+		// NOTE: only vertex shaders keep their input signature, the program type sits next to the RDEF target version
+		constexpr u32 VertexProgramType = 0xFFFE;
+		const bool vertexShader = BlobReader{ resources }.U32(16) >> 16 == VertexProgramType;
+		const auto inputSignature = FindChunk(bytecode, FourCC('I', 'S', 'G', 'N'));
+		if (vertexShader && !inputSignature.empty() && !ReflectInputSignature(inputSignature, reflection)) {
+			Logger::Error("[ShaderCooker]: broken input signature");
+			return false;
+		}
+
+		return true;
+	}
+
+	auto Cook(const char* manifestPath, const char* sourceDir, const char* compiledDir, const char* archivePath) -> bool {
+		std::vector<ProgramSource> sources;
+		if (!ParseManifest(manifestPath, sources))
+			return false;
+
+		std::sort(sources.begin(), sources.end(), [](const ProgramSource& a, const ProgramSource& b) { return a.name < b.name; });
+		const auto duplicate = std::adjacent_find(sources.begin(), sources.end(), [](const ProgramSource& a, const ProgramSource& b) { return a.name == b.name; });
+		if (duplicate != sources.end()) {
+			Logger::Error("[ShaderCooker]: program '" + duplicate->name + "' is listed twice");
+			return false;
+		}
+
+		PrepareDefaultShaders(sourceDir, compiledDir, sources);
+
+		// NOTE: programs share shaders (the line and color programs reuse pixel shaders, variants reuse the stage
+		// without features), each one is stored once
+		std::vector<CookedShader> cookedShaders;
+		auto addShader = [&](const std::string& name) -> i32 {
+			for (u32 i = 0; i < cookedShaders.size(); i++)
+				if (cookedShaders[i].name == name)
+					return static_cast<i32>(i);
+
+			CookedShader shader{ .name = name };
+			const auto path = ShaderPath(compiledDir, name);
+			if (!ReadFile(path, shader.bytecode)) {
+				Logger::Error("[ShaderCooker]: failed to read " + path.string());
+				return -1;
+			}
+
+			if (!ReflectBytecode(shader.bytecode, shader.reflection)) {
+				Logger::Error("[ShaderCooker]: failed to reflect " + path.string());
+				return -1;
+			}
+
+			cookedShaders.push_back(std::move(shader));
+			return static_cast<i32>(cookedShaders.size() - 1);
+		};
+
+		StringPool strings;
+		std::vector<ShaderArchiveFormat::Program> programs;
+		for (const auto& source : sources) {
+			std::error_code error;
+			if (source.optional && (!std::filesystem::exists(ShaderPath(compiledDir, source.vertexShader), error) ||
+				!std::filesystem::exists(ShaderPath(compiledDir, source.pixelShader), error))) {
+				Logger::Warn("[ShaderCooker]: optional program '" + source.name + "' has no bytecode, it's left out of the archive");
+				continue;
+			}
+
+			const auto space = FindPermutationSpace(source.name);
+			u32 droppedVariants = 0;
+			for (const auto key : ProgramVariants(source)) {
+				const auto vertexName = VariantShaderName(source.vertexShader, space, key, ShaderStage::Vertex);
+				const auto pixelName = VariantShaderName(source.pixelShader, space, key, ShaderStage::Pixel);
+
+				// NOTE: the default variant is FxCompile's output, a missing one is an error addShader reports
+				if (space != nullptr && key != space->defaultKey &&
+					(!PrepareVariant(sourceDir, compiledDir, source.vertexShader, vertexName, *space, key, ShaderStage::Vertex) ||
+					 !PrepareVariant(sourceDir, compiledDir, source.pixelShader, pixelName, *space, key, ShaderStage::Pixel))) {
+					droppedVariants++;
+					continue;
+				}
+
+				const i32 vertexShader = addShader(vertexName);
+				const i32 pixelShader = addShader(pixelName);
+				if (vertexShader < 0 || pixelShader < 0)
+					return false;
+
+				programs.push_back(ShaderArchiveFormat::Program{ .name = strings.Add(source.name), .permutationKey = key,
+					.vertexShader = static_cast<u32>(vertexShader), .pixelShader = static_cast<u32>(pixelShader) });
+			}
+
+			if (droppedVariants > 0)
+				Logger::Info("[ShaderCooker]: " + std::to_string(droppedVariants) + " variants of '" + source.name + "' have no up to date bytecode, they fall back to the default one");
+		}
+
+		std::vector<ShaderArchiveFormat::Shader> shaders;
+		std::vector<ShaderArchiveFormat::InputElement> inputs;
+		std::vector<ShaderArchiveFormat::ConstantBuffer> constantBuffers;
+		std::vector<ShaderArchiveFormat::ResourceBinding> bindings;
+		for (const auto& shader : cookedShaders) {
+			shaders.push_back(ShaderArchiveFormat::Shader{
+				.name = strings.Add(shader.name),
+				.bytecodeSize = static_cast<u32>(shader.bytecode.size()),
+				.firstInput = static_cast<u32>(inputs.size()),
+				.inputCount = static_cast<u32>(shader.reflection.inputs.size()),
+				.firstConstantBuffer = static_cast<u32>(constantBuffers.size()),
+				.constantBufferCount = static_cast<u32>(shader.reflection.constantBuffers.size()),
+				.firstBinding = static_cast<u32>(bindings.size()),
+				.bindingCount = static_cast<u32>(shader.reflection.bindings.size())
+			});
+
+			for (const auto& input : shader.reflection.inputs)
+				inputs.push_back(ShaderArchiveFormat::InputElement{ .semanticName = strings.Add(input.semanticName), .semanticIndex = input.semanticIndex,
+					.componentType = static_cast<u8>(input.componentType), .componentCount = static_cast<u8>(input.componentCount) });
+			for (const auto& constantBuffer : shader.reflection.constantBuffers)
+				constantBuffers.push_back(ShaderArchiveFormat::ConstantBuffer{ .name = strings.Add(constantBuffer.name), .slot = constantBuffer.slot, .size = constantBuffer.size });
+			for (const auto& binding : shader.reflection.bindings)
+				bindings.push_back(ShaderArchiveFormat::ResourceBinding{ .name = strings.Add(binding.name), .type = binding.type, .slot = binding.slot, .count = binding.count });
+		}
+
+		// NOTE: header, the tables, the string pool, then the bytecode blobs 16 byte aligned
+		ShaderArchiveFormat::Header header{
+			.magic = ShaderArchiveFormat::Magic,
+			.version = ShaderArchiveFormat::Version,
+			.programCount = static_cast<u32>(programs.size()),
+			.shaderCount = static_cast<u32>(shaders.size()),
+			.inputCount = static_cast<u32>(inputs.size()),
+			.constantBufferCount = static_cast<u32>(constantBuffers.size()),
+			.bindingCount = static_cast<u32>(bindings.size()),
+			.stringsSize = static_cast<u32>(strings.bytes.size())
+		};
+
+		std::vector<u8> archive(sizeof(header));
+		header.programsOffset = static_cast<u32>(archive.size());
+		Append(archive, std::span<const ShaderArchiveFormat::Program>{ programs });
+		header.shadersOffset = static_cast<u32>(archive.size());
+		Append(archive, std::span<const ShaderArchiveFormat::Shader>{ shaders }); // NOTE: bytecode offsets are patched below
+		header.inputsOffset = static_cast<u32>(archive.size());
+		Append(archive, std::span<const ShaderArchiveFormat::InputElement>{ inputs });
+		header.constantBuffersOffset = static_cast<u32>(archive.size());
+		Append(archive, std::span<const ShaderArchiveFormat::ConstantBuffer>{ constantBuffers });
+		header.bindingsOffset = static_cast<u32>(archive.size());
+		Append(archive, std::span<const ShaderArchiveFormat::ResourceBinding>{ bindings });
+		header.stringsOffset = static_cast<u32>(archive.size());
+		Append(archive, std::span<const u8>{ strings.bytes });
+
+		for (u32 i = 0; i < shaders.size(); i++) {
+			AlignTo(archive, 16);
+			shaders[i].bytecodeOffset = static_cast<u32>(archive.size());
+			Append(archive, std::span<const u8>{ cookedShaders[i].bytecode });
+		}
+
+		header.fileSize = static_cast<u32>(archive.size());
+		std::memcpy(archive.data(), &header, sizeof(header));
+		std::memcpy(archive.data() + header.shadersOffset, shaders.data(), shaders.size() * sizeof(ShaderArchiveFormat::Shader));
+
+		const auto path = std::filesystem::path(archivePath);
+		if (!WriteFile(path, archive))
+			return false;
+
+		Logger::Info("[ShaderCooker]: cooked " + std::to_string(programs.size()) + " program variants (" + std::to_string(shaders.size()) + " shaders, " +
+			std::to_string(archive.size()) + " bytes) into " + path.string());
+
+		return true;
+	}
+
+	auto CookIfStale(const char* manifestPath, const char* sourceDir, const char* compiledDir, const char* archivePath) -> bool {
+		namespace fs = std::filesystem;
+		std::error_code error;
+
+		const bool haveArchive = fs::exists(archivePath, error);
+		if (!fs::exists(manifestPath, error)) {
+			if (!haveArchive)
+				Logger::Error(std::string("[ShaderCooker]: neither ") + archivePath + " nor " + manifestPath + " to cook it from exist");
+			return haveArchive;
+		}
+
+		if (haveArchive) {
+			std::vector<ProgramSource> sources;
+			if (!ParseManifest(manifestPath, sources))
+				return false;
+
+			const auto archiveTime = fs::last_write_time(archivePath, error);
+			bool stale = error || fs::last_write_time(manifestPath, error) > archiveTime;
+			for (u32 i = 0; i < sources.size() && !stale; i++) {
+				const auto space = FindPermutationSpace(sources[i].name);
+				for (const auto key : ProgramVariants(sources[i])) {
+					for (const auto& [shader, stage] : { std::pair{ sources[i].vertexShader, ShaderStage::Vertex }, std::pair{ sources[i].pixelShader, ShaderStage::Pixel } }) {
+						const auto variant = VariantShaderName(shader, space, key, stage);
+						const auto time = fs::last_write_time(ShaderPath(compiledDir, variant), error);
+						if (variant == shader)
+							stale |= error ? !sources[i].optional : time > archiveTime; // NOTE: missing bytecode counts as stale, the cook then reports it
+						else if (!error)
+							stale |= time > archiveTime;
+#if defined(_WIN32)
+						else
+							stale = true; // NOTE: a missing variant the cook can compile
+#endif
+					}
+				}
+			}
+
+			// NOTE: bytecode compiled from an older source, the cook compiles it again or reports it
+			const auto stamps = ReadStamps(compiledDir);
+			for (u32 i = 0; i < sources.size() && !stale; i++) {
+				for (const auto& shader : { sources[i].vertexShader, sources[i].pixelShader }) {
+					u64 hash;
+					stale |= fs::exists(ShaderPath(compiledDir, shader), error) && SourceChanged(sourceDir, stamps, shader, hash);
+				}
+			}
+
+			if (!stale)
+				return true;
+		}
+
+		return Cook(manifestPath, sourceDir, compiledDir, archivePath);
+	}
+}
\ No newline at end of file
@@ -0,0 +1,66 @@
+#pragma once
+
+#include "RendererTypes.h"
+#include "ShaderArchiveFormat.h"
+#include "ShaderPermutations.h"
+#include <string>
+#include <vector>
+
+// Packs FXC output into the shader archive ShaderLibrary maps at startup. The manifest lists one program per line
+// as "name vertexShader pixelShader [optional]", shaders are read from <compiledDir>/<shader>.cso. An optional
+// program whose bytecode is missing is left out of the archive with a warning instead of failing the cook. Reflection is done here by
+// reading the DXBC container directly, so cooking doesn't need the D3D compiler and works on every platform.
+// Programs with a permutation space get one entry per variant. FxCompile only builds the default variant, the
+// others are compiled from <sourceDir>/<shader>.hlsl into <compiledDir>/<shader>.<stage key>.cso on Windows.
+// Elsewhere variants without bytecode are left out and the library falls back to the default one. The default
+// variants are stamped with a hash of the source they were compiled from, a mismatch is compiled again on Windows
+// and reported everywhere else.
+namespace Nickel::Renderer::ShaderCooker {
+	constexpr const char* ManifestPath = "Data/Shaders/Programs.txt";
+	constexpr const char* SourceShaderDir = "Data/Shaders";
+	constexpr const char* CompiledShaderDir = "Data/Shaders/Compiled";
+	constexpr const char* SourceStampsName = "Sources.txt"; // NOTE: in the compiled dir, the source hash each default variant was compiled from
+
+	struct ProgramSource {
+		std::string name;
+		std::string vertexShader;
+		std::string pixelShader;
+		bool optional = false; // NOTE: debug tooling, its users cope with GetProgram failing
+	};
+
+	struct ReflectedInput {
+		std::string semanticName;
+		u32 semanticIndex;
+		ShaderComponentType componentType;
+		u32 componentCount;
+	};
+
+	struct ReflectedConstantBuffer {
+		std::string name;
+		u32 slot;
+		u32 size;
+	};
+
+	struct ReflectedBinding {
+		std::string name;
+		ShaderArchiveFormat::BindingType type;
+		u32 slot;
+		u32 count;
+	};
+
+	struct ShaderReflection {
+		std::vector<ReflectedInput> inputs; // NOTE: system values like SV_VertexID aren't fed by the input layout and left out
+		std::vector<ReflectedConstantBuffer> constantBuffers;
+		std::vector<ReflectedBinding> bindings;
+	};
+
+	auto ParseManifest(const char* manifestPath, std::vector<ProgramSource>& programs) -> bool;
+	auto ReflectBytecode(std::span<const u8> bytecode, ShaderReflection& reflection) -> bool;
+
+	auto Cook(const char* manifestPath, const char* sourceDir, const char* compiledDir, const char* archivePath) -> bool;
+
+	// NOTE: cooks when the archive is missing or older than the manifest or any bytecode, when a variant could
+	// be compiled or when bytecode doesn't match its source. Returns false only when that cook failed. Shipped data without the manifest and bytecode just
+	// keeps the archive it has.
+	auto CookIfStale(const char* manifestPath, const char* sourceDir, const char* compiledDir, const char* archivePath) -> bool;
+}
\ No newline at end of file
@@ -0,0 +1,186 @@
+#include "ShaderLibrary.h"
+#include <algorithm>
+#include <cstring>
+
+namespace Nickel::Renderer {
+	namespace {
+		template <typename T>
+		auto MapTable(std::span<const u8> data, u32 offset, u32 count, std::span<const T>& table) -> bool {
+			if (offset % alignof(T) != 0 || offset > data.size() || (data.size() - offset) / sizeof(T) < count)
+				return false;
+
+			table = std::span{ reinterpret_cast<const T*>(data.data() + offset), count };
+			return true;
+		}
+
+		auto InRange(u32 first, u32 count, size_t size) -> bool {
+			return first <= size && count <= size - first;
+		}
+	}
+
+	auto ShaderLibrary::Open(const char* archivePath) -> bool {
+		Assert(!file.IsOpen());
+		if (!file.Open(archivePath))
+			return false;
+
+		using namespace ShaderArchiveFormat;
+		const auto data = file.Data();
+		auto fail = [&](const char* reason) {
+			Logger::Error(std::string("[ShaderLibrary]: ") + archivePath + " " + reason);
+			file.Close();
+			return false;
+		};
+
+		if (data.size() < sizeof(Header))
+			return fail("is too small to be a shader archive");
+
+		header = reinterpret_cast<const Header*>(data.data());
+		if (header->magic != Magic || header->version != Version)
+			return fail("isn't a shader archive of this version, re-cook it");
+		if (header->fileSize != data.size())
+			return fail("is truncated");
+
+		if (!MapTable(data, header->programsOffset, header->programCount, programs) ||
+			!MapTable(data, header->shadersOffset, header->shaderCount, shaders) ||
+			!MapTable(data, header->inputsOffset, header->inputCount, inputs) ||
+			!MapTable(data, header->constantBuffersOffset, header->constantBufferCount, constantBuffers) ||
+			!MapTable(data, header->bindingsOffset, header->bindingCount, bindings))
+			return fail("has a table outside the file");
+
+		if (header->stringsSize == 0 || !InRange(header->stringsOffset, header->stringsSize, data.size()) || data[header->stringsOffset + header->stringsSize - 1] != 0)
+			return fail("has a broken string pool");
+		strings = reinterpret_cast<const char*>(data.data() + header->stringsOffset);
+
+		// NOTE: everything below is trusted after this, lookups and program creation index without checks
+		const u32 stringsSize = header->stringsSize;
+		for (const auto& program : programs)
+			if (program.name >= stringsSize || program.vertexShader >= shaders.size() || program.pixelShader >= shaders.size())
+				return fail("has a broken program entry");
+
+		for (const auto& shader : shaders) {
+			if (shader.name >= stringsSize || !InRange(shader.bytecodeOffset, shader.bytecodeSize, data.size()) ||
+				!InRange(shader.firstInput, shader.inputCount, inputs.size()) ||
+				!InRange(shader.firstConstantBuffer, shader.constantBufferCount, constantBuffers.size()) ||
+				!InRange(shader.firstBinding, shader.bindingCount, bindings.size()))
+				return fail("has a broken shader entry");
+		}
+
+		for (const auto& input : inputs)
+			if (input.semanticName >= stringsSize || input.componentType > static_cast<u8>(ShaderComponentType::Float32) || input.componentCount - 1u > 3u)
+				return fail("has a broken input element");
+		for (const auto& constantBuffer : constantBuffers)
+			if (constantBuffer.name >= stringsSize)
+				return fail("has a broken constant buffer entry");
+		for (const auto& binding : bindings)
+			if (binding.name >= stringsSize)
+				return fail("has a broken resource binding");
+
+		createdPrograms.assign(programs.size(), ProgramHandle{});
+		Logger::Info("[ShaderLibrary]: mapped " + std::to_string(programs.size()) + " programs (" + std::to_string(shaders.size()) + " shaders) from " + archivePath);
+
+		return true;
+	}
+
+	auto ShaderLibrary::Release(const PlatformInterface& gfx) -> void {
+		for (const auto program : createdPrograms)
+			if (program.IsValid())
+				gfx.DestroyProgram(program);
+
+		*this = ShaderLibrary{};
+	}
+
+	auto ShaderLibrary::FindProgram(std::string_view name, PermutationKey key) const -> i32 {
+		const auto it = std::lower_bound(programs.begin(), programs.end(), std::pair{ name, key }, [&](const ShaderArchiveFormat::Program& program, std::pair<std::string_view, PermutationKey> search) {
+			const std::string_view programName{ GetString(program.name) };
+			return programName < search.first || (programName == search.first && program.permutationKey < search.second);
+		});
+
+		if (it == programs.end() || std::string_view{ GetString(it->name) } != name || it->permutationKey != key)
+			return -1;
+
+		return static_cast<i32>(it - programs.begin());
+	}
+
+	auto ShaderLibrary::HasVariant(std::string_view name, PermutationKey key) const -> bool {
+		return FindProgram(name, key) >= 0;
+	}
+
+	auto ShaderLibrary::GetProgram(const PlatformInterface& gfx, std::string_view name, PermutationKey key) -> ProgramHandle {
+		i32 index = FindProgram(name, key);
+		if (index < 0) {
+			const auto defaultKey = GetDefaultPermutation(name);
+			index = key != defaultKey ? FindProgram(name, defaultKey) : -1;
+			if (index < 0) {
+				Logger::Error("[ShaderLibrary]: no program '" + std::string(name) + "' in the archive");
+				return {};
+			}
+
+			Logger::Warn("[ShaderLibrary]: variant " + std::to_string(key) + " of '" + std::string(name) + "' wasn't cooked, using the default one");
+		}
+
+		auto& created = createdPrograms[index];
+		if (created.IsValid())
+			return created;
+
+		const auto& program = programs[index];
+		const auto vertexStage = GetStageInfo(shaders[program.vertexShader]);
+		const auto pixelStage = GetStageInfo(shaders[program.pixelShader]);
+
+		// NOTE: D3D11 has at most 32 input slots, the names point straight into the mapped string pool
+		constexpr u32 MaxInputElements = 32;
+		if (vertexStage.inputs.size() > MaxInputElements) {
+			Logger::Error("[ShaderLibrary]: program '" + std::string(name) + "' has more vertex inputs than a layout can hold");
+			return {};
+		}
+
+		ShaderInputElement inputSignature[MaxInputElements];
+		for (u32 i = 0; i < vertexStage.inputs.size(); i++) {
+			const auto& input = vertexStage.inputs[i];
+			inputSignature[i] = ShaderInputElement{
+				.semanticName = GetString(input.semanticName),
+				.semanticIndex = input.semanticIndex,
+				.componentType = static_cast<ShaderComponentType>(input.componentType),
+				.componentCount = input.componentCount
+			};
+		}
+
+		created = gfx.CreateProgram(ProgramDesc{
+			.vertexShaderBytecode = vertexStage.bytecode,
+			.pixelShaderBytecode = pixelStage.bytecode,
+			.inputSignature = std::span{ inputSignature, vertexStage.inputs.size() },
+			.name = GetString(program.name),
+			.permutationKey = program.permutationKey
+		});
+
+		return created;
+	}
+
+	auto ShaderLibrary::FindStage(std::string_view program, ShaderStage stage) const -> const ShaderArchiveFormat::Shader* {
+		const i32 index = FindProgram(program, GetDefaultPermutation(program));
+		if (index < 0)
+			return nullptr;
+
+		return &shaders[stage == ShaderStage::Vertex ? programs[index].vertexShader : programs[index].pixelShader];
+	}
+
+	auto ShaderLibrary::GetStageInfo(const ShaderArchiveFormat::Shader& shader) const -> ShaderStageInfo {
+		return ShaderStageInfo{
+			.bytecode = file.Data().subspan(shader.bytecodeOffset, shader.bytecodeSize),
+			.inputs = inputs.subspan(shader.firstInput, shader.inputCount),
+			.constantBuffers = constantBuffers.subspan(shader.firstConstantBuffer, shader.constantBufferCount),
+			.bindings = bindings.subspan(shader.firstBinding, shader.bindingCount)
+		};
+	}
+
+	auto ShaderLibrary::GetConstantBufferSize(std::string_view program, ShaderStage stage, u32 slot) const -> u32 {
+		const auto shader = FindStage(program, stage);
+		if (shader == nullptr)
+			return 0;
+
+		for (const auto& constantBuffer : GetStageInfo(*shader).constantBuffers)
+			if (constantBuffer.slot == slot)
+				return constantBuffer.size;
+
+		return 0;
+	}
+}
\ No newline at end of file
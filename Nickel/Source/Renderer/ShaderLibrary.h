@@ -0,0 +1,58 @@
+#pragma once
+
+#include "RendererPlatformInterface.h"
+#include "ShaderArchiveFormat.h"
+#include "ShaderPermutations.h"
+#include "../MappedFile.h"
+#include <string_view>
+#include <vector>
+
+namespace Nickel::Renderer {
+	constexpr const char* ShaderArchivePath = "Data/Shaders/Shaders.nsa";
+
+	// NOTE: zero-copy view of one stage of a program, names resolve through ShaderLibrary::GetString
+	struct ShaderStageInfo {
+		std::span<const u8> bytecode;
+		std::span<const ShaderArchiveFormat::InputElement> inputs;
+		std::span<const ShaderArchiveFormat::ConstantBuffer> constantBuffers;
+		std::span<const ShaderArchiveFormat::ResourceBinding> bindings;
+	};
+
+	// Programs out of the cooked shader archive. The archive is mapped, not read: bytecode goes straight from the
+	// mapping to the backend and the input signatures were extracted when cooking, so nothing is reflected at
+	// startup. Programs are only created the first time they're asked for and owned by the library from then on.
+	// Not thread-safe, programs are requested while loading content.
+	class ShaderLibrary {
+	public:
+		auto Open(const char* archivePath) -> bool; // NOTE: validates every table against the mapping once, lookups don't check again
+		auto Release(const PlatformInterface& gfx) -> void; // NOTE: destroys the created programs and unmaps the archive
+
+		// NOTE: invalid handle when the archive has no such program. A variant that wasn't cooked falls back to the
+		// program's default one, which is always there
+		auto GetProgram(const PlatformInterface& gfx, std::string_view name, PermutationKey key) -> ProgramHandle;
+		inline auto GetProgram(const PlatformInterface& gfx, std::string_view name) -> ProgramHandle { return GetProgram(gfx, name, GetDefaultPermutation(name)); }
+		auto HasVariant(std::string_view name, PermutationKey key) const -> bool;
+
+
+		auto FindStage(std::string_view program, ShaderStage stage) const -> const ShaderArchiveFormat::Shader*; // NOTE: of the default variant
+		auto GetStageInfo(const ShaderArchiveFormat::Shader& shader) const -> ShaderStageInfo;
+		auto GetConstantBufferSize(std::string_view program, ShaderStage stage, u32 slot) const -> u32; // NOTE: 0 when nothing is bound there
+
+		inline auto GetString(u32 offset) const -> const char* { return strings + offset; }
+		inline auto IsOpen() const -> bool { return file.IsOpen(); }
+
+	private:
+		auto FindProgram(std::string_view name, PermutationKey key) const -> i32; // NOTE: index into programs, -1 when missing
+
+		MappedFile file;
+		const ShaderArchiveFormat::Header* header = nullptr;
+		std::span<const ShaderArchiveFormat::Program> programs;
+		std::span<const ShaderArchiveFormat::Shader> shaders;
+		std::span<const ShaderArchiveFormat::InputElement> inputs;
+		std::span<const ShaderArchiveFormat::ConstantBuffer> constantBuffers;
+		std::span<const ShaderArchiveFormat::ResourceBinding> bindings;
+		const char* strings = nullptr;
+
+		std::vector<ProgramHandle> createdPrograms; // NOTE: parallel to programs, invalid until first requested
+	};
+}
\ No newline at end of file
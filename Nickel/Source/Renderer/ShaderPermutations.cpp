@@ -0,0 +1,90 @@
+#include "ShaderPermutations.h"
+
+namespace Nickel::Renderer {
+	namespace {
+		constexpr u32 BoolValues[] = { 0, 1 };
+
+		constexpr ShaderFeature pbrFeatures[] = {
+			{ "HAS_NORMAL_MAP",   ShaderStage::Pixel, 0, 1, BoolValues },
+			{ "HAS_EMISSIVE_MAP", ShaderStage::Pixel, 1, 1, BoolValues },
+			{ "HAS_AO_MAP",       ShaderStage::Pixel, 2, 1, BoolValues },
+		};
+
+		constexpr ShaderFeature lineFeatures[] = {
+			{ "MITER_JOIN", ShaderStage::Vertex, 0, 1, BoolValues },
+		};
+
+		constexpr PermutationSpace permutationSpaces[] = {
+			{ "Pbr",  pbrFeatures,  PbrPermutation::Default },
+			{ "Line", lineFeatures, LinePermutation::Default },
+		};
+
+		auto FieldIndex(const ShaderFeature& feature, PermutationKey key) -> u32 {
+			return (key >> feature.shift) & ((1u << feature.bits) - 1);
+		}
+	}
+
+	auto FindPermutationSpace(std::string_view program) -> const PermutationSpace* {
+		for (const auto& space : permutationSpaces)
+			if (program == space.program)
+				return &space;
+
+		return nullptr;
+	}
+
+	auto GetDefaultPermutation(std::string_view program) -> PermutationKey {
+		const auto space = FindPermutationSpace(program);
+		return space != nullptr ? space->defaultKey : 0;
+	}
+
+	auto IsValidPermutation(const PermutationSpace& space, PermutationKey key) -> bool {
+		PermutationKey usedBits = 0;
+		for (const auto& feature : space.features) {
+			if (FieldIndex(feature, key) >= feature.values.size())
+				return false;
+
+			usedBits |= ((1u << feature.bits) - 1) << feature.shift;
+		}
+
+		return (key & ~usedBits) == 0;
+	}
+
+	auto ExpandPermutations(const PermutationSpace& space) -> std::vector<PermutationKey> {
+		// NOTE: mixed radix count over the value indices of every feature
+		std::vector<PermutationKey> keys{ space.defaultKey };
+		std::vector<u32> indices(space.features.size(), 0);
+		while (true) {
+			PermutationKey key = 0;
+			for (u32 i = 0; i < space.features.size(); i++)
+				key |= indices[i] << space.features[i].shift;
+
+			if (key != space.defaultKey)
+				keys.push_back(key);
+
+			u32 feature = 0;
+			while (feature < indices.size() && ++indices[feature] == space.features[feature].values.size())
+				indices[feature++] = 0;
+
+			if (feature == indices.size())
+				return keys;
+		}
+	}
+
+	auto GetStageKey(const PermutationSpace& space, PermutationKey key, ShaderStage stage) -> PermutationKey {
+		PermutationKey stageKey = 0;
+		for (const auto& feature : space.features)
+			if (feature.stage == stage)
+				stageKey |= FieldIndex(feature, key) << feature.shift;
+
+		return stageKey;
+	}
+
+	auto GetDefines(const PermutationSpace& space, PermutationKey key, ShaderStage stage) -> std::vector<std::pair<std::string, std::string>> {
+		std::vector<std::pair<std::string, std::string>> defines;
+		for (const auto& feature : space.features)
+			if (feature.stage == stage)
+				defines.emplace_back(feature.define, std::to_string(feature.values[FieldIndex(feature, key)]));
+
+		return defines;
+	}
+}
\ No newline at end of file
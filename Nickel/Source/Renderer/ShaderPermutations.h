@@ -0,0 +1,55 @@
+#pragma once
+
+#include "RendererTypes.h"
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+// Compile-time shader variants. A program declares features (defines it's compiled with), each one owns a bit
+// field of the permutation key holding an index into the feature's values. The cooker compiles every key of a
+// program's space, backends look variants up by (program, key). This table is the permutation manifest: the
+// cooker, the shader library and the software backend's C++ ports all read it, the HLSL only has the defines.
+namespace Nickel::Renderer {
+	struct ShaderFeature {
+		const char* define;
+		ShaderStage stage; // NOTE: the program's shader the define is passed to
+		u32 shift;
+		u32 bits;
+		std::span<const u32> values; // NOTE: value of the define for every index the bit field can hold
+	};
+
+	struct PermutationSpace {
+		const char* program;
+		std::span<const ShaderFeature> features;
+		PermutationKey defaultKey; // NOTE: the key the HLSL compiles to without any defines, what FxCompile builds
+	};
+
+	namespace PbrPermutation {
+		// NOTE: lights aren't a feature, the shader loops over its cluster's list (ClusteredLighting)
+		constexpr PermutationKey NormalMap   = 1u << 0;
+		constexpr PermutationKey EmissiveMap = 1u << 1;
+		constexpr PermutationKey AOMap       = 1u << 2;
+
+		constexpr auto Key(bool normalMap, bool emissiveMap, bool aoMap) -> PermutationKey {
+			return (normalMap ? NormalMap : 0) | (emissiveMap ? EmissiveMap : 0) | (aoMap ? AOMap : 0);
+		}
+
+		constexpr PermutationKey Default = Key(true, true, true);
+	}
+
+	namespace LinePermutation {
+		constexpr PermutationKey MiterJoin = 1u << 0;
+		constexpr PermutationKey Default = 0;
+	}
+
+	auto FindPermutationSpace(std::string_view program) -> const PermutationSpace*;
+	auto GetDefaultPermutation(std::string_view program) -> PermutationKey; // NOTE: 0 for programs without features
+
+	auto ExpandPermutations(const PermutationSpace& space) -> std::vector<PermutationKey>; // NOTE: every valid key, default first
+	auto IsValidPermutation(const PermutationSpace& space, PermutationKey key) -> bool;
+
+	// NOTE: the part of a key one stage is compiled with, equal stage keys share bytecode between variants
+	auto GetStageKey(const PermutationSpace& space, PermutationKey key, ShaderStage stage) -> PermutationKey;
+	auto GetDefines(const PermutationSpace& space, PermutationKey key, ShaderStage stage) -> std::vector<std::pair<std::string, std::string>>;
+}
\ No newline at end of file
@@ -0,0 +1,747 @@
+#include "SoftwareCore.h"
+#include "../HandlePool.h"
+#include "../TextureCompression.h"
+#include "../../Threading.h"
+#include <cstdio>
+#if defined(_WIN32)
+#include <Windows.h>
+#endif
+
+namespace Nickel::Renderer::Software::Core {
+	namespace {
+		struct SoftwareBuffer {
+			BufferDesc desc;
+			std::vector<u8> data;
+			u32 version;
+
+			// NOTE: constant buffers are copied once per version and flush, draws keep pointing at that copy
+			const u8* snapshot;
+			u32 snapshotVersion;
+			u64 snapshotEpoch;
+		};
+
+		struct SoftwareProgram {
+			const ShaderPort* port; // NOTE: nullptr when there's no C++ port, draws with it are skipped
+			VertexShaderFn vertexShader; // NOTE: the port's variant for the program's permutation key
+			PixelShaderFn pixelShader;
+		};
+
+		struct SoftwareTextureTable {
+			TextureHandle textures[MaxShaderSlots];
+			SamplerHandle samplers[MaxShaderSlots];
+			u32 textureCount;
+			u32 samplerCount;
+		};
+
+		// NOTE: state descriptions are copied at creation, the pipeline doesn't depend on the state handles afterwards
+		struct SoftwarePipeline {
+			ProgramHandle program;
+			RasterizerDesc rasterizer;
+			DepthStencilDesc depthStencil;
+		};
+
+		// NOTE: fixed size blocks so pointers handed to queued draws stay valid until the next flush
+		class ConstantArena {
+		public:
+			static constexpr u32 BlockSize = 64 * 1024;
+
+			auto Allocate(u32 size) -> u8* {
+				size = (size + 15) & ~15u;
+				Assert(size <= BlockSize);
+				if (blocks.empty() || offset + size > BlockSize) {
+					if (++blockIdx >= blocks.size())
+						blocks.push_back(std::make_unique<u8[]>(BlockSize));
+					offset = 0;
+				}
+
+				u8* result = blocks[blockIdx].get() + offset;
+				offset += size;
+				return result;
+			}
+
+			auto Reset() -> void {
+				blockIdx = 0;
+				offset = blocks.empty() ? BlockSize : 0;
+			}
+
+		private:
+			std::vector<std::unique_ptr<u8[]>> blocks;
+			u32 blockIdx = static_cast<u32>(-1);
+			u32 offset = 0;
+		};
+
+		struct CoreState {
+			HandlePool<BufferHandle, SoftwareBuffer> buffers;
+			HandlePool<TextureHandle, std::unique_ptr<Texture>> textures;
+			HandlePool<SamplerHandle, SamplerDesc> samplers;
+			HandlePool<TextureTableHandle, SoftwareTextureTable> textureTables;
+			HandlePool<ProgramHandle, SoftwareProgram> programs;
+			HandlePool<PipelineHandle, SoftwarePipeline> pipelines;
+			HandlePool<RasterizerStateHandle, RasterizerDesc> rasterizerStates;
+			HandlePool<DepthStencilStateHandle, DepthStencilDesc> depthStencilStates;
+			HandlePool<RenderTargetHandle, std::unique_ptr<ColorTarget>> renderTargets;
+			HandlePool<DepthTargetHandle, std::unique_ptr<DepthTarget>> depthTargets;
+
+			Rasterizer rasterizer;
+			ConstantArena constants;
+			u64 epoch = 0; // NOTE: bumped on every flush, invalidates constant snapshots
+
+			ColorTarget* colorTarget = nullptr;
+			DepthTarget* depthTarget = nullptr;
+
+			RenderTargetHandle backbuffer;
+			void* windowHandle = nullptr;
+			bool initialized = false;
+
+			Stats stats{};
+		};
+
+		// NOTE: heap allocated, the handle pools and rasterizer batches are big and reset on Init/Shutdown
+		std::unique_ptr<CoreState> core;
+
+		constexpr u64 MaxPendingPrimitives = 1 << 21; // NOTE: flush early instead of letting the setup buffers grow without bound
+
+		auto Fail(const std::string& message) -> void {
+			Logger::Error("[Software]: " + message);
+		}
+
+		auto Flush() -> void {
+			if (!core->rasterizer.HasPendingWork())
+				return;
+
+			core->rasterizer.Flush();
+			core->constants.Reset();
+			core->epoch++;
+		}
+
+		auto AlignUp(u32 value, u32 alignment) -> u32 {
+			return (value + alignment - 1) / alignment * alignment;
+		}
+
+		auto Snapshot(SoftwareBuffer& buffer) -> const u8* {
+			if (buffer.snapshot == nullptr || buffer.snapshotEpoch != core->epoch || buffer.snapshotVersion != buffer.version) {
+				u8* copy = core->constants.Allocate(buffer.desc.size);
+				std::memcpy(copy, buffer.data.data(), buffer.desc.size);
+				buffer.snapshot = copy;
+				buffer.snapshotVersion = buffer.version;
+				buffer.snapshotEpoch = core->epoch;
+			}
+
+			return buffer.snapshot;
+		}
+
+		auto WriteBuffer(SoftwareBuffer& buffer, const void* data, u32 size) -> void {
+			// NOTE: queued draws read vertex, index and structured data in place, constant buffers are snapshotted
+			if (buffer.desc.type != BufferType::Constant)
+				Flush();
+
+			std::memcpy(buffer.data.data(), data, size);
+			buffer.version++;
+		}
+
+		auto PackClearColor(const f32 color[4]) -> u32 {
+			const auto channel = [](f32 c) { return static_cast<u32>(saturate(c) * 255.0f + 0.5f); };
+			return (channel(color[3]) << 24) | (channel(color[0]) << 16) | (channel(color[1]) << 8) | channel(color[2]);
+		}
+
+		// NOTE: tracks the bound state while a list is replayed and turns draws into rasterizer DrawCalls
+		struct Recorder {
+			FrameStats& frame;
+
+			ProgramHandle program;
+			RasterizerDesc rasterizer{};
+			DepthStencilDesc depthStencil{};
+			PrimitiveTopology topology = PrimitiveTopology::TriangleList;
+			Viewport viewport{};
+			bool hasViewport = false;
+
+			BufferHandle vertexBuffer;
+			u32 vertexStride = 0;
+			u32 vertexOffset = 0;
+			BufferHandle indexBuffer;
+			IndexFormat indexFormat = IndexFormat::U32;
+			u32 indexOffset = 0;
+
+			TextureHandle textures[2][MaxShaderSlots];
+			SamplerHandle samplers[2][MaxShaderSlots];
+			BufferHandle constantBuffers[2][MaxShaderSlots];
+			BufferHandle shaderBuffers[2][MaxShaderSlots];
+
+			auto operator()(const CmdSetRenderTarget& cmd) -> void {
+				auto color = core->renderTargets.Get(cmd.color);
+				auto depth = core->depthTargets.Get(cmd.depth);
+				auto colorTarget = color != nullptr ? color->get() : nullptr;
+				auto depthTarget = depth != nullptr ? depth->get() : nullptr;
+
+				if (colorTarget != nullptr && depthTarget != nullptr && (colorTarget->width != depthTarget->width || colorTarget->height != depthTarget->height))
+					Fail("render target and depth target sizes differ");
+
+				if (colorTarget != core->colorTarget || depthTarget != core->depthTarget)
+					Flush();
+
+				core->colorTarget = colorTarget;
+				core->depthTarget = depthTarget;
+				core->rasterizer.SetTargets(colorTarget, depthTarget);
+			}
+
+			auto operator()(const CmdSetViewport& cmd) -> void {
+				viewport = cmd.viewport;
+				hasViewport = true;
+			}
+
+			auto operator()(const CmdClear& cmd) -> void {
+				frame.clears++;
+				Flush();
+
+				if ((cmd.flags & static_cast<u32>(ClearFlag::CLEAR_COLOR)) != 0 && core->colorTarget != nullptr) {
+					auto& pixels = core->colorTarget->pixels;
+					std::fill(pixels.begin(), pixels.end(), PackClearColor(cmd.color));
+				}
+
+				if ((cmd.flags & static_cast<u32>(ClearFlag::CLEAR_DEPTH)) != 0 && core->depthTarget != nullptr) {
+					auto& depth = core->depthTarget->depth;
+					std::fill(depth.begin(), depth.end(), cmd.depth);
+				}
+			}
+
+			auto operator()(const CmdSetProgram& cmd) -> void { program = cmd.program; }
+			auto operator()(const CmdSetTopology& cmd) -> void { topology = cmd.topology; }
+
+			auto operator()(const CmdSetPipeline& cmd) -> void {
+				const auto pipeline = core->pipelines.Get(cmd.pipeline);
+				program = pipeline != nullptr ? pipeline->program : ProgramHandle{};
+				rasterizer = pipeline != nullptr ? pipeline->rasterizer : RasterizerDesc{};
+				depthStencil = pipeline != nullptr ? pipeline->depthStencil : DepthStencilDesc{};
+			}
+
+			auto operator()(const CmdSetRasterizerState& cmd) -> void {
+				const auto desc = core->rasterizerStates.Get(cmd.state);
+				rasterizer = desc != nullptr ? *desc : RasterizerDesc{};
+			}
+
+			auto operator()(const CmdSetDepthStencilState& cmd) -> void {
+				const auto desc = core->depthStencilStates.Get(cmd.state);
+				depthStencil = desc != nullptr ? *desc : DepthStencilDesc{};
+			}
+
+			auto operator()(const CmdSetVertexBuffer& cmd) -> void {
+				vertexBuffer = cmd.buffer;
+				vertexStride = cmd.stride;
+				vertexOffset = cmd.offset;
+			}
+
+			auto operator()(const CmdSetIndexBuffer& cmd) -> void {
+				indexBuffer = cmd.buffer;
+				indexFormat = cmd.format;
+				indexOffset = cmd.offset;
+			}
+
+			auto operator()(const CmdSetTextures& cmd, std::span<const TextureHandle> handles) -> void {
+				const u32 stage = static_cast<u32>(cmd.stage);
+				for (u32 i = 0; i < handles.size() && cmd.startSlot + i < MaxShaderSlots; i++) {
+					textures[stage][cmd.startSlot + i] = handles[i];
+					shaderBuffers[stage][cmd.startSlot + i] = {};
+				}
+			}
+
+			auto operator()(const CmdSetSamplers& cmd, std::span<const SamplerHandle> handles) -> void {
+				const u32 stage = static_cast<u32>(cmd.stage);
+				for (u32 i = 0; i < handles.size() && cmd.startSlot + i < MaxShaderSlots; i++)
+					samplers[stage][cmd.startSlot + i] = handles[i];
+			}
+
+			auto operator()(const CmdSetTextureTable& cmd) -> void {
+				const auto table = core->textureTables.Get(cmd.table);
+				if (table == nullptr)
+					return;
+
+				const u32 stage = static_cast<u32>(cmd.stage);
+				std::copy_n(table->textures, table->textureCount, textures[stage]);
+				std::copy_n(table->samplers, table->samplerCount, samplers[stage]);
+				std::fill_n(shaderBuffers[stage], table->textureCount, BufferHandle{});
+			}
+
+			auto operator()(const CmdSetConstantBuffer& cmd) -> void {
+				if (cmd.slot < MaxShaderSlots)
+					constantBuffers[static_cast<u32>(cmd.stage)][cmd.slot] = cmd.buffer;
+			}
+
+			auto operator()(const CmdSetShaderBuffer& cmd) -> void {
+				if (cmd.slot >= MaxShaderSlots)
+					return;
+
+				const u32 stage = static_cast<u32>(cmd.stage);
+				shaderBuffers[stage][cmd.slot] = cmd.buffer;
+				textures[stage][cmd.slot] = {};
+			}
+
+			auto operator()(const CmdUpdateBuffer& cmd, std::span<const u8> bytes) -> void {
+				auto buffer = core->buffers.Get(cmd.buffer);
+				if (buffer == nullptr || bytes.size() > buffer->desc.size) {
+					Fail("invalid buffer update in command list");
+					return;
+				}
+
+				WriteBuffer(*buffer, bytes.data(), static_cast<u32>(bytes.size()));
+			}
+
+			auto operator()(const CmdDraw& cmd) -> void {
+				RecordDraw(cmd.startVertex, cmd.vertexCount, 0, false);
+			}
+
+			auto operator()(const CmdDrawIndexed& cmd) -> void {
+				RecordDraw(cmd.startIndex, cmd.indexCount, cmd.baseVertex, true);
+			}
+
+			auto operator()(const CmdDrawInstanced& cmd) -> void {
+				RecordDraw(cmd.startVertex, cmd.vertexCount, 0, false, cmd.instanceCount);
+			}
+
+			auto ResolveResources(ShaderStage stage, u32 requiredConstants, ShaderResources& resources) -> bool {
+				const u32 s = static_cast<u32>(stage);
+				for (u32 slot = 0; slot < MaxShaderSlots; slot++) {
+					auto buffer = core->buffers.Get(constantBuffers[s][slot]);
+					resources.constantBuffers[slot] = buffer != nullptr && buffer->desc.type == BufferType::Constant ? Snapshot(*buffer) : nullptr;
+					if ((requiredConstants & (1u << slot)) != 0 && resources.constantBuffers[slot] == nullptr)
+						return false;
+
+					auto texture = core->textures.Get(textures[s][slot]);
+					resources.textures[slot] = texture != nullptr ? texture->get() : nullptr;
+
+					auto shaderBuffer = core->buffers.Get(shaderBuffers[s][slot]);
+					resources.buffers[slot] = shaderBuffer != nullptr && shaderBuffer->desc.type == BufferType::Structured ? std::span<const u8>{ shaderBuffer->data } : std::span<const u8>{};
+
+					auto sampler = core->samplers.Get(samplers[s][slot]);
+					resources.samplers[slot] = sampler != nullptr ? *sampler : SamplerDesc{};
+				}
+
+				return true;
+			}
+
+			auto RecordDraw(u32 first, u32 count, i32 baseVertex, bool indexed, u32 instanceCount = 1) -> void {
+				frame.draws++;
+
+				const auto prog = core->programs.Get(program);
+				if (prog == nullptr || prog->port == nullptr || !hasViewport || (core->colorTarget == nullptr && core->depthTarget == nullptr)) {
+					frame.skippedDraws++;
+					return;
+				}
+
+				if (topology != PrimitiveTopology::TriangleList && topology != PrimitiveTopology::TriangleStrip) {
+					// TODO: line and point rasterization
+					frame.skippedDraws++;
+					return;
+				}
+
+				const auto& port = *prog->port;
+				const auto vb = core->buffers.Get(vertexBuffer);
+				const bool needsVertices = port.vertexSize > 0;
+				if (needsVertices && (vb == nullptr || vertexStride < port.vertexSize || vertexOffset >= vb->desc.size)) {
+					Fail("draw without a vertex buffer matching the program's input layout");
+					frame.skippedDraws++;
+					return;
+				}
+
+				// NOTE: without an input layout the vertex shader only sees its ids, any vertex index is valid
+				auto draw = DrawCall{
+					.shader = &port,
+					.vertexShader = prog->vertexShader,
+					.pixelShader = prog->pixelShader,
+					.vertices = needsVertices ? vb->data.data() + vertexOffset : nullptr,
+					.vertexStride = needsVertices ? vertexStride : 0,
+					.vertexCount = needsVertices ? (vb->desc.size - vertexOffset) / vertexStride : ~0u,
+					.indices = nullptr,
+					.indexFormat = indexFormat,
+					.first = first,
+					.count = count,
+					.baseVertex = baseVertex,
+					.instanceCount = instanceCount,
+					.topology = topology,
+					.rasterizer = rasterizer,
+					.depthStencil = depthStencil,
+					.viewport = viewport
+				};
+
+				if (indexed) {
+					const auto ib = core->buffers.Get(indexBuffer);
+					const u64 indexSize = indexFormat == IndexFormat::U16 ? 2 : 4;
+					if (ib == nullptr || indexOffset + (static_cast<u64>(first) + count) * indexSize > ib->desc.size) {
+						Fail("indexed draw without an index buffer or reading past its end");
+						frame.skippedDraws++;
+						return;
+					}
+
+					draw.indices = ib->data.data() + indexOffset;
+				}
+
+				if (!ResolveResources(ShaderStage::Vertex, port.vertexConstantMask, draw.vertexResources) ||
+					!ResolveResources(ShaderStage::Pixel, port.pixelConstantMask, draw.pixelResources)) {
+					Fail("draw is missing a constant buffer its program reads");
+					frame.skippedDraws++;
+					return;
+				}
+
+				const i32 width  = static_cast<i32>(core->colorTarget != nullptr ? core->colorTarget->width : core->depthTarget->width);
+				const i32 height = static_cast<i32>(core->colorTarget != nullptr ? core->colorTarget->height : core->depthTarget->height);
+				draw.clipRect[0] = std::clamp(static_cast<i32>(std::floor(viewport.x)), 0, width);
+				draw.clipRect[1] = std::clamp(static_cast<i32>(std::floor(viewport.y)), 0, height);
+				draw.clipRect[2] = std::clamp(static_cast<i32>(std::ceil(viewport.x + viewport.width)), 0, width);
+				draw.clipRect[3] = std::clamp(static_cast<i32>(std::ceil(viewport.y + viewport.height)), 0, height);
+
+				core->rasterizer.Draw(draw);
+				if (core->rasterizer.PendingPrimitives() >= MaxPendingPrimitives)
+					Flush();
+			}
+		};
+
+		template <typename HandleT, typename T>
+		auto Release(HandlePool<HandleT, T>& pool, HandleT handle, const char* what) -> void {
+			Flush(); // NOTE: queued draws may still point into the resource
+			if (!pool.Free(handle))
+				Fail(std::string("destroying invalid or already destroyed ") + what);
+		}
+
+		auto CreateColorTarget(u32 width, u32 height) -> std::unique_ptr<ColorTarget> {
+			auto target = std::make_unique<ColorTarget>(ColorTarget{ .width = width, .height = height, .pitch = AlignUp(width, 4) });
+			target->pixels.resize(static_cast<u64>(target->pitch) * AlignUp(height, 2));
+			return target;
+		}
+	}
+
+	auto Init(const PlatformInitDesc& desc) -> bool {
+		if (desc.width == 0 || desc.height == 0) {
+			Logger::Error("[Software]: Init called with an empty backbuffer");
+			return false;
+		}
+
+		core = std::make_unique<CoreState>();
+		core->rasterizer.Init(GetWorkerCount());
+		core->backbuffer = core->renderTargets.Allocate(CreateColorTarget(desc.width, desc.height));
+		core->windowHandle = desc.windowHandle;
+		core->stats.workerCount = GetWorkerCount();
+		core->stats.avx2 = core->rasterizer.UsesAVX2();
+		core->initialized = true;
+
+		Logger::Info("[Software]: " + std::to_string(core->stats.workerCount) + " workers, " + (core->stats.avx2 ? "AVX2" : "scalar") + " rasterizer");
+
+		return true;
+	}
+
+	auto Shutdown() -> void {
+		if (core == nullptr)
+			return;
+
+		// NOTE: stats stay readable after shutdown so benchmarks can report them
+		const auto stats = core->stats;
+		core = std::make_unique<CoreState>();
+		core->stats = stats;
+	}
+
+	auto CreateBuffer(const BufferDesc& desc, const void* initialData) -> BufferHandle {
+		Assert(core != nullptr && core->initialized);
+
+		if (desc.size == 0) {
+			Fail("buffer created with size 0");
+			return {};
+		}
+
+		auto buffer = SoftwareBuffer{ .desc = desc, .data = std::vector<u8>(desc.size) };
+		if (initialData != nullptr)
+			std::memcpy(buffer.data.data(), initialData, desc.size);
+
+		return core->buffers.Allocate(std::move(buffer));
+	}
+
+	auto UpdateBuffer(BufferHandle handle, const void* data, u32 size) -> void {
+		auto buffer = core->buffers.Get(handle);
+		if (buffer == nullptr || data == nullptr || size > buffer->desc.size) {
+			Fail("invalid buffer update");
+			return;
+		}
+
+		WriteBuffer(*buffer, data, size);
+	}
+
+	auto DestroyBuffer(BufferHandle buffer) -> void {
+		Release(core->buffers, buffer, "buffer");
+	}
+
+	auto CreateTexture(const TextureDesc& desc, std::span<const SubresourceData> initialData) -> TextureHandle {
+		Assert(core != nullptr && core->initialized);
+
+		const u32 subresourceCount = desc.mipLevels * desc.arraySize;
+		if (desc.width == 0 || desc.height == 0 || subresourceCount == 0) {
+			Fail("texture created with an empty dimension");
+			return {};
+		}
+
+		if (!initialData.empty() && initialData.size() != subresourceCount) {
+			Fail("texture initial data needs one entry per subresource");
+			return {};
+		}
+
+		// NOTE: the samplers read RGBA8, block compressed data is decoded once here
+		const bool compressed = IsBlockCompressed(desc.format);
+		auto texture = std::make_unique<Texture>();
+		texture->desc = desc;
+		texture->desc.format = compressed ? TextureFormat::RGBA8_UNORM : desc.format;
+		texture->subresourceOffsets.resize(subresourceCount);
+
+		const u32 texelSize = GetTexelSize(texture->desc.format);
+		u64 size = 0;
+		for (u32 slice = 0; slice < desc.arraySize; slice++) {
+			for (u32 mip = 0; mip < desc.mipLevels; mip++) {
+				texture->subresourceOffsets[slice * desc.mipLevels + mip] = size;
+				size += static_cast<u64>(std::max(1u, desc.width >> mip)) * std::max(1u, desc.height >> mip) * texelSize;
+			}
+		}
+		texture->data.resize(size);
+
+		std::vector<u8> blocks;
+		for (u32 i = 0; i < initialData.size(); i++) {
+			const u32 mip = i % desc.mipLevels;
+			const u32 width = std::max(1u, desc.width >> mip);
+			const u32 height = std::max(1u, desc.height >> mip);
+			const u32 rowSize = GetRowPitch(desc.format, width);
+			const u32 rows = GetRowCount(desc.format, height);
+			const auto& src = initialData[i];
+			if (src.data == nullptr || src.rowPitch < rowSize) {
+				Fail("texture subresource has no data or a too small row pitch");
+				continue;
+			}
+
+			u8* dst = texture->data.data() + texture->subresourceOffsets[i];
+			if (compressed)
+				blocks.resize(static_cast<u64>(rowSize) * rows);
+			u8* packed = compressed ? blocks.data() : dst;
+			for (u32 row = 0; row < rows; row++)
+				std::memcpy(packed + static_cast<u64>(row) * rowSize, static_cast<const u8*>(src.data) + static_cast<u64>(row) * src.rowPitch, rowSize);
+
+			if (compressed)
+				DecompressBlocks(desc.format, blocks.data(), width, height, dst);
+		}
+
+		return core->textures.Allocate(std::move(texture));
+	}
+
+	auto DestroyTexture(TextureHandle texture) -> void {
+		Release(core->textures, texture, "texture");
+	}
+
+	auto CreateSampler(const SamplerDesc& desc) -> SamplerHandle {
+		return core->samplers.Allocate(desc);
+	}
+
+	auto DestroySampler(SamplerHandle sampler) -> void {
+		Release(core->samplers, sampler, "sampler");
+	}
+
+	auto CreateTextureTable(const TextureTableDesc& desc) -> TextureTableHandle {
+		if (desc.textures.size() > MaxShaderSlots || desc.samplers.size() > MaxShaderSlots) {
+			Fail("texture table has more entries than shader slots");
+			return {};
+		}
+
+		// NOTE: handles are resolved per draw like individually bound ones, so the table only stores them
+		SoftwareTextureTable table{};
+		table.textureCount = static_cast<u32>(desc.textures.size());
+		table.samplerCount = static_cast<u32>(desc.samplers.size());
+		std::copy(desc.textures.begin(), desc.textures.end(), table.textures);
+		std::copy(desc.samplers.begin(), desc.samplers.end(), table.samplers);
+
+		return core->textureTables.Allocate(table);
+	}
+
+	auto DestroyTextureTable(TextureTableHandle table) -> void {
+		Release(core->textureTables, table, "texture table");
+	}
+
+	auto CreateRasterizerState(const RasterizerDesc& desc) -> RasterizerStateHandle {
+		if (desc.fillMode == FillMode::Wireframe)
+			Logger::Warn("[Software]: wireframe isn't supported, rasterizing solid");
+
+		return core->rasterizerStates.Allocate(desc);
+	}
+
+	auto DestroyRasterizerState(RasterizerStateHandle state) -> void {
+		Release(core->rasterizerStates, state, "rasterizer state");
+	}
+
+	auto CreateDepthStencilState(const DepthStencilDesc& desc) -> DepthStencilStateHandle {
+		return core->depthStencilStates.Allocate(desc);
+	}
+
+	auto DestroyDepthStencilState(DepthStencilStateHandle state) -> void {
+		Release(core->depthStencilStates, state, "depth stencil state");
+	}
+
+	auto CreateProgram(const ProgramDesc& desc) -> ProgramHandle {
+		const char* name = desc.name != nullptr ? desc.name : "unnamed";
+		SoftwareProgram program{ .port = desc.name != nullptr ? FindShaderPort(desc.name) : nullptr };
+		if (program.port == nullptr) {
+			Logger::Warn(std::string("[Software]: no C++ port for program '") + name + "', its draws will be skipped");
+		} else if (!SelectVariant(*program.port, desc.permutationKey, program.vertexShader, program.pixelShader)) {
+			Logger::Warn(std::string("[Software]: the C++ port of '") + name + "' has no variant " + std::to_string(desc.permutationKey) + ", its draws will be skipped");
+			program.port = nullptr;
+		}
+
+		return core->programs.Allocate(program);
+	}
+
+	auto DestroyProgram(ProgramHandle program) -> void {
+		Release(core->programs, program, "program");
+	}
+
+	auto CreatePipeline(const PipelineDesc& desc) -> PipelineHandle {
+		const auto rasterizer = core->rasterizerStates.Get(desc.rasterizerState);
+		const auto depthStencil = core->depthStencilStates.Get(desc.depthStencilState);
+
+		return core->pipelines.Allocate(SoftwarePipeline{
+			.program = desc.program,
+			.rasterizer = rasterizer != nullptr ? *rasterizer : RasterizerDesc{},
+			.depthStencil = depthStencil != nullptr ? *depthStencil : DepthStencilDesc{}
+		});
+	}
+
+	auto DestroyPipeline(PipelineHandle pipeline) -> void {
+		Release(core->pipelines, pipeline, "pipeline");
+	}
+
+	auto CreateRenderTarget(const RenderTargetDesc& desc) -> RenderTargetHandle {
+		if (desc.width == 0 || desc.height == 0) {
+			Fail("render target created with an empty dimension");
+			return {};
+		}
+
+		// NOTE: everything is rasterized single-sampled into BGRA8, format and sample count only matter to the GPU backends
+		return core->renderTargets.Allocate(CreateColorTarget(desc.width, desc.height));
+	}
+
+	auto DestroyRenderTarget(RenderTargetHandle target) -> void {
+		if (target == core->backbuffer) {
+			Fail("destroying the backbuffer");
+			return;
+		}
+
+		if (auto color = core->renderTargets.Get(target); color != nullptr && color->get() == core->colorTarget) {
+			Flush();
+			core->colorTarget = nullptr;
+			core->rasterizer.SetTargets(nullptr, core->depthTarget);
+		}
+
+		Release(core->renderTargets, target, "render target");
+	}
+
+	auto CreateDepthTarget(const DepthTargetDesc& desc) -> DepthTargetHandle {
+		if (desc.width == 0 || desc.height == 0) {
+			Fail("depth target created with an empty dimension");
+			return {};
+		}
+
+		auto target = std::make_unique<DepthTarget>(DepthTarget{ .width = desc.width, .height = desc.height, .pitch = AlignUp(desc.width, 4) });
+		target->depth.resize(static_cast<u64>(target->pitch) * AlignUp(desc.height, 2), 1.0f);
+
+		return core->depthTargets.Allocate(std::move(target));
+	}
+
+	auto DestroyDepthTarget(DepthTargetHandle target) -> void {
+		if (auto depth = core->depthTargets.Get(target); depth != nullptr && depth->get() == core->depthTarget) {
+			Flush();
+			core->depthTarget = nullptr;
+			core->rasterizer.SetTargets(core->colorTarget, nullptr);
+		}
+
+		Release(core->depthTargets, target, "depth target");
+	}
+
+	auto GetBackbuffer() -> RenderTargetHandle {
+		return core->backbuffer;
+	}
+
+	auto Submit(std::span<const CommandList> lists) -> void {
+		auto& frame = core->stats.currentFrame;
+		for (const auto& list : lists) {
+			frame.commandLists++;
+			ForEachCommand(list, Recorder{ .frame = frame });
+		}
+	}
+
+	auto Present() -> void {
+		Flush();
+
+		auto& s = core->stats;
+		s.currentFrame.raster = core->rasterizer.GetStats();
+		core->rasterizer.ResetStats();
+		s.lastFrame = s.currentFrame;
+		s.currentFrame = {};
+		s.frameCount++;
+
+#if defined(_WIN32)
+		if (core->windowHandle != nullptr) {
+			const auto& target = **core->renderTargets.Get(core->backbuffer);
+			const auto window = static_cast<HWND>(core->windowHandle);
+
+			BITMAPINFO info{};
+			info.bmiHeader.biSize = sizeof(BITMAPINFOHEADER);
+			info.bmiHeader.biWidth = static_cast<LONG>(target.pitch);
+			info.bmiHeader.biHeight = -static_cast<LONG>(target.height); // NOTE: top-down rows
+			info.bmiHeader.biPlanes = 1;
+			info.bmiHeader.biBitCount = 32;
+			info.bmiHeader.biCompression = BI_RGB;
+
+			HDC dc = GetDC(window);
+			SetDIBitsToDevice(dc, 0, 0, target.width, target.height, 0, 0, 0, target.height, target.pixels.data(), &info, DIB_RGB_COLORS);
+			ReleaseDC(window, dc);
+		}
+#endif
+	}
+
+	auto GetStats() -> const Stats& {
+		return core->stats;
+	}
+
+	auto SaveBackbuffer(const std::string& path) -> bool {
+		const auto target = core != nullptr ? core->renderTargets.Get(core->backbuffer) : nullptr;
+		if (target == nullptr) {
+			Fail("no backbuffer to save");
+			return false;
+		}
+
+		const auto& t = **target;
+		const u32 rowSize = AlignUp(t.width * 3, 4);
+		const u32 imageSize = rowSize * t.height;
+
+		u8 header[54] = { 'B', 'M' };
+		const auto put32 = [&header](u32 at, u32 value) { std::memcpy(header + at, &value, sizeof(value)); };
+		put32(2, sizeof(header) + imageSize);
+		put32(10, sizeof(header));
+		put32(14, 40);
+		put32(18, t.width);
+		put32(22, t.height);
+		header[26] = 1;
+		header[28] = 24;
+		put32(34, imageSize);
+
+		FILE* file = std::fopen(path.c_str(), "wb");
+		if (file == nullptr) {
+			Fail("couldn't open " + path + " for writing");
+			return false;
+		}
+
+		std::fwrite(header, 1, sizeof(header), file);
+		auto row = std::vector<u8>(rowSize);
+		for (u32 y = t.height; y-- > 0;) { // NOTE: .bmp rows are stored bottom-up
+			const u32* src = t.pixels.data() + static_cast<u64>(y) * t.pitch;
+			for (u32 x = 0; x < t.width; x++) {
+				row[x * 3 + 0] = static_cast<u8>(src[x]);
+				row[x * 3 + 1] = static_cast<u8>(src[x] >> 8);
+				row[x * 3 + 2] = static_cast<u8>(src[x] >> 16);
+			}
+			std::fwrite(row.data(), 1, rowSize, file);
+		}
+
+		const bool written = std::ferror(file) == 0;
+		std::fclose(file);
+		return written;
+	}
+}
\ No newline at end of file
@@ -0,0 +1,65 @@
+#pragma once
+
+#include "../RendererPlatformInterface.h"
+#include "SoftwareRasterizer.h"
+
+// CPU backend: command lists are rasterized by a multithreaded tile renderer, programs run the C++ ports
+// of the HLSL shaders (see SoftwareShaders.cpp). Meant for reference images, CI and machines without a GPU.
+namespace Nickel::Renderer::Software::Core {
+	struct FrameStats {
+		u32 commandLists;
+		u32 draws;
+		u32 skippedDraws; // NOTE: draws without a shader port or with missing bindings
+		u32 clears;
+		RasterizerStats raster;
+	};
+
+	struct Stats {
+		u64 frameCount;
+		FrameStats lastFrame;
+		FrameStats currentFrame;
+
+		u32 workerCount;
+		bool avx2;
+	};
+
+	auto Init(const PlatformInitDesc& desc) -> bool;
+	auto Shutdown() -> void;
+
+	auto CreateBuffer(const BufferDesc& desc, const void* initialData) -> BufferHandle;
+	auto UpdateBuffer(BufferHandle buffer, const void* data, u32 size) -> void;
+	auto DestroyBuffer(BufferHandle buffer) -> void;
+
+	auto CreateTexture(const TextureDesc& desc, std::span<const SubresourceData> initialData) -> TextureHandle;
+	auto DestroyTexture(TextureHandle texture) -> void;
+
+	auto CreateSampler(const SamplerDesc& desc) -> SamplerHandle;
+	auto DestroySampler(SamplerHandle sampler) -> void;
+
+	auto CreateTextureTable(const TextureTableDesc& desc) -> TextureTableHandle;
+	auto DestroyTextureTable(TextureTableHandle table) -> void;
+
+	auto CreateRasterizerState(const RasterizerDesc& desc) -> RasterizerStateHandle;
+	auto DestroyRasterizerState(RasterizerStateHandle state) -> void;
+
+	auto CreateDepthStencilState(const DepthStencilDesc& desc) -> DepthStencilStateHandle;
+	auto DestroyDepthStencilState(DepthStencilStateHandle state) -> void;
+
+	auto CreateProgram(const ProgramDesc& desc) -> ProgramHandle;
+	auto DestroyProgram(ProgramHandle program) -> void;
+
+	auto CreatePipeline(const PipelineDesc& desc) -> PipelineHandle;
+	auto DestroyPipeline(PipelineHandle pipeline) -> void;
+
+	auto CreateRenderTarget(const RenderTargetDesc& desc) -> RenderTargetHandle;
+	auto DestroyRenderTarget(RenderTargetHandle target) -> void;
+	auto CreateDepthTarget(const DepthTargetDesc& desc) -> DepthTargetHandle;
+	auto DestroyDepthTarget(DepthTargetHandle target) -> void;
+	auto GetBackbuffer() -> RenderTargetHandle;
+
+	auto Submit(std::span<const CommandList> lists) -> void;
+	auto Present() -> void; // NOTE: blits to the window on Windows when Init got a window handle
+
+	auto GetStats() -> const Stats&;
+	auto SaveBackbuffer(const std::string& path) -> bool; // NOTE: 24 bit .bmp of the last presented frame
+}
\ No newline at end of file
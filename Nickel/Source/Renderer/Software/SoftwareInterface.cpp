@@ -0,0 +1,44 @@
+#include "../RendererPlatformInterface.h"
+#include "SoftwareInterface.h"
+#include "SoftwareCore.h"
+
+namespace Nickel::Renderer::Software {
+	auto GetPlatformInterface(PlatformInterface& platformInterface) -> void {
+		platformInterface.Init = Core::Init;
+		platformInterface.Shutdown = Core::Shutdown;
+
+		platformInterface.CreateBuffer = Core::CreateBuffer;
+		platformInterface.UpdateBuffer = Core::UpdateBuffer;
+		platformInterface.DestroyBuffer = Core::DestroyBuffer;
+
+		platformInterface.CreateTexture = Core::CreateTexture;
+		platformInterface.DestroyTexture = Core::DestroyTexture;
+
+		platformInterface.CreateSampler = Core::CreateSampler;
+		platformInterface.DestroySampler = Core::DestroySampler;
+
+		platformInterface.CreateTextureTable = Core::CreateTextureTable;
+		platformInterface.DestroyTextureTable = Core::DestroyTextureTable;
+
+		platformInterface.CreateRasterizerState = Core::CreateRasterizerState;
+		platformInterface.DestroyRasterizerState = Core::DestroyRasterizerState;
+
+		platformInterface.CreateDepthStencilState = Core::CreateDepthStencilState;
+		platformInterface.DestroyDepthStencilState = Core::DestroyDepthStencilState;
+
+		platformInterface.CreateProgram = Core::CreateProgram;
+		platformInterface.DestroyProgram = Core::DestroyProgram;
+
+		platformInterface.CreatePipeline = Core::CreatePipeline;
+		platformInterface.DestroyPipeline = Core::DestroyPipeline;
+
+		platformInterface.CreateRenderTarget = Core::CreateRenderTarget;
+		platformInterface.DestroyRenderTarget = Core::DestroyRenderTarget;
+		platformInterface.CreateDepthTarget = Core::CreateDepthTarget;
+		platformInterface.DestroyDepthTarget = Core::DestroyDepthTarget;
+		platformInterface.GetBackbuffer = Core::GetBackbuffer;
+
+		platformInterface.Submit = Core::Submit;
+		platformInterface.Present = Core::Present;
+	}
+}
\ No newline at end of file
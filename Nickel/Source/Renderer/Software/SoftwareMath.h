@@ -0,0 +1,86 @@
+#pragma once
+
+#include "../../platform.h"
+#include <cmath>
+
+// NOTE: just enough HLSL-style vector math for the shader ports to read like their .hlsl originals
+namespace Nickel::Renderer::Software {
+	struct float2 {
+		f32 x, y;
+	};
+
+	struct float3 {
+		f32 x, y, z;
+	};
+
+	struct float4 {
+		f32 x, y, z, w;
+
+		inline auto xyz() const -> float3 { return { x, y, z }; }
+	};
+
+	inline auto operator+(float2 a, float2 b) -> float2 { return { a.x + b.x, a.y + b.y }; }
+	inline auto operator-(float2 a, float2 b) -> float2 { return { a.x - b.x, a.y - b.y }; }
+	inline auto operator*(float2 a, f32 s)    -> float2 { return { a.x * s, a.y * s }; }
+	inline auto operator*(float2 a, float2 b) -> float2 { return { a.x * b.x, a.y * b.y }; }
+	inline auto operator/(float2 a, f32 s)    -> float2 { return { a.x / s, a.y / s }; }
+
+	inline auto operator+(float3 a, float3 b) -> float3 { return { a.x + b.x, a.y + b.y, a.z + b.z }; }
+	inline auto operator+(float3 a, f32 s)    -> float3 { return { a.x + s, a.y + s, a.z + s }; }
+	inline auto operator-(float3 a, float3 b) -> float3 { return { a.x - b.x, a.y - b.y, a.z - b.z }; }
+	inline auto operator-(float3 a, f32 s)    -> float3 { return { a.x - s, a.y - s, a.z - s }; }
+	inline auto operator-(f32 s, float3 a)    -> float3 { return { s - a.x, s - a.y, s - a.z }; }
+	inline auto operator-(float3 a)           -> float3 { return { -a.x, -a.y, -a.z }; }
+	inline auto operator*(float3 a, float3 b) -> float3 { return { a.x * b.x, a.y * b.y, a.z * b.z }; }
+	inline auto operator*(float3 a, f32 s)    -> float3 { return { a.x * s, a.y * s, a.z * s }; }
+	inline auto operator*(f32 s, float3 a)    -> float3 { return { a.x * s, a.y * s, a.z * s }; }
+	inline auto operator/(float3 a, float3 b) -> float3 { return { a.x / b.x, a.y / b.y, a.z / b.z }; }
+	inline auto operator/(float3 a, f32 s)    -> float3 { return { a.x / s, a.y / s, a.z / s }; }
+	inline auto operator+=(float3& a, float3 b) -> float3& { a = a + b; return a; }
+	inline auto operator*=(float3& a, f32 s)    -> float3& { a = a * s; return a; }
+
+	inline auto operator+(float4 a, float4 b) -> float4 { return { a.x + b.x, a.y + b.y, a.z + b.z, a.w + b.w }; }
+	inline auto operator*(float4 a, f32 s)    -> float4 { return { a.x * s, a.y * s, a.z * s, a.w * s }; }
+
+	inline auto dot(float2 a, float2 b) -> f32 { return a.x * b.x + a.y * b.y; }
+	inline auto dot(float3 a, float3 b) -> f32 { return a.x * b.x + a.y * b.y + a.z * b.z; }
+	inline auto dot(float4 a, float4 b) -> f32 { return a.x * b.x + a.y * b.y + a.z * b.z + a.w * b.w; }
+
+	inline auto cross(float3 a, float3 b) -> float3 {
+		return { a.y * b.z - a.z * b.y, a.z * b.x - a.x * b.z, a.x * b.y - a.y * b.x };
+	}
+
+	inline auto length(float2 v) -> f32 { return std::sqrt(dot(v, v)); }
+	inline auto length(float3 v) -> f32 { return std::sqrt(dot(v, v)); }
+	inline auto normalize(float2 v) -> float2 { return v * (1.0f / length(v)); }
+	inline auto normalize(float3 v) -> float3 { return v * (1.0f / length(v)); }
+
+	inline auto reflect(float3 i, float3 n) -> float3 { return i - n * (2.0f * dot(i, n)); }
+
+	// NOTE: NaN saturates to 0 like on the GPU
+	inline auto saturate(f32 v) -> f32 { return v > 0.0f ? (v < 1.0f ? v : 1.0f) : 0.0f; }
+	inline auto saturate(float3 v) -> float3 { return { saturate(v.x), saturate(v.y), saturate(v.z) }; }
+
+	inline auto max(f32 a, f32 b) -> f32 { return a > b ? a : b; }
+	inline auto max(float3 a, float3 b) -> float3 { return { max(a.x, b.x), max(a.y, b.y), max(a.z, b.z) }; }
+
+	inline auto lerp(f32 a, f32 b, f32 t) -> f32 { return a + (b - a) * t; }
+	inline auto lerp(float3 a, float3 b, f32 t) -> float3 { return a + (b - a) * t; }
+
+	inline auto pow(float3 v, f32 e) -> float3 { return { std::pow(v.x, e), std::pow(v.y, e), std::pow(v.z, e) }; }
+
+	// NOTE: HLSL 'matrix' as uploaded by the game (transposed XMMATRIX = column major), so a row of 'm' is a column of the math matrix
+	struct float4x4 {
+		float4 m[4];
+	};
+
+	// NOTE: mul(v, M) in HLSL
+	inline auto mul(float4 v, const float4x4& matrix) -> float4 {
+		return { dot(v, matrix.m[0]), dot(v, matrix.m[1]), dot(v, matrix.m[2]), dot(v, matrix.m[3]) };
+	}
+
+	// NOTE: mul(v, (float3x3)M) in HLSL
+	inline auto mul3x3(float3 v, const float4x4& matrix) -> float3 {
+		return { dot(v, matrix.m[0].xyz()), dot(v, matrix.m[1].xyz()), dot(v, matrix.m[2].xyz()) };
+	}
+}
\ No newline at end of file
@@ -0,0 +1,772 @@
+#include "SoftwareRasterizer.h"
+#include "../../Threading.h"
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstring>
+
+#if defined(_M_X64) || defined(__x86_64__)
+#define NICKEL_SOFTWARE_AVX2 1
+#include <immintrin.h>
+#if defined(__GNUC__) || defined(__clang__)
+#define AVX2_FUNCTION __attribute__((target("avx2")))
+#else
+#include <intrin.h>
+#define AVX2_FUNCTION
+#endif
+#endif
+
+namespace Nickel::Renderer::Software {
+	namespace {
+		constexpr u32 BatchPrimitives = 1024;
+		constexpr f32 SubpixelScale = 256.0f; // NOTE: vertices are snapped to 1/256 pixel before setup
+		constexpr f32 MinClipW = 1e-5f;
+
+		// NOTE: edge i is E(x, y) = A*x + (B*y + C), positive inside. C is computed from the lexicographically smaller endpoint,
+		// so the two triangles sharing an edge evaluate exactly negated values and the top-left rule gives every pixel to one of them.
+		struct Triangle {
+			f32 edgeA[3], edgeB[3], edgeC[3];
+			u32 topLeft; // NOTE: bit per edge, pixels exactly on a top or left edge are inside
+			f32 originX, originY; // NOTE: planes are evaluated relative to the first vertex
+			f32 depthPlane[3];
+			i32 minX, minY, maxX, maxY;
+			u32 planeOffset; // NOTE: (1 + varyingCount) planes in Batch::planes, 1/w first then varying/w
+		};
+
+		// NOTE: 4x2 pixels, two 2x2 quads side by side, lane = row * 4 + column
+		struct Block {
+			i32 x, y;
+			u32 mask;
+			alignas(32) f32 invW[8];
+			alignas(32) f32 varyings[MaxVaryings][8];
+		};
+
+		struct VertexCache {
+			static constexpr u32 Size = 256;
+			i64 keys[Size];
+			VertexOutput outputs[Size];
+		};
+
+		auto DetectAVX2() -> bool {
+#if defined(NICKEL_SOFTWARE_AVX2)
+#if defined(__GNUC__) || defined(__clang__)
+			__builtin_cpu_init();
+			return __builtin_cpu_supports("avx2");
+#else
+			i32 info[4];
+			__cpuid(info, 0);
+			if (info[0] < 7)
+				return false;
+
+			__cpuid(info, 1);
+			const bool osxsave = (info[2] & (1 << 27)) != 0;
+			const bool avx = (info[2] & (1 << 28)) != 0;
+			if (!osxsave || !avx || (_xgetbv(0) & 0x6) != 0x6)
+				return false;
+
+			__cpuidex(info, 7, 0);
+			return (info[1] & (1 << 5)) != 0;
+#endif
+#else
+			return false;
+#endif
+		}
+
+		auto InstancePrimitiveCount(const DrawCall& draw) -> u32 {
+			switch (draw.topology) {
+				case PrimitiveTopology::TriangleList:  return draw.count / 3;
+				case PrimitiveTopology::TriangleStrip: return draw.count >= 3 ? draw.count - 2 : 0;
+				default: return 0;
+			}
+		}
+
+		auto PrimitiveCount(const DrawCall& draw) -> u32 {
+			return InstancePrimitiveCount(draw) * draw.instanceCount;
+		}
+
+		auto FetchIndex(const DrawCall& draw, u32 i) -> i64 {
+			if (draw.indices == nullptr)
+				return static_cast<i64>(draw.first) + i;
+
+			if (draw.indexFormat == IndexFormat::U16) {
+				u16 index;
+				std::memcpy(&index, draw.indices + (static_cast<u64>(draw.first) + i) * sizeof(u16), sizeof(index));
+				return static_cast<i64>(index) + draw.baseVertex;
+			}
+
+			u32 index;
+			std::memcpy(&index, draw.indices + (static_cast<u64>(draw.first) + i) * sizeof(u32), sizeof(index));
+			return static_cast<i64>(index) + draw.baseVertex;
+		}
+
+		auto ShadeVertex(const DrawCall& draw, VertexCache& cache, i64 index, u32 instance) -> const VertexOutput* {
+			if (index < 0 || index >= draw.vertexCount)
+				return nullptr;
+
+			// NOTE: instances never share vertices, the key keeps them apart
+			const i64 key = (static_cast<i64>(instance) << 32) | index;
+			const u32 slot = static_cast<u32>(index + instance * draw.count) & (VertexCache::Size - 1);
+			auto& out = cache.outputs[slot];
+			if (cache.keys[slot] != key) {
+				cache.keys[slot] = key;
+				draw.vertexShader(draw.vertices + static_cast<u64>(index) * draw.vertexStride, VertexIds{ static_cast<u32>(index), instance }, draw.vertexResources, out);
+			}
+
+			return &out;
+		}
+
+		auto Lerp(const VertexOutput& a, const VertexOutput& b, f32 t, u32 varyingCount) -> VertexOutput {
+			VertexOutput result;
+			result.position = a.position + (b.position + a.position * -1.0f) * t;
+			for (u32 k = 0; k < varyingCount; k++)
+				result.varyings[k] = a.varyings[k] + (b.varyings[k] - a.varyings[k]) * t;
+
+			return result;
+		}
+
+		enum class ClipPlane : u8 { W, Near, Far };
+
+		auto ClipDistance(ClipPlane plane, const float4& p) -> f32 {
+			switch (plane) {
+				case ClipPlane::W:    return p.w - MinClipW;
+				case ClipPlane::Near: return p.z;
+				case ClipPlane::Far:  return p.w - p.z;
+			}
+
+			return 0.0f;
+		}
+
+		// NOTE: Sutherland-Hodgman against one plane, a triangle clipped by 3 planes has at most 6 vertices
+		auto ClipPolygon(ClipPlane plane, const VertexOutput* in, u32 inCount, VertexOutput* out, u32 varyingCount) -> u32 {
+			u32 outCount = 0;
+			for (u32 i = 0; i < inCount; i++) {
+				const auto& a = in[i];
+				const auto& b = in[(i + 1) % inCount];
+				const f32 da = ClipDistance(plane, a.position);
+				const f32 db = ClipDistance(plane, b.position);
+
+				if (da >= 0.0f)
+					out[outCount++] = a;
+
+				if ((da >= 0.0f) != (db >= 0.0f))
+					out[outCount++] = Lerp(a, b, da / (da - db), varyingCount);
+			}
+
+			return outCount;
+		}
+
+		auto IsTopLeft(f32 a, f32 b) -> bool {
+			// NOTE: clockwise triangles in y-down screen space: left edges go up, top edges go right
+			return a > 0.0f || (a == 0.0f && b > 0.0f);
+		}
+
+		auto ComputePlane(f32 a0, f32 a1, f32 a2, f32 dx1, f32 dy1, f32 dx2, f32 dy2, f32 invArea, f32* out) -> void {
+			const f32 d1 = a1 - a0;
+			const f32 d2 = a2 - a0;
+			out[0] = a0;
+			out[1] = (d1 * dy2 - d2 * dy1) * invArea;
+			out[2] = (d2 * dx1 - d1 * dx2) * invArea;
+		}
+
+		auto PackColor(const float4& c) -> u32 {
+			const u32 r = static_cast<u32>(saturate(c.x) * 255.0f + 0.5f);
+			const u32 g = static_cast<u32>(saturate(c.y) * 255.0f + 0.5f);
+			const u32 b = static_cast<u32>(saturate(c.z) * 255.0f + 0.5f);
+			const u32 a = static_cast<u32>(saturate(c.w) * 255.0f + 0.5f);
+			return (a << 24) | (r << 16) | (g << 8) | b;
+		}
+
+		auto DepthPasses(ComparisonFunc func, f32 z, f32 stored) -> bool {
+			switch (func) {
+				case ComparisonFunc::Never:        return false;
+				case ComparisonFunc::Less:         return z < stored;
+				case ComparisonFunc::Equal:        return z == stored;
+				case ComparisonFunc::LessEqual:    return z <= stored;
+				case ComparisonFunc::Greater:      return z > stored;
+				case ComparisonFunc::NotEqual:     return z != stored;
+				case ComparisonFunc::GreaterEqual: return z >= stored;
+				case ComparisonFunc::Always:       return true;
+			}
+
+			return true;
+		}
+
+		// NOTE: covered pixels of the block inside the triangle's clamped bounds, before the edge test
+		auto BoundsMask(i32 x, i32 y, i32 minX, i32 minY, i32 maxX, i32 maxY) -> u32 {
+			const i32 lo = std::max(0, minX - x);
+			const i32 hi = std::min(4, maxX - x);
+			if (hi <= lo)
+				return 0;
+
+			const u32 columns = ((1u << hi) - 1) & ~((1u << lo) - 1);
+			const bool row0 = y >= minY && y < maxY;
+			const bool row1 = y + 1 >= minY && y + 1 < maxY;
+			return (row0 ? columns : 0) | (row1 ? columns << 4 : 0);
+		}
+
+		struct RasterContext {
+			const Triangle& triangle;
+			const f32* planes;
+			const DrawCall& draw;
+			ColorTarget* color;
+			DepthTarget* depth;
+			i32 minX, minY, maxX, maxY; // NOTE: triangle bounds clamped to the tile
+		};
+
+		// NOTE: runs the pixel shader for the covered lanes, derivatives come from the whole quad including helper lanes
+		auto ShadeBlock(const RasterContext& ctx, const Block& block) -> u32 {
+			const auto& draw = ctx.draw;
+			const u32 varyingCount = draw.shader->varyingCount;
+			u32 shaded = 0;
+
+			for (u32 q = 0; q < 2; q++) {
+				const u32 lanes[4] = { 2 * q, 2 * q + 1, 2 * q + 4, 2 * q + 5 };
+				u32 quadMask = 0;
+				for (u32 i = 0; i < 4; i++)
+					quadMask |= block.mask & (1u << lanes[i]);
+
+				if (quadMask == 0)
+					continue;
+
+				// NOTE: helper lanes far outside the triangle can land behind the eye, take the other row/column then
+				bool valid[4];
+				for (u32 i = 0; i < 4; i++)
+					valid[i] = block.invW[lanes[i]] > 0.0f;
+
+				const i32 ddxFrom = valid[0] && valid[1] ? 0 : (valid[2] && valid[3] ? 2 : -1);
+				const i32 ddyFrom = valid[0] && valid[2] ? 0 : (valid[1] && valid[3] ? 1 : -1);
+
+				f32 ddx[MaxVaryings];
+				f32 ddy[MaxVaryings];
+				for (u32 k = 0; k < varyingCount; k++) {
+					const auto& v = block.varyings[k];
+					ddx[k] = ddxFrom >= 0 ? v[lanes[ddxFrom + 1]] - v[lanes[ddxFrom]] : 0.0f;
+					ddy[k] = ddyFrom >= 0 ? v[lanes[ddyFrom + 2]] - v[lanes[ddyFrom]] : 0.0f;
+				}
+
+				for (u32 i = 0; i < 4; i++) {
+					const u32 lane = lanes[i];
+					if ((block.mask & (1u << lane)) == 0)
+						continue;
+
+					f32 varyings[MaxVaryings];
+					for (u32 k = 0; k < varyingCount; k++)
+						varyings[k] = block.varyings[k][lane];
+
+					const auto result = draw.pixelShader(PixelInput{ .varyings = varyings, .ddx = ddx, .ddy = ddy }, draw.pixelResources);
+
+					const u32 px = static_cast<u32>(block.x) + (lane & 3);
+					const u32 py = static_cast<u32>(block.y) + (lane >> 2);
+					ctx.color->pixels[static_cast<u64>(py) * ctx.color->pitch + px] = PackColor(result);
+					shaded++;
+				}
+			}
+
+			return shaded;
+		}
+
+		auto RasterizeTriangleScalar(const RasterContext& ctx) -> u32 {
+			const auto& t = ctx.triangle;
+			const auto& draw = ctx.draw;
+			const auto& ds = draw.depthStencil;
+			const bool depthTest = ctx.depth != nullptr && ds.depthTest;
+			const bool depthWrite = depthTest && ds.depthWrite;
+			const u32 planeCount = 1 + draw.shader->varyingCount;
+			const f32 minDepth = draw.viewport.minDepth;
+			const f32 maxDepth = draw.viewport.maxDepth;
+
+			u32 shaded = 0;
+			for (i32 y = ctx.minY & ~1; y < ctx.maxY; y += 2) {
+				for (i32 x = ctx.minX & ~3; x < ctx.maxX; x += 4) {
+					Block block;
+					block.x = x;
+					block.y = y;
+					block.mask = 0;
+
+					const u32 bounds = BoundsMask(x, y, ctx.minX, ctx.minY, ctx.maxX, ctx.maxY);
+					if (bounds == 0)
+						continue;
+
+					f32 dx[8], dy[8];
+					for (u32 lane = 0; lane < 8; lane++) {
+						const f32 px = static_cast<f32>(x + static_cast<i32>(lane & 3)) + 0.5f;
+						const f32 py = static_cast<f32>(y + static_cast<i32>(lane >> 2)) + 0.5f;
+						dx[lane] = px - t.originX;
+						dy[lane] = py - t.originY;
+
+						if ((bounds & (1u << lane)) == 0)
+							continue;
+
+						bool inside = true;
+						for (u32 e = 0; e < 3; e++) {
+							const f32 edge = t.edgeA[e] * px + (t.edgeB[e] * py + t.edgeC[e]);
+							inside &= edge > 0.0f || (edge == 0.0f && (t.topLeft & (1u << e)) != 0);
+						}
+
+						if (!inside)
+							continue;
+
+						if (depthTest) {
+							const f32 z = std::min(std::max((t.depthPlane[0] + t.depthPlane[1] * dx[lane]) + t.depthPlane[2] * dy[lane], minDepth), maxDepth);
+							f32& stored = ctx.depth->depth[static_cast<u64>(y + (lane >> 2)) * ctx.depth->pitch + x + (lane & 3)];
+							if (!DepthPasses(ds.depthFunc, z, stored))
+								continue;
+
+							if (depthWrite)
+								stored = z;
+						}
+
+						block.mask |= 1u << lane;
+					}
+
+					if (block.mask == 0 || ctx.color == nullptr)
+						continue;
+
+					for (u32 lane = 0; lane < 8; lane++) {
+						const f32* p = ctx.planes;
+						const f32 invW = (p[0] + p[1] * dx[lane]) + p[2] * dy[lane];
+						const f32 w = 1.0f / invW;
+						block.invW[lane] = invW;
+						for (u32 k = 1; k < planeCount; k++) {
+							p += 3;
+							block.varyings[k - 1][lane] = ((p[0] + p[1] * dx[lane]) + p[2] * dy[lane]) * w;
+						}
+					}
+
+					shaded += ShadeBlock(ctx, block);
+				}
+			}
+
+			return shaded;
+		}
+
+#if defined(NICKEL_SOFTWARE_AVX2)
+		AVX2_FUNCTION auto DepthPasses(ComparisonFunc func, __m256 z, __m256 stored) -> __m256 {
+			switch (func) {
+				case ComparisonFunc::Never:        return _mm256_setzero_ps();
+				case ComparisonFunc::Less:         return _mm256_cmp_ps(z, stored, _CMP_LT_OQ);
+				case ComparisonFunc::Equal:        return _mm256_cmp_ps(z, stored, _CMP_EQ_OQ);
+				case ComparisonFunc::LessEqual:    return _mm256_cmp_ps(z, stored, _CMP_LE_OQ);
+				case ComparisonFunc::Greater:      return _mm256_cmp_ps(z, stored, _CMP_GT_OQ);
+				case ComparisonFunc::NotEqual:     return _mm256_cmp_ps(z, stored, _CMP_NEQ_UQ);
+				case ComparisonFunc::GreaterEqual: return _mm256_cmp_ps(z, stored, _CMP_GE_OQ);
+				case ComparisonFunc::Always:       break;
+			}
+
+			return _mm256_castsi256_ps(_mm256_set1_epi32(-1));
+		}
+
+		// NOTE: same arithmetic, in the same order, as RasterizeTriangleScalar (and no FMA) so both paths produce identical images
+		AVX2_FUNCTION auto RasterizeTriangleAVX2(const RasterContext& ctx) -> u32 {
+			const auto& t = ctx.triangle;
+			const auto& draw = ctx.draw;
+			const auto& ds = draw.depthStencil;
+			const bool depthTest = ctx.depth != nullptr && ds.depthTest;
+			const bool depthWrite = depthTest && ds.depthWrite;
+			const u32 planeCount = 1 + draw.shader->varyingCount;
+
+			const __m256 laneX = _mm256_setr_ps(0.5f, 1.5f, 2.5f, 3.5f, 0.5f, 1.5f, 2.5f, 3.5f);
+			const __m256 laneY = _mm256_setr_ps(0.5f, 0.5f, 0.5f, 0.5f, 1.5f, 1.5f, 1.5f, 1.5f);
+			const __m256 zero = _mm256_setzero_ps();
+			const __m256 originX = _mm256_set1_ps(t.originX);
+			const __m256 originY = _mm256_set1_ps(t.originY);
+			const __m256 minDepth = _mm256_set1_ps(draw.viewport.minDepth);
+			const __m256 maxDepth = _mm256_set1_ps(draw.viewport.maxDepth);
+
+			__m256 edgeA[3], edgeB[3], edgeC[3], topLeft[3];
+			for (u32 e = 0; e < 3; e++) {
+				edgeA[e] = _mm256_set1_ps(t.edgeA[e]);
+				edgeB[e] = _mm256_set1_ps(t.edgeB[e]);
+				edgeC[e] = _mm256_set1_ps(t.edgeC[e]);
+				topLeft[e] = _mm256_castsi256_ps(_mm256_set1_epi32((t.topLeft & (1u << e)) != 0 ? -1 : 0));
+			}
+
+			u32 shaded = 0;
+			for (i32 y = ctx.minY & ~1; y < ctx.maxY; y += 2) {
+				const __m256 py = _mm256_add_ps(_mm256_set1_ps(static_cast<f32>(y)), laneY);
+				const __m256 dy = _mm256_sub_ps(py, originY);
+
+				__m256 rowEdge[3];
+				for (u32 e = 0; e < 3; e++)
+					rowEdge[e] = _mm256_add_ps(_mm256_mul_ps(edgeB[e], py), edgeC[e]);
+
+				for (i32 x = ctx.minX & ~3; x < ctx.maxX; x += 4) {
+					const u32 bounds = BoundsMask(x, y, ctx.minX, ctx.minY, ctx.maxX, ctx.maxY);
+					if (bounds == 0)
+						continue;
+
+					const __m256 px = _mm256_add_ps(_mm256_set1_ps(static_cast<f32>(x)), laneX);
+
+					__m256 inside = _mm256_castsi256_ps(_mm256_set1_epi32(-1));
+					for (u32 e = 0; e < 3; e++) {
+						const __m256 edge = _mm256_add_ps(_mm256_mul_ps(edgeA[e], px), rowEdge[e]);
+						const __m256 positive = _mm256_cmp_ps(edge, zero, _CMP_GT_OQ);
+						const __m256 onEdge = _mm256_and_ps(_mm256_cmp_ps(edge, zero, _CMP_EQ_OQ), topLeft[e]);
+						inside = _mm256_and_ps(inside, _mm256_or_ps(positive, onEdge));
+					}
+
+					u32 mask = static_cast<u32>(_mm256_movemask_ps(inside)) & bounds;
+					if (mask == 0)
+						continue;
+
+					const __m256 dx = _mm256_sub_ps(px, originX);
+
+					if (depthTest) {
+						f32* row0 = ctx.depth->depth.data() + static_cast<u64>(y) * ctx.depth->pitch + x;
+						f32* row1 = row0 + ctx.depth->pitch;
+						const __m256 stored = _mm256_set_m128(_mm_loadu_ps(row1), _mm_loadu_ps(row0));
+
+						__m256 z = _mm256_add_ps(_mm256_add_ps(_mm256_set1_ps(t.depthPlane[0]), _mm256_mul_ps(_mm256_set1_ps(t.depthPlane[1]), dx)), _mm256_mul_ps(_mm256_set1_ps(t.depthPlane[2]), dy));
+						z = _mm256_min_ps(_mm256_max_ps(z, minDepth), maxDepth);
+
+						mask &= static_cast<u32>(_mm256_movemask_ps(DepthPasses(ds.depthFunc, z, stored)));
+						if (mask == 0)
+							continue;
+
+						if (depthWrite) {
+							const __m256i writeMask = _mm256_cmpgt_epi32(_mm256_and_si256(_mm256_set1_epi32(static_cast<i32>(mask)), _mm256_setr_epi32(1, 2, 4, 8, 16, 32, 64, 128)), _mm256_setzero_si256());
+							const __m256 written = _mm256_blendv_ps(stored, z, _mm256_castsi256_ps(writeMask));
+							_mm_storeu_ps(row0, _mm256_castps256_ps128(written));
+							_mm_storeu_ps(row1, _mm256_extractf128_ps(written, 1));
+						}
+					}
+
+					if (ctx.color == nullptr)
+						continue;
+
+					Block block;
+					block.x = x;
+					block.y = y;
+					block.mask = mask;
+
+					const f32* p = ctx.planes;
+					const __m256 invW = _mm256_add_ps(_mm256_add_ps(_mm256_set1_ps(p[0]), _mm256_mul_ps(_mm256_set1_ps(p[1]), dx)), _mm256_mul_ps(_mm256_set1_ps(p[2]), dy));
+					const __m256 w = _mm256_div_ps(_mm256_set1_ps(1.0f), invW);
+					_mm256_store_ps(block.invW, invW);
+					for (u32 k = 1; k < planeCount; k++) {
+						p += 3;
+						const __m256 v = _mm256_add_ps(_mm256_add_ps(_mm256_set1_ps(p[0]), _mm256_mul_ps(_mm256_set1_ps(p[1]), dx)), _mm256_mul_ps(_mm256_set1_ps(p[2]), dy));
+						_mm256_store_ps(block.varyings[k - 1], _mm256_mul_ps(v, w));
+					}
+
+					shaded += ShadeBlock(ctx, block);
+				}
+			}
+
+			return shaded;
+		}
+#endif
+	}
+
+	struct Rasterizer::Batch {
+		u32 drawIdx;
+		u32 firstPrimitive;
+		u32 primitiveCount;
+
+		std::vector<Triangle> triangles;
+		std::vector<f32> planes;
+		std::vector<std::vector<u32>> bins; // NOTE: triangle indices per tile, in submission order
+		RasterizerStats stats;
+	};
+
+	Rasterizer::Rasterizer() = default;
+	Rasterizer::~Rasterizer() = default;
+
+	auto Rasterizer::Init(u32 workers) -> void {
+		workerCount = std::max(1u, workers);
+		useAVX2 = DetectAVX2();
+	}
+
+	auto Rasterizer::SetTargets(ColorTarget* newColor, DepthTarget* newDepth) -> void {
+		if (newColor == color && newDepth == depth)
+			return;
+
+		Flush();
+		color = newColor;
+		depth = newDepth;
+
+		u32 width = 0, height = 0;
+		if (color != nullptr) {
+			width = color->width;
+			height = color->height;
+		}
+
+		if (depth != nullptr) {
+			width = color != nullptr ? std::min(width, depth->width) : depth->width;
+			height = color != nullptr ? std::min(height, depth->height) : depth->height;
+		}
+
+		tilesX = (width + TileSize - 1) / TileSize;
+		tilesY = (height + TileSize - 1) / TileSize;
+	}
+
+	auto Rasterizer::Draw(const DrawCall& draw) -> void {
+		if (color == nullptr && depth == nullptr)
+			return;
+
+		const u32 primitives = PrimitiveCount(draw);
+		if (primitives == 0)
+			return;
+
+		draws.push_back(draw);
+		pendingPrimitives += primitives;
+	}
+
+	auto Rasterizer::SetupBatch(Batch& batch) -> void {
+		const auto& draw = draws[batch.drawIdx];
+		const auto& vp = draw.viewport;
+		const u32 varyingCount = draw.shader->varyingCount;
+		const bool depthClip = draw.rasterizer.depthClip;
+		const i32* clip = draw.clipRect;
+		auto& stats = batch.stats;
+
+		auto cache = std::make_unique<VertexCache>();
+		std::fill(std::begin(cache->keys), std::end(cache->keys), -1);
+
+		auto emit = [&](const VertexOutput& a, const VertexOutput& b, const VertexOutput& c) {
+			const VertexOutput* v[3] = { &a, &b, &c };
+			f32 sx[3], sy[3], sz[3], invW[3];
+			for (u32 i = 0; i < 3; i++) {
+				const auto& p = v[i]->position;
+				invW[i] = 1.0f / p.w;
+				sx[i] = std::round((vp.x + (p.x * invW[i] + 1.0f) * 0.5f * vp.width) * SubpixelScale) / SubpixelScale;
+				sy[i] = std::round((vp.y + (1.0f - p.y * invW[i]) * 0.5f * vp.height) * SubpixelScale) / SubpixelScale;
+				sz[i] = vp.minDepth + p.z * invW[i] * (vp.maxDepth - vp.minDepth);
+				if (!std::isfinite(sx[i]) || !std::isfinite(sy[i]) || !std::isfinite(sz[i])) {
+					stats.trianglesCulled++;
+					return;
+				}
+			}
+
+			const f32 area = (sx[1] - sx[0]) * (sy[2] - sy[0]) - (sx[2] - sx[0]) * (sy[1] - sy[0]);
+			const bool frontFacing = draw.rasterizer.frontCounterClockwise ? area < 0.0f : area > 0.0f;
+			const auto cullMode = draw.rasterizer.cullMode;
+			if (area == 0.0f || (cullMode == CullMode::Back && !frontFacing) || (cullMode == CullMode::Front && frontFacing)) {
+				stats.trianglesCulled++;
+				return;
+			}
+
+			// NOTE: rasterize clockwise so inside is always positive
+			u32 order[3] = { 0, 1, 2 };
+			if (area < 0.0f)
+				std::swap(order[1], order[2]);
+
+			const f32 x0 = sx[order[0]], y0 = sy[order[0]];
+			const f32 x1 = sx[order[1]], y1 = sy[order[1]];
+			const f32 x2 = sx[order[2]], y2 = sy[order[2]];
+
+			// NOTE: pixel centers inside [min, max) of the clamped bounds
+			const f32 minXf = std::clamp(std::min({ x0, x1, x2 }) - 0.5f, static_cast<f32>(clip[0]), static_cast<f32>(clip[2]));
+			const f32 minYf = std::clamp(std::min({ y0, y1, y2 }) - 0.5f, static_cast<f32>(clip[1]), static_cast<f32>(clip[3]));
+			const f32 maxXf = std::clamp(std::max({ x0, x1, x2 }) - 0.5f, static_cast<f32>(clip[0] - 1), static_cast<f32>(clip[2] - 1));
+			const f32 maxYf = std::clamp(std::max({ y0, y1, y2 }) - 0.5f, static_cast<f32>(clip[1] - 1), static_cast<f32>(clip[3] - 1));
+
+			Triangle t;
+			t.minX = static_cast<i32>(std::ceil(minXf));
+			t.minY = static_cast<i32>(std::ceil(minYf));
+			t.maxX = static_cast<i32>(std::floor(maxXf)) + 1;
+			t.maxY = static_cast<i32>(std::floor(maxYf)) + 1;
+			if (t.minX >= t.maxX || t.minY >= t.maxY) {
+				stats.trianglesCulled++;
+				return;
+			}
+
+			const f32 xs[3] = { x0, x1, x2 };
+			const f32 ys[3] = { y0, y1, y2 };
+			t.topLeft = 0;
+			for (u32 e = 0; e < 3; e++) {
+				const u32 i = e;
+				const u32 j = (e + 1) % 3;
+				const f32 a = ys[i] - ys[j];
+				const f32 b = xs[j] - xs[i];
+				const bool iFirst = xs[i] < xs[j] || (xs[i] == xs[j] && ys[i] < ys[j]);
+				const u32 c = iFirst ? i : j;
+
+				t.edgeA[e] = a;
+				t.edgeB[e] = b;
+				t.edgeC[e] = -(a * xs[c] + b * ys[c]);
+				if (IsTopLeft(a, b))
+					t.topLeft |= 1u << e;
+			}
+
+			const f32 dx1 = x1 - x0, dy1 = y1 - y0;
+			const f32 dx2 = x2 - x0, dy2 = y2 - y0;
+			const f32 invArea = 1.0f / std::abs(area);
+			t.originX = x0;
+			t.originY = y0;
+			ComputePlane(sz[order[0]], sz[order[1]], sz[order[2]], dx1, dy1, dx2, dy2, invArea, t.depthPlane);
+
+			t.planeOffset = static_cast<u32>(batch.planes.size());
+			batch.planes.resize(batch.planes.size() + (1 + varyingCount) * 3);
+			f32* planes = batch.planes.data() + t.planeOffset;
+			ComputePlane(invW[order[0]], invW[order[1]], invW[order[2]], dx1, dy1, dx2, dy2, invArea, planes);
+			for (u32 k = 0; k < varyingCount; k++) {
+				planes += 3;
+				ComputePlane(v[order[0]]->varyings[k] * invW[order[0]], v[order[1]]->varyings[k] * invW[order[1]], v[order[2]]->varyings[k] * invW[order[2]], dx1, dy1, dx2, dy2, invArea, planes);
+			}
+
+			const u32 triangleIdx = static_cast<u32>(batch.triangles.size());
+			batch.triangles.push_back(t);
+			stats.trianglesBinned++;
+
+			const u32 tx0 = static_cast<u32>(t.minX) / TileSize, tx1 = static_cast<u32>(t.maxX - 1) / TileSize;
+			const u32 ty0 = static_cast<u32>(t.minY) / TileSize, ty1 = static_cast<u32>(t.maxY - 1) / TileSize;
+			for (u32 ty = ty0; ty <= ty1; ty++)
+				for (u32 tx = tx0; tx <= tx1; tx++)
+					batch.bins[ty * tilesX + tx].push_back(triangleIdx);
+		};
+
+		const u32 instancePrimitives = InstancePrimitiveCount(draw);
+		for (u32 prim = batch.firstPrimitive; prim < batch.firstPrimitive + batch.primitiveCount; prim++) {
+			stats.primitives++;
+
+			// NOTE: instances are laid out one after another in the draw's primitive range
+			const u32 instance = prim / instancePrimitives;
+			const u32 local = prim - instance * instancePrimitives;
+			u32 i0 = local * 3, i1 = local * 3 + 1, i2 = local * 3 + 2;
+			if (draw.topology == PrimitiveTopology::TriangleStrip) {
+				// NOTE: every odd strip triangle is flipped back to the winding of the first one
+				i0 = local;
+				i1 = local % 2 == 0 ? local + 1 : local + 2;
+				i2 = local % 2 == 0 ? local + 2 : local + 1;
+			}
+
+			const auto v0 = ShadeVertex(draw, *cache, FetchIndex(draw, i0), instance);
+			const auto v1 = ShadeVertex(draw, *cache, FetchIndex(draw, i1), instance);
+			const auto v2 = ShadeVertex(draw, *cache, FetchIndex(draw, i2), instance);
+			if (v0 == nullptr || v1 == nullptr || v2 == nullptr) {
+				stats.trianglesCulled++;
+				continue;
+			}
+
+			// NOTE: copies, the next lookups may evict these cache entries
+			VertexOutput polygon[2][8] = { { *v0, *v1, *v2 } };
+
+			// NOTE: trivially reject triangles fully outside one frustum plane
+			const float4* p[3] = { &polygon[0][0].position, &polygon[0][1].position, &polygon[0][2].position };
+			auto allOutside = [&](auto&& outside) { return outside(*p[0]) && outside(*p[1]) && outside(*p[2]); };
+			if (allOutside([](const float4& q) { return q.x < -q.w; }) || allOutside([](const float4& q) { return q.x > q.w; }) ||
+				allOutside([](const float4& q) { return q.y < -q.w; }) || allOutside([](const float4& q) { return q.y > q.w; }) ||
+				allOutside([](const float4& q) { return q.z < 0.0f; }) || (depthClip && allOutside([](const float4& q) { return q.z > q.w; }))) {
+				stats.trianglesCulled++;
+				continue;
+			}
+
+			bool needsClip = false;
+			for (u32 i = 0; i < 3; i++)
+				needsClip |= p[i]->w < MinClipW || p[i]->z < 0.0f || (depthClip && p[i]->z > p[i]->w);
+
+			if (!needsClip) {
+				emit(polygon[0][0], polygon[0][1], polygon[0][2]);
+				continue;
+			}
+
+			stats.trianglesClipped++;
+			u32 count = ClipPolygon(ClipPlane::W, polygon[0], 3, polygon[1], varyingCount);
+			count = ClipPolygon(ClipPlane::Near, polygon[1], count, polygon[0], varyingCount);
+			u32 current = 0;
+			if (depthClip) {
+				count = ClipPolygon(ClipPlane::Far, polygon[0], count, polygon[1], varyingCount);
+				current = 1;
+			}
+
+			for (u32 i = 1; i + 1 < count; i++)
+				emit(polygon[current][0], polygon[current][i], polygon[current][i + 1]);
+		}
+	}
+
+	auto Rasterizer::RasterizeTile(u32 tileIdx, u32 batchCount) -> u32 {
+		const i32 tileX = static_cast<i32>((tileIdx % tilesX) * TileSize);
+		const i32 tileY = static_cast<i32>((tileIdx / tilesX) * TileSize);
+
+		u32 shaded = 0;
+		for (u32 b = 0; b < batchCount; b++) {
+			const auto& batch = *batches[b];
+			const auto& bin = batch.bins[tileIdx];
+			if (bin.empty())
+				continue;
+
+			const auto& draw = draws[batch.drawIdx];
+			for (const u32 triangleIdx : bin) {
+				const auto& t = batch.triangles[triangleIdx];
+				const auto ctx = RasterContext{
+					.triangle = t,
+					.planes = batch.planes.data() + t.planeOffset,
+					.draw = draw,
+					.color = color,
+					.depth = depth,
+					.minX = std::max(t.minX, tileX),
+					.minY = std::max(t.minY, tileY),
+					.maxX = std::min(t.maxX, tileX + static_cast<i32>(TileSize)),
+					.maxY = std::min(t.maxY, tileY + static_cast<i32>(TileSize))
+				};
+
+#if defined(NICKEL_SOFTWARE_AVX2)
+				if (useAVX2) {
+					shaded += RasterizeTriangleAVX2(ctx);
+					continue;
+				}
+#endif
+				shaded += RasterizeTriangleScalar(ctx);
+			}
+		}
+
+		return shaded;
+	}
+
+	auto Rasterizer::Flush() -> void {
+		if (draws.empty())
+			return;
+
+		stats.flushes++;
+		const u32 tileCount = tilesX * tilesY;
+
+		// NOTE: batches are numbered in submission order, that order is what keeps per tile output deterministic
+		u32 batchCount = 0;
+		for (u32 drawIdx = 0; drawIdx < draws.size(); drawIdx++) {
+			const u32 primitives = PrimitiveCount(draws[drawIdx]);
+			for (u32 first = 0; first < primitives; first += BatchPrimitives) {
+				if (batchCount == batches.size())
+					batches.push_back(std::make_unique<Batch>());
+
+				auto& batch = *batches[batchCount++];
+				batch.drawIdx = drawIdx;
+				batch.firstPrimitive = first;
+				batch.primitiveCount = std::min(BatchPrimitives, primitives - first);
+				batch.triangles.clear();
+				batch.planes.clear();
+				batch.bins.resize(tileCount);
+				for (auto& bin : batch.bins)
+					bin.clear();
+				batch.stats = {};
+			}
+		}
+
+		std::atomic<u32> nextBatch = 0;
+		ParallelForChunks(std::min(workerCount, batchCount), workerCount, [&](u32, u32, u32) {
+			for (u32 b = nextBatch++; b < batchCount; b = nextBatch++)
+				SetupBatch(*batches[b]);
+		});
+
+		std::atomic<u64> pixelsShaded = 0;
+		std::atomic<u32> nextTile = 0;
+		ParallelForChunks(std::min(workerCount, tileCount), workerCount, [&](u32, u32, u32) {
+			u64 shaded = 0;
+			for (u32 t = nextTile++; t < tileCount; t = nextTile++)
+				shaded += RasterizeTile(t, batchCount);
+			pixelsShaded += shaded;
+		});
+
+		for (u32 b = 0; b < batchCount; b++) {
+			const auto& s = batches[b]->stats;
+			stats.primitives       += s.primitives;
+			stats.trianglesCulled  += s.trianglesCulled;
+			stats.trianglesClipped += s.trianglesClipped;
+			stats.trianglesBinned  += s.trianglesBinned;
+		}
+		stats.pixelsShaded += pixelsShaded;
+
+		draws.clear();
+		pendingPrimitives = 0;
+	}
+}
\ No newline at end of file
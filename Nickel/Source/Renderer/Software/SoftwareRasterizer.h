@@ -0,0 +1,94 @@
+#pragma once
+
+#include "SoftwareShaders.h"
+#include <memory>
+
+namespace Nickel::Renderer::Software {
+	constexpr u32 TileSize = 64;
+
+	// NOTE: pitch is rounded up to 4 pixels and the row count to 2, so the rasterizer can always touch whole 4x2 blocks
+	struct ColorTarget {
+		u32 width, height, pitch;
+		std::vector<u32> pixels; // NOTE: BGRA8, top row first
+	};
+
+	struct DepthTarget {
+		u32 width, height, pitch;
+		std::vector<f32> depth;
+	};
+
+	// Everything the rasterizer needs to turn one draw into pixels, resolved by the core when the draw is recorded.
+	// All pointers have to stay valid until the next Flush.
+	struct DrawCall {
+		const ShaderPort* shader;
+		VertexShaderFn vertexShader; // NOTE: the variant of the port's shaders the program was created with
+		PixelShaderFn pixelShader;
+		ShaderResources vertexResources;
+		ShaderResources pixelResources;
+
+		const u8* vertices;
+		u32 vertexStride;
+		u32 vertexCount;
+
+		const u8* indices; // NOTE: nullptr for non-indexed draws
+		IndexFormat indexFormat;
+		u32 first;         // NOTE: first index, or first vertex for non-indexed draws
+		u32 count;         // NOTE: per instance
+		i32 baseVertex;
+		u32 instanceCount; // NOTE: 1 for draws that aren't instanced
+		PrimitiveTopology topology;
+
+		RasterizerDesc rasterizer;
+		DepthStencilDesc depthStencil;
+		Viewport viewport;
+		i32 clipRect[4]; // NOTE: viewport clamped to the target, [minX, minY, maxX, maxY)
+	};
+
+	struct RasterizerStats {
+		u64 primitives;
+		u64 trianglesCulled;  // NOTE: back faces, degenerate and off screen triangles
+		u64 trianglesClipped; // NOTE: triangles that crossed the near or far plane
+		u64 trianglesBinned;
+		u64 pixelsShaded;
+		u32 flushes;
+	};
+
+	// Sort-middle tile renderer: Flush shades vertices and sets up triangles for all queued draws in parallel,
+	// bins them into TileSize tiles, then every worker rasterizes whole tiles so no two threads touch the same pixels.
+	// Submission order is kept per tile, blending free depth tested output is identical to drawing in order.
+	class Rasterizer {
+	public:
+		Rasterizer();
+		~Rasterizer();
+
+		auto Init(u32 workerCount) -> void;
+		auto SetTargets(ColorTarget* color, DepthTarget* depth) -> void; // NOTE: flushes if the targets change
+
+		auto Draw(const DrawCall& draw) -> void;
+		auto Flush() -> void;
+
+		inline auto HasPendingWork() const -> bool { return !draws.empty(); }
+		inline auto PendingPrimitives() const -> u64 { return pendingPrimitives; }
+		inline auto UsesAVX2() const -> bool { return useAVX2; }
+		inline auto GetStats() const -> const RasterizerStats& { return stats; }
+		inline auto ResetStats() -> void { stats = {}; }
+
+	private:
+		struct Batch;
+
+		auto SetupBatch(Batch& batch) -> void;
+		auto RasterizeTile(u32 tileIdx, u32 batchCount) -> u32; // NOTE: returns the number of shaded pixels
+
+		ColorTarget* color = nullptr;
+		DepthTarget* depth = nullptr;
+		u32 tilesX = 0, tilesY = 0;
+
+		std::vector<DrawCall> draws;
+		std::vector<std::unique_ptr<Batch>> batches; // NOTE: kept across flushes so steady-state frames don't allocate
+		u64 pendingPrimitives = 0;
+
+		u32 workerCount = 1;
+		bool useAVX2 = false;
+		RasterizerStats stats{};
+	};
+}
\ No newline at end of file
@@ -0,0 +1,681 @@
+#include "SoftwareShaders.h"
+#include "../ClusteredLighting.h"
+#include "../SphericalHarmonics.h"
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <utility>
+
+namespace Nickel::Renderer::Software {
+	namespace {
+		// Texture sampling ---------------------------
+
+		auto HalfToFloat(u16 half) -> f32 {
+			const u32 sign = static_cast<u32>(half & 0x8000) << 16;
+			const u32 exponent = (half >> 10) & 0x1f;
+			u32 mantissa = half & 0x3ff;
+
+			u32 bits;
+			if (exponent == 0) {
+				if (mantissa == 0) {
+					bits = sign;
+				} else { // NOTE: denormal, renormalize
+					u32 e = 113;
+					while ((mantissa & 0x400) == 0) {
+						mantissa <<= 1;
+						e--;
+					}
+					bits = sign | (e << 23) | ((mantissa & 0x3ff) << 13);
+				}
+			} else if (exponent == 31) {
+				bits = sign | 0x7f800000 | (mantissa << 13);
+			} else {
+				bits = sign | ((exponent + 112) << 23) | (mantissa << 13);
+			}
+
+			f32 result;
+			std::memcpy(&result, &bits, sizeof(result));
+			return result;
+		}
+
+		auto Fetch(const Texture& texture, u32 subresource, u32 width, u32 x, u32 y) -> float4 {
+			const auto format = texture.desc.format;
+			const u8* texel = texture.data.data() + texture.subresourceOffsets[subresource] + (static_cast<u64>(y) * width + x) * GetTexelSize(format);
+
+			switch (format) {
+				case TextureFormat::RGBA8_UNORM: {
+					constexpr f32 scale = 1.0f / 255.0f;
+					return { texel[0] * scale, texel[1] * scale, texel[2] * scale, texel[3] * scale };
+				}
+
+				case TextureFormat::RGBA16_FLOAT: {
+					u16 h[4];
+					std::memcpy(h, texel, sizeof(h));
+					return { HalfToFloat(h[0]), HalfToFloat(h[1]), HalfToFloat(h[2]), HalfToFloat(h[3]) };
+				}
+
+				case TextureFormat::RGBA32_FLOAT: {
+					float4 result;
+					std::memcpy(&result, texel, sizeof(result));
+					return result;
+				}
+
+				case TextureFormat::RG16_FLOAT: {
+					u16 h[2];
+					std::memcpy(h, texel, sizeof(h));
+					return { HalfToFloat(h[0]), HalfToFloat(h[1]), 0.0f, 1.0f };
+				}
+
+				case TextureFormat::R32_FLOAT: {
+					f32 r;
+					std::memcpy(&r, texel, sizeof(r));
+					return { r, 0.0f, 0.0f, 1.0f };
+				}
+
+				// NOTE: CreateTexture decodes block compressed data to RGBA8, no texture is stored in these
+				case TextureFormat::BC1_UNORM:
+				case TextureFormat::BC5_UNORM:
+				case TextureFormat::BC7_UNORM:
+					Assert(false);
+					break;
+			}
+
+			return {};
+		}
+
+		auto Address(i32 coord, i32 size, TextureAddressMode mode) -> u32 {
+			switch (mode) {
+				case TextureAddressMode::Wrap: {
+					coord %= size;
+					return static_cast<u32>(coord < 0 ? coord + size : coord);
+				}
+
+				case TextureAddressMode::Mirror: {
+					const i32 period = size * 2;
+					coord %= period;
+					if (coord < 0)
+						coord += period;
+					return static_cast<u32>(coord < size ? coord : period - 1 - coord);
+				}
+
+				case TextureAddressMode::Clamp: break;
+			}
+
+			return static_cast<u32>(std::clamp(coord, 0, size - 1));
+		}
+
+		auto SampleLevel(const Texture& texture, const SamplerDesc& sampler, u32 subresource, u32 mip, float2 uv) -> float4 {
+			const u32 width  = std::max(1u, texture.desc.width >> mip);
+			const u32 height = std::max(1u, texture.desc.height >> mip);
+			const f32 x = uv.x * width;
+			const f32 y = uv.y * height;
+
+			if (sampler.filter == TextureFilter::Point) {
+				const u32 px = Address(static_cast<i32>(std::floor(x)), width, sampler.addressMode);
+				const u32 py = Address(static_cast<i32>(std::floor(y)), height, sampler.addressMode);
+				return Fetch(texture, subresource, width, px, py);
+			}
+
+			// NOTE: anisotropic falls back to bilinear
+			const f32 fx = x - 0.5f;
+			const f32 fy = y - 0.5f;
+			const f32 x0f = std::floor(fx);
+			const f32 y0f = std::floor(fy);
+			const f32 tx = fx - x0f;
+			const f32 ty = fy - y0f;
+			const i32 x0 = static_cast<i32>(x0f);
+			const i32 y0 = static_cast<i32>(y0f);
+
+			const u32 ax0 = Address(x0, width, sampler.addressMode);
+			const u32 ax1 = Address(x0 + 1, width, sampler.addressMode);
+			const u32 ay0 = Address(y0, height, sampler.addressMode);
+			const u32 ay1 = Address(y0 + 1, height, sampler.addressMode);
+
+			const auto t00 = Fetch(texture, subresource, width, ax0, ay0);
+			const auto t10 = Fetch(texture, subresource, width, ax1, ay0);
+			const auto t01 = Fetch(texture, subresource, width, ax0, ay1);
+			const auto t11 = Fetch(texture, subresource, width, ax1, ay1);
+
+			const auto top    = t00 * (1.0f - tx) + t10 * tx;
+			const auto bottom = t01 * (1.0f - tx) + t11 * tx;
+			return top * (1.0f - ty) + bottom * ty;
+		}
+
+		// Shader ports ---------------------------
+		// NOTE: each port mirrors the .hlsl file named in its comment, keep them in sync
+
+		// CommonConstantBuffers.hlsl
+		struct PerApplication {
+			float4x4 projectionMatrix;
+			float3 clientData;
+		};
+
+		struct PerFrame {
+			float4x4 viewMatrix;
+			float3 eyePos;
+			f32 padding;
+			float3 lightPos;
+		};
+
+		struct PerObject {
+			float4x4 modelMatrix;
+			float4x4 viewProjectionMatrix;
+			float4x4 modelViewProjectionMatrix;
+		};
+
+		enum ConstantSlot : u32 {
+			PerApplicationSlot = 0,
+			PerFrameSlot = 1,
+			PerObjectSlot = 2,
+			ShaderDataSlot = 3,
+			ClusterDataSlot = ClusterConstantSlot,
+			IrradianceDataSlot = IrradianceConstantSlot
+		};
+
+		auto ReadFloat3(const u8* vertex, u32 offset) -> float3 {
+			float3 result;
+			std::memcpy(&result, vertex + offset, sizeof(result));
+			return result;
+		}
+
+		auto ReadFloat2(const u8* vertex, u32 offset) -> float2 {
+			float2 result;
+			std::memcpy(&result, vertex + offset, sizeof(result));
+			return result;
+		}
+
+		auto Write(f32* varyings, float2 v) -> void { varyings[0] = v.x; varyings[1] = v.y; }
+		auto Write(f32* varyings, float3 v) -> void { varyings[0] = v.x; varyings[1] = v.y; varyings[2] = v.z; }
+		auto Write(f32* varyings, float4 v) -> void { varyings[0] = v.x; varyings[1] = v.y; varyings[2] = v.z; varyings[3] = v.w; }
+
+		// PbrHelper.hlsl
+		constexpr f32 PI = 3.14159265359f;
+
+		auto ToneMapHDR(float3 color) -> float3 {
+			// Reinhard operator
+			return color / (color + 1.0f);
+		}
+
+		auto CorrectGamma(float3 color) -> float3 {
+			return pow(color, 1.0f / 2.2f);
+		}
+
+		auto DistributionGGX(float3 N, float3 H, f32 roughness) -> f32 {
+			const f32 a = roughness * roughness;
+			const f32 a2 = a * a;
+			const f32 NdotH = max(dot(N, H), 0.0f);
+			const f32 NdotH2 = NdotH * NdotH;
+
+			f32 denom = (NdotH2 * (a2 - 1.0f) + 1.0f);
+			denom = PI * denom * denom;
+
+			return a2 / denom;
+		}
+
+		auto GeometrySchlickGGX(f32 NdotV, f32 roughness) -> f32 {
+			const f32 r = (roughness + 1.0f);
+			const f32 k = (r * r) / 8.0f;
+
+			return NdotV / (NdotV * (1.0f - k) + k);
+		}
+
+		auto GeometrySmith(float3 N, float3 V, float3 L, f32 roughness) -> f32 {
+			const f32 NdotV = max(dot(N, V), 0.0f);
+			const f32 NdotL = max(dot(N, L), 0.0f);
+			return GeometrySchlickGGX(NdotL, roughness) * GeometrySchlickGGX(NdotV, roughness);
+		}
+
+		auto FresnelSchlick(f32 cosTheta, float3 F0) -> float3 {
+			return F0 + (1.0f - F0) * std::pow(saturate(1.0f - cosTheta), 5.0f);
+		}
+
+		auto FresnelSchlickRoughness(f32 cosTheta, float3 F0, f32 roughness) -> float3 {
+			const f32 oneMinusRoughness = 1.0f - roughness;
+			return F0 + (max(float3{ oneMinusRoughness, oneMinusRoughness, oneMinusRoughness }, F0) - F0) * std::pow(saturate(1.0f - cosTheta), 5.0f);
+		}
+
+		// SphericalHarmonics.hlsl
+		auto EvaluateIrradianceSH(const IrradianceShaderData& sh, float3 n) -> float3 {
+			const auto c = [&](u32 i) { return float3{ sh.coefficients[i][0], sh.coefficients[i][1], sh.coefficients[i][2] }; };
+			const float3 result = c(0) + c(1) * n.y + c(2) * n.z + c(3) * n.x +
+				c(4) * (n.x * n.y) + c(5) * (n.y * n.z) + c(6) * (3.0f * n.z * n.z - 1.0f) + c(7) * (n.x * n.z) + c(8) * (n.x * n.x - n.y * n.y);
+
+			return max(result, float3{ 0.0f, 0.0f, 0.0f });
+		}
+
+		// PbrVertexShader.hlsl / PbrPixelShader.hlsl
+		namespace Pbr {
+			struct ShaderData {
+				float4 albedoFactor;
+				f32 metallicFactor;
+				f32 roughnessFactor;
+				f32 aoFactor;
+			};
+
+			enum Varying : u32 { WorldPos = 0, NormalWS = 3, UV = 6, Count = 8 };
+			enum TextureSlot : u32 { Albedo, Normal, MetalRoughness, AO, Emission, Radiance = 6, BrdfLUT }; // NOTE: 5 was the irradiance cube map
+
+			auto VertexShader(const u8* vertex, const VertexIds&, const ShaderResources& res, VertexOutput& out) -> void {
+				const auto& object = res.Constants<PerObject>(PerObjectSlot);
+				const float3 position = ReadFloat3(vertex, 0);
+				const float3 normal = ReadFloat3(vertex, 12);
+				const float2 uv = ReadFloat2(vertex, 24);
+
+				const float4 p = { position.x, position.y, position.z, 1.0f };
+				out.position = mul(p, object.modelViewProjectionMatrix);
+				Write(out.varyings + WorldPos, mul(p, object.modelMatrix).xyz());
+				Write(out.varyings + NormalWS, normalize(mul3x3(normal, object.modelMatrix)));
+				Write(out.varyings + UV, uv);
+			}
+
+			auto GetNormalFromMap(const PixelInput& in, const ShaderResources& res, float3 normal, float2 uv, float2 uvDdx, float2 uvDdy) -> float3 {
+				const auto s = res.samplers[0];
+				// NOTE: z is rebuilt from xy, cooked normal maps are BC5 and only store those
+				const float4 normalTexel = Sample(res.textures[Normal], s, uv, uvDdx, uvDdy);
+				const float2 tangentXY = { normalTexel.x * 2.0f - 1.0f, normalTexel.y * 2.0f - 1.0f };
+				const float3 tangentNormal = { tangentXY.x, tangentXY.y, std::sqrt(saturate(1.0f - dot(tangentXY, tangentXY))) };
+
+				const float3 Q1 = { in.ddx[WorldPos], in.ddx[WorldPos + 1], in.ddx[WorldPos + 2] };
+				const float3 Q2 = { in.ddy[WorldPos], in.ddy[WorldPos + 1], in.ddy[WorldPos + 2] };
+				const float2 st1 = uvDdx;
+				const float2 st2 = uvDdy;
+
+				const float3 N = normalize(normal);
+				const float3 T = -normalize(Q1 * st2.y - Q2 * st1.y);
+				const float3 B = normalize(cross(N, T));
+
+				// NOTE: mul(tangentNormal, float3x3(T, B, N))
+				return normalize(T * tangentNormal.x + B * tangentNormal.y + N * tangentNormal.z);
+			}
+
+			// ClusteredLighting.hlsl
+			auto GetClusterRange(const ShaderResources& res, float3 viewPos) -> ClusterRange {
+				const auto& cluster = res.Constants<ClusterShaderData>(ClusterDataSlot);
+				const auto ranges = res.Buffer<ClusterRange>(ClusterRangeSlot);
+
+				const auto tile = [&](f32 ndc, u32 count) { return std::min(static_cast<u32>(saturate(ndc * 0.5f + 0.5f) * count), count - 1); };
+				const u32 x = tile(viewPos.x * cluster.projectionScale[0] / viewPos.z, cluster.gridSize[0]);
+				const u32 y = tile(viewPos.y * cluster.projectionScale[1] / viewPos.z, cluster.gridSize[1]);
+				const u32 slice = std::min(static_cast<u32>(max(std::log(viewPos.z) * cluster.sliceScale + cluster.sliceBias, 0.0f)), cluster.gridSize[2] - 1);
+
+				const u32 index = x + cluster.gridSize[0] * (y + cluster.gridSize[1] * slice);
+				return index < ranges.size() ? ranges[index] : ClusterRange{};
+			}
+
+			auto GetLightAttenuation(const ClusterLight& light, float3 toLight, float3 L) -> f32 {
+				const f32 distanceSq = dot(toLight, toLight);
+				const f32 ratio = distanceSq / (light.range * light.range);
+				const f32 window = saturate(1.0f - ratio * ratio);
+				const float3 direction = { light.direction[0], light.direction[1], light.direction[2] };
+				const f32 cone = saturate(dot(direction, -L) * light.spotScale + light.spotOffset);
+
+				return window * window * cone * cone / max(distanceSq, 0.0001f);
+			}
+
+			// NOTE: the HLSL features as template parameters, see PbrPermutation
+			template <PermutationKey Key>
+			auto PixelShader(const PixelInput& in, const ShaderResources& res) -> float4 {
+				const auto& data = res.Constants<ShaderData>(ShaderDataSlot);
+				const auto& frame = res.Constants<PerFrame>(PerFrameSlot);
+				const auto s = res.samplers[0];
+
+				const float3 worldPos = in.Get3(WorldPos);
+				const float2 uv = in.Get2(UV);
+				const float2 uvDdx = { in.ddx[UV], in.ddx[UV + 1] };
+				const float2 uvDdy = { in.ddy[UV], in.ddy[UV + 1] };
+
+				const float3 albedoTexel = pow(Sample(res.textures[Albedo], s, uv, uvDdx, uvDdy).xyz(), 2.2f);
+				const float4 metalRoughnessTexel = Sample(res.textures[MetalRoughness], s, uv, uvDdx, uvDdy);
+				const f32 metallic = metalRoughnessTexel.x;
+				const f32 roughness = metalRoughnessTexel.y;
+				const f32 ao = (Key & PbrPermutation::AOMap) ? Sample(res.textures[AO], s, uv, uvDdx, uvDdy).x : data.aoFactor;
+				const float3 emissionTexel = (Key & PbrPermutation::EmissiveMap) ? pow(Sample(res.textures[Emission], s, uv, uvDdx, uvDdy).xyz(), 2.2f) : float3{ 0.0f, 0.0f, 0.0f };
+
+				const float3 normal = normalize(in.Get3(NormalWS));
+				const float3 N = (Key & PbrPermutation::NormalMap) ? GetNormalFromMap(in, res, normal, uv, uvDdx, uvDdy) : normal;
+				const float3 V = normalize(frame.eyePos - worldPos);
+				const float3 R = reflect(-V, N);
+
+				const float3 F0 = lerp(float3{ 0.04f, 0.04f, 0.04f }, albedoTexel, metallic);
+
+				// reflectance equation, over the lights culled into this pixel's cluster
+				const float3 viewPos = mul(float4{ worldPos.x, worldPos.y, worldPos.z, 1.0f }, frame.viewMatrix).xyz();
+				const auto cluster = GetClusterRange(res, viewPos);
+				const auto lights = res.Buffer<ClusterLight>(ClusterLightSlot);
+				const auto lightIndices = res.Buffer<u32>(ClusterLightIndexSlot);
+
+				float3 Lo = { 0.0f, 0.0f, 0.0f };
+				for (u32 i = 0; i < cluster.count && cluster.offset + i < lightIndices.size(); ++i) {
+					const u32 lightIndex = lightIndices[cluster.offset + i];
+					if (lightIndex >= lights.size())
+						continue;
+
+					const auto& light = lights[lightIndex];
+					const float3 toLight = float3{ light.position[0], light.position[1], light.position[2] } - worldPos;
+					const float3 L = normalize(toLight);
+					const float3 H = normalize(V + L);
+					const float3 radiance = float3{ light.color[0], light.color[1], light.color[2] } * GetLightAttenuation(light, toLight, L);
+
+					// cook-torrance brdf
+					const f32 NDF = DistributionGGX(N, H, roughness);
+					const f32 G = GeometrySmith(N, V, L, roughness);
+					const float3 F = FresnelSchlick(saturate(dot(H, V)), F0);
+
+					const float3 numerator = F * (NDF * G);
+					const f32 denominator = 4.0f * max(dot(N, V), 0.0f) * max(dot(N, L), 0.0f) + 0.0001f;
+					const float3 specular = numerator / denominator;
+
+					float3 kD = 1.0f - F;
+					kD *= 1.0f - metallic;
+
+					const f32 NdotL = max(dot(N, L), 0.0f);
+					Lo += (kD * albedoTexel / PI + specular) * radiance * NdotL;
+				}
+
+				// ambient lighting (IBL)
+				const f32 NdotV = max(dot(N, V), 0.0f);
+				const float3 F = FresnelSchlickRoughness(NdotV, F0, roughness);
+
+				const Texture* radiance = res.textures[Radiance];
+				const f32 radianceLod = radiance != nullptr ? roughness * static_cast<f32>(radiance->desc.mipLevels - 1) : 0.0f;
+				const float3 prefilteredColor = SampleCube(radiance, s, R, radianceLod).xyz();
+				const float4 brdf = Sample(res.textures[BrdfLUT], s, float2{ NdotV, roughness }, {}, {});
+				const float3 specular = prefilteredColor * (F * brdf.x + brdf.y);
+
+				const float3 kD = 1.0f - FresnelSchlick(NdotV, F0);
+				const float3 irradiance = EvaluateIrradianceSH(res.Constants<IrradianceShaderData>(IrradianceDataSlot), N);
+				const float3 diffuse = irradiance * albedoTexel;
+				const float3 ambient = (kD * diffuse + specular) * ao;
+				float3 color = ambient + Lo + emissionTexel;
+
+				color = ToneMapHDR(color);
+				color = CorrectGamma(color);
+
+				return { color.x, color.y, color.z, 1.0f };
+			}
+
+			template <PermutationKey... Keys>
+			constexpr auto MakePixelVariants(std::integer_sequence<PermutationKey, Keys...>) -> std::array<PixelShaderFn, sizeof...(Keys)> {
+				return { PixelShader<Keys>... };
+			}
+
+			constexpr auto pixelVariants = MakePixelVariants(std::make_integer_sequence<PermutationKey, PbrPermutation::AOMap << 1>{});
+		}
+
+		// BackgroundVertexShader.hlsl / BackgroundPixelShader.hlsl
+		namespace Background {
+			enum Varying : u32 { WorldPos = 0, Count = 3 };
+
+			auto VertexShader(const u8* vertex, const VertexIds&, const ShaderResources& res, VertexOutput& out) -> void {
+				const auto& object = res.Constants<PerObject>(PerObjectSlot);
+				const float3 pos = ReadFloat3(vertex, 0);
+
+				out.position = mul(float4{ pos.x, pos.y, pos.z, 0.0f }, object.viewProjectionMatrix); // NOTE: w = 0 cancels translation
+				out.position.z = out.position.w; // NOTE: depth after the w divide is 1.0
+				Write(out.varyings + WorldPos, pos);
+			}
+
+			auto PixelShader(const PixelInput& in, const ShaderResources& res) -> float4 {
+				const float3 color = ToneMapHDR(SampleCube(res.textures[0], res.samplers[0], in.Get3(WorldPos)).xyz());
+				return { color.x, color.y, color.z, 1.0f };
+			}
+		}
+
+		// SimpleVertexShader.hlsl / SimplePixelShader.hlsl
+		namespace Simple {
+			enum Varying : u32 { WorldPos = 0, Normal = 3, Color = 6, View = 10, Light = 13, Count = 16 };
+
+			auto VertexShader(const u8* vertex, const VertexIds&, const ShaderResources& res, VertexOutput& out) -> void {
+				const auto& object = res.Constants<PerObject>(PerObjectSlot);
+				const auto& frame = res.Constants<PerFrame>(PerFrameSlot);
+				const float3 position = ReadFloat3(vertex, 0);
+				const float3 normal = ReadFloat3(vertex, 12);
+				const float3 color = ReadFloat3(vertex, 24);
+
+				const float4 p = { position.x, position.y, position.z, 1.0f };
+				out.position = mul(p, object.modelViewProjectionMatrix);
+				Write(out.varyings + WorldPos, mul(p, object.modelMatrix).xyz());
+				Write(out.varyings + Normal, normalize(normal)); // NOTE: the .hlsl overwrites the world space normal too
+				Write(out.varyings + Color, float4{ color.x, color.y, color.z, 1.0f });
+				Write(out.varyings + View, frame.eyePos);
+				Write(out.varyings + Light, frame.lightPos);
+			}
+
+			auto PixelShader(const PixelInput& in, const ShaderResources&) -> float4 {
+				const float3 worldPos = in.Get3(WorldPos);
+				const float3 n = normalize(in.Get3(Normal));
+				const float3 v = normalize(in.Get3(View) - worldPos);
+				const float3 l = normalize(in.Get3(Light) - worldPos);
+				const float3 inColor = in.Get3(Color);
+
+				const float3 cool = saturate(float3{ 0.0f, 0.0f, 0.1f } + inColor * 0.1f);
+				const float3 warm = inColor;
+				const float3 highlight = { 1.0f, 1.0f, 1.0f };
+
+				const float3 r = reflect(-l, n);
+				const f32 spec = saturate(100.0f * dot(r, v) - 97.0f);
+				const f32 t = (dot(n, l) + 1.0f) / 2.0f;
+				const float3 color = lerp(highlight, lerp(warm, cool, 1.0f - t), 1.0f - spec);
+
+				return { color.x, color.y, color.z, 1.0f };
+			}
+		}
+
+		// LineVertexShader.hlsl / ColorPixelShader.hlsl
+		namespace Line {
+			constexpr u32 PointSlot = 0;
+
+			struct ShaderData {
+				float4 color;
+				f32 thickness;
+				u32 firstPoint;
+				u32 pointCount;
+			};
+
+			enum Varying : u32 { Color = 0, Count = 4 };
+
+			template <bool MiterJoin>
+			auto VertexShader(const u8*, const VertexIds& ids, const ShaderResources& res, VertexOutput& out) -> void {
+				const auto& app = res.Constants<PerApplication>(PerApplicationSlot);
+				const auto& object = res.Constants<PerObject>(PerObjectSlot);
+				const auto& data = res.Constants<ShaderData>(ShaderDataSlot);
+				const auto points = res.Buffer<float3>(PointSlot);
+
+				// NOTE: one instance per segment, vertices 0/1 sit on its start point and 2/3 on its end point
+				const u32 point = ids.instance + (ids.vertex >> 1);
+				const u32 last = data.pointCount - 1;
+				const auto fetch = [&](u32 i) {
+					const u64 index = static_cast<u64>(data.firstPoint) + i;
+					return index < points.size() ? points[index] : float3{}; // NOTE: out of range structured buffer reads return 0
+				};
+
+				const auto project = [&](float3 p) { return mul(float4{ p.x, p.y, p.z, 1.0f }, object.modelViewProjectionMatrix); };
+				const float4 previousProjected = project(fetch(point > 0 ? point - 1 : 0));
+				const float4 currentProjected  = project(fetch(point));
+				const float4 nextProjected     = project(fetch(std::min(point + 1, last)));
+				const f32 orientation = (ids.vertex & 1) != 0 ? 1.0f : -1.0f;
+
+				const f32 aspectRatio = app.clientData.z;
+				const float2 aspectVec = { aspectRatio, 1.0f };
+				const auto toScreen = [&](float4 p) { return float2{ p.x, p.y } / p.w * aspectVec; };
+				const float2 currentScreen = toScreen(currentProjected);
+				const float2 previousScreen = toScreen(previousProjected);
+				const float2 nextScreen = toScreen(nextProjected);
+
+				f32 len = data.thickness;
+
+				// NOTE: starting point uses (next - current), ending point uses (current - previous)
+				float2 dir;
+				if (currentScreen.x == previousScreen.x && currentScreen.y == previousScreen.y) {
+					dir = normalize(nextScreen - currentScreen);
+				} else if (currentScreen.x == nextScreen.x && currentScreen.y == nextScreen.y) {
+					dir = normalize(currentScreen - previousScreen);
+				} else {
+					const float2 dirA = normalize(currentScreen - previousScreen);
+					if constexpr (MiterJoin) {
+						const float2 dirB = normalize(nextScreen - currentScreen);
+						const float2 tangent = normalize(dirA + dirB);
+						const float2 perp = { -dirA.y, dirA.x };
+						const float2 miter = { -tangent.y, tangent.x };
+						dir = tangent;
+						len = data.thickness / dot(miter, perp);
+					} else {
+						dir = dirA;
+					}
+				}
+
+				float2 normal = normalize(float2{ -dir.y, dir.x }) * (len * 0.5f);
+				normal.x /= aspectRatio;
+
+				out.position = currentProjected + float4{ normal.x * orientation, normal.y * orientation, 0.0f, 0.0f };
+				Write(out.varyings + Color, data.color);
+			}
+
+			auto PixelShader(const PixelInput& in, const ShaderResources&) -> float4 {
+				const float3 color = in.Get3(Color);
+				return { color.x, color.y, color.z, 1.0f };
+			}
+
+			constexpr VertexShaderFn vertexVariants[] = { VertexShader<false>, VertexShader<true> }; // NOTE: LinePermutation::MiterJoin
+		}
+
+		// TexVertexShader.hlsl / TexPixelShader.hlsl
+		namespace Textured {
+			enum Varying : u32 { UV = 0, Count = 2 };
+
+			auto VertexShader(const u8* vertex, const VertexIds&, const ShaderResources& res, VertexOutput& out) -> void {
+				const auto& object = res.Constants<PerObject>(PerObjectSlot);
+				const float3 position = ReadFloat3(vertex, 0);
+
+				out.position = mul(float4{ position.x, position.y, position.z, 1.0f }, object.modelViewProjectionMatrix);
+				Write(out.varyings + UV, ReadFloat2(vertex, 24));
+			}
+
+			auto PixelShader(const PixelInput& in, const ShaderResources& res) -> float4 {
+				const float3 color = Sample(res.textures[0], res.samplers[0], in.Get2(UV), { in.ddx[UV], in.ddx[UV + 1] }, { in.ddy[UV], in.ddy[UV + 1] }).xyz();
+				return { color.x, color.y, color.z, 1.0f };
+			}
+		}
+
+		constexpr u32 Slot(ConstantSlot slot) { return 1u << slot; }
+
+		constexpr ShaderPort shaderPorts[] = {
+			{ "Pbr",        Pbr::VertexShader,        Pbr::PixelShader<PbrPermutation::Default>, Pbr::Count, 32, Slot(PerObjectSlot), Slot(PerFrameSlot) | Slot(ShaderDataSlot) | Slot(ClusterDataSlot) | Slot(IrradianceDataSlot), {}, Pbr::pixelVariants },
+			{ "Background", Background::VertexShader, Background::PixelShader, Background::Count, 12, Slot(PerObjectSlot), 0 },
+			{ "Simple",     Simple::VertexShader,     Simple::PixelShader,     Simple::Count,     36, Slot(PerObjectSlot) | Slot(PerFrameSlot), 0 },
+			{ "Line",       Line::VertexShader<false>, Line::PixelShader,      Line::Count,       0,  Slot(PerApplicationSlot) | Slot(PerObjectSlot) | Slot(ShaderDataSlot), 0, Line::vertexVariants },
+			{ "Texture",    Textured::VertexShader,   Textured::PixelShader,   Textured::Count,   32, Slot(PerObjectSlot), 0 },
+		};
+	}
+
+	auto FindShaderPort(std::string_view name) -> const ShaderPort* {
+		for (const auto& port : shaderPorts)
+			if (port.name == name)
+				return &port;
+
+		return nullptr;
+	}
+
+	auto SelectVariant(const ShaderPort& port, PermutationKey key, VertexShaderFn& vertexShader, PixelShaderFn& pixelShader) -> bool {
+		vertexShader = port.vertexShader;
+		pixelShader = port.pixelShader;
+
+		const auto space = FindPermutationSpace(port.name);
+		if (space == nullptr)
+			return key == 0;
+		if (!IsValidPermutation(*space, key))
+			return false;
+
+		if (!port.vertexVariants.empty()) {
+			const PermutationKey stageKey = GetStageKey(*space, key, ShaderStage::Vertex);
+			vertexShader = stageKey < port.vertexVariants.size() ? port.vertexVariants[stageKey] : nullptr;
+		}
+
+		if (!port.pixelVariants.empty()) {
+			const PermutationKey stageKey = GetStageKey(*space, key, ShaderStage::Pixel);
+			pixelShader = stageKey < port.pixelVariants.size() ? port.pixelVariants[stageKey] : nullptr;
+		}
+
+		return vertexShader != nullptr && pixelShader != nullptr;
+	}
+
+	auto Sample(const Texture* texture, const SamplerDesc& sampler, float2 uv, float2 ddx, float2 ddy) -> float4 {
+		if (texture == nullptr)
+			return { 0.0f, 0.0f, 0.0f, 0.0f }; // NOTE: unbound slots read zero like on D3D
+
+		const auto& desc = texture->desc;
+		if (desc.mipLevels == 1)
+			return SampleLevel(*texture, sampler, 0, 0, uv);
+
+		const f32 width = static_cast<f32>(desc.width);
+		const f32 height = static_cast<f32>(desc.height);
+		const f32 rhoX = length(float2{ ddx.x * width, ddx.y * height });
+		const f32 rhoY = length(float2{ ddy.x * width, ddy.y * height });
+		const f32 lod = std::clamp(std::log2(std::max(std::max(rhoX, rhoY), 1e-8f)), 0.0f, static_cast<f32>(desc.mipLevels - 1));
+
+		if (sampler.filter == TextureFilter::Point)
+			return SampleLevel(*texture, sampler, static_cast<u32>(lod + 0.5f), static_cast<u32>(lod + 0.5f), uv);
+
+		const u32 mip0 = static_cast<u32>(lod);
+		const u32 mip1 = std::min(mip0 + 1, desc.mipLevels - 1);
+		const f32 t = lod - static_cast<f32>(mip0);
+		const auto a = SampleLevel(*texture, sampler, mip0, mip0, uv);
+		if (t == 0.0f || mip0 == mip1)
+			return a;
+
+		return a * (1.0f - t) + SampleLevel(*texture, sampler, mip1, mip1, uv) * t;
+	}
+
+	auto SampleCube(const Texture* texture, const SamplerDesc& sampler, float3 direction, f32 lod) -> float4 {
+		if (texture == nullptr || texture->desc.type != TextureType::TextureCube)
+			return { 0.0f, 0.0f, 0.0f, 0.0f };
+
+		// NOTE: D3D face selection, faces ordered +X -X +Y -Y +Z -Z
+		const f32 ax = std::abs(direction.x);
+		const f32 ay = std::abs(direction.y);
+		const f32 az = std::abs(direction.z);
+
+		u32 face;
+		f32 sc, tc, ma;
+		if (ax >= ay && ax >= az) {
+			face = direction.x >= 0.0f ? 0 : 1;
+			sc = direction.x >= 0.0f ? -direction.z : direction.z;
+			tc = -direction.y;
+			ma = ax;
+		} else if (ay >= az) {
+			face = direction.y >= 0.0f ? 2 : 3;
+			sc = direction.x;
+			tc = direction.y >= 0.0f ? direction.z : -direction.z;
+			ma = ay;
+		} else {
+			face = direction.z >= 0.0f ? 4 : 5;
+			sc = direction.z >= 0.0f ? direction.x : -direction.x;
+			tc = -direction.y;
+			ma = az;
+		}
+
+		if (!(ma > 0.0f))
+			return { 0.0f, 0.0f, 0.0f, 0.0f };
+
+		// NOTE: faces are sampled on their own with clamped edges, good enough for the low frequency IBL maps
+		const float2 uv = { (sc / ma + 1.0f) * 0.5f, (tc / ma + 1.0f) * 0.5f };
+		auto faceSampler = sampler;
+		faceSampler.addressMode = TextureAddressMode::Clamp;
+
+		const u32 mipLevels = texture->desc.mipLevels;
+		lod = std::clamp(lod, 0.0f, static_cast<f32>(mipLevels - 1));
+		if (sampler.filter == TextureFilter::Point) {
+			const u32 mip = static_cast<u32>(lod + 0.5f);
+			return SampleLevel(*texture, faceSampler, face * mipLevels + mip, mip, uv);
+		}
+
+		const u32 mip0 = static_cast<u32>(lod);
+		const u32 mip1 = std::min(mip0 + 1, mipLevels - 1);
+		const f32 t = lod - static_cast<f32>(mip0);
+		const auto a = SampleLevel(*texture, faceSampler, face * mipLevels + mip0, mip0, uv);
+		if (t == 0.0f || mip0 == mip1)
+			return a;
+
+		return a * (1.0f - t) + SampleLevel(*texture, faceSampler, face * mipLevels + mip1, mip1, uv) * t;
+	}
+}
\ No newline at end of file
@@ -0,0 +1,78 @@
+#pragma once
+
+#include "../RendererTypes.h"
+#include "../ShaderPermutations.h"
+#include "SoftwareMath.h"
+#include <string_view>
+#include <vector>
+
+namespace Nickel::Renderer::Software {
+	constexpr u32 MaxVaryings = 16;
+	constexpr u32 MaxShaderSlots = 16;
+
+	// NOTE: texel data is repacked tightly, subresources ordered [arraySlice][mip] like SubresourceData
+	struct Texture {
+		TextureDesc desc;
+		std::vector<u8> data;
+		std::vector<u64> subresourceOffsets;
+	};
+
+	// NOTE: everything a shader invocation can read, resolved once per draw
+	struct ShaderResources {
+		const u8* constantBuffers[MaxShaderSlots];
+		const Texture* textures[MaxShaderSlots];
+		SamplerDesc samplers[MaxShaderSlots];
+		std::span<const u8> buffers[MaxShaderSlots]; // NOTE: structured buffers, read in place, share the slots with textures
+
+		template <typename T>
+		inline auto Constants(u32 slot) const -> const T& { return *reinterpret_cast<const T*>(constantBuffers[slot]); }
+
+		template <typename T>
+		inline auto Buffer(u32 slot) const -> std::span<const T> { return { reinterpret_cast<const T*>(buffers[slot].data()), buffers[slot].size() / sizeof(T) }; }
+	};
+
+	struct VertexOutput {
+		float4 position; // NOTE: SV_POSITION, clip space
+		f32 varyings[MaxVaryings];
+	};
+
+	// NOTE: ddx/ddy are per 2x2 quad differences, same as the coarse derivatives a GPU hands to the pixel shader
+	struct PixelInput {
+		const f32* varyings;
+		const f32* ddx;
+		const f32* ddy;
+
+		inline auto Get2(u32 at) const -> float2 { return { varyings[at], varyings[at + 1] }; }
+		inline auto Get3(u32 at) const -> float3 { return { varyings[at], varyings[at + 1], varyings[at + 2] }; }
+		inline auto Get4(u32 at) const -> float4 { return { varyings[at], varyings[at + 1], varyings[at + 2], varyings[at + 3] }; }
+	};
+
+	// NOTE: SV_VertexID and SV_InstanceID, ports without an input layout fetch everything through these
+	struct VertexIds {
+		u32 vertex;
+		u32 instance;
+	};
+
+	using VertexShaderFn = auto (*)(const u8* vertex, const VertexIds& ids, const ShaderResources& resources, VertexOutput& out) -> void;
+	using PixelShaderFn  = auto (*)(const PixelInput& in, const ShaderResources& resources) -> float4;
+
+	// C++ port of one vertex/pixel shader pair from Data/Shaders, looked up by ProgramDesc::name
+	struct ShaderPort {
+		std::string_view name;
+		VertexShaderFn vertexShader;
+		PixelShaderFn pixelShader;
+		u32 varyingCount;
+		u32 vertexSize; // NOTE: bytes the vertex shader reads per vertex, the input layout of the HLSL version. 0 draws without a vertex buffer
+		u32 vertexConstantMask; // NOTE: bit per constant buffer slot the stage reads, draws missing one are skipped
+		u32 pixelConstantMask;
+		std::span<const VertexShaderFn> vertexVariants = {}; // NOTE: indexed by the stage's permutation key, empty when the stage has no features
+		std::span<const PixelShaderFn> pixelVariants = {};
+	};
+
+	auto FindShaderPort(std::string_view name) -> const ShaderPort*;
+	// NOTE: the port's shaders compiled for one permutation, false when the port has no such variant
+	auto SelectVariant(const ShaderPort& port, PermutationKey key, VertexShaderFn& vertexShader, PixelShaderFn& pixelShader) -> bool;
+
+	auto Sample(const Texture* texture, const SamplerDesc& sampler, float2 uv, float2 ddx, float2 ddy) -> float4;
+	auto SampleCube(const Texture* texture, const SamplerDesc& sampler, float3 direction, f32 lod = 0.0f) -> float4; // NOTE: lod picks the mip like SampleLevel
+}
\ No newline at end of file
@@ -0,0 +1,250 @@
+#include "SphericalHarmonics.h"
+#include "../Threading.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+
+#if defined(_M_X64) || defined(__x86_64__)
+#define NICKEL_SH_SSE 1
+#include <immintrin.h> // NOTE: SSE2 is part of x64, no runtime dispatch needed
+#endif
+
+namespace Nickel::Renderer {
+	namespace {
+		constexpr f32 Pi = 3.14159265359f;
+
+		// NOTE: normalization constants of the real SH basis functions, in coefficient order
+		constexpr f32 BasisConstants[SHCoefficientCount] = {
+			0.282095f,
+			0.488603f, 0.488603f, 0.488603f,
+			1.092548f, 1.092548f, 0.315392f, 1.092548f, 0.546274f
+		};
+
+		// NOTE: row sums of one chunk, doubles so a 4K face doesn't lose the small texels to rounding
+		struct Accumulator {
+			f64 sums[SHCoefficientCount][3]{};
+			f64 weight = 0.0;
+		};
+
+		auto Basis(f32 x, f32 y, f32 z, f32 (&out)[SHCoefficientCount]) -> void {
+			out[0] = BasisConstants[0];
+			out[1] = BasisConstants[1] * y;
+			out[2] = BasisConstants[2] * z;
+			out[3] = BasisConstants[3] * x;
+			out[4] = BasisConstants[4] * x * y;
+			out[5] = BasisConstants[5] * y * z;
+			out[6] = BasisConstants[6] * (3.0f * z * z - 1.0f);
+			out[7] = BasisConstants[7] * x * z;
+			out[8] = BasisConstants[8] * (x * x - y * y);
+		}
+
+		// NOTE: face u/v to unnormalized direction per face, the components are permutations of (1, u, v) with signs
+		struct FaceAxes {
+			f32 constant[3]; // NOTE: the major axis
+			f32 u[3];
+			f32 v[3];
+		};
+
+		auto GetFaceAxes(u32 face) -> FaceAxes {
+			const Vec3 origin = CubeFaceDirection(face, 0.0f, 0.0f);
+			const Vec3 du = CubeFaceDirection(face, 1.0f, 0.0f) - origin;
+			const Vec3 dv = CubeFaceDirection(face, 0.0f, 1.0f) - origin;
+			return FaceAxes{ { origin.x, origin.y, origin.z }, { du.x, du.y, du.z }, { dv.x, dv.y, dv.z } };
+		}
+
+		// NOTE: the differential solid angle of a texel at (u, v) is texelArea / (1 + u^2 + v^2)^(3/2), the sum is
+		// renormalized to 4pi afterwards so the approximation only shifts weight between texels, not in total
+		auto ProjectTexels(const CubemapImage& image, const FaceAxes& axes, u32 face, u32 y, u32 begin, u32 end, Accumulator& out) -> void {
+			const f32 texel = 2.0f / static_cast<f32>(image.size);
+			const f32 v = (static_cast<f32>(y) + 0.5f) * texel - 1.0f;
+			for (u32 x = begin; x < end; x++) {
+				const f32 u = (static_cast<f32>(x) + 0.5f) * texel - 1.0f;
+				const f32 lengthSq = 1.0f + u * u + v * v;
+				const f32 invLength = 1.0f / std::sqrt(lengthSq);
+				const f32 weight = invLength / lengthSq;
+
+				f32 direction[3];
+				for (u32 axis = 0; axis < 3; axis++)
+					direction[axis] = (axes.constant[axis] + axes.u[axis] * u + axes.v[axis] * v) * invLength;
+
+				f32 basis[SHCoefficientCount];
+				Basis(direction[0], direction[1], direction[2], basis);
+
+				const f32* color = image.Texel(face, x, y);
+				for (u32 i = 0; i < SHCoefficientCount; i++)
+					for (u32 c = 0; c < 3; c++)
+						out.sums[i][c] += static_cast<f64>(basis[i] * weight * color[c]);
+				out.weight += weight;
+			}
+		}
+
+#if defined(NICKEL_SH_SSE)
+		auto HorizontalSum(__m128 v) -> f32 {
+			const __m128 shuffled = _mm_shuffle_ps(v, v, _MM_SHUFFLE(2, 3, 0, 1));
+			const __m128 sums = _mm_add_ps(v, shuffled);
+			return _mm_cvtss_f32(_mm_add_ss(sums, _mm_movehl_ps(shuffled, sums)));
+		}
+
+		// NOTE: 4 texels per iteration, RGBA loads transposed into R, G, B vectors. Returns the first texel it didn't do
+		auto ProjectRowSSE(const CubemapImage& image, const FaceAxes& axes, u32 face, u32 y, Accumulator& out) -> u32 {
+			const u32 count = image.size & ~3u;
+			if (count == 0)
+				return 0;
+
+			const f32 texel = 2.0f / static_cast<f32>(image.size);
+			const f32 v = (static_cast<f32>(y) + 0.5f) * texel - 1.0f;
+			const __m128 one = _mm_set1_ps(1.0f);
+			const __m128 vv = _mm_set1_ps(v * v);
+			const __m128 texelStep = _mm_set1_ps(4.0f * texel);
+			__m128 u = _mm_setr_ps(0.5f * texel - 1.0f, 1.5f * texel - 1.0f, 2.5f * texel - 1.0f, 3.5f * texel - 1.0f);
+
+			__m128 base[3];
+			__m128 axisU[3];
+			for (u32 axis = 0; axis < 3; axis++) {
+				base[axis] = _mm_set1_ps(axes.constant[axis] + axes.v[axis] * v);
+				axisU[axis] = _mm_set1_ps(axes.u[axis]);
+			}
+
+			__m128 sums[SHCoefficientCount][3];
+			for (auto& coefficient : sums)
+				for (auto& channel : coefficient)
+					channel = _mm_setzero_ps();
+			__m128 weightSum = _mm_setzero_ps();
+
+			for (u32 x = 0; x < count; x += 4) {
+				const __m128 lengthSq = _mm_add_ps(_mm_add_ps(one, vv), _mm_mul_ps(u, u));
+				const __m128 invLength = _mm_div_ps(one, _mm_sqrt_ps(lengthSq));
+				const __m128 weight = _mm_div_ps(invLength, lengthSq);
+
+				const __m128 dx = _mm_mul_ps(_mm_add_ps(base[0], _mm_mul_ps(axisU[0], u)), invLength);
+				const __m128 dy = _mm_mul_ps(_mm_add_ps(base[1], _mm_mul_ps(axisU[1], u)), invLength);
+				const __m128 dz = _mm_mul_ps(_mm_add_ps(base[2], _mm_mul_ps(axisU[2], u)), invLength);
+
+				const __m128 basis[SHCoefficientCount] = {
+					_mm_set1_ps(BasisConstants[0]),
+					_mm_mul_ps(_mm_set1_ps(BasisConstants[1]), dy),
+					_mm_mul_ps(_mm_set1_ps(BasisConstants[2]), dz),
+					_mm_mul_ps(_mm_set1_ps(BasisConstants[3]), dx),
+					_mm_mul_ps(_mm_set1_ps(BasisConstants[4]), _mm_mul_ps(dx, dy)),
+					_mm_mul_ps(_mm_set1_ps(BasisConstants[5]), _mm_mul_ps(dy, dz)),
+					_mm_mul_ps(_mm_set1_ps(BasisConstants[6]), _mm_sub_ps(_mm_mul_ps(_mm_set1_ps(3.0f), _mm_mul_ps(dz, dz)), one)),
+					_mm_mul_ps(_mm_set1_ps(BasisConstants[7]), _mm_mul_ps(dx, dz)),
+					_mm_mul_ps(_mm_set1_ps(BasisConstants[8]), _mm_sub_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy)))
+				};
+
+				const f32* texels = image.Texel(face, x, y);
+				__m128 r = _mm_loadu_ps(texels);
+				__m128 g = _mm_loadu_ps(texels + 4);
+				__m128 b = _mm_loadu_ps(texels + 8);
+				__m128 a = _mm_loadu_ps(texels + 12);
+				_MM_TRANSPOSE4_PS(r, g, b, a);
+
+				const __m128 weighted[3] = { _mm_mul_ps(r, weight), _mm_mul_ps(g, weight), _mm_mul_ps(b, weight) };
+				for (u32 i = 0; i < SHCoefficientCount; i++)
+					for (u32 c = 0; c < 3; c++)
+						sums[i][c] = _mm_add_ps(sums[i][c], _mm_mul_ps(basis[i], weighted[c]));
+				weightSum = _mm_add_ps(weightSum, weight);
+
+				u = _mm_add_ps(u, texelStep);
+			}
+
+			for (u32 i = 0; i < SHCoefficientCount; i++)
+				for (u32 c = 0; c < 3; c++)
+					out.sums[i][c] += HorizontalSum(sums[i][c]);
+			out.weight += HorizontalSum(weightSum);
+
+			return count;
+		}
+#endif
+
+		auto ToMilliseconds(std::chrono::steady_clock::duration duration) -> f64 {
+			return std::chrono::duration<f64, std::milli>(duration).count();
+		}
+	}
+
+	auto ProjectCubemapSH(const CubemapImage& image, SHProjectionStats* stats) -> SHCoefficients {
+		if (!image.IsValid()) {
+			Logger::Error("[SphericalHarmonics]: can't project an empty or malformed cube map");
+			return {};
+		}
+
+		const auto start = std::chrono::steady_clock::now();
+
+		// NOTE: chunks over the rows of all faces, every chunk sums into its own accumulator
+		const u32 rowCount = image.size * CubeFaceCount;
+		const u32 chunkCount = std::min(GetWorkerCount(), rowCount);
+		std::vector<Accumulator> chunks(chunkCount);
+		ParallelForChunks(rowCount, chunkCount, [&](u32 chunkIdx, u32 begin, u32 end) {
+			auto& accumulator = chunks[chunkIdx];
+			for (u32 row = begin; row < end; row++) {
+				const u32 face = row / image.size;
+				const u32 y = row % image.size;
+				const auto axes = GetFaceAxes(face);
+
+				u32 x = 0;
+#if defined(NICKEL_SH_SSE)
+				x = ProjectRowSSE(image, axes, face, y, accumulator);
+#endif
+				ProjectTexels(image, axes, face, y, x, image.size, accumulator);
+			}
+		});
+
+		Accumulator total;
+		for (const auto& chunk : chunks) {
+			for (u32 i = 0; i < SHCoefficientCount; i++)
+				for (u32 c = 0; c < 3; c++)
+					total.sums[i][c] += chunk.sums[i][c];
+			total.weight += chunk.weight;
+		}
+
+		SHCoefficients result{};
+		const f64 normalization = 4.0 * Pi / total.weight;
+		for (u32 i = 0; i < SHCoefficientCount; i++) {
+			result.coefficients[i] = Vec3{
+				static_cast<f32>(total.sums[i][0] * normalization),
+				static_cast<f32>(total.sums[i][1] * normalization),
+				static_cast<f32>(total.sums[i][2] * normalization)
+			};
+		}
+
+		if (stats != nullptr)
+			*stats = SHProjectionStats{ .texelCount = rowCount * image.size, .milliseconds = ToMilliseconds(std::chrono::steady_clock::now() - start) };
+
+		return result;
+	}
+
+	auto ConvolveIrradianceSH(const SHCoefficients& radiance) -> SHCoefficients {
+		// NOTE: the clamped cosine's zonal harmonics per band (pi, 2pi/3, pi/4, Ramamoorthi and Hanrahan), over pi
+		constexpr f32 bandScale[3] = { 1.0f, 2.0f / 3.0f, 1.0f / 4.0f };
+		constexpr u32 band[SHCoefficientCount] = { 0, 1, 1, 1, 2, 2, 2, 2, 2 };
+
+		SHCoefficients result;
+		for (u32 i = 0; i < SHCoefficientCount; i++)
+			result.coefficients[i] = radiance.coefficients[i] * bandScale[band[i]];
+
+		return result;
+	}
+
+	auto EvaluateSH(const SHCoefficients& sh, const Vec3& direction) -> Vec3 {
+		f32 basis[SHCoefficientCount];
+		Basis(direction.x, direction.y, direction.z, basis);
+
+		Vec3 result{ 0.0f, 0.0f, 0.0f };
+		for (u32 i = 0; i < SHCoefficientCount; i++)
+			result += sh.coefficients[i] * basis[i];
+
+		return result;
+	}
+
+	auto MakeIrradianceShaderData(const SHCoefficients& irradiance) -> IrradianceShaderData {
+		IrradianceShaderData data{};
+		for (u32 i = 0; i < SHCoefficientCount; i++) {
+			const Vec3 c = irradiance.coefficients[i] * BasisConstants[i];
+			data.coefficients[i][0] = c.x;
+			data.coefficients[i][1] = c.y;
+			data.coefficients[i][2] = c.z;
+		}
+
+		return data;
+	}
+}
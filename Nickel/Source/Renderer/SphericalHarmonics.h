@@ -0,0 +1,38 @@
+#pragma once
+
+#include "CubemapImage.h"
+#include "../Math.h"
+
+// Diffuse environment lighting as order 2 spherical harmonics. A cube map is projected onto the 9 real SH basis
+// functions on the CPU (SSE over texels, threads over rows), convolved with the clamped cosine lobe and handed to
+// the PBR shader as 9 RGB coefficients, see SphericalHarmonics.hlsl. That replaces the irradiance cube map and the
+// brute force convolution pass that produced it, a new environment is relit in milliseconds.
+namespace Nickel::Renderer {
+	constexpr u32 SHCoefficientCount = 9;
+	constexpr u32 IrradianceConstantSlot = 5; // NOTE: after the clustered lighting cbuffer
+
+	// NOTE: RGB coefficients in the usual order, l = 0, then l = 1 (y, z, x), then l = 2 (xy, yz, 3z^2 - 1, xz, x^2 - y^2)
+	struct SHCoefficients {
+		Vec3 coefficients[SHCoefficientCount];
+	};
+
+	// NOTE: the coefficients with the basis constants folded in, the shader only multiplies by the polynomials
+	struct alignas(16) IrradianceShaderData {
+		f32 coefficients[SHCoefficientCount][4];
+	};
+	static_assert(sizeof(IrradianceShaderData) == 144, "has to match the IrradianceSH cbuffer");
+
+	struct SHProjectionStats {
+		u32 texelCount;
+		f64 milliseconds;
+	};
+
+	// NOTE: radiance projection, every texel weighted by the solid angle it covers
+	auto ProjectCubemapSH(const CubemapImage& image, SHProjectionStats* stats = nullptr) -> SHCoefficients;
+	// NOTE: irradiance divided by pi, what a Lambertian surface multiplies with its albedo. Matches the old
+	// ConvoluteBackground output and the cmft irradiance maps
+	auto ConvolveIrradianceSH(const SHCoefficients& radiance) -> SHCoefficients;
+	auto EvaluateSH(const SHCoefficients& sh, const Vec3& direction) -> Vec3; // NOTE: direction normalized
+
+	auto MakeIrradianceShaderData(const SHCoefficients& irradiance) -> IrradianceShaderData;
+}
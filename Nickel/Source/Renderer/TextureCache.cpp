@@ -0,0 +1,146 @@
+#include "TextureCache.h"
+#include "../MappedFile.h"
+#include <cstring>
+#include <fstream>
+#include <vector>
+
+namespace Nickel::Renderer {
+	namespace {
+		auto GetTotalSize(const TextureDesc& desc) -> u64 {
+			u64 size = 0;
+			for (u32 mip = 0; mip < desc.mipLevels; mip++)
+				size += GetSubresourceSize(desc, mip);
+
+			return size * desc.arraySize;
+		}
+
+		// NOTE: the first texel byte when the file is there, intact and made for 'key', null otherwise
+		auto OpenCachedTexture(MappedFile& file, const std::filesystem::path& path, u64 key, TextureDesc& desc) -> const u8* {
+			using namespace TextureCacheFormat;
+
+			std::error_code error;
+			if (!std::filesystem::exists(path, error))
+				return nullptr; // NOTE: a plain miss, MappedFile would log it as an error
+
+			if (!file.Open(path.string().c_str()))
+				return nullptr;
+
+			const auto bytes = file.Data();
+			if (bytes.size() < sizeof(Header))
+				return nullptr;
+
+			Header header;
+			std::memcpy(&header, bytes.data(), sizeof(Header));
+			if (header.magic != Magic || header.version != Version || header.key != key)
+				return nullptr;
+
+			desc = TextureDesc{
+				.type = static_cast<TextureType>(header.type),
+				.format = static_cast<TextureFormat>(header.format),
+				.width = header.width,
+				.height = header.height,
+				.mipLevels = header.mipLevels,
+				.arraySize = header.arraySize
+			};
+
+			if (desc.width == 0 || desc.height == 0 || desc.mipLevels == 0 || desc.arraySize == 0 ||
+				header.dataSize != GetTotalSize(desc) || bytes.size() - sizeof(Header) < header.dataSize) {
+				Logger::Warn("[TextureCache]: " + path.string() + " is damaged, rebuilding it");
+				return nullptr;
+			}
+
+			return bytes.data() + sizeof(Header);
+		}
+	}
+
+	auto HashBytes(std::span<const u8> bytes, u64 hash) -> u64 {
+		for (const u8 byte : bytes) {
+			hash ^= byte;
+			hash *= 0x100000001b3ull;
+		}
+
+		return hash;
+	}
+
+	auto GetSubresourceSize(const TextureDesc& desc, u32 mip) -> u64 {
+		const u64 rowPitch = GetRowPitch(desc.format, std::max(desc.width >> mip, 1u));
+		return rowPitch * GetRowCount(desc.format, std::max(desc.height >> mip, 1u));
+	}
+
+	auto LoadCachedTexture(const PlatformInterface& gfx, const std::filesystem::path& path, u64 key) -> TextureHandle {
+		MappedFile file;
+		TextureDesc desc;
+		const u8* cursor = OpenCachedTexture(file, path, key, desc);
+		if (cursor == nullptr)
+			return {};
+
+		std::vector<SubresourceData> data;
+		data.reserve(static_cast<size_t>(desc.mipLevels) * desc.arraySize);
+		for (u32 slice = 0; slice < desc.arraySize; slice++) {
+			for (u32 mip = 0; mip < desc.mipLevels; mip++) {
+				data.push_back(SubresourceData{ .data = cursor, .rowPitch = GetRowPitch(desc.format, std::max(desc.width >> mip, 1u)) });
+				cursor += GetSubresourceSize(desc, mip);
+			}
+		}
+
+		// NOTE: the backend copies the texels, the mapping can go right after
+		return gfx.CreateTexture(desc, data);
+	}
+
+	auto ReadCachedTexture(const std::filesystem::path& path, u64 key, TextureDesc& desc, std::vector<u8>& texels) -> bool {
+		MappedFile file;
+		const u8* cursor = OpenCachedTexture(file, path, key, desc);
+		if (cursor == nullptr)
+			return false;
+
+		texels.assign(cursor, cursor + GetTotalSize(desc));
+		return true;
+	}
+
+	auto StoreCachedTexture(const std::filesystem::path& path, u64 key, const TextureDesc& desc, std::span<const SubresourceData> data) -> bool {
+		using namespace TextureCacheFormat;
+		Assert(data.size() == static_cast<size_t>(desc.mipLevels) * desc.arraySize);
+
+		std::error_code error;
+		std::filesystem::create_directories(path.parent_path(), error);
+
+		const auto header = Header{
+			.magic = Magic,
+			.version = Version,
+			.key = key,
+			.type = static_cast<u32>(desc.type),
+			.format = static_cast<u32>(desc.format),
+			.width = desc.width,
+			.height = desc.height,
+			.mipLevels = desc.mipLevels,
+			.arraySize = desc.arraySize,
+			.dataSize = GetTotalSize(desc)
+		};
+
+		// NOTE: written next to the target and renamed over it, like the shader archive
+		auto temporaryPath = path;
+		temporaryPath += ".tmp";
+		{
+			std::ofstream file(temporaryPath, std::ios::binary | std::ios::trunc);
+			file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+			for (u32 i = 0; i < data.size(); i++) {
+				const u32 mip = i % desc.mipLevels;
+				Assert(data[i].rowPitch == GetRowPitch(desc.format, std::max(desc.width >> mip, 1u)));
+				file.write(static_cast<const char*>(data[i].data), static_cast<std::streamsize>(GetSubresourceSize(desc, mip)));
+			}
+
+			if (!file) {
+				Logger::Error("[TextureCache]: failed to write " + temporaryPath.string());
+				return false;
+			}
+		}
+
+		std::filesystem::rename(temporaryPath, path, error);
+		if (error) {
+			Logger::Error("[TextureCache]: failed to replace " + path.string() + ": " + error.message());
+			return false;
+		}
+
+		return true;
+	}
+}
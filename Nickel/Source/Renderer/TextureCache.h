@@ -0,0 +1,46 @@
+#pragma once
+
+#include "RendererPlatformInterface.h"
+#include <filesystem>
+#include <span>
+#include <vector>
+
+// Textures the engine computes at load time (prefiltered environments, lookup tables) kept on disk so the work runs
+// once. A cache file holds one texture with all its subresources, tagged with a key the producer derives from its
+// inputs. A key mismatch, a version bump or a damaged file is a miss and the producer rebuilds and stores again.
+namespace Nickel::Renderer::TextureCacheFormat {
+	constexpr u32 Magic = 'N' | ('T' << 8) | ('E' << 16) | ('X' << 24);
+	constexpr u32 Version = 1;
+
+	// NOTE: little endian, the subresources follow the header tightly packed in [arraySlice][mip] order
+	struct Header {
+		u32 magic;
+		u32 version;
+		u64 key;
+		u32 type;   // NOTE: TextureType
+		u32 format; // NOTE: TextureFormat
+		u32 width;
+		u32 height;
+		u32 mipLevels;
+		u32 arraySize;
+		u64 dataSize;
+	};
+	static_assert(sizeof(Header) == 48, "the header is written as-is");
+}
+
+namespace Nickel::Renderer {
+	constexpr const char* TextureCacheDir = "Data/Cache";
+	constexpr u64 HashSeed = 0xcbf29ce484222325ull; // NOTE: FNV-1a 64 offset basis
+
+	auto HashBytes(std::span<const u8> bytes, u64 hash = HashSeed) -> u64;
+
+	// NOTE: byte size of one mip of one array slice, rows (of blocks) tightly packed
+	auto GetSubresourceSize(const TextureDesc& desc, u32 mip) -> u64;
+
+	// NOTE: an invalid handle on a miss, the texture is created straight from the mapped file
+	auto LoadCachedTexture(const PlatformInterface& gfx, const std::filesystem::path& path, u64 key) -> TextureHandle;
+	// NOTE: the same for CPU side use, 'texels' gets every subresource tightly packed in [arraySlice][mip] order
+	auto ReadCachedTexture(const std::filesystem::path& path, u64 key, TextureDesc& desc, std::vector<u8>& texels) -> bool;
+	// NOTE: 'data' holds every subresource with tightly packed rows, written next to the target and renamed over it
+	auto StoreCachedTexture(const std::filesystem::path& path, u64 key, const TextureDesc& desc, std::span<const SubresourceData> data) -> bool;
+}
@@ -0,0 +1,560 @@
+#include "TextureCompression.h"
+#include "../Threading.h"
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstring>
+
+namespace Nickel::Renderer {
+	namespace {
+		constexpr u32 BlockTexels = 16;
+		constexpr u32 RefineIterations = 2;
+
+		// NOTE: BC7 4 bit index weights out of 64
+		constexpr u32 BC7Weights[16] = { 0, 4, 9, 13, 17, 21, 26, 30, 34, 38, 43, 47, 51, 55, 60, 64 };
+
+		// NOTE: the index whose weight is closest to every weight 0..64
+		constexpr auto BC7NearestIndex = []() {
+			std::array<u8, 65> nearest{};
+			for (u32 weight = 0; weight <= 64; weight++) {
+				u32 best = 0;
+				for (u32 i = 1; i < 16; i++) {
+					const u32 distance = weight > BC7Weights[i] ? weight - BC7Weights[i] : BC7Weights[i] - weight;
+					const u32 bestDistance = weight > BC7Weights[best] ? weight - BC7Weights[best] : BC7Weights[best] - weight;
+					if (distance < bestDistance)
+						best = i;
+				}
+				nearest[weight] = static_cast<u8>(best);
+			}
+			return nearest;
+		}();
+
+		struct Block {
+			f32 texels[BlockTexels][4];
+		};
+
+		auto LoadBlock(const u8* rgba, u32 width, u32 height, u32 blockX, u32 blockY, Block& block) -> void {
+			for (u32 y = 0; y < 4; y++) {
+				const u32 sourceY = std::min(blockY * 4 + y, height - 1);
+				for (u32 x = 0; x < 4; x++) {
+					const u32 sourceX = std::min(blockX * 4 + x, width - 1);
+					const u8* texel = rgba + (static_cast<u64>(sourceY) * width + sourceX) * 4;
+					for (u32 c = 0; c < 4; c++)
+						block.texels[y * 4 + x][c] = texel[c];
+				}
+			}
+		}
+
+		auto StoreBlock(const u8 (&texels)[BlockTexels][4], u32 width, u32 height, u32 blockX, u32 blockY, u8* rgba) -> void {
+			for (u32 y = 0; y < 4 && blockY * 4 + y < height; y++) {
+				for (u32 x = 0; x < 4 && blockX * 4 + x < width; x++) {
+					u8* texel = rgba + (static_cast<u64>(blockY * 4 + y) * width + blockX * 4 + x) * 4;
+					std::memcpy(texel, texels[y * 4 + x], 4);
+				}
+			}
+		}
+
+		// NOTE: the block's extent along its principal axis, found with a few power iterations on the covariance.
+		// Only the first 'Channels' channels take part
+		template <u32 Channels>
+		auto FitPrincipalAxis(const Block& block, f32 (&lo)[4], f32 (&hi)[4]) -> void {
+			f32 mean[4]{};
+			for (const auto& texel : block.texels) {
+				for (u32 c = 0; c < Channels; c++)
+					mean[c] += texel[c] / BlockTexels;
+			}
+
+			f32 covariance[4][4]{};
+			f32 minimum[4] = { 255.0f, 255.0f, 255.0f, 255.0f };
+			f32 maximum[4]{};
+			for (const auto& texel : block.texels) {
+				for (u32 i = 0; i < Channels; i++) {
+					minimum[i] = std::min(minimum[i], texel[i]);
+					maximum[i] = std::max(maximum[i], texel[i]);
+					for (u32 j = 0; j < Channels; j++)
+						covariance[i][j] += (texel[i] - mean[i]) * (texel[j] - mean[j]);
+				}
+			}
+
+			// NOTE: the bounding box diagonal is a good first guess and already exact for two-color blocks
+			f32 axis[4]{};
+			for (u32 c = 0; c < Channels; c++)
+				axis[c] = maximum[c] - minimum[c];
+
+			for (u32 iteration = 0; iteration < 8; iteration++) {
+				f32 next[4]{};
+				f32 length = 0.0f;
+				for (u32 i = 0; i < Channels; i++) {
+					for (u32 j = 0; j < Channels; j++)
+						next[i] += covariance[i][j] * axis[j];
+					length = std::max(length, std::abs(next[i]));
+				}
+
+				if (length < 1e-6f)
+					break;
+				for (u32 c = 0; c < Channels; c++)
+					axis[c] = next[c] / length;
+			}
+
+			f32 lengthSquared = 0.0f;
+			for (u32 c = 0; c < Channels; c++)
+				lengthSquared += axis[c] * axis[c];
+
+			f32 minT = 0.0f;
+			f32 maxT = 0.0f;
+			if (lengthSquared > 1e-12f) {
+				minT = 1e30f;
+				maxT = -1e30f;
+				for (const auto& texel : block.texels) {
+					f32 t = 0.0f;
+					for (u32 c = 0; c < Channels; c++)
+						t += (texel[c] - mean[c]) * axis[c];
+					minT = std::min(minT, t);
+					maxT = std::max(maxT, t);
+				}
+				minT /= lengthSquared;
+				maxT /= lengthSquared;
+			}
+
+			for (u32 c = 0; c < 4; c++) {
+				lo[c] = c < Channels ? std::clamp(mean[c] + axis[c] * minT, 0.0f, 255.0f) : 255.0f;
+				hi[c] = c < Channels ? std::clamp(mean[c] + axis[c] * maxT, 0.0f, 255.0f) : 255.0f;
+			}
+		}
+
+		// NOTE: least squares endpoints for fixed indices, texel i is lo + weights[i] * (hi - lo). False when every
+		// texel uses the same weight, the endpoints are left alone then
+		template <u32 Channels>
+		auto RefineEndpoints(const Block& block, const f32 (&weights)[BlockTexels], f32 (&lo)[4], f32 (&hi)[4]) -> bool {
+			f32 aa = 0.0f, bb = 0.0f, ab = 0.0f;
+			f32 ax[4]{}, bx[4]{};
+			for (u32 i = 0; i < BlockTexels; i++) {
+				const f32 b = weights[i];
+				const f32 a = 1.0f - b;
+				aa += a * a;
+				bb += b * b;
+				ab += a * b;
+				for (u32 c = 0; c < Channels; c++) {
+					ax[c] += a * block.texels[i][c];
+					bx[c] += b * block.texels[i][c];
+				}
+			}
+
+			const f32 determinant = aa * bb - ab * ab;
+			if (std::abs(determinant) < 1e-6f)
+				return false;
+
+			for (u32 c = 0; c < Channels; c++) {
+				lo[c] = std::clamp((ax[c] * bb - bx[c] * ab) / determinant, 0.0f, 255.0f);
+				hi[c] = std::clamp((bx[c] * aa - ax[c] * ab) / determinant, 0.0f, 255.0f);
+			}
+			return true;
+		}
+
+		// NOTE: writes and reads fields least significant bit first, the layout of BC7 blocks
+		struct BitStream {
+			u64 bits[2]{};
+			u32 position = 0;
+
+			auto Write(u64 value, u32 count) -> void {
+				const u32 shift = position % 64;
+				bits[position / 64] |= value << shift;
+				if (shift + count > 64)
+					bits[position / 64 + 1] |= value >> (64 - shift);
+				position += count;
+			}
+
+			auto Read(u32 count) -> u32 {
+				const u32 shift = position % 64;
+				u64 value = bits[position / 64] >> shift;
+				if (shift + count > 64)
+					value |= bits[position / 64 + 1] << (64 - shift);
+				position += count;
+				return static_cast<u32>(value & ((1ull << count) - 1));
+			}
+		};
+
+		// BC1
+
+		auto To565(const f32 (&color)[4]) -> u16 {
+			const u32 r = static_cast<u32>(std::lround(color[0] * 31.0f / 255.0f));
+			const u32 g = static_cast<u32>(std::lround(color[1] * 63.0f / 255.0f));
+			const u32 b = static_cast<u32>(std::lround(color[2] * 31.0f / 255.0f));
+			return static_cast<u16>(r << 11 | g << 5 | b);
+		}
+
+		auto From565(u16 color, u8 (&rgba)[4]) -> void {
+			const u32 r = color >> 11 & 31;
+			const u32 g = color >> 5 & 63;
+			const u32 b = color & 31;
+			rgba[0] = static_cast<u8>(r << 3 | r >> 2);
+			rgba[1] = static_cast<u8>(g << 2 | g >> 4);
+			rgba[2] = static_cast<u8>(b << 3 | b >> 2);
+			rgba[3] = 255;
+		}
+
+		// NOTE: four color palette, the caller makes sure color0 > color1
+		auto GetBC1Palette(u16 color0, u16 color1, u8 (&palette)[4][4]) -> void {
+			From565(color0, palette[0]);
+			From565(color1, palette[1]);
+			for (u32 c = 0; c < 3; c++) {
+				palette[2][c] = static_cast<u8>((2 * palette[0][c] + palette[1][c]) / 3);
+				palette[3][c] = static_cast<u8>((palette[0][c] + 2 * palette[1][c]) / 3);
+			}
+			palette[2][3] = palette[3][3] = 255;
+		}
+
+		auto EncodeBC1(const Block& block, u8* output) -> void {
+			constexpr f32 IndexWeights[4] = { 0.0f, 1.0f, 1.0f / 3.0f, 2.0f / 3.0f };
+
+			f32 lo[4], hi[4];
+			FitPrincipalAxis<3>(block, lo, hi);
+
+			u64 bestError = ~0ull;
+			u16 bestColors[2]{};
+			u32 bestIndices = 0;
+			for (u32 iteration = 0; iteration <= RefineIterations; iteration++) {
+				u16 color0 = To565(hi);
+				u16 color1 = To565(lo);
+				if (color0 < color1)
+					std::swap(color0, color1);
+
+				u32 indices = 0;
+				u64 error = 0;
+				f32 weights[BlockTexels]{};
+				// NOTE: equal colors would select the three color mode, index 0 is the only entry that is the color then
+				if (color0 != color1) {
+					u8 palette[4][4];
+					GetBC1Palette(color0, color1, palette);
+					for (u32 i = 0; i < BlockTexels; i++) {
+						u32 bestIndex = 0;
+						f32 bestDistance = 1e30f;
+						for (u32 index = 0; index < 4; index++) {
+							f32 distance = 0.0f;
+							for (u32 c = 0; c < 3; c++) {
+								const f32 d = block.texels[i][c] - palette[index][c];
+								distance += d * d;
+							}
+							if (distance < bestDistance) {
+								bestDistance = distance;
+								bestIndex = index;
+							}
+						}
+						indices |= bestIndex << (i * 2);
+						weights[i] = IndexWeights[bestIndex];
+						error += static_cast<u64>(bestDistance);
+					}
+				} else {
+					u8 color[4];
+					From565(color0, color);
+					for (const auto& texel : block.texels) {
+						for (u32 c = 0; c < 3; c++)
+							error += static_cast<u64>((texel[c] - color[c]) * (texel[c] - color[c]));
+					}
+				}
+
+				if (error < bestError) {
+					bestError = error;
+					bestColors[0] = color0;
+					bestColors[1] = color1;
+					bestIndices = indices;
+				}
+
+				// NOTE: weights run from color0 to color1, color0 holds the larger endpoint
+				if (error == 0 || color0 == color1 || !RefineEndpoints<3>(block, weights, hi, lo))
+					break;
+			}
+
+			std::memcpy(output, bestColors, 4);
+			std::memcpy(output + 4, &bestIndices, 4);
+		}
+
+		auto DecodeBC1(const u8* input, u8 (&texels)[BlockTexels][4]) -> void {
+			u16 colors[2];
+			u32 indices;
+			std::memcpy(colors, input, 4);
+			std::memcpy(&indices, input + 4, 4);
+
+			u8 palette[4][4];
+			if (colors[0] > colors[1]) {
+				GetBC1Palette(colors[0], colors[1], palette);
+			} else {
+				From565(colors[0], palette[0]);
+				From565(colors[1], palette[1]);
+				for (u32 c = 0; c < 3; c++) {
+					palette[2][c] = static_cast<u8>((palette[0][c] + palette[1][c]) / 2);
+					palette[3][c] = 0;
+				}
+				palette[2][3] = 255;
+				palette[3][3] = 0;
+			}
+
+			for (u32 i = 0; i < BlockTexels; i++)
+				std::memcpy(texels[i], palette[indices >> (i * 2) & 3], 4);
+		}
+
+		// BC4, one channel, BC5 is two of them
+
+		auto EncodeBC4(const Block& block, u32 channel, u8* output) -> void {
+			f32 minimum = 255.0f;
+			f32 maximum = 0.0f;
+			for (const auto& texel : block.texels) {
+				minimum = std::min(minimum, texel[channel]);
+				maximum = std::max(maximum, texel[channel]);
+			}
+
+			const u32 red0 = static_cast<u32>(maximum);
+			const u32 red1 = static_cast<u32>(minimum);
+			u64 indices = 0;
+			// NOTE: red0 > red1 selects the eight value mode, equal endpoints leave every index at 0 which is red0 either way
+			if (red0 > red1) {
+				u32 palette[8] = { red0, red1 };
+				for (u32 i = 2; i < 8; i++)
+					palette[i] = ((8 - i) * red0 + (i - 1) * red1) / 7;
+
+				for (u32 i = 0; i < BlockTexels; i++) {
+					u64 bestIndex = 0;
+					f32 bestDistance = 1e30f;
+					for (u32 index = 0; index < 8; index++) {
+						const f32 distance = std::abs(block.texels[i][channel] - static_cast<f32>(palette[index]));
+						if (distance < bestDistance) {
+							bestDistance = distance;
+							bestIndex = index;
+						}
+					}
+					indices |= bestIndex << (i * 3);
+				}
+			}
+
+			output[0] = static_cast<u8>(red0);
+			output[1] = static_cast<u8>(red1);
+			for (u32 i = 0; i < 6; i++)
+				output[2 + i] = static_cast<u8>(indices >> (i * 8));
+		}
+
+		auto DecodeBC4(const u8* input, u32 channel, u8 (&texels)[BlockTexels][4]) -> void {
+			const u32 red0 = input[0];
+			const u32 red1 = input[1];
+			u32 palette[8] = { red0, red1 };
+			if (red0 > red1) {
+				for (u32 i = 2; i < 8; i++)
+					palette[i] = ((8 - i) * red0 + (i - 1) * red1) / 7;
+			} else {
+				for (u32 i = 2; i < 6; i++)
+					palette[i] = ((6 - i) * red0 + (i - 1) * red1) / 5;
+				palette[6] = 0;
+				palette[7] = 255;
+			}
+
+			u64 indices = 0;
+			for (u32 i = 0; i < 6; i++)
+				indices |= static_cast<u64>(input[2 + i]) << (i * 8);
+
+			for (u32 i = 0; i < BlockTexels; i++)
+				texels[i][channel] = static_cast<u8>(palette[indices >> (i * 3) & 7]);
+		}
+
+		// BC7, mode 6 only: 7 bit RGBA endpoints with a p-bit each, 4 bit indices
+
+		struct BC7Endpoint {
+			u32 color[4]; // NOTE: 7 bits each
+			u32 pBit;
+		};
+
+		auto QuantizeBC7(const f32 (&endpoint)[4]) -> BC7Endpoint {
+			BC7Endpoint best{};
+			f32 bestError = 1e30f;
+			for (u32 pBit = 0; pBit < 2; pBit++) {
+				BC7Endpoint candidate{ .pBit = pBit };
+				f32 error = 0.0f;
+				for (u32 c = 0; c < 4; c++) {
+					candidate.color[c] = static_cast<u32>(std::clamp(std::lround((endpoint[c] - pBit) * 0.5f), 0l, 127l));
+					const f32 d = endpoint[c] - static_cast<f32>(candidate.color[c] << 1 | pBit);
+					error += d * d;
+				}
+				if (error < bestError) {
+					bestError = error;
+					best = candidate;
+				}
+			}
+			return best;
+		}
+
+		auto GetBC7Palette(const BC7Endpoint& e0, const BC7Endpoint& e1, u8 (&palette)[16][4]) -> void {
+			for (u32 c = 0; c < 4; c++) {
+				const u32 a = e0.color[c] << 1 | e0.pBit;
+				const u32 b = e1.color[c] << 1 | e1.pBit;
+				for (u32 i = 0; i < 16; i++)
+					palette[i][c] = static_cast<u8>(((64 - BC7Weights[i]) * a + BC7Weights[i] * b + 32) >> 6);
+			}
+		}
+
+		auto EncodeBC7(const Block& block, u8* output) -> void {
+			f32 lo[4], hi[4];
+			FitPrincipalAxis<4>(block, lo, hi);
+
+			u64 bestError = ~0ull;
+			BC7Endpoint bestEndpoints[2]{};
+			u32 bestIndices[BlockTexels]{};
+			for (u32 iteration = 0; iteration <= RefineIterations; iteration++) {
+				const BC7Endpoint e0 = QuantizeBC7(lo);
+				const BC7Endpoint e1 = QuantizeBC7(hi);
+				u8 palette[16][4];
+				GetBC7Palette(e0, e1, palette);
+
+				// NOTE: the palette lies on the line between the endpoints, projecting onto it finds the nearest entry
+				// without trying all 16
+				f32 direction[4];
+				f32 lengthSquared = 0.0f;
+				for (u32 c = 0; c < 4; c++) {
+					direction[c] = static_cast<f32>(palette[15][c]) - palette[0][c];
+					lengthSquared += direction[c] * direction[c];
+				}
+				const f32 projectionScale = lengthSquared > 0.0f ? 64.0f / lengthSquared : 0.0f;
+
+				u32 indices[BlockTexels];
+				f32 weights[BlockTexels];
+				u64 error = 0;
+				for (u32 i = 0; i < BlockTexels; i++) {
+					f32 t = 0.0f;
+					for (u32 c = 0; c < 4; c++)
+						t += (block.texels[i][c] - palette[0][c]) * direction[c];
+
+					const u32 index = BC7NearestIndex[static_cast<u32>(std::clamp(t * projectionScale, 0.0f, 64.0f) + 0.5f)];
+					f32 distance = 0.0f;
+					for (u32 c = 0; c < 4; c++) {
+						const f32 d = block.texels[i][c] - palette[index][c];
+						distance += d * d;
+					}
+					indices[i] = index;
+					weights[i] = BC7Weights[index] / 64.0f;
+					error += static_cast<u64>(distance);
+				}
+
+				if (error < bestError) {
+					bestError = error;
+					bestEndpoints[0] = e0;
+					bestEndpoints[1] = e1;
+					std::memcpy(bestIndices, indices, sizeof(indices));
+				}
+
+				if (error == 0 || !RefineEndpoints<4>(block, weights, lo, hi))
+					break;
+			}
+
+			// NOTE: the first texel's index has an implied 0 top bit, mirroring the indices moves it to the lower half
+			if (bestIndices[0] >= 8) {
+				std::swap(bestEndpoints[0], bestEndpoints[1]);
+				for (auto& index : bestIndices)
+					index = 15 - index;
+			}
+
+			BitStream stream;
+			stream.Write(1u << 6, 7);
+			for (u32 c = 0; c < 4; c++) {
+				stream.Write(bestEndpoints[0].color[c], 7);
+				stream.Write(bestEndpoints[1].color[c], 7);
+			}
+			stream.Write(bestEndpoints[0].pBit, 1);
+			stream.Write(bestEndpoints[1].pBit, 1);
+			for (u32 i = 0; i < BlockTexels; i++)
+				stream.Write(bestIndices[i], i == 0 ? 3 : 4);
+
+			std::memcpy(output, stream.bits, 16);
+		}
+
+		auto DecodeBC7(const u8* input, u8 (&texels)[BlockTexels][4]) -> void {
+			BitStream stream;
+			std::memcpy(stream.bits, input, 16);
+
+			if (stream.Read(7) != 1u << 6) {
+				// NOTE: another mode, none of those are written by the cooker. Magenta makes it obvious
+				for (auto& texel : texels) {
+					texel[0] = texel[2] = texel[3] = 255;
+					texel[1] = 0;
+				}
+				return;
+			}
+
+			BC7Endpoint endpoints[2]{};
+			for (u32 c = 0; c < 4; c++) {
+				endpoints[0].color[c] = stream.Read(7);
+				endpoints[1].color[c] = stream.Read(7);
+			}
+			endpoints[0].pBit = stream.Read(1);
+			endpoints[1].pBit = stream.Read(1);
+
+			u8 palette[16][4];
+			GetBC7Palette(endpoints[0], endpoints[1], palette);
+			for (u32 i = 0; i < BlockTexels; i++)
+				std::memcpy(texels[i], palette[stream.Read(i == 0 ? 3 : 4)], 4);
+		}
+	}
+
+	auto CompressBlocks(TextureFormat format, const u8* rgba, u32 width, u32 height, u8* blocks) -> void {
+		Assert(IsBlockCompressed(format));
+
+		const u32 blocksX = (width + 3) / 4;
+		const u32 blocksY = (height + 3) / 4;
+		const u32 blockSize = GetBlockSize(format);
+		ParallelForChunks(blocksY, std::min(GetWorkerCount(), blocksY), [&](u32, u32 begin, u32 end) {
+			Block block;
+			for (u32 blockY = begin; blockY < end; blockY++) {
+				for (u32 blockX = 0; blockX < blocksX; blockX++) {
+					LoadBlock(rgba, width, height, blockX, blockY, block);
+					u8* output = blocks + (static_cast<u64>(blockY) * blocksX + blockX) * blockSize;
+					switch (format) {
+					case TextureFormat::BC1_UNORM:
+						EncodeBC1(block, output);
+						break;
+					case TextureFormat::BC5_UNORM:
+						EncodeBC4(block, 0, output);
+						EncodeBC4(block, 1, output + 8);
+						break;
+					case TextureFormat::BC7_UNORM:
+						EncodeBC7(block, output);
+						break;
+					default:
+						break;
+					}
+				}
+			}
+		});
+	}
+
+	auto DecompressBlocks(TextureFormat format, const u8* blocks, u32 width, u32 height, u8* rgba) -> void {
+		Assert(IsBlockCompressed(format));
+
+		const u32 blocksX = (width + 3) / 4;
+		const u32 blocksY = (height + 3) / 4;
+		const u32 blockSize = GetBlockSize(format);
+		ParallelForChunks(blocksY, std::min(GetWorkerCount(), blocksY), [&](u32, u32 begin, u32 end) {
+			u8 texels[BlockTexels][4];
+			for (u32 blockY = begin; blockY < end; blockY++) {
+				for (u32 blockX = 0; blockX < blocksX; blockX++) {
+					const u8* input = blocks + (static_cast<u64>(blockY) * blocksX + blockX) * blockSize;
+					switch (format) {
+					case TextureFormat::BC1_UNORM:
+						DecodeBC1(input, texels);
+						break;
+					case TextureFormat::BC5_UNORM:
+						// NOTE: what sampling BC5 returns, z is reconstructed by the shader
+						for (auto& texel : texels) {
+							texel[2] = 0;
+							texel[3] = 255;
+						}
+						DecodeBC4(input, 0, texels);
+						DecodeBC4(input + 8, 1, texels);
+						break;
+					case TextureFormat::BC7_UNORM:
+						DecodeBC7(input, texels);
+						break;
+					default:
+						break;
+					}
+					StoreBlock(texels, width, height, blockX, blockY, rgba);
+				}
+			}
+		});
+	}
+}
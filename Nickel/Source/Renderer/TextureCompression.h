@@ -0,0 +1,15 @@
+#pragma once
+
+#include "RendererTypes.h"
+
+// Block compression on the CPU. The encoders write what the texture cooker needs: BC1 with four colors (no punch
+// through alpha), BC5 as two BC4 channels and BC7 in mode 6 only, a single subset with RGBA endpoints, which covers
+// most texture content at a fraction of a full mode search. The decoders are for backends that can't sample block
+// compressed data (the software rasterizer) and for measuring the encoders, BC7 decodes mode 6 only. Images are RGBA8
+// with tightly packed rows, blocks are in rows of 4x4 texels and partial blocks at the edges repeat the last texels.
+namespace Nickel::Renderer {
+	// NOTE: 'blocks' holds GetRowPitch(format, width) * GetRowCount(format, height) bytes, block rows are encoded in
+	// parallel
+	auto CompressBlocks(TextureFormat format, const u8* rgba, u32 width, u32 height, u8* blocks) -> void;
+	auto DecompressBlocks(TextureFormat format, const u8* blocks, u32 width, u32 height, u8* rgba) -> void;
+}
@@ -0,0 +1,273 @@
+#include "TextureCooker.h"
+#include "TextureCache.h"
+#include "TextureCompression.h"
+#include "ImageDecoder.h"
+#include "../AssetArchive.h"
+#include "../Threading.h"
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include <sstream>
+
+#if defined(_M_X64) || defined(__x86_64__)
+#define NICKEL_TEXTURE_SSE 1
+#include <immintrin.h> // NOTE: SSE2 is part of x64, no runtime dispatch needed
+#endif
+
+namespace Nickel::Renderer::TextureCooker {
+	namespace {
+		constexpr u32 LinearToSRGBSteps = 4096;
+
+		struct SRGBTables {
+			std::array<f32, 256> toLinear;
+			std::array<u8, LinearToSRGBSteps> fromLinear; // NOTE: indexed by linear * (steps - 1), rounded
+		};
+
+		auto GetSRGBTables() -> const SRGBTables& {
+			static const SRGBTables tables = []() {
+				SRGBTables result;
+				for (u32 i = 0; i < 256; i++) {
+					const f32 c = i / 255.0f;
+					result.toLinear[i] = c <= 0.04045f ? c / 12.92f : std::pow((c + 0.055f) / 1.055f, 2.4f);
+				}
+				for (u32 i = 0; i < LinearToSRGBSteps; i++) {
+					const f32 c = static_cast<f32>(i) / (LinearToSRGBSteps - 1);
+					const f32 srgb = c <= 0.0031308f ? c * 12.92f : 1.055f * std::pow(c, 1.0f / 2.4f) - 0.055f;
+					result.fromLinear[i] = static_cast<u8>(std::lround(std::clamp(srgb, 0.0f, 1.0f) * 255.0f));
+				}
+				return result;
+			}();
+			return tables;
+		}
+
+		// NOTE: the four source texels of one texel of the next mip, the last row and column repeat on odd sizes
+		struct Footprint {
+			const u8* texels[4];
+		};
+
+		auto GetFootprint(const u8* row0, const u8* row1, u32 width, u32 x) -> Footprint {
+			const u32 x0 = std::min(x * 2, width - 1) * 4;
+			const u32 x1 = std::min(x * 2 + 1, width - 1) * 4;
+			return Footprint{ { row0 + x0, row0 + x1, row1 + x0, row1 + x1 } };
+		}
+
+		auto AverageLinear(const Footprint& footprint, u8* output) -> void {
+			for (u32 c = 0; c < 4; c++)
+				output[c] = static_cast<u8>((footprint.texels[0][c] + footprint.texels[1][c] + footprint.texels[2][c] + footprint.texels[3][c] + 2) / 4);
+		}
+
+		auto DownsampleRowLinear(const u8* row0, const u8* row1, u32 width, u8* output, u32 outputWidth) -> void {
+			u32 x = 0;
+#if NICKEL_TEXTURE_SSE
+			// NOTE: two output texels per step from four texels of both rows, summed in 16 bit lanes
+			const __m128i zero = _mm_setzero_si128();
+			const __m128i rounding = _mm_set1_epi16(2);
+			for (; x + 2 <= outputWidth && x * 2 + 4 <= width; x += 2) {
+				const __m128i top = _mm_loadu_si128(reinterpret_cast<const __m128i*>(row0 + x * 8));
+				const __m128i bottom = _mm_loadu_si128(reinterpret_cast<const __m128i*>(row1 + x * 8));
+				const __m128i low = _mm_add_epi16(_mm_unpacklo_epi8(top, zero), _mm_unpacklo_epi8(bottom, zero));
+				const __m128i high = _mm_add_epi16(_mm_unpackhi_epi8(top, zero), _mm_unpackhi_epi8(bottom, zero));
+				const __m128i sums = _mm_add_epi16(_mm_unpacklo_epi64(low, high), _mm_unpackhi_epi64(low, high));
+				const __m128i average = _mm_srli_epi16(_mm_add_epi16(sums, rounding), 2);
+				_mm_storel_epi64(reinterpret_cast<__m128i*>(output + x * 4), _mm_packus_epi16(average, zero));
+			}
+#endif
+			for (; x < outputWidth; x++)
+				AverageLinear(GetFootprint(row0, row1, width, x), output + x * 4);
+		}
+
+		// NOTE: colors are averaged as light, not as encoded values, or every mip comes out darker. Alpha is linear
+		auto DownsampleRowSRGB(const u8* row0, const u8* row1, u32 width, u8* output, u32 outputWidth) -> void {
+			const auto& tables = GetSRGBTables();
+			for (u32 x = 0; x < outputWidth; x++) {
+				const auto footprint = GetFootprint(row0, row1, width, x);
+				u8* texel = output + x * 4;
+				for (u32 c = 0; c < 3; c++) {
+					const f32 sum = tables.toLinear[footprint.texels[0][c]] + tables.toLinear[footprint.texels[1][c]] +
+						tables.toLinear[footprint.texels[2][c]] + tables.toLinear[footprint.texels[3][c]];
+					texel[c] = tables.fromLinear[static_cast<u32>(sum * 0.25f * (LinearToSRGBSteps - 1) + 0.5f)];
+				}
+				texel[3] = static_cast<u8>((footprint.texels[0][3] + footprint.texels[1][3] + footprint.texels[2][3] + footprint.texels[3][3] + 2) / 4);
+			}
+		}
+
+		// NOTE: the average of unit vectors is shorter than one, renormalizing keeps lighting from flattening in the
+		// distance
+		auto DownsampleRowNormal(const u8* row0, const u8* row1, u32 width, u8* output, u32 outputWidth) -> void {
+			for (u32 x = 0; x < outputWidth; x++) {
+				const auto footprint = GetFootprint(row0, row1, width, x);
+				f32 normal[3]{};
+				for (const u8* source : footprint.texels) {
+					for (u32 c = 0; c < 3; c++)
+						normal[c] += source[c] / 127.5f - 1.0f;
+				}
+
+				const f32 length = std::sqrt(normal[0] * normal[0] + normal[1] * normal[1] + normal[2] * normal[2]);
+				const f32 scale = length > 1e-6f ? 1.0f / length : 0.0f;
+				u8* texel = output + x * 4;
+				for (u32 c = 0; c < 3; c++)
+					texel[c] = static_cast<u8>(std::lround((std::clamp(normal[c] * scale, -1.0f, 1.0f) * 0.5f + 0.5f) * 255.0f));
+				texel[3] = static_cast<u8>((footprint.texels[0][3] + footprint.texels[1][3] + footprint.texels[2][3] + footprint.texels[3][3] + 2) / 4);
+			}
+		}
+
+		auto IsSRGB(TextureRole role) -> bool {
+			return role == TextureRole::Albedo || role == TextureRole::Emissive;
+		}
+
+		auto HashValue(u64 hash, u32 value) -> u64 {
+			return HashBytes(std::span{ reinterpret_cast<const u8*>(&value), sizeof(value) }, hash);
+		}
+
+		auto GetChainBytes(const std::vector<std::vector<u8>>& mips) -> u64 {
+			u64 bytes = 0;
+			for (const auto& mip : mips)
+				bytes += mip.size();
+			return bytes;
+		}
+
+		auto ToMilliseconds(std::chrono::steady_clock::duration duration) -> f64 {
+			return std::chrono::duration<f64, std::milli>(duration).count();
+		}
+	}
+
+	auto GetRoleName(TextureRole role) -> const char* {
+		switch (role) {
+			case TextureRole::Raw:            return "raw";
+			case TextureRole::Albedo:         return "albedo";
+			case TextureRole::Normal:         return "normal";
+			case TextureRole::MetalRoughness: return "metal_roughness";
+			case TextureRole::Occlusion:      return "occlusion";
+			case TextureRole::Emissive:       return "emissive";
+		}
+		return "unknown";
+	}
+
+	auto GetFormat(TextureRole role) -> TextureFormat {
+		switch (role) {
+			case TextureRole::Albedo:
+			case TextureRole::MetalRoughness: return TextureFormat::BC7_UNORM;
+			case TextureRole::Normal:         return TextureFormat::BC5_UNORM;
+			case TextureRole::Occlusion:
+			case TextureRole::Emissive:       return TextureFormat::BC1_UNORM;
+			default:                          return TextureFormat::RGBA8_UNORM;
+		}
+	}
+
+	auto BuildMipChain(const u8* rgba, u32 width, u32 height, TextureRole role) -> std::vector<std::vector<u8>> {
+		std::vector<std::vector<u8>> mips;
+		mips.emplace_back(rgba, rgba + static_cast<u64>(width) * height * 4);
+
+		const auto downsample = IsSRGB(role) ? DownsampleRowSRGB : role == TextureRole::Normal ? DownsampleRowNormal : DownsampleRowLinear;
+		while (width > 1 || height > 1) {
+			const u32 mipWidth = std::max(width / 2, 1u);
+			const u32 mipHeight = std::max(height / 2, 1u);
+			std::vector<u8> mip(static_cast<u64>(mipWidth) * mipHeight * 4);
+
+			const auto& source = mips.back();
+			ParallelForChunks(mipHeight, std::min(GetWorkerCount(), mipHeight), [&](u32, u32 begin, u32 end) {
+				for (u32 y = begin; y < end; y++) {
+					const u8* row0 = source.data() + static_cast<u64>(std::min(y * 2, height - 1)) * width * 4;
+					const u8* row1 = source.data() + static_cast<u64>(std::min(y * 2 + 1, height - 1)) * width * 4;
+					downsample(row0, row1, width, mip.data() + static_cast<u64>(y) * mipWidth * 4, mipWidth);
+				}
+			});
+
+			mips.push_back(std::move(mip));
+			width = mipWidth;
+			height = mipHeight;
+		}
+
+		return mips;
+	}
+
+	auto Cook(const u8* rgba, u32 width, u32 height, TextureRole role, CookedTexture& cooked) -> void {
+		auto format = GetFormat(role);
+		if (IsBlockCompressed(format) && (width % 4 != 0 || height % 4 != 0)) {
+			Logger::Warn("[TextureCooker]: " + std::to_string(width) + "x" + std::to_string(height) + " " + GetRoleName(role) + " texture isn't made of whole blocks, kept as RGBA8");
+			format = TextureFormat::RGBA8_UNORM;
+		}
+
+		cooked.mips = BuildMipChain(rgba, width, height, role);
+		cooked.desc = TextureDesc{
+			.type = TextureType::Texture2D,
+			.format = format,
+			.width = width,
+			.height = height,
+			.mipLevels = static_cast<u32>(cooked.mips.size())
+		};
+
+		if (!IsBlockCompressed(format))
+			return;
+
+		for (u32 mip = 0; mip < cooked.desc.mipLevels; mip++) {
+			const u32 mipWidth = std::max(width >> mip, 1u);
+			const u32 mipHeight = std::max(height >> mip, 1u);
+			std::vector<u8> blocks(static_cast<u64>(GetRowPitch(format, mipWidth)) * GetRowCount(format, mipHeight));
+			CompressBlocks(format, cooked.mips[mip].data(), mipWidth, mipHeight, blocks.data());
+			cooked.mips[mip] = std::move(blocks);
+		}
+	}
+
+	auto GetCachePath(u64 key, TextureRole role) -> std::filesystem::path {
+		std::stringstream fileName;
+		fileName << GetRoleName(role) << '_' << std::hex << key << ".ntex";
+		return std::filesystem::path(TextureCacheDir) / fileName.str();
+	}
+
+	auto LoadOrCook(const std::string& sourcePath, TextureRole role, CookedTexture& cooked, CookStats* stats) -> bool {
+		AssetData source;
+		if (!ReadAsset(sourcePath, source))
+			return false;
+
+		return LoadOrCook(sourcePath, source.bytes, role, cooked, stats);
+	}
+
+	auto LoadOrCook(const std::string& sourcePath, std::span<const u8> source, TextureRole role, CookedTexture& cooked, CookStats* stats) -> bool {
+		const auto start = std::chrono::steady_clock::now();
+
+		const u64 key = HashValue(HashValue(HashBytes(source), Version), static_cast<u32>(role));
+		const auto cachePath = GetCachePath(key, role);
+
+		std::vector<u8> texels;
+		const bool cached = ReadCachedTexture(cachePath, key, cooked.desc, texels);
+		u64 uncompressedBytes = 0;
+		if (cached) {
+			cooked.mips.clear();
+			u64 offset = 0;
+			for (u32 mip = 0; mip < cooked.desc.mipLevels; mip++) {
+				const u64 size = GetSubresourceSize(cooked.desc, mip);
+				cooked.mips.emplace_back(texels.begin() + offset, texels.begin() + offset + size);
+				offset += size;
+				uncompressedBytes += static_cast<u64>(std::max(cooked.desc.width >> mip, 1u)) * std::max(cooked.desc.height >> mip, 1u) * 4;
+			}
+		} else {
+			DecodedImage image;
+			if (!DecodeImage(source, TextureFormat::RGBA8_UNORM, image, sourcePath))
+				return false;
+
+			Cook(image.texels.Data(), image.width, image.height, role, cooked);
+
+			std::vector<SubresourceData> data;
+			data.reserve(cooked.mips.size());
+			for (u32 mip = 0; mip < cooked.desc.mipLevels; mip++) {
+				data.push_back(SubresourceData{ .data = cooked.mips[mip].data(), .rowPitch = GetRowPitch(cooked.desc.format, std::max(cooked.desc.width >> mip, 1u)) });
+				uncompressedBytes += static_cast<u64>(std::max(cooked.desc.width >> mip, 1u)) * std::max(cooked.desc.height >> mip, 1u) * 4;
+			}
+			StoreCachedTexture(cachePath, key, cooked.desc, data);
+		}
+
+		if (stats != nullptr) {
+			*stats = CookStats{
+				.cached = cached,
+				.milliseconds = ToMilliseconds(std::chrono::steady_clock::now() - start),
+				.uncompressedBytes = uncompressedBytes,
+				.cookedBytes = GetChainBytes(cooked.mips)
+			};
+		}
+
+		return true;
+	}
+}
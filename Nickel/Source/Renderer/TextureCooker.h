@@ -0,0 +1,56 @@
+#pragma once
+
+#include "RendererTypes.h"
+#include <filesystem>
+#include <string>
+#include <vector>
+
+namespace Nickel::Renderer {
+	// NOTE: what a texture is sampled as, decides its format and how its mips are filtered. Raw keeps the file's
+	// texels as RGBA8 and box filters them
+	enum class TextureRole : u8 {
+		Raw,
+		Albedo,         // NOTE: sRGB color with alpha, BC7
+		Normal,         // NOTE: tangent space xy in rg, BC5. The shader rebuilds z
+		MetalRoughness, // NOTE: metalness in r and roughness in g as the Pbr shader reads them, BC7
+		Occlusion,      // NOTE: BC1
+		Emissive        // NOTE: sRGB color, BC1
+	};
+}
+
+// Turns source images into what the GPU samples: a full mip chain filtered the way the role needs it (averaged in
+// linear space for sRGB colors, renormalized for normals) and block compressed per role, 4:1 for BC5 and BC7 and 8:1
+// for BC1 against RGBA8. Results go to the texture cache keyed by the source file's bytes, the role and the cooker
+// version, so a texture is cooked the first time it's loaded and read back as-is after that. Images whose size isn't
+// a multiple of 4 can't be block compressed and are cooked to RGBA8 with mips. Everything here is CPU only and runs
+// on any thread, the work inside a level is spread over the job system.
+namespace Nickel::Renderer::TextureCooker {
+	constexpr u32 Version = 1; // NOTE: bump when the filtering or an encoder changes, old cache files become misses
+
+	struct CookedTexture {
+		TextureDesc desc;
+		std::vector<std::vector<u8>> mips; // NOTE: level 0 first, rows (of blocks) tightly packed
+	};
+
+	struct CookStats {
+		bool cached;
+		f64 milliseconds;
+		u64 uncompressedBytes; // NOTE: the RGBA8 mip chain
+		u64 cookedBytes;
+	};
+
+	auto GetRoleName(TextureRole role) -> const char*;
+	auto GetFormat(TextureRole role) -> TextureFormat;
+
+	// NOTE: RGBA8 levels down to 1x1, level 0 is a copy of 'rgba'
+	auto BuildMipChain(const u8* rgba, u32 width, u32 height, TextureRole role) -> std::vector<std::vector<u8>>;
+	auto Cook(const u8* rgba, u32 width, u32 height, TextureRole role, CookedTexture& cooked) -> void;
+
+	auto GetCachePath(u64 key, TextureRole role) -> std::filesystem::path;
+
+	// NOTE: reads the cooked texture when the cache has it for this source, cooks and stores it otherwise. False when
+	// the source can't be read or decoded
+	auto LoadOrCook(const std::string& sourcePath, TextureRole role, CookedTexture& cooked, CookStats* stats = nullptr) -> bool;
+	// NOTE: the same for a source already read, 'sourcePath' only names it in the log
+	auto LoadOrCook(const std::string& sourcePath, std::span<const u8> source, TextureRole role, CookedTexture& cooked, CookStats* stats = nullptr) -> bool;
+}
@@ -0,0 +1,206 @@
+#include "TextureStreaming.h"
+#include <algorithm>
+#include <cmath>
+
+namespace Nickel::Renderer {
+	auto ComputeStreamingMip(u32 textureSize, f32 screenPixels) -> f32 {
+		return std::max(std::log2(static_cast<f32>(textureSize) / std::max(screenPixels, 1.0f)), 0.0f);
+	}
+
+	TextureStreamer::TextureStreamer(const TextureStreamingDesc& desc) : desc(desc) {
+		stats.budgetBytes = desc.budgetBytes;
+	}
+
+	auto TextureStreamer::Register(u32 width, u32 height, u32 mipLevels, TextureFormat format) -> StreamedTextureHandle {
+		Assert(width > 0 && height > 0 && mipLevels > 0);
+
+		Entry entry{ .width = width, .height = height, .mipLevels = mipLevels, .format = format };
+		while (entry.tailMip + 1 < mipLevels && std::max(width >> entry.tailMip, height >> entry.tailMip) > desc.tailSize)
+			entry.tailMip++;
+
+		if (IsBlockCompressed(format)) {
+			u32 alignedMip = 0;
+			while (alignedMip < entry.tailMip && (width >> (alignedMip + 1)) % 4 == 0 && (height >> (alignedMip + 1)) % 4 == 0)
+				alignedMip++;
+			entry.tailMip = alignedMip;
+		}
+
+		entry.residentMip = entry.pendingMip = entry.wantedMip = entry.tailMip;
+		stats.residentBytes += GetChainBytes(entry, entry.tailMip);
+
+		return entries.Allocate(entry);
+	}
+
+	auto TextureStreamer::Unregister(StreamedTextureHandle texture) -> void {
+		const auto entry = entries.Get(texture);
+		if (entry == nullptr)
+			return;
+
+		if (entry->pendingMip != entry->residentMip) {
+			stats.pendingBytes -= entry->reservedBytes;
+			stats.fetchesInFlight--;
+		}
+
+		stats.residentBytes -= GetChainBytes(*entry, entry->residentMip);
+		entries.Free(texture);
+	}
+
+	auto TextureStreamer::RequestMip(StreamedTextureHandle texture, f32 mip) -> void {
+		const auto entry = entries.Get(texture);
+		if (entry == nullptr)
+			return;
+
+		const u32 wanted = std::min(static_cast<u32>(std::max(mip, 0.0f)), entry->tailMip);
+		if (entry->lastUsedFrame != frame) {
+			entry->lastUsedFrame = frame;
+			entry->wantedMip = wanted;
+		} else {
+			entry->wantedMip = std::min(entry->wantedMip, wanted);
+		}
+	}
+
+	auto TextureStreamer::Update() -> std::span<const StreamingRequest> {
+		requests.clear();
+		upgrades.clear();
+		evictionOrder.clear();
+		evictionCursor = 0;
+		stats.wantedBytes = 0;
+
+		entries.ForEachAlive([&](StreamedTextureHandle texture, Entry& entry) {
+			if (entry.lastUsedFrame != frame)
+				entry.wantedMip = entry.tailMip;
+
+			stats.wantedBytes += GetChainBytes(entry, entry.wantedMip);
+			if (entry.pendingMip != entry.residentMip)
+				return;
+
+			if (entry.wantedMip < entry.residentMip)
+				upgrades.emplace_back(texture, &entry);
+			else if (entry.residentMip < GetFloorMip(entry))
+				evictionOrder.emplace_back(texture, &entry);
+		});
+
+		// NOTE: least recently used first, among equals the one holding the most
+		std::sort(evictionOrder.begin(), evictionOrder.end(), [this](const auto& a, const auto& b) {
+			if (a.second->lastUsedFrame != b.second->lastUsedFrame)
+				return a.second->lastUsedFrame < b.second->lastUsedFrame;
+			return GetChainBytes(*a.second, a.second->residentMip) > GetChainBytes(*b.second, b.second->residentMip);
+		});
+
+		// NOTE: the budget may have been lowered or mips kept past it by a deferred frame
+		while (stats.residentBytes + stats.pendingBytes > desc.budgetBytes && EvictOne()) {}
+
+		// NOTE: the textures furthest from what they need first, so a blurry one near the camera isn't stuck behind
+		// many that are one mip short
+		std::sort(upgrades.begin(), upgrades.end(), [](const auto& a, const auto& b) {
+			const u32 gapA = a.second->residentMip - a.second->wantedMip;
+			const u32 gapB = b.second->residentMip - b.second->wantedMip;
+			return gapA != gapB ? gapA > gapB : a.first.id < b.first.id;
+		});
+
+		u64 frameBytes = 0;
+		for (const auto& [texture, entry] : upgrades) {
+			if (stats.fetchesInFlight >= desc.maxFetchesInFlight || frameBytes >= desc.maxFetchBytesPerFrame)
+				break;
+
+			// NOTE: evicting comes before settling for less, only when nothing is left to evict the target gets coarser
+			u32 target = entry->wantedMip;
+			const u64 residentChain = GetChainBytes(*entry, entry->residentMip);
+			while (stats.residentBytes + stats.pendingBytes + GetChainBytes(*entry, target) - residentChain > desc.budgetBytes) {
+				if (EvictOne())
+					continue;
+				if (target + 1 >= entry->residentMip)
+					break;
+				target++;
+			}
+
+			const u64 delta = GetChainBytes(*entry, target) - residentChain;
+			if (target >= entry->residentMip || stats.residentBytes + stats.pendingBytes + delta > desc.budgetBytes) {
+				stats.deferred++;
+				continue;
+			}
+
+			entry->pendingMip = target;
+			entry->reservedBytes = delta;
+			stats.pendingBytes += delta;
+			stats.fetchesInFlight++;
+			stats.fetches++;
+			frameBytes += delta;
+			requests.push_back(StreamingRequest{ .texture = texture, .action = StreamingAction::Fetch, .mip = target });
+		}
+
+		frame++;
+		return requests;
+	}
+
+	auto TextureStreamer::CompleteFetch(StreamedTextureHandle texture, bool loaded) -> void {
+		const auto entry = entries.Get(texture);
+		if (entry == nullptr)
+			return;
+
+		Assert(entry->pendingMip != entry->residentMip);
+		stats.pendingBytes -= entry->reservedBytes;
+		stats.fetchesInFlight--;
+
+		if (loaded) {
+			stats.residentBytes += entry->reservedBytes;
+			stats.fetchedBytes += entry->reservedBytes;
+			entry->residentMip = entry->pendingMip;
+		} else {
+			entry->pendingMip = entry->residentMip;
+		}
+
+		entry->reservedBytes = 0;
+	}
+
+	auto TextureStreamer::SetBudget(u64 budgetBytes) -> void {
+		desc.budgetBytes = budgetBytes;
+		stats.budgetBytes = budgetBytes;
+	}
+
+	auto TextureStreamer::GetResidentMip(StreamedTextureHandle texture) const -> u32 {
+		const auto entry = entries.Get(texture);
+		return entry != nullptr ? entry->residentMip : 0;
+	}
+
+	auto TextureStreamer::GetTailMip(StreamedTextureHandle texture) const -> u32 {
+		const auto entry = entries.Get(texture);
+		return entry != nullptr ? entry->tailMip : 0;
+	}
+
+	auto TextureStreamer::GetStats() const -> TextureStreamingStats {
+		auto result = stats;
+		result.textureCount = entries.LiveCount();
+		return result;
+	}
+
+	auto TextureStreamer::GetChainBytes(const Entry& entry, u32 mip) const -> u64 {
+		u64 bytes = 0;
+		for (u32 i = mip; i < entry.mipLevels; i++)
+			bytes += static_cast<u64>(GetRowPitch(entry.format, std::max(entry.width >> i, 1u))) * GetRowCount(entry.format, std::max(entry.height >> i, 1u));
+
+		return bytes;
+	}
+
+	auto TextureStreamer::GetFloorMip(const Entry& entry) const -> u32 {
+		// NOTE: what a texture seen this frame needs stays, the detail beyond it and unseen textures' mips are fair game
+		return entry.lastUsedFrame == frame ? entry.wantedMip : entry.tailMip;
+	}
+
+	auto TextureStreamer::EvictOne() -> bool {
+		while (evictionCursor < evictionOrder.size()) {
+			const auto [texture, entry] = evictionOrder[evictionCursor++];
+			const u32 floor = GetFloorMip(*entry);
+			if (entry->residentMip >= floor)
+				continue;
+
+			stats.residentBytes -= GetChainBytes(*entry, entry->residentMip) - GetChainBytes(*entry, floor);
+			entry->residentMip = entry->pendingMip = floor;
+			stats.evictions++;
+			requests.push_back(StreamingRequest{ .texture = texture, .action = StreamingAction::Evict, .mip = floor });
+			return true;
+		}
+
+		return false;
+	}
+}
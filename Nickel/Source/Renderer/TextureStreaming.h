@@ -0,0 +1,95 @@
+#pragma once
+
+#include "HandlePool.h"
+#include "RendererTypes.h"
+#include <span>
+#include <vector>
+
+// Mip residency for streamed textures under a memory budget. The streamer only decides: every frame the renderer
+// reports the finest mip each visible texture needs, derived from how many texels land on a pixel, Update picks the
+// textures that get finer mips and the ones that lose theirs, and the owner carries that out and reports back when a
+// fetch lands. Nothing in here touches the device, so the policy runs headless against a simulated budget.
+namespace Nickel::Renderer {
+	using StreamedTextureHandle = Handle<struct StreamedTextureTag>;
+
+	struct TextureStreamingDesc {
+		u64 budgetBytes = 256ull << 20;
+		u32 tailSize = 64; // NOTE: mips this size and smaller are always resident, a texture comes up with just these
+		u32 maxFetchesInFlight = 4;
+		u64 maxFetchBytesPerFrame = 16ull << 20; // NOTE: no new fetches in a frame once its fetches add up to this
+	};
+
+	enum class StreamingAction : u8 {
+		Fetch, // NOTE: make the mips up to 'mip' resident, report back with CompleteFetch
+		Evict  // NOTE: drop every mip finer than 'mip', already accounted for when Update returns
+	};
+
+	struct StreamingRequest {
+		StreamedTextureHandle texture;
+		StreamingAction action;
+		u32 mip; // NOTE: the finest resident mip afterwards
+	};
+
+	struct TextureStreamingStats {
+		u32 textureCount;
+		u32 fetchesInFlight;
+		u64 residentBytes;
+		u64 pendingBytes; // NOTE: reserved for fetches in flight
+		u64 wantedBytes;  // NOTE: what the last frame's requests would need with no budget
+		u64 budgetBytes;
+		u64 fetchedBytes; // NOTE: totals since creation from here on
+		u32 fetches;
+		u32 evictions;
+		u32 deferred;     // NOTE: upgrades that didn't fit the budget even after evicting
+	};
+
+	// NOTE: the mip that maps about one texel to one pixel, 'screenPixels' is how many pixels the texture's size in
+	// texels covers on screen. Fractional, the streamer rounds it to the finer mip
+	auto ComputeStreamingMip(u32 textureSize, f32 screenPixels) -> f32;
+
+	class TextureStreamer {
+	public:
+		explicit TextureStreamer(const TextureStreamingDesc& desc = {});
+
+		// NOTE: the texture starts with its tail resident, the owner creates it with those mips only. Block compressed
+		// textures keep a finer tail when needed so every mip a resident range starts at is made of whole blocks
+		auto Register(u32 width, u32 height, u32 mipLevels, TextureFormat format) -> StreamedTextureHandle;
+		auto Unregister(StreamedTextureHandle texture) -> void; // NOTE: the owner drops a fetch still in flight
+
+		auto RequestMip(StreamedTextureHandle texture, f32 mip) -> void; // NOTE: any number of times a frame, the finest wins
+		auto Update() -> std::span<const StreamingRequest>; // NOTE: once per frame, valid until the next call
+		auto CompleteFetch(StreamedTextureHandle texture, bool loaded = true) -> void; // NOTE: a failed fetch keeps the old mips
+
+		auto SetBudget(u64 budgetBytes) -> void; // NOTE: lowering it evicts on the next Update
+		auto GetResidentMip(StreamedTextureHandle texture) const -> u32;
+		auto GetTailMip(StreamedTextureHandle texture) const -> u32;
+		auto GetStats() const -> TextureStreamingStats;
+
+	private:
+		struct Entry {
+			u32 width;
+			u32 height;
+			u32 mipLevels;
+			TextureFormat format;
+			u32 tailMip;
+			u32 residentMip;
+			u32 pendingMip;  // NOTE: the fetch in flight, equal to residentMip without one
+			u32 wantedMip;   // NOTE: this frame's finest request, tailMip when unseen
+			u64 reservedBytes;
+			u64 lastUsedFrame;
+		};
+
+		auto GetChainBytes(const Entry& entry, u32 mip) const -> u64; // NOTE: bytes of mips [mip, mipLevels)
+		auto GetFloorMip(const Entry& entry) const -> u32; // NOTE: the coarsest residency eviction may leave
+		auto EvictOne() -> bool; // NOTE: the least recently used texture above its floor, false when there's none
+
+		TextureStreamingDesc desc;
+		HandlePool<StreamedTextureHandle, Entry> entries;
+		std::vector<StreamingRequest> requests;
+		std::vector<std::pair<StreamedTextureHandle, Entry*>> upgrades; // NOTE: scratch, kept to avoid allocating every frame
+		std::vector<std::pair<StreamedTextureHandle, Entry*>> evictionOrder;
+		u32 evictionCursor = 0;
+		u64 frame = 1;
+		TextureStreamingStats stats{};
+	};
+}
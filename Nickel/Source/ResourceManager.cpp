@@ -1,7 +1,215 @@
 #define STB_IMAGE_IMPLEMENTATION
 #include "ResourceManager.h"
+#include "Renderer/TextureCache.h"
+#include "AssetArchive.h"
+#include "GltfLoader.h"
+#include "Threading.h"
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <cstring>
+#include <filesystem>
 
 namespace Nickel::Renderer {
+	namespace {
+		// NOTE: the same file loaded as a 2D texture and as a cube map face are different assets
+		auto MakeKey(const char* kind, const std::string& path) -> std::string {
+			return std::string(kind) + ':' + path;
+		}
+
+		auto MakeCubeMapKey(std::span<const std::string, 6> facePaths) -> std::string {
+			std::string key = "cube";
+			for (const auto& path : facePaths)
+				key += ':' + path;
+			return key;
+		}
+
+		// NOTE: MurmurHash3's 64 bit finalizer
+		auto Mix64(u64 value) -> u64 {
+			value = (value ^ (value >> 33)) * 0xff51afd7ed558ccdull;
+			value = (value ^ (value >> 33)) * 0xc4ceb9fe1a85ec53ull;
+			return value ^ (value >> 33);
+		}
+
+		// NOTE: byte at a time FNV takes tens of milliseconds on a 4K texture, this mixes 8 bytes per step. The check
+		// lane is built differently from the key lane, a collision of one says nothing about the other
+		auto HashWords(std::span<const u8> bytes, TextureContentHash hash) -> TextureContentHash {
+			const u64 wordCount = bytes.size() / 8;
+			for (u64 i = 0; i < wordCount; i++) {
+				u64 word;
+				std::memcpy(&word, bytes.data() + i * 8, sizeof(word));
+				hash.key = std::rotl(hash.key ^ (word * 0x9e3779b97f4a7c15ull), 31) * 0xbf58476d1ce4e5b9ull;
+				hash.check = Mix64(hash.check + word);
+			}
+
+			const auto tail = bytes.subspan(wordCount * 8);
+			return TextureContentHash{ .key = HashBytes(tail, hash.key), .check = Mix64(HashBytes(tail, hash.check) ^ bytes.size()) };
+		}
+
+		// NOTE: the description is part of the hash, equal bytes in a different layout aren't the same texture. Rows
+		// have to be tightly packed, which is what every loader here produces
+		auto HashContent(const TextureDesc& desc, std::span<const SubresourceData> data) -> TextureContentHash {
+			const u32 layout[] = { static_cast<u32>(desc.type), static_cast<u32>(desc.format), desc.width, desc.height, desc.mipLevels, desc.arraySize };
+			const auto layoutBytes = std::span{ reinterpret_cast<const u8*>(layout), sizeof(layout) };
+			auto hash = TextureContentHash{ .key = HashBytes(layoutBytes), .check = Mix64(HashBytes(layoutBytes, ~HashSeed)) };
+			for (u32 i = 0; i < data.size(); i++) {
+				const auto size = GetSubresourceSize(desc, i % desc.mipLevels);
+				hash = HashWords(std::span{ static_cast<const u8*>(data[i].data), size }, hash);
+			}
+
+			return hash;
+		}
+
+		// NOTE: loads and the file watcher can name the same file differently (relative or absolute, '\\' or '/')
+		auto GetWatchedPath(const std::string& path) -> std::string {
+			std::error_code error;
+			return NormalizeAssetPath(std::filesystem::absolute(path, error).string());
+		}
+
+		auto GetTextureBytes(const TextureDesc& desc) -> u64 {
+			u64 bytes = 0;
+			for (u32 mip = 0; mip < desc.mipLevels; mip++)
+				bytes += GetSubresourceSize(desc, mip) * desc.arraySize;
+
+			return bytes;
+		}
+
+		auto DescribeImage(const DecodedImage& image) -> TextureDesc {
+			return TextureDesc{
+				.type = TextureType::Texture2D,
+				.format = image.format,
+				.width = image.width,
+				.height = image.height
+			};
+		}
+
+		// NOTE: every mip of a cooked texture, pointing into it
+		auto DescribeMips(const TextureCooker::CookedTexture& cooked) -> std::vector<SubresourceData> {
+			std::vector<SubresourceData> data;
+			data.reserve(cooked.mips.size());
+			for (u32 mip = 0; mip < cooked.mips.size(); mip++)
+				data.push_back(SubresourceData{ .data = cooked.mips[mip].data(), .rowPitch = GetRowPitch(cooked.desc.format, std::max(cooked.desc.width >> mip, 1u)) });
+
+			return data;
+		}
+
+		// NOTE: subresources in [face][mip] order, pointing into 'mips'
+		auto DescribeCubeMap(std::span<const CubemapImage> mips, std::vector<SubresourceData>& data) -> TextureDesc {
+			Assert(!mips.empty());
+
+			const auto desc = TextureDesc{
+				.type = TextureType::TextureCube,
+				.format = TextureFormat::RGBA32_FLOAT,
+				.width = mips[0].size,
+				.height = mips[0].size,
+				.mipLevels = static_cast<u32>(mips.size()),
+				.arraySize = CubeFaceCount
+			};
+
+			data.reserve(CubeFaceCount * mips.size());
+			for (u32 face = 0; face < CubeFaceCount; face++) {
+				for (u32 mip = 0; mip < desc.mipLevels; mip++) {
+					Assert(mips[mip].IsValid() && mips[mip].size == std::max(desc.width >> mip, 1u));
+					data.push_back(SubresourceData{ .data = mips[mip].faces[face].data(), .rowPitch = mips[mip].size * GetTexelSize(desc.format) });
+				}
+			}
+
+			return desc;
+		}
+
+		auto CheckCubeFaces(std::span<const std::string, 6> facePaths, std::span<const DecodedImage, CubeFaceCount> faces) -> bool {
+			for (u32 i = 0; i < CubeFaceCount; i++) {
+				if (faces[i].width != faces[i].height || faces[i].width != faces[0].width) {
+					Logger::Error("Cube map faces have to be square and the same size: " + facePaths[i]);
+					return false;
+				}
+			}
+
+			return true;
+		}
+
+		// NOTE: the faces are decoded in parallel, false (logged) when one fails or they aren't square and the same size
+		auto DecodeCubeFaces(std::span<const std::string, 6> facePaths, TextureFormat format, std::span<DecodedImage, CubeFaceCount> faces) -> bool {
+			return DecodeImages(facePaths, format, faces) && CheckCubeFaces(facePaths, faces);
+		}
+
+		// NOTE: the same from the files already read
+		auto DecodeCubeFaces(std::span<const std::string, 6> facePaths, std::span<const std::span<const u8>, 6> files, TextureFormat format, std::span<DecodedImage, CubeFaceCount> faces) -> bool {
+			std::atomic<u32> failed = 0;
+			ParallelForChunks(CubeFaceCount, CubeFaceCount, [&](u32, u32 begin, u32 end) {
+				for (u32 i = begin; i < end; i++) {
+					if (!DecodeImage(files[i], format, faces[i], facePaths[i]))
+						failed.fetch_add(1, std::memory_order_relaxed);
+				}
+			});
+
+			return failed.load() == 0 && CheckCubeFaces(facePaths, faces);
+		}
+
+		// NOTE: a single mip, subresources pointing into 'faces'
+		auto DescribeCubeFaces(std::span<const DecodedImage, CubeFaceCount> faces, std::vector<SubresourceData>& data) -> TextureDesc {
+			const auto desc = TextureDesc{
+				.type = TextureType::TextureCube,
+				.format = faces[0].format,
+				.width = faces[0].width,
+				.height = faces[0].height,
+				.arraySize = CubeFaceCount
+			};
+
+			data.reserve(CubeFaceCount);
+			for (const auto& face : faces)
+				data.push_back(SubresourceData{ .data = face.texels.Data(), .rowPitch = face.GetRowPitch() });
+
+			return desc;
+		}
+
+		// NOTE: in the order the scene graph lists them, a mesh referenced by several nodes comes once per node
+		auto CollectMeshes(const aiNode& node, const aiScene& scene, std::vector<const aiMesh*>& meshes) -> void {
+			for (u32 i = 0; i < node.mNumMeshes; i++)
+				meshes.push_back(scene.mMeshes[node.mMeshes[i]]);
+
+			for (u32 i = 0; i < node.mNumChildren; i++)
+				CollectMeshes(*node.mChildren[i], scene, meshes);
+		}
+
+		// NOTE: what assimp allocated for a mesh's vertex attributes and faces
+		auto GetSceneBytes(const aiMesh& mesh) -> u64 {
+			u64 vertexBytes = sizeof(aiVector3D);
+			vertexBytes += mesh.HasNormals() ? sizeof(aiVector3D) : 0;
+			vertexBytes += mesh.HasTangentsAndBitangents() ? 2 * sizeof(aiVector3D) : 0;
+			vertexBytes += mesh.GetNumUVChannels() * sizeof(aiVector3D);
+			vertexBytes += mesh.GetNumColorChannels() * sizeof(aiColor4D);
+			return vertexBytes * mesh.mNumVertices + static_cast<u64>(mesh.mNumFaces) * (sizeof(aiFace) + 3 * sizeof(u32));
+		}
+
+		// NOTE: from assimp's arrays straight into the upload layout, returns the bounding radius
+		auto WriteSubmesh(const aiMesh& mesh, MeshVertex* vertices, u32* indices) -> f32 {
+			Assert(mesh.HasPositions());
+
+			const aiVector3D* uvs = mesh.mTextureCoords[0];
+			f32 radiusSquared = 0.0f;
+			for (u32 i = 0; i < mesh.mNumVertices; i++) {
+				const auto& position = mesh.mVertices[i];
+				const auto normal = mesh.HasNormals() ? mesh.mNormals[i] : aiVector3D{};
+				const auto uv = uvs != nullptr ? uvs[i] : aiVector3D{};
+				vertices[i] = MeshVertex{
+					.position = { position.x, position.y, position.z },
+					.normal = { normal.x, normal.y, normal.z },
+					.uv = { uv.x, uv.y }
+				};
+				radiusSquared = std::max(radiusSquared, position.x * position.x + position.y * position.y + position.z * position.z);
+			}
+
+			for (u32 i = 0; i < mesh.mNumFaces; i++) {
+				const aiFace& face = mesh.mFaces[i];
+				Assert(face.mNumIndices == 3); // NOTE: mesh must be triangulated
+				std::memcpy(indices + i * 3, face.mIndices, 3 * sizeof(u32));
+			}
+
+			return std::sqrt(radiusSquared);
+		}
+	}
+
 	ResourceManager* ResourceManager::resourceManager = nullptr;
 
 	auto ResourceManager::GetInstance() -> ResourceManager* {
@@ -11,30 +219,121 @@ namespace Nickel::Renderer {
 		return resourceManager;
 	}
 
-	auto ResourceManager::Init(ID3D11Device1* _device) -> void {
-		device = _device;
+	auto ResourceManager::Init(const PlatformInterface& _gfx, PipelineCache& pipelineCache) -> void {
+		gfx = &_gfx;
+		defaultSampler = pipelineCache.AcquireSampler(*gfx, SamplerDesc{
+			.filter = TextureFilter::Linear,
+			.addressMode = TextureAddressMode::Wrap
+		});
+		fileReader.Init();
 	}
 
-	auto ResourceManager::LoadTexture(std::wstring path) -> DXLayer::TextureDX11 {
-		DXLayer::TextureDX11 newTex{ .samplerState = DXLayer::GetDefaultSamplerState(device)};
-		ASSERT_ERROR_RESULT(DirectX::CreateWICTextureFromFile(device, path.c_str(), &newTex.resource, &newTex.srv));
-		
-		/*
-		_In_ ID3D11Device* d3dDevice,
-        _In_opt_ ID3D11DeviceContext* d3dContext,
-        _In_z_ const wchar_t* szFileName,
-        _In_ size_t maxsize,
-        _In_ D3D11_USAGE usage,
-        _In_ unsigned int bindFlags,
-        _In_ unsigned int cpuAccessFlags,
-        _In_ unsigned int miscFlags,
-        _In_ unsigned int loadFlags,
-        _Outptr_opt_ ID3D11Resource** texture,
-        _Outptr_opt_ ID3D11ShaderResourceView** textureView);
-		*/
-		Assert(newTex.srv != nullptr);
+	auto ResourceManager::GetDefaultSampler() -> SamplerHandle {
+		return defaultSampler;
+	}
+
+	auto ResourceManager::LoadTexture(const std::string& path) -> TextureHandle {
+		Assert(gfx != nullptr);
+
+		const auto key = MakeKey("2d", path);
+		if (const auto texture = FindTexture(key); texture.IsValid())
+			return texture;
+
+		DecodedImage image;
+		if (!DecodeImage(path, TextureFormat::RGBA8_UNORM, image)) {
+			Logger::Error("Failed to load texture: " + path);
+			return {};
+		}
+
+		const auto desc = DescribeImage(image);
+		const auto data = SubresourceData{ .data = image.texels.Data(), .rowPitch = image.GetRowPitch() };
+
+		auto texture = HandOut(AddTexture(desc, std::span{ &data, 1 }, key, HashContent(desc, std::span{ &data, 1 }), 1));
+		TrackSource(key, AsyncLoadType::Texture, TextureRole::Raw, std::span{ &path, 1 });
+
+		Assert(texture.IsValid());
+		return texture;
+	}
+
+	auto ResourceManager::LoadCubeMap(std::span<const std::string, 6> facePaths) -> TextureHandle {
+		const auto key = MakeCubeMapKey(facePaths);
+		if (const auto texture = FindTexture(key); texture.IsValid())
+			return texture;
+
+		std::array<DecodedImage, CubeFaceCount> faces;
+		if (!DecodeCubeFaces(facePaths, TextureFormat::RGBA16_FLOAT, faces))
+			return {};
+
+		std::vector<SubresourceData> data;
+		const auto desc = DescribeCubeFaces(faces, data);
+		const auto texture = HandOut(AddTexture(desc, data, key, HashContent(desc, data), 1));
+		if (texture.IsValid())
+			TrackSource(key, AsyncLoadType::CubeMap, TextureRole::Raw, facePaths);
+
+		return texture;
+	}
+
+	auto ResourceManager::LoadCubeMapImage(std::span<const std::string, 6> facePaths) -> CubemapImage {
+		std::array<DecodedImage, CubeFaceCount> faces;
+		if (!DecodeCubeFaces(facePaths, TextureFormat::RGBA32_FLOAT, faces))
+			return {};
+
+		CubemapImage image{ .size = faces[0].width };
+		for (u32 i = 0; i < CubeFaceCount; i++) {
+			const auto texels = reinterpret_cast<const f32*>(faces[i].texels.Data());
+			image.faces[i].assign(texels, texels + static_cast<u64>(image.size) * image.size * 4);
+		}
+
+		return image;
+	}
 
-		return newTex;
+	auto ResourceManager::CreateCubeMap(const CubemapImage& image) -> TextureHandle {
+		return CreateCubeMap(std::span{ &image, 1 });
+	}
+
+	auto ResourceManager::CreateCubeMap(std::span<const CubemapImage> mips) -> TextureHandle {
+		Assert(gfx != nullptr);
+
+		std::vector<SubresourceData> data;
+		const auto desc = DescribeCubeMap(mips, data);
+		return gfx->CreateTexture(desc, data);
+	}
+
+	auto ResourceManager::LoadEquirectCubeMap(const std::string& path, const EquirectConversionDesc& desc) -> TextureHandle {
+		// NOTE: a hit skips the conversion too, the face size and filter are part of the key
+		const auto key = MakeKey("equirect", path + ':' + std::to_string(desc.faceSize) + ':' + std::to_string(static_cast<u32>(desc.filter)));
+		if (const auto texture = FindTexture(key); texture.IsValid())
+			return texture;
+
+		const auto panorama = LoadEquirectImage(path);
+		if (!panorama.IsValid())
+			return {};
+
+		EquirectConversionStats stats{};
+		const auto image = ConvertEquirectToCubemap(panorama, desc, &stats);
+		const auto mips = BuildMipChain(image);
+		Logger::Info("Converted " + path + " to " + std::to_string(image.size) + "^2 cube faces in " + std::to_string(stats.milliseconds) + " ms");
+
+		std::vector<SubresourceData> data;
+		const auto cubeDesc = DescribeCubeMap(mips, data);
+		return HandOut(AddTexture(cubeDesc, data, key, HashContent(cubeDesc, data), 1));
+	}
+
+	auto ResourceManager::LoadEquirectImage(const std::string& path) -> EquirectImage {
+		DecodedImage decoded;
+		if (!DecodeImage(path, TextureFormat::RGBA32_FLOAT, decoded)) {
+			Logger::Error("Failed to load panorama: " + path);
+			return {};
+		}
+
+		EquirectImage image{ .width = decoded.width, .height = decoded.height };
+		const auto texels = reinterpret_cast<const f32*>(decoded.texels.Data());
+		image.texels.assign(texels, texels + static_cast<u64>(image.width) * image.height * 4);
+
+		if (image.width != image.height * 2)
+			Logger::Warn("Panorama isn't 2:1, it will be stretched: " + path);
+
+		return image;
 	}
 
 	auto ResourceManager::LoadImageData(std::string path) -> LoadedImageData {
@@ -50,8 +349,7 @@ namespace Nickel::Renderer {
 	auto ResourceManager::LoadHDRImageData(std::string path) -> LoadedImageData {
 		i32 width, height, channels;
 		//stbi_set_flip_vertically_on_load(true);
-		bool asd = stbi_is_hdr(path.c_str());
-		stbi_hdr_to_ldr_gamma(2.2f);
+		// NOTE: stb_image's gamma settings are global, changing them here would race with decodes on other threads
 		f32* img = stbi_loadf(path.c_str(), &width, &height, &channels, 0);
 		Assert(img != nullptr);
 
@@ -60,105 +358,847 @@ namespace Nickel::Renderer {
 		};
 	}
 
-	auto ResourceManager::ProcessMesh(const aiMesh& mesh, const aiScene& scene) -> MeshData {
-		auto vertices = std::vector<LoadedVertex>(mesh.mNumVertices);
+	auto ResourceManager::ImportModel(const std::string& path, ImportedModel& model, ModelImporter importer) -> bool {
+		if (importer != ModelImporter::Assimp && Gltf::IsGltfPath(path)) {
+			const auto result = Gltf::Import(path, model);
+			if (result != Gltf::ImportResult::Unsupported || importer == ModelImporter::Native)
+				return result == Gltf::ImportResult::Loaded;
+		} else if (importer == ModelImporter::Native) {
+			Logger::Error("Only glTF models can be imported natively: " + path);
+			return false;
+		}
+
+		const auto start = std::chrono::steady_clock::now();
 
-		Assert(mesh.HasPositions());
-		for (u64 i = 0; i < mesh.mNumVertices; i++) {
-			const auto& vert = mesh.mVertices[i];
-			vertices[i].position = { vert.x, vert.y, vert.z };
+		// NOTE: no tangents, MeshVertex has nowhere to put them and generating them was a good part of the import
+		Assimp::Importer assimp;
+		//const u32 flags = aiProcess_Triangulate | aiProcess_SortByPType | aiProcess_JoinIdenticalVertices |
+			//aiProcess_OptimizeMeshes | aiProcess_OptimizeGraph | aiProcess_ImproveCacheLocality;
+		const u32 flags = aiProcess_Triangulate |
+			aiProcess_JoinIdenticalVertices |
+			aiProcess_ConvertToLeftHanded |
+			aiProcess_GenNormals;
+		const aiScene* scene = assimp.ReadFile(path, flags); // aiProcess_FlipUVs aiProcess_JoinIdenticalVertices
+		if (scene == nullptr) {
+			Logger::Error(assimp.GetErrorString());
+			return false;
 		}
 
-		if (mesh.HasNormals()) {
-			for (u64 i = 0; i < mesh.mNumVertices; i++) {
-				const auto& normal = mesh.mNormals[i];
-				vertices[i].normal = Vec3{ normal.x, normal.y, normal.z };
-			}
+		const auto parsed = std::chrono::steady_clock::now();
+		std::vector<const aiMesh*> meshes;
+		CollectMeshes(*scene->mRootNode, *scene, meshes);
+
+		// NOTE: the vertices of every submesh first, then the indices, so both stay 4 byte aligned
+		std::vector<u64> vertexOffsets(meshes.size() + 1), indexOffsets(meshes.size() + 1);
+		u64 sceneBytes = 0;
+		for (u32 i = 0; i < meshes.size(); i++) {
+			vertexOffsets[i + 1] = vertexOffsets[i] + meshes[i]->mNumVertices;
+			indexOffsets[i + 1] = indexOffsets[i] + static_cast<u64>(meshes[i]->mNumFaces) * 3;
+			sceneBytes += GetSceneBytes(*meshes[i]);
+		}
 
-			if (mesh.HasTangentsAndBitangents()) {
-				for (u64 i = 0; i < mesh.mNumVertices; i++) {
-					const auto& tangent = mesh.mTangents[i];
-					const auto& bitangent = mesh.mBitangents[i];
-					vertices[i].tangent = Vec3{ tangent.x, tangent.y, tangent.z };
-					vertices[i].bitangent = Vec3{ bitangent.x, bitangent.y, bitangent.z };
+		const u64 arenaBytes = vertexOffsets.back() * sizeof(MeshVertex) + indexOffsets.back() * sizeof(u32);
+		model.arena = std::make_unique_for_overwrite<u8[]>(arenaBytes);
+		const auto vertices = reinterpret_cast<MeshVertex*>(model.arena.get());
+		const auto indices = reinterpret_cast<u32*>(vertices + vertexOffsets.back());
+
+		model.submeshes.resize(meshes.size());
+		const u32 meshCount = static_cast<u32>(meshes.size());
+		if (meshCount > 0) {
+			ParallelForChunks(meshCount, std::min(GetWorkerCount(), meshCount), [&](u32, u32 begin, u32 end) {
+				for (u32 i = begin; i < end; i++) {
+					auto& submesh = model.submeshes[i];
+					submesh.vertices = std::span{ vertices + vertexOffsets[i], meshes[i]->mNumVertices };
+					submesh.indices = std::span{ indices + indexOffsets[i], indexOffsets[i + 1] - indexOffsets[i] };
+					submesh.boundingRadius = WriteSubmesh(*meshes[i], vertices + vertexOffsets[i], indices + indexOffsets[i]);
 				}
+			});
+		}
+
+		const auto converted = std::chrono::steady_clock::now();
+		model.files = { path };
+		model.stats = ModelImportStats{
+			.importer = ModelImporter::Assimp,
+			.parseMilliseconds = std::chrono::duration<f64, std::milli>(parsed - start).count(),
+			.sceneBytes = sceneBytes,
+			.convertMilliseconds = std::chrono::duration<f64, std::milli>(converted - parsed).count(),
+			.arenaBytes = arenaBytes,
+			.peakBytes = sceneBytes + arenaBytes
+		};
+
+		return true;
+	}
+
+	auto ResourceManager::LoadModel(std::string path) -> const ImportedModel* {
+		if (const auto it = cachedModels.find(path); it != cachedModels.end()) {
+			it->second.refCount++;
+			cacheStats.pathHits++;
+			return it->second.model.get();
+		}
+
+		auto model = std::make_unique<ImportedModel>();
+		if (!ImportModel(path, *model))
+			return nullptr;
+
+		cacheStats.misses++;
+		TrackSource(MakeKey("model", path), AsyncLoadType::Model, TextureRole::Raw, model->files);
+		auto& entry = cachedModels[path];
+		entry = CachedModel{ .model = std::move(model), .refCount = 1 };
+
+		return entry.model.get();
+	}
+
+	auto ResourceManager::FindTexture(const std::string& key) -> TextureHandle {
+		const auto it = texturesByKey.find(key);
+		if (it == texturesByKey.end())
+			return {};
+
+		auto& entry = cachedTextures.at(it->second.id);
+		entry.refCount++;
+		entry.handedOut = true;
+		cacheStats.pathHits++;
+		cacheStats.bytesSaved += entry.bytes;
+
+		return it->second;
+	}
+
+	auto ResourceManager::HandOut(TextureHandle texture) -> TextureHandle {
+		if (const auto it = cachedTextures.find(texture.id); it != cachedTextures.end())
+			it->second.handedOut = true;
+
+		return texture;
+	}
+
+	auto ResourceManager::AddTexture(const TextureDesc& desc, std::span<const SubresourceData> data, const std::string& key, const TextureContentHash& contentHash, u32 references) -> TextureHandle {
+		if (const auto resident = FindContent(contentHash); resident.IsValid()) {
+			auto& entry = cachedTextures.at(resident.id);
+			entry.refCount += references;
+			entry.keys.push_back(key);
+			texturesByKey[key] = resident;
+			cacheStats.contentHits++;
+			cacheStats.bytesSaved += entry.bytes;
+			return resident;
+		}
+
+		const auto texture = gfx->CreateTexture(desc, data);
+		if (!texture.IsValid())
+			return {};
+
+		RegisterTexture(texture, desc, key, contentHash, references);
+		return texture;
+	}
+
+	auto ResourceManager::RegisterTexture(TextureHandle texture, const TextureDesc& desc, const std::string& key, const TextureContentHash& contentHash, u32 references) -> CachedTexture& {
+		texturesByKey[key] = texture;
+		texturesByContent[contentHash.key] = texture; // NOTE: takes the slot over when only the key collided
+		cacheStats.misses++;
+
+		auto& entry = cachedTextures[texture.id];
+		entry = CachedTexture{ .keys = { key }, .contentHash = contentHash, .bytes = GetTextureBytes(desc), .refCount = references };
+		return entry;
+	}
+
+	auto ResourceManager::FindContent(const TextureContentHash& contentHash) const -> TextureHandle {
+		// NOTE: the key alone is one 64 bit hash, both colliding is what it takes for two files to share wrong pixels
+		const auto it = texturesByContent.find(contentHash.key);
+		if (it == texturesByContent.end() || cachedTextures.at(it->second.id).contentHash != contentHash)
+			return {};
+
+		return it->second;
+	}
+
+	auto ResourceManager::ReplaceCachedTexture(TextureHandle from, TextureHandle to) -> CachedTexture& {
+		auto node = cachedTextures.extract(from.id);
+		node.key() = to.id;
+		auto& entry = cachedTextures.insert(std::move(node)).position->second;
+
+		for (const auto& key : entry.keys)
+			texturesByKey[key] = to;
+		if (const auto content = texturesByContent.find(entry.contentHash.key); content != texturesByContent.end() && content->second.id == from.id)
+			content->second = to;
+
+		// NOTE: whoever holds the old texture's handle may still release or resolve it
+		if (entry.handedOut) {
+			entry.aliases.push_back(from);
+			entry.handedOut = false;
+		} else {
+			gfx->DestroyTexture(from);
+		}
+		for (const auto& alias : entry.aliases)
+			aliasedTextures[alias.id] = to;
+
+		return entry;
+	}
+
+	auto ResourceManager::ReleaseTexture(TextureHandle texture) -> void {
+		if (const auto it = aliasedTextures.find(texture.id); it != aliasedTextures.end())
+			texture = it->second;
+
+		if (const auto it = cachedTextures.find(texture.id); it != cachedTextures.end()) {
+			auto& entry = it->second;
+			Assert(entry.refCount > 0);
+			if (--entry.refCount > 0)
+				return;
+
+			for (const auto& alias : entry.aliases) {
+				aliasedTextures.erase(alias.id);
+				gfx->DestroyTexture(alias);
+			}
+
+			for (const auto& key : entry.keys)
+				texturesByKey.erase(key);
+			if (const auto content = texturesByContent.find(entry.contentHash.key); content != texturesByContent.end() && content->second.id == texture.id)
+				texturesByContent.erase(content);
+
+			if (entry.streamed.IsValid()) {
+				gfx->DestroyTexture(streamedTextures.at(entry.streamed.id).texture);
+				streamedTextures.erase(entry.streamed.id);
+				streamer->Unregister(entry.streamed);
+			} else {
+				gfx->DestroyTexture(texture);
 			}
+
+			cachedTextures.erase(it);
+			return;
 		}
 
-		const u32 uvChannelsCount = mesh.GetNumUVChannels();
-		//for (u32 channelIdx = 0; channelIdx < uvChannelsCount; channelIdx++) {
-			//if (!mesh.HasTextureCoords(channelIdx))
-				//continue;
+		// NOTE: still loading, the load drops its result once nobody waits for it anymore
+		for (auto& [key, load] : inFlightLoads) {
+			if (load->placeholder.id == texture.id) {
+				Assert(load->references > 0);
+				load->references--;
+				return;
+			}
+		}
+
+		Logger::Warn("[ResourceManager]: released a texture it doesn't own");
+	}
+
+	auto ResourceManager::ReleaseModel(const std::string& path) -> void {
+		const auto it = cachedModels.find(path);
+		if (it == cachedModels.end()) {
+			if (const auto load = inFlightLoads.find(MakeKey("model", path)); load != inFlightLoads.end() && load->second->references > 0) {
+				load->second->references--;
+				return;
+			}
+
+			Logger::Warn("[ResourceManager]: released a model that isn't loaded: " + path);
+			return;
+		}
 
-		for (u64 i = 0; i < mesh.mNumVertices; i++) {
-			if (mesh.mTextureCoords[0] == nullptr) {
-				vertices[i].uv[0] = Vec2{ 0.0f, 0.0f };
+		if (--it->second.refCount == 0)
+			cachedModels.erase(it);
+	}
+
+	auto ResourceManager::GetCacheStats() const -> AssetCacheStats {
+		auto stats = cacheStats;
+		stats.residentTextures = static_cast<u32>(cachedTextures.size());
+		stats.residentModels = static_cast<u32>(cachedModels.size());
+		for (const auto& [id, entry] : cachedTextures)
+			stats.residentBytes += entry.bytes;
+
+		return stats;
+	}
+
+	auto ResourceManager::CreatePlaceholder(TextureType type, std::array<u8, 4> color) -> TextureHandle {
+		Assert(gfx != nullptr);
+
+		const bool cube = type == TextureType::TextureCube;
+		const auto desc = TextureDesc{
+			.type = type,
+			.format = cube ? TextureFormat::RGBA16_FLOAT : TextureFormat::RGBA8_UNORM,
+			.width = 1,
+			.height = 1,
+			.arraySize = cube ? CubeFaceCount : 1u
+		};
+
+		// NOTE: cube maps are half floats like the loaded ones, the face data is shared
+		const u16 texel[4] = { FloatToHalf(color[0] / 255.0f), FloatToHalf(color[1] / 255.0f), FloatToHalf(color[2] / 255.0f), FloatToHalf(color[3] / 255.0f) };
+		SubresourceData data[CubeFaceCount];
+		for (auto& face : data)
+			face = SubresourceData{ .data = cube ? static_cast<const void*>(texel) : color.data(), .rowPitch = GetTexelSize(desc.format) };
+
+		return gfx->CreateTexture(desc, std::span{ data, desc.arraySize });
+	}
+
+	auto ResourceManager::LoadTextureAsync(const std::string& path, std::array<u8, 4> placeholder, TextureRole role) -> TextureHandle {
+		// NOTE: the same file cooked for another role is a different texture
+		const auto key = MakeKey(role == TextureRole::Raw ? "2d" : TextureCooker::GetRoleName(role), path);
+		if (const auto texture = FindTexture(key); texture.IsValid())
+			return texture;
+
+		// NOTE: the later callers get the first one's placeholder color
+		if (const auto it = inFlightLoads.find(key); it != inFlightLoads.end()) {
+			it->second->references++;
+			it->second->joins++;
+			cacheStats.pathHits++;
+			return it->second->placeholder;
+		}
+
+		auto load = new AsyncLoad{ .type = AsyncLoadType::Texture, .path = path, .key = key, .references = 1, .placeholder = CreatePlaceholder(TextureType::Texture2D, placeholder), .role = role, .streamed = streamer != nullptr };
+		const auto handle = load->placeholder;
+		Submit(load);
+
+		return handle;
+	}
+
+	auto ResourceManager::LoadCubeMapAsync(std::span<const std::string, 6> facePaths) -> TextureHandle {
+		const auto key = MakeCubeMapKey(facePaths);
+		if (const auto texture = FindTexture(key); texture.IsValid())
+			return texture;
+
+		if (const auto it = inFlightLoads.find(key); it != inFlightLoads.end()) {
+			it->second->references++;
+			it->second->joins++;
+			cacheStats.pathHits++;
+			return it->second->placeholder;
+		}
+
+		auto load = new AsyncLoad{ .type = AsyncLoadType::CubeMap, .path = facePaths[0], .key = key, .references = 1, .placeholder = CreatePlaceholder(TextureType::TextureCube, { 0, 0, 0, 255 }) };
+		std::copy(facePaths.begin(), facePaths.end(), load->facePaths.begin());
+		const auto handle = load->placeholder;
+		Submit(load);
+
+		return handle;
+	}
+
+	auto ResourceManager::LoadModelAsync(const std::string& path, ModelLoadedFn onLoaded) -> void {
+		// NOTE: nothing to decode, the callback still runs from ProcessCompletedLoads like for any other load
+		if (const auto it = cachedModels.find(path); it != cachedModels.end()) {
+			it->second.refCount++;
+			cacheStats.pathHits++;
+			pendingLoads.fetch_add(1);
+			loadStats.requested++;
+			finishQueue.push_back(new AsyncLoad{ .type = AsyncLoadType::Model, .path = path, .onLoaded = { std::move(onLoaded) } });
+			return;
+		}
+
+		const auto key = MakeKey("model", path);
+		if (const auto it = inFlightLoads.find(key); it != inFlightLoads.end()) {
+			it->second->references++;
+			it->second->onLoaded.push_back(std::move(onLoaded));
+			cacheStats.pathHits++;
+			return;
+		}
+
+		Submit(new AsyncLoad{ .type = AsyncLoadType::Model, .path = path, .key = key, .references = 1, .onLoaded = { std::move(onLoaded) } });
+	}
+
+	auto ResourceManager::Submit(AsyncLoad* load) -> void {
+		pendingLoads.fetch_add(1);
+		loadStats.requested++;
+		inFlightLoads[load->key] = load;
+
+		if (!QueueReads(*load))
+			StartDecode(load);
+	}
+
+	auto ResourceManager::QueueReads(AsyncLoad& load) -> bool {
+		// NOTE: an archived file is a span into the archive's mapping already, reading it again would only copy it
+		const auto paths = load.GetPaths();
+		if (load.type == AsyncLoadType::Model || std::ranges::any_of(paths, IsPackedAsset))
+			return false;
+
+		for (u32 i = 0; i < paths.size(); i++) {
+			auto& read = load.reads[i];
+			if (!fileReader.Open(paths[i].c_str(), read.file)) {
+				// NOTE: the reads queued for the other faces are still in flight, the load finishes with them
+				load.failed = true;
 				continue;
 			}
-			const auto& uv = mesh.mTextureCoords[0][i];
-			vertices[i].uv[0] = Vec2{ uv.x, uv.y };
+
+			read.size = read.file.GetSize();
+			read.bytes = std::make_unique_for_overwrite<u8[]>(read.size);
+			fileReader.QueueRead(read.file, 0, std::span{ read.bytes.get(), read.size }, reinterpret_cast<u64>(&load));
+			load.readsPending++;
 		}
-		//}
 
-		const u32 colorChannelsCount = mesh.GetNumColorChannels();
-		for (u32 i = 0; i < uvChannelsCount; i++) {
-			if (!mesh.HasVertexColors(i))
+		// NOTE: nothing was queued, the decode job reports the failure
+		return load.readsPending > 0;
+	}
+
+	auto ResourceManager::PumpReads() -> void {
+		readCompletions.clear();
+		fileReader.Poll(readCompletions);
+		for (const auto& completion : readCompletions) {
+			auto load = reinterpret_cast<AsyncLoad*>(completion.userData);
+			load->failed |= completion.failed;
+			if (--load->readsPending > 0)
 				continue;
 
-			for (u64 j = 0; j < mesh.mNumVertices; j++) {
-				const auto& color = mesh.mColors[i][j];
-				vertices[i].colors[j] = Vec4{ color.r, color.g, color.b, color.a };
+			for (auto& read : load->reads)
+				read.file.Close();
+			StartDecode(load);
+		}
+	}
+
+	auto ResourceManager::StartDecode(AsyncLoad* load) -> void {
+		JobSystem::Get().RunBackground([this, load]() {
+			Decode(*load);
+
+			AsyncLoad* head = completedLoads.load(std::memory_order_relaxed);
+			do {
+				load->next = head;
+			} while (!completedLoads.compare_exchange_weak(head, load, std::memory_order_release, std::memory_order_relaxed));
+		});
+	}
+
+	auto ResourceManager::Decode(AsyncLoad& load) -> void {
+		const auto start = std::chrono::steady_clock::now();
+		const auto readBytes = [&](u32 i) { return std::span<const u8>{ load.reads[i].bytes.get(), load.reads[i].size }; };
+		const bool read = load.reads[0].bytes != nullptr;
+
+		// NOTE: a file that couldn't be opened (the reader logged it) or read
+		if (load.failed) {
+			Logger::Error("Failed to load " + std::string(load.type == AsyncLoadType::CubeMap ? "cube map: " : "texture: ") + load.path);
+			load.reads = {};
+			return;
+		}
+
+		switch (load.type) {
+			case AsyncLoadType::Texture: {
+				if (load.role != TextureRole::Raw) {
+					load.failed = read ? !TextureCooker::LoadOrCook(load.path, readBytes(0), load.role, load.cooked, &load.cookStats)
+						: !TextureCooker::LoadOrCook(load.path, load.role, load.cooked, &load.cookStats);
+					if (load.failed) {
+						Logger::Error("Failed to load texture: " + load.path);
+						break;
+					}
+
+					load.contentHash = HashContent(load.cooked.desc, DescribeMips(load.cooked));
+					break;
+				}
+
+				load.failed = read ? !DecodeImage(readBytes(0), TextureFormat::RGBA8_UNORM, load.image, load.path) : !DecodeImage(load.path, TextureFormat::RGBA8_UNORM, load.image);
+				if (load.failed) {
+					Logger::Error("Failed to load texture: " + load.path);
+					break;
+				}
+
+				const auto data = SubresourceData{ .data = load.image.texels.Data(), .rowPitch = load.image.GetRowPitch() };
+				load.contentHash = HashContent(DescribeImage(load.image), std::span{ &data, 1 });
+				if (load.streamed) {
+					load.cooked.mips = TextureCooker::BuildMipChain(load.image.texels.Data(), load.image.width, load.image.height, TextureRole::Raw);
+					load.cooked.desc = DescribeImage(load.image);
+					load.cooked.desc.mipLevels = static_cast<u32>(load.cooked.mips.size());
+				}
+				break;
+			}
+			case AsyncLoadType::CubeMap: {
+				if (read) {
+					std::array<std::span<const u8>, CubeFaceCount> files;
+					for (u32 i = 0; i < CubeFaceCount; i++)
+						files[i] = readBytes(i);
+					load.failed = !DecodeCubeFaces(load.facePaths, files, TextureFormat::RGBA16_FLOAT, load.faces);
+				} else {
+					load.failed = !DecodeCubeFaces(load.facePaths, TextureFormat::RGBA16_FLOAT, load.faces);
+				}
+				if (load.failed)
+					break;
+
+				std::vector<SubresourceData> data;
+				const auto desc = DescribeCubeFaces(load.faces, data);
+				load.contentHash = HashContent(desc, data);
+				break;
 			}
+			case AsyncLoadType::Model:
+				load.failed = !ImportModel(load.path, load.model);
+				break;
+		}
+
+		load.reads = {};
+		load.decodeMilliseconds = std::chrono::duration<f64, std::milli>(std::chrono::steady_clock::now() - start).count();
+	}
+
+	auto ResourceManager::Finish(AsyncLoad& load, MaterialSystem& materials) -> void {
+		if (load.reload) {
+			FinishReload(load, materials);
+			return;
 		}
 
-		auto indices = std::vector<u32>(mesh.mNumFaces * 3);
-		for (u32 i = 0; i < mesh.mNumFaces; i++) {
-			aiFace face = mesh.mFaces[i];
-			Assert(face.mNumIndices == 3); // NOTE: mesh must be triangulated
-			for (u32 j = 0; j < 3; j++)
-				indices[(i * 3) + j] = face.mIndices[j];
+		if (!load.key.empty())
+			inFlightLoads.erase(load.key);
+
+		if (load.type == AsyncLoadType::Model) {
+			FinishModel(load);
+		} else if (load.references == 0) {
+			// NOTE: every caller released it while it was loading
+			gfx->DestroyTexture(load.placeholder);
+		} else if (!load.failed) {
+			TextureHandle texture;
+			if (load.streamed && !FindContent(load.contentHash).IsValid()) {
+				texture = AddStreamedTexture(load);
+			} else if (load.type == AsyncLoadType::Texture && load.role != TextureRole::Raw) {
+				const auto data = DescribeMips(load.cooked);
+				texture = AddTexture(load.cooked.desc, data, load.key, load.contentHash, load.references);
+			} else if (load.type == AsyncLoadType::Texture) {
+				const auto desc = DescribeImage(load.image);
+				const auto data = SubresourceData{ .data = load.image.texels.Data(), .rowPitch = load.image.GetRowPitch() };
+				texture = AddTexture(desc, std::span{ &data, 1 }, load.key, load.contentHash, load.references);
+			} else {
+				std::vector<SubresourceData> data;
+				const auto desc = DescribeCubeFaces(load.faces, data);
+				texture = AddTexture(desc, data, load.key, load.contentHash, load.references);
+			}
+
+			if (texture.IsValid()) {
+				materials.ReplaceTexture(*gfx, load.placeholder, texture);
+				cachedTextures.at(texture.id).aliases.push_back(load.placeholder);
+				aliasedTextures[load.placeholder.id] = texture;
+				cacheStats.bytesSaved += cachedTextures.at(texture.id).bytes * load.joins;
+				TrackSource(load.key, load.type, load.role, load.GetPaths());
+			}
 		}
 
-		// process materials
-		//aiMaterial* mat = scene->mMaterials[mesh.mMaterialIndex];
-		//mat->GetTexture(aiTextureType::)
-		//std::vector<Texture> textures;
+		// NOTE: a failed load keeps its placeholder, owned by the cache under no name so ReleaseTexture still works
+		if (load.type != AsyncLoadType::Model && load.failed && load.references > 0)
+			cachedTextures[load.placeholder.id] = CachedTexture{ .bytes = 0, .refCount = load.references };
+
+		// NOTE: back to the decoder's pool now rather than when the load is deleted
+		load.image = {};
+		load.faces = {};
 
-		return MeshData{ .v = vertices, .i = indices }; // textures
+		loadStats.completed++;
+		loadStats.failed += load.failed ? 1 : 0;
+		loadStats.decodeMilliseconds += load.decodeMilliseconds;
+		if (load.type == AsyncLoadType::Texture && load.role != TextureRole::Raw && !load.failed) {
+			loadStats.texturesCooked++;
+			loadStats.cookedCacheHits += load.cookStats.cached ? 1 : 0;
+			loadStats.uncompressedBytes += load.cookStats.uncompressedBytes;
+			loadStats.cookedBytes += load.cookStats.cookedBytes;
+		}
 	}
 
-	auto ResourceManager::ProcessNode(aiNode* node, const aiScene& scene, std::vector<MeshData>& submeshes) -> void {
-		if (submeshes.size() == 5) {
-			int x = 4;
+	auto ResourceManager::FinishModel(AsyncLoad& load) -> void {
+		if (load.failed)
+			return;
+
+		auto it = cachedModels.find(load.path);
+		if (load.key.empty()) {
+			// NOTE: answered from the cache when it was requested, the reference was taken then
+			Assert(it != cachedModels.end());
+		} else if (load.references == 0) {
+			return;
+		} else if (it == cachedModels.end()) {
+			it = cachedModels.emplace(load.path, CachedModel{ .model = std::make_unique<ImportedModel>(std::move(load.model)), .refCount = load.references }).first;
+			TrackSource(load.key, AsyncLoadType::Model, TextureRole::Raw, it->second.model->files);
+			cacheStats.misses++;
+		} else {
+			// NOTE: LoadModel read the same file while this one was decoding, the second copy is dropped
+			it->second.refCount += load.references;
 		}
-		for (u32 i = 0; i < node->mNumMeshes; i++) {
-			const aiMesh* submesh = scene.mMeshes[node->mMeshes[i]];
-			submeshes.push_back(ProcessMesh(*submesh, scene));
+
+		auto& model = *it->second.model;
+		for (const auto& onLoaded : load.onLoaded) {
+			if (onLoaded)
+				it->second.onLoaded.push_back(onLoaded);
 		}
+		for (const auto& onLoaded : load.onLoaded) {
+			if (onLoaded)
+				onLoaded(model);
+		}
+	}
 
-		for (u32 i = 0; i < node->mNumChildren; i++) {
-			ProcessNode(node->mChildren[i], scene, submeshes);
+	auto ResourceManager::EnableHotReload(const char* directory) -> bool {
+		return fileWatcher.Watch(directory);
+	}
+
+	auto ResourceManager::TrackSource(const std::string& key, AsyncLoadType type, TextureRole role, std::span<const std::string> paths) -> void {
+		if (!fileWatcher.IsWatching())
+			return;
+
+		assetSources[key] = AssetSource{ .type = type, .role = role, .paths = { paths.begin(), paths.end() } };
+		for (const auto& path : paths) {
+			auto& keys = dependentAssets[GetWatchedPath(path)];
+			if (std::find(keys.begin(), keys.end(), key) == keys.end())
+				keys.push_back(key);
 		}
 	}
 
-	auto ResourceManager::LoadModel(std::string path) -> std::vector<MeshData>* {
-		Assimp::Importer importer;
-		//const u32 flags = aiProcess_Triangulate | aiProcess_SortByPType | aiProcess_JoinIdenticalVertices |
-			//aiProcess_OptimizeMeshes | aiProcess_OptimizeGraph | aiProcess_ImproveCacheLocality;
-		const u32 flags = aiProcess_Triangulate |
-			aiProcess_JoinIdenticalVertices |
-			aiProcess_ConvertToLeftHanded |
-			aiProcess_GenNormals |
-			aiProcess_CalcTangentSpace;
-		const aiScene* scene = importer.ReadFile(path, flags); // aiProcess_FlipUVs aiProcess_JoinIdenticalVertices
-		if (scene == nullptr) {
-			Logger::Error(importer.GetErrorString());
-			return nullptr;
+	auto ResourceManager::PollHotReload() -> void {
+		fileChanges.clear();
+		if (fileWatcher.Poll(fileChanges) == 0)
+			return;
+
+		for (const auto& change : fileChanges) {
+			// NOTE: most changes are files nothing was loaded from, the cooked cache being written among them
+			const auto dependents = dependentAssets.find(GetWatchedPath(change.path));
+			if (dependents == dependentAssets.end())
+				continue;
+
+			hotReloadStats.changes++;
+			if (IsPackedAsset(change.path)) {
+				Logger::Warn("[HotReload]: " + change.path + " changed, but it's served from the mounted archive");
+				continue;
+			}
+
+			for (const auto& key : dependents->second)
+				Reload(key, change.firstSeen);
+		}
+	}
+
+	auto ResourceManager::Reload(const std::string& key, std::chrono::steady_clock::time_point changed) -> void {
+		// NOTE: one reload of an asset at a time, a file saved again meanwhile is read again once the first finished
+		if (const auto it = reloadingKeys.find(key); it != reloadingKeys.end()) {
+			it->second = true;
+			return;
+		}
+
+		const auto source = assetSources.find(key);
+		if (source == assetSources.end())
+			return;
+
+		const auto& [type, role, paths] = source->second;
+		// NOTE: released since, there is nothing to replace
+		if (type == AsyncLoadType::Model ? !cachedModels.contains(paths[0]) : !texturesByKey.contains(key))
+			return;
+
+		auto load = new AsyncLoad{ .type = type, .path = paths[0], .key = key, .role = role, .reload = true, .changed = changed };
+		if (type != AsyncLoadType::Model) {
+			load->streamed = cachedTextures.at(texturesByKey.at(key).id).streamed.IsValid();
+			if (type == AsyncLoadType::CubeMap)
+				std::copy(paths.begin(), paths.end(), load->facePaths.begin());
+		}
+
+		reloadingKeys[key] = false;
+		pendingLoads.fetch_add(1);
+		if (!QueueReads(*load))
+			StartDecode(load);
+	}
+
+	auto ResourceManager::FinishReload(AsyncLoad& load, MaterialSystem& materials) -> void {
+		const bool changedAgain = reloadingKeys.at(load.key);
+		reloadingKeys.erase(load.key);
+
+		bool swapped = false;
+		if (load.failed) {
+			// NOTE: the decoder logged why
+		} else if (load.type != AsyncLoadType::Model) {
+			swapped = SwapTexture(load, materials);
+		} else if (const auto it = cachedModels.find(load.path); it != cachedModels.end()) {
+			// NOTE: replaced in place, the pointers LoadModel handed out see the new model
+			auto& model = *it->second.model;
+			model = std::move(load.model);
+			TrackSource(load.key, AsyncLoadType::Model, TextureRole::Raw, model.files);
+
+			const auto callbacks = it->second.onLoaded; // NOTE: a callback may release the model
+			for (const auto& onLoaded : callbacks)
+				onLoaded(model);
+			swapped = true;
 		}
 
-		std::vector<MeshData>* submeshes = new std::vector<MeshData>();
-		ProcessNode(scene->mRootNode, *scene, *submeshes);
+		load.image = {};
+		load.faces = {};
+
+		if (swapped) {
+			hotReloadStats.reloads++;
+			hotReloadStats.lastMilliseconds = std::chrono::duration<f64, std::milli>(std::chrono::steady_clock::now() - load.changed).count();
+			Logger::Info("[HotReload]: reloaded " + load.key + ", " + std::to_string(hotReloadStats.lastMilliseconds) + " ms after the change");
+		} else if (load.failed) {
+			hotReloadStats.failed++;
+			Logger::Warn("[HotReload]: kept the previous " + load.key + ", the changed file didn't load");
+		}
+
+		// NOTE: what was read may be the file half written by the later save
+		if (changedAgain)
+			Reload(load.key, std::chrono::steady_clock::now());
+	}
+
+	auto ResourceManager::SwapTexture(AsyncLoad& load, MaterialSystem& materials) -> bool {
+		const auto it = texturesByKey.find(load.key);
+		if (it == texturesByKey.end())
+			return false;
+
+		// NOTE: the new texture is created before anything is touched, a failure keeps the old one everywhere
+		const auto handle = it->second;
+		auto& entry = cachedTextures.at(handle.id);
+		auto cacheHandle = handle;
+		if (entry.streamed.IsValid()) {
+			const auto& desc = load.cooked.desc;
+			const auto streamedHandle = streamer->Register(desc.width, desc.height, desc.mipLevels, desc.format);
+			auto streamed = StreamedTexture{ .width = desc.width, .height = desc.height, .format = desc.format, .mips = std::move(load.cooked.mips) };
+
+			// NOTE: starts over from the mip tail, the finer mips of the new data stream in as the texture is used
+			const u32 tailMip = streamer->GetTailMip(streamedHandle);
+			streamed.texture = CreateMipRange(streamed, tailMip);
+			if (!streamed.texture.IsValid()) {
+				streamer->Unregister(streamedHandle);
+				load.failed = true;
+				return false;
+			}
+
+			materials.ReplaceTexture(*gfx, handle, streamed.texture);
+			streamedTextures.erase(entry.streamed.id);
+			streamer->Unregister(entry.streamed);
+
+			entry.streamed = streamedHandle;
+			entry.bytes = 0;
+			for (u32 mip = tailMip; mip < streamed.mips.size(); mip++)
+				entry.bytes += streamed.mips[mip].size();
+			cacheHandle = streamed.texture;
+			streamedTextures[streamedHandle.id] = std::move(streamed);
+			ReplaceCachedTexture(handle, cacheHandle);
+		} else {
+			TextureDesc desc;
+			std::vector<SubresourceData> data;
+			if (load.type == AsyncLoadType::CubeMap) {
+				desc = DescribeCubeFaces(load.faces, data);
+			} else if (load.role != TextureRole::Raw) {
+				desc = load.cooked.desc;
+				data = DescribeMips(load.cooked);
+			} else {
+				desc = DescribeImage(load.image);
+				data.push_back(SubresourceData{ .data = load.image.texels.Data(), .rowPitch = load.image.GetRowPitch() });
+			}
+
+			const auto texture = gfx->CreateTexture(desc, data);
+			if (!texture.IsValid()) {
+				load.failed = true;
+				return false;
+			}
+
+			materials.ReplaceTexture(*gfx, handle, texture);
+			ReplaceCachedTexture(handle, texture).bytes = GetTextureBytes(desc);
+			cacheHandle = texture;
+		}
+
+		// NOTE: files that had the same pixels shared the texture, every one of them gets the new pixels
+		auto& cached = cachedTextures.at(cacheHandle.id);
+		if (const auto content = texturesByContent.find(cached.contentHash.key); content != texturesByContent.end() && content->second.id == cacheHandle.id)
+			texturesByContent.erase(content);
+		texturesByContent.try_emplace(load.contentHash.key, cacheHandle);
+		cached.contentHash = load.contentHash;
+
+		return true;
+	}
+
+	auto ResourceManager::ProcessCompletedLoads(MaterialSystem& materials, u32 maxUploads) -> u32 {
+		PollHotReload();
+		PumpReads();
+
+		// NOTE: the list comes out newest first, reversed so loads finish in the order they completed
+		const auto firstNew = finishQueue.size();
+		for (AsyncLoad* load = completedLoads.exchange(nullptr, std::memory_order_acquire); load != nullptr; load = load->next)
+			finishQueue.push_back(load);
+		std::reverse(finishQueue.begin() + firstNew, finishQueue.end());
+
+		if (finishQueue.empty())
+			return 0;
+
+		const auto start = std::chrono::steady_clock::now();
+		const u32 count = std::min(maxUploads, static_cast<u32>(finishQueue.size()));
+		for (u32 i = 0; i < count; i++) {
+			Finish(*finishQueue[i], materials);
+			delete finishQueue[i];
+		}
+
+		finishQueue.erase(finishQueue.begin(), finishQueue.begin() + count);
+		pendingLoads.fetch_sub(count, std::memory_order_release);
+		loadStats.uploadMilliseconds += std::chrono::duration<f64, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+		return count;
+	}
+
+	auto ResourceManager::Resolve(TextureHandle texture) const -> TextureHandle {
+		if (const auto it = aliasedTextures.find(texture.id); it != aliasedTextures.end())
+			texture = it->second;
+
+		return texture;
+	}
+
+	auto ResourceManager::EnableStreaming(const TextureStreamingDesc& desc) -> void {
+		Assert(streamer == nullptr);
+		streamer = std::make_unique<TextureStreamer>(desc);
+	}
+
+	auto ResourceManager::ReportTextureUse(TextureHandle texture, f32 screenPixels) -> void {
+		if (streamer == nullptr)
+			return;
+
+		// NOTE: placeholders aren't in the cache yet, nothing to stream until the load finished
+		if (const auto it = aliasedTextures.find(texture.id); it != aliasedTextures.end())
+			texture = it->second;
+
+		const auto it = cachedTextures.find(texture.id);
+		if (it == cachedTextures.end() || !it->second.streamed.IsValid())
+			return;
+
+		const auto& streamed = streamedTextures.at(it->second.streamed.id);
+		streamer->RequestMip(it->second.streamed, ComputeStreamingMip(std::max(streamed.width, streamed.height), screenPixels));
+	}
+
+	auto ResourceManager::UpdateStreaming(MaterialSystem& materials) -> void {
+		if (streamer == nullptr)
+			return;
+
+		// NOTE: the source is in memory, so a fetch is carried out right away and the per frame byte limit of the
+		// streamer is what bounds the upload work of a frame
+		for (const auto& request : streamer->Update()) {
+			auto& streamed = streamedTextures.at(request.texture.id);
+			const auto texture = CreateMipRange(streamed, request.mip);
+			if (request.action == StreamingAction::Fetch)
+				streamer->CompleteFetch(request.texture, texture.IsValid());
+
+			if (!texture.IsValid()) {
+				Logger::Warn("[ResourceManager]: couldn't recreate a streamed texture with mip " + std::to_string(request.mip));
+				continue;
+			}
+
+			// NOTE: the entry moves to the new texture, the old one goes unless a Load call returned it
+			materials.ReplaceTexture(*gfx, streamed.texture, texture);
+			const auto previous = streamed.texture;
+			streamed.texture = texture;
+
+			auto& entry = ReplaceCachedTexture(previous, texture);
+			entry.bytes = 0;
+			for (u32 mip = request.mip; mip < streamed.mips.size(); mip++)
+				entry.bytes += streamed.mips[mip].size();
+		}
+	}
+
+	auto ResourceManager::GetStreamingStats() const -> TextureStreamingStats {
+		return streamer != nullptr ? streamer->GetStats() : TextureStreamingStats{};
+	}
+
+	auto ResourceManager::AddStreamedTexture(AsyncLoad& load) -> TextureHandle {
+		const auto& cookedDesc = load.cooked.desc;
+		const auto handle = streamer->Register(cookedDesc.width, cookedDesc.height, cookedDesc.mipLevels, cookedDesc.format);
+		auto streamed = StreamedTexture{ .width = cookedDesc.width, .height = cookedDesc.height, .format = cookedDesc.format, .mips = std::move(load.cooked.mips) };
+
+		const u32 tailMip = streamer->GetTailMip(handle);
+		const auto texture = CreateMipRange(streamed, tailMip);
+		if (!texture.IsValid()) {
+			streamer->Unregister(handle);
+			return {};
+		}
+
+		auto desc = cookedDesc;
+		desc.width = std::max(desc.width >> tailMip, 1u);
+		desc.height = std::max(desc.height >> tailMip, 1u);
+		desc.mipLevels = static_cast<u32>(streamed.mips.size()) - tailMip;
+
+		auto& entry = RegisterTexture(texture, desc, load.key, load.contentHash, load.references);
+		entry.streamed = handle;
+		streamed.texture = texture;
+		streamedTextures[handle.id] = std::move(streamed);
+
+		return texture;
+	}
+
+	auto ResourceManager::CreateMipRange(const StreamedTexture& streamed, u32 firstMip) -> TextureHandle {
+		const auto desc = TextureDesc{
+			.type = TextureType::Texture2D,
+			.format = streamed.format,
+			.width = std::max(streamed.width >> firstMip, 1u),
+			.height = std::max(streamed.height >> firstMip, 1u),
+			.mipLevels = static_cast<u32>(streamed.mips.size()) - firstMip
+		};
+
+		std::vector<SubresourceData> data;
+		data.reserve(desc.mipLevels);
+		for (u32 mip = firstMip; mip < streamed.mips.size(); mip++)
+			data.push_back(SubresourceData{ .data = streamed.mips[mip].data(), .rowPitch = GetRowPitch(desc.format, std::max(streamed.width >> mip, 1u)) });
 
-		return submeshes;
+		return gfx->CreateTexture(desc, data);
 	}
 }
\ No newline at end of file
@@ -1,5 +1,14 @@
 #pragma once
-#include "Renderer/DX11Layer.h"
+#include "Renderer/RendererPlatformInterface.h"
+#include "Renderer/PipelineCache.h"
+#include "Renderer/CubemapImage.h"
+#include "Renderer/EquirectConversion.h"
+#include "Renderer/ImageDecoder.h"
+#include "Renderer/MaterialSystem.h"
+#include "Renderer/TextureCooker.h"
+#include "Renderer/TextureStreaming.h"
+#include "AsyncFileIO.h"
+#include "FileWatcher.h"
 #include "Mesh.h"
 #include "stb/stb_image.h"
 
@@ -8,6 +17,13 @@
 #include "assimp/postprocess.h"
 //#include "assimp/material.h"
 
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <unordered_map>
+
 namespace Nickel::Renderer {
 	//struct Texture {
 		//unsigned int id;
@@ -15,6 +31,52 @@ namespace Nickel::Renderer {
 		//std::string path;  // we store the path of the texture to compare with other textures
 	//};
 
+	// NOTE: runs on the render thread once the model is imported, creates the GPU meshes straight from its arena. Not
+	// called on failure. The model lives in the model cache, it's shared with every other load of the same file. Runs
+	// again with the new model each time hot reload re-imports the file, the meshes it created before are still alive
+	using ModelLoadedFn = std::function<void(const ImportedModel& model)>;
+
+	struct AsyncLoadStats {
+		u32 requested;
+		u32 completed; // NOTE: uploaded, failures included
+		u32 failed;
+		f64 decodeMilliseconds; // NOTE: summed over the decode jobs, the wall clock time is lower with several workers
+		f64 uploadMilliseconds; // NOTE: render thread time spent in ProcessCompletedLoads
+		u32 texturesCooked; // NOTE: textures loaded with a role, compressed on a worker or read from the texture cache
+		u32 cookedCacheHits;
+		u64 uncompressedBytes; // NOTE: what those textures take as RGBA8 with mips
+		u64 cookedBytes;
+	};
+
+	struct AssetCacheStats {
+		u32 pathHits; // NOTE: loads of a file that's resident or already loading, nothing is read
+		u32 contentHits; // NOTE: decoded data identical to a resident texture from another file, the upload is skipped
+		u32 misses;
+		u32 residentTextures;
+		u32 residentModels;
+		u64 residentBytes;
+		u64 bytesSaved; // NOTE: texture memory not allocated thanks to both kinds of hits
+	};
+
+	struct HotReloadStats {
+		u32 changes; // NOTE: changed files some loaded asset was read from
+		u32 reloads; // NOTE: assets swapped in
+		u32 failed; // NOTE: the changed file didn't load, the old asset stayed
+		f64 lastMilliseconds; // NOTE: from the first write of the last change to the swap
+	};
+
+	// NOTE: two independent 64 bit hashes of a texture's layout and texels. 'key' finds the resident texture, 'check'
+	// has to match as well before it's shared
+	struct TextureContentHash {
+		u64 key;
+		u64 check;
+
+		auto operator==(const TextureContentHash&) const -> bool = default;
+	};
+
+	// Loaded assets are cached: a texture is keyed by its file (and how it was loaded) and by a hash of its decoded
+	// data, so loading the same file twice or two files with the same pixels yields one texture. Every Load call adds a
+	// reference that ReleaseTexture / ReleaseModel gives back, the asset is destroyed with the last one.
 	class ResourceManager {
 	private:
 		static ResourceManager* resourceManager;
@@ -25,16 +87,65 @@ namespace Nickel::Renderer {
 		auto operator=(const ResourceManager&) -> void = delete;
 
 		static auto GetInstance() -> ResourceManager*;
-		auto Init(ID3D11Device1* _device) -> void;
+		auto Init(const PlatformInterface& _gfx, PipelineCache& pipelineCache) -> void;
 		
-		// NOTE: supports BMP, JPEG, PNG, TIFF, GIF
-		auto LoadTexture(std::wstring path)->DXLayer::TextureDX11;
+		// NOTE: supports JPEG, PNG, TGA, BMP, PSD, GIF, HDR, PIC - always loaded as RGBA8
+		auto LoadTexture(const std::string& path)->TextureHandle;
+		// NOTE: faces in +X, -X, +Y, -Y, +Z, -Z order, uploaded as RGBA16F
+		auto LoadCubeMap(std::span<const std::string, 6> facePaths)->TextureHandle;
+		auto LoadCubeMapImage(std::span<const std::string, 6> facePaths)->CubemapImage; // NOTE: RGBA32F kept on the CPU, invalid when a face fails to load
+		auto CreateCubeMap(const CubemapImage& image)->TextureHandle;
+		auto CreateCubeMap(std::span<const CubemapImage> mips)->TextureHandle; // NOTE: mip 0 first, every mip half the size of the one before
+		// NOTE: a single latitude/longitude panorama instead of six faces, converted on load with a full mip chain
+		auto LoadEquirectCubeMap(const std::string& path, const EquirectConversionDesc& desc = {})->TextureHandle;
+		auto LoadEquirectImage(const std::string& path)->EquirectImage; // NOTE: RGBA32F, LDR files are converted to linear. Invalid on failure
 		auto LoadImageData(std::string path)->LoadedImageData;
 		auto LoadHDRImageData(std::string path)->LoadedImageData;
-		auto ProcessMesh(const aiMesh& mesh, const aiScene& scene)->MeshData;
-		auto ProcessNode(aiNode* node, const aiScene& scene, std::vector<MeshData>& submeshes) -> void;
-		auto LoadModel(std::string path)->std::vector<MeshData>*;
-		auto GetDefaultSamplerState()->ID3D11SamplerState*;
+		auto LoadModel(std::string path)->const ImportedModel*; // NOTE: owned by the cache, valid until ReleaseModel
+		// NOTE: uncached, any thread. Auto reads glTF natively and falls back to assimp for what the native loader
+		// doesn't support, Native fails on those instead
+		auto ImportModel(const std::string& path, ImportedModel& model, ModelImporter importer = ModelImporter::Auto) -> bool;
+		auto GetDefaultSampler()->SamplerHandle;
+
+		auto ReleaseTexture(TextureHandle texture) -> void; // NOTE: a loaded texture or a placeholder, resolved first
+		auto ReleaseModel(const std::string& path) -> void;
+		auto GetCacheStats() const -> AssetCacheStats;
+
+		// Asynchronous loads return right away and decode on the job system. Textures hand out a 1x1 placeholder of
+		// the given color (RGBA8) that materials bind meanwhile, ProcessCompletedLoads uploads the decoded data on the
+		// render thread and swaps it into every material. The placeholder stays alive until the texture's last release,
+		// its handle names the loaded texture for ReleaseTexture and Resolve. Failed loads keep the placeholder.
+		// Loading a file that's already loading hands out the same placeholder. Render thread only.
+		// Texture files that aren't in a mounted archive are read before the decode job runs, every read requested
+		// since the last ProcessCompletedLoads goes to the OS in one batch (io_uring, a completion port) and a file's
+		// decode starts in the ProcessCompletedLoads that sees its reads complete. No worker blocks on the disk.
+		// NOTE: a role other than Raw loads the texture cooked, block compressed with mips, see TextureCooker
+		auto LoadTextureAsync(const std::string& path, std::array<u8, 4> placeholder = { 255, 255, 255, 255 }, TextureRole role = TextureRole::Raw)->TextureHandle;
+		auto LoadCubeMapAsync(std::span<const std::string, 6> facePaths)->TextureHandle; // NOTE: black placeholder
+		auto LoadModelAsync(const std::string& path, ModelLoadedFn onLoaded) -> void;
+		// NOTE: render thread, once per frame before recording. Returns the number of loads finished
+		auto ProcessCompletedLoads(MaterialSystem& materials, u32 maxUploads = ~0u) -> u32;
+		auto Resolve(TextureHandle texture) const -> TextureHandle; // NOTE: the current texture for a placeholder or a streamed texture
+		inline auto GetPendingLoadCount() const -> u32 { return pendingLoads.load(std::memory_order_acquire); }
+		inline auto GetLoadStats() const -> const AsyncLoadStats& { return loadStats; }
+		inline auto GetFileReader() const -> const AsyncFileReader& { return fileReader; }
+
+		// Streaming: once enabled, asynchronously loaded 2D textures come up with their mip tail only and get finer
+		// mips as ReportTextureUse asks for them, within the budget. Every change recreates the texture with the new
+		// mip range and swaps it into the materials, so code binding a handle directly has to Resolve it each frame.
+		// The full mip chain is kept in system memory as the source, JPEG and PNG can't be read one mip at a time.
+		auto EnableStreaming(const TextureStreamingDesc& desc) -> void; // NOTE: before the loads that should stream
+		auto ReportTextureUse(TextureHandle texture, f32 screenPixels) -> void; // NOTE: pixels the texture's width covers on screen
+		auto UpdateStreaming(MaterialSystem& materials) -> void; // NOTE: render thread, once per frame after the uses are reported
+		auto GetStreamingStats() const -> TextureStreamingStats;
+
+		// Hot reload: once enabled, a file changed under the watched directory is mapped to the assets loaded from it
+		// and only those are decoded, cooked or imported again, on the job system like any asynchronous load.
+		// ProcessCompletedLoads swaps them in at the start of a frame, a texture behind every handle and material
+		// that had the old one, a model by running its ModelLoadedFn again. A mounted archive shadows the loose
+		// files, what it serves isn't reloaded.
+		auto EnableHotReload(const char* directory) -> bool; // NOTE: before the loads it should cover
+		inline auto GetHotReloadStats() const -> const HotReloadStats& { return hotReloadStats; }
 
 		/*
 		inline std::vector<Texture> loadMaterialTextures(aiMaterial* mat, aiTextureType type, std::string typeName) {
@@ -53,7 +164,137 @@ namespace Nickel::Renderer {
 		*/
 
 	private:
-		ID3D11Device1* device;
-		std::vector<DXLayer::TextureDX11> loadedTextures = std::vector<DXLayer::TextureDX11>();
+		enum class AsyncLoadType : u8 {
+			Texture,
+			CubeMap,
+			Model
+		};
+
+		// NOTE: a texture file read ahead of its decode
+		struct FileRead {
+			AsyncFile file; // NOTE: closed once read
+			std::unique_ptr<u8[]> bytes;
+			u64 size;
+		};
+
+		// NOTE: one request from the call to its upload. Decode jobs push it onto 'completedLoads', a lock free list
+		// only the render thread takes from, all at once, so there's no ABA
+		struct AsyncLoad {
+			AsyncLoadType type;
+			std::string path;
+			std::string key; // NOTE: cache key, empty for model loads answered from the cache
+			u32 references; // NOTE: Load calls waiting for this one, render thread only
+			u32 joins; // NOTE: Load calls of the same file while it was loading
+			std::array<std::string, CubeFaceCount> facePaths;
+			std::array<FileRead, CubeFaceCount> reads; // NOTE: empty when the decode job reads through ReadAsset itself
+			u32 readsPending; // NOTE: render thread only
+			TextureHandle placeholder;
+			TextureRole role;
+			DecodedImage image; // NOTE: RGBA8, back to the decoder's pool after the upload
+			std::array<DecodedImage, CubeFaceCount> faces; // NOTE: RGBA16F
+			ImportedModel model;
+			TextureCooker::CookedTexture cooked; // NOTE: the whole chain of a cooked or streamed texture
+			TextureCooker::CookStats cookStats;
+			std::vector<ModelLoadedFn> onLoaded;
+			TextureContentHash contentHash; // NOTE: hashed on the worker
+			f64 decodeMilliseconds;
+			bool streamed;
+			bool failed;
+			bool reload; // NOTE: replaces the resident asset of 'key' instead of adding one
+			std::chrono::steady_clock::time_point changed; // NOTE: reloads only, the first write of the file
+			AsyncLoad* next;
+
+			inline auto GetPaths() const -> std::span<const std::string> {
+				return type == AsyncLoadType::CubeMap ? std::span<const std::string>(facePaths) : std::span<const std::string>(&path, 1);
+			}
+		};
+
+		// NOTE: what reloading an asset reads and how
+		struct AssetSource {
+			AsyncLoadType type;
+			TextureRole role;
+			std::vector<std::string> paths; // NOTE: the model's own file first, then its buffers
+		};
+
+		struct CachedTexture {
+			std::vector<std::string> keys; // NOTE: every file that resolved to this texture
+			TextureContentHash contentHash;
+			u64 bytes;
+			u32 refCount;
+			StreamedTextureHandle streamed; // NOTE: the entry moves to every new mip range, see StreamedTexture
+			// NOTE: handles given out that aren't the texture anymore, placeholders and the textures a hot reload
+			// replaced. Alive until the entry goes so the pool can't give their ids to another texture meanwhile
+			std::vector<TextureHandle> aliases;
+			bool handedOut; // NOTE: a Load call returned the texture itself, it becomes an alias once replaced
+		};
+
+		// NOTE: 'texture' is the current mip range. The cache entry is keyed by it like any other texture and moves
+		// with it, so a hit never hands out a texture streaming already destroyed
+		struct StreamedTexture {
+			TextureHandle texture;
+			u32 width;
+			u32 height;
+			TextureFormat format;
+			std::vector<std::vector<u8>> mips;
+		};
+
+		struct CachedModel {
+			std::unique_ptr<ImportedModel> model;
+			u32 refCount;
+			std::vector<ModelLoadedFn> onLoaded; // NOTE: every callback the model was loaded with, run again on a reload
+		};
+
+		auto FindTexture(const std::string& key) -> TextureHandle; // NOTE: adds a reference on a hit
+		auto HandOut(TextureHandle texture) -> TextureHandle; // NOTE: marks a texture returned to a caller
+		// NOTE: the resident texture with the same content if there is one, 'key' then becomes another name of it
+		auto AddTexture(const TextureDesc& desc, std::span<const SubresourceData> data, const std::string& key, const TextureContentHash& contentHash, u32 references) -> TextureHandle;
+		auto RegisterTexture(TextureHandle texture, const TextureDesc& desc, const std::string& key, const TextureContentHash& contentHash, u32 references) -> CachedTexture&;
+		auto FindContent(const TextureContentHash& contentHash) const -> TextureHandle; // NOTE: invalid unless both hashes match
+		// NOTE: moves the entry of 'from' to 'to' (a reload or a new mip range), destroys 'from' unless it was handed
+		// out, then it becomes an alias. The materials are the caller's
+		auto ReplaceCachedTexture(TextureHandle from, TextureHandle to) -> CachedTexture&;
+		auto AddStreamedTexture(AsyncLoad& load) -> TextureHandle;
+		auto CreateMipRange(const StreamedTexture& streamed, u32 firstMip) -> TextureHandle; // NOTE: mips [firstMip, count)
+		auto CreatePlaceholder(TextureType type, std::array<u8, 4> color) -> TextureHandle;
+		auto Submit(AsyncLoad* load) -> void;
+		auto QueueReads(AsyncLoad& load) -> bool; // NOTE: false when the decode job has to read, models and archived files
+		auto StartDecode(AsyncLoad* load) -> void;
+		auto PumpReads() -> void; // NOTE: submits the queued reads, starts the decode of loads whose files are read
+		auto Decode(AsyncLoad& load) -> void; // NOTE: worker thread, touches nothing but the load
+		auto Finish(AsyncLoad& load, MaterialSystem& materials) -> void;
+		auto FinishModel(AsyncLoad& load) -> void; // NOTE: caches the model and runs the callbacks
+		auto TrackSource(const std::string& key, AsyncLoadType type, TextureRole role, std::span<const std::string> paths) -> void;
+		auto PollHotReload() -> void; // NOTE: starts the reloads of the assets read from the files that changed
+		auto Reload(const std::string& key, std::chrono::steady_clock::time_point changed) -> void;
+		auto FinishReload(AsyncLoad& load, MaterialSystem& materials) -> void;
+		auto SwapTexture(AsyncLoad& load, MaterialSystem& materials) -> bool; // NOTE: false when the texture was released meanwhile or failed
+
+		const PlatformInterface* gfx = nullptr;
+		SamplerHandle defaultSampler;
+
+		std::unordered_map<std::string, TextureHandle> texturesByKey;
+		std::unordered_map<u64, TextureHandle> texturesByContent; // NOTE: by TextureContentHash::key
+		std::unordered_map<u32, CachedTexture> cachedTextures; // NOTE: texture id to its entry
+		std::unordered_map<std::string, CachedModel> cachedModels;
+		std::unordered_map<std::string, AsyncLoad*> inFlightLoads; // NOTE: cache key to the load that decodes it
+		AssetCacheStats cacheStats{};
+
+		std::atomic<AsyncLoad*> completedLoads = nullptr;
+		std::vector<AsyncLoad*> finishQueue; // NOTE: render thread only, taken from completedLoads in completion order
+		std::atomic<u32> pendingLoads = 0;
+		std::unordered_map<u32, TextureHandle> aliasedTextures; // NOTE: alias id to the texture, see CachedTexture::aliases
+		AsyncLoadStats loadStats{};
+		AsyncFileReader fileReader;
+		std::vector<IoCompletion> readCompletions;
+
+		std::unique_ptr<TextureStreamer> streamer;
+		std::unordered_map<u32, StreamedTexture> streamedTextures; // NOTE: streamed handle id to its data
+
+		FileWatcher fileWatcher;
+		std::vector<FileChange> fileChanges;
+		std::unordered_map<std::string, std::vector<std::string>> dependentAssets; // NOTE: normalized file path to the keys of the assets read from it
+		std::unordered_map<std::string, AssetSource> assetSources; // NOTE: cache key ("model:" and the path for models) to its files
+		std::unordered_map<std::string, bool> reloadingKeys; // NOTE: to whether the file changed again while it was reloading
+		HotReloadStats hotReloadStats{};
 	};
 }
\ No newline at end of file
@@ -1,19 +1,25 @@
 #include "ShaderProgram.h"
+#include <bit>
 
 namespace Nickel::Renderer::DXLayer {
 	// auto CreateInputLayout(ID3D11Device1* device, std::span<D3D11_INPUT_ELEMENT_DESC> vertexLayoutDesc, std::span<const u8> shaderBytecodeWithInputSignature) -> ID3D11InputLayout*;
 
-	auto ShaderProgram::Create(ID3D11Device1* device, std::span<const u8> vertexShaderBytecode, std::span<const u8> pixelShaderBytecode) -> void {
+	auto ShaderProgram::Create(ID3D11Device1* device, std::span<const u8> vertexShaderBytecode, std::span<const u8> pixelShaderBytecode, std::span<const ShaderInputElement> inputSignature) -> void {
 		Assert(vertexShaderBytecode.data() != nullptr);
 		Assert(pixelShaderBytecode.data() != nullptr);
 
-		//inputLayout = CreateInputLayout(device, vertexLayoutDesc, vertexShaderBytecode);
-		inputLayout = CreateInputLayoutFromBytecode(device, vertexShaderBytecode);
+		inputLayout = inputSignature.empty() ? CreateInputLayoutFromBytecode(device, vertexShaderBytecode) : CreateInputLayout(device, inputSignature, vertexShaderBytecode);
 		CreateShaderFromBytecode(device, vertexShader, vertexShaderBytecode);
 		CreateShaderFromBytecode(device, pixelShader, pixelShaderBytecode);
 	}
 
-	auto ShaderProgram::Bind(ID3D11DeviceContext1* ctx) -> void {
+	auto ShaderProgram::Release() -> void {
+		SafeRelease(inputLayout);
+		SafeRelease(vertexShader);
+		SafeRelease(pixelShader);
+	}
+
+	auto ShaderProgram::Bind(ID3D11DeviceContext1* ctx) const -> void {
 		Assert(ctx != nullptr);
 
 		auto bindShader = [&](auto& arg) {
@@ -46,58 +52,72 @@ namespace Nickel::Renderer::DXLayer {
 			//bindShader(s);
 	}
 
-	auto ShaderProgram::Unbind(ID3D11DeviceContext1* ctx) -> void {
+	auto ShaderProgram::Unbind(ID3D11DeviceContext1* ctx) const -> void {
 		ctx->VSSetShader(nullptr, nullptr, 0);
 		ctx->PSSetShader(nullptr, nullptr, 0);
 	}
 
-	auto ShaderProgram::CreateInputLayoutFromBytecode(ID3D11Device1* device, std::span<const u8> vertexShaderBytecode) -> ID3D11InputLayout* {
-		Microsoft::WRL::ComPtr<ID3D11ShaderReflection> vertexShaderReflection = nullptr;
-		ASSERT_ERROR_RESULT(D3DReflect(vertexShaderBytecode.data(), vertexShaderBytecode.size(), IID_ID3D11ShaderReflection, (void**)vertexShaderReflection.GetAddressOf()));
+	auto ShaderProgram::CreateInputLayout(ID3D11Device1* device, std::span<const ShaderInputElement> inputSignature, std::span<const u8> vertexShaderBytecode) -> ID3D11InputLayout* {
+		constexpr DXGI_FORMAT formats[3][4] = {
+			{ DXGI_FORMAT_R32_UINT,  DXGI_FORMAT_R32G32_UINT,  DXGI_FORMAT_R32G32B32_UINT,  DXGI_FORMAT_R32G32B32A32_UINT },
+			{ DXGI_FORMAT_R32_SINT,  DXGI_FORMAT_R32G32_SINT,  DXGI_FORMAT_R32G32B32_SINT,  DXGI_FORMAT_R32G32B32A32_SINT },
+			{ DXGI_FORMAT_R32_FLOAT, DXGI_FORMAT_R32G32_FLOAT, DXGI_FORMAT_R32G32B32_FLOAT, DXGI_FORMAT_R32G32B32A32_FLOAT }
+		};
 
-		D3D11_SHADER_DESC shaderDesc;
-		ASSERT_ERROR_RESULT(vertexShaderReflection->GetDesc(&shaderDesc));
+		// NOTE: shaders that fetch everything through SV_VertexID/SV_InstanceID run without a layout
+		if (inputSignature.empty())
+			return nullptr;
 
-		std::vector<D3D11_INPUT_ELEMENT_DESC> inputLayoutDesc;
-		for (uint32_t i = 0; i < shaderDesc.InputParameters; i++) {
-			D3D11_SIGNATURE_PARAMETER_DESC paramDesc;
-			vertexShaderReflection->GetInputParameterDesc(i, &paramDesc);
+		D3D11_INPUT_ELEMENT_DESC inputLayoutDesc[D3D11_IA_VERTEX_INPUT_STRUCTURE_ELEMENT_COUNT];
+		Assert(inputSignature.size() <= ArrayCount(inputLayoutDesc));
+		for (u32 i = 0; i < inputSignature.size(); i++) {
+			const auto& element = inputSignature[i];
+			Assert(element.componentCount >= 1 && element.componentCount <= 4);
 
-			// fill out input element desc
-			auto elementDesc = D3D11_INPUT_ELEMENT_DESC{
-				.SemanticName = paramDesc.SemanticName,
-				.SemanticIndex = paramDesc.SemanticIndex,
+			inputLayoutDesc[i] = D3D11_INPUT_ELEMENT_DESC{
+				.SemanticName = element.semanticName,
+				.SemanticIndex = element.semanticIndex,
+				.Format = formats[static_cast<u32>(element.componentType)][element.componentCount - 1],
 				.InputSlot = 0,
 				.AlignedByteOffset = D3D11_APPEND_ALIGNED_ELEMENT,
 				.InputSlotClass = D3D11_INPUT_PER_VERTEX_DATA,
 				.InstanceDataStepRate = 0
 			};
-
-			// determine DXGI format
-			if (paramDesc.Mask == 1) { // offset += 4
-				if (paramDesc.ComponentType == D3D_REGISTER_COMPONENT_UINT32) elementDesc.Format = DXGI_FORMAT_R32_UINT;
-				else if (paramDesc.ComponentType == D3D_REGISTER_COMPONENT_SINT32) elementDesc.Format = DXGI_FORMAT_R32_SINT;
-				else if (paramDesc.ComponentType == D3D_REGISTER_COMPONENT_FLOAT32) elementDesc.Format = DXGI_FORMAT_R32_FLOAT;
-			} else if (paramDesc.Mask <= 3) { // offset += 8
-				if (paramDesc.ComponentType == D3D_REGISTER_COMPONENT_UINT32) elementDesc.Format = DXGI_FORMAT_R32G32_UINT;
-				else if (paramDesc.ComponentType == D3D_REGISTER_COMPONENT_SINT32) elementDesc.Format = DXGI_FORMAT_R32G32_SINT;
-				else if (paramDesc.ComponentType == D3D_REGISTER_COMPONENT_FLOAT32) elementDesc.Format = DXGI_FORMAT_R32G32_FLOAT;
-			} else if (paramDesc.Mask <= 7) { // offset += 12
-				if (paramDesc.ComponentType == D3D_REGISTER_COMPONENT_UINT32) elementDesc.Format = DXGI_FORMAT_R32G32B32_UINT;
-				else if (paramDesc.ComponentType == D3D_REGISTER_COMPONENT_SINT32) elementDesc.Format = DXGI_FORMAT_R32G32B32_SINT;
-				else if (paramDesc.ComponentType == D3D_REGISTER_COMPONENT_FLOAT32) elementDesc.Format = DXGI_FORMAT_R32G32B32_FLOAT;
-			} else if (paramDesc.Mask <= 15) { // offset += 16
-				if (paramDesc.ComponentType == D3D_REGISTER_COMPONENT_UINT32) elementDesc.Format = DXGI_FORMAT_R32G32B32A32_UINT;
-				else if (paramDesc.ComponentType == D3D_REGISTER_COMPONENT_SINT32) elementDesc.Format = DXGI_FORMAT_R32G32B32A32_SINT;
-				else if (paramDesc.ComponentType == D3D_REGISTER_COMPONENT_FLOAT32) elementDesc.Format = DXGI_FORMAT_R32G32B32A32_FLOAT;
-			}
-
-			inputLayoutDesc.push_back(elementDesc);
 		}
 
 		ID3D11InputLayout* inputLayout;
-		ASSERT_ERROR_RESULT(device->CreateInputLayout(inputLayoutDesc.data(), static_cast<UINT>(inputLayoutDesc.size()), vertexShaderBytecode.data(), vertexShaderBytecode.size_bytes(), &inputLayout));
+		ASSERT_ERROR_RESULT(device->CreateInputLayout(inputLayoutDesc, static_cast<UINT>(inputSignature.size()), vertexShaderBytecode.data(), vertexShaderBytecode.size_bytes(), &inputLayout));
 
 		return inputLayout;
 	}
+
+	// NOTE: only for bytecode that didn't come out of the shader archive, the cooker extracted the signature for everything else
+	auto ShaderProgram::CreateInputLayoutFromBytecode(ID3D11Device1* device, std::span<const u8> vertexShaderBytecode) -> ID3D11InputLayout* {
+		Microsoft::WRL::ComPtr<ID3D11ShaderReflection> vertexShaderReflection = nullptr;
+		ASSERT_ERROR_RESULT(D3DReflect(vertexShaderBytecode.data(), vertexShaderBytecode.size(), IID_ID3D11ShaderReflection, (void**)vertexShaderReflection.GetAddressOf()));
+
+		D3D11_SHADER_DESC shaderDesc;
+		ASSERT_ERROR_RESULT(vertexShaderReflection->GetDesc(&shaderDesc));
+
+		std::vector<ShaderInputElement> inputSignature;
+		for (uint32_t i = 0; i < shaderDesc.InputParameters; i++) {
+			D3D11_SIGNATURE_PARAMETER_DESC paramDesc;
+			vertexShaderReflection->GetInputParameterDesc(i, &paramDesc);
+			if (paramDesc.SystemValueType != D3D_NAME_UNDEFINED)
+				continue; // NOTE: SV_VertexID and friends aren't fed by the layout
+
+			auto componentType = ShaderComponentType::Float32;
+			if (paramDesc.ComponentType == D3D_REGISTER_COMPONENT_UINT32) componentType = ShaderComponentType::Uint32;
+			else if (paramDesc.ComponentType == D3D_REGISTER_COMPONENT_SINT32) componentType = ShaderComponentType::Sint32;
+
+			inputSignature.push_back(ShaderInputElement{
+				.semanticName = paramDesc.SemanticName,
+				.semanticIndex = paramDesc.SemanticIndex,
+				.componentType = componentType,
+				.componentCount = static_cast<u32>(std::bit_width(static_cast<u32>(paramDesc.Mask & 0xF)))
+			});
+		}
+
+		return CreateInputLayout(device, inputSignature, vertexShaderBytecode);
+	}
 }
\ No newline at end of file
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Renderer/DirectXIncludes.h"
+#include "Renderer/RendererTypes.h"
 #include <variant>
 
 namespace Nickel::Renderer::DXLayer {
@@ -39,17 +40,19 @@ namespace Nickel::Renderer::DXLayer {
 		ShaderProgram() = default;
 		~ShaderProgram() = default;
 
-		auto Create(ID3D11Device1* device, std::span<const u8> vertexShaderBytecode, std::span<const u8> pixelShaderBytecode) -> void; // removed std::span<D3D11_INPUT_ELEMENT_DESC> vertexLayoutDesc
-		auto Bind(ID3D11DeviceContext1* ctx) -> void;
-		auto Unbind(ID3D11DeviceContext1* ctx) -> void;
+		// NOTE: an empty input signature falls back to reflecting the vertex shader bytecode
+		auto Create(ID3D11Device1* device, std::span<const u8> vertexShaderBytecode, std::span<const u8> pixelShaderBytecode, std::span<const ShaderInputElement> inputSignature) -> void;
+		auto Release() -> void;
+		auto Bind(ID3D11DeviceContext1* ctx) const -> void;
+		auto Unbind(ID3D11DeviceContext1* ctx) const -> void;
 		inline auto SetProperty(ID3D11DeviceContext1* ctx) -> void {
 			//ctx->VSSet
 			
 		}
 
-		ID3D11InputLayout* inputLayout;
-		ID3D11VertexShader* vertexShader;
-		ID3D11PixelShader* pixelShader;
+		ID3D11InputLayout* inputLayout = nullptr;
+		ID3D11VertexShader* vertexShader = nullptr;
+		ID3D11PixelShader* pixelShader = nullptr;
 
 		/*
 		Shader shaders[6] = {
@@ -63,6 +66,7 @@ namespace Nickel::Renderer::DXLayer {
 		*/
 
 		private:
+		auto CreateInputLayout(ID3D11Device1* device, std::span<const ShaderInputElement> inputSignature, std::span<const u8> vertexShaderBytecode) -> ID3D11InputLayout*;
 		auto CreateInputLayoutFromBytecode(ID3D11Device1* device, std::span<const u8> vertexShaderBytecode) -> ID3D11InputLayout*;
 
 		template<typename ShaderT>
@@ -1,3177 +0,0 @@
-#if 0
-//
-// Generated by Microsoft (R) HLSL Shader Compiler 10.1
-//
-//
-// Resource Bindings:
-//
-// Name                                 Type  Format         Dim      HLSL Bind  Count
-// ------------------------------ ---------- ------- ----------- -------------- ------
-// ss                                sampler      NA          NA             s0      1 
-// tex                               texture  float4        cube             t0      1 
-//
-//
-//
-// Input signature:
-//
-// Name                 Index   Mask Register SysValue  Format   Used
-// -------------------- ----- ------ -------- -------- ------- ------
-// WORLD_POSITION           0   xyz         0     NONE   float   xyz 
-//
-//
-// Output signature:
-//
-// Name                 Index   Mask Register SysValue  Format   Used
-// -------------------- ----- ------ -------- -------- ------- ------
-// SV_TARGET                0   xyzw        0   TARGET   float   xyzw
-//
-ps_5_0
-dcl_globalFlags refactoringAllowed | skipOptimization
-dcl_sampler s0, mode_default
-dcl_resource_texturecube (float,float,float,float) t0
-dcl_input_ps linear v0.xyz
-dcl_output o0.xyzw
-dcl_temps 2
-//
-// Initial variable locations:
-//   v0.x <- worldPos.x; v0.y <- worldPos.y; v0.z <- worldPos.z; 
-//   o0.x <- <BackgroundPixelShader return value>.x; o0.y <- <BackgroundPixelShader return value>.y; o0.z <- <BackgroundPixelShader return value>.z; o0.w <- <BackgroundPixelShader return value>.w
-//
-#line 38 "E:\Projects\Nickel\Nickel\Data\Shaders\BackgroundPixelShader.hlsl"
-sample_indexable(texturecube)(float,float,float,float) r0.xyz, v0.xyzx, t0.xyzw, s0  // r0.x <- color.x; r0.y <- color.y; r0.z <- color.z
-
-#line 40
-nop 
-
-#line 5 "E:\Projects\Nickel\Nickel\Data\Shaders\PbrHelper.hlsl"
-add r1.xyz, r0.xyzx, l(1.000000, 1.000000, 1.000000, 0.000000)
-div r0.xyz, r0.xyzx, r1.xyzx  // r0.x <- <ToneMapHDR return value>.x; r0.y <- <ToneMapHDR return value>.y; r0.z <- <ToneMapHDR return value>.z
-
-#line 40 "E:\Projects\Nickel\Nickel\Data\Shaders\BackgroundPixelShader.hlsl"
-mov r0.xyz, r0.xyzx  // r0.x <- color.x; r0.y <- color.y; r0.z <- color.z
-
-#line 43
-mov o0.xyz, r0.xyzx
-mov o0.w, l(1.000000)
-ret 
-// Approximately 8 instruction slots used
-#endif
-
-const BYTE g_BackgroundPixelShader[] =
-{
-     68,  88,  66,  67, 209,  37, 
-    225, 229, 142, 228, 102, 191, 
-    206, 201,  47,  50, 154, 116, 
-    165,  89,   1,   0,   0,   0, 
-      0,  73,   0,   0,   6,   0, 
-      0,   0,  56,   0,   0,   0, 
-    236,   0,   0,   0,  36,   1, 
-      0,   0,  88,   1,   0,   0, 
-     92,   2,   0,   0, 248,   2, 
-      0,   0,  82,  68,  69,  70, 
-    172,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      2,   0,   0,   0,  60,   0, 
-      0,   0,   0,   5, 255, 255, 
-      5,   1,   0,   0, 131,   0, 
-      0,   0,  82,  68,  49,  49, 
-     60,   0,   0,   0,  24,   0, 
-      0,   0,  32,   0,   0,   0, 
-     40,   0,   0,   0,  36,   0, 
-      0,   0,  12,   0,   0,   0, 
-      0,   0,   0,   0, 124,   0, 
-      0,   0,   3,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   1,   0, 
-      0,   0,   1,   0,   0,   0, 
-    127,   0,   0,   0,   2,   0, 
-      0,   0,   5,   0,   0,   0, 
-      9,   0,   0,   0, 255, 255, 
-    255, 255,   0,   0,   0,   0, 
-      1,   0,   0,   0,  13,   0, 
-      0,   0, 115, 115,   0, 116, 
-    101, 120,   0,  77, 105,  99, 
-    114, 111, 115, 111, 102, 116, 
-     32,  40,  82,  41,  32,  72, 
-     76,  83,  76,  32,  83, 104, 
-     97, 100, 101, 114,  32,  67, 
-    111, 109, 112, 105, 108, 101, 
-    114,  32,  49,  48,  46,  49, 
-      0, 171,  73,  83,  71,  78, 
-     48,   0,   0,   0,   1,   0, 
-      0,   0,   8,   0,   0,   0, 
-     32,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      3,   0,   0,   0,   0,   0, 
-      0,   0,   7,   7,   0,   0, 
-     87,  79,  82,  76,  68,  95, 
-     80,  79,  83,  73,  84,  73, 
-     79,  78,   0, 171,  79,  83, 
-     71,  78,  44,   0,   0,   0, 
-      1,   0,   0,   0,   8,   0, 
-      0,   0,  32,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   3,   0,   0,   0, 
-      0,   0,   0,   0,  15,   0, 
-      0,   0,  83,  86,  95,  84, 
-     65,  82,  71,  69,  84,   0, 
-    171, 171,  83,  72,  69,  88, 
-    252,   0,   0,   0,  80,   0, 
-      0,   0,  63,   0,   0,   0, 
-    106, 136,   0,   1,  90,   0, 
-      0,   3,   0,  96,  16,   0, 
-      0,   0,   0,   0,  88,  48, 
-      0,   4,   0, 112,  16,   0, 
-      0,   0,   0,   0,  85,  85, 
-      0,   0,  98,  16,   0,   3, 
-    114,  16,  16,   0,   0,   0, 
-      0,   0, 101,   0,   0,   3, 
-    242,  32,  16,   0,   0,   0, 
-      0,   0, 104,   0,   0,   2, 
-      2,   0,   0,   0,  69,   0, 
-      0, 139, 130,   1,   0, 128, 
-     67,  85,  21,   0, 114,   0, 
-     16,   0,   0,   0,   0,   0, 
-     70,  18,  16,   0,   0,   0, 
-      0,   0,  70, 126,  16,   0, 
-      0,   0,   0,   0,   0,  96, 
-     16,   0,   0,   0,   0,   0, 
-     58,   0,   0,   1,   0,   0, 
-      0,  10, 114,   0,  16,   0, 
-      1,   0,   0,   0,  70,   2, 
-     16,   0,   0,   0,   0,   0, 
-      2,  64,   0,   0,   0,   0, 
-    128,  63,   0,   0, 128,  63, 
-      0,   0, 128,  63,   0,   0, 
-      0,   0,  14,   0,   0,   7, 
-    114,   0,  16,   0,   0,   0, 
-      0,   0,  70,   2,  16,   0, 
-      0,   0,   0,   0,  70,   2, 
-     16,   0,   1,   0,   0,   0, 
-     54,   0,   0,   5, 114,   0, 
-     16,   0,   0,   0,   0,   0, 
-     70,   2,  16,   0,   0,   0, 
-      0,   0,  54,   0,   0,   5, 
-    114,  32,  16,   0,   0,   0, 
-      0,   0,  70,   2,  16,   0, 
-      0,   0,   0,   0,  54,   0, 
-      0,   5, 130,  32,  16,   0, 
-      0,   0,   0,   0,   1,  64, 
-      0,   0,   0,   0, 128,  63, 
-     62,   0,   0,   1,  83,  84, 
-     65,  84, 148,   0,   0,   0, 
-      8,   0,   0,   0,   2,   0, 
-      0,   0,   0,   0,   0,   0, 
-      2,   0,   0,   0,   2,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   1,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   1,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   3,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,  83,  80, 
-     68,  66,   0,  70,   0,   0, 
-     77, 105,  99, 114, 111, 115, 
-    111, 102, 116,  32,  67,  47, 
-     67,  43,  43,  32,  77,  83, 
-     70,  32,  55,  46,  48,  48, 
-     13,  10,  26,  68,  83,   0, 
-      0,   0,   0,   2,   0,   0, 
-      2,   0,   0,   0,  35,   0, 
-      0,   0, 184,   0,   0,   0, 
-      0,   0,   0,   0,  34,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0, 192, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255,  56,   0, 
-      0,   0, 248, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-      5,   0,   0,   0,  32,   0, 
-      0,   0,  60,   0,   0,   0, 
-      0,   0,   0,   0, 255, 255, 
-    255, 255,   0,   0,   0,   0, 
-      6,   0,   0,   0,   5,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   3,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0, 148,  46, 
-     49,   1, 138, 176, 147,  97, 
-      1,   0,   0,   0, 100, 119, 
-    239,  42,  66, 145, 169,  75, 
-    167, 178, 136, 194,  39, 160, 
-     88,  77,   0,   0,   0,   0, 
-      0,   0,   0,   0,   1,   0, 
-      0,   0,   1,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-    220,  81,  51,   1,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-     11, 202,  49,   1,  56,   0, 
-      0,   0,   0,  16,   0,   0, 
-      1,  16,   0,   0,  24,   0, 
-      0,   0,  12,   0, 255, 255, 
-      4,   0,   0,   0, 255, 255, 
-      3,   0,   0,   0,   0,   0, 
-      4,   0,   0,   0,   4,   0, 
-      0,   0,   8,   0,   0,   0, 
-     12,   0,   0,   0,   0,   0, 
-      0,   0,  22,   0,   1,  22, 
-      0,   0,   0,   0,   7,  16, 
-      0,   0,  84, 111, 110, 101, 
-     77,  97, 112,  72,  68,  82, 
-      0, 241,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,  76, 232,   3,   0, 
-     25,  96,   3,   0, 198,  90, 
-      0,   0, 229,  18,   2,   0, 
-    193, 145,   0,   0,  65,  36, 
-      1,   0, 152, 210,   1,   0, 
-     32, 240,   2,   0, 201, 233, 
-      0,   0, 125,  10,   2,   0, 
-    125, 181,   2,   0, 250, 175, 
-      2,   0, 193,  33,   3,   0, 
-     65, 185,   2,   0,   0,  16, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,  84, 101, 
-    120, 116, 117, 114, 101,  67, 
-    117,  98, 101,  32, 116, 101, 
-    120,  32,  58,  32, 114, 101, 
-    103, 105, 115, 116, 101, 114, 
-     40, 116,  48,  41,  59,  10, 
-     83,  97, 109, 112, 108, 101, 
-    114,  83, 116,  97, 116, 101, 
-     32, 115, 115,  32,  58,  32, 
-    114, 101, 103, 105, 115, 116, 
-    101, 114,  40, 115,  48,  41, 
-     59,  10,  10,  35, 105, 110, 
-     99, 108, 117, 100, 101,  32, 
-     34,  80,  98, 114,  72, 101, 
-    108, 112, 101, 114,  46, 104, 
-    108, 115, 108,  34,  10,  10, 
-     47,  42,  10, 102, 108, 111, 
-     97, 116,  51,  32,  99, 117, 
-     98, 101, 109,  97, 112,  83, 
-    101,  97, 109, 108, 101, 115, 
-    115,  70, 105, 120,  68, 105, 
-    114, 101,  99, 116, 105, 111, 
-    110,  40, 102, 108, 111,  97, 
-    116,  51,  32, 100, 105, 114, 
-     44,  32,  99, 111, 110, 115, 
-    116,  32, 102, 108, 111,  97, 
-    116,  32, 115,  99,  97, 108, 
-    101,  41,  32, 123,  10,  32, 
-     32,  32,  32,  47,  47,  32, 
-    104, 116, 116, 112,  58,  47, 
-     47, 115, 101,  98, 108,  97, 
-    103,  97, 114, 100, 101,  46, 
-    119, 111, 114, 100, 112, 114, 
-    101, 115, 115,  46,  99, 111, 
-    109,  47,  50,  48,  49,  50, 
-     47,  48,  54,  47,  49,  48, 
-     47,  97, 109, 100,  45,  99, 
-    117,  98, 101, 109,  97, 112, 
-    103, 101, 110,  45, 102, 111, 
-    114,  45, 112, 104, 121, 115, 
-    105,  99,  97, 108, 108, 121, 
-     45,  98,  97, 115, 101, 100, 
-     45, 114, 101, 110, 100, 101, 
-    114, 105, 110, 103,  47,  10, 
-     32,  32,  32,  32, 102, 108, 
-    111,  97, 116,  32,  77,  32, 
-     61,  32, 109,  97, 120,  40, 
-    109,  97, 120,  40,  97,  98, 
-    115,  40, 100, 105, 114,  46, 
-    120,  41,  44,  32,  97,  98, 
-    115,  40, 100, 105, 114,  46, 
-    121,  41,  41,  44,  32,  97, 
-     98, 115,  40, 100, 105, 114, 
-     46, 122,  41,  41,  59,  10, 
-     10,  32,  32,  32,  32, 105, 
-    102,  32,  40,  97,  98, 115, 
-     40, 100, 105, 114,  46, 120, 
-     41,  32,  33,  61,  32,  77, 
-     41,  10,  32,  32,  32,  32, 
-     32,  32,  32,  32, 100, 105, 
-    114,  46, 120,  32,  42,  61, 
-     32, 115,  99,  97, 108, 101, 
-     59,  10,  10,  32,  32,  32, 
-     32, 105, 102,  32,  40,  97, 
-     98, 115,  40, 100, 105, 114, 
-     46, 121,  41,  32,  33,  61, 
-     32,  77,  41,  10,  32,  32, 
-     32,  32,  32,  32,  32,  32, 
-    100, 105, 114,  46, 121,  32, 
-     42,  61,  32, 115,  99,  97, 
-    108, 101,  59,  10,  10,  32, 
-     32,  32,  32, 105, 102,  32, 
-     40,  97,  98, 115,  40, 100, 
-    105, 114,  46, 122,  41,  32, 
-     33,  61,  32,  77,  41,  10, 
-     32,  32,  32,  32,  32,  32, 
-     32,  32, 100, 105, 114,  46, 
-    122,  32,  42,  61,  32, 115, 
-     99,  97, 108, 101,  59,  10, 
-     10,  32,  32,  32,  32, 114, 
-    101, 116, 117, 114, 110,  32, 
-    100, 105, 114,  59,  10, 125, 
-     10,  10, 102, 108, 111,  97, 
-    116,  52,  32, 116, 101, 120, 
-    116, 117, 114, 101,  67, 117, 
-     98, 101, 109,  97, 112,  40, 
-     99, 111, 110, 115, 116,  32, 
-    105, 110,  32, 115,  97, 109, 
-    112, 108, 101, 114,  67, 117, 
-     98, 101,  32, 116, 101, 120, 
-     44,  32,  99, 111, 110, 115, 
-    116,  32, 105, 110,  32, 102, 
-    108, 111,  97, 116,  51,  32, 
-    100, 105, 114,  41,  32, 123, 
-     10,  32,  32,  32,  32, 102, 
-    108, 111,  97, 116,  52,  32, 
-    114, 103,  98,  97,  32,  61, 
-     32, 116, 101, 120, 116, 117, 
-    114, 101,  67, 117,  98, 101, 
-     40, 116, 101, 120,  44,  32, 
-    100, 105, 114,  41,  59,  10, 
-     32,  32,  32,  32, 114, 101, 
-    116, 117, 114, 110,  32,  76, 
-    111, 103,  76, 117, 118,  84, 
-    111,  76, 105, 110, 101,  97, 
-    114,  40, 114, 103,  98,  97, 
-     41,  59,  10, 125,  10,  10, 
-     47,  47,  32,  83, 101,  97, 
-    109, 108, 101, 115, 115,  32, 
-     99, 117,  98, 101, 109,  97, 
-    112,  32, 102, 111, 114,  32, 
-     98,  97,  99, 107, 103, 114, 
-    111, 117, 110, 100,  10, 102, 
-    108, 111,  97, 116,  52,  32, 
-    116, 101, 120, 116, 117, 114, 
-    101,  67, 117,  98, 101,  70, 
-    105, 120, 101, 100,  40,  99, 
-    111, 110, 115, 116,  32, 115, 
-     97, 109, 112, 108, 101, 114, 
-     67, 117,  98, 101,  32, 116, 
-    101, 120,  44,  32,  99, 111, 
-    110, 115, 116,  32, 102, 108, 
-    111,  97, 116,  51,  32, 100, 
-    105, 114, 101,  99, 116, 105, 
-    111, 110,  41,  32, 123,  10, 
-     32,  32,  32,  32,  47,  47, 
-     32, 104, 116, 116, 112,  58, 
-     47,  47, 115, 101,  98, 108, 
-     97, 103,  97, 114, 100, 101, 
-     46, 119, 111, 114, 100, 112, 
-    114, 101, 115, 115,  46,  99, 
-    111, 109,  47,  50,  48,  49, 
-     50,  47,  48,  54,  47,  49, 
-     48,  47,  97, 109, 100,  45, 
-     99, 117,  98, 101, 109,  97, 
-    112, 103, 101, 110,  45, 102, 
-    111, 114,  45, 112, 104, 121, 
-    115, 105,  99,  97, 108, 108, 
-    121,  45,  98,  97, 115, 101, 
-    100,  45, 114, 101, 110, 100, 
-    101, 114, 105, 110, 103,  47, 
-     10,  32,  32,  32,  32, 102, 
-    108, 111,  97, 116,  32, 115, 
-     99,  97, 108, 101,  32,  61, 
-     32,  49,  46,  48,  32,  45, 
-     32,  49,  46,  48,  32,  47, 
-     32, 117,  69, 110, 118, 105, 
-    114, 111, 110, 109, 101, 110, 
-    116,  83, 105, 122, 101,  91, 
-     48,  93,  59,  10,  32,  32, 
-     32,  32, 118, 101,  99,  51, 
-     32, 100, 105, 114,  32,  61, 
-     32,  99, 117,  98, 101, 109, 
-     97, 112,  83, 101,  97, 109, 
-    108, 101, 115, 115,  70, 105, 
-    120,  68, 105, 114, 101,  99, 
-    116, 105, 111, 110,  40, 100, 
-    105, 114, 101,  99, 116, 105, 
-    111, 110,  44,  32, 115,  99, 
-     97, 108, 101,  41,  59,  10, 
-     32,  32,  32,  32, 114, 101, 
-    116, 117, 114, 110,  32, 116, 
-    101, 120, 116, 117, 114, 101, 
-     67, 117,  98, 101, 109,  97, 
-    112,  40, 116, 101, 120,  44, 
-     32, 100, 105, 114,  41,  59, 
-     10, 125,  10,  42,  47,  10, 
-     10, 102, 108, 111,  97, 116, 
-     52,  32,  66,  97,  99, 107, 
-    103, 114, 111, 117, 110, 100, 
-     80, 105, 120, 101, 108,  83, 
-    104,  97, 100, 101, 114,  40, 
-    102, 108, 111,  97, 116,  51, 
-     32, 119, 111, 114, 108, 100, 
-     80, 111, 115,  32,  58,  32, 
-     87,  79,  82,  76,  68,  95, 
-     80,  79,  83,  73,  84,  73, 
-     79,  78,  41,  32,  58,  32, 
-     83,  86,  95,  84,  65,  82, 
-     71,  69,  84, 123,  10,  32, 
-     32,  32,  32, 102, 108, 111, 
-     97, 116,  51,  32,  99, 111, 
-    108, 111, 114,  32,  61,  32, 
-    116, 101, 120,  46,  83,  97, 
-    109, 112, 108, 101,  40, 115, 
-    115,  44,  32, 119, 111, 114, 
-    108, 100,  80, 111, 115,  41, 
-     59,  10,  10,  32,  32,  32, 
-     32,  99, 111, 108, 111, 114, 
-     32,  61,  32,  84, 111, 110, 
-    101,  77,  97, 112,  72,  68, 
-     82,  40,  99, 111, 108, 111, 
-    114,  41,  59,  10,  32,  32, 
-     32,  32,  47,  47,  32,  99, 
-    111, 108, 111, 114,  32,  61, 
-     32,  67, 111, 114, 114, 101, 
-     99, 116,  71,  97, 109, 109, 
-     97,  40,  99, 111, 108, 111, 
-    114,  41,  59,  10,  10,  32, 
-     32,  32,  32, 114, 101, 116, 
-    117, 114, 110,  32, 102, 108, 
-    111,  97, 116,  52,  40,  99, 
-    111, 108, 111, 114,  44,  32, 
-     49,  46,  48,  41,  59,  10, 
-    125,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0, 115, 116, 
-     97, 116, 105,  99,  32,  99, 
-    111, 110, 115, 116,  32, 102, 
-    108, 111,  97, 116,  32,  80, 
-     73,  32,  61,  32,  51,  46, 
-     49,  52,  49,  53,  57,  50, 
-     54,  53,  51,  53,  57,  59, 
-     10,  10, 105, 110, 108, 105, 
-    110, 101,  32, 102, 108, 111, 
-     97, 116,  51,  32,  84, 111, 
-    110, 101,  77,  97, 112,  72, 
-     68,  82,  40,  99, 111, 110, 
-    115, 116,  32, 102, 108, 111, 
-     97, 116,  51,  32,  99, 111, 
-    108, 111, 114,  41,  32, 123, 
-     10,  32,  32,  32,  32,  47, 
-     47,  32,  82, 101, 105, 110, 
-    104,  97, 114, 100,  32, 111, 
-    112, 101, 114,  97, 116, 111, 
-    114,  10,  32,  32,  32,  32, 
-    114, 101, 116, 117, 114, 110, 
-     32,  99, 111, 108, 111, 114, 
-     32,  47,  32,  40,  99, 111, 
-    108, 111, 114,  32,  43,  32, 
-    102, 108, 111,  97, 116,  51, 
-     40,  49,  46,  48,  44,  32, 
-     49,  46,  48,  44,  32,  49, 
-     46,  48,  41,  41,  59,  10, 
-    125,  10,  10, 105, 110, 108, 
-    105, 110, 101,  32, 102, 108, 
-    111,  97, 116,  51,  32,  67, 
-    111, 114, 114, 101,  99, 116, 
-     71,  97, 109, 109,  97,  40, 
-     99, 111, 110, 115, 116,  32, 
-    102, 108, 111,  97, 116,  51, 
-     32,  99, 111, 108, 111, 114, 
-     41,  32, 123,  10,  32,  32, 
-     32,  32,  99, 111, 110, 115, 
-    116,  32, 102, 108, 111,  97, 
-    116,  32, 112, 111, 119,  78, 
-     32,  61,  32,  49,  46,  48, 
-     32,  47,  32,  50,  46,  50, 
-     59,  10,  32,  32,  32,  32, 
-    114, 101, 116, 117, 114, 110, 
-     32, 112, 111, 119,  40,  99, 
-    111, 108, 111, 114,  44,  32, 
-    102, 108, 111,  97, 116,  51, 
-     40, 112, 111, 119,  78,  44, 
-     32, 112, 111, 119,  78,  44, 
-     32, 112, 111, 119,  78,  41, 
-     41,  59,  10, 125,  10,  10, 
-    102, 108, 111,  97, 116,  32, 
-     68, 105, 115, 116, 114, 105, 
-     98, 117, 116, 105, 111, 110, 
-     71,  71,  88,  40, 102, 108, 
-    111,  97, 116,  51,  32,  78, 
-     44,  32, 102, 108, 111,  97, 
-    116,  51,  32,  72,  44,  32, 
-    102, 108, 111,  97, 116,  32, 
-    114, 111, 117, 103, 104, 110, 
-    101, 115, 115,  41,  32, 123, 
-     10,  32,  32,  32,  32, 102, 
-    108, 111,  97, 116,  32,  97, 
-     32,  61,  32, 114, 111, 117, 
-    103, 104, 110, 101, 115, 115, 
-     32,  42,  32, 114, 111, 117, 
-    103, 104, 110, 101, 115, 115, 
-     59,  10,  32,  32,  32,  32, 
-    102, 108, 111,  97, 116,  32, 
-     97,  50,  32,  61,  32,  97, 
-     32,  42,  32,  97,  59,  10, 
-     32,  32,  32,  32, 102, 108, 
-    111,  97, 116,  32,  78, 100, 
-    111, 116,  72,  32,  61,  32, 
-    109,  97, 120,  40, 100, 111, 
-    116,  40,  78,  44,  32,  72, 
-     41,  44,  32,  48,  46,  48, 
-     41,  59,  10,  32,  32,  32, 
-     32, 102, 108, 111,  97, 116, 
-     32,  78, 100, 111, 116,  72, 
-     50,  32,  61,  32,  78, 100, 
-    111, 116,  72,  32,  42,  32, 
-     78, 100, 111, 116,  72,  59, 
-     10,  10,  32,  32,  32,  32, 
-    102, 108, 111,  97, 116,  32, 
-    110, 117, 109,  32,  61,  32, 
-     97,  50,  59,  10,  32,  32, 
-     32,  32, 102, 108, 111,  97, 
-    116,  32, 100, 101, 110, 111, 
-    109,  32,  61,  32,  40,  78, 
-    100, 111, 116,  72,  50,  32, 
-     42,  32,  40,  97,  50,  32, 
-     45,  32,  49,  46,  48,  41, 
-     32,  43,  32,  49,  46,  48, 
-     41,  59,  10,  32,  32,  32, 
-     32, 100, 101, 110, 111, 109, 
-     32,  61,  32,  80,  73,  32, 
-     42,  32, 100, 101, 110, 111, 
-    109,  32,  42,  32, 100, 101, 
-    110, 111, 109,  59,  10,  10, 
-     32,  32,  32,  32, 114, 101, 
-    116, 117, 114, 110,  32, 110, 
-    117, 109,  32,  47,  32, 100, 
-    101, 110, 111, 109,  59,  10, 
-    125,  10,  10, 102, 108, 111, 
-     97, 116,  32,  71, 101, 111, 
-    109, 101, 116, 114, 121,  83, 
-     99, 104, 108, 105,  99, 107, 
-     71,  71,  88,  40, 102, 108, 
-    111,  97, 116,  32,  78, 100, 
-    111, 116,  86,  44,  32, 102, 
-    108, 111,  97, 116,  32, 114, 
-    111, 117, 103, 104, 110, 101, 
-    115, 115,  41,  32, 123,  10, 
-     32,  32,  32,  32, 102, 108, 
-    111,  97, 116,  32, 114,  32, 
-     61,  32,  40, 114, 111, 117, 
-    103, 104, 110, 101, 115, 115, 
-     32,  43,  32,  49,  46,  48, 
-     41,  59,  10,  32,  32,  32, 
-     32, 102, 108, 111,  97, 116, 
-     32, 107,  32,  61,  32,  40, 
-    114,  32,  42,  32, 114,  41, 
-     32,  47,  32,  56,  46,  48, 
-     59,  10,  10,  32,  32,  32, 
-     32, 102, 108, 111,  97, 116, 
-     32, 110, 117, 109,  32,  61, 
-     32,  78, 100, 111, 116,  86, 
-     59,  10,  32,  32,  32,  32, 
-    102, 108, 111,  97, 116,  32, 
-    100, 101, 110, 111, 109,  32, 
-     61,  32,  78, 100, 111, 116, 
-     86,  32,  42,  32,  40,  49, 
-     46,  48,  32,  45,  32, 107, 
-     41,  32,  43,  32, 107,  59, 
-     10,  10,  32,  32,  32,  32, 
-    114, 101, 116, 117, 114, 110, 
-     32, 110, 117, 109,  32,  47, 
-     32, 100, 101, 110, 111, 109, 
-     59,  10, 125,  10,  10, 102, 
-    108, 111,  97, 116,  32,  71, 
-    101, 111, 109, 101, 116, 114, 
-    121,  83, 109, 105, 116, 104, 
-     40, 102, 108, 111,  97, 116, 
-     51,  32,  78,  44,  32, 102, 
-    108, 111,  97, 116,  51,  32, 
-     86,  44,  32, 102, 108, 111, 
-     97, 116,  51,  32,  76,  44, 
-     32, 102, 108, 111,  97, 116, 
-     32, 114, 111, 117, 103, 104, 
-    110, 101, 115, 115,  41,  32, 
-    123,  10,  32,  32,  32,  32, 
-    102, 108, 111,  97, 116,  32, 
-     78, 100, 111, 116,  86,  32, 
-     61,  32, 109,  97, 120,  40, 
-    100, 111, 116,  40,  78,  44, 
-     32,  86,  41,  44,  32,  48, 
-     46,  48,  41,  59,  10,  32, 
-     32,  32,  32, 102, 108, 111, 
-     97, 116,  32,  78, 100, 111, 
-    116,  76,  32,  61,  32, 109, 
-     97, 120,  40, 100, 111, 116, 
-     40,  78,  44,  32,  76,  41, 
-     44,  32,  48,  46,  48,  41, 
-     59,  10,  32,  32,  32,  32, 
-    102, 108, 111,  97, 116,  32, 
-    103, 103, 120,  50,  32,  61, 
-     32,  71, 101, 111, 109, 101, 
-    116, 114, 121,  83,  99, 104, 
-    108, 105,  99, 107,  71,  71, 
-     88,  40,  78, 100, 111, 116, 
-     86,  44,  32, 114, 111, 117, 
-    103, 104, 110, 101, 115, 115, 
-     41,  59,  10,  32,  32,  32, 
-     32, 102, 108, 111,  97, 116, 
-     32, 103, 103, 120,  49,  32, 
-     61,  32,  71, 101, 111, 109, 
-    101, 116, 114, 121,  83,  99, 
-    104, 108, 105,  99, 107,  71, 
-     71,  88,  40,  78, 100, 111, 
-    116,  76,  44,  32, 114, 111, 
-    117, 103, 104, 110, 101, 115, 
-    115,  41,  59,  10,  10,  32, 
-     32,  32,  32, 114, 101, 116, 
-    117, 114, 110,  32, 103, 103, 
-    120,  49,  32,  42,  32, 103, 
-    103, 120,  50,  59,  10, 125, 
-     10,  10, 102, 108, 111,  97, 
-    116,  51,  32,  70, 114, 101, 
-    115, 110, 101, 108,  83,  99, 
-    104, 108, 105,  99, 107,  40, 
-    102, 108, 111,  97, 116,  32, 
-     99, 111, 115,  84, 104, 101, 
-    116,  97,  44,  32, 102, 108, 
-    111,  97, 116,  51,  32,  70, 
-     48,  41,  32, 123,  10,  32, 
-     32,  32,  32, 114, 101, 116, 
-    117, 114, 110,  32,  70,  48, 
-     32,  43,  32,  40,  49,  46, 
-     48,  32,  45,  32,  70,  48, 
-     41,  32,  42,  32, 112, 111, 
-    119,  40, 115,  97, 116, 117, 
-    114,  97, 116, 101,  40,  49, 
-     46,  48,  32,  45,  32,  99, 
-    111, 115,  84, 104, 101, 116, 
-     97,  41,  44,  32,  53,  46, 
-     48,  41,  59,  10, 125,  10, 
-     10, 102, 108, 111,  97, 116, 
-     51,  32,  70, 114, 101, 115, 
-    110, 101, 108,  83,  99, 104, 
-    108, 105,  99, 107,  82, 111, 
-    117, 103, 104, 110, 101, 115, 
-    115,  40, 102, 108, 111,  97, 
-    116,  32,  99, 111, 115,  84, 
-    104, 101, 116,  97,  44,  32, 
-    102, 108, 111,  97, 116,  51, 
-     32,  70,  48,  44,  32, 102, 
-    108, 111,  97, 116,  32, 114, 
-    111, 117, 103, 104, 110, 101, 
-    115, 115,  41,  32, 123,  10, 
-     32,  32,  32,  32,  99, 111, 
-    110, 115, 116,  32, 102, 108, 
-    111,  97, 116,  32, 111, 110, 
-    101,  77, 105, 110, 117, 115, 
-     82, 111, 117, 103, 104, 110, 
-    101, 115, 115,  32,  61,  32, 
-     49,  46,  48,  32,  45,  32, 
-    114, 111, 117, 103, 104, 110, 
-    101, 115, 115,  59,  10,  32, 
-     32,  32,  32, 114, 101, 116, 
-    117, 114, 110,  32,  70,  48, 
-     32,  43,  32,  40, 109,  97, 
-    120,  40, 102, 108, 111,  97, 
-    116,  51,  40, 111, 110, 101, 
-     77, 105, 110, 117, 115,  82, 
-    111, 117, 103, 104, 110, 101, 
-    115, 115,  44,  32, 111, 110, 
-    101,  77, 105, 110, 117, 115, 
-     82, 111, 117, 103, 104, 110, 
-    101, 115, 115,  44,  32, 111, 
-    110, 101,  77, 105, 110, 117, 
-    115,  82, 111, 117, 103, 104, 
-    110, 101, 115, 115,  41,  44, 
-     32,  70,  48,  41,  32,  45, 
-     32,  70,  48,  41,  32,  42, 
-     32, 112, 111, 119,  40, 115, 
-     97, 116, 117, 114,  97, 116, 
-    101,  40,  49,  46,  48,  32, 
-     45,  32,  99, 111, 115,  84, 
-    104, 101, 116,  97,  41,  44, 
-     32,  53,  46,  48,  41,  59, 
-     10, 125,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0, 254, 239, 
-    254, 239,   1,   0,   0,   0, 
-    153,  11,   0,   0,   0,  69, 
-     58,  92,  80, 114, 111, 106, 
-    101,  99, 116, 115,  92,  78, 
-    105,  99, 107, 101, 108,  92, 
-     78, 105,  99, 107, 101, 108, 
-     92,  68,  97, 116,  97,  92, 
-     83, 104,  97, 100, 101, 114, 
-    115,  92,  66,  97,  99, 107, 
-    103, 114, 111, 117, 110, 100, 
-     80, 105, 120, 101, 108,  83, 
-    104,  97, 100, 101, 114,  46, 
-    104, 108, 115, 108,   0,   0, 
-    101,  58,  92, 112, 114, 111, 
-    106, 101,  99, 116, 115,  92, 
-    110, 105,  99, 107, 101, 108, 
-     92, 110, 105,  99, 107, 101, 
-    108,  92, 100,  97, 116,  97, 
-     92, 115, 104,  97, 100, 101, 
-    114, 115,  92,  98,  97,  99, 
-    107, 103, 114, 111, 117, 110, 
-    100, 112, 105, 120, 101, 108, 
-    115, 104,  97, 100, 101, 114, 
-     46, 104, 108, 115, 108,   0, 
-     69,  58,  92,  80, 114, 111, 
-    106, 101,  99, 116, 115,  92, 
-     78, 105,  99, 107, 101, 108, 
-     92,  78, 105,  99, 107, 101, 
-    108,  92,  68,  97, 116,  97, 
-     92,  83, 104,  97, 100, 101, 
-    114, 115,  92,  80,  98, 114, 
-     72, 101, 108, 112, 101, 114, 
-     46, 104, 108, 115, 108,   0, 
-    101,  58,  92, 112, 114, 111, 
-    106, 101,  99, 116, 115,  92, 
-    110, 105,  99, 107, 101, 108, 
-     92, 110, 105,  99, 107, 101, 
-    108,  92, 100,  97, 116,  97, 
-     92, 115, 104,  97, 100, 101, 
-    114, 115,  92, 112,  98, 114, 
-    104, 101, 108, 112, 101, 114, 
-     46, 104, 108, 115, 108,   0, 
-     84, 101, 120, 116, 117, 114, 
-    101,  67, 117,  98, 101,  32, 
-    116, 101, 120,  32,  58,  32, 
-    114, 101, 103, 105, 115, 116, 
-    101, 114,  40, 116,  48,  41, 
-     59,  10,  83,  97, 109, 112, 
-    108, 101, 114,  83, 116,  97, 
-    116, 101,  32, 115, 115,  32, 
-     58,  32, 114, 101, 103, 105, 
-    115, 116, 101, 114,  40, 115, 
-     48,  41,  59,  10,  10,  35, 
-    105, 110,  99, 108, 117, 100, 
-    101,  32,  34,  80,  98, 114, 
-     72, 101, 108, 112, 101, 114, 
-     46, 104, 108, 115, 108,  34, 
-     10,  10,  47,  42,  10, 102, 
-    108, 111,  97, 116,  51,  32, 
-     99, 117,  98, 101, 109,  97, 
-    112,  83, 101,  97, 109, 108, 
-    101, 115, 115,  70, 105, 120, 
-     68, 105, 114, 101,  99, 116, 
-    105, 111, 110,  40, 102, 108, 
-    111,  97, 116,  51,  32, 100, 
-    105, 114,  44,  32,  99, 111, 
-    110, 115, 116,  32, 102, 108, 
-    111,  97, 116,  32, 115,  99, 
-     97, 108, 101,  41,  32, 123, 
-     10,  32,  32,  32,  32,  47, 
-     47,  32, 104, 116, 116, 112, 
-     58,  47,  47, 115, 101,  98, 
-    108,  97, 103,  97, 114, 100, 
-    101,  46, 119, 111, 114, 100, 
-    112, 114, 101, 115, 115,  46, 
-     99, 111, 109,  47,  50,  48, 
-     49,  50,  47,  48,  54,  47, 
-     49,  48,  47,  97, 109, 100, 
-     45,  99, 117,  98, 101, 109, 
-     97, 112, 103, 101, 110,  45, 
-    102, 111, 114,  45, 112, 104, 
-    121, 115, 105,  99,  97, 108, 
-    108, 121,  45,  98,  97, 115, 
-    101, 100,  45, 114, 101, 110, 
-    100, 101, 114, 105, 110, 103, 
-     27, 226,  48,   1, 172,   0, 
-      0,   0, 213, 132, 131, 250, 
-    236, 218, 215,   1,   1,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   2,   0, 
-      0,   0,   4,   0,   0,   0, 
-      1,   0,   0,   0,   3,   0, 
-      0,   0,   0,   0,   0,   0, 
-     68,   0,   0,   0,  40,   0, 
-      0,   0,  27, 226,  48,   1, 
-    110, 167,  14,  54, 197,   4, 
-      0,   0,   1,   0,   0,   0, 
-     67,   0,   0,   0,  68,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0, 188,   0,   0,   0, 
-     40,   0,   0,   0,  27, 226, 
-     48,   1, 194, 234, 171, 223, 
-    224,   5,   0,   0, 134,   0, 
-      0,   0,  67,   0,   0,   0, 
-    188,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   4,   0,   0,   0, 
-     66,   0,  60,  17,  16,   1, 
-      0,   0,   0,   1,  10,   0, 
-      1,   0,   1,   0, 124,  79, 
-     10,   0,   1,   0,   1,   0, 
-    124,  79,  77, 105,  99, 114, 
-    111, 115, 111, 102, 116,  32, 
-     40,  82,  41,  32,  72,  76, 
-     83,  76,  32,  83, 104,  97, 
-    100, 101, 114,  32,  67, 111, 
-    109, 112, 105, 108, 101, 114, 
-     32,  49,  48,  46,  49,   0, 
-      0,   0,  70,   0,  61,  17, 
-      1, 104, 108, 115, 108,  70, 
-    108,  97, 103, 115,   0,  48, 
-    120,  53,   0, 104, 108, 115, 
-    108,  84,  97, 114, 103, 101, 
-    116,   0, 112, 115,  95,  53, 
-     95,  48,   0, 104, 108, 115, 
-    108,  69, 110, 116, 114, 121, 
-      0,  66,  97,  99, 107, 103, 
-    114, 111, 117, 110, 100,  80, 
-    105, 120, 101, 108,  83, 104, 
-     97, 100, 101, 114,   0,   0, 
-      0,   0,  62,   0,  16,  17, 
-      0,   0,   0,   0,  52,   3, 
-      0,   0,   0,   0,   0,   0, 
-    180,   0,   0,   0,   0,   0, 
-      0,   0, 180,   0,   0,   0, 
-      4,  16,   0,   0,  72,   0, 
-      0,   0,   1,   0, 160,  66, 
-     97,  99, 107, 103, 114, 111, 
-    117, 110, 100,  80, 105, 120, 
-    101, 108,  83, 104,  97, 100, 
-    101, 114,   0,   0,   0,   0, 
-     46,   0,  62,  17,   0,  16, 
-      0,   0,   9,   0, 119, 111, 
-    114, 108, 100,  80, 111, 115, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-     22,   0,  80,  17,   1,   0, 
-      5,   0,   0,   0,   4,   0, 
-     72,   0,   0,   0,   1,   0, 
-    180,   0,   0,   0,   0,   0, 
-     22,   0,  80,  17,   1,   0, 
-      5,   0,   4,   0,   4,   0, 
-     72,   0,   0,   0,   1,   0, 
-    180,   0,   4,   0,   0,   0, 
-     22,   0,  80,  17,   1,   0, 
-      5,   0,   8,   0,   4,   0, 
-     72,   0,   0,   0,   1,   0, 
-    180,   0,   8,   0,   0,   0, 
-     74,   0,  62,  17,   3,  16, 
-      0,   0, 136,   0,  60,  66, 
-     97,  99, 107, 103, 114, 111, 
-    117, 110, 100,  80, 105, 120, 
-    101, 108,  83, 104,  97, 100, 
-    101, 114,  32, 114, 101, 116, 
-    117, 114, 110,  32, 118,  97, 
-    108, 117, 101,  62,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,  22,   0, 
-     80,  17,   2,   0,   5,   0, 
-      0,   0,   4,   0,  72,   0, 
-      0,   0,   1,   0, 180,   0, 
-      0,   0,   0,   0,  22,   0, 
-     80,  17,   2,   0,   5,   0, 
-      4,   0,   4,   0,  72,   0, 
-      0,   0,   1,   0, 180,   0, 
-      4,   0,   0,   0,  22,   0, 
-     80,  17,   2,   0,   5,   0, 
-      8,   0,   4,   0,  72,   0, 
-      0,   0,   1,   0, 180,   0, 
-      8,   0,   0,   0,  22,   0, 
-     80,  17,   2,   0,   5,   0, 
-     12,   0,   4,   0,  72,   0, 
-      0,   0,   1,   0, 180,   0, 
-     12,   0,   0,   0,  46,   0, 
-     62,  17,   0,  16,   0,   0, 
-      8,   0,  99, 111, 108, 111, 
-    114,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,  26,   0, 
-     80,  17,   0,   0,   5,   0, 
-      0,   0,   4,   0, 116,   0, 
-      0,   0,   1,   0, 136,   0, 
-     72,   0,  20,   0,   0,   0, 
-      0,   0,  26,   0,  80,  17, 
-      0,   0,   5,   0,   4,   0, 
-      4,   0, 116,   0,   0,   0, 
-      1,   0, 136,   0,  72,   0, 
-     20,   0,   4,   0,   0,   0, 
-     26,   0,  80,  17,   0,   0, 
-      5,   0,   8,   0,   4,   0, 
-    116,   0,   0,   0,   1,   0, 
-    136,   0,  72,   0,  20,   0, 
-      8,   0,   0,   0,  42,   0, 
-     77,  17, 144,   0,   0,   0, 
-     48,   3,   0,   0,   0,  16, 
-      0,   0,   7,   0,   9,   5, 
-     13,  51,   6,   4,  12,  68, 
-     48,   8,   0,   9,  21,  13, 
-     49,   1, 120,   3,   0,   9, 
-     12,  13,  50,  12,  28,  40, 
-     66,   0,  62,  17,   5,  16, 
-      0,   0, 136,   0,  60,  84, 
-    111, 110, 101,  77,  97, 112, 
-     72,  68,  82,  32, 114, 101, 
-    116, 117, 114, 110,  32, 118, 
-     97, 108, 117, 101,  62,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,  22,   0,  80,  17, 
-      0,   0,   5,   0,   0,   0, 
-      4,   0, 188,   0,   0,   0, 
-      1,   0,  20,   0,   0,   0, 
-      0,   0,  22,   0,  80,  17, 
-      0,   0,   5,   0,   4,   0, 
-      4,   0, 188,   0,   0,   0, 
-      1,   0,  20,   0,   4,   0, 
-      0,   0,  22,   0,  80,  17, 
-      0,   0,   5,   0,   8,   0, 
-      4,   0, 188,   0,   0,   0, 
-      1,   0,  20,   0,   8,   0, 
-      0,   0,   2,   0,  78,  17, 
-      2,   0,   6,   0, 244,   0, 
-      0,   0,  48,   0,   0,   0, 
-      1,   0,   0,   0,  16,   1, 
-    236,  14, 125,  53,  74, 178, 
-     80, 183, 218,   4, 152,  42, 
-     82,  76, 125,  97,   0,   0, 
-    134,   0,   0,   0,  16,   1, 
-    243,   4, 123,  95, 212, 230, 
-     88, 130,  41, 203, 197,  51, 
-    105,  65, 190, 234,   0,   0, 
-    242,   0,   0,   0, 216,   0, 
-      0,   0,   0,   0,   0,   0, 
-      1,   0,   1,   0, 252,   0, 
-      0,   0,   0,   0,   0,   0, 
-     16,   0,   0,   0, 204,   0, 
-      0,   0,  72,   0,   0,   0, 
-     38,   0,   0, 128,  72,   0, 
-      0,   0,  38,   0,   0,   0, 
-    116,   0,   0,   0,  40,   0, 
-      0, 128, 116,   0,   0,   0, 
-     40,   0,   0,   0, 120,   0, 
-      0,   0,  40,   0,   0, 128, 
-    120,   0,   0,   0,  40,   0, 
-      0,   0, 160,   0,   0,   0, 
-     40,   0,   0, 128, 160,   0, 
-      0,   0,  40,   0,   0,   0, 
-    188,   0,   0,   0,  40,   0, 
-      0, 128, 188,   0,   0,   0, 
-     40,   0,   0,   0, 208,   0, 
-      0,   0,  43,   0,   0, 128, 
-    208,   0,   0,   0,  43,   0, 
-      0,   0, 228,   0,   0,   0, 
-     43,   0,   0, 128, 228,   0, 
-      0,   0,  43,   0,   0,   0, 
-    248,   0,   0,   0,  43,   0, 
-      0, 128, 248,   0,   0,   0, 
-     43,   0,   0,   0,   5,   0, 
-     44,   0,  20,   0,  43,   0, 
-      5,   0,  30,   0,  13,   0, 
-     29,   0,   5,   0,  30,   0, 
-     13,   0,  29,   0,   5,   0, 
-     30,   0,  13,   0,  29,   0, 
-      5,   0,  30,   0,   5,   0, 
-     29,   0,   5,   0,  30,   0, 
-      5,   0,  30,   0,   5,   0, 
-     30,   0,   5,   0,  30,   0, 
-      5,   0,  30,   0,   5,   0, 
-     30,   0, 246,   0,   0,   0, 
-     20,   0,   0,   0,   1,   0, 
-      0,   0,   0,  16,   0,   0, 
-     24,   0,   0,   0,   3,   0, 
-      0,   0,   0,   0,   0,   0, 
-     12,   0,   0,   0,   0,   0, 
-      0,   0,  36,   0,   0,   0, 
-     60,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,  11, 202,  49,   1, 
-     56,   0,   0,   0,   0,  16, 
-      0,   0,  14,  16,   0,   0, 
-    208,   0,   0,   0,  11,   0, 
-    255, 255,   4,   0,   0,   0, 
-    255, 255,   3,   0,   0,   0, 
-      0,   0,  56,   0,   0,   0, 
-     56,   0,   0,   0,   8,   0, 
-      0,   0,  64,   0,   0,   0, 
-      0,   0,   0,   0,  22,   0, 
-     27,  21,  64,   0,   0,   0, 
-      3,   0,   0,   0,  12,   0, 
-    102, 108, 111,  97, 116,  51, 
-      0, 243, 242, 241,  10,   0, 
-      1,  18,   1,   0,   0,   0, 
-      0,  16,   0,   0,  22,   0, 
-     27,  21,  64,   0,   0,   0, 
-      4,   0,   0,   0,  16,   0, 
-    102, 108, 111,  97, 116,  52, 
-      0, 243, 242, 241,  10,   0, 
-     24,  21,   2,  16,   0,   0, 
-      1,   0,   1,   0,  14,   0, 
-      8,  16,   3,  16,   0,   0, 
-     23,   0,   1,   0,   1,  16, 
-      0,   0,  10,   0,  24,  21, 
-      0,  16,   0,   0,   1,   0, 
-      1,   0,  10,   0,   1,  18, 
-      1,   0,   0,   0,   5,  16, 
-      0,   0,  14,   0,   8,  16, 
-      5,  16,   0,   0,  23,   0, 
-      1,   0,   6,  16,   0,   0, 
-     14,   0,  23,  21,   2,  16, 
-      0,   0,   6,   2, 208, 138, 
-      0,   0, 242, 241,  10,   0, 
-     24,  21,   8,  16,   0,   0, 
-      1,   0,   1,   0,  10,   0, 
-     24,  21,   9,  16,   0,   0, 
-      1,   0,   0,   2,  14,   0, 
-     23,  21,   0,   0,   0,   0, 
-     10,   2, 208, 138,   0,   0, 
-    242, 241,  10,   0,  24,  21, 
-     11,  16,   0,   0,   1,   0, 
-      1,   0,  10,   0,  24,  21, 
-     12,  16,   0,   0,   1,   0, 
-      0,   2,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,  48, 224, 
-      3,   0,   0,  16,   0,   0, 
-      0,   0,   0,   0,   0,  16, 
-      0,   0,   0,   0,   0,   0, 
-    255, 255, 255, 255,   4,   0, 
-      0,   0, 255, 255,   3,   0, 
-      0,   0,   0,   0, 255, 255, 
-    255, 255,   0,   0,   0,   0, 
-    255, 255, 255, 255,   0,   0, 
-      0,   0, 255, 255, 255, 255, 
-     22,   0,  27,  21,  64,   0, 
-      0,   0,   3,   0,   0,   0, 
-     12,   0, 102, 108, 111,  97, 
-    116,  51,   0, 243, 242, 241, 
-     10,   0,   1,  18,   1,   0, 
-      0,   0,   0,  16,   0,   0, 
-     22,   0,  27,  21,  64,   0, 
-      0,   0,   4,   0,   0,   0, 
-     16,   0, 102, 108, 111,  97, 
-    116,  52,   0, 243, 242, 241, 
-     10,   0,  24,  21,   2,  16, 
-      0,   0,   1,   0,   1,   0, 
-     14,   0,   8,  16,   3,  16, 
-      0,   0,  23,   0,   1,   0, 
-      1,  16,   0,   0,  10,   0, 
-     24,  21,   0,  16,   0,   0, 
-      1,   0,   1,   0,  10,   0, 
-      1,  18,   1,   0,   0,   0, 
-      5,  16,   0,   0,  14,   0, 
-      8,  16,   5,  16,   0,   0, 
-     23,   0,   1,   0,   6,  16, 
-      0,   0,  14,   0,  23,  21, 
-      2,  16,   0,   0,   6,   2, 
-    208, 138,   0,   0, 242, 241, 
-     10,   0,  24,  21,   8,  16, 
-      0,   0,   1,   0,   1,   0, 
-     10,   0,  24,  21,   9,  16, 
-      0,   0,   1,   0,   0,   2, 
-     14,   0,  23,  21,   0,   0, 
-      0,   0,  10,   2, 208, 138, 
-      0,   0, 242, 241,  10,   0, 
-     24,  21,  11,  16,   0,   0, 
-      1,   0,   1,   0,  10,   0, 
-     24,  21,  12,  16,   0,   0, 
-      1,   0,   0,   2,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-     68,  51,  68,  83,  72,  68, 
-     82,   0, 252,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-     32,   0,   0,  96,   4,   0, 
-      0,   0,   8,   0,   0,   0, 
-     12,   0,   0,   0,   0,   0, 
-      0,   0,  22,   0,   1,  22, 
-      0,   0,   0,   0,   7,  16, 
-      0,   0,  84, 111, 110, 101, 
-     77,  97, 112,  72,  68,  82, 
-      0, 241,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0, 255, 255, 255, 255, 
-     26,   9,  47, 241,  24,   0, 
-      0,   0,  16,   2,   0,   0, 
-     37,   0,   0,   0,   1,   0, 
-      0,   0,  61,   0,   0,   0, 
-      1,   0,   0,   0,   1,   0, 
-      0,   0,   1,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,  16,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   2,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0, 128,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,  12,   0, 
-      0,   0,  24,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-     34,   0,  37,  17,   0,   0, 
-      0,   0, 144,   0,   0,   0, 
-      1,   0,  66,  97,  99, 107, 
-    103, 114, 111, 117, 110, 100, 
-     80, 105, 120, 101, 108,  83, 
-    104,  97, 100, 101, 114,   0, 
-     22,   0,  81,  17,  10,  16, 
-      0,   0,   7,   0, 255, 255, 
-    255, 255,   0,   0, 255, 255, 
-    255, 255, 116, 101, 120,   0, 
-     22,   0,  81,  17,  13,  16, 
-      0,   0,   6,   0, 255, 255, 
-    255, 255, 255, 255,   0,   0, 
-    255, 255, 115, 115,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,  16,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-    255, 255, 255, 255,  26,   9, 
-     47, 241,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0, 255, 255, 
-    255, 255, 119,   9,  49,   1, 
-      1,   0,   0,   0,  14,   0, 
-     20, 142,  15,   0,  20, 107, 
-     16,   0,   1,   0,  92,   0, 
-      0,   0,  32,   0,   0,   0, 
-     44,   0,   0,   0, 136,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,  22,   0, 
-      0,   0,  25,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      1,   0,   0,   0,   0,   0, 
-      0,   0, 252,   0,   0,   0, 
-     32,   0,   0,  96,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   2,   0, 
-     10,   0,  56,   3,   0,   0, 
-      0,   0,   0,   0,  52,   1, 
-      0,   0,   2,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-     66,  97,  99, 107, 103, 114, 
-    111, 117, 110, 100,  80, 105, 
-    120, 101, 108,  83, 104,  97, 
-    100, 101, 114,   0, 110, 111, 
-    110, 101,   0,   0,  45, 186, 
-     46, 241,   1,   0,   0,   0, 
-      0,   0,   0,   0, 252,   0, 
-      0,   0,  32,   0,   0,  96, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      2,   0,   2,   0,   7,   0, 
-      0,   0,   0,   0,   1,   0, 
-    255, 255, 255, 255,   0,   0, 
-      0,   0, 252,   0,   0,   0, 
-      8,   2,   0,   0,   0,   0, 
-      0,   0, 255, 255, 255, 255, 
-      0,   0,   0,   0, 255, 255, 
-    255, 255,   1,   0,   2,   0, 
-      0,   0,   2,   0,   0,   0, 
-      0,   0,  66,   0,   0,   0, 
-     69,  58,  92,  80, 114, 111, 
-    106, 101,  99, 116, 115,  92, 
-     78, 105,  99, 107, 101, 108, 
-     92,  78, 105,  99, 107, 101, 
-    108,  92,  68,  97, 116,  97, 
-     92,  83, 104,  97, 100, 101, 
-    114, 115,  92,  66,  97,  99, 
-    107, 103, 114, 111, 117, 110, 
-    100,  80, 105, 120, 101, 108, 
-     83, 104,  97, 100, 101, 114, 
-     46, 104, 108, 115, 108,   0, 
-     69,  58,  92,  80, 114, 111, 
-    106, 101,  99, 116, 115,  92, 
-     78, 105,  99, 107, 101, 108, 
-     92,  78, 105,  99, 107, 101, 
-    108,  92,  68,  97, 116,  97, 
-     92,  83, 104,  97, 100, 101, 
-    114, 115,  92,  80,  98, 114, 
-     72, 101, 108, 112, 101, 114, 
-     46, 104, 108, 115, 108,   0, 
-    254, 239, 254, 239,   1,   0, 
-      0,   0,   1,   0,   0,   0, 
-      0,   1,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255,  13, 
-      0, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-     47,  10,  32,  32,  32,  32, 
-    102, 108, 111,  97, 116,  32, 
-     77,  32,  61,  32, 109,  97, 
-    120,  40, 109,  97, 120,  40, 
-     97,  98, 115,  40, 100, 105, 
-    114,  46, 120,  41,  44,  32, 
-     97,  98, 115,  40, 100, 105, 
-    114,  46, 121,  41,  41,  44, 
-     32,  97,  98, 115,  40, 100, 
-    105, 114,  46, 122,  41,  41, 
-     59,  10,  10,  32,  32,  32, 
-     32, 105, 102,  32,  40,  97, 
-     98, 115,  40, 100, 105, 114, 
-     46, 120,  41,  32,  33,  61, 
-     32,  77,  41,  10,  32,  32, 
-     32,  32,  32,  32,  32,  32, 
-    100, 105, 114,  46, 120,  32, 
-     42,  61,  32, 115,  99,  97, 
-    108, 101,  59,  10,  10,  32, 
-     32,  32,  32, 105, 102,  32, 
-     40,  97,  98, 115,  40, 100, 
-    105, 114,  46, 121,  41,  32, 
-     33,  61,  32,  77,  41,  10, 
-     32,  32,  32,  32,  32,  32, 
-     32,  32, 100, 105, 114,  46, 
-    121,  32,  42,  61,  32, 115, 
-     99,  97, 108, 101,  59,  10, 
-     10,  32,  32,  32,  32, 105, 
-    102,  32,  40,  97,  98, 115, 
-     40, 100, 105, 114,  46, 122, 
-     41,  32,  33,  61,  32,  77, 
-     41,  10,  32,  32,  32,  32, 
-     32,  32,  32,  32, 100, 105, 
-    114,  46, 122,  32,  42,  61, 
-     32, 115,  99,  97, 108, 101, 
-     59,  10,  10,  32,  32,  32, 
-     32, 114, 101, 116, 117, 114, 
-    110,  32, 100, 105, 114,  59, 
-     10, 125,  10,  10, 102, 108, 
-    111,  97, 116,  52,  32, 116, 
-    101, 120, 116, 117, 114, 101, 
-     67, 117,  98, 101, 109,  97, 
-    112,  40,  99, 111, 110, 115, 
-    116,  32, 105, 110,  32, 115, 
-     97, 109, 112, 108, 101, 114, 
-     67, 117,  98, 101,  32, 116, 
-    101, 120,  44,  32,  99, 111, 
-    110, 115, 116,  32, 105, 110, 
-     32, 102, 108, 111,  97, 116, 
-     51,  32, 100, 105, 114,  41, 
-     32, 123,  10,  32,  32,  32, 
-     32, 102, 108, 111,  97, 116, 
-     52,  32, 114, 103,  98,  97, 
-     32,  61,  32, 116, 101, 120, 
-    116, 117, 114, 101,  67, 117, 
-     98, 101,  40, 116, 101, 120, 
-     44,  32, 100, 105, 114,  41, 
-     59,  10,  32,  32,  32,  32, 
-    114, 101, 116, 117, 114, 110, 
-     32,  76, 111, 103,  76, 117, 
-    118,  84, 111,  76, 105, 110, 
-    101,  97, 114,  40, 114, 103, 
-     98,  97,  41,  59,  10, 125, 
-     10,  10,  47,  47,  32,  83, 
-    101,  97, 109, 108, 101, 115, 
-    115,  32,  99, 117,  98, 101, 
-    109,  97, 112,  32, 102, 111, 
-    114,  32,  98,  97,  99, 107, 
-    103, 114, 111, 117, 110, 100, 
-     10, 102, 108, 111,  97, 116, 
-     52,  32, 116, 101, 120, 116, 
-    117, 114, 101,  67, 117,  98, 
-    101,  70, 105, 120, 101, 100, 
-     40,  99, 111, 110, 115, 116, 
-     32, 115,  97, 109, 112, 108, 
-    101, 114,  67, 117,  98, 101, 
-     32, 116, 101, 120,  44,  32, 
-     99, 111, 110, 115, 116,  32, 
-    102, 108, 111,  97, 116,  51, 
-     32, 100, 105, 114, 101,  99, 
-    116, 105, 111, 110,  41,  32, 
-    123,  10,  32,  32,  32,  32, 
-     47,  47,  32, 104, 116, 116, 
-    112,  58,  47,  47, 115, 101, 
-     98, 108,  97, 103,  97, 114, 
-    100, 101,  46, 119, 111, 114, 
-    100, 112, 114, 101, 115, 115, 
-     46,  99, 111, 109,  47,  50, 
-     48,  49,  50,  47,  48,  54, 
-     47,  49,  48,  47,  97, 109, 
-    100,  45,  99, 117,  98, 101, 
-    109,  97, 112, 103, 101, 110, 
-     45, 102, 111, 114,  45, 112, 
-    104, 121, 115, 105,  99,  97, 
-    108, 108, 121,  45,  98,  97, 
-    115, 101, 100,  45, 114, 101, 
-    110, 100, 101, 114, 105, 110, 
-    103,  47,  10,  32,  32,  32, 
-     32, 102, 108, 111,  97, 116, 
-     32, 115,  99,  97, 108, 101, 
-     32,  61,  32,  49,  46,  48, 
-     32,  45,  32,  49,  46,  48, 
-     32,  47,  32, 117,  69, 110, 
-    118, 105, 114, 111, 110, 109, 
-    101, 110, 116,  83, 105, 122, 
-    101,  91,  48,  93,  59,  10, 
-     32,  32,  32,  32, 118, 101, 
-     99,  51,  32, 100, 105, 114, 
-     32,  61,  32,  99, 117,  98, 
-    101, 109,  97, 112,  83, 101, 
-     97, 109, 108, 101, 115, 115, 
-     70, 105, 120,  68, 105, 114, 
-    101,  99, 116, 105, 111, 110, 
-     40, 100, 105, 114, 101,  99, 
-    116, 105, 111, 110,  44,  32, 
-    115,  99,  97, 108, 101,  41, 
-     59,  10,  32,  32,  32,  32, 
-    114, 101, 116, 117, 114, 110, 
-     32, 116, 101, 120, 116, 117, 
-    114, 101,  67, 117,  98, 101, 
-    109,  97, 112,  40, 116, 101, 
-    120,  44,  32, 100, 105, 114, 
-     41,  59,  10, 125,  10,  42, 
-     47,  10,  10, 102, 108, 111, 
-     97, 116,  52,  32,  66,  97, 
-     99, 107, 103, 114, 111, 117, 
-    110, 100,  80, 105, 120, 101, 
-    108,  83, 104,  97, 100, 101, 
-    114,  40, 102, 108, 111,  97, 
-    116,  51,  32, 119, 111, 114, 
-    108, 100,  80, 111, 115,  32, 
-     58,  32,  87,  79,  82,  76, 
-     68,  95,  80,  79,  83,  73, 
-     84,  73,  79,  78,  41,  32, 
-     58,  32,  83,  86,  95,  84, 
-     65,  82,  71,  69,  84, 123, 
-     10,  32,  32,  32,  32, 102, 
-    108, 111,  97, 116,  51,  32, 
-     99, 111, 108, 111, 114,  32, 
-     61,  32, 116, 101, 120,  46, 
-     83,  97, 109, 112, 108, 101, 
-     40, 115, 115,  44,  32, 119, 
-    111, 114, 108, 100,  80, 111, 
-    115,  41,  59,  10,  10,  32, 
-     32,  32,  32,  99, 111, 108, 
-    111, 114,  32,  61,  32,  84, 
-    111, 110, 101,  77,  97, 112, 
-     72,  68,  82,  40,  99, 111, 
-    108, 111, 114,  41,  59,  10, 
-     32,  32,  32,  32,  47,  47, 
-     32,  99, 111, 108, 111, 114, 
-     32,  61,  32,  67, 111, 114, 
-    114, 101,  99, 116,  71,  97, 
-    109, 109,  97,  40,  99, 111, 
-    108, 111, 114,  41,  59,  10, 
-     10,  32,  32,  32,  32, 114, 
-    101, 116, 117, 114, 110,  32, 
-    102, 108, 111,  97, 116,  52, 
-     40,  99, 111, 108, 111, 114, 
-     44,  32,  49,  46,  48,  41, 
-     59,  10, 125,   0, 115, 116, 
-     97, 116, 105,  99,  32,  99, 
-    111, 110, 115, 116,  32, 102, 
-    108, 111,  97, 116,  32,  80, 
-     73,  32,  61,  32,  51,  46, 
-     49,  52,  49,  53,  57,  50, 
-     54,  53,  51,  53,  57,  59, 
-     10,  10, 105, 110, 108, 105, 
-    110, 101,  32, 102, 108, 111, 
-     97, 116,  51,  32,  84, 111, 
-    110, 101,  77,  97, 112,  72, 
-     68,  82,  40,  99, 111, 110, 
-    115, 116,  32, 102, 108, 111, 
-     97, 116,  51,  32,  99, 111, 
-    108, 111, 114,  41,  32, 123, 
-     10,  32,  32,  32,  32,  47, 
-     47,  32,  82, 101, 105, 110, 
-    104,  97, 114, 100,  32, 111, 
-    112, 101, 114,  97, 116, 111, 
-    114,  10,  32,  32,  32,  32, 
-    114, 101, 116, 117, 114, 110, 
-     32,  99, 111, 108, 111, 114, 
-     32,  47,  32,  40,  99, 111, 
-    108, 111, 114,  32,  43,  32, 
-    102, 108, 111,  97, 116,  51, 
-     40,  49,  46,  48,  44,  32, 
-     49,  46,  48,  44,  32,  49, 
-     46,  48,  41,  41,  59,  10, 
-    125,  10,  10, 105, 110, 108, 
-    105, 110, 101,  32, 102, 108, 
-    111,  97, 116,  51,  32,  67, 
-    111, 114, 114, 101,  99, 116, 
-     71,  97, 109, 109,  97,  40, 
-     99, 111, 110, 115, 116,  32, 
-    102, 108, 111,  97, 116,  51, 
-     32,  99, 111, 108, 111, 114, 
-     41,  32, 123,  10,  32,  32, 
-     32,  32,  99, 111, 110, 115, 
-    116,  32, 102, 108, 111,  97, 
-    116,  32, 112, 111, 119,  78, 
-     32,  61,  32,  49,  46,  48, 
-     32,  47,  32,  50,  46,  50, 
-     59,  10,  32,  32,  32,  32, 
-    114, 101, 116, 117, 114, 110, 
-     32, 112, 111, 119,  40,  99, 
-    111, 108, 111, 114,  44,  32, 
-    102, 108, 111,  97, 116,  51, 
-     40, 112, 111, 119,  78,  44, 
-     32, 112, 111, 119,  78,  44, 
-     32, 112, 111, 119,  78,  41, 
-     41,  59,  10, 125,  10,  10, 
-    102, 108, 111,  97, 116,  32, 
-     68, 105, 115, 116, 114, 105, 
-     98, 117, 116, 105, 111, 110, 
-     71,  71,  88,  40, 102, 108, 
-    111,  97, 116,  51,  32,  78, 
-     44,  32, 102, 108, 111,  97, 
-    116,  51,  32,  72,  44,  32, 
-    102, 108, 111,  97, 116,  32, 
-    114, 111, 117, 103, 104, 110, 
-    101, 115, 115,  41,  32, 123, 
-     10,  32,  32,  32,  32, 102, 
-    108, 111,  97, 116,  32,  97, 
-     32,  61,  32, 114, 111, 117, 
-    103, 104, 110, 101, 115, 115, 
-     32,  42,  32, 114, 111, 117, 
-    103, 104, 110, 101, 115, 115, 
-     59,  10,  32,  32,  32,  32, 
-    102, 108, 111,  97, 116,  32, 
-     97,  50,  32,  61,  32,  97, 
-     32,  42,  32,  97,  59,  10, 
-     32,  32,  32,  32, 102, 108, 
-    111,  97, 116,  32,  78, 100, 
-    111, 116,  72,  32,  61,  32, 
-    109,  97, 120,  40, 100, 111, 
-    116,  40,  78,  44,  32,  72, 
-     41,  44,  32,  48,  46,  48, 
-     41,  59,  10,  32,  32,  32, 
-     32, 102, 108, 111,  97, 116, 
-     32,  78, 100, 111, 116,  72, 
-     50,  32,  61,  32,  78, 100, 
-    111, 116,  72,  32,  42,  32, 
-     78, 100, 111, 116,  72,  59, 
-     10,  10,  32,  32,  32,  32, 
-    102, 108, 111,  97, 116,  32, 
-    110, 117, 109,  32,  61,  32, 
-     97,  50,  59,  10,  32,  32, 
-     32,  32, 102, 108, 111,  97, 
-    116,  32, 100, 101, 110, 111, 
-    109,  32,  61,  32,  40,  78, 
-    100, 111, 116,  72,  50,  32, 
-     42,  32,  40,  97,  50,  32, 
-     45,  32,  49,  46,  48,  41, 
-     32,  43,  32,  49,  46,  48, 
-     41,  59,  10,  32,  32,  32, 
-     32, 100, 101, 110, 111, 109, 
-     32,  61,  32,  80,  73,  32, 
-     42,  32, 100, 101, 110, 111, 
-    109,  32,  42,  32, 100, 101, 
-    110, 111, 109,  59,  10,  10, 
-     32,  32,  32,  32, 114, 101, 
-    116, 117, 114, 110,  32, 110, 
-    117, 109,  32,  47,  32, 100, 
-    101, 110, 111, 109,  59,  10, 
-    125,  10,  10, 102, 108, 111, 
-     97, 116,  32,  71, 101, 111, 
-    109, 101, 116, 114, 121,  83, 
-     99, 104, 108, 105,  99, 107, 
-     71,  71,  88,  40, 102, 108, 
-    111,  97, 116,  32,  78, 100, 
-    111, 116,  86,  44,  32, 102, 
-    108, 111,  97, 116,  32, 114, 
-    111, 117, 103, 104, 110, 101, 
-    115, 115,  41,  32, 123,  10, 
-     32,  32,  32,  32, 102, 108, 
-    111,  97, 116,  32, 114,  32, 
-     61,  32,  40, 114, 111, 117, 
-    103, 104, 110, 101, 115, 115, 
-     32,  43,  32,  49,  46,  48, 
-     41,  59,  10,  32,  32,  32, 
-     32, 102, 108, 111,  97, 116, 
-     32, 107,  32,  61,  32,  40, 
-    114,  32,  42,  32, 114,  41, 
-     32,  47,  32,  56,  46,  48, 
-     59,  10,  10,  32,  32,  32, 
-     32, 102, 108, 111,  97, 116, 
-     32, 110, 117, 109,  32,  61, 
-     32,  78, 100, 111, 116,  86, 
-     59,  10,  32,  32,  32,  32, 
-    102, 108, 111,  97, 116,  32, 
-    100, 101, 110, 111, 109,  32, 
-     61,  32,  78, 100, 111, 116, 
-     86,  32,  42,  32,  40,  49, 
-     46,  48,  32,  45,  32, 107, 
-     41,  32,  43,  32, 107,  59, 
-     10,  10,  32,  32,  32,  32, 
-    114, 101, 116, 117, 114, 110, 
-     32, 110, 117, 109,  32,  47, 
-     32, 100, 101, 110, 111, 109, 
-     59,  10, 125,  10,  10, 102, 
-    108, 111,  97, 116,  32,  71, 
-    101, 111, 109, 101, 116, 114, 
-    121,  83, 109, 105, 116, 104, 
-     40, 102, 108, 111,  97, 116, 
-     51,  32,  78,  44,  32, 102, 
-    108, 111,  97, 116,  51,  32, 
-     86,  44,  32, 102, 108, 111, 
-     97, 116,  51,  32,  76,  44, 
-     32, 102, 108, 111,  97, 116, 
-     32, 114, 111, 117, 103, 104, 
-    110, 101, 115, 115,  41,  32, 
-    123,  10,  32,  32,  32,  32, 
-    102, 108, 111,  97, 116,  32, 
-     78, 100, 111, 116,  86,  32, 
-     61,  32, 109,  97, 120,  40, 
-    100, 111, 116,  40,  78,  44, 
-     32,  86,  41,  44,  32,  48, 
-     46,  48,  41,  59,  10,  32, 
-     32,  32,  32, 102, 108, 111, 
-     97, 116,  32,  78, 100, 111, 
-    116,  76,  32,  61,  32, 109, 
-     97, 120,  40, 100, 111, 116, 
-     40,  78,  44,  32,  76,  41, 
-     44,  32,  48,  46,  48,  41, 
-     59,  10,  32,  32,  32,  32, 
-    102, 108, 111,  97, 116,  32, 
-    103, 103, 120,  50,  32,  61, 
-     32,  71, 101, 111, 109, 101, 
-    116, 114, 121,  83,  99, 104, 
-    108, 105,  99, 107,  71,  71, 
-     88,  40,  78, 100, 111, 116, 
-     86,  44,  32, 114, 111, 117, 
-    103, 104, 110, 101, 115, 115, 
-     41,  59,  10,  32,  32,  32, 
-     32, 102, 108, 111,  97, 116, 
-     32, 103, 103, 120,  49,  32, 
-     61,  32,  71, 101, 111, 109, 
-    101, 116, 114, 121,  83,  99, 
-    104, 108, 105,  99, 107,  71, 
-     71,  88,  40,  78, 100, 111, 
-    116,  76,  44,  32, 114, 111, 
-    117, 103, 104, 110, 101, 115, 
-    115,  41,  59,  10,  10,  32, 
-     32,  32,  32, 114, 101, 116, 
-    117, 114, 110,  32, 103, 103, 
-    120,  49,  32,  42,  32, 103, 
-    103, 120,  50,  59,  10, 125, 
-     10,  10, 102, 108, 111,  97, 
-    116,  51,  32,  70, 114, 101, 
-    115, 110, 101, 108,  83,  99, 
-    104, 108, 105,  99, 107,  40, 
-    102, 108, 111,  97, 116,  32, 
-     99, 111, 115,  84, 104, 101, 
-    116,  97,  44,  32, 102, 108, 
-    111,  97, 116,  51,  32,  70, 
-     48,  41,  32, 123,  10,  32, 
-     32,  32,  32, 114, 101, 116, 
-    117, 114, 110,  32,  70,  48, 
-     32,  43,  32,  40,  49,  46, 
-     48,  32,  45,  32,  70,  48, 
-     41,  32,  42,  32, 112, 111, 
-    119,  40, 115,  97, 116, 117, 
-    114,  97, 116, 101,  40,  49, 
-     46,  48,  32,  45,  32,  99, 
-    111, 115,  84, 104, 101, 116, 
-     97,  41,  44,  32,  53,  46, 
-     48,  41,  59,  10, 125,  10, 
-     10, 102, 108, 111,  97, 116, 
-     51,  32,  70, 114, 101, 115, 
-    110, 101, 108,  83,  99, 104, 
-    108, 105,  99, 107,  82, 111, 
-    117, 103, 104, 110, 101, 115, 
-    115,  40, 102, 108, 111,  97, 
-    116,  32,  99, 111, 115,  84, 
-    104, 101, 116,  97,  44,  32, 
-    102, 108, 111,  97, 116,  51, 
-     32,  70,  48,  44,  32, 102, 
-    108, 111,  97, 116,  32, 114, 
-    111, 117, 103, 104, 110, 101, 
-    115, 115,  41,  32, 123,  10, 
-     32,  32,  32,  32,  99, 111, 
-    110, 115, 116,  32, 102, 108, 
-    111,  97, 116,  32, 111, 110, 
-    101,  77, 105, 110, 117, 115, 
-     82, 111, 117, 103, 104, 110, 
-    101, 115, 115,  32,  61,  32, 
-     49,  46,  48,  32,  45,  32, 
-    114, 111, 117, 103, 104, 110, 
-    101, 115, 115,  59,  10,  32, 
-     32,  32,  32, 114, 101, 116, 
-    117, 114, 110,  32,  70,  48, 
-     32,  43,  32,  40, 109,  97, 
-    120,  40, 102, 108, 111,  97, 
-    116,  51,  40, 111, 110, 101, 
-     77, 105, 110, 117, 115,  82, 
-    111, 117, 103, 104, 110, 101, 
-    115, 115,  44,  32, 111, 110, 
-    101,  77, 105, 110, 117, 115, 
-     82, 111, 117, 103, 104, 110, 
-    101, 115, 115,  44,  32, 111, 
-    110, 101,  77, 105, 110, 117, 
-    115,  82, 111, 117, 103, 104, 
-    110, 101, 115, 115,  41,  44, 
-     32,  70,  48,  41,  32,  45, 
-     32,  70,  48,  41,  32,  42, 
-     32, 112, 111, 119,  40, 115, 
-     97, 116, 117, 114,  97, 116, 
-    101,  40,  49,  46,  48,  32, 
-     45,  32,  99, 111, 115,  84, 
-    104, 101, 116,  97,  41,  44, 
-     32,  53,  46,  48,  41,  59, 
-     10, 125,   0,  11,   0,   0, 
-      0,   0,   0,   0,   0,  67, 
-      0,   0,   0,  68,   0,   0, 
-      0,   1,   0,   0,   0, 134, 
-      0,   0,   0, 188,   0,   0, 
-      0, 242,   0,   0,   0, 184, 
-      5,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   7,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0, 148,  46, 
-     49,   1, 138, 176, 147,  97, 
-      1,   0,   0,   0, 100, 119, 
-    239,  42,  66, 145, 169,  75, 
-    167, 178, 136, 194,  39, 160, 
-     88,  77, 176,   0,   0,   0, 
-     47,  76, 105, 110, 107,  73, 
-    110, 102, 111,   0,  47, 110, 
-     97, 109, 101, 115,   0,  47, 
-    115, 114,  99,  47, 104, 101, 
-     97, 100, 101, 114,  98, 108, 
-    111,  99, 107,   0,  47, 115, 
-    114,  99,  47, 102, 105, 108, 
-    101, 115,  47, 101,  58,  92, 
-    112, 114, 111, 106, 101,  99, 
-    116, 115,  92, 110, 105,  99, 
-    107, 101, 108,  92, 110, 105, 
-     99, 107, 101, 108,  92, 100, 
-     97, 116,  97,  92, 115, 104, 
-     97, 100, 101, 114, 115,  92, 
-     98,  97,  99, 107, 103, 114, 
-    111, 117, 110, 100, 112, 105, 
-    120, 101, 108, 115, 104,  97, 
-    100, 101, 114,  46, 104, 108, 
-    115, 108,   0,  47, 115, 114, 
-     99,  47, 102, 105, 108, 101, 
-    115,  47, 101,  58,  92, 112, 
-    114, 111, 106, 101,  99, 116, 
-    115,  92, 110, 105,  99, 107, 
-    101, 108,  92, 110, 105,  99, 
-    107, 101, 108,  92, 100,  97, 
-    116,  97,  92, 115, 104,  97, 
-    100, 101, 114, 115,  92, 112, 
-     98, 114, 104, 101, 108, 112, 
-    101, 114,  46, 104, 108, 115, 
-    108,   0,   5,   0,   0,   0, 
-     10,   0,   0,   0,   1,   0, 
-      0,   0,  62,   0,   0,   0, 
-      0,   0,   0,   0,  17,   0, 
-      0,   0,   7,   0,   0,   0, 
-      0,   0,   0,   0,   5,   0, 
-      0,   0, 111,   0,   0,   0, 
-      9,   0,   0,   0,  34,   0, 
-      0,   0,   8,   0,   0,   0, 
-     10,   0,   0,   0,   6,   0, 
-      0,   0,   0,   0,   0,   0, 
-    220,  81,  51,   1,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-     17,   0,   0,   0,  32,   0, 
-      0,   0,  20,   1,   0,   0, 
-      8,   1,   0,   0, 159,   1, 
-      0,   0,  80,   0,   0,   0, 
-      0,   0,   0,   0, 217,  11, 
-      0,   0, 172,   0,   0,   0, 
-    197,   4,   0,   0, 224,   5, 
-      0,   0, 124,   4,   0,   0, 
-     64,   0,   0,   0,  12,   0, 
-      0,   0,  40,   0,   0,   0, 
-     56,   2,   0,   0,  44,   0, 
-      0,   0,  84,   0,   0,   0, 
-      3,   0,   0,   0,  32,   0, 
-      0,   0,  19,   0,   0,   0, 
-     26,   0,   0,   0,   6,   0, 
-      0,   0,  14,   0,   0,   0, 
-     27,   0,   0,   0,  28,   0, 
-      0,   0,  29,   0,   0,   0, 
-     30,   0,   0,   0,  31,   0, 
-      0,   0,  15,   0,   0,   0, 
-      8,   0,   0,   0,   9,   0, 
-      0,   0,  10,   0,   0,   0, 
-     11,   0,   0,   0,  12,   0, 
-      0,   0,  13,   0,   0,   0, 
-     16,   0,   0,   0,  17,   0, 
-      0,   0,  18,   0,   0,   0, 
-      7,   0,   0,   0,  20,   0, 
-      0,   0,  21,   0,   0,   0, 
-     22,   0,   0,   0,  23,   0, 
-      0,   0,  25,   0,   0,   0, 
-     24,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,  33,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0
-};
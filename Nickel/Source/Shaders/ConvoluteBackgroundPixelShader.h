@@ -1,3835 +0,0 @@
-#if 0
-//
-// Generated by Microsoft (R) HLSL Shader Compiler 10.1
-//
-//
-// Resource Bindings:
-//
-// Name                                 Type  Format         Dim      HLSL Bind  Count
-// ------------------------------ ---------- ------- ----------- -------------- ------
-// ss                                sampler      NA          NA             s0      1 
-// tex                               texture  float4        cube             t0      1 
-//
-//
-//
-// Input signature:
-//
-// Name                 Index   Mask Register SysValue  Format   Used
-// -------------------- ----- ------ -------- -------- ------- ------
-// WORLD_POSITION           0   xyz         0     NONE   float   xyz 
-//
-//
-// Output signature:
-//
-// Name                 Index   Mask Register SysValue  Format   Used
-// -------------------- ----- ------ -------- -------- ------- ------
-// SV_TARGET                0   xyzw        0   TARGET   float   xyzw
-//
-ps_5_0
-dcl_globalFlags refactoringAllowed | skipOptimization
-dcl_sampler s0, mode_default
-dcl_resource_texturecube (float,float,float,float) t0
-dcl_input_ps linear v0.xyz
-dcl_output o0.xyzw
-dcl_temps 9
-//
-// Initial variable locations:
-//   v0.x <- worldPos.x; v0.y <- worldPos.y; v0.z <- worldPos.z; 
-//   o0.x <- <ConvoluteBackgroundPixelShader return value>.x; o0.y <- <ConvoluteBackgroundPixelShader return value>.y; o0.z <- <ConvoluteBackgroundPixelShader return value>.z; o0.w <- <ConvoluteBackgroundPixelShader return value>.w
-//
-#line 1 "E:\Projects\Nickel\Nickel\Data\Shaders\PbrHelper.hlsl"
-mov r0.x, l(3.141593)  // r0.x <- PI
-
-#line 8 "E:\Projects\Nickel\Nickel\Data\Shaders\ConvoluteBackgroundPixelShader.hlsl"
-dp3 r0.y, v0.xyzx, v0.xyzx
-rsq r0.y, r0.y
-mul r0.yzw, r0.yyyy, v0.xxyz  // r0.y <- N.x; r0.z <- N.y; r0.w <- N.z
-
-#line 9
-mov r1.xyz, l(0,0,0,0)  // r1.x <- irradiance.x; r1.y <- irradiance.y; r1.z <- irradiance.z
-
-#line 11
-mov r2.xyz, l(0,0,1.000000,0)  // r2.x <- up.z; r2.y <- up.x; r2.z <- up.y
-
-#line 12
-mul r3.xyz, r0.wyzw, r2.zxyz
-mul r2.xyz, r0.zwyz, r2.xyzx
-mov r2.xyz, -r2.xyzx
-add r2.xyz, r2.xyzx, r3.xyzx
-dp3 r1.w, r2.xyzx, r2.xyzx
-rsq r1.w, r1.w
-mul r2.xyz, r1.wwww, r2.xyzx  // r2.x <- right.x; r2.y <- right.y; r2.z <- right.z
-
-#line 13
-mul r3.xyz, r0.zwyz, r2.zxyz
-mul r4.xyz, r0.wyzw, r2.yzxy
-mov r4.xyz, -r4.xyzx
-add r3.xyz, r3.xyzx, r4.xyzx
-dp3 r1.w, r3.xyzx, r3.xyzx
-rsq r1.w, r1.w
-mul r3.xyz, r1.wwww, r3.xyzx  // r3.x <- up.x; r3.y <- up.y; r3.z <- up.z
-
-#line 15
-mov r1.w, l(0.025000)  // r1.w <- sampleDelta
-
-#line 16
-mov r2.w, l(0)  // r2.w <- nrSamples
-
-#line 17
-mov r3.w, l(0)  // r3.w <- phi
-mov r4.xyz, r1.xyzx  // r4.x <- irradiance.x; r4.y <- irradiance.y; r4.z <- irradiance.z
-mov r4.w, r2.w  // r4.w <- nrSamples
-mov r5.x, r3.w  // r5.x <- phi
-loop 
-  lt r5.y, r5.x, l(6.283185)
-  breakc_z r5.y
-
-#line 18
-  mov r5.y, l(0)  // r5.y <- theta
-  mov r6.xyz, r4.xyzx  // r6.x <- irradiance.x; r6.y <- irradiance.y; r6.z <- irradiance.z
-  mov r5.z, r4.w  // r5.z <- nrSamples
-  mov r5.w, r5.y  // r5.w <- theta
-  loop 
-    lt r6.w, r5.w, l(1.570796)
-    breakc_z r6.w
-
-#line 20
-    sincos r6.w, null, r5.w
-    sincos null, r7.x, r5.x
-    mul r6.w, r6.w, r7.x  // r6.w <- tangentSample.x
-    sincos r7.x, null, r5.w
-    sincos r7.y, null, r5.x
-    mul r7.x, r7.y, r7.x  // r7.x <- tangentSample.y
-    sincos null, r7.y, r5.w  // r7.y <- tangentSample.z
-
-#line 22
-    mul r8.xyz, r2.xyzx, r6.wwww
-    mul r7.xzw, r3.xxyz, r7.xxxx
-    add r7.xzw, r7.xxzw, r8.xxyz
-    mul r8.xyz, r0.yzwy, r7.yyyy
-    add r7.xyz, r7.xzwx, r8.xyzx  // r7.x <- sampleVec.x; r7.y <- sampleVec.y; r7.z <- sampleVec.z
-
-#line 24
-    sample_indexable(texturecube)(float,float,float,float) r7.xyz, r7.xyzx, t0.xyzw, s0
-    sincos null, r6.w, r5.w
-    mul r7.xyz, r6.wwww, r7.xyzx
-    sincos r6.w, null, r5.w
-    mul r7.xyz, r6.wwww, r7.xyzx
-    add r6.xyz, r6.xyzx, r7.xyzx
-
-#line 25
-    add r5.z, r5.z, l(1.000000)
-
-#line 26
-    add r5.w, r1.w, r5.w
-  endloop 
-  mov r4.xyz, r6.xyzx  // r4.x <- irradiance.x; r4.y <- irradiance.y; r4.z <- irradiance.z
-  mov r4.w, r5.z  // r4.w <- nrSamples
-
-#line 27
-  add r5.x, r1.w, r5.x
-endloop 
-
-#line 28
-mul r0.xyz, r0.xxxx, r4.xyzx
-div r0.w, l(1.000000), r4.w
-mul r0.xyz, r0.wwww, r0.xyzx  // r0.x <- irradiance.x; r0.y <- irradiance.y; r0.z <- irradiance.z
-
-#line 30
-mov o0.xyz, r0.xyzx
-mov o0.w, l(1.000000)
-ret 
-// Approximately 67 instruction slots used
-#endif
-
-const BYTE g_ConvoluteBackgroundPixelShader[] =
-{
-     68,  88,  66,  67,  75, 225, 
-     92,  51, 110,  11,  30,  14, 
-    213,  71,  51, 211, 184,  60, 
-     61,  21,   1,   0,   0,   0, 
-    108,  86,   0,   0,   6,   0, 
-      0,   0,  56,   0,   0,   0, 
-    236,   0,   0,   0,  36,   1, 
-      0,   0,  88,   1,   0,   0, 
-    200,   7,   0,   0, 100,   8, 
-      0,   0,  82,  68,  69,  70, 
-    172,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      2,   0,   0,   0,  60,   0, 
-      0,   0,   0,   5, 255, 255, 
-      5,   1,   0,   0, 131,   0, 
-      0,   0,  82,  68,  49,  49, 
-     60,   0,   0,   0,  24,   0, 
-      0,   0,  32,   0,   0,   0, 
-     40,   0,   0,   0,  36,   0, 
-      0,   0,  12,   0,   0,   0, 
-      0,   0,   0,   0, 124,   0, 
-      0,   0,   3,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   1,   0, 
-      0,   0,   1,   0,   0,   0, 
-    127,   0,   0,   0,   2,   0, 
-      0,   0,   5,   0,   0,   0, 
-      9,   0,   0,   0, 255, 255, 
-    255, 255,   0,   0,   0,   0, 
-      1,   0,   0,   0,  13,   0, 
-      0,   0, 115, 115,   0, 116, 
-    101, 120,   0,  77, 105,  99, 
-    114, 111, 115, 111, 102, 116, 
-     32,  40,  82,  41,  32,  72, 
-     76,  83,  76,  32,  83, 104, 
-     97, 100, 101, 114,  32,  67, 
-    111, 109, 112, 105, 108, 101, 
-    114,  32,  49,  48,  46,  49, 
-      0, 171,  73,  83,  71,  78, 
-     48,   0,   0,   0,   1,   0, 
-      0,   0,   8,   0,   0,   0, 
-     32,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      3,   0,   0,   0,   0,   0, 
-      0,   0,   7,   7,   0,   0, 
-     87,  79,  82,  76,  68,  95, 
-     80,  79,  83,  73,  84,  73, 
-     79,  78,   0, 171,  79,  83, 
-     71,  78,  44,   0,   0,   0, 
-      1,   0,   0,   0,   8,   0, 
-      0,   0,  32,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   3,   0,   0,   0, 
-      0,   0,   0,   0,  15,   0, 
-      0,   0,  83,  86,  95,  84, 
-     65,  82,  71,  69,  84,   0, 
-    171, 171,  83,  72,  69,  88, 
-    104,   6,   0,   0,  80,   0, 
-      0,   0, 154,   1,   0,   0, 
-    106, 136,   0,   1,  90,   0, 
-      0,   3,   0,  96,  16,   0, 
-      0,   0,   0,   0,  88,  48, 
-      0,   4,   0, 112,  16,   0, 
-      0,   0,   0,   0,  85,  85, 
-      0,   0,  98,  16,   0,   3, 
-    114,  16,  16,   0,   0,   0, 
-      0,   0, 101,   0,   0,   3, 
-    242,  32,  16,   0,   0,   0, 
-      0,   0, 104,   0,   0,   2, 
-      9,   0,   0,   0,  54,   0, 
-      0,   5,  18,   0,  16,   0, 
-      0,   0,   0,   0,   1,  64, 
-      0,   0, 219,  15,  73,  64, 
-     16,   0,   0,   7,  34,   0, 
-     16,   0,   0,   0,   0,   0, 
-     70,  18,  16,   0,   0,   0, 
-      0,   0,  70,  18,  16,   0, 
-      0,   0,   0,   0,  68,   0, 
-      0,   5,  34,   0,  16,   0, 
-      0,   0,   0,   0,  26,   0, 
-     16,   0,   0,   0,   0,   0, 
-     56,   0,   0,   7, 226,   0, 
-     16,   0,   0,   0,   0,   0, 
-     86,   5,  16,   0,   0,   0, 
-      0,   0,   6,  25,  16,   0, 
-      0,   0,   0,   0,  54,   0, 
-      0,   8, 114,   0,  16,   0, 
-      1,   0,   0,   0,   2,  64, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-     54,   0,   0,   8, 114,   0, 
-     16,   0,   2,   0,   0,   0, 
-      2,  64,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0, 128,  63,   0,   0, 
-      0,   0,  56,   0,   0,   7, 
-    114,   0,  16,   0,   3,   0, 
-      0,   0, 118,  14,  16,   0, 
-      0,   0,   0,   0,  38,   9, 
-     16,   0,   2,   0,   0,   0, 
-     56,   0,   0,   7, 114,   0, 
-     16,   0,   2,   0,   0,   0, 
-    230,   9,  16,   0,   0,   0, 
-      0,   0,  70,   2,  16,   0, 
-      2,   0,   0,   0,  54,   0, 
-      0,   6, 114,   0,  16,   0, 
-      2,   0,   0,   0,  70,   2, 
-     16, 128,  65,   0,   0,   0, 
-      2,   0,   0,   0,   0,   0, 
-      0,   7, 114,   0,  16,   0, 
-      2,   0,   0,   0,  70,   2, 
-     16,   0,   2,   0,   0,   0, 
-     70,   2,  16,   0,   3,   0, 
-      0,   0,  16,   0,   0,   7, 
-    130,   0,  16,   0,   1,   0, 
-      0,   0,  70,   2,  16,   0, 
-      2,   0,   0,   0,  70,   2, 
-     16,   0,   2,   0,   0,   0, 
-     68,   0,   0,   5, 130,   0, 
-     16,   0,   1,   0,   0,   0, 
-     58,   0,  16,   0,   1,   0, 
-      0,   0,  56,   0,   0,   7, 
-    114,   0,  16,   0,   2,   0, 
-      0,   0, 246,  15,  16,   0, 
-      1,   0,   0,   0,  70,   2, 
-     16,   0,   2,   0,   0,   0, 
-     56,   0,   0,   7, 114,   0, 
-     16,   0,   3,   0,   0,   0, 
-    230,   9,  16,   0,   0,   0, 
-      0,   0,  38,   9,  16,   0, 
-      2,   0,   0,   0,  56,   0, 
-      0,   7, 114,   0,  16,   0, 
-      4,   0,   0,   0, 118,  14, 
-     16,   0,   0,   0,   0,   0, 
-    150,   4,  16,   0,   2,   0, 
-      0,   0,  54,   0,   0,   6, 
-    114,   0,  16,   0,   4,   0, 
-      0,   0,  70,   2,  16, 128, 
-     65,   0,   0,   0,   4,   0, 
-      0,   0,   0,   0,   0,   7, 
-    114,   0,  16,   0,   3,   0, 
-      0,   0,  70,   2,  16,   0, 
-      3,   0,   0,   0,  70,   2, 
-     16,   0,   4,   0,   0,   0, 
-     16,   0,   0,   7, 130,   0, 
-     16,   0,   1,   0,   0,   0, 
-     70,   2,  16,   0,   3,   0, 
-      0,   0,  70,   2,  16,   0, 
-      3,   0,   0,   0,  68,   0, 
-      0,   5, 130,   0,  16,   0, 
-      1,   0,   0,   0,  58,   0, 
-     16,   0,   1,   0,   0,   0, 
-     56,   0,   0,   7, 114,   0, 
-     16,   0,   3,   0,   0,   0, 
-    246,  15,  16,   0,   1,   0, 
-      0,   0,  70,   2,  16,   0, 
-      3,   0,   0,   0,  54,   0, 
-      0,   5, 130,   0,  16,   0, 
-      1,   0,   0,   0,   1,  64, 
-      0,   0, 205, 204, 204,  60, 
-     54,   0,   0,   5, 130,   0, 
-     16,   0,   2,   0,   0,   0, 
-      1,  64,   0,   0,   0,   0, 
-      0,   0,  54,   0,   0,   5, 
-    130,   0,  16,   0,   3,   0, 
-      0,   0,   1,  64,   0,   0, 
-      0,   0,   0,   0,  54,   0, 
-      0,   5, 114,   0,  16,   0, 
-      4,   0,   0,   0,  70,   2, 
-     16,   0,   1,   0,   0,   0, 
-     54,   0,   0,   5, 130,   0, 
-     16,   0,   4,   0,   0,   0, 
-     58,   0,  16,   0,   2,   0, 
-      0,   0,  54,   0,   0,   5, 
-     18,   0,  16,   0,   5,   0, 
-      0,   0,  58,   0,  16,   0, 
-      3,   0,   0,   0,  48,   0, 
-      0,   1,  49,   0,   0,   7, 
-     34,   0,  16,   0,   5,   0, 
-      0,   0,  10,   0,  16,   0, 
-      5,   0,   0,   0,   1,  64, 
-      0,   0, 219,  15, 201,  64, 
-      3,   0,   0,   3,  26,   0, 
-     16,   0,   5,   0,   0,   0, 
-     54,   0,   0,   5,  34,   0, 
-     16,   0,   5,   0,   0,   0, 
-      1,  64,   0,   0,   0,   0, 
-      0,   0,  54,   0,   0,   5, 
-    114,   0,  16,   0,   6,   0, 
-      0,   0,  70,   2,  16,   0, 
-      4,   0,   0,   0,  54,   0, 
-      0,   5,  66,   0,  16,   0, 
-      5,   0,   0,   0,  58,   0, 
-     16,   0,   4,   0,   0,   0, 
-     54,   0,   0,   5, 130,   0, 
-     16,   0,   5,   0,   0,   0, 
-     26,   0,  16,   0,   5,   0, 
-      0,   0,  48,   0,   0,   1, 
-     49,   0,   0,   7, 130,   0, 
-     16,   0,   6,   0,   0,   0, 
-     58,   0,  16,   0,   5,   0, 
-      0,   0,   1,  64,   0,   0, 
-    219,  15, 201,  63,   3,   0, 
-      0,   3,  58,   0,  16,   0, 
-      6,   0,   0,   0,  77,   0, 
-      0,   6, 130,   0,  16,   0, 
-      6,   0,   0,   0,   0, 208, 
-      0,   0,  58,   0,  16,   0, 
-      5,   0,   0,   0,  77,   0, 
-      0,   6,   0, 208,   0,   0, 
-     18,   0,  16,   0,   7,   0, 
-      0,   0,  10,   0,  16,   0, 
-      5,   0,   0,   0,  56,   0, 
-      0,   7, 130,   0,  16,   0, 
-      6,   0,   0,   0,  58,   0, 
-     16,   0,   6,   0,   0,   0, 
-     10,   0,  16,   0,   7,   0, 
-      0,   0,  77,   0,   0,   6, 
-     18,   0,  16,   0,   7,   0, 
-      0,   0,   0, 208,   0,   0, 
-     58,   0,  16,   0,   5,   0, 
-      0,   0,  77,   0,   0,   6, 
-     34,   0,  16,   0,   7,   0, 
-      0,   0,   0, 208,   0,   0, 
-     10,   0,  16,   0,   5,   0, 
-      0,   0,  56,   0,   0,   7, 
-     18,   0,  16,   0,   7,   0, 
-      0,   0,  26,   0,  16,   0, 
-      7,   0,   0,   0,  10,   0, 
-     16,   0,   7,   0,   0,   0, 
-     77,   0,   0,   6,   0, 208, 
-      0,   0,  34,   0,  16,   0, 
-      7,   0,   0,   0,  58,   0, 
-     16,   0,   5,   0,   0,   0, 
-     56,   0,   0,   7, 114,   0, 
-     16,   0,   8,   0,   0,   0, 
-     70,   2,  16,   0,   2,   0, 
-      0,   0, 246,  15,  16,   0, 
-      6,   0,   0,   0,  56,   0, 
-      0,   7, 210,   0,  16,   0, 
-      7,   0,   0,   0,   6,   9, 
-     16,   0,   3,   0,   0,   0, 
-      6,   0,  16,   0,   7,   0, 
-      0,   0,   0,   0,   0,   7, 
-    210,   0,  16,   0,   7,   0, 
-      0,   0,   6,  14,  16,   0, 
-      7,   0,   0,   0,   6,   9, 
-     16,   0,   8,   0,   0,   0, 
-     56,   0,   0,   7, 114,   0, 
-     16,   0,   8,   0,   0,   0, 
-    150,   7,  16,   0,   0,   0, 
-      0,   0,  86,   5,  16,   0, 
-      7,   0,   0,   0,   0,   0, 
-      0,   7, 114,   0,  16,   0, 
-      7,   0,   0,   0, 134,   3, 
-     16,   0,   7,   0,   0,   0, 
-     70,   2,  16,   0,   8,   0, 
-      0,   0,  69,   0,   0, 139, 
-    130,   1,   0, 128,  67,  85, 
-     21,   0, 114,   0,  16,   0, 
-      7,   0,   0,   0,  70,   2, 
-     16,   0,   7,   0,   0,   0, 
-     70, 126,  16,   0,   0,   0, 
-      0,   0,   0,  96,  16,   0, 
-      0,   0,   0,   0,  77,   0, 
-      0,   6,   0, 208,   0,   0, 
-    130,   0,  16,   0,   6,   0, 
-      0,   0,  58,   0,  16,   0, 
-      5,   0,   0,   0,  56,   0, 
-      0,   7, 114,   0,  16,   0, 
-      7,   0,   0,   0, 246,  15, 
-     16,   0,   6,   0,   0,   0, 
-     70,   2,  16,   0,   7,   0, 
-      0,   0,  77,   0,   0,   6, 
-    130,   0,  16,   0,   6,   0, 
-      0,   0,   0, 208,   0,   0, 
-     58,   0,  16,   0,   5,   0, 
-      0,   0,  56,   0,   0,   7, 
-    114,   0,  16,   0,   7,   0, 
-      0,   0, 246,  15,  16,   0, 
-      6,   0,   0,   0,  70,   2, 
-     16,   0,   7,   0,   0,   0, 
-      0,   0,   0,   7, 114,   0, 
-     16,   0,   6,   0,   0,   0, 
-     70,   2,  16,   0,   6,   0, 
-      0,   0,  70,   2,  16,   0, 
-      7,   0,   0,   0,   0,   0, 
-      0,   7,  66,   0,  16,   0, 
-      5,   0,   0,   0,  42,   0, 
-     16,   0,   5,   0,   0,   0, 
-      1,  64,   0,   0,   0,   0, 
-    128,  63,   0,   0,   0,   7, 
-    130,   0,  16,   0,   5,   0, 
-      0,   0,  58,   0,  16,   0, 
-      1,   0,   0,   0,  58,   0, 
-     16,   0,   5,   0,   0,   0, 
-     22,   0,   0,   1,  54,   0, 
-      0,   5, 114,   0,  16,   0, 
-      4,   0,   0,   0,  70,   2, 
-     16,   0,   6,   0,   0,   0, 
-     54,   0,   0,   5, 130,   0, 
-     16,   0,   4,   0,   0,   0, 
-     42,   0,  16,   0,   5,   0, 
-      0,   0,   0,   0,   0,   7, 
-     18,   0,  16,   0,   5,   0, 
-      0,   0,  58,   0,  16,   0, 
-      1,   0,   0,   0,  10,   0, 
-     16,   0,   5,   0,   0,   0, 
-     22,   0,   0,   1,  56,   0, 
-      0,   7, 114,   0,  16,   0, 
-      0,   0,   0,   0,   6,   0, 
-     16,   0,   0,   0,   0,   0, 
-     70,   2,  16,   0,   4,   0, 
-      0,   0,  14,   0,   0,   7, 
-    130,   0,  16,   0,   0,   0, 
-      0,   0,   1,  64,   0,   0, 
-      0,   0, 128,  63,  58,   0, 
-     16,   0,   4,   0,   0,   0, 
-     56,   0,   0,   7, 114,   0, 
-     16,   0,   0,   0,   0,   0, 
-    246,  15,  16,   0,   0,   0, 
-      0,   0,  70,   2,  16,   0, 
-      0,   0,   0,   0,  54,   0, 
-      0,   5, 114,  32,  16,   0, 
-      0,   0,   0,   0,  70,   2, 
-     16,   0,   0,   0,   0,   0, 
-     54,   0,   0,   5, 130,  32, 
-     16,   0,   0,   0,   0,   0, 
-      1,  64,   0,   0,   0,   0, 
-    128,  63,  62,   0,   0,   1, 
-     83,  84,  65,  84, 148,   0, 
-      0,   0,  67,   0,   0,   0, 
-      9,   0,   0,   0,   0,   0, 
-      0,   0,   2,   0,   0,   0, 
-     42,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      1,   0,   0,   0,   2,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   1,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-     17,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-     83,  80,  68,  66,   0,  78, 
-      0,   0,  77, 105,  99, 114, 
-    111, 115, 111, 102, 116,  32, 
-     67,  47,  67,  43,  43,  32, 
-     77,  83,  70,  32,  55,  46, 
-     48,  48,  13,  10,  26,  68, 
-     83,   0,   0,   0,   0,   2, 
-      0,   0,   2,   0,   0,   0, 
-     39,   0,   0,   0, 200,   0, 
-      0,   0,   0,   0,   0,   0, 
-     38,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0, 192, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-     56,   0,   0,   0, 128, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255,   5,   0,   0,   0, 
-     32,   0,   0,   0,  60,   0, 
-      0,   0,   0,   0,   0,   0, 
-    255, 255, 255, 255,   0,   0, 
-      0,   0,   6,   0,   0,   0, 
-      5,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   3,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-    148,  46,  49,   1, 138, 176, 
-    147,  97,   1,   0,   0,   0, 
-    120, 101, 141, 102, 194, 143, 
-     36,  67, 146,  28, 136, 184, 
-     77, 246, 154,  41,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      1,   0,   0,   0,   1,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0, 220,  81,  51,   1, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,  68,  51,  68,  83, 
-     72,  68,  82,   0, 104,   6, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,  32,   0,   0,  96, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,  76, 232, 
-      3,   0,  25,  96,   3,   0, 
-    198,  90,   0,   0, 229,  18, 
-      2,   0, 193, 145,   0,   0, 
-    146, 230,   3,   0, 201, 233, 
-      0,   0,  49, 251,   3,   0, 
-    201, 190,   0,   0, 250, 175, 
-      2,   0, 206,  55,   0,   0, 
-     57, 206,   1,   0,   0,  16, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-     84, 101, 120, 116, 117, 114, 
-    101,  67, 117,  98, 101,  32, 
-    116, 101, 120,  32,  58,  32, 
-    114, 101, 103, 105, 115, 116, 
-    101, 114,  40, 116,  48,  41, 
-     59,  10,  83,  97, 109, 112, 
-    108, 101, 114,  83, 116,  97, 
-    116, 101,  32, 115, 115,  32, 
-     58,  32, 114, 101, 103, 105, 
-    115, 116, 101, 114,  40, 115, 
-     48,  41,  59,  10,  10,  35, 
-    105, 110,  99, 108, 117, 100, 
-    101,  32,  34,  80,  98, 114, 
-     72, 101, 108, 112, 101, 114, 
-     46, 104, 108, 115, 108,  34, 
-     10,  10, 102, 108, 111,  97, 
-    116,  52,  32,  67, 111, 110, 
-    118, 111, 108, 117, 116, 101, 
-     66,  97,  99, 107, 103, 114, 
-    111, 117, 110, 100,  80, 105, 
-    120, 101, 108,  83, 104,  97, 
-    100, 101, 114,  40, 102, 108, 
-    111,  97, 116,  51,  32, 119, 
-    111, 114, 108, 100,  80, 111, 
-    115,  32,  58,  32,  87,  79, 
-     82,  76,  68,  95,  80,  79, 
-     83,  73,  84,  73,  79,  78, 
-     41,  32,  58,  32,  83,  86, 
-     95,  84,  65,  82,  71,  69, 
-     84,  10, 123,  10,  32,  32, 
-     32,  32, 102, 108, 111,  97, 
-    116,  51,  32,  78,  32,  61, 
-     32, 110, 111, 114, 109,  97, 
-    108, 105, 122, 101,  40, 119, 
-    111, 114, 108, 100,  80, 111, 
-    115,  41,  59,  10,   9, 102, 
-    108, 111,  97, 116,  51,  32, 
-    105, 114, 114,  97, 100, 105, 
-     97, 110,  99, 101,  32,  61, 
-     32, 102, 108, 111,  97, 116, 
-     51,  40,  48,  46,  48,  44, 
-     32,  48,  46,  48,  44,  32, 
-     48,  46,  48,  41,  59,  10, 
-     10,  32,  32,  32,  32, 102, 
-    108, 111,  97, 116,  51,  32, 
-    117, 112,  32,  61,  32, 102, 
-    108, 111,  97, 116,  51,  40, 
-     48,  46,  48,  44,  32,  49, 
-     46,  48,  44,  32,  48,  46, 
-     48,  41,  59,  10,  32,  32, 
-     32,  32, 102, 108, 111,  97, 
-    116,  51,  32, 114, 105, 103, 
-    104, 116,  32,  61,  32, 110, 
-    111, 114, 109,  97, 108, 105, 
-    122, 101,  40,  99, 114, 111, 
-    115, 115,  40, 117, 112,  44, 
-     32,  78,  41,  41,  59,  10, 
-     32,  32,  32,  32, 117, 112, 
-     32,  61,  32, 110, 111, 114, 
-    109,  97, 108, 105, 122, 101, 
-     40,  99, 114, 111, 115, 115, 
-     40,  78,  44,  32, 114, 105, 
-    103, 104, 116,  41,  41,  59, 
-     10,  10,  32,  32,  32,  32, 
-    102, 108, 111,  97, 116,  32, 
-    115,  97, 109, 112, 108, 101, 
-     68, 101, 108, 116,  97,  32, 
-     61,  32,  48,  46,  48,  50, 
-     53,  59,  10,  32,  32,  32, 
-     32, 102, 108, 111,  97, 116, 
-     32, 110, 114,  83,  97, 109, 
-    112, 108, 101, 115,  32,  61, 
-     32,  48,  46,  48,  59,  10, 
-     32,  32,  32,  32, 102, 111, 
-    114,  32,  40, 102, 108, 111, 
-     97, 116,  32, 112, 104, 105, 
-     32,  61,  32,  48,  46,  48, 
-     59,  32, 112, 104, 105,  32, 
-     60,  32,  50,  46,  48,  32, 
-     42,  32,  80,  73,  59,  32, 
-    112, 104, 105,  32,  43,  61, 
-     32, 115,  97, 109, 112, 108, 
-    101,  68, 101, 108, 116,  97, 
-     41,  32, 123,  10,  32,  32, 
-     32,  32,  32,  32,  32,  32, 
-    102, 111, 114,  32,  40, 102, 
-    108, 111,  97, 116,  32, 116, 
-    104, 101, 116,  97,  32,  61, 
-     32,  48,  46,  48,  59,  32, 
-    116, 104, 101, 116,  97,  32, 
-     60,  32,  48,  46,  53,  32, 
-     42,  32,  80,  73,  59,  32, 
-    116, 104, 101, 116,  97,  32, 
-     43,  61,  32, 115,  97, 109, 
-    112, 108, 101,  68, 101, 108, 
-    116,  97,  41,  32, 123,  10, 
-     32,  32,  32,  32,  32,  32, 
-     32,  32,  32,  32,  32,  32, 
-     47,  47,  32, 115, 112, 104, 
-    101, 114, 105,  99,  97, 108, 
-     32, 116, 111,  32,  99,  97, 
-    114, 116, 101, 115, 105,  97, 
-    110,  32,  40, 105, 110,  32, 
-    116,  97, 110, 103, 101, 110, 
-    116,  32, 115, 112,  97,  99, 
-    101,  41,  10,  32,  32,  32, 
-     32,  32,  32,  32,  32,  32, 
-     32,  32,  32, 102, 108, 111, 
-     97, 116,  51,  32, 116,  97, 
-    110, 103, 101, 110, 116,  83, 
-     97, 109, 112, 108, 101,  32, 
-     61,  32, 102, 108, 111,  97, 
-    116,  51,  40, 115, 105, 110, 
-     40, 116, 104, 101, 116,  97, 
-     41,  32,  42,  32,  99, 111, 
-    115,  40, 112, 104, 105,  41, 
-     44,  32, 115, 105, 110,  40, 
-    116, 104, 101, 116,  97,  41, 
-     32,  42,  32, 115, 105, 110, 
-     40, 112, 104, 105,  41,  44, 
-     32,  99, 111, 115,  40, 116, 
-    104, 101, 116,  97,  41,  41, 
-     59,  10,  32,  32,  32,  32, 
-     32,  32,  32,  32,  32,  32, 
-     32,  32,  47,  47,  32, 116, 
-     97, 110, 103, 101, 110, 116, 
-     32, 115, 112,  97,  99, 101, 
-     32, 116, 111,  32, 119, 111, 
-    114, 108, 100,  10,  32,  32, 
-     32,  32,  32,  32,  32,  32, 
-     32,  32,  32,  32, 102, 108, 
-    111,  97, 116,  51,  32, 115, 
-     97, 109, 112, 108, 101,  86, 
-    101,  99,  32,  61,  32, 116, 
-     97, 110, 103, 101, 110, 116, 
-     83,  97, 109, 112, 108, 101, 
-     46, 120,  32,  42,  32, 114, 
-    105, 103, 104, 116,  32,  43, 
-     32, 116,  97, 110, 103, 101, 
-    110, 116,  83,  97, 109, 112, 
-    108, 101,  46, 121,  32,  42, 
-     32, 117, 112,  32,  43,  32, 
-    116,  97, 110, 103, 101, 110, 
-    116,  83,  97, 109, 112, 108, 
-    101,  46, 122,  32,  42,  32, 
-     78,  59,  10,  10,  32,  32, 
-     32,  32,  32,  32,  32,  32, 
-     32,  32,  32,  32, 105, 114, 
-    114,  97, 100, 105,  97, 110, 
-     99, 101,  32,  43,  61,  32, 
-    116, 101, 120,  46,  83,  97, 
-    109, 112, 108, 101,  40, 115, 
-    115,  44,  32, 115,  97, 109, 
-    112, 108, 101,  86, 101,  99, 
-     41,  46, 114, 103,  98,  32, 
-     42,  32,  99, 111, 115,  40, 
-    116, 104, 101, 116,  97,  41, 
-     42,  32, 115, 105, 110,  40, 
-    116, 104, 101, 116,  97,  41, 
-     59,  10,  32,  32,  32,  32, 
-     32,  32,  32,  32,  32,  32, 
-     32,  32, 110, 114,  83,  97, 
-    109, 112, 108, 101, 115,  43, 
-     43,  59,  10,  32,  32,  32, 
-     32,  32,  32,  32,  32, 125, 
-     10,  32,  32,  32,  32, 125, 
-     10,  32,  32,  32,  32, 105, 
-    114, 114,  97, 100, 105,  97, 
-    110,  99, 101,  32,  61,  32, 
-     80,  73,  32,  42,  32, 105, 
-    114, 114,  97, 100, 105,  97, 
-    110,  99, 101,  32,  42,  32, 
-     40,  49,  46,  48,  32,  47, 
-     32, 102, 108, 111,  97, 116, 
-     40, 110, 114,  83,  97, 109, 
-    112, 108, 101, 115,  41,  41, 
-     59,  10,  10,   9, 114, 101, 
-    116, 117, 114, 110,  32, 102, 
-    108, 111,  97, 116,  52,  40, 
-    105, 114, 114,  97, 100, 105, 
-     97, 110,  99, 101,  44,  32, 
-     49,  46,  48,  41,  59,  10, 
-    125,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-    115, 116,  97, 116, 105,  99, 
-     32,  99, 111, 110, 115, 116, 
-     32, 102, 108, 111,  97, 116, 
-     32,  80,  73,  32,  61,  32, 
-     51,  46,  49,  52,  49,  53, 
-     57,  50,  54,  53,  51,  53, 
-     57,  59,  10,  10, 105, 110, 
-    108, 105, 110, 101,  32, 102, 
-    108, 111,  97, 116,  51,  32, 
-     84, 111, 110, 101,  77,  97, 
-    112,  72,  68,  82,  40,  99, 
-    111, 110, 115, 116,  32, 102, 
-    108, 111,  97, 116,  51,  32, 
-     99, 111, 108, 111, 114,  41, 
-     32, 123,  10,  32,  32,  32, 
-     32,  47,  47,  32,  82, 101, 
-    105, 110, 104,  97, 114, 100, 
-     32, 111, 112, 101, 114,  97, 
-    116, 111, 114,  10,  32,  32, 
-     32,  32, 114, 101, 116, 117, 
-    114, 110,  32,  99, 111, 108, 
-    111, 114,  32,  47,  32,  40, 
-     99, 111, 108, 111, 114,  32, 
-     43,  32, 102, 108, 111,  97, 
-    116,  51,  40,  49,  46,  48, 
-     44,  32,  49,  46,  48,  44, 
-     32,  49,  46,  48,  41,  41, 
-     59,  10, 125,  10,  10, 105, 
-    110, 108, 105, 110, 101,  32, 
-    102, 108, 111,  97, 116,  51, 
-     32,  67, 111, 114, 114, 101, 
-     99, 116,  71,  97, 109, 109, 
-     97,  40,  99, 111, 110, 115, 
-    116,  32, 102, 108, 111,  97, 
-    116,  51,  32,  99, 111, 108, 
-    111, 114,  41,  32, 123,  10, 
-     32,  32,  32,  32,  99, 111, 
-    110, 115, 116,  32, 102, 108, 
-    111,  97, 116,  32, 112, 111, 
-    119,  78,  32,  61,  32,  49, 
-     46,  48,  32,  47,  32,  50, 
-     46,  50,  59,  10,  32,  32, 
-     32,  32, 114, 101, 116, 117, 
-    114, 110,  32, 112, 111, 119, 
-     40,  99, 111, 108, 111, 114, 
-     44,  32, 102, 108, 111,  97, 
-    116,  51,  40, 112, 111, 119, 
-     78,  44,  32, 112, 111, 119, 
-     78,  44,  32, 112, 111, 119, 
-     78,  41,  41,  59,  10, 125, 
-     10,  10, 102, 108, 111,  97, 
-    116,  32,  68, 105, 115, 116, 
-    114, 105,  98, 117, 116, 105, 
-    111, 110,  71,  71,  88,  40, 
-    102, 108, 111,  97, 116,  51, 
-     32,  78,  44,  32, 102, 108, 
-    111,  97, 116,  51,  32,  72, 
-     44,  32, 102, 108, 111,  97, 
-    116,  32, 114, 111, 117, 103, 
-    104, 110, 101, 115, 115,  41, 
-     32, 123,  10,  32,  32,  32, 
-     32, 102, 108, 111,  97, 116, 
-     32,  97,  32,  61,  32, 114, 
-    111, 117, 103, 104, 110, 101, 
-    115, 115,  32,  42,  32, 114, 
-    111, 117, 103, 104, 110, 101, 
-    115, 115,  59,  10,  32,  32, 
-     32,  32, 102, 108, 111,  97, 
-    116,  32,  97,  50,  32,  61, 
-     32,  97,  32,  42,  32,  97, 
-     59,  10,  32,  32,  32,  32, 
-    102, 108, 111,  97, 116,  32, 
-     78, 100, 111, 116,  72,  32, 
-     61,  32, 109,  97, 120,  40, 
-    100, 111, 116,  40,  78,  44, 
-     32,  72,  41,  44,  32,  48, 
-     46,  48,  41,  59,  10,  32, 
-     32,  32,  32, 102, 108, 111, 
-     97, 116,  32,  78, 100, 111, 
-    116,  72,  50,  32,  61,  32, 
-     78, 100, 111, 116,  72,  32, 
-     42,  32,  78, 100, 111, 116, 
-     72,  59,  10,  10,  32,  32, 
-     32,  32, 102, 108, 111,  97, 
-    116,  32, 110, 117, 109,  32, 
-     61,  32,  97,  50,  59,  10, 
-     32,  32,  32,  32, 102, 108, 
-    111,  97, 116,  32, 100, 101, 
-    110, 111, 109,  32,  61,  32, 
-     40,  78, 100, 111, 116,  72, 
-     50,  32,  42,  32,  40,  97, 
-     50,  32,  45,  32,  49,  46, 
-     48,  41,  32,  43,  32,  49, 
-     46,  48,  41,  59,  10,  32, 
-     32,  32,  32, 100, 101, 110, 
-    111, 109,  32,  61,  32,  80, 
-     73,  32,  42,  32, 100, 101, 
-    110, 111, 109,  32,  42,  32, 
-    100, 101, 110, 111, 109,  59, 
-     10,  10,  32,  32,  32,  32, 
-    114, 101, 116, 117, 114, 110, 
-     32, 110, 117, 109,  32,  47, 
-     32, 100, 101, 110, 111, 109, 
-     59,  10, 125,  10,  10, 102, 
-    108, 111,  97, 116,  32,  71, 
-    101, 111, 109, 101, 116, 114, 
-    121,  83,  99, 104, 108, 105, 
-     99, 107,  71,  71,  88,  40, 
-    102, 108, 111,  97, 116,  32, 
-     78, 100, 111, 116,  86,  44, 
-     32, 102, 108, 111,  97, 116, 
-     32, 114, 111, 117, 103, 104, 
-    110, 101, 115, 115,  41,  32, 
-    123,  10,  32,  32,  32,  32, 
-    102, 108, 111,  97, 116,  32, 
-    114,  32,  61,  32,  40, 114, 
-    111, 117, 103, 104, 110, 101, 
-    115, 115,  32,  43,  32,  49, 
-     46,  48,  41,  59,  10,  32, 
-     32,  32,  32, 102, 108, 111, 
-     97, 116,  32, 107,  32,  61, 
-     32,  40, 114,  32,  42,  32, 
-    114,  41,  32,  47,  32,  56, 
-     46,  48,  59,  10,  10,  32, 
-     32,  32,  32, 102, 108, 111, 
-     97, 116,  32, 110, 117, 109, 
-     32,  61,  32,  78, 100, 111, 
-    116,  86,  59,  10,  32,  32, 
-     32,  32, 102, 108, 111,  97, 
-    116,  32, 100, 101, 110, 111, 
-    109,  32,  61,  32,  78, 100, 
-    111, 116,  86,  32,  42,  32, 
-     40,  49,  46,  48,  32,  45, 
-     32, 107,  41,  32,  43,  32, 
-    107,  59,  10,  10,  32,  32, 
-     32,  32, 114, 101, 116, 117, 
-    114, 110,  32, 110, 117, 109, 
-     32,  47,  32, 100, 101, 110, 
-    111, 109,  59,  10, 125,  10, 
-     10, 102, 108, 111,  97, 116, 
-     32,  71, 101, 111, 109, 101, 
-    116, 114, 121,  83, 109, 105, 
-    116, 104,  40, 102, 108, 111, 
-     97, 116,  51,  32,  78,  44, 
-     32, 102, 108, 111,  97, 116, 
-     51,  32,  86,  44,  32, 102, 
-    108, 111,  97, 116,  51,  32, 
-     76,  44,  32, 102, 108, 111, 
-     97, 116,  32, 114, 111, 117, 
-    103, 104, 110, 101, 115, 115, 
-     41,  32, 123,  10,  32,  32, 
-     32,  32, 102, 108, 111,  97, 
-    116,  32,  78, 100, 111, 116, 
-     86,  32,  61,  32, 109,  97, 
-    120,  40, 100, 111, 116,  40, 
-     78,  44,  32,  86,  41,  44, 
-     32,  48,  46,  48,  41,  59, 
-     10,  32,  32,  32,  32, 102, 
-    108, 111,  97, 116,  32,  78, 
-    100, 111, 116,  76,  32,  61, 
-     32, 109,  97, 120,  40, 100, 
-    111, 116,  40,  78,  44,  32, 
-     76,  41,  44,  32,  48,  46, 
-     48,  41,  59,  10,  32,  32, 
-     32,  32, 102, 108, 111,  97, 
-    116,  32, 103, 103, 120,  50, 
-     32,  61,  32,  71, 101, 111, 
-    109, 101, 116, 114, 121,  83, 
-     99, 104, 108, 105,  99, 107, 
-     71,  71,  88,  40,  78, 100, 
-    111, 116,  86,  44,  32, 114, 
-    111, 117, 103, 104, 110, 101, 
-    115, 115,  41,  59,  10,  32, 
-     32,  32,  32, 102, 108, 111, 
-     97, 116,  32, 103, 103, 120, 
-     49,  32,  61,  32,  71, 101, 
-    111, 109, 101, 116, 114, 121, 
-     83,  99, 104, 108, 105,  99, 
-    107,  71,  71,  88,  40,  78, 
-    100, 111, 116,  76,  44,  32, 
-    114, 111, 117, 103, 104, 110, 
-    101, 115, 115,  41,  59,  10, 
-     10,  32,  32,  32,  32, 114, 
-    101, 116, 117, 114, 110,  32, 
-    103, 103, 120,  49,  32,  42, 
-     32, 103, 103, 120,  50,  59, 
-     10, 125,  10,  10, 102, 108, 
-    111,  97, 116,  51,  32,  70, 
-    114, 101, 115, 110, 101, 108, 
-     83,  99, 104, 108, 105,  99, 
-    107,  40, 102, 108, 111,  97, 
-    116,  32,  99, 111, 115,  84, 
-    104, 101, 116,  97,  44,  32, 
-    102, 108, 111,  97, 116,  51, 
-     32,  70,  48,  41,  32, 123, 
-     10,  32,  32,  32,  32, 114, 
-    101, 116, 117, 114, 110,  32, 
-     70,  48,  32,  43,  32,  40, 
-     49,  46,  48,  32,  45,  32, 
-     70,  48,  41,  32,  42,  32, 
-    112, 111, 119,  40, 115,  97, 
-    116, 117, 114,  97, 116, 101, 
-     40,  49,  46,  48,  32,  45, 
-     32,  99, 111, 115,  84, 104, 
-    101, 116,  97,  41,  44,  32, 
-     53,  46,  48,  41,  59,  10, 
-    125,  10,  10, 102, 108, 111, 
-     97, 116,  51,  32,  70, 114, 
-    101, 115, 110, 101, 108,  83, 
-     99, 104, 108, 105,  99, 107, 
-     82, 111, 117, 103, 104, 110, 
-    101, 115, 115,  40, 102, 108, 
-    111,  97, 116,  32,  99, 111, 
-    115,  84, 104, 101, 116,  97, 
-     44,  32, 102, 108, 111,  97, 
-    116,  51,  32,  70,  48,  44, 
-     32, 102, 108, 111,  97, 116, 
-     32, 114, 111, 117, 103, 104, 
-    110, 101, 115, 115,  41,  32, 
-    123,  10,  32,  32,  32,  32, 
-     99, 111, 110, 115, 116,  32, 
-    102, 108, 111,  97, 116,  32, 
-    111, 110, 101,  77, 105, 110, 
-    117, 115,  82, 111, 117, 103, 
-    104, 110, 101, 115, 115,  32, 
-     61,  32,  49,  46,  48,  32, 
-     45,  32, 114, 111, 117, 103, 
-    104, 110, 101, 115, 115,  59, 
-     10,  32,  32,  32,  32, 114, 
-    101, 116, 117, 114, 110,  32, 
-     70,  48,  32,  43,  32,  40, 
-    109,  97, 120,  40, 102, 108, 
-    111,  97, 116,  51,  40, 111, 
-    110, 101,  77, 105, 110, 117, 
-    115,  82, 111, 117, 103, 104, 
-    110, 101, 115, 115,  44,  32, 
-    111, 110, 101,  77, 105, 110, 
-    117, 115,  82, 111, 117, 103, 
-    104, 110, 101, 115, 115,  44, 
-     32, 111, 110, 101,  77, 105, 
-    110, 117, 115,  82, 111, 117, 
-    103, 104, 110, 101, 115, 115, 
-     41,  44,  32,  70,  48,  41, 
-     32,  45,  32,  70,  48,  41, 
-     32,  42,  32, 112, 111, 119, 
-     40, 115,  97, 116, 117, 114, 
-     97, 116, 101,  40,  49,  46, 
-     48,  32,  45,  32,  99, 111, 
-    115,  84, 104, 101, 116,  97, 
-     41,  44,  32,  53,  46,  48, 
-     41,  59,  10, 125,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-    254, 239, 254, 239,   1,   0, 
-      0,   0,  43,  11,   0,   0, 
-      0,  69,  58,  92,  80, 114, 
-    111, 106, 101,  99, 116, 115, 
-     92,  78, 105,  99, 107, 101, 
-    108,  92,  78, 105,  99, 107, 
-    101, 108,  92,  68,  97, 116, 
-     97,  92,  83, 104,  97, 100, 
-    101, 114, 115,  92,  67, 111, 
-    110, 118, 111, 108, 117, 116, 
-    101,  66,  97,  99, 107, 103, 
-    114, 111, 117, 110, 100,  80, 
-    105, 120, 101, 108,  83, 104, 
-     97, 100, 101, 114,  46, 104, 
-    108, 115, 108,   0,   0, 101, 
-     58,  92, 112, 114, 111, 106, 
-    101,  99, 116, 115,  92, 110, 
-    105,  99, 107, 101, 108,  92, 
-    110, 105,  99, 107, 101, 108, 
-     92, 100,  97, 116,  97,  92, 
-    115, 104,  97, 100, 101, 114, 
-    115,  92,  99, 111, 110, 118, 
-    111, 108, 117, 116, 101,  98, 
-     97,  99, 107, 103, 114, 111, 
-    117, 110, 100, 112, 105, 120, 
-    101, 108, 115, 104,  97, 100, 
-    101, 114,  46, 104, 108, 115, 
-    108,   0,  69,  58,  92,  80, 
-    114, 111, 106, 101,  99, 116, 
-    115,  92,  78, 105,  99, 107, 
-    101, 108,  92,  78, 105,  99, 
-    107, 101, 108,  92,  68,  97, 
-    116,  97,  92,  83, 104,  97, 
-    100, 101, 114, 115,  92,  80, 
-     98, 114,  72, 101, 108, 112, 
-    101, 114,  46, 104, 108, 115, 
-    108,   0, 101,  58,  92, 112, 
-    114, 111, 106, 101,  99, 116, 
-    115,  92, 110, 105,  99, 107, 
-    101, 108,  92, 110, 105,  99, 
-    107, 101, 108,  92, 100,  97, 
-    116,  97,  92, 115, 104,  97, 
-    100, 101, 114, 115,  92, 112, 
-     98, 114, 104, 101, 108, 112, 
-    101, 114,  46, 104, 108, 115, 
-    108,   0,  84, 101, 120, 116, 
-    117, 114, 101,  67, 117,  98, 
-    101,  32, 116, 101, 120,  32, 
-     58,  32, 114, 101, 103, 105, 
-    115, 116, 101, 114,  40, 116, 
-     48,  41,  59,  10,  83,  97, 
-    109, 112, 108, 101, 114,  83, 
-    116,  97, 116, 101,  32, 115, 
-    115,  32,  58,  32, 114, 101, 
-    103, 105, 115, 116, 101, 114, 
-     40, 115,  48,  41,  59,  10, 
-     10,  35, 105, 110,  99, 108, 
-    117, 100, 101,  32,  34,  80, 
-     98, 114,  72, 101, 108, 112, 
-    101, 114,  46, 104, 108, 115, 
-    108,  34,  10,  10, 102, 108, 
-    111,  97, 116,  52,  32,  67, 
-    111, 110, 118, 111, 108, 117, 
-    116, 101,  66,  97,  99, 107, 
-    103, 114, 111, 117, 110, 100, 
-     80, 105, 120, 101, 108,  83, 
-    104,  97, 100, 101, 114,  40, 
-    102, 108, 111,  97, 116,  51, 
-     32, 119, 111, 114, 108, 100, 
-     80, 111, 115,  32,  58,  32, 
-     87,  79,  82,  76,  68,  95, 
-     80,  79,  83,  73,  84,  73, 
-     79,  78,  41,  32,  58,  32, 
-     83,  86,  95,  84,  65,  82, 
-     71,  69,  84,  10, 123,  10, 
-     32,  32,  32,  32, 102, 108, 
-    111,  97, 116,  51,  32,  78, 
-     32,  61,  32, 110, 111, 114, 
-    109,  97, 108, 105, 122, 101, 
-     40, 119, 111, 114, 108, 100, 
-     80, 111, 115,  41,  59,  10, 
-      9, 102, 108, 111,  97, 116, 
-     51,  32, 105, 114, 114,  97, 
-    100, 105,  97, 110,  99, 101, 
-     32,  61,  32, 102, 108, 111, 
-     97, 116,  27, 226,  48,   1, 
-    172,   0,   0,   0,  42,  16, 
-    220, 250, 236, 218, 215,   1, 
-      1,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      2,   0,   0,   0,   4,   0, 
-      0,   0,   1,   0,   0,   0, 
-      6,   0,   0,   0,   0,   0, 
-      0,   0,  77,   0,   0,   0, 
-     40,   0,   0,   0,  27, 226, 
-     48,   1,  91, 244, 254, 142, 
-     69,   4,   0,   0,   1,   0, 
-      0,   0,  76,   0,   0,   0, 
-     77,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0, 206,   0, 
-      0,   0,  40,   0,   0,   0, 
-     27, 226,  48,   1, 194, 234, 
-    171, 223, 224,   5,   0,   0, 
-    152,   0,   0,   0,  76,   0, 
-      0,   0, 206,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   4,   0, 
-      0,   0,  66,   0,  60,  17, 
-     16,   1,   0,   0,   0,   1, 
-     10,   0,   1,   0,   1,   0, 
-    124,  79,  10,   0,   1,   0, 
-      1,   0, 124,  79,  77, 105, 
-     99, 114, 111, 115, 111, 102, 
-    116,  32,  40,  82,  41,  32, 
-     72,  76,  83,  76,  32,  83, 
-    104,  97, 100, 101, 114,  32, 
-     67, 111, 109, 112, 105, 108, 
-    101, 114,  32,  49,  48,  46, 
-     49,   0,   0,   0,  78,   0, 
-     61,  17,   1, 104, 108, 115, 
-    108,  70, 108,  97, 103, 115, 
-      0,  48, 120,  53,   0, 104, 
-    108, 115, 108,  84,  97, 114, 
-    103, 101, 116,   0, 112, 115, 
-     95,  53,  95,  48,   0, 104, 
-    108, 115, 108,  69, 110, 116, 
-    114, 121,   0,  67, 111, 110, 
-    118, 111, 108, 117, 116, 101, 
-     66,  97,  99, 107, 103, 114, 
-    111, 117, 110, 100,  80, 105, 
-    120, 101, 108,  83, 104,  97, 
-    100, 101, 114,   0,   0,   0, 
-     70,   0,  16,  17,   0,   0, 
-      0,   0, 224,   7,   0,   0, 
-      0,   0,   0,   0,  32,   6, 
-      0,   0,   0,   0,   0,   0, 
-     32,   6,   0,   0,   4,  16, 
-      0,   0,  72,   0,   0,   0, 
-      1,   0, 160,  67, 111, 110, 
-    118, 111, 108, 117, 116, 101, 
-     66,  97,  99, 107, 103, 114, 
-    111, 117, 110, 100,  80, 105, 
-    120, 101, 108,  83, 104,  97, 
-    100, 101, 114,   0,   0,   0, 
-     46,   0,  62,  17,   0,  16, 
-      0,   0,   9,   0, 119, 111, 
-    114, 108, 100,  80, 111, 115, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-     22,   0,  80,  17,   1,   0, 
-      5,   0,   0,   0,   4,   0, 
-     72,   0,   0,   0,   1,   0, 
-     32,   6,   0,   0,   0,   0, 
-     22,   0,  80,  17,   1,   0, 
-      5,   0,   4,   0,   4,   0, 
-     72,   0,   0,   0,   1,   0, 
-     32,   6,   4,   0,   0,   0, 
-     22,   0,  80,  17,   1,   0, 
-      5,   0,   8,   0,   4,   0, 
-     72,   0,   0,   0,   1,   0, 
-     32,   6,   8,   0,   0,   0, 
-     86,   0,  62,  17,   3,  16, 
-      0,   0, 136,   0,  60,  67, 
-    111, 110, 118, 111, 108, 117, 
-    116, 101,  66,  97,  99, 107, 
-    103, 114, 111, 117, 110, 100, 
-     80, 105, 120, 101, 108,  83, 
-    104,  97, 100, 101, 114,  32, 
-    114, 101, 116, 117, 114, 110, 
-     32, 118,  97, 108, 117, 101, 
-     62,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,  22,   0, 
-     80,  17,   2,   0,   5,   0, 
-      0,   0,   4,   0,  72,   0, 
-      0,   0,   1,   0,  32,   6, 
-      0,   0,   0,   0,  22,   0, 
-     80,  17,   2,   0,   5,   0, 
-      4,   0,   4,   0,  72,   0, 
-      0,   0,   1,   0,  32,   6, 
-      4,   0,   0,   0,  22,   0, 
-     80,  17,   2,   0,   5,   0, 
-      8,   0,   4,   0,  72,   0, 
-      0,   0,   1,   0,  32,   6, 
-      8,   0,   0,   0,  22,   0, 
-     80,  17,   2,   0,   5,   0, 
-     12,   0,   4,   0,  72,   0, 
-      0,   0,   1,   0,  32,   6, 
-     12,   0,   0,   0,  42,   0, 
-     62,  17,   0,  16,   0,   0, 
-      8,   0,  78,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-     22,   0,  80,  17,   0,   0, 
-      5,   0,   0,   0,   4,   0, 
-    168,   0,   0,   0,   1,   0, 
-     92,   5,   4,   0,   0,   0, 
-     22,   0,  80,  17,   0,   0, 
-      5,   0,   4,   0,   4,   0, 
-    168,   0,   0,   0,   1,   0, 
-     92,   5,   8,   0,   0,   0, 
-     22,   0,  80,  17,   0,   0, 
-      5,   0,   8,   0,   4,   0, 
-    168,   0,   0,   0,   1,   0, 
-    120,   5,  12,   0,   0,   0, 
-     50,   0,  62,  17,   0,  16, 
-      0,   0,   8,   0, 105, 114, 
-    114,  97, 100, 105,  97, 110, 
-     99, 101,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,  22,   0, 
-     80,  17,   0,   0,   5,   0, 
-      0,   0,   4,   0, 200,   0, 
-      0,   0,   1,   0, 224,   1, 
-     16,   0,   0,   0,  22,   0, 
-     80,  17,   0,   0,   5,   0, 
-      4,   0,   4,   0, 200,   0, 
-      0,   0,   1,   0, 224,   1, 
-     20,   0,   0,   0,  22,   0, 
-     80,  17,   0,   0,   5,   0, 
-      8,   0,   4,   0, 200,   0, 
-      0,   0,   1,   0, 224,   1, 
-     24,   0,   0,   0,  26,   0, 
-     80,  17,   0,   0,   5,   0, 
-      0,   0,   4,   0, 168,   2, 
-      0,   0,   1,   0, 148,   3, 
-    124,   0, 144,   2,  64,   0, 
-      0,   0,  26,   0,  80,  17, 
-      0,   0,   5,   0,   4,   0, 
-      4,   0, 168,   2,   0,   0, 
-      1,   0, 148,   3, 124,   0, 
-    144,   2,  68,   0,   0,   0, 
-     26,   0,  80,  17,   0,   0, 
-      5,   0,   8,   0,   4,   0, 
-    168,   2,   0,   0,   1,   0, 
-    148,   3, 124,   0, 144,   2, 
-     72,   0,   0,   0,  22,   0, 
-     80,  17,   0,   0,   5,   0, 
-      0,   0,   4,   0,  36,   3, 
-      0,   0,   1,   0, 144,   2, 
-     96,   0,   0,   0,  22,   0, 
-     80,  17,   0,   0,   5,   0, 
-      4,   0,   4,   0,  36,   3, 
-      0,   0,   1,   0, 144,   2, 
-    100,   0,   0,   0,  22,   0, 
-     80,  17,   0,   0,   5,   0, 
-      8,   0,   4,   0,  36,   3, 
-      0,   0,   1,   0, 144,   2, 
-    104,   0,   0,   0,  22,   0, 
-     80,  17,   0,   0,   5,   0, 
-      0,   0,   4,   0,  60,   6, 
-      0,   0,   1,   0,  44,   0, 
-      0,   0,   0,   0,  22,   0, 
-     80,  17,   0,   0,   5,   0, 
-      4,   0,   4,   0,  60,   6, 
-      0,   0,   1,   0,  44,   0, 
-      4,   0,   0,   0,  22,   0, 
-     80,  17,   0,   0,   5,   0, 
-      8,   0,   4,   0,  60,   6, 
-      0,   0,   1,   0,  44,   0, 
-      8,   0,   0,   0,  42,   0, 
-     62,  17,   0,  16,   0,   0, 
-      8,   0, 117, 112,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-     22,   0,  80,  17,   0,   0, 
-      5,   0,   8,   0,   4,   0, 
-    232,   0,   0,   0,   1,   0, 
-     56,   0,  32,   0,   0,   0, 
-     22,   0,  80,  17,   0,   0, 
-      5,   0,   0,   0,   4,   0, 
-    232,   0,   0,   0,   1,   0, 
-     56,   0,  36,   0,   0,   0, 
-     22,   0,  80,  17,   0,   0, 
-      5,   0,   4,   0,   4,   0, 
-    232,   0,   0,   0,   1,   0, 
-     56,   0,  40,   0,   0,   0, 
-     22,   0,  80,  17,   0,   0, 
-      5,   0,   0,   0,   4,   0, 
-     88,   2,   0,   0,   1,   0, 
-     16,   4,  48,   0,   0,   0, 
-     22,   0,  80,  17,   0,   0, 
-      5,   0,   4,   0,   4,   0, 
-     88,   2,   0,   0,   1,   0, 
-     16,   4,  52,   0,   0,   0, 
-     22,   0,  80,  17,   0,   0, 
-      5,   0,   8,   0,   4,   0, 
-     88,   2,   0,   0,   1,   0, 
-     16,   4,  56,   0,   0,   0, 
-     46,   0,  62,  17,   0,  16, 
-      0,   0,   8,   0, 114, 105, 
-    103, 104, 116,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-     22,   0,  80,  17,   0,   0, 
-      5,   0,   0,   0,   4,   0, 
-    160,   1,   0,   0,   1,   0, 
-    200,   4,  32,   0,   0,   0, 
-     22,   0,  80,  17,   0,   0, 
-      5,   0,   4,   0,   4,   0, 
-    160,   1,   0,   0,   1,   0, 
-    200,   4,  36,   0,   0,   0, 
-     22,   0,  80,  17,   0,   0, 
-      5,   0,   8,   0,   4,   0, 
-    160,   1,   0,   0,   1,   0, 
-    200,   4,  40,   0,   0,   0, 
-     50,   0,  62,  17,  64,   0, 
-      0,   0,   0,   0, 115,  97, 
-    109, 112, 108, 101,  68, 101, 
-    108, 116,  97,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,  22,   0, 
-     80,  17,   0,   0,   1,   0, 
-      0,   0,   4,   0, 108,   2, 
-      0,   0,   1,   0, 252,   3, 
-     28,   0,   0,   0,  50,   0, 
-     62,  17,  64,   0,   0,   0, 
-      0,   0, 110, 114,  83,  97, 
-    109, 112, 108, 101, 115,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,  22,   0,  80,  17, 
-      0,   0,   1,   0,   0,   0, 
-      4,   0, 128,   2,   0,   0, 
-      1,   0,  60,   0,  44,   0, 
-      0,   0,  26,   0,  80,  17, 
-      0,   0,   1,   0,   0,   0, 
-      4,   0, 188,   2,   0,   0, 
-      1,   0, 172,   3, 124,   0, 
-    144,   2,  76,   0,   0,   0, 
-     22,   0,  80,  17,   0,   0, 
-      1,   0,   0,   0,   4,   0, 
-     56,   3,   0,   0,   1,   0, 
-    144,   2,  88,   0,   0,   0, 
-     42,   0,  62,  17,  64,   0, 
-      0,   0,   0,   0, 112, 104, 
-    105,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,  22,   0,  80,  17, 
-      0,   0,   1,   0,   0,   0, 
-      4,   0, 148,   2,   0,   0, 
-      1,   0,  60,   0,  60,   0, 
-      0,   0,  22,   0,  80,  17, 
-      0,   0,   1,   0,   0,   0, 
-      4,   0, 208,   2,   0,   0, 
-      1,   0, 152,   3,  80,   0, 
-      0,   0,  46,   0,  62,  17, 
-     64,   0,   0,   0,   0,   0, 
-    116, 104, 101, 116,  97,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,  22,   0,  80,  17, 
-      0,   0,   1,   0,   0,   0, 
-      4,   0,  16,   3,   0,   0, 
-      1,   0,  60,   0,  84,   0, 
-      0,   0,  22,   0,  80,  17, 
-      0,   0,   1,   0,   0,   0, 
-      4,   0,  76,   3,   0,   0, 
-      1,   0, 156,   2,  92,   0, 
-      0,   0,  54,   0,  62,  17, 
-      0,  16,   0,   0,   8,   0, 
-    116,  97, 110, 103, 101, 110, 
-    116,  83,  97, 109, 112, 108, 
-    101,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,  22,   0, 
-     80,  17,   0,   0,   5,   0, 
-      0,   0,   4,   0, 196,   3, 
-      0,   0,   1,   0,  52,   1, 
-    108,   0,   0,   0,  22,   0, 
-     80,  17,   0,   0,   5,   0, 
-      4,   0,   4,   0,  16,   4, 
-      0,   0,   1,   0,  80,   0, 
-    112,   0,   0,   0,  22,   0, 
-     80,  17,   0,   0,   5,   0, 
-      8,   0,   4,   0,  40,   4, 
-      0,   0,   1,   0, 140,   0, 
-    116,   0,   0,   0,  50,   0, 
-     62,  17,   0,  16,   0,   0, 
-      8,   0, 115,  97, 109, 112, 
-    108, 101,  86, 101,  99,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,  22,   0,  80,  17, 
-      0,   0,   5,   0,   0,   0, 
-      4,   0, 180,   4,   0,   0, 
-      1,   0,  44,   0, 112,   0, 
-      0,   0,  22,   0,  80,  17, 
-      0,   0,   5,   0,   4,   0, 
-      4,   0, 180,   4,   0,   0, 
-      1,   0,  44,   0, 116,   0, 
-      0,   0,  22,   0,  80,  17, 
-      0,   0,   5,   0,   8,   0, 
-      4,   0, 180,   4,   0,   0, 
-      1,   0,  44,   0, 120,   0, 
-      0,   0,  42,   0,  62,  17, 
-      5,  16,   0,   0,   0,   0, 
-     80,  73,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,  22,   0, 
-     80,  17,   0,   0,   1,   0, 
-      0,   0,   4,   0,  92,   0, 
-      0,   0,   1,   0, 168,   5, 
-      0,   0,   0,   0,   2,   0, 
-      6,   0,  22,   0,  82,  17, 
-      5,  16,   0,   0,   0,   0, 
-      0,   0,   0,   0, 255, 255, 
-    255, 255, 255, 255,  80,  73, 
-      0,   0, 244,   0,   0,   0, 
-     48,   0,   0,   0,   1,   0, 
-      0,   0,  16,   1, 180, 100, 
-    234, 222, 102,  26, 197, 137, 
-     37, 165,  49, 226,  91,  49, 
-     37,  79,   0,   0, 152,   0, 
-      0,   0,  16,   1, 243,   4, 
-    123,  95, 212, 230,  88, 130, 
-     41, 203, 197,  51, 105,  65, 
-    190, 234,   0,   0, 242,   0, 
-      0,   0, 108,   6,   0,   0, 
-      0,   0,   0,   0,   1,   0, 
-      1,   0, 104,   6,   0,   0, 
-     24,   0,   0,   0,   2,   0, 
-      0,   0,  36,   0,   0,   0, 
-     72,   0,   0,   0,   1,   0, 
-      0, 128,  72,   0,   0,   0, 
-      1,   0,   0,   0,  20,   0, 
-     37,   0,  20,   0,  37,   0, 
-      0,   0,   0,   0, 132,   0, 
-      0,   0,  60,   6,   0,   0, 
-     92,   0,   0,   0,   8,   0, 
-      0, 128,  92,   0,   0,   0, 
-      8,   0,   0,   0, 120,   0, 
-      0,   0,   8,   0,   0, 128, 
-    120,   0,   0,   0,   8,   0, 
-      0,   0, 140,   0,   0,   0, 
-      8,   0,   0, 128, 140,   0, 
-      0,   0,   8,   0,   0,   0, 
-    168,   0,   0,   0,   9,   0, 
-      0, 128, 168,   0,   0,   0, 
-      9,   0,   0,   0, 200,   0, 
-      0,   0,  11,   0,   0, 128, 
-    200,   0,   0,   0,  11,   0, 
-      0,   0, 232,   0,   0,   0, 
-     12,   0,   0, 128, 232,   0, 
-      0,   0,  12,   0,   0,   0, 
-      4,   1,   0,   0,  12,   0, 
-      0, 128,   4,   1,   0,   0, 
-     12,   0,   0,   0,  32,   1, 
-      0,   0,  12,   0,   0, 128, 
-     32,   1,   0,   0,  12,   0, 
-      0,   0,  56,   1,   0,   0, 
-     12,   0,   0, 128,  56,   1, 
-      0,   0,  12,   0,   0,   0, 
-     84,   1,   0,   0,  12,   0, 
-      0, 128,  84,   1,   0,   0, 
-     12,   0,   0,   0, 112,   1, 
-      0,   0,  12,   0,   0, 128, 
-    112,   1,   0,   0,  12,   0, 
-      0,   0, 132,   1,   0,   0, 
-     12,   0,   0, 128, 132,   1, 
-      0,   0,  12,   0,   0,   0, 
-    160,   1,   0,   0,  13,   0, 
-      0, 128, 160,   1,   0,   0, 
-     13,   0,   0,   0, 188,   1, 
-      0,   0,  13,   0,   0, 128, 
-    188,   1,   0,   0,  13,   0, 
-      0,   0, 216,   1,   0,   0, 
-     13,   0,   0, 128, 216,   1, 
-      0,   0,  13,   0,   0,   0, 
-    240,   1,   0,   0,  13,   0, 
-      0, 128, 240,   1,   0,   0, 
-     13,   0,   0,   0,  12,   2, 
-      0,   0,  13,   0,   0, 128, 
-     12,   2,   0,   0,  13,   0, 
-      0,   0,  40,   2,   0,   0, 
-     13,   0,   0, 128,  40,   2, 
-      0,   0,  13,   0,   0,   0, 
-     60,   2,   0,   0,  13,   0, 
-      0, 128,  60,   2,   0,   0, 
-     13,   0,   0,   0,  88,   2, 
-      0,   0,  15,   0,   0, 128, 
-     88,   2,   0,   0,  15,   0, 
-      0,   0, 108,   2,   0,   0, 
-     16,   0,   0, 128, 108,   2, 
-      0,   0,  16,   0,   0,   0, 
-    128,   2,   0,   0,  17,   0, 
-      0, 128, 128,   2,   0,   0, 
-     17,   0,   0,   0, 148,   2, 
-      0,   0,  17,   0,   0, 128, 
-    148,   2,   0,   0,  17,   0, 
-      0,   0, 168,   2,   0,   0, 
-     17,   0,   0, 128, 168,   2, 
-      0,   0,  17,   0,   0,   0, 
-    188,   2,   0,   0,  17,   0, 
-      0, 128, 188,   2,   0,   0, 
-     17,   0,   0,   0, 208,   2, 
-      0,   0,  17,   0,   0, 128, 
-    208,   2,   0,   0,  17,   0, 
-      0,   0, 212,   2,   0,   0, 
-     17,   0,   0, 128, 212,   2, 
-      0,   0,  17,   0,   0,   0, 
-    240,   2,   0,   0,  17,   0, 
-      0, 128, 240,   2,   0,   0, 
-     17,   0,   0,   0, 252,   2, 
-      0,   0,  18,   0,   0, 128, 
-    252,   2,   0,   0,  18,   0, 
-      0,   0,  16,   3,   0,   0, 
-     18,   0,   0, 128,  16,   3, 
-      0,   0,  18,   0,   0,   0, 
-     36,   3,   0,   0,  18,   0, 
-      0, 128,  36,   3,   0,   0, 
-     18,   0,   0,   0,  56,   3, 
-      0,   0,  18,   0,   0, 128, 
-     56,   3,   0,   0,  18,   0, 
-      0,   0,  76,   3,   0,   0, 
-     18,   0,   0, 128,  76,   3, 
-      0,   0,  18,   0,   0,   0, 
-     80,   3,   0,   0,  18,   0, 
-      0, 128,  80,   3,   0,   0, 
-     18,   0,   0,   0, 108,   3, 
-      0,   0,  18,   0,   0, 128, 
-    108,   3,   0,   0,  18,   0, 
-      0,   0, 120,   3,   0,   0, 
-     20,   0,   0, 128, 120,   3, 
-      0,   0,  20,   0,   0,   0, 
-    144,   3,   0,   0,  20,   0, 
-      0, 128, 144,   3,   0,   0, 
-     20,   0,   0,   0, 168,   3, 
-      0,   0,  20,   0,   0, 128, 
-    168,   3,   0,   0,  20,   0, 
-      0,   0, 196,   3,   0,   0, 
-     20,   0,   0, 128, 196,   3, 
-      0,   0,  20,   0,   0,   0, 
-    220,   3,   0,   0,  20,   0, 
-      0, 128, 220,   3,   0,   0, 
-     20,   0,   0,   0, 244,   3, 
-      0,   0,  20,   0,   0, 128, 
-    244,   3,   0,   0,  20,   0, 
-      0,   0,  16,   4,   0,   0, 
-     20,   0,   0, 128,  16,   4, 
-      0,   0,  20,   0,   0,   0, 
-     40,   4,   0,   0,  22,   0, 
-      0, 128,  40,   4,   0,   0, 
-     22,   0,   0,   0,  68,   4, 
-      0,   0,  22,   0,   0, 128, 
-     68,   4,   0,   0,  22,   0, 
-      0,   0,  96,   4,   0,   0, 
-     22,   0,   0, 128,  96,   4, 
-      0,   0,  22,   0,   0,   0, 
-    124,   4,   0,   0,  22,   0, 
-      0, 128, 124,   4,   0,   0, 
-     22,   0,   0,   0, 152,   4, 
-      0,   0,  22,   0,   0, 128, 
-    152,   4,   0,   0,  22,   0, 
-      0,   0, 180,   4,   0,   0, 
-     24,   0,   0, 128, 180,   4, 
-      0,   0,  24,   0,   0,   0, 
-    224,   4,   0,   0,  24,   0, 
-      0, 128, 224,   4,   0,   0, 
-     24,   0,   0,   0, 248,   4, 
-      0,   0,  24,   0,   0, 128, 
-    248,   4,   0,   0,  24,   0, 
-      0,   0,  20,   5,   0,   0, 
-     24,   0,   0, 128,  20,   5, 
-      0,   0,  24,   0,   0,   0, 
-     44,   5,   0,   0,  24,   0, 
-      0, 128,  44,   5,   0,   0, 
-     24,   0,   0,   0,  72,   5, 
-      0,   0,  24,   0,   0, 128, 
-     72,   5,   0,   0,  24,   0, 
-      0,   0, 100,   5,   0,   0, 
-     25,   0,   0, 128, 100,   5, 
-      0,   0,  25,   0,   0,   0, 
-    128,   5,   0,   0,  26,   0, 
-      0, 128, 128,   5,   0,   0, 
-     18,   0,   0,   0, 156,   5, 
-      0,   0,  26,   0,   0, 128, 
-    156,   5,   0,   0,  26,   0, 
-      0,   0, 160,   5,   0,   0, 
-     26,   0,   0, 128, 160,   5, 
-      0,   0,  26,   0,   0,   0, 
-    180,   5,   0,   0,  26,   0, 
-      0, 128, 180,   5,   0,   0, 
-     26,   0,   0,   0, 200,   5, 
-      0,   0,  27,   0,   0, 128, 
-    200,   5,   0,   0,  17,   0, 
-      0,   0, 228,   5,   0,   0, 
-     27,   0,   0, 128, 228,   5, 
-      0,   0,  27,   0,   0,   0, 
-    232,   5,   0,   0,  28,   0, 
-      0, 128, 232,   5,   0,   0, 
-     28,   0,   0,   0,   4,   6, 
-      0,   0,  28,   0,   0, 128, 
-      4,   6,   0,   0,  28,   0, 
-      0,   0,  32,   6,   0,   0, 
-     28,   0,   0, 128,  32,   6, 
-      0,   0,  28,   0,   0,   0, 
-     60,   6,   0,   0,  30,   0, 
-      0, 128,  60,   6,   0,   0, 
-     30,   0,   0,   0,  80,   6, 
-      0,   0,  30,   0,   0, 128, 
-     80,   6,   0,   0,  30,   0, 
-      0,   0, 100,   6,   0,   0, 
-     30,   0,   0, 128, 100,   6, 
-      0,   0,  30,   0,   0,   0, 
-      5,   0,  35,   0,  16,   0, 
-     34,   0,   5,   0,  35,   0, 
-     16,   0,  34,   0,   5,   0, 
-     35,   0,  16,   0,  34,   0, 
-      2,   0,  43,   0,   9,   0, 
-     42,   0,   5,   0,  38,   0, 
-     12,   0,  37,   0,   5,   0, 
-     43,   0,  30,   0,  41,   0, 
-      5,   0,  43,   0,  30,   0, 
-     41,   0,   5,   0,  43,   0, 
-     30,   0,  41,   0,   5,   0, 
-     43,   0,  30,   0,  41,   0, 
-      5,   0,  43,   0,  20,   0, 
-     42,   0,   5,   0,  43,   0, 
-     20,   0,  42,   0,   5,   0, 
-     43,   0,  20,   0,  42,   0, 
-      5,   0,  36,   0,  20,   0, 
-     34,   0,   5,   0,  36,   0, 
-     20,   0,  34,   0,   5,   0, 
-     36,   0,  20,   0,  34,   0, 
-      5,   0,  36,   0,  20,   0, 
-     34,   0,   5,   0,  36,   0, 
-     10,   0,  35,   0,   5,   0, 
-     36,   0,  10,   0,  35,   0, 
-      5,   0,  36,   0,  10,   0, 
-     35,   0,   5,   0,  30,   0, 
-     11,   0,  29,   0,   5,   0, 
-     26,   0,  11,   0,  25,   0, 
-      5,   0,  61,   0,  16,   0, 
-     24,   0,   5,   0,  61,   0, 
-      5,   0,  61,   0,   5,   0, 
-     61,   0,   5,   0,  61,   0, 
-      5,   0,  61,   0,   5,   0, 
-     61,   0,   5,   0,  61,   0, 
-      5,   0,  61,   0,   5,   0, 
-     61,   0,  27,   0,  40,   0, 
-      5,   0,  61,   0,  27,   0, 
-     40,   0,   9,   0,  71,   0, 
-     20,   0,  30,   0,   9,   0, 
-     71,   0,   9,   0,  71,   0, 
-      9,   0,  71,   0,   9,   0, 
-     71,   0,   9,   0,  71,   0, 
-      9,   0,  71,   0,   9,   0, 
-     71,   0,   9,   0,  71,   0, 
-      9,   0,  71,   0,  33,   0, 
-     48,   0,   9,   0,  71,   0, 
-     33,   0,  48,   0,  13,   0, 
-    100,   0,  43,   0,  52,   0, 
-     13,   0, 100,   0,  56,   0, 
-     63,   0,  13,   0, 100,   0, 
-     43,   0,  63,   0,  13,   0, 
-    100,   0,  66,   0,  75,   0, 
-     13,   0, 100,   0,  79,   0, 
-     86,   0,  13,   0, 100,   0, 
-     66,   0,  86,   0,  13,   0, 
-    100,   0,  89,   0,  98,   0, 
-     13,   0, 100,   0,  32,   0, 
-     54,   0,  13,   0, 100,   0, 
-     58,   0,  77,   0,  13,   0, 
-    100,   0,  32,   0,  77,   0, 
-     13,   0, 100,   0,  81,   0, 
-     99,   0,  13,   0, 100,   0, 
-     32,   0,  99,   0,  13,   0, 
-     81,   0,  27,   0,  51,   0, 
-     13,   0,  81,   0,  59,   0, 
-     68,   0,  13,   0,  81,   0, 
-     27,   0,  68,   0,  13,   0, 
-     81,   0,  71,   0,  80,   0, 
-     13,   0,  81,   0,  27,   0, 
-     80,   0,  13,   0,  81,   0, 
-     13,   0,  80,   0,  13,   0, 
-     24,   0,  13,   0,  23,   0, 
-      9,   0,   9,   0,  51,   0, 
-     70,   0,   9,   0,   9,   0, 
-      9,   0,   9,   0,   9,   0, 
-      9,   0,   9,   0,   9,   0, 
-      9,   0,   9,   0,   9,   0, 
-      9,   0,   5,   0,   5,   0, 
-     43,   0,  60,   0,   5,   0, 
-      5,   0,   5,   0,   5,   0, 
-      5,   0,  60,   0,  18,   0, 
-     32,   0,   5,   0,  60,   0, 
-     37,   0,  58,   0,   5,   0, 
-     60,   0,  18,   0,  59,   0, 
-      2,   0,  32,   0,   2,   0, 
-     32,   0,   2,   0,  32,   0, 
-      2,   0,  32,   0,   2,   0, 
-     32,   0,   2,   0,  32,   0, 
-    246,   0,   0,   0,   4,   0, 
-      0,   0,   1,   0,   0,   0, 
-     16,   0,   0,   0,   0,   0, 
-      0,   0,  48,   0,   0,   0, 
-     72,   0,   0,   0,  96,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,  11, 202,  49,   1, 
-     56,   0,   0,   0,   0,  16, 
-      0,   0,  12,  16,   0,   0, 
-    180,   0,   0,   0,  11,   0, 
-    255, 255,   4,   0,   0,   0, 
-    255, 255,   3,   0,   0,   0, 
-      0,   0,  48,   0,   0,   0, 
-     48,   0,   0,   0,   8,   0, 
-      0,   0,  56,   0,   0,   0, 
-      0,   0,   0,   0,  22,   0, 
-     27,  21,  64,   0,   0,   0, 
-      3,   0,   0,   0,  12,   0, 
-    102, 108, 111,  97, 116,  51, 
-      0, 243, 242, 241,  10,   0, 
-      1,  18,   1,   0,   0,   0, 
-      0,  16,   0,   0,  22,   0, 
-     27,  21,  64,   0,   0,   0, 
-      4,   0,   0,   0,  16,   0, 
-    102, 108, 111,  97, 116,  52, 
-      0, 243, 242, 241,  10,   0, 
-     24,  21,   2,  16,   0,   0, 
-      1,   0,   1,   0,  14,   0, 
-      8,  16,   3,  16,   0,   0, 
-     23,   0,   1,   0,   1,  16, 
-      0,   0,  10,   0,  24,  21, 
-     64,   0,   0,   0,   1,   0, 
-      1,   0,  14,   0,  23,  21, 
-      2,  16,   0,   0,   6,   2, 
-    208, 138,   0,   0, 242, 241, 
-     10,   0,  24,  21,   6,  16, 
-      0,   0,   1,   0,   1,   0, 
-     10,   0,  24,  21,   7,  16, 
-      0,   0,   1,   0,   0,   2, 
-     14,   0,  23,  21,   0,   0, 
-      0,   0,  10,   2, 208, 138, 
-      0,   0, 242, 241,  10,   0, 
-     24,  21,   9,  16,   0,   0, 
-      1,   0,   1,   0,  10,   0, 
-     24,  21,  10,  16,   0,   0, 
-      1,   0,   0,   2,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,  11, 202, 
-     49,   1,  56,   0,   0,   0, 
-      0,  16,   0,   0,   0,  16, 
-      0,   0,   0,   0,   0,   0, 
-     12,   0, 255, 255,   4,   0, 
-      0,   0, 255, 255,   3,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-    255, 255, 255, 255,  26,   9, 
-     47, 241,  32,   0,   0,   0, 
-     20,   2,   0,   0,  49,   0, 
-      0,   0,   1,   0,   0,   0, 
-      1,   0,   0,   0,   1,   0, 
-      0,   0,  73,   0,   0,   0, 
-      1,   0,   0,   0,  97,   0, 
-      0,   0,   1,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,  16,   0,   0,   0, 
-      0,   0,   0,   0,   0,   8, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   2,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   2,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,  12,   0, 
-      0,   0,  24,   0,   0,   0, 
-     36,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,  46,   0, 
-     37,  17,   0,   0,   0,   0, 
-    152,   0,   0,   0,   1,   0, 
-     67, 111, 110, 118, 111, 108, 
-    117, 116, 101,  66,  97,  99, 
-    107, 103, 114, 111, 117, 110, 
-    100,  80, 105, 120, 101, 108, 
-     83, 104,  97, 100, 101, 114, 
-      0,   0,   0,   0,  22,   0, 
-     81,  17,   8,  16,   0,   0, 
-      7,   0, 255, 255, 255, 255, 
-      0,   0, 255, 255, 255, 255, 
-    116, 101, 120,   0,  22,   0, 
-     81,  17,  11,  16,   0,   0, 
-      6,   0, 255, 255, 255, 255, 
-    255, 255,   0,   0, 255, 255, 
-    115, 115,   0,   0,  22,   0, 
-     82,  17,   5,  16,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-    255, 255, 255, 255, 255, 255, 
-     80,  73,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-     16,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0, 255, 255, 
-    255, 255,  26,   9,  47, 241, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0, 255, 255, 255, 255, 
-    119,   9,  49,   1,   1,   0, 
-      0,   0,  14,   0,  20, 142, 
-     15,   0,  20, 107,  16,   0, 
-      1,   0, 100,   0,   0,   0, 
-     32,   0,   0,   0,  44,   0, 
-      0,   0, 148,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,  22,   0,   0,   0, 
-     25,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   1,   0, 
-      0,   0,   0,   0,   0,   0, 
-    104,   6,   0,   0,  32,   0, 
-      0,  96,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   2,   0,  10,   0, 
-    252,   7,   0,   0,   0,   0, 
-      0,   0, 184,   6,   0,   0, 
-      2,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,  67, 111, 
-    110, 118, 111, 108, 117, 116, 
-    101,  66,  97,  99, 107, 103, 
-    114, 111, 117, 110, 100,  80, 
-    105, 120, 101, 108,  83, 104, 
-     97, 100, 101, 114,   0, 110, 
-    111, 110, 101,   0,  45, 186, 
-     46, 241,   1,   0,   0,   0, 
-      0,   0,   0,   0, 104,   6, 
-      0,   0,  32,   0,   0,  96, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      2,   0,   2,   0,   7,   0, 
-      0,   0,   0,   0,   1,   0, 
-    255, 255, 255, 255,   0,   0, 
-      0,   0, 104,   6,   0,   0, 
-      8,   2,   0,   0,   0,   0, 
-      0,   0, 255, 255, 255, 255, 
-      0,   0,   0,   0, 255, 255, 
-    255, 255,   1,   0,   2,   0, 
-      0,   0,   2,   0,   0,   0, 
-      0,   0,  75,   0,   0,   0, 
-     69,  58,  92,  80, 114, 111, 
-    106, 101,  99, 116, 115,  92, 
-     78, 105,  99, 107, 101, 108, 
-     92,  78, 105,  99, 107, 101, 
-    108,  92,  68,  97, 116,  97, 
-     92,  83, 104,  97, 100, 101, 
-    114, 115,  92,  67, 111, 110, 
-    118, 111, 108, 117, 116, 101, 
-     66,  97,  99, 107, 103, 114, 
-    111, 117, 110, 100,  80, 105, 
-    120, 101, 108,  83, 104,  97, 
-    100, 101, 114,  46, 104, 108, 
-    115, 108,   0,  69,  58,  92, 
-     80, 114, 111, 106, 101,  99, 
-    116, 115,  92,  78, 105,  99, 
-    107, 101, 108,  92,  78, 105, 
-     99, 107, 101, 108,  92,  68, 
-     97, 116,  97,  92,  83, 104, 
-     97, 100, 101, 114, 115,  92, 
-     80,  98, 114,  72, 101, 108, 
-    112, 101, 114,  46, 104, 108, 
-    115, 108,   0,   0,   0,   0, 
-    254, 239, 254, 239,   1,   0, 
-      0,   0,   1,   0,   0,   0, 
-      0,   1,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255,  13, 
-      0, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,  51,  40, 
-     48,  46,  48,  44,  32,  48, 
-     46,  48,  44,  32,  48,  46, 
-     48,  41,  59,  10,  10,  32, 
-     32,  32,  32, 102, 108, 111, 
-     97, 116,  51,  32, 117, 112, 
-     32,  61,  32, 102, 108, 111, 
-     97, 116,  51,  40,  48,  46, 
-     48,  44,  32,  49,  46,  48, 
-     44,  32,  48,  46,  48,  41, 
-     59,  10,  32,  32,  32,  32, 
-    102, 108, 111,  97, 116,  51, 
-     32, 114, 105, 103, 104, 116, 
-     32,  61,  32, 110, 111, 114, 
-    109,  97, 108, 105, 122, 101, 
-     40,  99, 114, 111, 115, 115, 
-     40, 117, 112,  44,  32,  78, 
-     41,  41,  59,  10,  32,  32, 
-     32,  32, 117, 112,  32,  61, 
-     32, 110, 111, 114, 109,  97, 
-    108, 105, 122, 101,  40,  99, 
-    114, 111, 115, 115,  40,  78, 
-     44,  32, 114, 105, 103, 104, 
-    116,  41,  41,  59,  10,  10, 
-     32,  32,  32,  32, 102, 108, 
-    111,  97, 116,  32, 115,  97, 
-    109, 112, 108, 101,  68, 101, 
-    108, 116,  97,  32,  61,  32, 
-     48,  46,  48,  50,  53,  59, 
-     10,  32,  32,  32,  32, 102, 
-    108, 111,  97, 116,  32, 110, 
-    114,  83,  97, 109, 112, 108, 
-    101, 115,  32,  61,  32,  48, 
-     46,  48,  59,  10,  32,  32, 
-     32,  32, 102, 111, 114,  32, 
-     40, 102, 108, 111,  97, 116, 
-     32, 112, 104, 105,  32,  61, 
-     32,  48,  46,  48,  59,  32, 
-    112, 104, 105,  32,  60,  32, 
-     50,  46,  48,  32,  42,  32, 
-     80,  73,  59,  32, 112, 104, 
-    105,  32,  43,  61,  32, 115, 
-     97, 109, 112, 108, 101,  68, 
-    101, 108, 116,  97,  41,  32, 
-    123,  10,  32,  32,  32,  32, 
-     32,  32,  32,  32, 102, 111, 
-    114,  32,  40, 102, 108, 111, 
-     97, 116,  32, 116, 104, 101, 
-    116,  97,  32,  61,  32,  48, 
-     46,  48,  59,  32, 116, 104, 
-    101, 116,  97,  32,  60,  32, 
-     48,  46,  53,  32,  42,  32, 
-     80,  73,  59,  32, 116, 104, 
-    101, 116,  97,  32,  43,  61, 
-     32, 115,  97, 109, 112, 108, 
-    101,  68, 101, 108, 116,  97, 
-     41,  32, 123,  10,  32,  32, 
-     32,  32,  32,  32,  32,  32, 
-     32,  32,  32,  32,  47,  47, 
-     32, 115, 112, 104, 101, 114, 
-    105,  99,  97, 108,  32, 116, 
-    111,  32,  99,  97, 114, 116, 
-    101, 115, 105,  97, 110,  32, 
-     40, 105, 110,  32, 116,  97, 
-    110, 103, 101, 110, 116,  32, 
-    115, 112,  97,  99, 101,  41, 
-     10,  32,  32,  32,  32,  32, 
-     32,  32,  32,  32,  32,  32, 
-     32, 102, 108, 111,  97, 116, 
-     51,  32, 116,  97, 110, 103, 
-    101, 110, 116,  83,  97, 109, 
-    112, 108, 101,  32,  61,  32, 
-    102, 108, 111,  97, 116,  51, 
-     40, 115, 105, 110,  40, 116, 
-    104, 101, 116,  97,  41,  32, 
-     42,  32,  99, 111, 115,  40, 
-    112, 104, 105,  41,  44,  32, 
-    115, 105, 110,  40, 116, 104, 
-    101, 116,  97,  41,  32,  42, 
-     32, 115, 105, 110,  40, 112, 
-    104, 105,  41,  44,  32,  99, 
-    111, 115,  40, 116, 104, 101, 
-    116,  97,  41,  41,  59,  10, 
-     32,  32,  32,  32,  32,  32, 
-     32,  32,  32,  32,  32,  32, 
-     47,  47,  32, 116,  97, 110, 
-    103, 101, 110, 116,  32, 115, 
-    112,  97,  99, 101,  32, 116, 
-    111,  32, 119, 111, 114, 108, 
-    100,  10,  32,  32,  32,  32, 
-     32,  32,  32,  32,  32,  32, 
-     32,  32, 102, 108, 111,  97, 
-    116,  51,  32, 115,  97, 109, 
-    112, 108, 101,  86, 101,  99, 
-     32,  61,  32, 116,  97, 110, 
-    103, 101, 110, 116,  83,  97, 
-    109, 112, 108, 101,  46, 120, 
-     32,  42,  32, 114, 105, 103, 
-    104, 116,  32,  43,  32, 116, 
-     97, 110, 103, 101, 110, 116, 
-     83,  97, 109, 112, 108, 101, 
-     46, 121,  32,  42,  32, 117, 
-    112,  32,  43,  32, 116,  97, 
-    110, 103, 101, 110, 116,  83, 
-     97, 109, 112, 108, 101,  46, 
-    122,  32,  42,  32,  78,  59, 
-     10,  10,  32,  32,  32,  32, 
-     32,  32,  32,  32,  32,  32, 
-     32,  32, 105, 114, 114,  97, 
-    100, 105,  97, 110,  99, 101, 
-     32,  43,  61,  32, 116, 101, 
-    120,  46,  83,  97, 109, 112, 
-    108, 101,  40, 115, 115,  44, 
-     32, 115,  97, 109, 112, 108, 
-    101,  86, 101,  99,  41,  46, 
-    114, 103,  98,  32,  42,  32, 
-     99, 111, 115,  40, 116, 104, 
-    101, 116,  97,  41,  42,  32, 
-    115, 105, 110,  40, 116, 104, 
-    101, 116,  97,  41,  59,  10, 
-     32,  32,  32,  32,  32,  32, 
-     32,  32,  32,  32,  32,  32, 
-    110, 114,  83,  97, 109, 112, 
-    108, 101, 115,  43,  43,  59, 
-     10,  32,  32,  32,  32,  32, 
-     32,  32,  32, 125,  10,  32, 
-     32,  32,  32, 125,  10,  32, 
-     32,  32,  32, 105, 114, 114, 
-     97, 100, 105,  97, 110,  99, 
-    101,  32,  61,  32,  80,  73, 
-     32,  42,  32, 105, 114, 114, 
-     97, 100, 105,  97, 110,  99, 
-    101,  32,  42,  32,  40,  49, 
-     46,  48,  32,  47,  32, 102, 
-    108, 111,  97, 116,  40, 110, 
-    114,  83,  97, 109, 112, 108, 
-    101, 115,  41,  41,  59,  10, 
-     10,   9, 114, 101, 116, 117, 
-    114, 110,  32, 102, 108, 111, 
-     97, 116,  52,  40, 105, 114, 
-    114,  97, 100, 105,  97, 110, 
-     99, 101,  44,  32,  49,  46, 
-     48,  41,  59,  10, 125,   0, 
-    115, 116,  97, 116, 105,  99, 
-     32,  99, 111, 110, 115, 116, 
-     32, 102, 108, 111,  97, 116, 
-     32,  80,  73,  32,  61,  32, 
-     51,  46,  49,  52,  49,  53, 
-     57,  50,  54,  53,  51,  53, 
-     57,  59,  10,  10, 105, 110, 
-    108, 105, 110, 101,  32, 102, 
-    108, 111,  97, 116,  51,  32, 
-     84, 111, 110, 101,  77,  97, 
-    112,  72,  68,  82,  40,  99, 
-    111, 110, 115, 116,  32, 102, 
-    108, 111,  97, 116,  51,  32, 
-     99, 111, 108, 111, 114,  41, 
-     32, 123,  10,  32,  32,  32, 
-     32,  47,  47,  32,  82, 101, 
-    105, 110, 104,  97, 114, 100, 
-     32, 111, 112, 101, 114,  97, 
-    116, 111, 114,  10,  32,  32, 
-     32,  32, 114, 101, 116, 117, 
-    114, 110,  32,  99, 111, 108, 
-    111, 114,  32,  47,  32,  40, 
-     99, 111, 108, 111, 114,  32, 
-     43,  32, 102, 108, 111,  97, 
-    116,  51,  40,  49,  46,  48, 
-     44,  32,  49,  46,  48,  44, 
-     32,  49,  46,  48,  41,  41, 
-     59,  10, 125,  10,  10, 105, 
-    110, 108, 105, 110, 101,  32, 
-    102, 108, 111,  97, 116,  51, 
-     32,  67, 111, 114, 114, 101, 
-     99, 116,  71,  97, 109, 109, 
-     97,  40,  99, 111, 110, 115, 
-    116,  32, 102, 108, 111,  97, 
-    116,  51,  32,  99, 111, 108, 
-    111, 114,  41,  32, 123,  10, 
-     32,  32,  32,  32,  99, 111, 
-    110, 115, 116,  32, 102, 108, 
-    111,  97, 116,  32, 112, 111, 
-    119,  78,  32,  61,  32,  49, 
-     46,  48,  32,  47,  32,  50, 
-     46,  50,  59,  10,  32,  32, 
-     32,  32, 114, 101, 116, 117, 
-    114, 110,  32, 112, 111, 119, 
-     40,  99, 111, 108, 111, 114, 
-     44,  32, 102, 108, 111,  97, 
-    116,  51,  40, 112, 111, 119, 
-     78,  44,  32, 112, 111, 119, 
-     78,  44,  32, 112, 111, 119, 
-     78,  41,  41,  59,  10, 125, 
-     10,  10, 102, 108, 111,  97, 
-    116,  32,  68, 105, 115, 116, 
-    114, 105,  98, 117, 116, 105, 
-    111, 110,  71,  71,  88,  40, 
-    102, 108, 111,  97, 116,  51, 
-     32,  78,  44,  32, 102, 108, 
-    111,  97, 116,  51,  32,  72, 
-     44,  32, 102, 108, 111,  97, 
-    116,  32, 114, 111, 117, 103, 
-    104, 110, 101, 115, 115,  41, 
-     32, 123,  10,  32,  32,  32, 
-     32, 102, 108, 111,  97, 116, 
-     32,  97,  32,  61,  32, 114, 
-    111, 117, 103, 104, 110, 101, 
-    115, 115,  32,  42,  32, 114, 
-    111, 117, 103, 104, 110, 101, 
-    115, 115,  59,  10,  32,  32, 
-     32,  32, 102, 108, 111,  97, 
-    116,  32,  97,  50,  32,  61, 
-     32,  97,  32,  42,  32,  97, 
-     59,  10,  32,  32,  32,  32, 
-    102, 108, 111,  97, 116,  32, 
-     78, 100, 111, 116,  72,  32, 
-     61,  32, 109,  97, 120,  40, 
-    100, 111, 116,  40,  78,  44, 
-     32,  72,  41,  44,  32,  48, 
-     46,  48,  41,  59,  10,  32, 
-     32,  32,  32, 102, 108, 111, 
-     97, 116,  32,  78, 100, 111, 
-    116,  72,  50,  32,  61,  32, 
-     78, 100, 111, 116,  72,  32, 
-     42,  32,  78, 100, 111, 116, 
-     72,  59,  10,  10,  32,  32, 
-     32,  32, 102, 108, 111,  97, 
-    116,  32, 110, 117, 109,  32, 
-     61,  32,  97,  50,  59,  10, 
-     32,  32,  32,  32, 102, 108, 
-    111,  97, 116,  32, 100, 101, 
-    110, 111, 109,  32,  61,  32, 
-     40,  78, 100, 111, 116,  72, 
-     50,  32,  42,  32,  40,  97, 
-     50,  32,  45,  32,  49,  46, 
-     48,  41,  32,  43,  32,  49, 
-     46,  48,  41,  59,  10,  32, 
-     32,  32,  32, 100, 101, 110, 
-    111, 109,  32,  61,  32,  80, 
-     73,  32,  42,  32, 100, 101, 
-    110, 111, 109,  32,  42,  32, 
-    100, 101, 110, 111, 109,  59, 
-     10,  10,  32,  32,  32,  32, 
-    114, 101, 116, 117, 114, 110, 
-     32, 110, 117, 109,  32,  47, 
-     32, 100, 101, 110, 111, 109, 
-     59,  10, 125,  10,  10, 102, 
-    108, 111,  97, 116,  32,  71, 
-    101, 111, 109, 101, 116, 114, 
-    121,  83,  99, 104, 108, 105, 
-     99, 107,  71,  71,  88,  40, 
-    102, 108, 111,  97, 116,  32, 
-     78, 100, 111, 116,  86,  44, 
-     32, 102, 108, 111,  97, 116, 
-     32, 114, 111, 117, 103, 104, 
-    110, 101, 115, 115,  41,  32, 
-    123,  10,  32,  32,  32,  32, 
-    102, 108, 111,  97, 116,  32, 
-    114,  32,  61,  32,  40, 114, 
-    111, 117, 103, 104, 110, 101, 
-    115, 115,  32,  43,  32,  49, 
-     46,  48,  41,  59,  10,  32, 
-     32,  32,  32, 102, 108, 111, 
-     97, 116,  32, 107,  32,  61, 
-     32,  40, 114,  32,  42,  32, 
-    114,  41,  32,  47,  32,  56, 
-     46,  48,  59,  10,  10,  32, 
-     32,  32,  32, 102, 108, 111, 
-     97, 116,  32, 110, 117, 109, 
-     32,  61,  32,  78, 100, 111, 
-    116,  86,  59,  10,  32,  32, 
-     32,  32, 102, 108, 111,  97, 
-    116,  32, 100, 101, 110, 111, 
-    109,  32,  61,  32,  78, 100, 
-    111, 116,  86,  32,  42,  32, 
-     40,  49,  46,  48,  32,  45, 
-     32, 107,  41,  32,  43,  32, 
-    107,  59,  10,  10,  32,  32, 
-     32,  32, 114, 101, 116, 117, 
-    114, 110,  32, 110, 117, 109, 
-     32,  47,  32, 100, 101, 110, 
-    111, 109,  59,  10, 125,  10, 
-     10, 102, 108, 111,  97, 116, 
-     32,  71, 101, 111, 109, 101, 
-    116, 114, 121,  83, 109, 105, 
-    116, 104,  40, 102, 108, 111, 
-     97, 116,  51,  32,  78,  44, 
-     32, 102, 108, 111,  97, 116, 
-     51,  32,  86,  44,  32, 102, 
-    108, 111,  97, 116,  51,  32, 
-     76,  44,  32, 102, 108, 111, 
-     97, 116,  32, 114, 111, 117, 
-    103, 104, 110, 101, 115, 115, 
-     41,  32, 123,  10,  32,  32, 
-     32,  32, 102, 108, 111,  97, 
-    116,  32,  78, 100, 111, 116, 
-     86,  32,  61,  32, 109,  97, 
-    120,  40, 100, 111, 116,  40, 
-     78,  44,  32,  86,  41,  44, 
-     32,  48,  46,  48,  41,  59, 
-     10,  32,  32,  32,  32, 102, 
-    108, 111,  97, 116,  32,  78, 
-    100, 111, 116,  76,  32,  61, 
-     32, 109,  97, 120,  40, 100, 
-    111, 116,  40,  78,  44,  32, 
-     76,  41,  44,  32,  48,  46, 
-     48,  41,  59,  10,  32,  32, 
-     32,  32, 102, 108, 111,  97, 
-    116,  32, 103, 103, 120,  50, 
-     32,  61,  32,  71, 101, 111, 
-    109, 101, 116, 114, 121,  83, 
-     99, 104, 108, 105,  99, 107, 
-     71,  71,  88,  40,  78, 100, 
-    111, 116,  86,  44,  32, 114, 
-    111, 117, 103, 104, 110, 101, 
-    115, 115,  41,  59,  10,  32, 
-     32,  32,  32, 102, 108, 111, 
-     97, 116,  32, 103, 103, 120, 
-     49,  32,  61,  32,  71, 101, 
-    111, 109, 101, 116, 114, 121, 
-     83,  99, 104, 108, 105,  99, 
-    107,  71,  71,  88,  40,  78, 
-    100, 111, 116,  76,  44,  32, 
-    114, 111, 117, 103, 104, 110, 
-    101, 115, 115,  41,  59,  10, 
-     10,  32,  32,  32,  32, 114, 
-    101, 116, 117, 114, 110,  32, 
-    103, 103, 120,  49,  32,  42, 
-     32, 103, 103, 120,  50,  59, 
-     10, 125,  10,  10, 102, 108, 
-    111,  97, 116,  51,  32,  70, 
-    114, 101, 115, 110, 101, 108, 
-     83,  99, 104, 108, 105,  99, 
-    107,  40, 102, 108, 111,  97, 
-    116,  32,  99, 111, 115,  84, 
-    104, 101, 116,  97,  44,  32, 
-    102, 108, 111,  97, 116,  51, 
-     32,  70,  48,  41,  32, 123, 
-     10,  32,  32,  32,  32, 114, 
-    101, 116, 117, 114, 110,  32, 
-     70,  48,  32,  43,  32,  40, 
-     49,  46,  48,  32,  45,  32, 
-     70,  48,  41,  32,  42,  32, 
-    112, 111, 119,  40, 115,  97, 
-    116, 117, 114,  97, 116, 101, 
-     40,  49,  46,  48,  32,  45, 
-     32,  99, 111, 115,  84, 104, 
-    101, 116,  97,  41,  44,  32, 
-     53,  46,  48,  41,  59,  10, 
-    125,  10,  10, 102, 108, 111, 
-     97, 116,  51,  32,  70, 114, 
-    101, 115, 110, 101, 108,  83, 
-     99, 104, 108, 105,  99, 107, 
-     82, 111, 117, 103, 104, 110, 
-    101, 115, 115,  40, 102, 108, 
-    111,  97, 116,  32,  99, 111, 
-    115,  84, 104, 101, 116,  97, 
-     44,  32, 102, 108, 111,  97, 
-    116,  51,  32,  70,  48,  44, 
-     32, 102, 108, 111,  97, 116, 
-     32, 114, 111, 117, 103, 104, 
-    110, 101, 115, 115,  41,  32, 
-    123,  10,  32,  32,  32,  32, 
-     99, 111, 110, 115, 116,  32, 
-    102, 108, 111,  97, 116,  32, 
-    111, 110, 101,  77, 105, 110, 
-    117, 115,  82, 111, 117, 103, 
-    104, 110, 101, 115, 115,  32, 
-     61,  32,  49,  46,  48,  32, 
-     45,  32, 114, 111, 117, 103, 
-    104, 110, 101, 115, 115,  59, 
-     10,  32,  32,  32,  32, 114, 
-    101, 116, 117, 114, 110,  32, 
-     70,  48,  32,  43,  32,  40, 
-    109,  97, 120,  40, 102, 108, 
-    111,  97, 116,  51,  40, 111, 
-    110, 101,  77, 105, 110, 117, 
-    115,  82, 111, 117, 103, 104, 
-    110, 101, 115, 115,  44,  32, 
-    111, 110, 101,  77, 105, 110, 
-    117, 115,  82, 111, 117, 103, 
-    104, 110, 101, 115, 115,  44, 
-     32, 111, 110, 101,  77, 105, 
-    110, 117, 115,  82, 111, 117, 
-    103, 104, 110, 101, 115, 115, 
-     41,  44,  32,  70,  48,  41, 
-     32,  45,  32,  70,  48,  41, 
-     32,  42,  32, 112, 111, 119, 
-     40, 115,  97, 116, 117, 114, 
-     97, 116, 101,  40,  49,  46, 
-     48,  32,  45,  32,  99, 111, 
-    115,  84, 104, 101, 116,  97, 
-     41,  44,  32,  53,  46,  48, 
-     41,  59,  10, 125,   0,  11, 
-      0,   0,   0,   0,   0,   0, 
-      0,  76,   0,   0,   0, 152, 
-      0,   0,   0, 206,   0,   0, 
-      0,   1,   0,   0,   0,   4, 
-      1,   0,   0,  77,   0,   0, 
-      0,  74,   5,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   7, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0, 148,  46,  49,   1, 
-    138, 176, 147,  97,   1,   0, 
-      0,   0, 120, 101, 141, 102, 
-    194, 143,  36,  67, 146,  28, 
-    136, 184,  77, 246, 154,  41, 
-    185,   0,   0,   0,  47,  76, 
-    105, 110, 107,  73, 110, 102, 
-    111,   0,  47, 110,  97, 109, 
-    101, 115,   0,  47, 115, 114, 
-     99,  47, 104, 101,  97, 100, 
-    101, 114,  98, 108, 111,  99, 
-    107,   0,  47, 115, 114,  99, 
-     47, 102, 105, 108, 101, 115, 
-     47, 101,  58,  92, 112, 114, 
-    111, 106, 101,  99, 116, 115, 
-     92, 110, 105,  99, 107, 101, 
-    108,  92, 110, 105,  99, 107, 
-    101, 108,  92, 100,  97, 116, 
-     97,  92, 115, 104,  97, 100, 
-    101, 114, 115,  92,  99, 111, 
-    110, 118, 111, 108, 117, 116, 
-    101,  98,  97,  99, 107, 103, 
-    114, 111, 117, 110, 100, 112, 
-    105, 120, 101, 108, 115, 104, 
-     97, 100, 101, 114,  46, 104, 
-    108, 115, 108,   0,  47, 115, 
-    114,  99,  47, 102, 105, 108, 
-    101, 115,  47, 101,  58,  92, 
-    112, 114, 111, 106, 101,  99, 
-    116, 115,  92, 110, 105,  99, 
-    107, 101, 108,  92, 110, 105, 
-     99, 107, 101, 108,  92, 100, 
-     97, 116,  97,  92, 115, 104, 
-     97, 100, 101, 114, 115,  92, 
-    112,  98, 114, 104, 101, 108, 
-    112, 101, 114,  46, 104, 108, 
-    115, 108,   0,   5,   0,   0, 
-      0,  10,   0,   0,   0,   1, 
-      0,   0,   0,  46,   1,   0, 
-      0,   0,   0,   0,   0,  17, 
-      0,   0,   0,   7,   0,   0, 
-      0,   0,   0,   0,   0,   5, 
-      0,   0,   0, 120,   0,   0, 
-      0,   9,   0,   0,   0,  10, 
-      0,   0,   0,   6,   0,   0, 
-      0,  34,   0,   0,   0,   8, 
-      0,   0,   0,   0,   0,   0, 
-      0, 220,  81,  51,   1,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,  17,   0, 
-      0,   0,  32,   0,   0,   0, 
-     29,   1,   0,   0, 236,   0, 
-      0,   0, 179,   1,   0,   0, 
-     56,   0,   0,   0,   0,   0, 
-      0,   0, 107,  11,   0,   0, 
-    172,   0,   0,   0,  69,   4, 
-      0,   0, 224,   5,   0,   0, 
-    200,  14,   0,   0,  56,   0, 
-      0,   0,   0,   0,   0,   0, 
-     40,   0,   0,   0,  68,   2, 
-      0,   0,  44,   0,   0,   0, 
-    120,   0,   0,   0,   3,   0, 
-      0,   0,  36,   0,   0,   0, 
-     24,   0,   0,   0,  30,   0, 
-      0,   0,  25,   0,   0,   0, 
-     14,   0,   0,   0,  31,   0, 
-      0,   0,  32,   0,   0,   0, 
-     33,   0,   0,   0,  34,   0, 
-      0,   0,  35,   0,   0,   0, 
-     15,   0,   0,   0,   8,   0, 
-      0,   0,   9,   0,   0,   0, 
-     10,   0,   0,   0,  11,   0, 
-      0,   0,  12,   0,   0,   0, 
-     13,   0,   0,   0,  16,   0, 
-      0,   0,  17,   0,   0,   0, 
-     18,   0,   0,   0,  19,   0, 
-      0,   0,  20,   0,   0,   0, 
-     21,   0,   0,   0,  22,   0, 
-      0,   0,  23,   0,   0,   0, 
-      7,   0,   0,   0,   6,   0, 
-      0,   0,  26,   0,   0,   0, 
-     27,   0,   0,   0,  29,   0, 
-      0,   0,  28,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-     37,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0
-};
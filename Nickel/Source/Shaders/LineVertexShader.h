@@ -1,4852 +0,0 @@
-#if 0
-//
-// Generated by Microsoft (R) HLSL Shader Compiler 10.1
-//
-//
-// Buffer Definitions: 
-//
-// cbuffer PerApplication
-// {
-//
-//   float4x4 projectionMatrix;         // Offset:    0 Size:    64 [unused]
-//   float3 clientData;                 // Offset:   64 Size:    12
-//
-// }
-//
-// cbuffer PerObject
-// {
-//
-//   float4x4 modelMatrix;              // Offset:    0 Size:    64 [unused]
-//   float4x4 viewProjectionMatrix;     // Offset:   64 Size:    64 [unused]
-//   float4x4 modelViewProjectionMatrix;// Offset:  128 Size:    64
-//
-// }
-//
-// cbuffer ShaderData
-// {
-//
-//   float thickness;                   // Offset:    0 Size:     4
-//   int miter;                         // Offset:    4 Size:     4
-//
-// }
-//
-//
-// Resource Bindings:
-//
-// Name                                 Type  Format         Dim      HLSL Bind  Count
-// ------------------------------ ---------- ------- ----------- -------------- ------
-// PerApplication                    cbuffer      NA          NA            cb0      1 
-// PerObject                         cbuffer      NA          NA            cb2      1 
-// ShaderData                        cbuffer      NA          NA            cb3      1 
-//
-//
-//
-// Input signature:
-//
-// Name                 Index   Mask Register SysValue  Format   Used
-// -------------------- ----- ------ -------- -------- ------- ------
-// POSITION                 0   xyz         0     NONE   float   xyz 
-// POSITION                 2   xyz         1     NONE   float   xyz 
-// POSITION                 3   xyz         2     NONE   float   xyz 
-// DIRECTION                0   xyz         3     NONE   float   x   
-//
-//
-// Output signature:
-//
-// Name                 Index   Mask Register SysValue  Format   Used
-// -------------------- ----- ------ -------- -------- ------- ------
-// COLOR                    0   xyzw        0     NONE   float   xyzw
-// SV_POSITION              0   xyzw        1      POS   float   xyzw
-//
-vs_5_0
-dcl_globalFlags refactoringAllowed | skipOptimization
-dcl_constantbuffer CB0[5], immediateIndexed
-dcl_constantbuffer CB2[12], immediateIndexed
-dcl_constantbuffer CB3[1], immediateIndexed
-dcl_input v0.xyz
-dcl_input v1.xyz
-dcl_input v2.xyz
-dcl_input v3.x
-dcl_output o0.xyzw
-dcl_output_siv o1.xyzw, position
-dcl_temps 5
-//
-// Initial variable locations:
-//   v0.x <- IN.position.x; v0.y <- IN.position.y; v0.z <- IN.position.z; 
-//   v1.x <- IN.previous.x; v1.y <- IN.previous.y; v1.z <- IN.previous.z; 
-//   v2.x <- IN.next.x; v2.y <- IN.next.y; v2.z <- IN.next.z; 
-//   v3.x <- IN.direction.x; v3.y <- IN.direction.y; v3.z <- IN.direction.z; 
-//   o1.x <- <LineVertexShader return value>.position.x; o1.y <- <LineVertexShader return value>.position.y; o1.z <- <LineVertexShader return value>.position.z; o1.w <- <LineVertexShader return value>.position.w; 
-//   o0.x <- <LineVertexShader return value>.color.x; o0.y <- <LineVertexShader return value>.color.y; o0.z <- <LineVertexShader return value>.color.z; o0.w <- <LineVertexShader return value>.color.w
-//
-#line 35 "E:\Projects\Nickel\Nickel\Data\Shaders\LineVertexShader.hlsl"
-mov r0.xyz, v1.xyzx
-mov r0.w, l(1.000000)
-dp4 r1.x, r0.xyzw, cb2[8].xyzw  // r1.x <- previousProjected.x
-dp4 r1.y, r0.xyzw, cb2[9].xyzw  // r1.y <- previousProjected.y
-dp4 r0.x, r0.xyzw, cb2[11].xyzw  // r0.x <- previousProjected.w
-
-#line 36
-mov r2.xyz, v0.xyzx
-mov r2.w, l(1.000000)
-dp4 r3.x, r2.xyzw, cb2[8].xyzw  // r3.x <- currentProjected.x
-dp4 r3.y, r2.xyzw, cb2[9].xyzw  // r3.y <- currentProjected.y
-dp4 r3.z, r2.xyzw, cb2[10].xyzw  // r3.z <- currentProjected.z
-dp4 r3.w, r2.xyzw, cb2[11].xyzw  // r3.w <- currentProjected.w
-
-#line 37
-mov r2.xyz, v2.xyzx
-mov r2.w, l(1.000000)
-dp4 r4.x, r2.xyzw, cb2[8].xyzw  // r4.x <- nextProjected.x
-dp4 r4.y, r2.xyzw, cb2[9].xyzw  // r4.y <- nextProjected.y
-dp4 r0.y, r2.xyzw, cb2[11].xyzw  // r0.y <- nextProjected.w
-
-#line 39
-mov r2.x, cb0[4].z  // r2.x <- aspectRatio
-
-#line 40
-mov r2.x, r2.x  // r2.x <- aspectVec.x
-mov r2.y, l(1.000000)  // r2.y <- aspectVec.y
-
-#line 42
-div r0.zw, r3.xxxy, r3.wwww
-mul r0.zw, r2.xxxy, r0.zzzw  // r0.z <- currentScreen.x; r0.w <- currentScreen.y
-
-#line 43
-div r1.xy, r1.xyxx, r0.xxxx
-mul r1.xy, r2.xyxx, r1.xyxx  // r1.x <- previousScreen.x; r1.y <- previousScreen.y
-
-#line 44
-div r0.xy, r4.xyxx, r0.yyyy
-mul r0.xy, r2.xyxx, r0.xyxx  // r0.x <- nextScreen.x; r0.y <- nextScreen.y
-
-#line 48
-mov r1.z, cb3[0].x  // r1.z <- len
-
-#line 52
-eq r1.w, r0.z, r1.x
-eq r2.y, r0.w, r1.y
-and r1.w, r1.w, r2.y
-if_nz r1.w
-
-#line 53
-  mov r2.yz, -r0.zzwz
-  add r2.yz, r0.xxyx, r2.yyzy
-  dp2 r1.w, r2.yzyy, r2.yzyy
-  rsq r1.w, r1.w
-  mul r2.yz, r1.wwww, r2.zzyz  // r2.y <- dir.y; r2.z <- dir.x
-
-#line 54
-else 
-  eq r1.w, r0.x, r0.z
-  eq r2.w, r0.y, r0.w
-  and r1.w, r1.w, r2.w
-  if_nz r1.w
-
-#line 55
-    mov r4.xy, -r1.xyxx
-    add r4.xy, r0.zwzz, r4.xyxx
-    dp2 r1.w, r4.xyxx, r4.xyxx
-    rsq r1.w, r1.w
-    mul r2.yz, r1.wwww, r4.yyxy  // r2.y <- dir.y; r2.z <- dir.x
-
-#line 56
-  else   // Prior locations: r4.x <- nextProjected.x; r4.y <- nextProjected.y
-
-#line 59
-    mov r1.xy, -r1.xyxx
-    add r1.xy, r0.zwzz, r1.xyxx
-    dp2 r1.w, r1.xyxx, r1.xyxx
-    rsq r1.w, r1.w
-    mul r2.yz, r1.wwww, r1.yyxy  // r2.y <- dirA.y; r2.z <- dirA.x
-
-#line 60
-    ieq r1.x, cb3[0].y, l(1)
-    if_nz r1.x
-
-#line 61
-      mov r0.zw, -r0.zzzw
-      add r0.xy, r0.zwzz, r0.xyxx
-      dp2 r0.z, r0.xyxx, r0.xyxx
-      rsq r0.z, r0.z
-      mul r0.xy, r0.zzzz, r0.xyxx  // r0.x <- dirB.x; r0.y <- dirB.y
-
-#line 63
-      add r0.xy, r0.xyxx, r2.zyzz
-      dp2 r0.z, r0.xyxx, r0.xyxx
-      rsq r0.z, r0.z
-      mul r0.xy, r0.zzzz, r0.xyxx  // r0.x <- tangent.x; r0.y <- tangent.y
-
-#line 64
-      mov r1.x, -r2.y  // r1.x <- perp.x
-      mov r1.y, r2.z  // r1.y <- perp.y
-
-#line 65
-      mov r4.x, -r0.y  // r4.x <- miter.x
-      mov r4.y, r0.x  // r4.y <- miter.y
-
-#line 66
-      mov r2.yz, r0.yyxy  // r2.y <- dir.y; r2.z <- dir.x
-
-#line 67
-      dp2 r0.x, r4.xyxx, r1.xyxx
-      div r1.z, cb3[0].x, r0.x
-
-#line 68
-    else   // Prior locations: r4.x <- nextProjected.x; r4.y <- nextProjected.y; r0.z <- currentScreen.x; r0.w <- currentScreen.y; r0.x <- nextScreen.x; r0.y <- nextScreen.y; r2.y <- dirA.y; r2.z <- dirA.x
-
-#line 69
-      mov r2.yz, r2.yyzy  // r2.y <- dir.y; r2.z <- dir.x
-
-#line 70
-    endif 
-
-#line 71
-  endif 
-endif 
-
-#line 73
-mov r2.y, -r2.y
-dp2 r0.x, r2.yzyy, r2.yzyy
-rsq r0.x, r0.x
-mul r0.xy, r0.xxxx, r2.yzyy  // r0.x <- normal.x; r0.y <- normal.y
-
-#line 74
-mul r0.z, r1.z, l(0.500000)
-mul r0.yz, r0.zzzz, r0.xxyx  // r0.y <- normal.x; r0.z <- normal.y
-
-#line 75
-div r0.x, r0.y, r2.x  // r0.x <- normal.x
-
-#line 77
-mov r0.y, v3.x  // r0.y <- orientation
-
-#line 78
-mul r0.xy, r0.yyyy, r0.xzxx  // r0.x <- offset.x; r0.y <- offset.y
-
-#line 79
-mov r0.zw, l(0,0,0,0)
-add r0.xyzw, r0.xyzw, r3.xyzw  // r0.x <- OUT.position.x; r0.y <- OUT.position.y; r0.z <- OUT.position.z; r0.w <- OUT.position.w
-
-#line 80
-mov r1.xyzw, l(0.900000,0.900000,0.900000,1.000000)  // r1.x <- OUT.color.x; r1.y <- OUT.color.y; r1.z <- OUT.color.z; r1.w <- OUT.color.w
-
-#line 82
-mov o0.xyzw, r1.xyzw
-mov o1.xyzw, r0.xyzw
-ret 
-// Approximately 89 instruction slots used
-#endif
-
-const BYTE g_LineVertexShader[] =
-{
-     68,  88,  66,  67,  66,  42, 
-     25,   4, 159, 188, 164,  46, 
-     20, 238, 131,  64, 229, 174, 
-      7, 107,   1,   0,   0,   0, 
-      4, 108,   0,   0,   6,   0, 
-      0,   0,  56,   0,   0,   0, 
-    160,   3,   0,   0,  36,   4, 
-      0,   0, 120,   4,   0,   0, 
-     96,  13,   0,   0, 252,  13, 
-      0,   0,  82,  68,  69,  70, 
-     96,   3,   0,   0,   3,   0, 
-      0,   0, 192,   0,   0,   0, 
-      3,   0,   0,   0,  60,   0, 
-      0,   0,   0,   5, 254, 255, 
-      5,   1,   0,   0,  56,   3, 
-      0,   0,  82,  68,  49,  49, 
-     60,   0,   0,   0,  24,   0, 
-      0,   0,  32,   0,   0,   0, 
-     40,   0,   0,   0,  36,   0, 
-      0,   0,  12,   0,   0,   0, 
-      0,   0,   0,   0, 156,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   1,   0, 
-      0,   0,   1,   0,   0,   0, 
-    171,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   2,   0,   0,   0, 
-      1,   0,   0,   0,   1,   0, 
-      0,   0, 181,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   3,   0, 
-      0,   0,   1,   0,   0,   0, 
-      1,   0,   0,   0,  80, 101, 
-    114,  65, 112, 112, 108, 105, 
-     99,  97, 116, 105, 111, 110, 
-      0,  80, 101, 114,  79,  98, 
-    106, 101,  99, 116,   0,  83, 
-    104,  97, 100, 101, 114,  68, 
-     97, 116,  97,   0, 156,   0, 
-      0,   0,   2,   0,   0,   0, 
-      8,   1,   0,   0,  80,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0, 171,   0, 
-      0,   0,   3,   0,   0,   0, 
-    208,   1,   0,   0, 192,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0, 181,   0, 
-      0,   0,   2,   0,   0,   0, 
-    132,   2,   0,   0,  16,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,  88,   1, 
-      0,   0,   0,   0,   0,   0, 
-     64,   0,   0,   0,   0,   0, 
-      0,   0, 116,   1,   0,   0, 
-      0,   0,   0,   0, 255, 255, 
-    255, 255,   0,   0,   0,   0, 
-    255, 255, 255, 255,   0,   0, 
-      0,   0, 152,   1,   0,   0, 
-     64,   0,   0,   0,  12,   0, 
-      0,   0,   2,   0,   0,   0, 
-    172,   1,   0,   0,   0,   0, 
-      0,   0, 255, 255, 255, 255, 
-      0,   0,   0,   0, 255, 255, 
-    255, 255,   0,   0,   0,   0, 
-    112, 114, 111, 106, 101,  99, 
-    116, 105, 111, 110,  77,  97, 
-    116, 114, 105, 120,   0, 102, 
-    108, 111,  97, 116,  52, 120, 
-     52,   0, 171, 171,   3,   0, 
-      3,   0,   4,   0,   4,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-    105,   1,   0,   0,  99, 108, 
-    105, 101, 110, 116,  68,  97, 
-    116,  97,   0, 102, 108, 111, 
-     97, 116,  51,   0, 171, 171, 
-      1,   0,   3,   0,   1,   0, 
-      3,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0, 163,   1,   0,   0, 
-     72,   2,   0,   0,   0,   0, 
-      0,   0,  64,   0,   0,   0, 
-      0,   0,   0,   0, 116,   1, 
-      0,   0,   0,   0,   0,   0, 
-    255, 255, 255, 255,   0,   0, 
-      0,   0, 255, 255, 255, 255, 
-      0,   0,   0,   0,  84,   2, 
-      0,   0,  64,   0,   0,   0, 
-     64,   0,   0,   0,   0,   0, 
-      0,   0, 116,   1,   0,   0, 
-      0,   0,   0,   0, 255, 255, 
-    255, 255,   0,   0,   0,   0, 
-    255, 255, 255, 255,   0,   0, 
-      0,   0, 105,   2,   0,   0, 
-    128,   0,   0,   0,  64,   0, 
-      0,   0,   2,   0,   0,   0, 
-    116,   1,   0,   0,   0,   0, 
-      0,   0, 255, 255, 255, 255, 
-      0,   0,   0,   0, 255, 255, 
-    255, 255,   0,   0,   0,   0, 
-    109, 111, 100, 101, 108,  77, 
-     97, 116, 114, 105, 120,   0, 
-    118, 105, 101, 119,  80, 114, 
-    111, 106, 101,  99, 116, 105, 
-    111, 110,  77,  97, 116, 114, 
-    105, 120,   0, 109, 111, 100, 
-    101, 108,  86, 105, 101, 119, 
-     80, 114, 111, 106, 101,  99, 
-    116, 105, 111, 110,  77,  97, 
-    116, 114, 105, 120,   0, 171, 
-    212,   2,   0,   0,   0,   0, 
-      0,   0,   4,   0,   0,   0, 
-      2,   0,   0,   0, 228,   2, 
-      0,   0,   0,   0,   0,   0, 
-    255, 255, 255, 255,   0,   0, 
-      0,   0, 255, 255, 255, 255, 
-      0,   0,   0,   0,   8,   3, 
-      0,   0,   4,   0,   0,   0, 
-      4,   0,   0,   0,   2,   0, 
-      0,   0,  20,   3,   0,   0, 
-      0,   0,   0,   0, 255, 255, 
-    255, 255,   0,   0,   0,   0, 
-    255, 255, 255, 255,   0,   0, 
-      0,   0, 116, 104, 105,  99, 
-    107, 110, 101, 115, 115,   0, 
-    102, 108, 111,  97, 116,   0, 
-      0,   0,   3,   0,   1,   0, 
-      1,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0, 222,   2,   0,   0, 
-    109, 105, 116, 101, 114,   0, 
-    105, 110, 116,   0, 171, 171, 
-      0,   0,   2,   0,   1,   0, 
-      1,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,  14,   3,   0,   0, 
-     77, 105,  99, 114, 111, 115, 
-    111, 102, 116,  32,  40,  82, 
-     41,  32,  72,  76,  83,  76, 
-     32,  83, 104,  97, 100, 101, 
-    114,  32,  67, 111, 109, 112, 
-    105, 108, 101, 114,  32,  49, 
-     48,  46,  49,   0,  73,  83, 
-     71,  78, 124,   0,   0,   0, 
-      4,   0,   0,   0,   8,   0, 
-      0,   0, 104,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   3,   0,   0,   0, 
-      0,   0,   0,   0,   7,   7, 
-      0,   0, 104,   0,   0,   0, 
-      2,   0,   0,   0,   0,   0, 
-      0,   0,   3,   0,   0,   0, 
-      1,   0,   0,   0,   7,   7, 
-      0,   0, 104,   0,   0,   0, 
-      3,   0,   0,   0,   0,   0, 
-      0,   0,   3,   0,   0,   0, 
-      2,   0,   0,   0,   7,   7, 
-      0,   0, 113,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   3,   0,   0,   0, 
-      3,   0,   0,   0,   7,   1, 
-      0,   0,  80,  79,  83,  73, 
-     84,  73,  79,  78,   0,  68, 
-     73,  82,  69,  67,  84,  73, 
-     79,  78,   0, 171,  79,  83, 
-     71,  78,  76,   0,   0,   0, 
-      2,   0,   0,   0,   8,   0, 
-      0,   0,  56,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   3,   0,   0,   0, 
-      0,   0,   0,   0,  15,   0, 
-      0,   0,  62,   0,   0,   0, 
-      0,   0,   0,   0,   1,   0, 
-      0,   0,   3,   0,   0,   0, 
-      1,   0,   0,   0,  15,   0, 
-      0,   0,  67,  79,  76,  79, 
-     82,   0,  83,  86,  95,  80, 
-     79,  83,  73,  84,  73,  79, 
-     78,   0, 171, 171,  83,  72, 
-     69,  88, 224,   8,   0,   0, 
-     80,   0,   1,   0,  56,   2, 
-      0,   0, 106, 136,   0,   1, 
-     89,   0,   0,   4,  70, 142, 
-     32,   0,   0,   0,   0,   0, 
-      5,   0,   0,   0,  89,   0, 
-      0,   4,  70, 142,  32,   0, 
-      2,   0,   0,   0,  12,   0, 
-      0,   0,  89,   0,   0,   4, 
-     70, 142,  32,   0,   3,   0, 
-      0,   0,   1,   0,   0,   0, 
-     95,   0,   0,   3, 114,  16, 
-     16,   0,   0,   0,   0,   0, 
-     95,   0,   0,   3, 114,  16, 
-     16,   0,   1,   0,   0,   0, 
-     95,   0,   0,   3, 114,  16, 
-     16,   0,   2,   0,   0,   0, 
-     95,   0,   0,   3,  18,  16, 
-     16,   0,   3,   0,   0,   0, 
-    101,   0,   0,   3, 242,  32, 
-     16,   0,   0,   0,   0,   0, 
-    103,   0,   0,   4, 242,  32, 
-     16,   0,   1,   0,   0,   0, 
-      1,   0,   0,   0, 104,   0, 
-      0,   2,   5,   0,   0,   0, 
-     54,   0,   0,   5, 114,   0, 
-     16,   0,   0,   0,   0,   0, 
-     70,  18,  16,   0,   1,   0, 
-      0,   0,  54,   0,   0,   5, 
-    130,   0,  16,   0,   0,   0, 
-      0,   0,   1,  64,   0,   0, 
-      0,   0, 128,  63,  17,   0, 
-      0,   8,  18,   0,  16,   0, 
-      1,   0,   0,   0,  70,  14, 
-     16,   0,   0,   0,   0,   0, 
-     70, 142,  32,   0,   2,   0, 
-      0,   0,   8,   0,   0,   0, 
-     17,   0,   0,   8,  34,   0, 
-     16,   0,   1,   0,   0,   0, 
-     70,  14,  16,   0,   0,   0, 
-      0,   0,  70, 142,  32,   0, 
-      2,   0,   0,   0,   9,   0, 
-      0,   0,  17,   0,   0,   8, 
-     18,   0,  16,   0,   0,   0, 
-      0,   0,  70,  14,  16,   0, 
-      0,   0,   0,   0,  70, 142, 
-     32,   0,   2,   0,   0,   0, 
-     11,   0,   0,   0,  54,   0, 
-      0,   5, 114,   0,  16,   0, 
-      2,   0,   0,   0,  70,  18, 
-     16,   0,   0,   0,   0,   0, 
-     54,   0,   0,   5, 130,   0, 
-     16,   0,   2,   0,   0,   0, 
-      1,  64,   0,   0,   0,   0, 
-    128,  63,  17,   0,   0,   8, 
-     18,   0,  16,   0,   3,   0, 
-      0,   0,  70,  14,  16,   0, 
-      2,   0,   0,   0,  70, 142, 
-     32,   0,   2,   0,   0,   0, 
-      8,   0,   0,   0,  17,   0, 
-      0,   8,  34,   0,  16,   0, 
-      3,   0,   0,   0,  70,  14, 
-     16,   0,   2,   0,   0,   0, 
-     70, 142,  32,   0,   2,   0, 
-      0,   0,   9,   0,   0,   0, 
-     17,   0,   0,   8,  66,   0, 
-     16,   0,   3,   0,   0,   0, 
-     70,  14,  16,   0,   2,   0, 
-      0,   0,  70, 142,  32,   0, 
-      2,   0,   0,   0,  10,   0, 
-      0,   0,  17,   0,   0,   8, 
-    130,   0,  16,   0,   3,   0, 
-      0,   0,  70,  14,  16,   0, 
-      2,   0,   0,   0,  70, 142, 
-     32,   0,   2,   0,   0,   0, 
-     11,   0,   0,   0,  54,   0, 
-      0,   5, 114,   0,  16,   0, 
-      2,   0,   0,   0,  70,  18, 
-     16,   0,   2,   0,   0,   0, 
-     54,   0,   0,   5, 130,   0, 
-     16,   0,   2,   0,   0,   0, 
-      1,  64,   0,   0,   0,   0, 
-    128,  63,  17,   0,   0,   8, 
-     18,   0,  16,   0,   4,   0, 
-      0,   0,  70,  14,  16,   0, 
-      2,   0,   0,   0,  70, 142, 
-     32,   0,   2,   0,   0,   0, 
-      8,   0,   0,   0,  17,   0, 
-      0,   8,  34,   0,  16,   0, 
-      4,   0,   0,   0,  70,  14, 
-     16,   0,   2,   0,   0,   0, 
-     70, 142,  32,   0,   2,   0, 
-      0,   0,   9,   0,   0,   0, 
-     17,   0,   0,   8,  34,   0, 
-     16,   0,   0,   0,   0,   0, 
-     70,  14,  16,   0,   2,   0, 
-      0,   0,  70, 142,  32,   0, 
-      2,   0,   0,   0,  11,   0, 
-      0,   0,  54,   0,   0,   6, 
-     18,   0,  16,   0,   2,   0, 
-      0,   0,  42, 128,  32,   0, 
-      0,   0,   0,   0,   4,   0, 
-      0,   0,  54,   0,   0,   5, 
-     18,   0,  16,   0,   2,   0, 
-      0,   0,  10,   0,  16,   0, 
-      2,   0,   0,   0,  54,   0, 
-      0,   5,  34,   0,  16,   0, 
-      2,   0,   0,   0,   1,  64, 
-      0,   0,   0,   0, 128,  63, 
-     14,   0,   0,   7, 194,   0, 
-     16,   0,   0,   0,   0,   0, 
-      6,   4,  16,   0,   3,   0, 
-      0,   0, 246,  15,  16,   0, 
-      3,   0,   0,   0,  56,   0, 
-      0,   7, 194,   0,  16,   0, 
-      0,   0,   0,   0,   6,   4, 
-     16,   0,   2,   0,   0,   0, 
-    166,  14,  16,   0,   0,   0, 
-      0,   0,  14,   0,   0,   7, 
-     50,   0,  16,   0,   1,   0, 
-      0,   0,  70,   0,  16,   0, 
-      1,   0,   0,   0,   6,   0, 
-     16,   0,   0,   0,   0,   0, 
-     56,   0,   0,   7,  50,   0, 
-     16,   0,   1,   0,   0,   0, 
-     70,   0,  16,   0,   2,   0, 
-      0,   0,  70,   0,  16,   0, 
-      1,   0,   0,   0,  14,   0, 
-      0,   7,  50,   0,  16,   0, 
-      0,   0,   0,   0,  70,   0, 
-     16,   0,   4,   0,   0,   0, 
-     86,   5,  16,   0,   0,   0, 
-      0,   0,  56,   0,   0,   7, 
-     50,   0,  16,   0,   0,   0, 
-      0,   0,  70,   0,  16,   0, 
-      2,   0,   0,   0,  70,   0, 
-     16,   0,   0,   0,   0,   0, 
-     54,   0,   0,   6,  66,   0, 
-     16,   0,   1,   0,   0,   0, 
-     10, 128,  32,   0,   3,   0, 
-      0,   0,   0,   0,   0,   0, 
-     24,   0,   0,   7, 130,   0, 
-     16,   0,   1,   0,   0,   0, 
-     42,   0,  16,   0,   0,   0, 
-      0,   0,  10,   0,  16,   0, 
-      1,   0,   0,   0,  24,   0, 
-      0,   7,  34,   0,  16,   0, 
-      2,   0,   0,   0,  58,   0, 
-     16,   0,   0,   0,   0,   0, 
-     26,   0,  16,   0,   1,   0, 
-      0,   0,   1,   0,   0,   7, 
-    130,   0,  16,   0,   1,   0, 
-      0,   0,  58,   0,  16,   0, 
-      1,   0,   0,   0,  26,   0, 
-     16,   0,   2,   0,   0,   0, 
-     31,   0,   4,   3,  58,   0, 
-     16,   0,   1,   0,   0,   0, 
-     54,   0,   0,   6,  98,   0, 
-     16,   0,   2,   0,   0,   0, 
-    166,  11,  16, 128,  65,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   7,  98,   0, 
-     16,   0,   2,   0,   0,   0, 
-      6,   1,  16,   0,   0,   0, 
-      0,   0,  86,   6,  16,   0, 
-      2,   0,   0,   0,  15,   0, 
-      0,   7, 130,   0,  16,   0, 
-      1,   0,   0,   0, 150,   5, 
-     16,   0,   2,   0,   0,   0, 
-    150,   5,  16,   0,   2,   0, 
-      0,   0,  68,   0,   0,   5, 
-    130,   0,  16,   0,   1,   0, 
-      0,   0,  58,   0,  16,   0, 
-      1,   0,   0,   0,  56,   0, 
-      0,   7,  98,   0,  16,   0, 
-      2,   0,   0,   0, 246,  15, 
-     16,   0,   1,   0,   0,   0, 
-    166,   9,  16,   0,   2,   0, 
-      0,   0,  18,   0,   0,   1, 
-     24,   0,   0,   7, 130,   0, 
-     16,   0,   1,   0,   0,   0, 
-     10,   0,  16,   0,   0,   0, 
-      0,   0,  42,   0,  16,   0, 
-      0,   0,   0,   0,  24,   0, 
-      0,   7, 130,   0,  16,   0, 
-      2,   0,   0,   0,  26,   0, 
-     16,   0,   0,   0,   0,   0, 
-     58,   0,  16,   0,   0,   0, 
-      0,   0,   1,   0,   0,   7, 
-    130,   0,  16,   0,   1,   0, 
-      0,   0,  58,   0,  16,   0, 
-      1,   0,   0,   0,  58,   0, 
-     16,   0,   2,   0,   0,   0, 
-     31,   0,   4,   3,  58,   0, 
-     16,   0,   1,   0,   0,   0, 
-     54,   0,   0,   6,  50,   0, 
-     16,   0,   4,   0,   0,   0, 
-     70,   0,  16, 128,  65,   0, 
-      0,   0,   1,   0,   0,   0, 
-      0,   0,   0,   7,  50,   0, 
-     16,   0,   4,   0,   0,   0, 
-    230,  10,  16,   0,   0,   0, 
-      0,   0,  70,   0,  16,   0, 
-      4,   0,   0,   0,  15,   0, 
-      0,   7, 130,   0,  16,   0, 
-      1,   0,   0,   0,  70,   0, 
-     16,   0,   4,   0,   0,   0, 
-     70,   0,  16,   0,   4,   0, 
-      0,   0,  68,   0,   0,   5, 
-    130,   0,  16,   0,   1,   0, 
-      0,   0,  58,   0,  16,   0, 
-      1,   0,   0,   0,  56,   0, 
-      0,   7,  98,   0,  16,   0, 
-      2,   0,   0,   0, 246,  15, 
-     16,   0,   1,   0,   0,   0, 
-     86,   4,  16,   0,   4,   0, 
-      0,   0,  18,   0,   0,   1, 
-     54,   0,   0,   6,  50,   0, 
-     16,   0,   1,   0,   0,   0, 
-     70,   0,  16, 128,  65,   0, 
-      0,   0,   1,   0,   0,   0, 
-      0,   0,   0,   7,  50,   0, 
-     16,   0,   1,   0,   0,   0, 
-    230,  10,  16,   0,   0,   0, 
-      0,   0,  70,   0,  16,   0, 
-      1,   0,   0,   0,  15,   0, 
-      0,   7, 130,   0,  16,   0, 
-      1,   0,   0,   0,  70,   0, 
-     16,   0,   1,   0,   0,   0, 
-     70,   0,  16,   0,   1,   0, 
-      0,   0,  68,   0,   0,   5, 
-    130,   0,  16,   0,   1,   0, 
-      0,   0,  58,   0,  16,   0, 
-      1,   0,   0,   0,  56,   0, 
-      0,   7,  98,   0,  16,   0, 
-      2,   0,   0,   0, 246,  15, 
-     16,   0,   1,   0,   0,   0, 
-     86,   4,  16,   0,   1,   0, 
-      0,   0,  32,   0,   0,   8, 
-     18,   0,  16,   0,   1,   0, 
-      0,   0,  26, 128,  32,   0, 
-      3,   0,   0,   0,   0,   0, 
-      0,   0,   1,  64,   0,   0, 
-      1,   0,   0,   0,  31,   0, 
-      4,   3,  10,   0,  16,   0, 
-      1,   0,   0,   0,  54,   0, 
-      0,   6, 194,   0,  16,   0, 
-      0,   0,   0,   0, 166,  14, 
-     16, 128,  65,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   7,  50,   0,  16,   0, 
-      0,   0,   0,   0, 230,  10, 
-     16,   0,   0,   0,   0,   0, 
-     70,   0,  16,   0,   0,   0, 
-      0,   0,  15,   0,   0,   7, 
-     66,   0,  16,   0,   0,   0, 
-      0,   0,  70,   0,  16,   0, 
-      0,   0,   0,   0,  70,   0, 
-     16,   0,   0,   0,   0,   0, 
-     68,   0,   0,   5,  66,   0, 
-     16,   0,   0,   0,   0,   0, 
-     42,   0,  16,   0,   0,   0, 
-      0,   0,  56,   0,   0,   7, 
-     50,   0,  16,   0,   0,   0, 
-      0,   0, 166,  10,  16,   0, 
-      0,   0,   0,   0,  70,   0, 
-     16,   0,   0,   0,   0,   0, 
-      0,   0,   0,   7,  50,   0, 
-     16,   0,   0,   0,   0,   0, 
-     70,   0,  16,   0,   0,   0, 
-      0,   0, 102,  10,  16,   0, 
-      2,   0,   0,   0,  15,   0, 
-      0,   7,  66,   0,  16,   0, 
-      0,   0,   0,   0,  70,   0, 
-     16,   0,   0,   0,   0,   0, 
-     70,   0,  16,   0,   0,   0, 
-      0,   0,  68,   0,   0,   5, 
-     66,   0,  16,   0,   0,   0, 
-      0,   0,  42,   0,  16,   0, 
-      0,   0,   0,   0,  56,   0, 
-      0,   7,  50,   0,  16,   0, 
-      0,   0,   0,   0, 166,  10, 
-     16,   0,   0,   0,   0,   0, 
-     70,   0,  16,   0,   0,   0, 
-      0,   0,  54,   0,   0,   6, 
-     18,   0,  16,   0,   1,   0, 
-      0,   0,  26,   0,  16, 128, 
-     65,   0,   0,   0,   2,   0, 
-      0,   0,  54,   0,   0,   5, 
-     34,   0,  16,   0,   1,   0, 
-      0,   0,  42,   0,  16,   0, 
-      2,   0,   0,   0,  54,   0, 
-      0,   6,  18,   0,  16,   0, 
-      4,   0,   0,   0,  26,   0, 
-     16, 128,  65,   0,   0,   0, 
-      0,   0,   0,   0,  54,   0, 
-      0,   5,  34,   0,  16,   0, 
-      4,   0,   0,   0,  10,   0, 
-     16,   0,   0,   0,   0,   0, 
-     54,   0,   0,   5,  98,   0, 
-     16,   0,   2,   0,   0,   0, 
-     86,   4,  16,   0,   0,   0, 
-      0,   0,  15,   0,   0,   7, 
-     18,   0,  16,   0,   0,   0, 
-      0,   0,  70,   0,  16,   0, 
-      4,   0,   0,   0,  70,   0, 
-     16,   0,   1,   0,   0,   0, 
-     14,   0,   0,   8,  66,   0, 
-     16,   0,   1,   0,   0,   0, 
-     10, 128,  32,   0,   3,   0, 
-      0,   0,   0,   0,   0,   0, 
-     10,   0,  16,   0,   0,   0, 
-      0,   0,  18,   0,   0,   1, 
-     54,   0,   0,   5,  98,   0, 
-     16,   0,   2,   0,   0,   0, 
-     86,   6,  16,   0,   2,   0, 
-      0,   0,  21,   0,   0,   1, 
-     21,   0,   0,   1,  21,   0, 
-      0,   1,  54,   0,   0,   6, 
-     34,   0,  16,   0,   2,   0, 
-      0,   0,  26,   0,  16, 128, 
-     65,   0,   0,   0,   2,   0, 
-      0,   0,  15,   0,   0,   7, 
-     18,   0,  16,   0,   0,   0, 
-      0,   0, 150,   5,  16,   0, 
-      2,   0,   0,   0, 150,   5, 
-     16,   0,   2,   0,   0,   0, 
-     68,   0,   0,   5,  18,   0, 
-     16,   0,   0,   0,   0,   0, 
-     10,   0,  16,   0,   0,   0, 
-      0,   0,  56,   0,   0,   7, 
-     50,   0,  16,   0,   0,   0, 
-      0,   0,   6,   0,  16,   0, 
-      0,   0,   0,   0, 150,   5, 
-     16,   0,   2,   0,   0,   0, 
-     56,   0,   0,   7,  66,   0, 
-     16,   0,   0,   0,   0,   0, 
-     42,   0,  16,   0,   1,   0, 
-      0,   0,   1,  64,   0,   0, 
-      0,   0,   0,  63,  56,   0, 
-      0,   7,  98,   0,  16,   0, 
-      0,   0,   0,   0, 166,  10, 
-     16,   0,   0,   0,   0,   0, 
-      6,   1,  16,   0,   0,   0, 
-      0,   0,  14,   0,   0,   7, 
-     18,   0,  16,   0,   0,   0, 
-      0,   0,  26,   0,  16,   0, 
-      0,   0,   0,   0,  10,   0, 
-     16,   0,   2,   0,   0,   0, 
-     54,   0,   0,   5,  34,   0, 
-     16,   0,   0,   0,   0,   0, 
-     10,  16,  16,   0,   3,   0, 
-      0,   0,  56,   0,   0,   7, 
-     50,   0,  16,   0,   0,   0, 
-      0,   0,  86,   5,  16,   0, 
-      0,   0,   0,   0, 134,   0, 
-     16,   0,   0,   0,   0,   0, 
-     54,   0,   0,   8, 194,   0, 
-     16,   0,   0,   0,   0,   0, 
-      2,  64,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   7, 
-    242,   0,  16,   0,   0,   0, 
-      0,   0,  70,  14,  16,   0, 
-      0,   0,   0,   0,  70,  14, 
-     16,   0,   3,   0,   0,   0, 
-     54,   0,   0,   8, 242,   0, 
-     16,   0,   1,   0,   0,   0, 
-      2,  64,   0,   0, 102, 102, 
-    102,  63, 102, 102, 102,  63, 
-    102, 102, 102,  63,   0,   0, 
-    128,  63,  54,   0,   0,   5, 
-    242,  32,  16,   0,   0,   0, 
-      0,   0,  70,  14,  16,   0, 
-      1,   0,   0,   0,  54,   0, 
-      0,   5, 242,  32,  16,   0, 
-      1,   0,   0,   0,  70,  14, 
-     16,   0,   0,   0,   0,   0, 
-     62,   0,   0,   1,  83,  84, 
-     65,  84, 148,   0,   0,   0, 
-     89,   0,   0,   0,   5,   0, 
-      0,   0,   0,   0,   0,   0, 
-      6,   0,   0,   0,  57,   0, 
-      0,   0,   1,   0,   0,   0, 
-      2,   0,   0,   0,   4,   0, 
-      0,   0,   3,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,  19,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,  83,  80, 
-     68,  66,   0,  94,   0,   0, 
-     77, 105,  99, 114, 111, 115, 
-    111, 102, 116,  32,  67,  47, 
-     67,  43,  43,  32,  77,  83, 
-     70,  32,  55,  46,  48,  48, 
-     13,  10,  26,  68,  83,   0, 
-      0,   0,   0,   2,   0,   0, 
-      2,   0,   0,   0,  47,   0, 
-      0,   0, 228,   0,   0,   0, 
-      0,   0,   0,   0,  45,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0, 192, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255,  56,   0, 
-      0,   0,   0, 192, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-      5,   0,   0,   0,  32,   0, 
-      0,   0,  60,   0,   0,   0, 
-      0,   0,   0,   0, 255, 255, 
-    255, 255,   0,   0,   0,   0, 
-      6,   0,   0,   0,   5,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   3,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0, 148,  46, 
-     49,   1,  40, 162, 146,  97, 
-      1,   0,   0,   0, 173, 122, 
-     85, 243, 196,  11, 159,  68, 
-    151,  52, 141,  53, 107,   9, 
-     52, 182,   0,   0,   0,   0, 
-      0,   0,   0,   0,   1,   0, 
-      0,   0,   1,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-    220,  81,  51,   1,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-     32, 102, 108, 111,  97, 116, 
-     51,  32, 100, 105, 114, 101, 
-     99, 116, 105, 111, 110,  32, 
-     58,  32,  68,  73,  82,  69, 
-     67,  84,  73,  79,  78,  59, 
-     13,  10, 125,  59,  13,  10, 
-     13,  10, 115, 116, 114, 117, 
-     99, 116,  32,  86, 101, 114, 
-    116, 101, 120,  83, 104,  97, 
-    100, 101, 114,  79, 117, 116, 
-    112, 117, 116,  13,  10, 123, 
-     13,  10,   9, 102, 108, 111, 
-     97, 116,  52,  32,  99, 111, 
-    108, 111, 114,  32,  58,  32, 
-     67,  79,  76,  79,  82,  59, 
-     13,  10,   9, 102, 108, 111, 
-     97, 116,  52,  32, 112, 111, 
-    115, 105, 116, 105, 111, 110, 
-     32,  58,  32,  83,  86,  95, 
-     80,  79,  83,  73,  84,  73, 
-     79,  78,  59,  13,  10, 125, 
-     59,  13,  10,  13,  10,  86, 
-    101, 114, 116, 101, 120,  83, 
-    104,  97, 100, 101, 114,  79, 
-    117, 116, 112, 117, 116,  32, 
-     76, 105, 110, 101,  86, 101, 
-    114, 116, 101, 120,  83, 104, 
-     97, 100, 101, 114,  40,  86, 
-    101, 114, 116, 101, 120,  68, 
-     97, 116,  97,  32,  73,  78, 
-     41,  13,  10, 123,  13,  10, 
-     32,  32,  32,  32,  86, 101, 
-    114, 116, 101, 120,  83, 104, 
-     97, 100, 101, 114,  79, 117, 
-    116, 112, 117, 116,  32,  79, 
-     85,  84,  59,  13,  10,  13, 
-     10,  32,  32,  32,  32,  47, 
-     47, 102, 108, 111,  97, 116, 
-     51,  32, 112, 114, 101, 118, 
-    105, 111, 117, 115,  87, 111, 
-    114, 108, 100,  32,  61,  32, 
-    109, 117, 108,  40, 102, 108, 
-    111,  97, 116,  52,  40,  73, 
-     78,  46, 112, 114, 101, 118, 
-    105, 111, 117, 115,  44,  32, 
-     49,  46,  48, 102,  41,  44, 
-     32, 109, 111, 100, 101, 108, 
-     77,  97, 116, 114, 105, 120, 
-     41,  59,  13,  10,  32,  32, 
-     32,  32,  47,  47, 102, 108, 
-    111,  97, 116,  51,  32,  99, 
-    117, 114, 114, 101, 110, 116, 
-     87, 111, 114, 108, 100,  32, 
-     61,  32, 109, 117, 108,  40, 
-    102, 108, 111,  97, 116,  52, 
-     40,  73,  78,  46, 112, 111, 
-    115, 105, 116, 105, 111, 110, 
-     44,  32,  49,  46,  48, 102, 
-     41,  44,  32, 109, 111, 100, 
-    101, 108,  77,  97, 116, 114, 
-    105, 120,  41,  59,  13,  10, 
-     32,  32,  32,  32,  47,  47, 
-    102, 108, 111,  97, 116,  51, 
-     32, 110, 101, 120, 116,  87, 
-    111, 114, 108, 100,  32,  61, 
-     32, 109, 117, 108,  40, 102, 
-    108, 111,  97, 116,  52,  40, 
-     73,  78,  46, 110, 101, 120, 
-    116,  44,  32,  49,  46,  48, 
-    102,  41,  44,  32, 109, 111, 
-    100, 101, 108,  77,  97, 116, 
-    114, 105, 120,  41,  59,  13, 
-     10,  13,  10,  32,  32,  32, 
-     32,  47,  47, 102, 108, 111, 
-     97, 116,  52,  32, 112, 114, 
-    101, 118, 105, 111, 117, 115, 
-     80, 114, 111, 106, 101,  99, 
-    116, 101, 100,  32,  61,  32, 
-    109, 117, 108,  40, 102, 108, 
-    111,  97, 116,  52,  40, 112, 
-    114, 101, 118, 105, 111, 117, 
-    115,  87, 111, 114, 108, 100, 
-     44,  32,  49,  46,  48,  41, 
-     44,  32, 118, 105, 101, 119, 
-     80, 114, 111, 106, 101,  99, 
-    116, 105,  76, 232,   3,   0, 
-     78, 161,   1,   0, 228, 252, 
-      0,   0,  30, 194,   2,   0, 
-    198,  90,   0,   0, 116,  39, 
-      2,   0, 221, 143,   3,   0, 
-     49, 251,   3,   0, 138, 183, 
-      3,   0, 146, 230,   3,   0, 
-    117, 131,   1,   0,  73,  20, 
-      1,   0,  65,  36,   1,   0, 
-     65, 185,   2,   0, 103, 159, 
-      1,   0, 149,  49,   3,   0, 
-    125, 218,   1,   0, 125, 181, 
-      2,   0, 118,  19,   1,   0, 
-    140, 144,   3,   0,   0,  16, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,  35, 105, 
-    110,  99, 108, 117, 100, 101, 
-     32,  34,  67, 111, 109, 109, 
-    111, 110,  67, 111, 110, 115, 
-    116,  97, 110, 116,  66, 117, 
-    102, 102, 101, 114, 115,  46, 
-    104, 108, 115, 108,  34,  13, 
-     10,  13,  10,  99,  98, 117, 
-    102, 102, 101, 114,  32,  83, 
-    104,  97, 100, 101, 114,  68, 
-     97, 116,  97,  32,  58,  32, 
-    114, 101, 103, 105, 115, 116, 
-    101, 114,  40,  98,  51,  41, 
-     13,  10, 123,  13,  10,  32, 
-     32,  32,  32, 102, 108, 111, 
-     97, 116,  32, 116, 104, 105, 
-     99, 107, 110, 101, 115, 115, 
-     59,  13,  10,  32,  32,  32, 
-     32, 105, 110, 116,  32, 109, 
-    105, 116, 101, 114,  59,  13, 
-     10, 125,  13,  10,  13,  10, 
-    115, 116, 114, 117,  99, 116, 
-     32,  86, 101, 114, 116, 101, 
-    120,  68,  97, 116,  97,  13, 
-     10, 123,  13,  10,  32,  32, 
-     32,  32, 102, 108, 111,  97, 
-    116,  51,  32, 112, 111, 115, 
-    105, 116, 105, 111, 110,  32, 
-     58,  32,  80,  79,  83,  73, 
-     84,  73,  79,  78,  59,  13, 
-     10,  32,  32,  32,  32, 102, 
-    108, 111,  97, 116,  51,  32, 
-    112, 114, 101, 118, 105, 111, 
-    117, 115,  32,  58,  32,  80, 
-     79,  83,  73,  84,  73,  79, 
-     78,  50,  59,  13,  10,  32, 
-     32,  32,  32, 102, 108, 111, 
-     97, 116,  51,  32, 110, 101, 
-    120, 116,  32,  58,  32,  80, 
-     79,  83,  73,  84,  73,  79, 
-     78,  51,  59,  13,  10,  32, 
-     32,  32,  32, 102, 108, 111, 
-     97, 116,  51,  32, 100, 105, 
-    114, 101,  99, 116, 105, 111, 
-    110,  32,  58,  32,  68,  73, 
-     82,  69,  67,  84,  73,  79, 
-     78,  59,  13,  10, 125,  59, 
-     13,  10,  13,  10, 115, 116, 
-    114, 117,  99, 116,  32,  86, 
-    101, 114, 116, 101, 120,  83, 
-    104,  97, 100, 101, 114,  79, 
-    117, 116, 112, 117, 116,  13, 
-     10, 123,  13,  10,   9, 102, 
-    108, 111,  97, 116,  52,  32, 
-     99, 111, 108, 111, 114,  32, 
-     58,  32,  67,  79,  76,  79, 
-     82,  59,  13,  10,   9, 102, 
-    108, 111,  97, 116,  52,  32, 
-    112, 111, 115, 105, 116, 105, 
-    111, 110,  32,  58,  32,  83, 
-     86,  95,  80,  79,  83,  73, 
-     84,  73,  79,  78,  59,  13, 
-     10, 125,  59,  13,  10,  13, 
-     10,  86, 101, 114, 116, 101, 
-    120,  83, 104,  97, 100, 101, 
-    114,  79, 117, 116, 112, 117, 
-    116,  32,  76, 105, 110, 101, 
-     86, 101, 114, 116, 101, 120, 
-     83, 104,  97, 100, 101, 114, 
-     40,  86, 101, 114, 116, 101, 
-    120,  68,  97, 116,  97,  32, 
-     73,  78,  41,  13,  10, 123, 
-     13,  10,  32,  32,  32,  32, 
-     86, 101, 114, 116, 101, 120, 
-     83, 104,  97, 100, 101, 114, 
-     79, 117, 116, 112, 117, 116, 
-     32,  79,  85,  84,  59,  13, 
-     10,  13,  10,  32,  32,  32, 
-     32,  47,  47, 102, 108, 111, 
-     97, 116,  51,  32, 112, 114, 
-    101, 118, 105, 111, 117, 115, 
-     87, 111, 114, 108, 100,  32, 
-     61,  32, 109, 117, 108,  40, 
-    102, 108, 111,  97, 116,  52, 
-     40,  73,  78,  46, 112, 114, 
-    101, 118, 105, 111, 117, 115, 
-     44,  32,  49,  46,  48, 102, 
-     41,  44,  32, 109, 111, 100, 
-    101, 108,  77,  97, 116, 114, 
-    105, 120,  41,  59,  13,  10, 
-     32,  32,  32,  32,  47,  47, 
-    102, 108, 111,  97, 116,  51, 
-     32,  99, 117, 114, 114, 101, 
-    110, 116,  87, 111, 114, 108, 
-    100,  32,  61,  32, 109, 117, 
-    108,  40, 102, 108, 111,  97, 
-    116,  52,  40,  73,  78,  46, 
-    112, 111, 115, 105, 116, 105, 
-    111, 110,  44,  32,  49,  46, 
-     48, 102,  41,  44,  32, 109, 
-    111, 100, 101, 108,  77,  97, 
-    116, 114, 105, 120,  41,  59, 
-     13,  10,  32,  32,  32,  32, 
-     47,  47, 102, 108, 111,  97, 
-    116,  51,  32, 110, 101, 120, 
-    116,  87, 111, 114, 108, 100, 
-     32,  61,  32, 109, 117, 108, 
-     40, 102, 108, 111,  97, 116, 
-     52,  40,  73,  78,  46, 110, 
-    101, 120, 116,  44,  32,  49, 
-     46,  48, 102,  41,  44,  32, 
-    109, 111, 100, 101, 108,  77, 
-     97, 116, 114, 105, 120,  41, 
-     59,  13,  10,  13,  10,  32, 
-     32,  32,  32,  47,  47, 102, 
-    108, 111,  97, 116,  52,  32, 
-    112, 114, 101, 118, 105, 111, 
-    117, 115,  80, 114, 111, 106, 
-    101,  99, 116, 101, 100,  32, 
-     61,  32, 109, 117, 108,  40, 
-    102, 108, 111,  97, 116,  52, 
-     40, 112, 114, 101, 118, 105, 
-    111, 117, 115,  87, 111, 114, 
-    108, 100,  44,  32,  49,  46, 
-     48,  41,  44,  32, 118, 105, 
-    101, 119,  80, 114, 111, 106, 
-    101,  99, 116, 105, 111, 110, 
-     77,  97, 116, 114, 105, 120, 
-     41,  59,  13,  10,  32,  32, 
-     32,  32,  47,  47, 102, 108, 
-    111,  97, 116,  52,  32,  99, 
-    117, 114, 114, 101, 110, 116, 
-     80, 114, 111, 106, 101,  99, 
-    116, 101, 100,  32,  61,  32, 
-    109, 117, 108,  40, 102, 108, 
-    111,  97, 116,  52,  40,  99, 
-    117, 114, 114, 101, 110, 116, 
-     87, 111, 114, 108, 100,  44, 
-     32,  49,  46,  48,  41,  44, 
-     32, 118, 105, 101, 119,  80, 
-    114, 111, 106, 101,  99, 116, 
-    105, 111, 110,  77,  97, 116, 
-    114, 105, 120,  41,  59,  13, 
-     10,  32,  32,  32,  32,  47, 
-     47, 102, 108, 111,  97, 116, 
-     52,  32, 110, 101, 120, 116, 
-     80, 114, 111, 106, 101,  99, 
-    116, 101, 100,  32,  61,  32, 
-    109, 117, 108,  40, 102, 108, 
-    111,  97, 116,  52,  40, 110, 
-    101, 120, 116,  87, 111, 114, 
-    108, 100,  44,  32,  49,  46, 
-     48,  41,  44,  32, 118, 105, 
-    101, 119,  80, 114, 111, 106, 
-    101,  99, 116, 105, 111, 110, 
-     77,  97, 116, 114, 105, 120, 
-     41,  59,  13,  10,  13,  10, 
-     32,  32,  32,  32, 102, 108, 
-    111,  97, 116,  52,  32, 112, 
-    114, 101, 118, 105, 111, 117, 
-    115,  80, 114, 111, 106, 101, 
-     99, 116, 101, 100,  32,  61, 
-     32, 109, 117, 108,  40, 102, 
-    108, 111,  97, 116,  52,  40, 
-     73,  78,  46, 112, 114, 101, 
-    118, 105, 111, 117, 115,  44, 
-     32,  49,  46,  48, 102,  41, 
-     44,  32, 109, 111, 100, 101, 
-    108,  86, 105, 101, 119,  80, 
-    114, 111, 106, 101,  99, 116, 
-    105, 111, 110,  77,  97, 116, 
-    114, 105, 120,  41,  59,  13, 
-     10,  32,  32,  32,  32, 102, 
-    108, 111,  97, 116,  52,  32, 
-     99, 117, 114, 114, 101, 110, 
-    116,  80, 114, 111, 106, 101, 
-     99, 116, 101, 100,  32,  61, 
-     32, 109, 117, 108,  40, 102, 
-    108, 111,  97, 116,  52,  40, 
-     73,  78,  46, 112, 111, 115, 
-    105, 116, 105, 111, 110,  44, 
-     32,  49,  46,  48, 102,  41, 
-     44,  32, 109, 111, 100, 101, 
-    108,  86, 105, 101, 119,  80, 
-    114, 111, 106, 101,  99, 116, 
-    105, 111, 110,  77,  97, 116, 
-    114, 105, 120,  41,  59,  13, 
-     10,  32,  32,  32,  32, 102, 
-    108, 111,  97, 116,  52,  32, 
-    110, 101, 120, 116,  80, 114, 
-    111, 106, 101,  99, 116, 101, 
-    100,  32,  61,  32, 109, 117, 
-    108,  40, 102, 108, 111,  97, 
-    116,  52,  40,  73,  78,  46, 
-    110, 101, 120, 116,  44,  32, 
-     49,  46,  48, 102,  41,  44, 
-     32, 109, 111, 100, 101, 108, 
-     86, 105, 101, 119,  80, 114, 
-    111, 106, 101,  99, 116, 105, 
-    111, 110,  77,  97, 116, 114, 
-    105, 120,  41,  59,  13,  10, 
-     13,  10,  32,  32,  32,  32, 
-     99, 111, 110, 115, 116,  32, 
-    102, 108, 111,  97, 116,  32, 
-     97, 115, 112, 101,  99, 116, 
-     82,  97, 116, 105, 111,  32, 
-     61,  32,  99, 108, 105, 101, 
-    110, 116,  68,  97, 116,  97, 
-     91,  50,  93,  59,  13,  10, 
-     32,  32,  32,  32,  99, 111, 
-    110, 115, 116,  32, 102, 108, 
-    111,  97, 116,  50,  32,  97, 
-    115, 112, 101,  99, 116,  86, 
-    101,  99,  32,  61,  32, 102, 
-    108, 111,  97, 116,  50,  40, 
-     97, 115, 112, 101,  99, 116, 
-     82,  97, 116, 105, 111,  44, 
-     32,  49,  46,  48, 102,  41, 
-     59,  13,  10,  32,  32,  32, 
-     32,  47,  47, 103, 101, 116, 
-     32,  50,  68,  32, 115,  99, 
-    114, 101, 101, 110,  32, 115, 
-    112,  97,  99, 101,  32, 119, 
-    105, 116, 104,  32,  87,  32, 
-    100, 105, 118, 105, 100, 101, 
-     32,  97, 110, 100,  32,  97, 
-    115, 112, 101,  99, 116,  32, 
-     99, 111, 114, 114, 101,  99, 
-    116, 105, 111, 110,  13,  10, 
-     32,  32,  32,  32, 102, 108, 
-    111,  97, 116,  50,  32,  99, 
-    117, 114, 114, 101, 110, 116, 
-     83,  99, 114, 101, 101, 110, 
-     32,  61,  32,  40,  99, 117, 
-    114, 114, 101, 110, 116,  80, 
-    114, 111, 106, 101,  99, 116, 
-    101, 100,  46, 120, 121,  32, 
-     47,  32,  99, 117, 114, 114, 
-    101, 110, 116,  80, 114, 111, 
-    106, 101,  99, 116, 101, 100, 
-     46, 119,  41,  32,  42,  32, 
-     97, 115, 112, 101,  99, 116, 
-     86, 101,  99,  59,  13,  10, 
-     32,  32,  32,  32, 102, 108, 
-    111,  97, 116,  50,  32, 112, 
-    114, 101, 118, 105, 111, 117, 
-    115,  83,  99, 114, 101, 101, 
-    110,  32,  61,  32,  40, 112, 
-    114, 101, 118, 105, 111, 117, 
-    115,  80, 114, 111, 106, 101, 
-     99, 116, 101, 100,  46, 120, 
-    121,  32,  47,  32, 112, 114, 
-    101, 118, 105, 111, 117, 115, 
-     80, 114, 111, 106, 101,  99, 
-    116, 101, 100,  46, 119,  41, 
-     32,  42,  32,  97, 115, 112, 
-    101,  99, 116,  86, 101,  99, 
-     59,  13,  10,  32,  32,  32, 
-     32, 102, 108, 111,  97, 116, 
-     50,  32, 110, 101, 120, 116, 
-     83,  99, 114, 101, 101, 110, 
-     32,  61,  32,  40, 110, 101, 
-    120, 116,  80, 114, 111, 106, 
-    101,  99, 116, 101, 100,  46, 
-    120, 121,  32,  47,  32, 110, 
-    101, 120, 116,  80, 114, 111, 
-    106, 101,  99, 116, 101, 100, 
-     46, 119,  41,  32,  42,  32, 
-     97, 115, 112, 101,  99, 116, 
-     86, 101,  99,  59,  13,  10, 
-     13,  10,  32,  32,  32,  32, 
-     47,  47,  32,  79,  85,  84, 
-     46,  99, 111, 108, 111, 114, 
-     32,  61,  32, 102, 108, 111, 
-     97, 116,  52,  40,  40,  99, 
-    117, 114, 114, 101, 110, 116, 
-     83,  99, 114, 101, 101, 110, 
-     46, 120,  43,  49,  46,  48, 
-     41,  47,  50,  46,  48,  44, 
-     32,  40,  99, 117, 114, 114, 
-    101, 110, 116,  83,  99, 114, 
-    101, 101, 110,  46, 121,  43, 
-     49,  46,  48,  41,  47,  50, 
-     46,  48, 102,  44,  32,  48, 
-     46,  48,  44,  32,  49,  46, 
-     48,  41,  59,  13,  10,  13, 
-     10,  32,  32,  32,  32, 102, 
-    108, 111,  97, 116,  32, 108, 
-    101, 110,  32,  61,  32, 116, 
-    104, 105,  99, 107, 110, 101, 
-    115, 115,  59,  13,  10,  13, 
-     10,  32,  32,  32,  32,  47, 
-     47,  32,  78,  79,  84,  69, 
-     58,  32, 115, 116,  97, 114, 
-    116, 105, 110, 103,  32, 112, 
-    111, 105, 110, 116,  32, 117, 
-    115, 101, 115,  32,  40, 110, 
-    101, 120, 116,  32,  45,  32, 
-     99, 117, 114, 114, 101, 110, 
-    116,  41,  13,  10,  32,  32, 
-     32,  32, 102, 108, 111,  97, 
-    116,  50,  32, 100, 105, 114, 
-     32,  61,  32, 102, 108, 111, 
-     97, 116,  50,  40,  48,  46, 
-     48, 102,  44,  32,  48,  46, 
-     48, 102,  41,  59,  13,  10, 
-     32,  32,  32,  32, 105, 102, 
-     32,  40,  99, 117, 114, 114, 
-    101, 110, 116,  83,  99, 114, 
-    101, 101, 110,  46, 120,  32, 
-     61,  61,  32, 112, 114, 101, 
-    118, 105, 111, 117, 115,  83, 
-     99, 114, 101, 101, 110,  46, 
-    120,  32,  38,  38,  32,  99, 
-    117, 114, 114, 101, 110, 116, 
-     83,  99, 114, 101, 101, 110, 
-     46, 121,  32,  61,  61,  32, 
-    112, 114, 101, 118, 105, 111, 
-    117, 115,  83,  99, 114, 101, 
-    101, 110,  46, 121,  41,  32, 
-    123,  13,  10,  32,  32,  32, 
-     32,  32,  32,  32,  32, 100, 
-    105, 114,  32,  61,  32, 110, 
-    111, 114, 109,  97, 108, 105, 
-    122, 101,  40, 110, 101, 120, 
-    116,  83,  99, 114, 101, 101, 
-    110,  32,  45,  32,  99, 117, 
-    114, 114, 101, 110, 116,  83, 
-     99, 114, 101, 101, 110,  41, 
-     59,  13,  10,  32,  32,  32, 
-     32, 125,  32, 101, 108, 115, 
-    101,  32, 105, 102,  32,  40, 
-     99, 117, 114, 114, 101, 110, 
-    116,  83,  99, 114, 101, 101, 
-    110,  46, 120,  32,  61,  61, 
-     32, 110, 101, 120, 116,  83, 
-     99, 114, 101, 101, 110,  46, 
-    120,  32,  38,  38,  32,  99, 
-    117, 114, 114, 101, 110, 116, 
-     83,  99, 114, 101, 101, 110, 
-     46, 121,  32,  61,  61,  32, 
-    110, 101, 120, 116,  83,  99, 
-    114, 101, 101, 110,  46, 121, 
-     41,  32, 123,  32,  47,  47, 
-    101, 110, 100, 105, 110, 103, 
-     32, 112, 111, 105, 110, 116, 
-     32, 117, 115, 101, 115,  32, 
-     40,  99, 117, 114, 114, 101, 
-    110, 116,  32,  45,  32, 112, 
-    114, 101, 118, 105, 111, 117, 
-    115,  41,  13,  10,  32,  32, 
-     32,  32,  32,  32,  32,  32, 
-    100, 105, 114,  32,  61,  32, 
-    110, 111, 114, 109,  97, 108, 
-    105, 122, 101,  40,  99, 117, 
-    114, 114, 101, 110, 116,  83, 
-     99, 114, 101, 101, 110,  32, 
-     45,  32, 112, 114, 101, 118, 
-    105, 111, 117, 115,  83,  99, 
-    114, 101, 101, 110,  41,  59, 
-     13,  10,  32,  32,  32,  32, 
-    125,  32, 101, 108, 115, 101, 
-     32, 123,  13,  10,  32,  32, 
-     32,  32,  32,  32,  32,  32, 
-     47,  47,  32,  78,  79,  84, 
-     69,  58,  32, 115, 111, 109, 
-    101, 119, 104, 101, 114, 101, 
-     32, 105, 110,  32, 109, 105, 
-    100, 100, 108, 101,  44,  32, 
-    110, 101, 101, 100, 115,  32, 
-     97,  32, 106, 111, 105, 110, 
-     13,  10,  32,  32,  32,  32, 
-     32,  32,  32,  32,  47,  47, 
-     32,  78,  79,  84,  69,  58, 
-     32, 103, 101, 116,  32, 100, 
-    105, 114,  32, 102, 114, 111, 
-    109,  32,  40,  67,  32,  45, 
-     32,  66,  41,  32,  97, 110, 
-    100,  32,  40,  66,  32,  45, 
-     32,  65,  41,  13,  10,  32, 
-     32,  32,  32,  32,  32,  32, 
-     32, 102, 108, 111,  97, 116, 
-     50,  32, 100, 105, 114,  65, 
-     32,  61,  32, 110, 111, 114, 
-    109,  97, 108, 105, 122, 101, 
-     40,  99, 117, 114, 114, 101, 
-    110, 116,  83,  99, 114, 101, 
-    101, 110,  32,  45,  32, 112, 
-    114, 101, 118, 105, 111, 117, 
-    115,  83,  99, 114, 101, 101, 
-    110,  41,  59,  13,  10,  32, 
-     32,  32,  32,  32,  32,  32, 
-     32, 105, 102,  32,  40, 109, 
-    105, 116, 101, 114,  32,  61, 
-     61,  32,  49,  41,  32, 123, 
-     13,  10,  32,  32,  32,  32, 
-     32,  32,  32,  32,  32,  32, 
-     32,  32, 102, 108, 111,  97, 
-    116,  50,  32, 100, 105, 114, 
-     66,  32,  61,  32, 110, 111, 
-    114, 109,  97, 108, 105, 122, 
-    101,  40, 110, 101, 120, 116, 
-     83,  99, 114, 101, 101, 110, 
-     32,  45,  32,  99, 117, 114, 
-    114, 101, 110, 116,  83,  99, 
-    114, 101, 101, 110,  41,  59, 
-     13,  10,  13,  10,  32,  32, 
-     32,  32,  32,  32,  32,  32, 
-     32,  32,  32,  32, 102, 108, 
-    111,  97, 116,  50,  32, 116, 
-     97, 110, 103, 101, 110, 116, 
-     32,  61,  32, 110, 111, 114, 
-    109,  97, 108, 105, 122, 101, 
-     40, 100, 105, 114,  65,  32, 
-     43,  32, 100, 105, 114,  66, 
-     41,  59,  13,  10,  32,  32, 
-     32,  32,  32,  32,  32,  32, 
-     32,  32,  32,  32, 102, 108, 
-    111,  97, 116,  50,  32, 112, 
-    101, 114, 112,  32,  61,  32, 
-    102, 108, 111,  97, 116,  50, 
-     40,  45, 100, 105, 114,  65, 
-     46, 121,  44,  32, 100, 105, 
-    114,  65,  46, 120,  41,  59, 
-     13,  10,  32,  32,  32,  32, 
-     32,  32,  32,  32,  32,  32, 
-     32,  32, 102, 108, 111,  97, 
-    116,  50,  32, 109, 105, 116, 
-    101, 114,  32,  61,  32, 102, 
-    108, 111,  97, 116,  50,  40, 
-     45, 116,  97, 110, 103, 101, 
-    110, 116,  46, 121,  44,  32, 
-    116,  97, 110, 103, 101, 110, 
-    116,  46, 120,  41,  59,  13, 
-     10,  32,  32,  32,  32,  32, 
-     32,  32,  32,  32,  32,  32, 
-     32, 100, 105, 114,  32,  61, 
-     32, 116,  97, 110, 103, 101, 
-    110, 116,  59,  13,  10,  32, 
-     32,  32,  32,  32,  32,  32, 
-     32,  32,  32,  32,  32, 108, 
-    101, 110,  32,  61,  32, 116, 
-    104, 105,  99, 107, 110, 101, 
-    115, 115,  32,  47,  32, 100, 
-    111, 116,  40, 109, 105, 116, 
-    101, 114,  44,  32, 112, 101, 
-    114, 112,  41,  59,  13,  10, 
-     32,  32,  32,  32,  32,  32, 
-     32,  32, 125,  32, 101, 108, 
-    115, 101,  32, 123,  13,  10, 
-     32,  32,  32,  32,  32,  32, 
-     32,  32,  32,  32,  32,  32, 
-    100, 105, 114,  32,  61,  32, 
-    100, 105, 114,  65,  59,  13, 
-     10,  32,  32,  32,  32,  32, 
-     32,  32,  32, 125,  13,  10, 
-     32,  32,  32,  32, 125,  13, 
-     10,  13,  10,  32,  32,  32, 
-     32, 102, 108, 111,  97, 116, 
-     50,  32, 110, 111, 114, 109, 
-     97, 108,  32,  61,  32, 110, 
-    111, 114, 109,  97, 108, 105, 
-    122, 101,  40, 102, 108, 111, 
-     97, 116,  50,  40,  45, 100, 
-    105, 114,  46, 121,  44,  32, 
-    100, 105, 114,  46, 120,  41, 
-     41,  59,  13,  10,  32,  32, 
-     32,  32, 110, 111, 114, 109, 
-     97, 108,  32,  42,  61,  32, 
-    108, 101, 110,  32,  42,  32, 
-     48,  46,  53, 102,  59,  13, 
-     10,  32,  32,  32,  32, 110, 
-    111, 114, 109,  97, 108,  46, 
-    120,  32,  47,  61,  32,  97, 
-    115, 112, 101,  99, 116,  82, 
-     97, 116, 105, 111,  59,  13, 
-     10,  13,  10,  32,  32,  32, 
-     32,  99, 111, 110, 115, 116, 
-     32, 102, 108, 111,  97, 116, 
-     32, 111, 114, 105, 101, 110, 
-    116,  97, 116, 105, 111, 110, 
-     32,  61,  32,  73,  78,  46, 
-    100, 105, 114, 101,  99, 116, 
-    105, 111, 110,  91,  48,  93, 
-     59,  13,  10,  32,  32,  32, 
-     32,  99, 111, 110, 115, 116, 
-     32, 102, 108, 111,  97, 116, 
-     50,  32, 111, 102, 102, 115, 
-    101, 116,  32,  61,  32, 110, 
-    111, 114, 109,  97, 108,  32, 
-     42,  32, 111, 114, 105, 101, 
-    110, 116,  97, 116, 105, 111, 
-    110,  59,  13,  10,  32,  32, 
-     32,  32,  79,  85,  84,  46, 
-    112, 111, 115, 105, 116, 105, 
-    111, 110,  32,  61,  32,  99, 
-    117, 114, 114, 101, 110, 116, 
-     80, 114, 111, 106, 101,  99, 
-    116, 101, 100,  32,  43,  32, 
-    102, 108, 111,  97, 116,  52, 
-     40, 111, 102, 102, 115, 101, 
-    116,  46, 120, 121,  44,  32, 
-     48,  46,  48,  44,  32,  48, 
-     46,  48,  41,  59,  13,  10, 
-     32,  32,  32,  32,  79,  85, 
-     84,  46,  99, 111, 108, 111, 
-    114,  32,  61,  32, 102, 108, 
-    111,  97, 116,  52,  40,  48, 
-     46,  57,  44,  32,  48,  46, 
-     57,  44,  32,  48,  46,  57, 
-     44,  32,  49,  46,  48,  41, 
-     59,  13,  10,  13,  10,  32, 
-     32,  32,  32, 114, 101, 116, 
-    117, 114, 110,  32,  79,  85, 
-     84,  59,  13,  10, 125,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-     99,  98, 117, 102, 102, 101, 
-    114,  32,  80, 101, 114,  65, 
-    112, 112, 108, 105,  99,  97, 
-    116, 105, 111, 110,  32,  58, 
-     32, 114, 101, 103, 105, 115, 
-    116, 101, 114,  40,  98,  48, 
-     41,  32, 123,  13,  10,   9, 
-    109,  97, 116, 114, 105, 120, 
-     32, 112, 114, 111, 106, 101, 
-     99, 116, 105, 111, 110,  77, 
-     97, 116, 114, 105, 120,  59, 
-     13,  10,   9, 102, 108, 111, 
-     97, 116,  51,  32,  99, 108, 
-    105, 101, 110, 116,  68,  97, 
-    116,  97,  59,  13,  10, 125, 
-     13,  10,  13,  10,  99,  98, 
-    117, 102, 102, 101, 114,  32, 
-     80, 101, 114,  70, 114,  97, 
-    109, 101,  32,  58,  32, 114, 
-    101, 103, 105, 115, 116, 101, 
-    114,  40,  98,  49,  41,  32, 
-    123,  13,  10,   9, 109,  97, 
-    116, 114, 105, 120,  32, 118, 
-    105, 101, 119,  77,  97, 116, 
-    114, 105, 120,  59,  13,  10, 
-      9, 102, 108, 111,  97, 116, 
-     51,  32, 101, 121, 101,  80, 
-    111, 115,  59,  13,  10,   9, 
-    102, 108, 111,  97, 116,  51, 
-     32, 108, 105, 103, 104, 116, 
-     80, 111, 115,  59,  13,  10, 
-    125,  13,  10,  13,  10,  99, 
-     98, 117, 102, 102, 101, 114, 
-     32,  80, 101, 114,  79,  98, 
-    106, 101,  99, 116,  32,  58, 
-     32, 114, 101, 103, 105, 115, 
-    116, 101, 114,  40,  98,  50, 
-     41,  32, 123,  13,  10,   9, 
-    109,  97, 116, 114, 105, 120, 
-     32, 109, 111, 100, 101, 108, 
-     77,  97, 116, 114, 105, 120, 
-     59,  13,  10,   9, 109,  97, 
-    116, 114, 105, 120,  32, 118, 
-    105, 101, 119,  80, 114, 111, 
-    106, 101,  99, 116, 105, 111, 
-    110,  77,  97, 116, 114, 105, 
-    120,  59,  13,  10,   9, 109, 
-     97, 116, 114, 105, 120,  32, 
-    109, 111, 100, 101, 108,  86, 
-    105, 101, 119,  80, 114, 111, 
-    106, 101,  99, 116, 105, 111, 
-    110,  77,  97, 116, 114, 105, 
-    120,  59,  13,  10, 125,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0, 254, 239, 254, 239, 
-      1,   0,   0,   0,  76,  14, 
-      0,   0,   0,  69,  58,  92, 
-     80, 114, 111, 106, 101,  99, 
-    116, 115,  92,  78, 105,  99, 
-    107, 101, 108,  92,  78, 105, 
-     99, 107, 101, 108,  92,  68, 
-     97, 116,  97,  92,  83, 104, 
-     97, 100, 101, 114, 115,  92, 
-     76, 105, 110, 101,  86, 101, 
-    114, 116, 101, 120,  83, 104, 
-     97, 100, 101, 114,  46, 104, 
-    108, 115, 108,   0,   0, 101, 
-     58,  92, 112, 114, 111, 106, 
-    101,  99, 116, 115,  92, 110, 
-    105,  99, 107, 101, 108,  92, 
-    110, 105,  99, 107, 101, 108, 
-     92, 100,  97, 116,  97,  92, 
-    115, 104,  97, 100, 101, 114, 
-    115,  92, 108, 105, 110, 101, 
-    118, 101, 114, 116, 101, 120, 
-    115, 104,  97, 100, 101, 114, 
-     46, 104, 108, 115, 108,   0, 
-     69,  58,  92,  80, 114, 111, 
-    106, 101,  99, 116, 115,  92, 
-     78, 105,  99, 107, 101, 108, 
-     92,  78, 105,  99, 107, 101, 
-    108,  92,  68,  97, 116,  97, 
-     92,  83, 104,  97, 100, 101, 
-    114, 115,  92,  67, 111, 109, 
-    109, 111, 110,  67, 111, 110, 
-    115, 116,  97, 110, 116,  66, 
-    117, 102, 102, 101, 114, 115, 
-     46, 104, 108, 115, 108,   0, 
-    101,  58,  92, 112, 114, 111, 
-    106, 101,  99, 116, 115,  92, 
-    110, 105,  99, 107, 101, 108, 
-     92, 110, 105,  99, 107, 101, 
-    108,  92, 100,  97, 116,  97, 
-     92, 115, 104,  97, 100, 101, 
-    114, 115,  92,  99, 111, 109, 
-    109, 111, 110,  99, 111, 110, 
-    115, 116,  97, 110, 116,  98, 
-    117, 102, 102, 101, 114, 115, 
-     46, 104, 108, 115, 108,   0, 
-     35, 105, 110,  99, 108, 117, 
-    100, 101,  32,  34,  67, 111, 
-    109, 109, 111, 110,  67, 111, 
-    110, 115, 116,  97, 110, 116, 
-     66, 117, 102, 102, 101, 114, 
-    115,  46, 104, 108, 115, 108, 
-     34,  13,  10,  13,  10,  99, 
-     98, 117, 102, 102, 101, 114, 
-     32,  83, 104,  97, 100, 101, 
-    114,  68,  97, 116,  97,  32, 
-     58,  32, 114, 101, 103, 105, 
-    115, 116, 101, 114,  40,  98, 
-     51,  41,  13,  10, 123,  13, 
-     10,  32,  32,  32,  32, 102, 
-    108, 111,  97, 116,  32, 116, 
-    104, 105,  99, 107, 110, 101, 
-    115, 115,  59,  13,  10,  32, 
-     32,  32,  32, 105, 110, 116, 
-     32, 109, 105, 116, 101, 114, 
-     59,  13,  10, 125,  13,  10, 
-     13,  10, 115, 116, 114, 117, 
-     99, 116,  32,  86, 101, 114, 
-    116, 101, 120,  68,  97, 116, 
-     97,  13,  10, 123,  13,  10, 
-     32,  32,  32,  32, 102, 108, 
-    111,  97, 116,  51,  32, 112, 
-    111, 115, 105, 116, 105, 111, 
-    110,  32,  58,  32,  80,  79, 
-     83,  73,  84,  73,  79,  78, 
-     59,  13,  10,  32,  32,  32, 
-     32, 102, 108, 111,  97, 116, 
-     51,  32, 112, 114, 101, 118, 
-    105, 111, 117, 115,  32,  58, 
-     32,  80,  79,  83,  73,  84, 
-     73,  79,  78,  50,  59,  13, 
-     10,  32,  32,  32,  32, 102, 
-    108, 111,  97, 116,  51,  32, 
-    110, 101, 120, 116,  32,  58, 
-     32,  80,  79,  83,  73,  84, 
-     73,  79,  78,  51,  59,  13, 
-     10,  32,  32,  32,  27, 226, 
-     48,   1, 172,   0,   0,   0, 
-     54,   3, 120, 209,  75, 218, 
-    215,   1,   1,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   2,   0,   0,   0, 
-      4,   0,   0,   0,   1,   0, 
-      0,   0,  12,   0,   0,   0, 
-      0,   0,   0,   0, 190,   0, 
-      0,   0,  40,   0,   0,   0, 
-     27, 226,  48,   1,   4, 183, 
-     45, 148,  61,   1,   0,   0, 
-    124,   0,   0,   0,  62,   0, 
-      0,   0, 190,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-     63,   0,   0,   0,  40,   0, 
-      0,   0,  27, 226,  48,   1, 
-    232, 182,  37,  61,  13,  12, 
-      0,   0,   1,   0,   0,   0, 
-     62,   0,   0,   0,  63,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      4,   0,   0,   0,  66,   0, 
-     60,  17,  16,   1,   0,   0, 
-      0,   1,  10,   0,   1,   0, 
-      1,   0, 124,  79,  10,   0, 
-      1,   0,   1,   0, 124,  79, 
-     77, 105,  99, 114, 111, 115, 
-    111, 102, 116,  32,  40,  82, 
-     41,  32,  72,  76,  83,  76, 
-     32,  83, 104,  97, 100, 101, 
-    114,  32,  67, 111, 109, 112, 
-    105, 108, 101, 114,  32,  49, 
-     48,  46,  49,   0,   0,   0, 
-     66,   0,  61,  17,   1, 104, 
-    108, 115, 108,  70, 108,  97, 
-    103, 115,   0,  48, 120,  53, 
-      0, 104, 108, 115, 108,  84, 
-     97, 114, 103, 101, 116,   0, 
-    118, 115,  95,  53,  95,  48, 
-      0, 104, 108, 115, 108,  69, 
-    110, 116, 114, 121,   0,  76, 
-    105, 110, 101,  86, 101, 114, 
-    116, 101, 120,  83, 104,  97, 
-    100, 101, 114,   0,   0,   0, 
-      0,   0,  54,   0,  16,  17, 
-      0,   0,   0,   0, 120,  11, 
-      0,   0,   0,   0,   0,   0, 
-     80,   8,   0,   0,   0,   0, 
-      0,   0,  80,   8,   0,   0, 
-      8,  16,   0,   0, 144,   0, 
-      0,   0,   1,   0, 160,  76, 
-    105, 110, 101,  86, 101, 114, 
-    116, 101, 120,  83, 104,  97, 
-    100, 101, 114,   0,  42,   0, 
-     62,  17,   2,  16,   0,   0, 
-      9,   0,  73,  78,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-     22,   0,  80,  17,   1,   0, 
-      5,   0,   0,   0,   4,   0, 
-    144,   0,   0,   0,   1,   0, 
-     80,   8,   0,   0,   0,   0, 
-     22,   0,  80,  17,   1,   0, 
-      5,   0,   4,   0,   4,   0, 
-    144,   0,   0,   0,   1,   0, 
-     80,   8,   4,   0,   0,   0, 
-     22,   0,  80,  17,   1,   0, 
-      5,   0,   8,   0,   4,   0, 
-    144,   0,   0,   0,   1,   0, 
-     80,   8,   8,   0,   0,   0, 
-     22,   0,  80,  17,   1,   0, 
-      5,   0,  12,   0,   4,   0, 
-    144,   0,   0,   0,   1,   0, 
-     80,   8,  16,   0,   0,   0, 
-     22,   0,  80,  17,   1,   0, 
-      5,   0,  16,   0,   4,   0, 
-    144,   0,   0,   0,   1,   0, 
-     80,   8,  20,   0,   0,   0, 
-     22,   0,  80,  17,   1,   0, 
-      5,   0,  20,   0,   4,   0, 
-    144,   0,   0,   0,   1,   0, 
-     80,   8,  24,   0,   0,   0, 
-     22,   0,  80,  17,   1,   0, 
-      5,   0,  24,   0,   4,   0, 
-    144,   0,   0,   0,   1,   0, 
-     80,   8,  32,   0,   0,   0, 
-     22,   0,  80,  17,   1,   0, 
-      5,   0,  28,   0,   4,   0, 
-    144,   0,   0,   0,   1,   0, 
-     80,   8,  36,   0,   0,   0, 
-     22,   0,  80,  17,   1,   0, 
-      5,   0,  32,   0,   4,   0, 
-    144,   0,   0,   0,   1,   0, 
-     80,   8,  40,   0,   0,   0, 
-     22,   0,  80,  17,   1,   0, 
-      5,   0,  36,   0,   4,   0, 
-    144,   0,   0,   0,   1,   0, 
-     80,   8,  48,   0,   0,   0, 
-     22,   0,  80,  17,   1,   0, 
-      5,   0,  40,   0,   4,   0, 
-    144,   0,   0,   0,   1,   0, 
-     80,   8,  52,   0,   0,   0, 
-     22,   0,  80,  17,   1,   0, 
-      5,   0,  44,   0,   4,   0, 
-    144,   0,   0,   0,   1,   0, 
-     80,   8,  56,   0,   0,   0, 
-     70,   0,  62,  17,   7,  16, 
-      0,   0, 136,   0,  60,  76, 
-    105, 110, 101,  86, 101, 114, 
-    116, 101, 120,  83, 104,  97, 
-    100, 101, 114,  32, 114, 101, 
-    116, 117, 114, 110,  32, 118, 
-     97, 108, 117, 101,  62,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-     22,   0,  80,  17,   2,   0, 
-      5,   0,  16,   0,   4,   0, 
-    144,   0,   0,   0,   1,   0, 
-     80,   8,  16,   0,   0,   0, 
-     22,   0,  80,  17,   2,   0, 
-      5,   0,  20,   0,   4,   0, 
-    144,   0,   0,   0,   1,   0, 
-     80,   8,  20,   0,   0,   0, 
-     22,   0,  80,  17,   2,   0, 
-      5,   0,  24,   0,   4,   0, 
-    144,   0,   0,   0,   1,   0, 
-     80,   8,  24,   0,   0,   0, 
-     22,   0,  80,  17,   2,   0, 
-      5,   0,  28,   0,   4,   0, 
-    144,   0,   0,   0,   1,   0, 
-     80,   8,  28,   0,   0,   0, 
-     22,   0,  80,  17,   2,   0, 
-      5,   0,   0,   0,   4,   0, 
-    144,   0,   0,   0,   1,   0, 
-     80,   8,   0,   0,   0,   0, 
-     22,   0,  80,  17,   2,   0, 
-      5,   0,   4,   0,   4,   0, 
-    144,   0,   0,   0,   1,   0, 
-     80,   8,   4,   0,   0,   0, 
-     22,   0,  80,  17,   2,   0, 
-      5,   0,   8,   0,   4,   0, 
-    144,   0,   0,   0,   1,   0, 
-     80,   8,   8,   0,   0,   0, 
-     22,   0,  80,  17,   2,   0, 
-      5,   0,  12,   0,   4,   0, 
-    144,   0,   0,   0,   1,   0, 
-     80,   8,  12,   0,   0,   0, 
-     42,   0,  62,  17,   6,  16, 
-      0,   0,   8,   0,  79,  85, 
-     84,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,  22,   0,  80,  17, 
-      0,   0,   5,   0,  16,   0, 
-      4,   0, 148,   8,   0,   0, 
-      1,   0,  76,   0,   0,   0, 
-      0,   0,  22,   0,  80,  17, 
-      0,   0,   5,   0,  20,   0, 
-      4,   0, 148,   8,   0,   0, 
-      1,   0,  76,   0,   4,   0, 
-      0,   0,  22,   0,  80,  17, 
-      0,   0,   5,   0,  24,   0, 
-      4,   0, 148,   8,   0,   0, 
-      1,   0,  76,   0,   8,   0, 
-      0,   0,  22,   0,  80,  17, 
-      0,   0,   5,   0,  28,   0, 
-      4,   0, 148,   8,   0,   0, 
-      1,   0,  76,   0,  12,   0, 
-      0,   0,  22,   0,  80,  17, 
-      0,   0,   5,   0,   0,   0, 
-      4,   0, 180,   8,   0,   0, 
-      1,   0,  44,   0,  16,   0, 
-      0,   0,  22,   0,  80,  17, 
-      0,   0,   5,   0,   4,   0, 
-      4,   0, 180,   8,   0,   0, 
-      1,   0,  44,   0,  20,   0, 
-      0,   0,  22,   0,  80,  17, 
-      0,   0,   5,   0,   8,   0, 
-      4,   0, 180,   8,   0,   0, 
-      1,   0,  44,   0,  24,   0, 
-      0,   0,  22,   0,  80,  17, 
-      0,   0,   5,   0,  12,   0, 
-      4,   0, 180,   8,   0,   0, 
-      1,   0,  44,   0,  28,   0, 
-      0,   0,  58,   0,  62,  17, 
-      4,  16,   0,   0,   8,   0, 
-    112, 114, 101, 118, 105, 111, 
-    117, 115,  80, 114, 111, 106, 
-    101,  99, 116, 101, 100,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,  22,   0,  80,  17, 
-      0,   0,   5,   0,   0,   0, 
-      4,   0, 216,   0,   0,   0, 
-      1,   0,   4,   2,  16,   0, 
-      0,   0,  22,   0,  80,  17, 
-      0,   0,   5,   0,   4,   0, 
-      4,   0, 248,   0,   0,   0, 
-      1,   0, 228,   1,  20,   0, 
-      0,   0,  22,   0,  80,  17, 
-      0,   0,   5,   0,  12,   0, 
-      4,   0,  24,   1,   0,   0, 
-      1,   0, 252,   1,   0,   0, 
-      0,   0,  54,   0,  62,  17, 
-      4,  16,   0,   0,   8,   0, 
-     99, 117, 114, 114, 101, 110, 
-    116,  80, 114, 111, 106, 101, 
-     99, 116, 101, 100,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,  22,   0, 
-     80,  17,   0,   0,   5,   0, 
-      0,   0,   4,   0,  96,   1, 
-      0,   0,   1,   0, 128,   7, 
-     48,   0,   0,   0,  22,   0, 
-     80,  17,   0,   0,   5,   0, 
-      4,   0,   4,   0, 128,   1, 
-      0,   0,   1,   0,  96,   7, 
-     52,   0,   0,   0,  22,   0, 
-     80,  17,   0,   0,   5,   0, 
-      8,   0,   4,   0, 160,   1, 
-      0,   0,   1,   0,  64,   7, 
-     56,   0,   0,   0,  22,   0, 
-     80,  17,   0,   0,   5,   0, 
-     12,   0,   4,   0, 192,   1, 
-      0,   0,   1,   0,  32,   7, 
-     60,   0,   0,   0,  54,   0, 
-     62,  17,   4,  16,   0,   0, 
-      8,   0, 110, 101, 120, 116, 
-     80, 114, 111, 106, 101,  99, 
-    116, 101, 100,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-     30,   0,  80,  17,   0,   0, 
-      5,   0,   0,   0,   4,   0, 
-      8,   2,   0,   0,   1,   0, 
-     92,   5, 156,   2, 108,   0, 
-    224,   4, 104,   0,  64,   0, 
-      0,   0,  30,   0,  80,  17, 
-      0,   0,   5,   0,   4,   0, 
-      4,   0,  40,   2,   0,   0, 
-      1,   0,  60,   5, 124,   2, 
-    108,   0, 212,   4,  84,   0, 
-     68,   0,   0,   0,  22,   0, 
-     80,  17,   0,   0,   5,   0, 
-     12,   0,   4,   0,  72,   2, 
-      0,   0,   1,   0, 204,   0, 
-      4,   0,   0,   0,  50,   0, 
-     62,  17,   9,  16,   0,   0, 
-      0,   0,  97, 115, 112, 101, 
-     99, 116,  82,  97, 116, 105, 
-    111,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,  22,   0,  80,  17, 
-      0,   0,   1,   0,   0,   0, 
-      4,   0,  96,   2,   0,   0, 
-      1,   0, 128,   6,  32,   0, 
-      0,   0,  50,   0,  62,  17, 
-     11,  16,   0,   0,   8,   0, 
-     97, 115, 112, 101,  99, 116, 
-     86, 101,  99,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-     22,   0,  80,  17,   0,   0, 
-      5,   0,   0,   0,   4,   0, 
-    116,   2,   0,   0,   1,   0, 
-    108,   6,  32,   0,   0,   0, 
-     22,   0,  80,  17,   0,   0, 
-      5,   0,   4,   0,   4,   0, 
-    136,   2,   0,   0,   1,   0, 
-    248,   0,  36,   0,   0,   0, 
-     54,   0,  62,  17,  10,  16, 
-      0,   0,   8,   0,  99, 117, 
-    114, 114, 101, 110, 116,  83, 
-     99, 114, 101, 101, 110,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,  26,   0,  80,  17, 
-      0,   0,   5,   0,   0,   0, 
-      4,   0, 192,   2,   0,   0, 
-      1,   0, 164,   4,  20,   3, 
-    124,   1,   8,   0,   0,   0, 
-     26,   0,  80,  17,   0,   0, 
-      5,   0,   4,   0,   4,   0, 
-    192,   2,   0,   0,   1,   0, 
-    164,   4,  20,   3, 124,   1, 
-     12,   0,   0,   0,  54,   0, 
-     62,  17,  10,  16,   0,   0, 
-      8,   0, 112, 114, 101, 118, 
-    105, 111, 117, 115,  83,  99, 
-    114, 101, 101, 110,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-     22,   0,  80,  17,   0,   0, 
-      5,   0,   0,   0,   4,   0, 
-    248,   2,   0,   0,   1,   0, 
-     48,   2,  16,   0,   0,   0, 
-     22,   0,  80,  17,   0,   0, 
-      5,   0,   4,   0,   4,   0, 
-    248,   2,   0,   0,   1,   0, 
-     48,   2,  20,   0,   0,   0, 
-     50,   0,  62,  17,  10,  16, 
-      0,   0,   8,   0, 110, 101, 
-    120, 116,  83,  99, 114, 101, 
-    101, 110,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,  26,   0, 
-     80,  17,   0,   0,   5,   0, 
-      0,   0,   4,   0,  48,   3, 
-      0,   0,   1,   0,  52,   4, 
-    192,   2,  96,   1,   0,   0, 
-      0,   0,  26,   0,  80,  17, 
-      0,   0,   5,   0,   4,   0, 
-      4,   0,  48,   3,   0,   0, 
-      1,   0,  52,   4, 192,   2, 
-     96,   1,   4,   0,   0,   0, 
-     42,   0,  62,  17,  64,   0, 
-      0,   0,   0,   0, 108, 101, 
-    110,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,  22,   0,  80,  17, 
-      0,   0,   1,   0,   0,   0, 
-      4,   0,  72,   3,   0,   0, 
-      1,   0, 108,   5,  24,   0, 
-      0,   0,  42,   0,  62,  17, 
-     10,  16,   0,   0,   8,   0, 
-    100, 105, 114,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,  34,   0, 
-     80,  17,   0,   0,   5,   0, 
-      4,   0,   4,   0,  40,   4, 
-      0,   0,   1,   0,  96,   3, 
-      4,   0, 224,   0, 232,   0, 
-      0,   2,  40,   3,  20,   0, 
-     36,   0,   0,   0,  34,   0, 
-     80,  17,   0,   0,   5,   0, 
-      0,   0,   4,   0,  40,   4, 
-      0,   0,   1,   0, 184,   4, 
-      4,   0, 224,   0, 232,   0, 
-      0,   2,  40,   3,  20,   0, 
-     40,   0,   0,   0,  42,   0, 
-     62,  17,  10,  16,   0,   0, 
-      8,   0, 100, 105, 114,  65, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-     26,   0,  80,  17,   0,   0, 
-      5,   0,   4,   0,   4,   0, 
-    144,   5,   0,   0,   1,   0, 
-    216,   1, 128,   1,  64,   0, 
-     36,   0,   0,   0,  26,   0, 
-     80,  17,   0,   0,   5,   0, 
-      0,   0,   4,   0, 144,   5, 
-      0,   0,   1,   0, 216,   1, 
-    128,   1,  64,   0,  40,   0, 
-      0,   0,  42,   0,  62,  17, 
-     10,  16,   0,   0,   8,   0, 
-    100, 105, 114,  66,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,  22,   0, 
-     80,  17,   0,   0,   5,   0, 
-      0,   0,   4,   0,  60,   6, 
-      0,   0,   1,   0,  28,   0, 
-      0,   0,   0,   0,  22,   0, 
-     80,  17,   0,   0,   5,   0, 
-      4,   0,   4,   0,  60,   6, 
-      0,   0,   1,   0,  28,   0, 
-      4,   0,   0,   0,  46,   0, 
-     62,  17,  10,  16,   0,   0, 
-      8,   0, 116,  97, 110, 103, 
-    101, 110, 116,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,  22,   0, 
-     80,  17,   0,   0,   5,   0, 
-      0,   0,   4,   0, 164,   6, 
-      0,   0,   1,   0, 136,   0, 
-      0,   0,   0,   0,  22,   0, 
-     80,  17,   0,   0,   5,   0, 
-      4,   0,   4,   0, 164,   6, 
-      0,   0,   1,   0, 172,   0, 
-      4,   0,   0,   0,  42,   0, 
-     62,  17,  10,  16,   0,   0, 
-      8,   0, 112, 101, 114, 112, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-     22,   0,  80,  17,   0,   0, 
-      5,   0,   0,   0,   4,   0, 
-    188,   6,   0,   0,   1,   0, 
-    148,   0,  16,   0,   0,   0, 
-     22,   0,  80,  17,   0,   0, 
-      5,   0,   4,   0,   4,   0, 
-    208,   6,   0,   0,   1,   0, 
-    128,   0,  20,   0,   0,   0, 
-     46,   0,  62,  17,  10,  16, 
-      0,   0,   8,   0, 109, 105, 
-    116, 101, 114,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-     22,   0,  80,  17,   0,   0, 
-      5,   0,   0,   0,   4,   0, 
-    232,   6,   0,   0,   1,   0, 
-    104,   0,  64,   0,   0,   0, 
-     22,   0,  80,  17,   0,   0, 
-      5,   0,   4,   0,   4,   0, 
-    252,   6,   0,   0,   1,   0, 
-     84,   0,  68,   0,   0,   0, 
-     46,   0,  62,  17,  10,  16, 
-      0,   0,   8,   0, 110, 111, 
-    114, 109,  97, 108,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-     26,   0,  80,  17,   0,   0, 
-      5,   0,   0,   0,   4,   0, 
-    212,   7,   0,   0,   1,   0, 
-    132,   0,  56,   0,  28,   0, 
-      0,   0,   0,   0,  22,   0, 
-     80,  17,   0,   0,   5,   0, 
-      4,   0,   4,   0, 212,   7, 
-      0,   0,   1,   0,  56,   0, 
-      4,   0,   0,   0,  22,   0, 
-     80,  17,   0,   0,   5,   0, 
-      0,   0,   4,   0,  12,   8, 
-      0,   0,   1,   0,  28,   0, 
-      4,   0,   0,   0,  22,   0, 
-     80,  17,   0,   0,   5,   0, 
-      4,   0,   4,   0,  12,   8, 
-      0,   0,   1,   0, 108,   0, 
-      8,   0,   0,   0,  50,   0, 
-     62,  17,   9,  16,   0,   0, 
-      0,   0, 111, 114, 105, 101, 
-    110, 116,  97, 116, 105, 111, 
-    110,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,  22,   0,  80,  17, 
-      0,   0,   1,   0,   0,   0, 
-      4,   0,  60,   8,   0,   0, 
-      1,   0,  28,   0,   4,   0, 
-      0,   0,  46,   0,  62,  17, 
-     11,  16,   0,   0,   8,   0, 
-    111, 102, 102, 115, 101, 116, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,  22,   0,  80,  17, 
-      0,   0,   5,   0,   0,   0, 
-      4,   0,  88,   8,   0,   0, 
-      1,   0,  60,   0,   0,   0, 
-      0,   0,  22,   0,  80,  17, 
-      0,   0,   5,   0,   4,   0, 
-      4,   0,  88,   8,   0,   0, 
-      1,   0,  60,   0,   4,   0, 
-      0,   0,   2,   0,   6,   0, 
-    244,   0,   0,   0,  48,   0, 
-      0,   0,   1,   0,   0,   0, 
-     16,   1, 138, 155, 244, 226, 
-    238,  75, 196,  21,  38,  97, 
-     54, 114, 239,  43,  56, 199, 
-      0,   0, 124,   0,   0,   0, 
-     16,   1, 118, 121, 219,  16, 
-    108,  60,  36, 183,  75, 158, 
-    242, 112, 198,  70,  53,  61, 
-      0,   0, 242,   0,   0,   0, 
-    112,   8,   0,   0,   0,   0, 
-      0,   0,   1,   0,   1,   0, 
-    224,   8,   0,   0,   0,   0, 
-      0,   0, 178,   0,   0,   0, 
-    100,   8,   0,   0, 144,   0, 
-      0,   0,  35,   0,   0, 128, 
-    144,   0,   0,   0,  35,   0, 
-      0,   0, 164,   0,   0,   0, 
-     35,   0,   0, 128, 164,   0, 
-      0,   0,  35,   0,   0,   0, 
-    184,   0,   0,   0,  35,   0, 
-      0, 128, 184,   0,   0,   0, 
-     35,   0,   0,   0, 216,   0, 
-      0,   0,  35,   0,   0, 128, 
-    216,   0,   0,   0,  35,   0, 
-      0,   0, 248,   0,   0,   0, 
-     35,   0,   0, 128, 248,   0, 
-      0,   0,  35,   0,   0,   0, 
-     24,   1,   0,   0,  36,   0, 
-      0, 128,  24,   1,   0,   0, 
-     36,   0,   0,   0,  44,   1, 
-      0,   0,  36,   0,   0, 128, 
-     44,   1,   0,   0,  36,   0, 
-      0,   0,  64,   1,   0,   0, 
-     36,   0,   0, 128,  64,   1, 
-      0,   0,  36,   0,   0,   0, 
-     96,   1,   0,   0,  36,   0, 
-      0, 128,  96,   1,   0,   0, 
-     36,   0,   0,   0, 128,   1, 
-      0,   0,  36,   0,   0, 128, 
-    128,   1,   0,   0,  36,   0, 
-      0,   0, 160,   1,   0,   0, 
-     36,   0,   0, 128, 160,   1, 
-      0,   0,  36,   0,   0,   0, 
-    192,   1,   0,   0,  37,   0, 
-      0, 128, 192,   1,   0,   0, 
-     37,   0,   0,   0, 212,   1, 
-      0,   0,  37,   0,   0, 128, 
-    212,   1,   0,   0,  37,   0, 
-      0,   0, 232,   1,   0,   0, 
-     37,   0,   0, 128, 232,   1, 
-      0,   0,  37,   0,   0,   0, 
-      8,   2,   0,   0,  37,   0, 
-      0, 128,   8,   2,   0,   0, 
-     37,   0,   0,   0,  40,   2, 
-      0,   0,  37,   0,   0, 128, 
-     40,   2,   0,   0,  37,   0, 
-      0,   0,  72,   2,   0,   0, 
-     39,   0,   0, 128,  72,   2, 
-      0,   0,  39,   0,   0,   0, 
-     96,   2,   0,   0,  40,   0, 
-      0, 128,  96,   2,   0,   0, 
-     40,   0,   0,   0, 116,   2, 
-      0,   0,  40,   0,   0, 128, 
-    116,   2,   0,   0,  40,   0, 
-      0,   0, 136,   2,   0,   0, 
-     42,   0,   0, 128, 136,   2, 
-      0,   0,  42,   0,   0,   0, 
-    164,   2,   0,   0,  42,   0, 
-      0, 128, 164,   2,   0,   0, 
-     42,   0,   0,   0, 192,   2, 
-      0,   0,  43,   0,   0, 128, 
-    192,   2,   0,   0,  43,   0, 
-      0,   0, 220,   2,   0,   0, 
-     43,   0,   0, 128, 220,   2, 
-      0,   0,  43,   0,   0,   0, 
-    248,   2,   0,   0,  44,   0, 
-      0, 128, 248,   2,   0,   0, 
-     44,   0,   0,   0,  20,   3, 
-      0,   0,  44,   0,   0, 128, 
-     20,   3,   0,   0,  44,   0, 
-      0,   0,  48,   3,   0,   0, 
-     48,   0,   0, 128,  48,   3, 
-      0,   0,  48,   0,   0,   0, 
-     72,   3,   0,   0,  52,   0, 
-      0, 128,  72,   3,   0,   0, 
-     52,   0,   0,   0, 100,   3, 
-      0,   0,  52,   0,   0, 128, 
-    100,   3,   0,   0,  52,   0, 
-      0,   0, 128,   3,   0,   0, 
-     52,   0,   0, 128, 128,   3, 
-      0,   0,  52,   0,   0,   0, 
-    156,   3,   0,   0,  52,   0, 
-      0, 128, 156,   3,   0,   0, 
-     52,   0,   0,   0, 168,   3, 
-      0,   0,  53,   0,   0, 128, 
-    168,   3,   0,   0,  53,   0, 
-      0,   0, 192,   3,   0,   0, 
-     53,   0,   0, 128, 192,   3, 
-      0,   0,  53,   0,   0,   0, 
-    220,   3,   0,   0,  53,   0, 
-      0, 128, 220,   3,   0,   0, 
-     53,   0,   0,   0, 248,   3, 
-      0,   0,  53,   0,   0, 128, 
-    248,   3,   0,   0,  53,   0, 
-      0,   0,  12,   4,   0,   0, 
-     53,   0,   0, 128,  12,   4, 
-      0,   0,  53,   0,   0,   0, 
-     40,   4,   0,   0,  54,   0, 
-      0, 128,  40,   4,   0,   0, 
-     54,   0,   0,   0,  44,   4, 
-      0,   0,  54,   0,   0, 128, 
-     44,   4,   0,   0,  54,   0, 
-      0,   0,  72,   4,   0,   0, 
-     54,   0,   0, 128,  72,   4, 
-      0,   0,  54,   0,   0,   0, 
-    100,   4,   0,   0,  54,   0, 
-      0, 128, 100,   4,   0,   0, 
-     54,   0,   0,   0, 128,   4, 
-      0,   0,  54,   0,   0, 128, 
-    128,   4,   0,   0,  54,   0, 
-      0,   0, 140,   4,   0,   0, 
-     55,   0,   0, 128, 140,   4, 
-      0,   0,  55,   0,   0,   0, 
-    164,   4,   0,   0,  55,   0, 
-      0, 128, 164,   4,   0,   0, 
-     55,   0,   0,   0, 192,   4, 
-      0,   0,  55,   0,   0, 128, 
-    192,   4,   0,   0,  55,   0, 
-      0,   0, 220,   4,   0,   0, 
-     55,   0,   0, 128, 220,   4, 
-      0,   0,  55,   0,   0,   0, 
-    240,   4,   0,   0,  55,   0, 
-      0, 128, 240,   4,   0,   0, 
-     55,   0,   0,   0,  12,   5, 
-      0,   0,  56,   0,   0, 128, 
-     12,   5,   0,   0,  56,   0, 
-      0,   0,  16,   5,   0,   0, 
-     59,   0,   0, 128,  16,   5, 
-      0,   0,  59,   0,   0,   0, 
-     40,   5,   0,   0,  59,   0, 
-      0, 128,  40,   5,   0,   0, 
-     59,   0,   0,   0,  68,   5, 
-      0,   0,  59,   0,   0, 128, 
-     68,   5,   0,   0,  59,   0, 
-      0,   0,  96,   5,   0,   0, 
-     59,   0,   0, 128,  96,   5, 
-      0,   0,  59,   0,   0,   0, 
-    116,   5,   0,   0,  59,   0, 
-      0, 128, 116,   5,   0,   0, 
-     59,   0,   0,   0, 144,   5, 
-      0,   0,  60,   0,   0, 128, 
-    144,   5,   0,   0,  60,   0, 
-      0,   0, 176,   5,   0,   0, 
-     60,   0,   0, 128, 176,   5, 
-      0,   0,  60,   0,   0,   0, 
-    188,   5,   0,   0,  61,   0, 
-      0, 128, 188,   5,   0,   0, 
-     61,   0,   0,   0, 212,   5, 
-      0,   0,  61,   0,   0, 128, 
-    212,   5,   0,   0,  61,   0, 
-      0,   0, 240,   5,   0,   0, 
-     61,   0,   0, 128, 240,   5, 
-      0,   0,  61,   0,   0,   0, 
-     12,   6,   0,   0,  61,   0, 
-      0, 128,  12,   6,   0,   0, 
-     61,   0,   0,   0,  32,   6, 
-      0,   0,  61,   0,   0, 128, 
-     32,   6,   0,   0,  61,   0, 
-      0,   0,  60,   6,   0,   0, 
-     63,   0,   0, 128,  60,   6, 
-      0,   0,  63,   0,   0,   0, 
-     88,   6,   0,   0,  63,   0, 
-      0, 128,  88,   6,   0,   0, 
-     63,   0,   0,   0, 116,   6, 
-      0,   0,  63,   0,   0, 128, 
-    116,   6,   0,   0,  63,   0, 
-      0,   0, 136,   6,   0,   0, 
-     63,   0,   0, 128, 136,   6, 
-      0,   0,  63,   0,   0,   0, 
-    164,   6,   0,   0,  64,   0, 
-      0, 128, 164,   6,   0,   0, 
-     64,   0,   0,   0, 188,   6, 
-      0,   0,  64,   0,   0, 128, 
-    188,   6,   0,   0,  64,   0, 
-      0,   0, 208,   6,   0,   0, 
-     65,   0,   0, 128, 208,   6, 
-      0,   0,  65,   0,   0,   0, 
-    232,   6,   0,   0,  65,   0, 
-      0, 128, 232,   6,   0,   0, 
-     65,   0,   0,   0, 252,   6, 
-      0,   0,  66,   0,   0, 128, 
-    252,   6,   0,   0,  66,   0, 
-      0,   0,  16,   7,   0,   0, 
-     67,   0,   0, 128,  16,   7, 
-      0,   0,  67,   0,   0,   0, 
-     44,   7,   0,   0,  67,   0, 
-      0, 128,  44,   7,   0,   0, 
-     67,   0,   0,   0,  76,   7, 
-      0,   0,  68,   0,   0, 128, 
-     76,   7,   0,   0,  68,   0, 
-      0,   0,  80,   7,   0,   0, 
-     69,   0,   0, 128,  80,   7, 
-      0,   0,  69,   0,   0,   0, 
-    100,   7,   0,   0,  70,   0, 
-      0, 128, 100,   7,   0,   0, 
-     70,   0,   0,   0, 104,   7, 
-      0,   0,  71,   0,   0, 128, 
-    104,   7,   0,   0,  71,   0, 
-      0,   0, 108,   7,   0,   0, 
-     71,   0,   0, 128, 108,   7, 
-      0,   0,  71,   0,   0,   0, 
-    112,   7,   0,   0,  73,   0, 
-      0, 128, 112,   7,   0,   0, 
-     73,   0,   0,   0, 136,   7, 
-      0,   0,  73,   0,   0, 128, 
-    136,   7,   0,   0,  73,   0, 
-      0,   0, 164,   7,   0,   0, 
-     73,   0,   0, 128, 164,   7, 
-      0,   0,  73,   0,   0,   0, 
-    184,   7,   0,   0,  73,   0, 
-      0, 128, 184,   7,   0,   0, 
-     73,   0,   0,   0, 212,   7, 
-      0,   0,  74,   0,   0, 128, 
-    212,   7,   0,   0,  74,   0, 
-      0,   0, 240,   7,   0,   0, 
-     74,   0,   0, 128, 240,   7, 
-      0,   0,  74,   0,   0,   0, 
-     12,   8,   0,   0,  75,   0, 
-      0, 128,  12,   8,   0,   0, 
-     75,   0,   0,   0,  40,   8, 
-      0,   0,  77,   0,   0, 128, 
-     40,   8,   0,   0,  77,   0, 
-      0,   0,  60,   8,   0,   0, 
-     78,   0,   0, 128,  60,   8, 
-      0,   0,  78,   0,   0,   0, 
-     88,   8,   0,   0,  79,   0, 
-      0, 128,  88,   8,   0,   0, 
-     79,   0,   0,   0, 120,   8, 
-      0,   0,  79,   0,   0, 128, 
-    120,   8,   0,   0,  79,   0, 
-      0,   0, 148,   8,   0,   0, 
-     80,   0,   0, 128, 148,   8, 
-      0,   0,  80,   0,   0,   0, 
-    180,   8,   0,   0,  82,   0, 
-      0, 128, 180,   8,   0,   0, 
-     82,   0,   0,   0, 200,   8, 
-      0,   0,  82,   0,   0, 128, 
-    200,   8,   0,   0,  82,   0, 
-      0,   0, 220,   8,   0,   0, 
-     82,   0,   0, 128, 220,   8, 
-      0,   0,  82,   0,   0,   0, 
-      5,   0,  89,   0,  32,   0, 
-     88,   0,   5,   0,  89,   0, 
-     32,   0,  88,   0,   5,   0, 
-     89,   0,  32,   0,  88,   0, 
-      5,   0,  89,   0,  32,   0, 
-     88,   0,   5,   0,  89,   0, 
-     32,   0,  88,   0,   5,   0, 
-     88,   0,  31,   0,  87,   0, 
-      5,   0,  88,   0,  31,   0, 
-     87,   0,   5,   0,  88,   0, 
-     31,   0,  87,   0,   5,   0, 
-     88,   0,  31,   0,  87,   0, 
-      5,   0,  88,   0,  31,   0, 
-     87,   0,   5,   0,  88,   0, 
-     31,   0,  87,   0,   5,   0, 
-     81,   0,  28,   0,  80,   0, 
-      5,   0,  81,   0,  28,   0, 
-     80,   0,   5,   0,  81,   0, 
-     28,   0,  80,   0,   5,   0, 
-     81,   0,  28,   0,  80,   0, 
-      5,   0,  81,   0,  28,   0, 
-     80,   0,   5,   0,  44,   0, 
-     17,   0,  43,   0,   5,   0, 
-     55,   0,  18,   0,  54,   0, 
-      5,   0,  55,   0,  18,   0, 
-     54,   0,   5,   0,  82,   0, 
-     29,   0,  68,   0,   5,   0, 
-     82,   0,  28,   0,  81,   0, 
-      5,   0,  85,   0,  30,   0, 
-     71,   0,   5,   0,  85,   0, 
-     29,   0,  84,   0,   5,   0, 
-     73,   0,  26,   0,  59,   0, 
-      5,   0,  73,   0,  25,   0, 
-     72,   0,   5,   0,  26,   0, 
-     11,   0,  25,   0,   5,   0, 
-     83,   0,   9,   0,  43,   0, 
-      5,   0,  83,   0,  48,   0, 
-     82,   0,   5,   0,  83,   0, 
-      9,   0,  82,   0,   5,   0, 
-     83,   0,   5,   0,  83,   0, 
-      9,   0,  52,   0,  25,   0, 
-     50,   0,   9,   0,  52,   0, 
-     25,   0,  50,   0,   9,   0, 
-     52,   0,  15,   0,  51,   0, 
-      9,   0,  52,   0,  15,   0, 
-     51,   0,   9,   0,  52,   0, 
-     15,   0,  51,   0,   5,   0, 
-      5,   0,   5,   0,   5,   0, 
-     12,   0,  82,   0,  16,   0, 
-     46,   0,  12,   0,  82,   0, 
-     51,   0,  81,   0,  12,   0, 
-     82,   0,  16,   0,  81,   0, 
-     12,   0,  82,   0,  12,   0, 
-     82,   0,   9,   0,  56,   0, 
-     25,   0,  54,   0,   9,   0, 
-     56,   0,  25,   0,  54,   0, 
-      9,   0,  56,   0,  15,   0, 
-     55,   0,   9,   0,  56,   0, 
-     15,   0,  55,   0,   9,   0, 
-     56,   0,  15,   0,  55,   0, 
-      5,   0,   5,   0,   5,   0, 
-      5,   0,   9,   0,  64,   0, 
-     33,   0,  62,   0,   9,   0, 
-     64,   0,  33,   0,  62,   0, 
-      9,   0,  64,   0,  23,   0, 
-     63,   0,   9,   0,  64,   0, 
-     23,   0,  63,   0,   9,   0, 
-     64,   0,  23,   0,  63,   0, 
-      9,   0,  23,   0,  13,   0, 
-     22,   0,   9,   0,  23,   0, 
-      9,   0,  23,   0,  13,   0, 
-     64,   0,  37,   0,  62,   0, 
-     13,   0,  64,   0,  37,   0, 
-     62,   0,  13,   0,  64,   0, 
-     27,   0,  63,   0,  13,   0, 
-     64,   0,  27,   0,  63,   0, 
-     13,   0,  64,   0,  27,   0, 
-     63,   0,  13,   0,  52,   0, 
-     40,   0,  50,   0,  13,   0, 
-     52,   0,  30,   0,  51,   0, 
-     13,   0,  52,   0,  30,   0, 
-     51,   0,  13,   0,  52,   0, 
-     30,   0,  51,   0,  13,   0, 
-     50,   0,  34,   0,  40,   0, 
-     13,   0,  50,   0,  20,   0, 
-     49,   0,  13,   0,  57,   0, 
-     35,   0,  44,   0,  13,   0, 
-     57,   0,  20,   0,  56,   0, 
-     13,   0,  26,   0,  13,   0, 
-     25,   0,  13,   0,  47,   0, 
-     31,   0,  46,   0,  13,   0, 
-     47,   0,  19,   0,  46,   0, 
-      9,   0,   9,   0,   9,   0, 
-      9,   0,  13,   0,  23,   0, 
-     13,   0,  22,   0,   9,   0, 
-      9,   0,   9,   0,   9,   0, 
-      5,   0,   5,   0,   5,   0, 
-      5,   0,   5,   0,   5,   0, 
-      5,   0,   5,   0,   5,   0, 
-     53,   0,  38,   0,  43,   0, 
-      5,   0,  53,   0,  21,   0, 
-     52,   0,   5,   0,  53,   0, 
-     21,   0,  52,   0,   5,   0, 
-     53,   0,  21,   0,  52,   0, 
-      5,   0,  25,   0,  15,   0, 
-     24,   0,   5,   0,  25,   0, 
-      5,   0,  24,   0,   5,   0, 
-     28,   0,   5,   0,  27,   0, 
-      5,   0,  46,   0,  17,   0, 
-     45,   0,   5,   0,  47,   0, 
-     27,   0,  46,   0,   5,   0, 
-     66,   0,  20,   0,  65,   0, 
-      5,   0,  66,   0,  20,   0, 
-     65,   0,   5,   0,  43,   0, 
-      5,   0,  42,   0,   5,   0, 
-     15,   0,   5,   0,  15,   0, 
-      5,   0,  15,   0,   5,   0, 
-     15,   0,   5,   0,  15,   0, 
-      5,   0,  15,   0, 246,   0, 
-      0,   0,   4,   0,   0,   0, 
-      0,   0,   0,   0,  20,   0, 
-      0,   0,   0,   0,   0,   0, 
-     32,   0,   0,   0,  64,   0, 
-      0,   0, 112,   0,   0,   0, 
-    144,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,  11, 202, 
-     49,   1,  56,   0,   0,   0, 
-      0,  16,   0,   0,  20,  16, 
-      0,   0, 196,   1,   0,   0, 
-     11,   0, 255, 255,   4,   0, 
-      0,   0, 255, 255,   3,   0, 
-      0,   0,   0,   0,  80,   0, 
-      0,   0,  80,   0,   0,   0, 
-      8,   0,   0,   0,  88,   0, 
-      0,   0,   0,   0,   0,   0, 
-     22,   0,  27,  21,  64,   0, 
-      0,   0,   3,   0,   0,   0, 
-     12,   0, 102, 108, 111,  97, 
-    116,  51,   0, 243, 242, 241, 
-     78,   0,   3,  18,  13,  21, 
-      3,   0,   0,  16,   0,   0, 
-      0,   0, 112, 111, 115, 105, 
-    116, 105, 111, 110,   0, 241, 
-     13,  21,   3,   0,   0,  16, 
-      0,   0,  12,   0, 112, 114, 
-    101, 118, 105, 111, 117, 115, 
-      0, 241,  13,  21,   3,   0, 
-      0,  16,   0,   0,  24,   0, 
-    110, 101, 120, 116,   0, 241, 
-     13,  21,   3,   0,   0,  16, 
-      0,   0,  36,   0, 100, 105, 
-    114, 101,  99, 116, 105, 111, 
-    110,   0,  34,   0,   5,  21, 
-      4,   0,   0,   0,   1,  16, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,  48,   0, 
-     86, 101, 114, 116, 101, 120, 
-     68,  97, 116,  97,   0, 243, 
-    242, 241,  10,   0,   1,  18, 
-      1,   0,   0,   0,   2,  16, 
-      0,   0,  22,   0,  27,  21, 
-     64,   0,   0,   0,   4,   0, 
-      0,   0,  16,   0, 102, 108, 
-    111,  97, 116,  52,   0, 243, 
-    242, 241,  38,   0,   3,  18, 
-     13,  21,   3,   0,   4,  16, 
-      0,   0,   0,   0,  99, 111, 
-    108, 111, 114,   0,  13,  21, 
-      3,   0,   4,  16,   0,   0, 
-     16,   0, 112, 111, 115, 105, 
-    116, 105, 111, 110,   0, 241, 
-     42,   0,   5,  21,   2,   0, 
-      0,   0,   5,  16,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,  32,   0,  86, 101, 
-    114, 116, 101, 120,  83, 104, 
-     97, 100, 101, 114,  79, 117, 
-    116, 112, 117, 116,   0, 243, 
-    242, 241,  10,   0,  24,  21, 
-      6,  16,   0,   0,   1,   0, 
-      1,   0,  14,   0,   8,  16, 
-      7,  16,   0,   0,  23,   0, 
-      1,   0,   3,  16,   0,   0, 
-     10,   0,  24,  21,  64,   0, 
-      0,   0,   1,   0,   1,   0, 
-     22,   0,  27,  21,  64,   0, 
-      0,   0,   2,   0,   0,   0, 
-      8,   0, 102, 108, 111,  97, 
-    116,  50,   0, 243, 242, 241, 
-     10,   0,  24,  21,  10,  16, 
-      0,   0,   1,   0,   1,   0, 
-     10,   0,  24,  21,   0,  16, 
-      0,   0,   1,   0,   1,   0, 
-     10,   0,  24,  21,  12,  16, 
-      0,   0,   1,   0,   0,   2, 
-     30,   0,  28,  21,  64,   0, 
-      0,   0,   4,   0,   0,   0, 
-      4,   0,   0,   0,  16,   0, 
-      0,   0,   0,  64,   0, 102, 
-    108, 111,  97, 116,  52, 120, 
-     52,   0,  10,   0,  24,  21, 
-     14,  16,   0,   0,   1,   0, 
-      1,   0,  10,   0,  24,  21, 
-     15,  16,   0,   0,   1,   0, 
-      0,   2,  10,   0,  24,  21, 
-      9,  16,   0,   0,   1,   0, 
-      0,   2,  10,   0,  24,  21, 
-    116,   0,   0,   0,   1,   0, 
-      1,   0,  10,   0,  24,  21, 
-     18,  16,   0,   0,   1,   0, 
-      0,   2,   0,   0,   0,   0, 
-     11, 202,  49,   1,  56,   0, 
-      0,   0,   0,  16,   0,   0, 
-      0,  16,   0,   0,   0,   0, 
-      0,   0,  12,   0, 255, 255, 
-      4,   0,   0,   0, 255, 255, 
-      3,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0, 111, 110,  77,  97, 
-    116, 114, 105, 120,  41,  59, 
-     13,  10,  32,  32,  32,  32, 
-     47,  47, 102, 108, 111,  97, 
-    116,  52,  32,  99, 117, 114, 
-    114, 101, 110, 116,  80, 114, 
-    111, 106, 101,  99, 116, 101, 
-    100,  32,  61,  32, 109, 117, 
-    108,  40, 102, 108, 111,  97, 
-    116,  52,  40,  99, 117, 114, 
-    114, 101, 110, 116,  87, 111, 
-    114, 108, 100,  44,  32,  49, 
-     46,  48,  41,  44,  32, 118, 
-    105, 101, 119,  80, 114, 111, 
-    106, 101,  99, 116, 105, 111, 
-    110,  77,  97, 116, 114, 105, 
-    120,  41,  59,  13,  10,  32, 
-     32,  32,  32,  47,  47, 102, 
-    108, 111,  97, 116,  52,  32, 
-    110, 101, 120, 116,  80, 114, 
-    111, 106, 101,  99, 116, 101, 
-    100,  32,  61,  32, 109, 117, 
-    108,  40, 102, 108, 111,  97, 
-    116,  52,  40, 110, 101, 120, 
-    116,  87, 111, 114, 108, 100, 
-     44,  32,  49,  46,  48,  41, 
-     44,  32, 118, 105, 101, 119, 
-     80, 114, 111, 106, 101,  99, 
-    116, 105, 111, 110,  77,  97, 
-    116, 114, 105, 120,  41,  59, 
-     13,  10,  13,  10,  32,  32, 
-     32,  32, 102, 108, 111,  97, 
-    116,  52,  32, 112, 114, 101, 
-    118, 105, 111, 117, 115,  80, 
-    114, 111, 106, 101,  99, 116, 
-    101, 100,  32,  61,  32, 109, 
-    117, 108,  40, 102, 108, 111, 
-     97, 116,  52,  40,  73,  78, 
-     46, 112, 114, 101, 118, 105, 
-    111, 117, 115,  44,  32,  49, 
-     46,  48, 102,  41,  44,  32, 
-    109, 111, 100, 101, 108,  86, 
-    105, 101, 119,  80, 114, 111, 
-    106, 101,  99, 116, 105, 111, 
-    110,  77,  97, 116, 114, 105, 
-    120,  41,  59,  13,  10,  32, 
-     32,  32,  32, 102, 108, 111, 
-     97, 116,  52,  32,  99, 117, 
-    114, 114, 101, 110, 116,  80, 
-    114, 111, 106, 101,  99, 116, 
-    101, 100,  32,  61,  32, 109, 
-    117, 108,  40, 102, 108, 111, 
-     97, 116,  52,  40,  73,  78, 
-     46, 112, 111, 115, 105, 116, 
-    105, 111, 110,  44,  32,  49, 
-     46,  48, 102,  41,  44,  32, 
-    109, 111, 100, 101, 108,  86, 
-    105, 101, 119,  80, 114, 111, 
-    106, 101,  99, 116, 105, 111, 
-    110,  77,  97, 116, 114, 105, 
-    120,  41,  59,  13,  10,  32, 
-     32,  32,  32, 102, 108, 111, 
-     97, 116,  52,  32, 110, 101, 
-    120, 116,  80, 114, 111, 106, 
-    101,  99, 116, 101, 100,  32, 
-     61,  32, 109, 117, 108,  40, 
-    102, 108, 111,  97, 116,  52, 
-     40,  73,  78,  46, 110, 101, 
-    120, 116,  44,  32,  49,  46, 
-     48, 102,  41,  44,  32, 109, 
-    111, 100, 101, 108,  86, 105, 
-    101, 119,  80, 114, 111, 106, 
-    101,  99, 116, 105, 111, 110, 
-     77,  97, 116, 114, 105, 120, 
-     41,  59,  13,  10,  13,  10, 
-     32,  32,  32,  32,  99, 111, 
-    110, 115, 116,  32, 102, 108, 
-    111,  97, 116,  32,  97, 115, 
-    112, 101,  99, 116,  82,  97, 
-    116, 105, 111,  32,  61,  32, 
-     99, 108, 105, 101, 110, 116, 
-     68,  97, 116,  97,  91,  50, 
-     93,  59,  13,  10,  32,  32, 
-     32,  32,  99, 111, 110, 115, 
-    116,  32, 102, 108, 111,  97, 
-    116,  50,  32,  97, 115, 112, 
-    101,  99, 116,  86, 101,  99, 
-     32,  61,  32, 102, 108, 111, 
-     97, 116,  50,  40,  97, 115, 
-    112, 101,  99, 116,  82,  97, 
-    116, 105, 111,  44,  32,  49, 
-     46,  48, 102,  41,  59,  13, 
-     10,  32,  32,  32,  32,  47, 
-     47, 103, 101, 116,  32,  50, 
-     68,  32, 115,  99, 114, 101, 
-    101, 110,  32, 115, 112,  97, 
-     99, 101,  32, 119, 105, 116, 
-    104,  32,  87,  32, 100, 105, 
-    118, 105, 100, 101,  32,  97, 
-    110, 100,  32,  97, 115, 112, 
-    101,  99, 116,  32,  99, 111, 
-    114, 114, 101,  99, 116, 105, 
-    111, 110,  13,  10,  32,  32, 
-     32,  32, 102, 108, 111,  97, 
-    116,  50,  32,  99, 117, 114, 
-    114, 101, 110, 116,  83,  99, 
-    114, 101, 101, 110,  32,  61, 
-     32,  40,  99, 117, 114, 114, 
-    101, 110, 116,  80, 114, 111, 
-    106, 101,  99, 116, 101, 100, 
-     46, 120, 121,  32,  47,  32, 
-     99, 117, 114, 114, 101, 110, 
-    116,  80, 114, 111, 106, 101, 
-     99, 116, 101, 100,  46, 119, 
-     41,  32,  42,  32,  97, 115, 
-    112, 101,  99, 116,  86, 101, 
-     99,  59,  13,  10,  32,  32, 
-     32,  32, 102, 108, 111,  97, 
-    116,  50,  32, 112, 114, 101, 
-    118, 105, 111, 117, 115,  83, 
-     99, 114, 101, 101, 110,  32, 
-     61,  32,  40, 112, 114, 101, 
-    118, 105, 111, 117, 115,  80, 
-    114, 111, 106, 101,  99, 116, 
-    101, 100,  46, 120, 121,  32, 
-     47,  32, 112, 114, 101, 118, 
-    105, 111, 117, 115,  80, 114, 
-    111, 106, 101,  99, 116, 101, 
-    100,  46, 119,  41,  32,  42, 
-     32,  97, 115, 112, 101,  99, 
-    116,  86, 101,  99,  59,  13, 
-     10,  32,  32,  32,  32, 102, 
-    108, 111,  97, 116,  50,  32, 
-    110, 101, 120, 116,  83,  99, 
-    114, 101, 101, 110,  32,  61, 
-     32,  40, 110, 101, 120, 116, 
-     80, 114, 111, 106, 101,  99, 
-    116, 101, 100,  46, 120, 121, 
-     32,  47,  32, 110, 101, 120, 
-    116,  80, 114, 111, 106, 101, 
-     99, 116, 101, 100,  46, 119, 
-     41,  32,  42,  32,  97, 115, 
-    112, 101,  99, 116,  86, 101, 
-     99,  59,  13,  10,  13,  10, 
-     32,  32,  32,  32,  47,  47, 
-     32,  79,  85,  84,  46,  99, 
-    111, 108, 111, 114,  32,  61, 
-     32, 102, 108, 111,  97, 116, 
-     52,  40,  40,  99, 117, 114, 
-    114, 101, 110, 116,  83,  99, 
-    114, 101, 101, 110,  46, 120, 
-     43,  49,  46,  48,  41,  47, 
-     50,  46,  48,  44,  32,  40, 
-     99, 117, 114, 114, 101, 110, 
-    116,  83,  99, 114, 101, 101, 
-    110,  46, 121,  43,  49,  46, 
-     48,  41,  47,  50,  46,  48, 
-    102,  44,  32,  48,  46,  48, 
-     44,  32,  49,  46,  48,  41, 
-     59,  13,  10,  13,  10,  32, 
-     32,  32,  32, 102, 108, 111, 
-     97, 116,  32, 108, 101, 110, 
-     32,  61,  32, 116, 104, 105, 
-     99, 107, 110, 101, 115, 115, 
-     59,  13,  10,  13,  10,  32, 
-     32,  32,  32,  47,  47,  32, 
-     78,  79,  84,  69,  58,  32, 
-    115, 116,  97, 114, 116, 105, 
-    110, 103,  32, 112, 111, 105, 
-    110, 116,  32, 117, 115, 101, 
-    115,  32,  40, 110, 101, 120, 
-    116,  32,  45,  32,  99, 117, 
-    114, 114, 101, 110, 116,  41, 
-     13,  10,  32,  32,  32,  32, 
-    102, 108, 111,  97, 116,  50, 
-     32, 100, 105, 114,  32,  61, 
-     32, 102, 108, 111,  97, 116, 
-     50,  40,  48,  46,  48, 102, 
-     44,  32,  48,  46,  48, 102, 
-     41,  59,  13,  10,  32,  32, 
-     32,  32, 105, 102,  32,  40, 
-     99, 117, 114, 114, 101, 110, 
-    116,  83,  99, 114, 101, 101, 
-    110,  46, 120,  32,  61,  61, 
-     32, 112, 114, 101, 118, 105, 
-    111, 117, 115,  83,  99, 114, 
-    101, 101, 110,  46, 120,  32, 
-     38,  38,  32,  99, 117, 114, 
-    114, 101, 110, 116,  83,  99, 
-    114, 101, 101, 110,  46, 121, 
-     32,  61,  61,  32, 112, 114, 
-    101, 118, 105, 111, 117, 115, 
-     83,  99, 114, 101, 101, 110, 
-     46, 121,  41,  32, 123,  13, 
-     10,  32,  32,  32,  32,  32, 
-     32,  32,  32, 100, 105, 114, 
-     32,  61,  32, 110, 111, 114, 
-    109,  97, 108, 105, 122, 101, 
-     40, 110, 101, 120, 116,  83, 
-     99, 114, 101, 101, 110,  32, 
-     45,  32,  99, 117, 114, 114, 
-    101, 110, 116,  83,  99, 114, 
-    101, 101, 110,  41,  59,  13, 
-     10,  32,  32,  32,  32, 125, 
-     32, 101, 108, 115, 101,  32, 
-    105, 102,  32,  40,  99, 117, 
-    114, 114, 101, 110, 116,  83, 
-     99, 114, 101, 101, 110,  46, 
-    120,  32,  61,  61,  32, 110, 
-    101, 120, 116,  83,  99, 114, 
-    101, 101, 110,  46, 120,  32, 
-     38,  38,  32,  99, 117, 114, 
-    114, 101, 110, 116,  83,  99, 
-    114, 101, 101, 110,  46, 121, 
-     32,  61,  61,  32, 110, 101, 
-    120, 116,  83,  99, 114, 101, 
-    101, 110,  46, 121,  41,  32, 
-    123,  32,  47,  47, 101, 110, 
-    100, 105, 110, 103,  32, 112, 
-    111, 105, 110, 116,  32, 117, 
-    115, 101, 115,  32,  40,  99, 
-    117, 114, 114, 101, 110, 116, 
-     32,  45,  32, 112, 114, 101, 
-    118, 105, 111, 117, 115,  41, 
-     13,  10,  32,  32,  32,  32, 
-     32,  32,  32,  32, 100, 105, 
-    114,  32,  61,  32, 110, 111, 
-    114, 109,  97, 108, 105, 122, 
-    101,  40,  99, 117, 114, 114, 
-    101, 110, 116,  83,  99, 114, 
-    101, 101, 110,  32,  45,  32, 
-    112, 114, 101, 118, 105, 111, 
-    117, 115,  83,  99, 114, 101, 
-    101, 110,  41,  59,  13,  10, 
-     32,  32,  32,  32, 125,  32, 
-    101, 108, 115, 101,  32, 123, 
-     13,  10,  32,  32,  32,  32, 
-     32,  32,  32,  32,  47,  47, 
-     32,  78,  79,  84,  69,  58, 
-     32, 115, 111, 109, 101, 119, 
-    104, 101, 114, 101,  32, 105, 
-    110,  32, 109, 105, 100, 100, 
-    108, 101,  44,  32, 110, 101, 
-    101, 100, 115,  32,  97,  32, 
-    106, 111, 105, 110,  13,  10, 
-     32,  32,  32,  32,  32,  32, 
-     32,  32,  47,  47,  32,  78, 
-     79,  84,  69,  58,  32, 103, 
-    101, 116,  32, 100, 105, 114, 
-     32, 102, 114, 111, 109,  32, 
-     40,  67,  32,  45,  32,  66, 
-     41,  32,  97, 110, 100,  32, 
-     40,  66,  32,  45,  32,  65, 
-     41,  13,  10,  32,  32,  32, 
-     32,  32,  32,  32,  32, 102, 
-    108, 111,  97, 116,  50,  32, 
-    100, 105, 114,  65,  32,  61, 
-     32, 110, 111, 114, 109,  97, 
-    108, 105, 122, 101,  40,  99, 
-    117, 114, 114, 101, 110, 116, 
-     83,  99, 114, 101, 101, 110, 
-     32,  45,  32, 112, 114, 101, 
-    118, 105, 111, 117, 115,  83, 
-     99, 114, 101, 101, 110,  41, 
-     59,  13,  10,  32,  32,  32, 
-     32,  32,  32,  32,  32, 105, 
-    102,  32,  40, 109, 105, 116, 
-    101, 114,  32,  61,  61,  32, 
-     49,  41,  32, 123,  13,  10, 
-     32,  32,  32,  32,  32,  32, 
-     32,  32,  32,  32,  32,  32, 
-    102, 108, 111,  97, 116,  50, 
-     32, 100, 105, 114,  66,  32, 
-     61,  32, 110, 111, 114, 109, 
-     97, 108, 105, 122, 101,  40, 
-    110, 101, 120, 116,  83,  99, 
-    114, 101, 101, 110,  32,  45, 
-     32,  99, 117, 114, 114, 101, 
-    110, 116,  83,  99, 114, 101, 
-    101, 110,  41,  59,  13,  10, 
-     13,  10,  32,  32,  32,  32, 
-     32,  32,  32,  32,  32,  32, 
-     32,  32, 102, 108, 111,  97, 
-    116,  50,  32, 116,  97, 110, 
-    103, 101, 110, 116,  32,  61, 
-     32, 110, 111, 114, 109,  97, 
-    108, 105, 122, 101,  40, 100, 
-    105, 114,  65,  32,  43,  32, 
-    100, 105, 114,  66,  41,  59, 
-     13,  10,  32,  32,  32,  32, 
-     32,  32,  32,  32,  32,  32, 
-     32,  32, 102, 108, 111,  97, 
-    116,  50,  32, 112, 101, 114, 
-    112,  32,  61,  32, 102, 108, 
-    111,  97, 116,  50,  40,  45, 
-    100, 105, 114,  65,  46, 121, 
-     44,  32, 100, 105, 114,  65, 
-     46, 120,  41,  59,  13,  10, 
-     32,  32,  32,  32,  32,  32, 
-     32,  32,  32,  32,  32,  32, 
-    102, 108, 111,  97, 116,  50, 
-     32, 109, 105, 116, 101, 114, 
-     32,  61,  32, 102, 108, 111, 
-     97, 116,  50,  40,  45, 116, 
-     97, 110, 103, 101, 110, 116, 
-     46, 121,  44,  32, 116,  97, 
-    110, 103, 101, 110, 116,  46, 
-    120,  41,  59,  13,  10,  32, 
-     32,  32,  32,  32,  32,  32, 
-     32,  32,  32,  32,  32, 100, 
-    105, 114,  32,  61,  32, 116, 
-     97, 110, 103, 101, 110, 116, 
-     59,  13,  10,  32,  32,  32, 
-     32,  32,  32,  32,  32,  32, 
-     32,  32,  32, 108, 101, 110, 
-     32,  61,  32, 116, 104, 105, 
-     99, 107, 110, 101, 115, 115, 
-     32,  47,  32, 100, 111, 116, 
-     40, 109, 105, 116, 101, 114, 
-     44,  32, 112, 101, 114, 112, 
-     41,  59,  13,  10,  32,  32, 
-     32,  32,  32,  32,  32,  32, 
-    125,  32, 101, 108, 115, 101, 
-     32, 123,  13,  10,  32,  32, 
-     32,  32,  32,  32,  32,  32, 
-     32,  32,  32,  32, 100, 105, 
-    114,  32,  61,  32, 100, 105, 
-    114,  65,  59,  13,  10,  32, 
-     32,  32,  32,  32,  32,  32, 
-     32, 125,  13,  10,  32,  32, 
-     32,  32, 125,  13,  10,  13, 
-     10,  32,  32,  32,  32, 102, 
-    108, 111,  97, 116,  50,  32, 
-    110, 111, 114, 109,  97, 108, 
-     32,  61,  32, 110, 111, 114, 
-    109,  97, 108, 105, 122, 101, 
-     40, 102, 108, 111,  97, 116, 
-     50,  40,  45, 100, 105, 114, 
-     46, 121,  44,  32, 100, 105, 
-    114,  46, 120,  41,  41,  59, 
-     13,  10,  32,  32,  32,  32, 
-    110, 111, 114, 109,  97, 108, 
-     32,  42,  61,  32, 108, 101, 
-    110,  32,  42,  32,  48,  46, 
-     53, 102,  59,  13,  10,  32, 
-     32,  32,  32, 110, 111, 114, 
-    109,  97, 108,  46, 120,  32, 
-     47,  61,  32,  97, 115, 112, 
-    101,  99, 116,  82,  97, 116, 
-    105, 111,  59,  13,  10,  13, 
-     10,  32,  32,  32,  32,  99, 
-    111, 110, 115, 116,  32, 102, 
-    108, 111,  97, 116,  32, 111, 
-    114, 105, 101, 110, 116,  97, 
-    116, 105, 111, 110,  32,  61, 
-     32,  73,  78,  46, 100, 105, 
-    114, 101,  99, 116, 105, 111, 
-    110,  91,  48,  93,  59,  13, 
-     10,  32,  32,  32,  32,  99, 
-    111, 110, 115, 116,  32, 102, 
-    108, 111,  97, 116,  50,  32, 
-    111, 102, 102, 115, 101, 116, 
-     32,  61,  32, 110, 111, 114, 
-    109,  97, 108,  32,  42,  32, 
-    111, 114, 105, 101, 110, 116, 
-     97, 116, 105, 111, 110,  59, 
-     13,  10,  32,  32,  32,  32, 
-     79,  85,  84,  46, 112, 111, 
-    115, 105, 116, 105, 111, 110, 
-     32,  61,  32,  99, 117, 114, 
-    114, 101, 110, 116,  80, 114, 
-    111, 106, 101,  99, 116, 101, 
-    100,  32,  43,  32, 102, 108, 
-    111,  97, 116,  52,  40, 111, 
-    102, 102, 115, 101, 116,  46, 
-    120, 121,  44,  32,  48,  46, 
-     48,  44,  32,  48,  46,  48, 
-     41,  59,  13,  10,  32,  32, 
-     32,  32,  79,  85,  84,  46, 
-     99, 111, 108, 111, 114,  32, 
-     61,  32, 102, 108, 111,  97, 
-    116,  52,  40,  48,  46,  57, 
-     44,  32,  48,  46,  57,  44, 
-     32,  48,  46,  57,  44,  32, 
-     49,  46,  48,  41,  59,  13, 
-     10,  13,  10,  32,  32,  32, 
-     32, 114, 101, 116, 117, 114, 
-    110,  32,  79,  85,  84,  59, 
-     13,  10, 125,   0,  99,  98, 
-    117, 102, 102, 101, 114,  32, 
-     80, 101, 114,  65, 112, 112, 
-    108, 105,  99,  97, 116, 105, 
-    111, 110,  32,  58,  32, 114, 
-    101, 103, 105, 115, 116, 101, 
-    114,  40,  98,  48,  41,  32, 
-    123,  13,  10,   9, 109,  97, 
-    116, 114, 105, 120,  32, 112, 
-    114, 111, 106, 101,  99, 116, 
-    105, 111, 110,  77,  97, 116, 
-    114, 105, 120,  59,  13,  10, 
-      9, 102, 108, 111,  97, 116, 
-     51,  32,  99, 108, 105, 101, 
-    110, 116,  68,  97, 116,  97, 
-     59,  13,  10, 125,  13,  10, 
-     13,  10,  99,  98, 117, 102, 
-    102, 101, 114,  32,  80, 101, 
-    114,  70, 114,  97, 109, 101, 
-     32,  58,  32, 114, 101, 103, 
-    105, 115, 116, 101, 114,  40, 
-     98,  49,  41,  32, 123,  13, 
-     10,   9, 109,  97, 116, 114, 
-    105, 120,  32, 118, 105, 101, 
-    119,  77,  97, 116, 114, 105, 
-    120,  59,  13,  10,   9, 102, 
-    108, 111,  97, 116,  51,  32, 
-    101, 121, 101,  80, 111, 115, 
-     59,  13,  10,   9, 102, 108, 
-    111,  97, 116,  51,  32, 108, 
-    105, 103, 104, 116,  80, 111, 
-    115,  59,  13,  10, 125,  13, 
-     10,  13,  10,  99,  98, 117, 
-    102, 102, 101, 114,  32,  80, 
-    101, 114,  79,  98, 106, 101, 
-     99, 116,  32,  58,  32, 114, 
-    101, 103, 105, 115, 116, 101, 
-    114,  40,  98,  50,  41,  32, 
-    123,  13,  10,   9, 109,  97, 
-    116, 114, 105, 120,  32, 109, 
-    111, 100, 101, 108,  77,  97, 
-    116, 114, 105, 120,  59,  13, 
-     10,   9, 109,  97, 116, 114, 
-    105, 120,  32, 118, 105, 101, 
-    119,  80, 114, 111, 106, 101, 
-     99, 116, 105, 111, 110,  77, 
-     97, 116, 114, 105, 120,  59, 
-     13,  10,   9, 109,  97, 116, 
-    114, 105, 120,  32, 109, 111, 
-    100, 101, 108,  86, 105, 101, 
-    119,  80, 114, 111, 106, 101, 
-     99, 116, 105, 111, 110,  77, 
-     97, 116, 114, 105, 120,  59, 
-     13,  10, 125,   0,  11,   0, 
-      0,   0,  14,  13,   0,   0, 
-     62,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   1,   0,   0, 
-      1,   0,   0,   0,  63,   0, 
-      0,   0, 124,   0,   0,   0, 
-    190,   0,   0,   0,   7,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,  68,  51,  68,  83, 
-     72,  68,  82,   0, 224,   8, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,  32,   0,   0,  96, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0, 255, 255, 
-    255, 255,  26,   9,  47, 241, 
-     40,   0,   0,   0,  24,   2, 
-      0,   0, 145,   0,   0,   0, 
-      1,   0,   0,   0, 113,   0, 
-      0,   0,   1,   0,   0,   0, 
-     33,   0,   0,   0,   1,   0, 
-      0,   0,  65,   0,   0,   0, 
-      1,   0,   0,   0,   1,   0, 
-      0,   0,   1,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   4, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      4,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0, 128, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,  32,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0, 128,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,  12,   0, 
-      0,   0,  24,   0,   0,   0, 
-     36,   0,   0,   0,  48,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,  30,   0,  37,  17, 
-      0,   0,   0,   0, 140,   0, 
-      0,   0,   1,   0,  76, 105, 
-    110, 101,  86, 101, 114, 116, 
-    101, 120,  83, 104,  97, 100, 
-    101, 114,   0,   0,  30,   0, 
-     81,  17,  13,  16,   0,   0, 
-      8,   0,   0,   0,  64,   0, 
-    255, 255, 255, 255, 255, 255, 
-     99, 108, 105, 101, 110, 116, 
-     68,  97, 116,  97,   0,   0, 
-     46,   0,  81,  17,  16,  16, 
-      0,   0,   8,   0,   2,   0, 
-    128,   0, 255, 255, 255, 255, 
-    255, 255, 109, 111, 100, 101, 
-    108,  86, 105, 101, 119,  80, 
-    114, 111, 106, 101,  99, 116, 
-    105, 111, 110,  77,  97, 116, 
-    114, 105, 120,   0,   0,   0, 
-     30,   0,  81,  17,  17,  16, 
-      0,   0,   8,   0,   3,   0, 
-      0,   0, 255, 255, 255, 255, 
-    255, 255, 116, 104, 105,  99, 
-    107, 110, 101, 115, 115,   0, 
-      0,   0,  26,   0,  81,  17, 
-     19,  16,   0,   0,   8,   0, 
-      3,   0,   4,   0, 255, 255, 
-    255, 255, 255, 255, 109, 105, 
-    116, 101, 114,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,  16,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0, 255, 255, 255, 255, 
-     26,   9,  47, 241,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-    255, 255, 255, 255, 119,   9, 
-     49,   1,   1,   0,   0,   0, 
-     14,   0,  20, 142,  15,   0, 
-     20, 107,  16,   0,   1,   0, 
-     88,   0,   0,   0,  32,   0, 
-      0,   0,  44,   0,   0,   0, 
-    144,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-     22,   0,   0,   0,  25,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   1,   0,   0,   0, 
-      0,   0,   0,   0, 224,   8, 
-      0,   0,  32,   0,   0,  96, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      2,   0,  10,   0, 124,  11, 
-      0,   0,   0,   0,   0,   0, 
-    188,   8,   0,   0,   2,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,  76, 105, 110, 101, 
-     86, 101, 114, 116, 101, 120, 
-     83, 104,  97, 100, 101, 114, 
-      0, 110, 111, 110, 101,   0, 
-      0,   0,  45, 186,  46, 241, 
-      1,   0,   0,   0,   0,   0, 
-      0,   0, 224,   8,   0,   0, 
-     32,   0,   0,  96,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   2,   0, 
-      2,   0,   7,   0,   0,   0, 
-      0,   0,   1,   0, 255, 255, 
-    255, 255,   0,   0,   0,   0, 
-    224,   8,   0,   0,   8,   2, 
-      0,   0,   0,   0,   0,   0, 
-    255, 255, 255, 255,   0,   0, 
-      0,   0, 255, 255, 255, 255, 
-      1,   0,   2,   0,   0,   0, 
-      2,   0,   0,   0,   0,   0, 
-     61,   0,   0,   0,  69,  58, 
-     92,  80, 114, 111, 106, 101, 
-     99, 116, 115,  92,  78, 105, 
-     99, 107, 101, 108,  92,  78, 
-    105,  99, 107, 101, 108,  92, 
-     68,  97, 116,  97,  92,  83, 
-    104,  97, 100, 101, 114, 115, 
-     92,  76, 105, 110, 101,  86, 
-    101, 114, 116, 101, 120,  83, 
-    104,  97, 100, 101, 114,  46, 
-    104, 108, 115, 108,   0,  69, 
-     58,  92,  80, 114, 111, 106, 
-    101,  99, 116, 115,  92,  78, 
-    105,  99, 107, 101, 108,  92, 
-     78, 105,  99, 107, 101, 108, 
-     92,  68,  97, 116,  97,  92, 
-     83, 104,  97, 100, 101, 114, 
-    115,  92,  67, 111, 109, 109, 
-    111, 110,  67, 111, 110, 115, 
-    116,  97, 110, 116,  66, 117, 
-    102, 102, 101, 114, 115,  46, 
-    104, 108, 115, 108,   0,   0, 
-    254, 239, 254, 239,   1,   0, 
-      0,   0,   1,   0,   0,   0, 
-      0,   1,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255,  13, 
-      0, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0, 148,  46,  49,   1, 
-     40, 162, 146,  97,   1,   0, 
-      0,   0, 173, 122,  85, 243, 
-    196,  11, 159,  68, 151,  52, 
-    141,  53, 107,   9,  52, 182, 
-    183,   0,   0,   0,  47,  76, 
-    105, 110, 107,  73, 110, 102, 
-    111,   0,  47, 110,  97, 109, 
-    101, 115,   0,  47, 115, 114, 
-     99,  47, 104, 101,  97, 100, 
-    101, 114,  98, 108, 111,  99, 
-    107,   0,  47, 115, 114,  99, 
-     47, 102, 105, 108, 101, 115, 
-     47, 101,  58,  92, 112, 114, 
-    111, 106, 101,  99, 116, 115, 
-     92, 110, 105,  99, 107, 101, 
-    108,  92, 110, 105,  99, 107, 
-    101, 108,  92, 100,  97, 116, 
-     97,  92, 115, 104,  97, 100, 
-    101, 114, 115,  92, 108, 105, 
-    110, 101, 118, 101, 114, 116, 
-    101, 120, 115, 104,  97, 100, 
-    101, 114,  46, 104, 108, 115, 
-    108,   0,  47, 115, 114,  99, 
-     47, 102, 105, 108, 101, 115, 
-     47, 101,  58,  92, 112, 114, 
-    111, 106, 101,  99, 116, 115, 
-     92, 110, 105,  99, 107, 101, 
-    108,  92, 110, 105,  99, 107, 
-    101, 108,  92, 100,  97, 116, 
-     97,  92, 115, 104,  97, 100, 
-    101, 114, 115,  92,  99, 111, 
-    109, 109, 111, 110,  99, 111, 
-    110, 115, 116,  97, 110, 116, 
-     98, 117, 102, 102, 101, 114, 
-    115,  46, 104, 108, 115, 108, 
-      0,   5,   0,   0,   0,  10, 
-      0,   0,   0,   1,   0,   0, 
-      0,  55,   0,   0,   0,   0, 
-      0,   0,   0,  34,   0,   0, 
-      0,   8,   0,   0,   0,  17, 
-      0,   0,   0,   7,   0,   0, 
-      0,   0,   0,   0,   0,   5, 
-      0,   0,   0, 106,   0,   0, 
-      0,   9,   0,   0,   0,  10, 
-      0,   0,   0,   6,   0,   0, 
-      0,   0,   0,   0,   0, 220, 
-     81,  51,   1,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,  17,   0, 
-      0,   0,  32,   0,   0,   0, 
-     27,   1,   0,   0, 252,   1, 
-      0,   0, 163,   1,   0,   0, 
-     56,   0,   0,   0,   0,   0, 
-      0,   0, 140,  14,   0,   0, 
-    172,   0,   0,   0,  13,  12, 
-      0,   0,  61,   1,   0,   0, 
-     80,  20,   0,   0,  88,   0, 
-      0,   0,   0,   0,   0,   0, 
-     40,   0,   0,   0,  80,   2, 
-      0,   0,  44,   0,   0,   0, 
-    172,   0,   0,   0,   3,   0, 
-      0,   0,  43,   0,   0,   0, 
-     29,   0,   0,   0,  42,   0, 
-      0,   0,  30,   0,   0,   0, 
-     16,   0,   0,   0,   6,   0, 
-      0,   0,  31,   0,   0,   0, 
-     32,   0,   0,   0,  33,   0, 
-      0,   0,  34,   0,   0,   0, 
-     35,   0,   0,   0,  36,   0, 
-      0,   0,  17,   0,   0,   0, 
-      8,   0,   0,   0,   9,   0, 
-      0,   0,  10,   0,   0,   0, 
-     11,   0,   0,   0,  12,   0, 
-      0,   0,  13,   0,   0,   0, 
-     14,   0,   0,   0,  15,   0, 
-      0,   0,  18,   0,   0,   0, 
-     19,   0,   0,   0,  20,   0, 
-      0,   0,  21,   0,   0,   0, 
-     22,   0,   0,   0,  23,   0, 
-      0,   0,  24,   0,   0,   0, 
-     25,   0,   0,   0,  26,   0, 
-      0,   0,  27,   0,   0,   0, 
-     28,   0,   0,   0,   7,   0, 
-      0,   0,  37,   0,   0,   0, 
-     38,   0,   0,   0,  39,   0, 
-      0,   0,  41,   0,   0,   0, 
-     40,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-     44,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0
-};
@@ -1,9473 +0,0 @@
-#if 0
-//
-// Generated by Microsoft (R) HLSL Shader Compiler 10.1
-//
-//
-// Buffer Definitions: 
-//
-// cbuffer PerFrame
-// {
-//
-//   float4x4 viewMatrix;               // Offset:    0 Size:    64 [unused]
-//   float3 eyePos;                     // Offset:   64 Size:    12
-//   float3 lightPos;                   // Offset:   80 Size:    12 [unused]
-//
-// }
-//
-// cbuffer ShaderData
-// {
-//
-//   float4 lightPositions[4];          // Offset:    0 Size:    64
-//   float4 lightColors[4];             // Offset:   64 Size:    64
-//   float4 albedoFactor;               // Offset:  128 Size:    16 [unused]
-//   float metallicFactor;              // Offset:  144 Size:     4 [unused]
-//   float roughnessFactor;             // Offset:  148 Size:     4 [unused]
-//   float aoFactor;                    // Offset:  152 Size:     4 [unused]
-//
-// }
-//
-//
-// Resource Bindings:
-//
-// Name                                 Type  Format         Dim      HLSL Bind  Count
-// ------------------------------ ---------- ------- ----------- -------------- ------
-// sampleType                        sampler      NA          NA             s0      1 
-// albedoTex                         texture  float4          2d             t0      1 
-// normalTex                         texture  float4          2d             t1      1 
-// metalRoughnessTex                 texture  float4          2d             t2      1 
-// aoTex                             texture  float4          2d             t3      1 
-// emissionTex                       texture  float4          2d             t4      1 
-// irradianceMap                     texture  float4        cube             t5      1 
-// radianceMap                       texture  float4        cube             t6      1 
-// brdfLUT                           texture  float4          2d             t7      1 
-// PerFrame                          cbuffer      NA          NA            cb1      1 
-// ShaderData                        cbuffer      NA          NA            cb3      1 
-//
-//
-//
-// Input signature:
-//
-// Name                 Index   Mask Register SysValue  Format   Used
-// -------------------- ----- ------ -------- -------- ------- ------
-// WORLD_POSITION           0   xyz         0     NONE   float   xyz 
-// NORMAL_WS                0   xyz         1     NONE   float   xyz 
-// TEXCOORD                 0   xy          2     NONE   float   xy  
-//
-//
-// Output signature:
-//
-// Name                 Index   Mask Register SysValue  Format   Used
-// -------------------- ----- ------ -------- -------- ------- ------
-// SV_TARGET                0   xyzw        0   TARGET   float   xyzw
-//
-ps_5_0
-dcl_globalFlags refactoringAllowed | skipOptimization
-dcl_constantbuffer CB1[5], immediateIndexed
-dcl_constantbuffer CB3[8], dynamicIndexed
-dcl_sampler s0, mode_default
-dcl_resource_texture2d (float,float,float,float) t0
-dcl_resource_texture2d (float,float,float,float) t1
-dcl_resource_texture2d (float,float,float,float) t2
-dcl_resource_texture2d (float,float,float,float) t3
-dcl_resource_texture2d (float,float,float,float) t4
-dcl_resource_texturecube (float,float,float,float) t5
-dcl_resource_texturecube (float,float,float,float) t6
-dcl_resource_texture2d (float,float,float,float) t7
-dcl_input_ps linear v0.xyz
-dcl_input_ps linear v1.xyz
-dcl_input_ps linear v2.xy
-dcl_output o0.xyzw
-dcl_temps 14
-//
-// Initial variable locations:
-//   v0.x <- IN.worldPos.x; v0.y <- IN.worldPos.y; v0.z <- IN.worldPos.z; 
-//   v1.x <- IN.normalWS.x; v1.y <- IN.normalWS.y; v1.z <- IN.normalWS.z; 
-//   v2.x <- IN.uv.x; v2.y <- IN.uv.y; 
-//   o0.x <- <PbrPixelShader return value>.x; o0.y <- <PbrPixelShader return value>.y; o0.z <- <PbrPixelShader return value>.z; o0.w <- <PbrPixelShader return value>.w
-//
-#line 1 "E:\Projects\Nickel\Nickel\Data\Shaders\PbrHelper.hlsl"
-mov r0.x, l(3.141593)  // r0.x <- PI
-
-#line 58 "E:\Projects\Nickel\Nickel\Data\Shaders\PbrPixelShader.hlsl"
-sample_indexable(texture2d)(float,float,float,float) r0.yzw, v2.xyxx, t0.wxyz, s0
-log r0.yzw, r0.yyzw
-mul r0.yzw, r0.yyzw, l(0.000000, 2.200000, 2.200000, 2.200000)
-exp r0.yzw, r0.yyzw  // r0.y <- albedoTexel.x; r0.z <- albedoTexel.y; r0.w <- albedoTexel.z
-
-#line 59
-sample_indexable(texture2d)(float,float,float,float) r1.xy, v2.xyxx, t2.xyzw, s0  // r1.y <- metalRoughnessTexel.y
-mov r1.xy, r1.xyxx  // r1.x <- metalRoughnessTexel.x
-
-#line 60
-mov r1.x, r1.x  // r1.x <- metallic
-
-#line 61
-mov r1.y, r1.y  // r1.y <- roughness
-
-#line 62
-sample_indexable(texture2d)(float,float,float,float) r1.z, v2.xyxx, t3.yzxw, s0
-mov r1.z, r1.z  // r1.z <- ao
-
-#line 63
-sample_indexable(texture2d)(float,float,float,float) r2.xyz, v2.xyxx, t4.xyzw, s0
-log r2.xyz, r2.xyzx
-mul r2.xyz, r2.xyzx, l(2.200000, 2.200000, 2.200000, 0.000000)
-exp r2.xyz, r2.xyzx  // r2.x <- emissionTexel.x; r2.y <- emissionTexel.y; r2.z <- emissionTexel.z
-
-#line 65
-nop 
-dp3 r1.w, v1.xyzx, v1.xyzx
-rsq r1.w, r1.w
-mul r3.xyz, r1.wwww, v1.zxyz
-
-#line 35
-sample_indexable(texture2d)(float,float,float,float) r4.xyz, v2.xyxx, t1.xyzw, s0
-mov r4.xyz, r4.xyzx  // r4.x <- tangentNormal.x; r4.y <- tangentNormal.y; r4.z <- tangentNormal.z
-
-#line 36
-mul r4.xyz, r4.xyzx, l(2.000000, 2.000000, 2.000000, 0.000000)
-mov r5.xyz, l(-1.000000,-1.000000,-1.000000,-0.000000)
-add r4.xyz, r4.xyzx, r5.xyzx
-dp3 r1.w, r4.xyzx, r4.xyzx
-rsq r1.w, r1.w
-mul r4.xyz, r1.wwww, r4.xyzx
-
-#line 38
-deriv_rtx_coarse r5.xyz, v0.yzxy  // r5.x <- Q1.y; r5.y <- Q1.z; r5.z <- Q1.x
-
-#line 39
-deriv_rty_coarse r6.xyz, v0.yzxy  // r6.x <- Q2.y; r6.y <- Q2.z; r6.z <- Q2.x
-
-#line 40
-deriv_rtx_coarse r1.w, v2.y  // r1.w <- st1.y
-
-#line 41
-deriv_rty_coarse r2.w, v2.y  // r2.w <- st2.y
-
-#line 47
-dp3 r3.w, r3.xyzx, r3.xyzx
-rsq r3.w, r3.w
-mul r3.xyz, r3.wwww, r3.yzxy  // r3.x <- Normal.x; r3.y <- Normal.y; r3.z <- Normal.z
-
-#line 48
-mul r5.xyz, r2.wwww, r5.xyzx
-mul r6.xyz, r1.wwww, r6.xyzx
-mov r6.xyz, -r6.xyzx
-add r5.xyz, r5.xyzx, r6.xyzx
-dp3 r1.w, r5.xyzx, r5.xyzx
-rsq r1.w, r1.w
-mul r5.xyz, r1.wwww, r5.xyzx
-mov r5.xyz, -r5.xyzx  // r5.x <- Tangent.y; r5.y <- Tangent.z; r5.z <- Tangent.x
-
-#line 49
-mul r6.xyz, r3.yzxy, r5.yzxy
-mul r7.xyz, r3.zxyz, r5.xyzx
-mov r7.xyz, -r7.xyzx
-add r6.xyz, r6.xyzx, r7.xyzx
-dp3 r1.w, r6.xyzx, r6.xyzx
-rsq r1.w, r1.w
-mul r6.xyz, r1.wwww, r6.xyzx  // r6.x <- Binormal.x; r6.y <- Binormal.y; r6.z <- Binormal.z
-
-#line 51
-mov r7.x, r5.z  // r7.x <- TBN._m00
-mov r7.y, r6.x  // r7.y <- TBN._m10
-mov r7.z, r3.x  // r7.z <- TBN._m20
-mov r8.x, r5.x  // r8.x <- TBN._m01
-mov r8.y, r6.y  // r8.y <- TBN._m11
-mov r8.z, r3.y  // r8.z <- TBN._m21
-mov r3.x, r5.y  // r3.x <- TBN._m02
-mov r3.y, r6.z  // r3.y <- TBN._m12
-mov r3.z, r3.z  // r3.z <- TBN._m22
-
-#line 53
-dp3 r5.x, r4.xyzx, r7.xyzx
-dp3 r5.y, r4.xyzx, r8.xyzx
-dp3 r5.z, r4.xyzx, r3.xyzx
-dp3 r1.w, r5.xyzx, r5.xyzx
-rsq r1.w, r1.w
-mul r3.xyz, r1.wwww, r5.xyzx  // r3.x <- <GetNormalFromMap return value>.x; r3.y <- <GetNormalFromMap return value>.y; r3.z <- <GetNormalFromMap return value>.z
-
-#line 65
-mov r3.xyz, r3.xyzx  // r3.x <- N.x; r3.y <- N.y; r3.z <- N.z
-
-#line 66
-mov r4.xyz, -v0.xyzx
-add r4.xyz, r4.xyzx, cb1[4].xyzx
-dp3 r1.w, r4.xyzx, r4.xyzx
-rsq r1.w, r1.w
-mul r4.xyz, r1.wwww, r4.xyzx  // r4.x <- V.x; r4.y <- V.y; r4.z <- V.z
-
-#line 67
-mov r5.xyz, -r4.xyzx
-dp3 r1.w, r5.xyzx, r3.xyzx
-add r1.w, r1.w, r1.w
-mov r1.w, -r1.w
-mul r6.xyz, r1.wwww, r3.xyzx
-add r5.xyz, r5.xyzx, r6.xyzx  // r5.x <- R.x; r5.y <- R.y; r5.z <- R.z
-
-#line 69
-mov r6.xyz, l(-0.040000,-0.040000,-0.040000,-0.000000)
-add r6.xyz, r0.yzwy, r6.xyzx
-mul r6.xyz, r1.xxxx, r6.xyzx
-add r6.xyz, r6.xyzx, l(0.040000, 0.040000, 0.040000, 0.000000)  // r6.x <- F0.x; r6.y <- F0.y; r6.z <- F0.z
-
-#line 72
-mov r7.xyz, l(0,0,0,0)  // r7.x <- Lo.x; r7.y <- Lo.y; r7.z <- Lo.z
-
-#line 73
-mov r1.w, l(0)  // r1.w <- i
-mov r8.xyz, r7.xyzx  // r8.x <- Lo.x; r8.y <- Lo.y; r8.z <- Lo.z
-mov r2.w, r1.w  // r2.w <- i
-loop 
-  ilt r3.w, r2.w, l(4)
-  breakc_z r3.w
-
-#line 75
-  mov r9.xyz, -v0.xyzx
-  add r9.xyz, r9.xyzx, cb3[r2.w + 0].xyzx
-  dp3 r3.w, r9.xyzx, r9.xyzx
-  rsq r3.w, r3.w
-  mul r9.xyz, r3.wwww, r9.xyzx  // r9.x <- L.x; r9.y <- L.y; r9.z <- L.z
-
-#line 76
-  add r10.xyz, r4.xyzx, r9.xyzx
-  dp3 r3.w, r10.xyzx, r10.xyzx
-  rsq r3.w, r3.w
-  mul r10.xyz, r3.wwww, r10.xyzx  // r10.x <- H.x; r10.y <- H.y; r10.z <- H.z
-
-#line 77
-  mov r11.xyz, -v0.xyzx
-  add r11.xyz, r11.xyzx, cb3[r2.w + 0].xyzx
-  dp3 r3.w, r11.xyzx, r11.xyzx
-  sqrt r3.w, r3.w  // r3.w <- distance
-
-#line 78
-  mul r3.w, r3.w, r3.w
-  div r3.w, l(1.000000), r3.w  // r3.w <- attenuation
-
-#line 79
-  mul r11.xyz, r3.wwww, cb3[r2.w + 4].xyzx  // r11.x <- radiance.x; r11.y <- radiance.y; r11.z <- radiance.z
-
-#line 82
-  nop 
-  mov r12.xyz, r3.xyzx
-  mov r10.xyz, r10.xyzx
-  mov r3.w, r1.y
-
-#line 14 "E:\Projects\Nickel\Nickel\Data\Shaders\PbrHelper.hlsl"
-  mul r3.w, r3.w, r3.w  // r3.w <- a
-
-#line 15
-  mul r3.w, r3.w, r3.w  // r3.w <- a2
-
-#line 16
-  dp3 r4.w, r12.xyzx, r10.xyzx
-  max r4.w, r4.w, l(0.000000)  // r4.w <- NdotH
-
-#line 17
-  mul r4.w, r4.w, r4.w  // r4.w <- NdotH2
-
-#line 19
-  mov r3.w, r3.w  // r3.w <- num
-
-#line 20
-  mov r5.w, l(-1.000000)
-  add r5.w, r3.w, r5.w
-  mul r4.w, r4.w, r5.w
-  add r4.w, r4.w, l(1.000000)  // r4.w <- denom
-
-#line 21
-  mul r5.w, r0.x, r4.w
-  mul r4.w, r4.w, r5.w
-
-#line 23
-  div r3.w, r3.w, r4.w  // r3.w <- <DistributionGGX return value>
-
-#line 82 "E:\Projects\Nickel\Nickel\Data\Shaders\PbrPixelShader.hlsl"
-  mov r3.w, r3.w  // r3.w <- NDF
-
-#line 83
-  nop 
-  mov r12.xyz, r3.xyzx
-  mov r13.xyz, r4.xyzx
-  mov r9.xyz, r9.xyzx
-  mov r4.w, r1.y
-
-#line 37 "E:\Projects\Nickel\Nickel\Data\Shaders\PbrHelper.hlsl"
-  dp3 r5.w, r12.xyzx, r13.xyzx
-  max r5.w, r5.w, l(0.000000)  // r5.w <- NdotV
-
-#line 38
-  dp3 r6.w, r12.xyzx, r9.xyzx
-  max r6.w, r6.w, l(0.000000)  // r6.w <- NdotL
-
-#line 39
-  nop 
-  mov r5.w, r5.w
-  mov r4.w, r4.w
-
-#line 27
-  add r7.w, r4.w, l(1.000000)  // r7.w <- r
-
-#line 28
-  mul r7.w, r7.w, r7.w
-  div r7.w, r7.w, l(8.000000)  // r7.w <- k
-
-#line 30
-  mov r5.w, r5.w  // r5.w <- num
-
-#line 31
-  mov r8.w, -r7.w
-  add r8.w, r8.w, l(1.000000)
-  mul r8.w, r5.w, r8.w
-  add r7.w, r7.w, r8.w  // r7.w <- denom
-
-#line 33
-  div r5.w, r5.w, r7.w  // r5.w <- <GeometrySchlickGGX return value>
-
-#line 39
-  mov r5.w, r5.w  // r5.w <- ggx2
-
-#line 40
-  nop 
-  mov r6.w, r6.w
-
-#line 27
-  add r4.w, r4.w, l(1.000000)  // r4.w <- r
-
-#line 28
-  mul r4.w, r4.w, r4.w
-  div r4.w, r4.w, l(8.000000)  // r4.w <- k
-
-#line 30
-  mov r6.w, r6.w  // r6.w <- num
-
-#line 31
-  mov r7.w, -r4.w
-  add r7.w, r7.w, l(1.000000)
-  mul r7.w, r6.w, r7.w
-  add r4.w, r4.w, r7.w  // r4.w <- denom
-
-#line 33
-  div r4.w, r6.w, r4.w  // r4.w <- <GeometrySchlickGGX return value>
-
-#line 40
-  mov r4.w, r4.w  // r4.w <- ggx1
-
-#line 42
-  mul r4.w, r5.w, r4.w  // r4.w <- <GeometrySmith return value>
-
-#line 83 "E:\Projects\Nickel\Nickel\Data\Shaders\PbrPixelShader.hlsl"
-  mov r4.w, r4.w  // r4.w <- G
-
-#line 84
-  nop 
-  dp3 r5.w, r10.xyzx, r4.xyzx
-  max r5.w, r5.w, l(0.000000)
-  min r5.w, r5.w, l(1.000000)
-  mov r10.xyz, r6.xyzx
-
-#line 46 "E:\Projects\Nickel\Nickel\Data\Shaders\PbrHelper.hlsl"
-  mov r12.xyz, -r10.xyzx
-  add r12.xyz, r12.xyzx, l(1.000000, 1.000000, 1.000000, 0.000000)
-  mov r5.w, -r5.w
-  add r5.w, r5.w, l(1.000000)
-  max r5.w, r5.w, l(0.000000)
-  min r5.w, r5.w, l(1.000000)
-  mov r6.w, l(1.000000)
-  mul r6.w, r5.w, r6.w
-  mul r5.w, r5.w, r5.w
-  mul r5.w, r5.w, r5.w
-  mul r5.w, r5.w, r6.w
-  mul r12.xyz, r5.wwww, r12.xyzx
-  add r10.xyz, r10.xyzx, r12.xyzx  // r10.x <- <FresnelSchlick return value>.x; r10.y <- <FresnelSchlick return value>.y; r10.z <- <FresnelSchlick return value>.z
-
-#line 84 "E:\Projects\Nickel\Nickel\Data\Shaders\PbrPixelShader.hlsl"
-  mov r10.xyz, r10.xyzx  // r10.x <- F.x; r10.y <- F.y; r10.z <- F.z
-
-#line 86
-  mul r3.w, r3.w, r4.w
-  mul r12.xyz, r10.xyzx, r3.wwww  // r12.x <- numerator.x; r12.y <- numerator.y; r12.z <- numerator.z
-
-#line 87
-  itof r3.w, l(4)
-  dp3 r4.w, r3.xyzx, r4.xyzx
-  max r4.w, r4.w, l(0.000000)
-  mul r3.w, r3.w, r4.w
-  dp3 r4.w, r3.xyzx, r9.xyzx
-  max r4.w, r4.w, l(0.000000)
-  mul r3.w, r3.w, r4.w
-  add r3.w, r3.w, l(0.000100)  // r3.w <- denominator
-
-#line 88
-  div r12.xyz, r12.xyzx, r3.wwww  // r12.x <- specular.x; r12.y <- specular.y; r12.z <- specular.z
-
-#line 91
-  mov r10.xyz, r10.xyzx  // r10.x <- kS.x; r10.y <- kS.y; r10.z <- kS.z
-
-#line 95
-  mov r10.xyz, -r10.xyzx
-  add r10.xyz, r10.xyzx, l(1.000000, 1.000000, 1.000000, 0.000000)  // r10.x <- kD.x; r10.y <- kD.y; r10.z <- kD.z
-
-#line 99
-  mov r3.w, -r1.x
-  add r3.w, r3.w, l(1.000000)
-  mul r10.xyz, r3.wwww, r10.xyzx
-
-#line 102
-  dp3 r3.w, r3.xyzx, r9.xyzx
-  max r3.w, r3.w, l(0.000000)  // r3.w <- NdotL
-
-#line 105
-  mul r9.xyz, r0.yzwy, r10.xyzx
-  div r9.xyz, r9.xyzx, r0.xxxx
-  add r9.xyz, r12.xyzx, r9.xyzx
-  mul r9.xyz, r11.xyzx, r9.xyzx
-  mul r9.xyz, r3.wwww, r9.xyzx
-  add r8.xyz, r8.xyzx, r9.xyzx
-
-#line 106
-  iadd r2.w, r2.w, l(1)
-endloop 
-
-#line 109
-nop 
-dp3 r0.x, r3.xyzx, r4.xyzx
-max r0.x, r0.x, l(0.000000)
-mov r6.xyz, r6.xyzx
-mov r1.y, r1.y
-
-#line 50 "E:\Projects\Nickel\Nickel\Data\Shaders\PbrHelper.hlsl"
-mov r1.w, -r1.y
-add r1.w, r1.w, l(1.000000)  // r1.w <- oneMinusRoughness
-
-#line 51
-max r7.xyz, r6.xyzx, r1.wwww
-mov r9.xyz, -r6.xyzx
-add r7.xyz, r7.xyzx, r9.xyzx
-mov r0.x, -r0.x
-add r0.x, r0.x, l(1.000000)
-max r0.x, r0.x, l(0.000000)
-min r0.x, r0.x, l(1.000000)
-mov r1.w, l(1.000000)
-mul r1.w, r0.x, r1.w
-mul r0.x, r0.x, r0.x
-mul r0.x, r0.x, r0.x
-mul r0.x, r0.x, r1.w
-mul r7.xyz, r0.xxxx, r7.xyzx
-add r7.xyz, r6.xyzx, r7.xyzx  // r7.x <- <FresnelSchlickRoughness return value>.x; r7.y <- <FresnelSchlickRoughness return value>.y; r7.z <- <FresnelSchlickRoughness return value>.z
-
-#line 109 "E:\Projects\Nickel\Nickel\Data\Shaders\PbrPixelShader.hlsl"
-mov r7.xyz, r7.xyzx  // r7.x <- F.x; r7.y <- F.y; r7.z <- F.z
-
-#line 111
-sample_indexable(texturecube)(float,float,float,float) r5.xyz, r5.xyzx, t6.xyzw, s0
-mov r5.xyz, r5.xyzx  // r5.x <- prefilteredColor.x; r5.y <- prefilteredColor.y; r5.z <- prefilteredColor.z
-
-#line 112
-dp3 r0.x, r3.xyzx, r4.xyzx
-max r1.x, r0.x, l(0.000000)  // r1.x <- brdfLutUv.x
-mov r1.y, r1.y  // r1.y <- brdfLutUv.y
-
-#line 113
-sample_indexable(texture2d)(float,float,float,float) r1.xy, r1.xyxx, t7.xyzw, s0
-mov r1.xy, r1.xyxx  // r1.x <- brdf.x; r1.y <- brdf.y
-
-#line 114
-mul r7.xyz, r1.xxxx, r7.xyzx
-add r1.xyw, r1.yyyy, r7.xyxz
-mul r1.xyw, r1.xyxw, r5.xyxz  // r1.x <- specular.x; r1.y <- specular.y; r1.w <- specular.z
-
-#line 117
-nop 
-dp3 r0.x, r3.xyzx, r4.xyzx
-max r0.x, r0.x, l(0.000000)
-mov r6.xyz, r6.xyzx
-
-#line 46 "E:\Projects\Nickel\Nickel\Data\Shaders\PbrHelper.hlsl"
-mov r4.xyz, -r6.xyzx
-add r4.xyz, r4.xyzx, l(1.000000, 1.000000, 1.000000, 0.000000)
-mov r0.x, -r0.x
-add r0.x, r0.x, l(1.000000)
-max r0.x, r0.x, l(0.000000)
-min r0.x, r0.x, l(1.000000)
-mov r2.w, l(1.000000)
-mul r2.w, r0.x, r2.w
-mul r0.x, r0.x, r0.x
-mul r0.x, r0.x, r0.x
-mul r0.x, r0.x, r2.w
-mul r4.xyz, r0.xxxx, r4.xyzx
-add r4.xyz, r4.xyzx, r6.xyzx  // r4.x <- <FresnelSchlick return value>.x; r4.y <- <FresnelSchlick return value>.y; r4.z <- <FresnelSchlick return value>.z
-
-#line 117 "E:\Projects\Nickel\Nickel\Data\Shaders\PbrPixelShader.hlsl"
-mov r4.xyz, r4.xyzx  // r4.x <- kS.x; r4.y <- kS.y; r4.z <- kS.z
-
-#line 118
-mov r4.xyz, -r4.xyzx
-add r4.xyz, r4.xyzx, l(1.000000, 1.000000, 1.000000, 0.000000)  // r4.x <- kD.x; r4.y <- kD.y; r4.z <- kD.z
-
-#line 119
-sample_indexable(texturecube)(float,float,float,float) r3.xyz, r3.xyzx, t5.xyzw, s0
-mov r3.xyz, r3.xyzx  // r3.x <- irradiance.x; r3.y <- irradiance.y; r3.z <- irradiance.z
-
-#line 120
-mul r0.xyz, r0.yzwy, r3.xyzx  // r0.x <- diffuse.x; r0.y <- diffuse.y; r0.z <- diffuse.z
-
-#line 121
-mul r0.xyz, r0.xyzx, r4.xyzx
-add r0.xyz, r1.xywx, r0.xyzx
-mul r0.xyz, r1.zzzz, r0.xyzx  // r0.x <- ambient.x; r0.y <- ambient.y; r0.z <- ambient.z
-
-#line 123
-add r0.xyz, r8.xyzx, r0.xyzx
-add r0.xyz, r2.xyzx, r0.xyzx  // r0.x <- color.x; r0.y <- color.y; r0.z <- color.z
-
-#line 125
-nop 
-
-#line 5 "E:\Projects\Nickel\Nickel\Data\Shaders\PbrHelper.hlsl"
-add r1.xyz, r0.xyzx, l(1.000000, 1.000000, 1.000000, 0.000000)
-div r0.xyz, r0.xyzx, r1.xyzx  // r0.x <- <ToneMapHDR return value>.x; r0.y <- <ToneMapHDR return value>.y; r0.z <- <ToneMapHDR return value>.z
-
-#line 126 "E:\Projects\Nickel\Nickel\Data\Shaders\PbrPixelShader.hlsl"
-nop 
-
-#line 9 "E:\Projects\Nickel\Nickel\Data\Shaders\PbrHelper.hlsl"
-mov r0.w, l(0.454545)  // r0.w <- powN
-
-#line 10
-log r0.xyz, r0.xyzx
-mul r0.xyz, r0.xyzx, r0.wwww
-exp r0.xyz, r0.xyzx  // r0.x <- <CorrectGamma return value>.x; r0.y <- <CorrectGamma return value>.y; r0.z <- <CorrectGamma return value>.z
-
-#line 126 "E:\Projects\Nickel\Nickel\Data\Shaders\PbrPixelShader.hlsl"
-mov r0.xyz, r0.xyzx  // r0.x <- color.x; r0.y <- color.y; r0.z <- color.z
-
-#line 128
-mov o0.xyz, r0.xyzx
-mov o0.w, l(1.000000)
-ret 
-// Approximately 275 instruction slots used
-#endif
-
-const BYTE g_PbrPixelShader[] =
-{
-     68,  88,  66,  67, 163, 158, 
-    129,  64,  16, 200, 136, 223, 
-    150, 190,  38, 148, 138,   4, 
-      2,  85,   1,   0,   0,   0, 
-      0, 209,   0,   0,   6,   0, 
-      0,   0,  56,   0,   0,   0, 
-    136,   5,   0,   0,   4,   6, 
-      0,   0,  56,   6,   0,   0, 
-     92,  34,   0,   0, 248,  34, 
-      0,   0,  82,  68,  69,  70, 
-     72,   5,   0,   0,   2,   0, 
-      0,   0,  24,   2,   0,   0, 
-     11,   0,   0,   0,  60,   0, 
-      0,   0,   0,   5, 255, 255, 
-      5,   1,   0,   0,  29,   5, 
-      0,   0,  82,  68,  49,  49, 
-     60,   0,   0,   0,  24,   0, 
-      0,   0,  32,   0,   0,   0, 
-     40,   0,   0,   0,  36,   0, 
-      0,   0,  12,   0,   0,   0, 
-      0,   0,   0,   0, 156,   1, 
-      0,   0,   3,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   1,   0, 
-      0,   0,   1,   0,   0,   0, 
-    167,   1,   0,   0,   2,   0, 
-      0,   0,   5,   0,   0,   0, 
-      4,   0,   0,   0, 255, 255, 
-    255, 255,   0,   0,   0,   0, 
-      1,   0,   0,   0,  13,   0, 
-      0,   0, 177,   1,   0,   0, 
-      2,   0,   0,   0,   5,   0, 
-      0,   0,   4,   0,   0,   0, 
-    255, 255, 255, 255,   1,   0, 
-      0,   0,   1,   0,   0,   0, 
-     13,   0,   0,   0, 187,   1, 
-      0,   0,   2,   0,   0,   0, 
-      5,   0,   0,   0,   4,   0, 
-      0,   0, 255, 255, 255, 255, 
-      2,   0,   0,   0,   1,   0, 
-      0,   0,  13,   0,   0,   0, 
-    205,   1,   0,   0,   2,   0, 
-      0,   0,   5,   0,   0,   0, 
-      4,   0,   0,   0, 255, 255, 
-    255, 255,   3,   0,   0,   0, 
-      1,   0,   0,   0,  13,   0, 
-      0,   0, 211,   1,   0,   0, 
-      2,   0,   0,   0,   5,   0, 
-      0,   0,   4,   0,   0,   0, 
-    255, 255, 255, 255,   4,   0, 
-      0,   0,   1,   0,   0,   0, 
-     13,   0,   0,   0, 223,   1, 
-      0,   0,   2,   0,   0,   0, 
-      5,   0,   0,   0,   9,   0, 
-      0,   0, 255, 255, 255, 255, 
-      5,   0,   0,   0,   1,   0, 
-      0,   0,  13,   0,   0,   0, 
-    237,   1,   0,   0,   2,   0, 
-      0,   0,   5,   0,   0,   0, 
-      9,   0,   0,   0, 255, 255, 
-    255, 255,   6,   0,   0,   0, 
-      1,   0,   0,   0,  13,   0, 
-      0,   0, 249,   1,   0,   0, 
-      2,   0,   0,   0,   5,   0, 
-      0,   0,   4,   0,   0,   0, 
-    255, 255, 255, 255,   7,   0, 
-      0,   0,   1,   0,   0,   0, 
-     13,   0,   0,   0,   1,   2, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      1,   0,   0,   0,   1,   0, 
-      0,   0,   1,   0,   0,   0, 
-     10,   2,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   3,   0,   0,   0, 
-      1,   0,   0,   0,   1,   0, 
-      0,   0, 115,  97, 109, 112, 
-    108, 101,  84, 121, 112, 101, 
-      0,  97, 108,  98, 101, 100, 
-    111,  84, 101, 120,   0, 110, 
-    111, 114, 109,  97, 108,  84, 
-    101, 120,   0, 109, 101, 116, 
-     97, 108,  82, 111, 117, 103, 
-    104, 110, 101, 115, 115,  84, 
-    101, 120,   0,  97, 111,  84, 
-    101, 120,   0, 101, 109, 105, 
-    115, 115, 105, 111, 110,  84, 
-    101, 120,   0, 105, 114, 114, 
-     97, 100, 105,  97, 110,  99, 
-    101,  77,  97, 112,   0, 114, 
-     97, 100, 105,  97, 110,  99, 
-    101,  77,  97, 112,   0,  98, 
-    114, 100, 102,  76,  85,  84, 
-      0,  80, 101, 114,  70, 114, 
-     97, 109, 101,   0,  83, 104, 
-     97, 100, 101, 114,  68,  97, 
-    116,  97,   0, 171, 171, 171, 
-      1,   2,   0,   0,   3,   0, 
-      0,   0,  72,   2,   0,   0, 
-     96,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-     10,   2,   0,   0,   6,   0, 
-      0,   0,  56,   3,   0,   0, 
-    160,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-    192,   2,   0,   0,   0,   0, 
-      0,   0,  64,   0,   0,   0, 
-      0,   0,   0,   0, 212,   2, 
-      0,   0,   0,   0,   0,   0, 
-    255, 255, 255, 255,   0,   0, 
-      0,   0, 255, 255, 255, 255, 
-      0,   0,   0,   0, 248,   2, 
-      0,   0,  64,   0,   0,   0, 
-     12,   0,   0,   0,   2,   0, 
-      0,   0,   8,   3,   0,   0, 
-      0,   0,   0,   0, 255, 255, 
-    255, 255,   0,   0,   0,   0, 
-    255, 255, 255, 255,   0,   0, 
-      0,   0,  44,   3,   0,   0, 
-     80,   0,   0,   0,  12,   0, 
-      0,   0,   0,   0,   0,   0, 
-      8,   3,   0,   0,   0,   0, 
-      0,   0, 255, 255, 255, 255, 
-      0,   0,   0,   0, 255, 255, 
-    255, 255,   0,   0,   0,   0, 
-    118, 105, 101, 119,  77,  97, 
-    116, 114, 105, 120,   0, 102, 
-    108, 111,  97, 116,  52, 120, 
-     52,   0,   3,   0,   3,   0, 
-      4,   0,   4,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0, 203,   2, 
-      0,   0, 101, 121, 101,  80, 
-    111, 115,   0, 102, 108, 111, 
-     97, 116,  51,   0, 171, 171, 
-      1,   0,   3,   0,   1,   0, 
-      3,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0, 255,   2,   0,   0, 
-    108, 105, 103, 104, 116,  80, 
-    111, 115,   0, 171, 171, 171, 
-     40,   4,   0,   0,   0,   0, 
-      0,   0,  64,   0,   0,   0, 
-      2,   0,   0,   0,  64,   4, 
-      0,   0,   0,   0,   0,   0, 
-    255, 255, 255, 255,   0,   0, 
-      0,   0, 255, 255, 255, 255, 
-      0,   0,   0,   0, 100,   4, 
-      0,   0,  64,   0,   0,   0, 
-     64,   0,   0,   0,   2,   0, 
-      0,   0, 112,   4,   0,   0, 
-      0,   0,   0,   0, 255, 255, 
-    255, 255,   0,   0,   0,   0, 
-    255, 255, 255, 255,   0,   0, 
-      0,   0, 148,   4,   0,   0, 
-    128,   0,   0,   0,  16,   0, 
-      0,   0,   0,   0,   0,   0, 
-    164,   4,   0,   0,   0,   0, 
-      0,   0, 255, 255, 255, 255, 
-      0,   0,   0,   0, 255, 255, 
-    255, 255,   0,   0,   0,   0, 
-    200,   4,   0,   0, 144,   0, 
-      0,   0,   4,   0,   0,   0, 
-      0,   0,   0,   0, 224,   4, 
-      0,   0,   0,   0,   0,   0, 
-    255, 255, 255, 255,   0,   0, 
-      0,   0, 255, 255, 255, 255, 
-      0,   0,   0,   0,   4,   5, 
-      0,   0, 148,   0,   0,   0, 
-      4,   0,   0,   0,   0,   0, 
-      0,   0, 224,   4,   0,   0, 
-      0,   0,   0,   0, 255, 255, 
-    255, 255,   0,   0,   0,   0, 
-    255, 255, 255, 255,   0,   0, 
-      0,   0,  20,   5,   0,   0, 
-    152,   0,   0,   0,   4,   0, 
-      0,   0,   0,   0,   0,   0, 
-    224,   4,   0,   0,   0,   0, 
-      0,   0, 255, 255, 255, 255, 
-      0,   0,   0,   0, 255, 255, 
-    255, 255,   0,   0,   0,   0, 
-    108, 105, 103, 104, 116,  80, 
-    111, 115, 105, 116, 105, 111, 
-    110, 115,   0, 102, 108, 111, 
-     97, 116,  52,   0, 171, 171, 
-      1,   0,   3,   0,   1,   0, 
-      4,   0,   4,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,  55,   4,   0,   0, 
-    108, 105, 103, 104, 116,  67, 
-    111, 108, 111, 114, 115,   0, 
-      1,   0,   3,   0,   1,   0, 
-      4,   0,   4,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,  55,   4,   0,   0, 
-     97, 108,  98, 101, 100, 111, 
-     70,  97,  99, 116, 111, 114, 
-      0, 171, 171, 171,   1,   0, 
-      3,   0,   1,   0,   4,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-     55,   4,   0,   0, 109, 101, 
-    116,  97, 108, 108, 105,  99, 
-     70,  97,  99, 116, 111, 114, 
-      0, 102, 108, 111,  97, 116, 
-      0, 171, 171, 171,   0,   0, 
-      3,   0,   1,   0,   1,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-    215,   4,   0,   0, 114, 111, 
-    117, 103, 104, 110, 101, 115, 
-    115,  70,  97,  99, 116, 111, 
-    114,   0,  97, 111,  70,  97, 
-     99, 116, 111, 114,   0,  77, 
-    105,  99, 114, 111, 115, 111, 
-    102, 116,  32,  40,  82,  41, 
-     32,  72,  76,  83,  76,  32, 
-     83, 104,  97, 100, 101, 114, 
-     32,  67, 111, 109, 112, 105, 
-    108, 101, 114,  32,  49,  48, 
-     46,  49,   0, 171, 171, 171, 
-     73,  83,  71,  78, 116,   0, 
-      0,   0,   3,   0,   0,   0, 
-      8,   0,   0,   0,  80,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   3,   0, 
-      0,   0,   0,   0,   0,   0, 
-      7,   7,   0,   0,  95,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   3,   0, 
-      0,   0,   1,   0,   0,   0, 
-      7,   7,   0,   0, 105,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   3,   0, 
-      0,   0,   2,   0,   0,   0, 
-      3,   3,   0,   0,  87,  79, 
-     82,  76,  68,  95,  80,  79, 
-     83,  73,  84,  73,  79,  78, 
-      0,  78,  79,  82,  77,  65, 
-     76,  95,  87,  83,   0,  84, 
-     69,  88,  67,  79,  79,  82, 
-     68,   0, 171, 171,  79,  83, 
-     71,  78,  44,   0,   0,   0, 
-      1,   0,   0,   0,   8,   0, 
-      0,   0,  32,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   3,   0,   0,   0, 
-      0,   0,   0,   0,  15,   0, 
-      0,   0,  83,  86,  95,  84, 
-     65,  82,  71,  69,  84,   0, 
-    171, 171,  83,  72,  69,  88, 
-     28,  28,   0,   0,  80,   0, 
-      0,   0,   7,   7,   0,   0, 
-    106, 136,   0,   1,  89,   0, 
-      0,   4,  70, 142,  32,   0, 
-      1,   0,   0,   0,   5,   0, 
-      0,   0,  89,   8,   0,   4, 
-     70, 142,  32,   0,   3,   0, 
-      0,   0,   8,   0,   0,   0, 
-     90,   0,   0,   3,   0,  96, 
-     16,   0,   0,   0,   0,   0, 
-     88,  24,   0,   4,   0, 112, 
-     16,   0,   0,   0,   0,   0, 
-     85,  85,   0,   0,  88,  24, 
-      0,   4,   0, 112,  16,   0, 
-      1,   0,   0,   0,  85,  85, 
-      0,   0,  88,  24,   0,   4, 
-      0, 112,  16,   0,   2,   0, 
-      0,   0,  85,  85,   0,   0, 
-     88,  24,   0,   4,   0, 112, 
-     16,   0,   3,   0,   0,   0, 
-     85,  85,   0,   0,  88,  24, 
-      0,   4,   0, 112,  16,   0, 
-      4,   0,   0,   0,  85,  85, 
-      0,   0,  88,  48,   0,   4, 
-      0, 112,  16,   0,   5,   0, 
-      0,   0,  85,  85,   0,   0, 
-     88,  48,   0,   4,   0, 112, 
-     16,   0,   6,   0,   0,   0, 
-     85,  85,   0,   0,  88,  24, 
-      0,   4,   0, 112,  16,   0, 
-      7,   0,   0,   0,  85,  85, 
-      0,   0,  98,  16,   0,   3, 
-    114,  16,  16,   0,   0,   0, 
-      0,   0,  98,  16,   0,   3, 
-    114,  16,  16,   0,   1,   0, 
-      0,   0,  98,  16,   0,   3, 
-     50,  16,  16,   0,   2,   0, 
-      0,   0, 101,   0,   0,   3, 
-    242,  32,  16,   0,   0,   0, 
-      0,   0, 104,   0,   0,   2, 
-     14,   0,   0,   0,  54,   0, 
-      0,   5,  18,   0,  16,   0, 
-      0,   0,   0,   0,   1,  64, 
-      0,   0, 219,  15,  73,  64, 
-     69,   0,   0, 139, 194,   0, 
-      0, 128,  67,  85,  21,   0, 
-    226,   0,  16,   0,   0,   0, 
-      0,   0,  70,  16,  16,   0, 
-      2,   0,   0,   0,  54, 121, 
-     16,   0,   0,   0,   0,   0, 
-      0,  96,  16,   0,   0,   0, 
-      0,   0,  47,   0,   0,   5, 
-    226,   0,  16,   0,   0,   0, 
-      0,   0,  86,  14,  16,   0, 
-      0,   0,   0,   0,  56,   0, 
-      0,  10, 226,   0,  16,   0, 
-      0,   0,   0,   0,  86,  14, 
-     16,   0,   0,   0,   0,   0, 
-      2,  64,   0,   0,   0,   0, 
-      0,   0, 205, 204,  12,  64, 
-    205, 204,  12,  64, 205, 204, 
-     12,  64,  25,   0,   0,   5, 
-    226,   0,  16,   0,   0,   0, 
-      0,   0,  86,  14,  16,   0, 
-      0,   0,   0,   0,  69,   0, 
-      0, 139, 194,   0,   0, 128, 
-     67,  85,  21,   0,  50,   0, 
-     16,   0,   1,   0,   0,   0, 
-     70,  16,  16,   0,   2,   0, 
-      0,   0,  70, 126,  16,   0, 
-      2,   0,   0,   0,   0,  96, 
-     16,   0,   0,   0,   0,   0, 
-     54,   0,   0,   5,  50,   0, 
-     16,   0,   1,   0,   0,   0, 
-     70,   0,  16,   0,   1,   0, 
-      0,   0,  54,   0,   0,   5, 
-     18,   0,  16,   0,   1,   0, 
-      0,   0,  10,   0,  16,   0, 
-      1,   0,   0,   0,  54,   0, 
-      0,   5,  34,   0,  16,   0, 
-      1,   0,   0,   0,  26,   0, 
-     16,   0,   1,   0,   0,   0, 
-     69,   0,   0, 139, 194,   0, 
-      0, 128,  67,  85,  21,   0, 
-     66,   0,  16,   0,   1,   0, 
-      0,   0,  70,  16,  16,   0, 
-      2,   0,   0,   0, 150, 124, 
-     16,   0,   3,   0,   0,   0, 
-      0,  96,  16,   0,   0,   0, 
-      0,   0,  54,   0,   0,   5, 
-     66,   0,  16,   0,   1,   0, 
-      0,   0,  42,   0,  16,   0, 
-      1,   0,   0,   0,  69,   0, 
-      0, 139, 194,   0,   0, 128, 
-     67,  85,  21,   0, 114,   0, 
-     16,   0,   2,   0,   0,   0, 
-     70,  16,  16,   0,   2,   0, 
-      0,   0,  70, 126,  16,   0, 
-      4,   0,   0,   0,   0,  96, 
-     16,   0,   0,   0,   0,   0, 
-     47,   0,   0,   5, 114,   0, 
-     16,   0,   2,   0,   0,   0, 
-     70,   2,  16,   0,   2,   0, 
-      0,   0,  56,   0,   0,  10, 
-    114,   0,  16,   0,   2,   0, 
-      0,   0,  70,   2,  16,   0, 
-      2,   0,   0,   0,   2,  64, 
-      0,   0, 205, 204,  12,  64, 
-    205, 204,  12,  64, 205, 204, 
-     12,  64,   0,   0,   0,   0, 
-     25,   0,   0,   5, 114,   0, 
-     16,   0,   2,   0,   0,   0, 
-     70,   2,  16,   0,   2,   0, 
-      0,   0,  58,   0,   0,   1, 
-     16,   0,   0,   7, 130,   0, 
-     16,   0,   1,   0,   0,   0, 
-     70,  18,  16,   0,   1,   0, 
-      0,   0,  70,  18,  16,   0, 
-      1,   0,   0,   0,  68,   0, 
-      0,   5, 130,   0,  16,   0, 
-      1,   0,   0,   0,  58,   0, 
-     16,   0,   1,   0,   0,   0, 
-     56,   0,   0,   7, 114,   0, 
-     16,   0,   3,   0,   0,   0, 
-    246,  15,  16,   0,   1,   0, 
-      0,   0,  38,  25,  16,   0, 
-      1,   0,   0,   0,  69,   0, 
-      0, 139, 194,   0,   0, 128, 
-     67,  85,  21,   0, 114,   0, 
-     16,   0,   4,   0,   0,   0, 
-     70,  16,  16,   0,   2,   0, 
-      0,   0,  70, 126,  16,   0, 
-      1,   0,   0,   0,   0,  96, 
-     16,   0,   0,   0,   0,   0, 
-     54,   0,   0,   5, 114,   0, 
-     16,   0,   4,   0,   0,   0, 
-     70,   2,  16,   0,   4,   0, 
-      0,   0,  56,   0,   0,  10, 
-    114,   0,  16,   0,   4,   0, 
-      0,   0,  70,   2,  16,   0, 
-      4,   0,   0,   0,   2,  64, 
-      0,   0,   0,   0,   0,  64, 
-      0,   0,   0,  64,   0,   0, 
-      0,  64,   0,   0,   0,   0, 
-     54,   0,   0,   8, 114,   0, 
-     16,   0,   5,   0,   0,   0, 
-      2,  64,   0,   0,   0,   0, 
-    128, 191,   0,   0, 128, 191, 
-      0,   0, 128, 191,   0,   0, 
-      0, 128,   0,   0,   0,   7, 
-    114,   0,  16,   0,   4,   0, 
-      0,   0,  70,   2,  16,   0, 
-      4,   0,   0,   0,  70,   2, 
-     16,   0,   5,   0,   0,   0, 
-     16,   0,   0,   7, 130,   0, 
-     16,   0,   1,   0,   0,   0, 
-     70,   2,  16,   0,   4,   0, 
-      0,   0,  70,   2,  16,   0, 
-      4,   0,   0,   0,  68,   0, 
-      0,   5, 130,   0,  16,   0, 
-      1,   0,   0,   0,  58,   0, 
-     16,   0,   1,   0,   0,   0, 
-     56,   0,   0,   7, 114,   0, 
-     16,   0,   4,   0,   0,   0, 
-    246,  15,  16,   0,   1,   0, 
-      0,   0,  70,   2,  16,   0, 
-      4,   0,   0,   0, 122,   0, 
-      0,   5, 114,   0,  16,   0, 
-      5,   0,   0,   0, 150,  20, 
-     16,   0,   0,   0,   0,   0, 
-    124,   0,   0,   5, 114,   0, 
-     16,   0,   6,   0,   0,   0, 
-    150,  20,  16,   0,   0,   0, 
-      0,   0, 122,   0,   0,   5, 
-    130,   0,  16,   0,   1,   0, 
-      0,   0,  26,  16,  16,   0, 
-      2,   0,   0,   0, 124,   0, 
-      0,   5, 130,   0,  16,   0, 
-      2,   0,   0,   0,  26,  16, 
-     16,   0,   2,   0,   0,   0, 
-     16,   0,   0,   7, 130,   0, 
-     16,   0,   3,   0,   0,   0, 
-     70,   2,  16,   0,   3,   0, 
-      0,   0,  70,   2,  16,   0, 
-      3,   0,   0,   0,  68,   0, 
-      0,   5, 130,   0,  16,   0, 
-      3,   0,   0,   0,  58,   0, 
-     16,   0,   3,   0,   0,   0, 
-     56,   0,   0,   7, 114,   0, 
-     16,   0,   3,   0,   0,   0, 
-    246,  15,  16,   0,   3,   0, 
-      0,   0, 150,   4,  16,   0, 
-      3,   0,   0,   0,  56,   0, 
-      0,   7, 114,   0,  16,   0, 
-      5,   0,   0,   0, 246,  15, 
-     16,   0,   2,   0,   0,   0, 
-     70,   2,  16,   0,   5,   0, 
-      0,   0,  56,   0,   0,   7, 
-    114,   0,  16,   0,   6,   0, 
-      0,   0, 246,  15,  16,   0, 
-      1,   0,   0,   0,  70,   2, 
-     16,   0,   6,   0,   0,   0, 
-     54,   0,   0,   6, 114,   0, 
-     16,   0,   6,   0,   0,   0, 
-     70,   2,  16, 128,  65,   0, 
-      0,   0,   6,   0,   0,   0, 
-      0,   0,   0,   7, 114,   0, 
-     16,   0,   5,   0,   0,   0, 
-     70,   2,  16,   0,   5,   0, 
-      0,   0,  70,   2,  16,   0, 
-      6,   0,   0,   0,  16,   0, 
-      0,   7, 130,   0,  16,   0, 
-      1,   0,   0,   0,  70,   2, 
-     16,   0,   5,   0,   0,   0, 
-     70,   2,  16,   0,   5,   0, 
-      0,   0,  68,   0,   0,   5, 
-    130,   0,  16,   0,   1,   0, 
-      0,   0,  58,   0,  16,   0, 
-      1,   0,   0,   0,  56,   0, 
-      0,   7, 114,   0,  16,   0, 
-      5,   0,   0,   0, 246,  15, 
-     16,   0,   1,   0,   0,   0, 
-     70,   2,  16,   0,   5,   0, 
-      0,   0,  54,   0,   0,   6, 
-    114,   0,  16,   0,   5,   0, 
-      0,   0,  70,   2,  16, 128, 
-     65,   0,   0,   0,   5,   0, 
-      0,   0,  56,   0,   0,   7, 
-    114,   0,  16,   0,   6,   0, 
-      0,   0, 150,   4,  16,   0, 
-      3,   0,   0,   0, 150,   4, 
-     16,   0,   5,   0,   0,   0, 
-     56,   0,   0,   7, 114,   0, 
-     16,   0,   7,   0,   0,   0, 
-     38,   9,  16,   0,   3,   0, 
-      0,   0,  70,   2,  16,   0, 
-      5,   0,   0,   0,  54,   0, 
-      0,   6, 114,   0,  16,   0, 
-      7,   0,   0,   0,  70,   2, 
-     16, 128,  65,   0,   0,   0, 
-      7,   0,   0,   0,   0,   0, 
-      0,   7, 114,   0,  16,   0, 
-      6,   0,   0,   0,  70,   2, 
-     16,   0,   6,   0,   0,   0, 
-     70,   2,  16,   0,   7,   0, 
-      0,   0,  16,   0,   0,   7, 
-    130,   0,  16,   0,   1,   0, 
-      0,   0,  70,   2,  16,   0, 
-      6,   0,   0,   0,  70,   2, 
-     16,   0,   6,   0,   0,   0, 
-     68,   0,   0,   5, 130,   0, 
-     16,   0,   1,   0,   0,   0, 
-     58,   0,  16,   0,   1,   0, 
-      0,   0,  56,   0,   0,   7, 
-    114,   0,  16,   0,   6,   0, 
-      0,   0, 246,  15,  16,   0, 
-      1,   0,   0,   0,  70,   2, 
-     16,   0,   6,   0,   0,   0, 
-     54,   0,   0,   5,  18,   0, 
-     16,   0,   7,   0,   0,   0, 
-     42,   0,  16,   0,   5,   0, 
-      0,   0,  54,   0,   0,   5, 
-     34,   0,  16,   0,   7,   0, 
-      0,   0,  10,   0,  16,   0, 
-      6,   0,   0,   0,  54,   0, 
-      0,   5,  66,   0,  16,   0, 
-      7,   0,   0,   0,  10,   0, 
-     16,   0,   3,   0,   0,   0, 
-     54,   0,   0,   5,  18,   0, 
-     16,   0,   8,   0,   0,   0, 
-     10,   0,  16,   0,   5,   0, 
-      0,   0,  54,   0,   0,   5, 
-     34,   0,  16,   0,   8,   0, 
-      0,   0,  26,   0,  16,   0, 
-      6,   0,   0,   0,  54,   0, 
-      0,   5,  66,   0,  16,   0, 
-      8,   0,   0,   0,  26,   0, 
-     16,   0,   3,   0,   0,   0, 
-     54,   0,   0,   5,  18,   0, 
-     16,   0,   3,   0,   0,   0, 
-     26,   0,  16,   0,   5,   0, 
-      0,   0,  54,   0,   0,   5, 
-     34,   0,  16,   0,   3,   0, 
-      0,   0,  42,   0,  16,   0, 
-      6,   0,   0,   0,  54,   0, 
-      0,   5,  66,   0,  16,   0, 
-      3,   0,   0,   0,  42,   0, 
-     16,   0,   3,   0,   0,   0, 
-     16,   0,   0,   7,  18,   0, 
-     16,   0,   5,   0,   0,   0, 
-     70,   2,  16,   0,   4,   0, 
-      0,   0,  70,   2,  16,   0, 
-      7,   0,   0,   0,  16,   0, 
-      0,   7,  34,   0,  16,   0, 
-      5,   0,   0,   0,  70,   2, 
-     16,   0,   4,   0,   0,   0, 
-     70,   2,  16,   0,   8,   0, 
-      0,   0,  16,   0,   0,   7, 
-     66,   0,  16,   0,   5,   0, 
-      0,   0,  70,   2,  16,   0, 
-      4,   0,   0,   0,  70,   2, 
-     16,   0,   3,   0,   0,   0, 
-     16,   0,   0,   7, 130,   0, 
-     16,   0,   1,   0,   0,   0, 
-     70,   2,  16,   0,   5,   0, 
-      0,   0,  70,   2,  16,   0, 
-      5,   0,   0,   0,  68,   0, 
-      0,   5, 130,   0,  16,   0, 
-      1,   0,   0,   0,  58,   0, 
-     16,   0,   1,   0,   0,   0, 
-     56,   0,   0,   7, 114,   0, 
-     16,   0,   3,   0,   0,   0, 
-    246,  15,  16,   0,   1,   0, 
-      0,   0,  70,   2,  16,   0, 
-      5,   0,   0,   0,  54,   0, 
-      0,   5, 114,   0,  16,   0, 
-      3,   0,   0,   0,  70,   2, 
-     16,   0,   3,   0,   0,   0, 
-     54,   0,   0,   6, 114,   0, 
-     16,   0,   4,   0,   0,   0, 
-     70,  18,  16, 128,  65,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   8, 114,   0, 
-     16,   0,   4,   0,   0,   0, 
-     70,   2,  16,   0,   4,   0, 
-      0,   0,  70, 130,  32,   0, 
-      1,   0,   0,   0,   4,   0, 
-      0,   0,  16,   0,   0,   7, 
-    130,   0,  16,   0,   1,   0, 
-      0,   0,  70,   2,  16,   0, 
-      4,   0,   0,   0,  70,   2, 
-     16,   0,   4,   0,   0,   0, 
-     68,   0,   0,   5, 130,   0, 
-     16,   0,   1,   0,   0,   0, 
-     58,   0,  16,   0,   1,   0, 
-      0,   0,  56,   0,   0,   7, 
-    114,   0,  16,   0,   4,   0, 
-      0,   0, 246,  15,  16,   0, 
-      1,   0,   0,   0,  70,   2, 
-     16,   0,   4,   0,   0,   0, 
-     54,   0,   0,   6, 114,   0, 
-     16,   0,   5,   0,   0,   0, 
-     70,   2,  16, 128,  65,   0, 
-      0,   0,   4,   0,   0,   0, 
-     16,   0,   0,   7, 130,   0, 
-     16,   0,   1,   0,   0,   0, 
-     70,   2,  16,   0,   5,   0, 
-      0,   0,  70,   2,  16,   0, 
-      3,   0,   0,   0,   0,   0, 
-      0,   7, 130,   0,  16,   0, 
-      1,   0,   0,   0,  58,   0, 
-     16,   0,   1,   0,   0,   0, 
-     58,   0,  16,   0,   1,   0, 
-      0,   0,  54,   0,   0,   6, 
-    130,   0,  16,   0,   1,   0, 
-      0,   0,  58,   0,  16, 128, 
-     65,   0,   0,   0,   1,   0, 
-      0,   0,  56,   0,   0,   7, 
-    114,   0,  16,   0,   6,   0, 
-      0,   0, 246,  15,  16,   0, 
-      1,   0,   0,   0,  70,   2, 
-     16,   0,   3,   0,   0,   0, 
-      0,   0,   0,   7, 114,   0, 
-     16,   0,   5,   0,   0,   0, 
-     70,   2,  16,   0,   5,   0, 
-      0,   0,  70,   2,  16,   0, 
-      6,   0,   0,   0,  54,   0, 
-      0,   8, 114,   0,  16,   0, 
-      6,   0,   0,   0,   2,  64, 
-      0,   0,  10, 215,  35, 189, 
-     10, 215,  35, 189,  10, 215, 
-     35, 189,   0,   0,   0, 128, 
-      0,   0,   0,   7, 114,   0, 
-     16,   0,   6,   0,   0,   0, 
-    150,   7,  16,   0,   0,   0, 
-      0,   0,  70,   2,  16,   0, 
-      6,   0,   0,   0,  56,   0, 
-      0,   7, 114,   0,  16,   0, 
-      6,   0,   0,   0,   6,   0, 
-     16,   0,   1,   0,   0,   0, 
-     70,   2,  16,   0,   6,   0, 
-      0,   0,   0,   0,   0,  10, 
-    114,   0,  16,   0,   6,   0, 
-      0,   0,  70,   2,  16,   0, 
-      6,   0,   0,   0,   2,  64, 
-      0,   0,  10, 215,  35,  61, 
-     10, 215,  35,  61,  10, 215, 
-     35,  61,   0,   0,   0,   0, 
-     54,   0,   0,   8, 114,   0, 
-     16,   0,   7,   0,   0,   0, 
-      2,  64,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,  54,   0,   0,   5, 
-    130,   0,  16,   0,   1,   0, 
-      0,   0,   1,  64,   0,   0, 
-      0,   0,   0,   0,  54,   0, 
-      0,   5, 114,   0,  16,   0, 
-      8,   0,   0,   0,  70,   2, 
-     16,   0,   7,   0,   0,   0, 
-     54,   0,   0,   5, 130,   0, 
-     16,   0,   2,   0,   0,   0, 
-     58,   0,  16,   0,   1,   0, 
-      0,   0,  48,   0,   0,   1, 
-     34,   0,   0,   7, 130,   0, 
-     16,   0,   3,   0,   0,   0, 
-     58,   0,  16,   0,   2,   0, 
-      0,   0,   1,  64,   0,   0, 
-      4,   0,   0,   0,   3,   0, 
-      0,   3,  58,   0,  16,   0, 
-      3,   0,   0,   0,  54,   0, 
-      0,   6, 114,   0,  16,   0, 
-      9,   0,   0,   0,  70,  18, 
-     16, 128,  65,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   9, 114,   0,  16,   0, 
-      9,   0,   0,   0,  70,   2, 
-     16,   0,   9,   0,   0,   0, 
-     70, 130,  32,   4,   3,   0, 
-      0,   0,  58,   0,  16,   0, 
-      2,   0,   0,   0,  16,   0, 
-      0,   7, 130,   0,  16,   0, 
-      3,   0,   0,   0,  70,   2, 
-     16,   0,   9,   0,   0,   0, 
-     70,   2,  16,   0,   9,   0, 
-      0,   0,  68,   0,   0,   5, 
-    130,   0,  16,   0,   3,   0, 
-      0,   0,  58,   0,  16,   0, 
-      3,   0,   0,   0,  56,   0, 
-      0,   7, 114,   0,  16,   0, 
-      9,   0,   0,   0, 246,  15, 
-     16,   0,   3,   0,   0,   0, 
-     70,   2,  16,   0,   9,   0, 
-      0,   0,   0,   0,   0,   7, 
-    114,   0,  16,   0,  10,   0, 
-      0,   0,  70,   2,  16,   0, 
-      4,   0,   0,   0,  70,   2, 
-     16,   0,   9,   0,   0,   0, 
-     16,   0,   0,   7, 130,   0, 
-     16,   0,   3,   0,   0,   0, 
-     70,   2,  16,   0,  10,   0, 
-      0,   0,  70,   2,  16,   0, 
-     10,   0,   0,   0,  68,   0, 
-      0,   5, 130,   0,  16,   0, 
-      3,   0,   0,   0,  58,   0, 
-     16,   0,   3,   0,   0,   0, 
-     56,   0,   0,   7, 114,   0, 
-     16,   0,  10,   0,   0,   0, 
-    246,  15,  16,   0,   3,   0, 
-      0,   0,  70,   2,  16,   0, 
-     10,   0,   0,   0,  54,   0, 
-      0,   6, 114,   0,  16,   0, 
-     11,   0,   0,   0,  70,  18, 
-     16, 128,  65,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   9, 114,   0,  16,   0, 
-     11,   0,   0,   0,  70,   2, 
-     16,   0,  11,   0,   0,   0, 
-     70, 130,  32,   4,   3,   0, 
-      0,   0,  58,   0,  16,   0, 
-      2,   0,   0,   0,  16,   0, 
-      0,   7, 130,   0,  16,   0, 
-      3,   0,   0,   0,  70,   2, 
-     16,   0,  11,   0,   0,   0, 
-     70,   2,  16,   0,  11,   0, 
-      0,   0,  75,   0,   0,   5, 
-    130,   0,  16,   0,   3,   0, 
-      0,   0,  58,   0,  16,   0, 
-      3,   0,   0,   0,  56,   0, 
-      0,   7, 130,   0,  16,   0, 
-      3,   0,   0,   0,  58,   0, 
-     16,   0,   3,   0,   0,   0, 
-     58,   0,  16,   0,   3,   0, 
-      0,   0,  14,   0,   0,   7, 
-    130,   0,  16,   0,   3,   0, 
-      0,   0,   1,  64,   0,   0, 
-      0,   0, 128,  63,  58,   0, 
-     16,   0,   3,   0,   0,   0, 
-     56,   0,   0,  10, 114,   0, 
-     16,   0,  11,   0,   0,   0, 
-    246,  15,  16,   0,   3,   0, 
-      0,   0,  70, 130,  32,   6, 
-      3,   0,   0,   0,   4,   0, 
-      0,   0,  58,   0,  16,   0, 
-      2,   0,   0,   0,  58,   0, 
-      0,   1,  54,   0,   0,   5, 
-    114,   0,  16,   0,  12,   0, 
-      0,   0,  70,   2,  16,   0, 
-      3,   0,   0,   0,  54,   0, 
-      0,   5, 114,   0,  16,   0, 
-     10,   0,   0,   0,  70,   2, 
-     16,   0,  10,   0,   0,   0, 
-     54,   0,   0,   5, 130,   0, 
-     16,   0,   3,   0,   0,   0, 
-     26,   0,  16,   0,   1,   0, 
-      0,   0,  56,   0,   0,   7, 
-    130,   0,  16,   0,   3,   0, 
-      0,   0,  58,   0,  16,   0, 
-      3,   0,   0,   0,  58,   0, 
-     16,   0,   3,   0,   0,   0, 
-     56,   0,   0,   7, 130,   0, 
-     16,   0,   3,   0,   0,   0, 
-     58,   0,  16,   0,   3,   0, 
-      0,   0,  58,   0,  16,   0, 
-      3,   0,   0,   0,  16,   0, 
-      0,   7, 130,   0,  16,   0, 
-      4,   0,   0,   0,  70,   2, 
-     16,   0,  12,   0,   0,   0, 
-     70,   2,  16,   0,  10,   0, 
-      0,   0,  52,   0,   0,   7, 
-    130,   0,  16,   0,   4,   0, 
-      0,   0,  58,   0,  16,   0, 
-      4,   0,   0,   0,   1,  64, 
-      0,   0,   0,   0,   0,   0, 
-     56,   0,   0,   7, 130,   0, 
-     16,   0,   4,   0,   0,   0, 
-     58,   0,  16,   0,   4,   0, 
-      0,   0,  58,   0,  16,   0, 
-      4,   0,   0,   0,  54,   0, 
-      0,   5, 130,   0,  16,   0, 
-      3,   0,   0,   0,  58,   0, 
-     16,   0,   3,   0,   0,   0, 
-     54,   0,   0,   5, 130,   0, 
-     16,   0,   5,   0,   0,   0, 
-      1,  64,   0,   0,   0,   0, 
-    128, 191,   0,   0,   0,   7, 
-    130,   0,  16,   0,   5,   0, 
-      0,   0,  58,   0,  16,   0, 
-      3,   0,   0,   0,  58,   0, 
-     16,   0,   5,   0,   0,   0, 
-     56,   0,   0,   7, 130,   0, 
-     16,   0,   4,   0,   0,   0, 
-     58,   0,  16,   0,   4,   0, 
-      0,   0,  58,   0,  16,   0, 
-      5,   0,   0,   0,   0,   0, 
-      0,   7, 130,   0,  16,   0, 
-      4,   0,   0,   0,  58,   0, 
-     16,   0,   4,   0,   0,   0, 
-      1,  64,   0,   0,   0,   0, 
-    128,  63,  56,   0,   0,   7, 
-    130,   0,  16,   0,   5,   0, 
-      0,   0,  10,   0,  16,   0, 
-      0,   0,   0,   0,  58,   0, 
-     16,   0,   4,   0,   0,   0, 
-     56,   0,   0,   7, 130,   0, 
-     16,   0,   4,   0,   0,   0, 
-     58,   0,  16,   0,   4,   0, 
-      0,   0,  58,   0,  16,   0, 
-      5,   0,   0,   0,  14,   0, 
-      0,   7, 130,   0,  16,   0, 
-      3,   0,   0,   0,  58,   0, 
-     16,   0,   3,   0,   0,   0, 
-     58,   0,  16,   0,   4,   0, 
-      0,   0,  54,   0,   0,   5, 
-    130,   0,  16,   0,   3,   0, 
-      0,   0,  58,   0,  16,   0, 
-      3,   0,   0,   0,  58,   0, 
-      0,   1,  54,   0,   0,   5, 
-    114,   0,  16,   0,  12,   0, 
-      0,   0,  70,   2,  16,   0, 
-      3,   0,   0,   0,  54,   0, 
-      0,   5, 114,   0,  16,   0, 
-     13,   0,   0,   0,  70,   2, 
-     16,   0,   4,   0,   0,   0, 
-     54,   0,   0,   5, 114,   0, 
-     16,   0,   9,   0,   0,   0, 
-     70,   2,  16,   0,   9,   0, 
-      0,   0,  54,   0,   0,   5, 
-    130,   0,  16,   0,   4,   0, 
-      0,   0,  26,   0,  16,   0, 
-      1,   0,   0,   0,  16,   0, 
-      0,   7, 130,   0,  16,   0, 
-      5,   0,   0,   0,  70,   2, 
-     16,   0,  12,   0,   0,   0, 
-     70,   2,  16,   0,  13,   0, 
-      0,   0,  52,   0,   0,   7, 
-    130,   0,  16,   0,   5,   0, 
-      0,   0,  58,   0,  16,   0, 
-      5,   0,   0,   0,   1,  64, 
-      0,   0,   0,   0,   0,   0, 
-     16,   0,   0,   7, 130,   0, 
-     16,   0,   6,   0,   0,   0, 
-     70,   2,  16,   0,  12,   0, 
-      0,   0,  70,   2,  16,   0, 
-      9,   0,   0,   0,  52,   0, 
-      0,   7, 130,   0,  16,   0, 
-      6,   0,   0,   0,  58,   0, 
-     16,   0,   6,   0,   0,   0, 
-      1,  64,   0,   0,   0,   0, 
-      0,   0,  58,   0,   0,   1, 
-     54,   0,   0,   5, 130,   0, 
-     16,   0,   5,   0,   0,   0, 
-     58,   0,  16,   0,   5,   0, 
-      0,   0,  54,   0,   0,   5, 
-    130,   0,  16,   0,   4,   0, 
-      0,   0,  58,   0,  16,   0, 
-      4,   0,   0,   0,   0,   0, 
-      0,   7, 130,   0,  16,   0, 
-      7,   0,   0,   0,  58,   0, 
-     16,   0,   4,   0,   0,   0, 
-      1,  64,   0,   0,   0,   0, 
-    128,  63,  56,   0,   0,   7, 
-    130,   0,  16,   0,   7,   0, 
-      0,   0,  58,   0,  16,   0, 
-      7,   0,   0,   0,  58,   0, 
-     16,   0,   7,   0,   0,   0, 
-     14,   0,   0,   7, 130,   0, 
-     16,   0,   7,   0,   0,   0, 
-     58,   0,  16,   0,   7,   0, 
-      0,   0,   1,  64,   0,   0, 
-      0,   0,   0,  65,  54,   0, 
-      0,   5, 130,   0,  16,   0, 
-      5,   0,   0,   0,  58,   0, 
-     16,   0,   5,   0,   0,   0, 
-     54,   0,   0,   6, 130,   0, 
-     16,   0,   8,   0,   0,   0, 
-     58,   0,  16, 128,  65,   0, 
-      0,   0,   7,   0,   0,   0, 
-      0,   0,   0,   7, 130,   0, 
-     16,   0,   8,   0,   0,   0, 
-     58,   0,  16,   0,   8,   0, 
-      0,   0,   1,  64,   0,   0, 
-      0,   0, 128,  63,  56,   0, 
-      0,   7, 130,   0,  16,   0, 
-      8,   0,   0,   0,  58,   0, 
-     16,   0,   5,   0,   0,   0, 
-     58,   0,  16,   0,   8,   0, 
-      0,   0,   0,   0,   0,   7, 
-    130,   0,  16,   0,   7,   0, 
-      0,   0,  58,   0,  16,   0, 
-      7,   0,   0,   0,  58,   0, 
-     16,   0,   8,   0,   0,   0, 
-     14,   0,   0,   7, 130,   0, 
-     16,   0,   5,   0,   0,   0, 
-     58,   0,  16,   0,   5,   0, 
-      0,   0,  58,   0,  16,   0, 
-      7,   0,   0,   0,  54,   0, 
-      0,   5, 130,   0,  16,   0, 
-      5,   0,   0,   0,  58,   0, 
-     16,   0,   5,   0,   0,   0, 
-     58,   0,   0,   1,  54,   0, 
-      0,   5, 130,   0,  16,   0, 
-      6,   0,   0,   0,  58,   0, 
-     16,   0,   6,   0,   0,   0, 
-      0,   0,   0,   7, 130,   0, 
-     16,   0,   4,   0,   0,   0, 
-     58,   0,  16,   0,   4,   0, 
-      0,   0,   1,  64,   0,   0, 
-      0,   0, 128,  63,  56,   0, 
-      0,   7, 130,   0,  16,   0, 
-      4,   0,   0,   0,  58,   0, 
-     16,   0,   4,   0,   0,   0, 
-     58,   0,  16,   0,   4,   0, 
-      0,   0,  14,   0,   0,   7, 
-    130,   0,  16,   0,   4,   0, 
-      0,   0,  58,   0,  16,   0, 
-      4,   0,   0,   0,   1,  64, 
-      0,   0,   0,   0,   0,  65, 
-     54,   0,   0,   5, 130,   0, 
-     16,   0,   6,   0,   0,   0, 
-     58,   0,  16,   0,   6,   0, 
-      0,   0,  54,   0,   0,   6, 
-    130,   0,  16,   0,   7,   0, 
-      0,   0,  58,   0,  16, 128, 
-     65,   0,   0,   0,   4,   0, 
-      0,   0,   0,   0,   0,   7, 
-    130,   0,  16,   0,   7,   0, 
-      0,   0,  58,   0,  16,   0, 
-      7,   0,   0,   0,   1,  64, 
-      0,   0,   0,   0, 128,  63, 
-     56,   0,   0,   7, 130,   0, 
-     16,   0,   7,   0,   0,   0, 
-     58,   0,  16,   0,   6,   0, 
-      0,   0,  58,   0,  16,   0, 
-      7,   0,   0,   0,   0,   0, 
-      0,   7, 130,   0,  16,   0, 
-      4,   0,   0,   0,  58,   0, 
-     16,   0,   4,   0,   0,   0, 
-     58,   0,  16,   0,   7,   0, 
-      0,   0,  14,   0,   0,   7, 
-    130,   0,  16,   0,   4,   0, 
-      0,   0,  58,   0,  16,   0, 
-      6,   0,   0,   0,  58,   0, 
-     16,   0,   4,   0,   0,   0, 
-     54,   0,   0,   5, 130,   0, 
-     16,   0,   4,   0,   0,   0, 
-     58,   0,  16,   0,   4,   0, 
-      0,   0,  56,   0,   0,   7, 
-    130,   0,  16,   0,   4,   0, 
-      0,   0,  58,   0,  16,   0, 
-      5,   0,   0,   0,  58,   0, 
-     16,   0,   4,   0,   0,   0, 
-     54,   0,   0,   5, 130,   0, 
-     16,   0,   4,   0,   0,   0, 
-     58,   0,  16,   0,   4,   0, 
-      0,   0,  58,   0,   0,   1, 
-     16,   0,   0,   7, 130,   0, 
-     16,   0,   5,   0,   0,   0, 
-     70,   2,  16,   0,  10,   0, 
-      0,   0,  70,   2,  16,   0, 
-      4,   0,   0,   0,  52,   0, 
-      0,   7, 130,   0,  16,   0, 
-      5,   0,   0,   0,  58,   0, 
-     16,   0,   5,   0,   0,   0, 
-      1,  64,   0,   0,   0,   0, 
-      0,   0,  51,   0,   0,   7, 
-    130,   0,  16,   0,   5,   0, 
-      0,   0,  58,   0,  16,   0, 
-      5,   0,   0,   0,   1,  64, 
-      0,   0,   0,   0, 128,  63, 
-     54,   0,   0,   5, 114,   0, 
-     16,   0,  10,   0,   0,   0, 
-     70,   2,  16,   0,   6,   0, 
-      0,   0,  54,   0,   0,   6, 
-    114,   0,  16,   0,  12,   0, 
-      0,   0,  70,   2,  16, 128, 
-     65,   0,   0,   0,  10,   0, 
-      0,   0,   0,   0,   0,  10, 
-    114,   0,  16,   0,  12,   0, 
-      0,   0,  70,   2,  16,   0, 
-     12,   0,   0,   0,   2,  64, 
-      0,   0,   0,   0, 128,  63, 
-      0,   0, 128,  63,   0,   0, 
-    128,  63,   0,   0,   0,   0, 
-     54,   0,   0,   6, 130,   0, 
-     16,   0,   5,   0,   0,   0, 
-     58,   0,  16, 128,  65,   0, 
-      0,   0,   5,   0,   0,   0, 
-      0,   0,   0,   7, 130,   0, 
-     16,   0,   5,   0,   0,   0, 
-     58,   0,  16,   0,   5,   0, 
-      0,   0,   1,  64,   0,   0, 
-      0,   0, 128,  63,  52,   0, 
-      0,   7, 130,   0,  16,   0, 
-      5,   0,   0,   0,  58,   0, 
-     16,   0,   5,   0,   0,   0, 
-      1,  64,   0,   0,   0,   0, 
-      0,   0,  51,   0,   0,   7, 
-    130,   0,  16,   0,   5,   0, 
-      0,   0,  58,   0,  16,   0, 
-      5,   0,   0,   0,   1,  64, 
-      0,   0,   0,   0, 128,  63, 
-     54,   0,   0,   5, 130,   0, 
-     16,   0,   6,   0,   0,   0, 
-      1,  64,   0,   0,   0,   0, 
-    128,  63,  56,   0,   0,   7, 
-    130,   0,  16,   0,   6,   0, 
-      0,   0,  58,   0,  16,   0, 
-      5,   0,   0,   0,  58,   0, 
-     16,   0,   6,   0,   0,   0, 
-     56,   0,   0,   7, 130,   0, 
-     16,   0,   5,   0,   0,   0, 
-     58,   0,  16,   0,   5,   0, 
-      0,   0,  58,   0,  16,   0, 
-      5,   0,   0,   0,  56,   0, 
-      0,   7, 130,   0,  16,   0, 
-      5,   0,   0,   0,  58,   0, 
-     16,   0,   5,   0,   0,   0, 
-     58,   0,  16,   0,   5,   0, 
-      0,   0,  56,   0,   0,   7, 
-    130,   0,  16,   0,   5,   0, 
-      0,   0,  58,   0,  16,   0, 
-      5,   0,   0,   0,  58,   0, 
-     16,   0,   6,   0,   0,   0, 
-     56,   0,   0,   7, 114,   0, 
-     16,   0,  12,   0,   0,   0, 
-    246,  15,  16,   0,   5,   0, 
-      0,   0,  70,   2,  16,   0, 
-     12,   0,   0,   0,   0,   0, 
-      0,   7, 114,   0,  16,   0, 
-     10,   0,   0,   0,  70,   2, 
-     16,   0,  10,   0,   0,   0, 
-     70,   2,  16,   0,  12,   0, 
-      0,   0,  54,   0,   0,   5, 
-    114,   0,  16,   0,  10,   0, 
-      0,   0,  70,   2,  16,   0, 
-     10,   0,   0,   0,  56,   0, 
-      0,   7, 130,   0,  16,   0, 
-      3,   0,   0,   0,  58,   0, 
-     16,   0,   3,   0,   0,   0, 
-     58,   0,  16,   0,   4,   0, 
-      0,   0,  56,   0,   0,   7, 
-    114,   0,  16,   0,  12,   0, 
-      0,   0,  70,   2,  16,   0, 
-     10,   0,   0,   0, 246,  15, 
-     16,   0,   3,   0,   0,   0, 
-     43,   0,   0,   5, 130,   0, 
-     16,   0,   3,   0,   0,   0, 
-      1,  64,   0,   0,   4,   0, 
-      0,   0,  16,   0,   0,   7, 
-    130,   0,  16,   0,   4,   0, 
-      0,   0,  70,   2,  16,   0, 
-      3,   0,   0,   0,  70,   2, 
-     16,   0,   4,   0,   0,   0, 
-     52,   0,   0,   7, 130,   0, 
-     16,   0,   4,   0,   0,   0, 
-     58,   0,  16,   0,   4,   0, 
-      0,   0,   1,  64,   0,   0, 
-      0,   0,   0,   0,  56,   0, 
-      0,   7, 130,   0,  16,   0, 
-      3,   0,   0,   0,  58,   0, 
-     16,   0,   3,   0,   0,   0, 
-     58,   0,  16,   0,   4,   0, 
-      0,   0,  16,   0,   0,   7, 
-    130,   0,  16,   0,   4,   0, 
-      0,   0,  70,   2,  16,   0, 
-      3,   0,   0,   0,  70,   2, 
-     16,   0,   9,   0,   0,   0, 
-     52,   0,   0,   7, 130,   0, 
-     16,   0,   4,   0,   0,   0, 
-     58,   0,  16,   0,   4,   0, 
-      0,   0,   1,  64,   0,   0, 
-      0,   0,   0,   0,  56,   0, 
-      0,   7, 130,   0,  16,   0, 
-      3,   0,   0,   0,  58,   0, 
-     16,   0,   3,   0,   0,   0, 
-     58,   0,  16,   0,   4,   0, 
-      0,   0,   0,   0,   0,   7, 
-    130,   0,  16,   0,   3,   0, 
-      0,   0,  58,   0,  16,   0, 
-      3,   0,   0,   0,   1,  64, 
-      0,   0,  23, 183, 209,  56, 
-     14,   0,   0,   7, 114,   0, 
-     16,   0,  12,   0,   0,   0, 
-     70,   2,  16,   0,  12,   0, 
-      0,   0, 246,  15,  16,   0, 
-      3,   0,   0,   0,  54,   0, 
-      0,   5, 114,   0,  16,   0, 
-     10,   0,   0,   0,  70,   2, 
-     16,   0,  10,   0,   0,   0, 
-     54,   0,   0,   6, 114,   0, 
-     16,   0,  10,   0,   0,   0, 
-     70,   2,  16, 128,  65,   0, 
-      0,   0,  10,   0,   0,   0, 
-      0,   0,   0,  10, 114,   0, 
-     16,   0,  10,   0,   0,   0, 
-     70,   2,  16,   0,  10,   0, 
-      0,   0,   2,  64,   0,   0, 
-      0,   0, 128,  63,   0,   0, 
-    128,  63,   0,   0, 128,  63, 
-      0,   0,   0,   0,  54,   0, 
-      0,   6, 130,   0,  16,   0, 
-      3,   0,   0,   0,  10,   0, 
-     16, 128,  65,   0,   0,   0, 
-      1,   0,   0,   0,   0,   0, 
-      0,   7, 130,   0,  16,   0, 
-      3,   0,   0,   0,  58,   0, 
-     16,   0,   3,   0,   0,   0, 
-      1,  64,   0,   0,   0,   0, 
-    128,  63,  56,   0,   0,   7, 
-    114,   0,  16,   0,  10,   0, 
-      0,   0, 246,  15,  16,   0, 
-      3,   0,   0,   0,  70,   2, 
-     16,   0,  10,   0,   0,   0, 
-     16,   0,   0,   7, 130,   0, 
-     16,   0,   3,   0,   0,   0, 
-     70,   2,  16,   0,   3,   0, 
-      0,   0,  70,   2,  16,   0, 
-      9,   0,   0,   0,  52,   0, 
-      0,   7, 130,   0,  16,   0, 
-      3,   0,   0,   0,  58,   0, 
-     16,   0,   3,   0,   0,   0, 
-      1,  64,   0,   0,   0,   0, 
-      0,   0,  56,   0,   0,   7, 
-    114,   0,  16,   0,   9,   0, 
-      0,   0, 150,   7,  16,   0, 
-      0,   0,   0,   0,  70,   2, 
-     16,   0,  10,   0,   0,   0, 
-     14,   0,   0,   7, 114,   0, 
-     16,   0,   9,   0,   0,   0, 
-     70,   2,  16,   0,   9,   0, 
-      0,   0,   6,   0,  16,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   7, 114,   0,  16,   0, 
-      9,   0,   0,   0,  70,   2, 
-     16,   0,  12,   0,   0,   0, 
-     70,   2,  16,   0,   9,   0, 
-      0,   0,  56,   0,   0,   7, 
-    114,   0,  16,   0,   9,   0, 
-      0,   0,  70,   2,  16,   0, 
-     11,   0,   0,   0,  70,   2, 
-     16,   0,   9,   0,   0,   0, 
-     56,   0,   0,   7, 114,   0, 
-     16,   0,   9,   0,   0,   0, 
-    246,  15,  16,   0,   3,   0, 
-      0,   0,  70,   2,  16,   0, 
-      9,   0,   0,   0,   0,   0, 
-      0,   7, 114,   0,  16,   0, 
-      8,   0,   0,   0,  70,   2, 
-     16,   0,   8,   0,   0,   0, 
-     70,   2,  16,   0,   9,   0, 
-      0,   0,  30,   0,   0,   7, 
-    130,   0,  16,   0,   2,   0, 
-      0,   0,  58,   0,  16,   0, 
-      2,   0,   0,   0,   1,  64, 
-      0,   0,   1,   0,   0,   0, 
-     22,   0,   0,   1,  58,   0, 
-      0,   1,  16,   0,   0,   7, 
-     18,   0,  16,   0,   0,   0, 
-      0,   0,  70,   2,  16,   0, 
-      3,   0,   0,   0,  70,   2, 
-     16,   0,   4,   0,   0,   0, 
-     52,   0,   0,   7,  18,   0, 
-     16,   0,   0,   0,   0,   0, 
-     10,   0,  16,   0,   0,   0, 
-      0,   0,   1,  64,   0,   0, 
-      0,   0,   0,   0,  54,   0, 
-      0,   5, 114,   0,  16,   0, 
-      6,   0,   0,   0,  70,   2, 
-     16,   0,   6,   0,   0,   0, 
-     54,   0,   0,   5,  34,   0, 
-     16,   0,   1,   0,   0,   0, 
-     26,   0,  16,   0,   1,   0, 
-      0,   0,  54,   0,   0,   6, 
-    130,   0,  16,   0,   1,   0, 
-      0,   0,  26,   0,  16, 128, 
-     65,   0,   0,   0,   1,   0, 
-      0,   0,   0,   0,   0,   7, 
-    130,   0,  16,   0,   1,   0, 
-      0,   0,  58,   0,  16,   0, 
-      1,   0,   0,   0,   1,  64, 
-      0,   0,   0,   0, 128,  63, 
-     52,   0,   0,   7, 114,   0, 
-     16,   0,   7,   0,   0,   0, 
-     70,   2,  16,   0,   6,   0, 
-      0,   0, 246,  15,  16,   0, 
-      1,   0,   0,   0,  54,   0, 
-      0,   6, 114,   0,  16,   0, 
-      9,   0,   0,   0,  70,   2, 
-     16, 128,  65,   0,   0,   0, 
-      6,   0,   0,   0,   0,   0, 
-      0,   7, 114,   0,  16,   0, 
-      7,   0,   0,   0,  70,   2, 
-     16,   0,   7,   0,   0,   0, 
-     70,   2,  16,   0,   9,   0, 
-      0,   0,  54,   0,   0,   6, 
-     18,   0,  16,   0,   0,   0, 
-      0,   0,  10,   0,  16, 128, 
-     65,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   7, 
-     18,   0,  16,   0,   0,   0, 
-      0,   0,  10,   0,  16,   0, 
-      0,   0,   0,   0,   1,  64, 
-      0,   0,   0,   0, 128,  63, 
-     52,   0,   0,   7,  18,   0, 
-     16,   0,   0,   0,   0,   0, 
-     10,   0,  16,   0,   0,   0, 
-      0,   0,   1,  64,   0,   0, 
-      0,   0,   0,   0,  51,   0, 
-      0,   7,  18,   0,  16,   0, 
-      0,   0,   0,   0,  10,   0, 
-     16,   0,   0,   0,   0,   0, 
-      1,  64,   0,   0,   0,   0, 
-    128,  63,  54,   0,   0,   5, 
-    130,   0,  16,   0,   1,   0, 
-      0,   0,   1,  64,   0,   0, 
-      0,   0, 128,  63,  56,   0, 
-      0,   7, 130,   0,  16,   0, 
-      1,   0,   0,   0,  10,   0, 
-     16,   0,   0,   0,   0,   0, 
-     58,   0,  16,   0,   1,   0, 
-      0,   0,  56,   0,   0,   7, 
-     18,   0,  16,   0,   0,   0, 
-      0,   0,  10,   0,  16,   0, 
-      0,   0,   0,   0,  10,   0, 
-     16,   0,   0,   0,   0,   0, 
-     56,   0,   0,   7,  18,   0, 
-     16,   0,   0,   0,   0,   0, 
-     10,   0,  16,   0,   0,   0, 
-      0,   0,  10,   0,  16,   0, 
-      0,   0,   0,   0,  56,   0, 
-      0,   7,  18,   0,  16,   0, 
-      0,   0,   0,   0,  10,   0, 
-     16,   0,   0,   0,   0,   0, 
-     58,   0,  16,   0,   1,   0, 
-      0,   0,  56,   0,   0,   7, 
-    114,   0,  16,   0,   7,   0, 
-      0,   0,   6,   0,  16,   0, 
-      0,   0,   0,   0,  70,   2, 
-     16,   0,   7,   0,   0,   0, 
-      0,   0,   0,   7, 114,   0, 
-     16,   0,   7,   0,   0,   0, 
-     70,   2,  16,   0,   6,   0, 
-      0,   0,  70,   2,  16,   0, 
-      7,   0,   0,   0,  54,   0, 
-      0,   5, 114,   0,  16,   0, 
-      7,   0,   0,   0,  70,   2, 
-     16,   0,   7,   0,   0,   0, 
-     69,   0,   0, 139, 130,   1, 
-      0, 128,  67,  85,  21,   0, 
-    114,   0,  16,   0,   5,   0, 
-      0,   0,  70,   2,  16,   0, 
-      5,   0,   0,   0,  70, 126, 
-     16,   0,   6,   0,   0,   0, 
-      0,  96,  16,   0,   0,   0, 
-      0,   0,  54,   0,   0,   5, 
-    114,   0,  16,   0,   5,   0, 
-      0,   0,  70,   2,  16,   0, 
-      5,   0,   0,   0,  16,   0, 
-      0,   7,  18,   0,  16,   0, 
-      0,   0,   0,   0,  70,   2, 
-     16,   0,   3,   0,   0,   0, 
-     70,   2,  16,   0,   4,   0, 
-      0,   0,  52,   0,   0,   7, 
-     18,   0,  16,   0,   1,   0, 
-      0,   0,  10,   0,  16,   0, 
-      0,   0,   0,   0,   1,  64, 
-      0,   0,   0,   0,   0,   0, 
-     54,   0,   0,   5,  34,   0, 
-     16,   0,   1,   0,   0,   0, 
-     26,   0,  16,   0,   1,   0, 
-      0,   0,  69,   0,   0, 139, 
-    194,   0,   0, 128,  67,  85, 
-     21,   0,  50,   0,  16,   0, 
-      1,   0,   0,   0,  70,   0, 
-     16,   0,   1,   0,   0,   0, 
-     70, 126,  16,   0,   7,   0, 
-      0,   0,   0,  96,  16,   0, 
-      0,   0,   0,   0,  54,   0, 
-      0,   5,  50,   0,  16,   0, 
-      1,   0,   0,   0,  70,   0, 
-     16,   0,   1,   0,   0,   0, 
-     56,   0,   0,   7, 114,   0, 
-     16,   0,   7,   0,   0,   0, 
-      6,   0,  16,   0,   1,   0, 
-      0,   0,  70,   2,  16,   0, 
-      7,   0,   0,   0,   0,   0, 
-      0,   7, 178,   0,  16,   0, 
-      1,   0,   0,   0,  86,   5, 
-     16,   0,   1,   0,   0,   0, 
-     70,   8,  16,   0,   7,   0, 
-      0,   0,  56,   0,   0,   7, 
-    178,   0,  16,   0,   1,   0, 
-      0,   0,  70,  12,  16,   0, 
-      1,   0,   0,   0,  70,   8, 
-     16,   0,   5,   0,   0,   0, 
-     58,   0,   0,   1,  16,   0, 
-      0,   7,  18,   0,  16,   0, 
-      0,   0,   0,   0,  70,   2, 
-     16,   0,   3,   0,   0,   0, 
-     70,   2,  16,   0,   4,   0, 
-      0,   0,  52,   0,   0,   7, 
-     18,   0,  16,   0,   0,   0, 
-      0,   0,  10,   0,  16,   0, 
-      0,   0,   0,   0,   1,  64, 
-      0,   0,   0,   0,   0,   0, 
-     54,   0,   0,   5, 114,   0, 
-     16,   0,   6,   0,   0,   0, 
-     70,   2,  16,   0,   6,   0, 
-      0,   0,  54,   0,   0,   6, 
-    114,   0,  16,   0,   4,   0, 
-      0,   0,  70,   2,  16, 128, 
-     65,   0,   0,   0,   6,   0, 
-      0,   0,   0,   0,   0,  10, 
-    114,   0,  16,   0,   4,   0, 
-      0,   0,  70,   2,  16,   0, 
-      4,   0,   0,   0,   2,  64, 
-      0,   0,   0,   0, 128,  63, 
-      0,   0, 128,  63,   0,   0, 
-    128,  63,   0,   0,   0,   0, 
-     54,   0,   0,   6,  18,   0, 
-     16,   0,   0,   0,   0,   0, 
-     10,   0,  16, 128,  65,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   7,  18,   0, 
-     16,   0,   0,   0,   0,   0, 
-     10,   0,  16,   0,   0,   0, 
-      0,   0,   1,  64,   0,   0, 
-      0,   0, 128,  63,  52,   0, 
-      0,   7,  18,   0,  16,   0, 
-      0,   0,   0,   0,  10,   0, 
-     16,   0,   0,   0,   0,   0, 
-      1,  64,   0,   0,   0,   0, 
-      0,   0,  51,   0,   0,   7, 
-     18,   0,  16,   0,   0,   0, 
-      0,   0,  10,   0,  16,   0, 
-      0,   0,   0,   0,   1,  64, 
-      0,   0,   0,   0, 128,  63, 
-     54,   0,   0,   5, 130,   0, 
-     16,   0,   2,   0,   0,   0, 
-      1,  64,   0,   0,   0,   0, 
-    128,  63,  56,   0,   0,   7, 
-    130,   0,  16,   0,   2,   0, 
-      0,   0,  10,   0,  16,   0, 
-      0,   0,   0,   0,  58,   0, 
-     16,   0,   2,   0,   0,   0, 
-     56,   0,   0,   7,  18,   0, 
-     16,   0,   0,   0,   0,   0, 
-     10,   0,  16,   0,   0,   0, 
-      0,   0,  10,   0,  16,   0, 
-      0,   0,   0,   0,  56,   0, 
-      0,   7,  18,   0,  16,   0, 
-      0,   0,   0,   0,  10,   0, 
-     16,   0,   0,   0,   0,   0, 
-     10,   0,  16,   0,   0,   0, 
-      0,   0,  56,   0,   0,   7, 
-     18,   0,  16,   0,   0,   0, 
-      0,   0,  10,   0,  16,   0, 
-      0,   0,   0,   0,  58,   0, 
-     16,   0,   2,   0,   0,   0, 
-     56,   0,   0,   7, 114,   0, 
-     16,   0,   4,   0,   0,   0, 
-      6,   0,  16,   0,   0,   0, 
-      0,   0,  70,   2,  16,   0, 
-      4,   0,   0,   0,   0,   0, 
-      0,   7, 114,   0,  16,   0, 
-      4,   0,   0,   0,  70,   2, 
-     16,   0,   4,   0,   0,   0, 
-     70,   2,  16,   0,   6,   0, 
-      0,   0,  54,   0,   0,   5, 
-    114,   0,  16,   0,   4,   0, 
-      0,   0,  70,   2,  16,   0, 
-      4,   0,   0,   0,  54,   0, 
-      0,   6, 114,   0,  16,   0, 
-      4,   0,   0,   0,  70,   2, 
-     16, 128,  65,   0,   0,   0, 
-      4,   0,   0,   0,   0,   0, 
-      0,  10, 114,   0,  16,   0, 
-      4,   0,   0,   0,  70,   2, 
-     16,   0,   4,   0,   0,   0, 
-      2,  64,   0,   0,   0,   0, 
-    128,  63,   0,   0, 128,  63, 
-      0,   0, 128,  63,   0,   0, 
-      0,   0,  69,   0,   0, 139, 
-    130,   1,   0, 128,  67,  85, 
-     21,   0, 114,   0,  16,   0, 
-      3,   0,   0,   0,  70,   2, 
-     16,   0,   3,   0,   0,   0, 
-     70, 126,  16,   0,   5,   0, 
-      0,   0,   0,  96,  16,   0, 
-      0,   0,   0,   0,  54,   0, 
-      0,   5, 114,   0,  16,   0, 
-      3,   0,   0,   0,  70,   2, 
-     16,   0,   3,   0,   0,   0, 
-     56,   0,   0,   7, 114,   0, 
-     16,   0,   0,   0,   0,   0, 
-    150,   7,  16,   0,   0,   0, 
-      0,   0,  70,   2,  16,   0, 
-      3,   0,   0,   0,  56,   0, 
-      0,   7, 114,   0,  16,   0, 
-      0,   0,   0,   0,  70,   2, 
-     16,   0,   0,   0,   0,   0, 
-     70,   2,  16,   0,   4,   0, 
-      0,   0,   0,   0,   0,   7, 
-    114,   0,  16,   0,   0,   0, 
-      0,   0,  70,   3,  16,   0, 
-      1,   0,   0,   0,  70,   2, 
-     16,   0,   0,   0,   0,   0, 
-     56,   0,   0,   7, 114,   0, 
-     16,   0,   0,   0,   0,   0, 
-    166,  10,  16,   0,   1,   0, 
-      0,   0,  70,   2,  16,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   7, 114,   0,  16,   0, 
-      0,   0,   0,   0,  70,   2, 
-     16,   0,   8,   0,   0,   0, 
-     70,   2,  16,   0,   0,   0, 
-      0,   0,   0,   0,   0,   7, 
-    114,   0,  16,   0,   0,   0, 
-      0,   0,  70,   2,  16,   0, 
-      2,   0,   0,   0,  70,   2, 
-     16,   0,   0,   0,   0,   0, 
-     58,   0,   0,   1,   0,   0, 
-      0,  10, 114,   0,  16,   0, 
-      1,   0,   0,   0,  70,   2, 
-     16,   0,   0,   0,   0,   0, 
-      2,  64,   0,   0,   0,   0, 
-    128,  63,   0,   0, 128,  63, 
-      0,   0, 128,  63,   0,   0, 
-      0,   0,  14,   0,   0,   7, 
-    114,   0,  16,   0,   0,   0, 
-      0,   0,  70,   2,  16,   0, 
-      0,   0,   0,   0,  70,   2, 
-     16,   0,   1,   0,   0,   0, 
-     58,   0,   0,   1,  54,   0, 
-      0,   5, 130,   0,  16,   0, 
-      0,   0,   0,   0,   1,  64, 
-      0,   0,  47, 186, 232,  62, 
-     47,   0,   0,   5, 114,   0, 
-     16,   0,   0,   0,   0,   0, 
-     70,   2,  16,   0,   0,   0, 
-      0,   0,  56,   0,   0,   7, 
-    114,   0,  16,   0,   0,   0, 
-      0,   0,  70,   2,  16,   0, 
-      0,   0,   0,   0, 246,  15, 
-     16,   0,   0,   0,   0,   0, 
-     25,   0,   0,   5, 114,   0, 
-     16,   0,   0,   0,   0,   0, 
-     70,   2,  16,   0,   0,   0, 
-      0,   0,  54,   0,   0,   5, 
-    114,   0,  16,   0,   0,   0, 
-      0,   0,  70,   2,  16,   0, 
-      0,   0,   0,   0,  54,   0, 
-      0,   5, 114,  32,  16,   0, 
-      0,   0,   0,   0,  70,   2, 
-     16,   0,   0,   0,   0,   0, 
-     54,   0,   0,   5, 130,  32, 
-     16,   0,   0,   0,   0,   0, 
-      1,  64,   0,   0,   0,   0, 
-    128,  63,  62,   0,   0,   1, 
-     83,  84,  65,  84, 148,   0, 
-      0,   0,  19,   1,   0,   0, 
-     14,   0,   0,   0,   0,   0, 
-      0,   0,   4,   0,   0,   0, 
-    194,   0,   0,   0,   2,   0, 
-      0,   0,   0,   0,   0,   0, 
-      1,   0,   0,   0,   1,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   8,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-     56,   0,   0,   0,   0,   0, 
-      0,   0,   1,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-     83,  80,  68,  66,   0, 174, 
-      0,   0,  77, 105,  99, 114, 
-    111, 115, 111, 102, 116,  32, 
-     67,  47,  67,  43,  43,  32, 
-     77,  83,  70,  32,  55,  46, 
-     48,  48,  13,  10,  26,  68, 
-     83,   0,   0,   0,   0,   2, 
-      0,   0,   2,   0,   0,   0, 
-     87,   0,   0,   0, 132,   1, 
-      0,   0,   0,   0,   0,   0, 
-     84,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0, 192, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-     56,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0, 224, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255,   5,   0,   0,   0, 
-     32,   0,   0,   0,  60,   0, 
-      0,   0,   0,   0,   0,   0, 
-    255, 255, 255, 255,   0,   0, 
-      0,   0,   6,   0,   0,   0, 
-      5,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   3,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-    148,  46,  49,   1, 216, 200, 
-    147,  97,   1,   0,   0,   0, 
-     23, 224,   0, 135, 254,  38, 
-    233,  64, 178,  60,   3, 229, 
-    101,  83, 229,  26,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      1,   0,   0,   0,   1,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0, 220,  81,  51,   1, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0, 105, 115, 116, 101, 
-    114,  40, 116,  51,  41,  59, 
-     13,  10,  84, 101, 120, 116, 
-    117, 114, 101,  50,  68,  32, 
-    101, 109, 105, 115, 115, 105, 
-    111, 110,  84, 101, 120,  32, 
-     58,  32, 114, 101, 103, 105, 
-    115, 116, 101, 114,  40, 116, 
-     52,  41,  59,  13,  10,  13, 
-     10,  84, 101, 120, 116, 117, 
-    114, 101,  67, 117,  98, 101, 
-     32, 105, 114, 114,  97, 100, 
-    105,  97, 110,  99, 101,  77, 
-     97, 112,  32,  58,  32, 114, 
-    101, 103, 105, 115, 116, 101, 
-    114,  40, 116,  53,  41,  59, 
-     13,  10,  84, 101, 120, 116, 
-    117, 114, 101,  67, 117,  98, 
-    101,  32, 114,  97, 100, 105, 
-     97, 110,  99, 101,  77,  97, 
-    112,  32,  58,  32, 114, 101, 
-    103, 105, 115, 116, 101, 114, 
-     40, 116,  54,  41,  59,  13, 
-     10,  13,  10,  84, 101, 120, 
-    116, 117, 114, 101,  50,  68, 
-     32,  98, 114, 100, 102,  76, 
-     85,  84,  32,  58,  32, 114, 
-    101, 103, 105, 115, 116, 101, 
-    114,  40, 116,  55,  41,  59, 
-     13,  10,  13,  10,  83,  97, 
-    109, 112, 108, 101, 114,  83, 
-    116,  97, 116, 101,  32, 115, 
-     97, 109, 112, 108, 101,  84, 
-    121, 112, 101,  32,  58,  32, 
-    114, 101, 103, 105, 115, 116, 
-    101, 114,  40, 115,  48,  41, 
-     59,  13,  10,  13,  10,  35, 
-    105, 110,  99, 108, 117, 100, 
-    101,  32,  34,  80,  98, 114, 
-     72, 101, 108, 112, 101, 114, 
-     46, 104, 108, 115, 108,  34, 
-     13,  10,  35, 105, 110,  99, 
-    108, 117, 100, 101,  32,  34, 
-     67, 111, 109, 109, 111, 110, 
-     67, 111, 110, 115, 116,  97, 
-    110, 116,  66, 117, 102, 102, 
-    101, 114, 115,  46, 104, 108, 
-    115, 108,  34,  13,  10,  13, 
-     10,  99,  98, 117, 102, 102, 
-    101, 114,  32,  83, 104,  97, 
-    100, 101, 114,  68,  97, 116, 
-     97,  32,  58,  32, 114, 101, 
-    103, 105, 115, 116, 101, 114, 
-     40,  98,  51,  41,  13,  10, 
-    123,  13,  10,  32,  32,  32, 
-     32, 102, 108, 111,  97, 116, 
-     52,  32, 108, 105, 103, 104, 
-    116,  80, 111, 115, 105, 116, 
-    105, 111, 110, 115,  91,  52, 
-     93,  59,  13,  10,  32,  32, 
-     32,  32, 102, 108, 111,  97, 
-    116,  52,  32, 108, 105, 103, 
-    104, 116,  67, 111, 108, 111, 
-    114, 115,  91,  52,  93,  59, 
-     13,  10,  32,  32,  32,  32, 
-    102, 108, 111,  97, 116,  52, 
-     32,  97, 108,  98, 101, 100, 
-    111,  70,  97,  99, 116, 111, 
-    114,  59,  13,  10,  32,  32, 
-     32,  32, 102, 108, 111,  97, 
-    116,  32, 109, 101, 116,  97, 
-    108, 108, 105,  99,  70,  97, 
-     99, 116, 111, 114,  59,  13, 
-     10,  32,  32,  32,  32, 102, 
-    108, 111,  97, 116,  32, 114, 
-    111, 117, 103, 104, 110, 101, 
-    115, 115,  70,  97,  99, 116, 
-    111, 114,  59,  13,  10,  32, 
-     32,  32,  32, 102, 108, 111, 
-     97, 116,  32,  97, 111,  70, 
-     97,  99, 116, 111, 114,  59, 
-     13,  10, 125,  13,  10,  13, 
-     10, 115, 116, 114, 117,  99, 
-    116,  32,  80, 105, 120, 101, 
-    108,  83, 104,  97, 100, 101, 
-    114,  73, 110, 112,  76, 232, 
-      3,   0, 117, 131,   1,   0, 
-    235, 109,   3,   0,  47,  63, 
-      0,   0,  38, 247,   2,   0, 
-    198,  90,   0,   0, 109,  24, 
-      1,   0, 248,  34,   2,   0, 
-     65,  36,   1,   0, 233, 240, 
-      2,   0, 146, 230,   3,   0, 
-    163,  90,   1,   0, 217, 159, 
-      3,   0,  45, 242,   3,   0, 
-    168, 245,   3,   0, 245,  55, 
-      3,   0,  13,  58,   1,   0, 
-    217, 252,   1,   0, 220,  13, 
-      0,   0,  87, 215,   1,   0, 
-     99,  39,   3,   0, 230,  68, 
-      1,   0, 216, 221,   2,   0, 
-    131,  67,   0,   0, 103, 135, 
-      3,   0, 200, 218,   3,   0, 
-     74, 146,   2,   0,  16, 206, 
-      3,   0, 226, 163,   0,   0, 
-    246, 129,   2,   0, 202, 198, 
-      2,   0, 238, 175,   0,   0, 
-     96,  48,   1,   0, 196, 136, 
-      2,   0,  54, 229,   1,   0, 
-     21, 230,   0,   0, 134,  90, 
-      0,   0, 122, 245,   1,   0, 
-      0,  16,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-     84, 101, 120, 116, 117, 114, 
-    101,  50,  68,  32,  97, 108, 
-     98, 101, 100, 111,  84, 101, 
-    120,  32,  58,  32, 114, 101, 
-    103, 105, 115, 116, 101, 114, 
-     40, 116,  48,  41,  59,  13, 
-     10,  84, 101, 120, 116, 117, 
-    114, 101,  50,  68,  32, 110, 
-    111, 114, 109,  97, 108,  84, 
-    101, 120,  32,  58,  32, 114, 
-    101, 103, 105, 115, 116, 101, 
-    114,  40, 116,  49,  41,  59, 
-     13,  10,  84, 101, 120, 116, 
-    117, 114, 101,  50,  68,  32, 
-    109, 101, 116,  97, 108,  82, 
-    111, 117, 103, 104, 110, 101, 
-    115, 115,  84, 101, 120,  32, 
-     58,  32, 114, 101, 103, 105, 
-    115, 116, 101, 114,  40, 116, 
-     50,  41,  59,  13,  10,  84, 
-    101, 120, 116, 117, 114, 101, 
-     50,  68,  32,  97, 111,  84, 
-    101, 120,  32,  58,  32, 114, 
-    101, 103, 105, 115, 116, 101, 
-    114,  40, 116,  51,  41,  59, 
-     13,  10,  84, 101, 120, 116, 
-    117, 114, 101,  50,  68,  32, 
-    101, 109, 105, 115, 115, 105, 
-    111, 110,  84, 101, 120,  32, 
-     58,  32, 114, 101, 103, 105, 
-    115, 116, 101, 114,  40, 116, 
-     52,  41,  59,  13,  10,  13, 
-     10,  84, 101, 120, 116, 117, 
-    114, 101,  67, 117,  98, 101, 
-     32, 105, 114, 114,  97, 100, 
-    105,  97, 110,  99, 101,  77, 
-     97, 112,  32,  58,  32, 114, 
-    101, 103, 105, 115, 116, 101, 
-    114,  40, 116,  53,  41,  59, 
-     13,  10,  84, 101, 120, 116, 
-    117, 114, 101,  67, 117,  98, 
-    101,  32, 114,  97, 100, 105, 
-     97, 110,  99, 101,  77,  97, 
-    112,  32,  58,  32, 114, 101, 
-    103, 105, 115, 116, 101, 114, 
-     40, 116,  54,  41,  59,  13, 
-     10,  13,  10,  84, 101, 120, 
-    116, 117, 114, 101,  50,  68, 
-     32,  98, 114, 100, 102,  76, 
-     85,  84,  32,  58,  32, 114, 
-    101, 103, 105, 115, 116, 101, 
-    114,  40, 116,  55,  41,  59, 
-     13,  10,  13,  10,  83,  97, 
-    109, 112, 108, 101, 114,  83, 
-    116,  97, 116, 101,  32, 115, 
-     97, 109, 112, 108, 101,  84, 
-    121, 112, 101,  32,  58,  32, 
-    114, 101, 103, 105, 115, 116, 
-    101, 114,  40, 115,  48,  41, 
-     59,  13,  10,  13,  10,  35, 
-    105, 110,  99, 108, 117, 100, 
-    101,  32,  34,  80,  98, 114, 
-     72, 101, 108, 112, 101, 114, 
-     46, 104, 108, 115, 108,  34, 
-     13,  10,  35, 105, 110,  99, 
-    108, 117, 100, 101,  32,  34, 
-     67, 111, 109, 109, 111, 110, 
-     67, 111, 110, 115, 116,  97, 
-    110, 116,  66, 117, 102, 102, 
-    101, 114, 115,  46, 104, 108, 
-    115, 108,  34,  13,  10,  13, 
-     10,  99,  98, 117, 102, 102, 
-    101, 114,  32,  83, 104,  97, 
-    100, 101, 114,  68,  97, 116, 
-     97,  32,  58,  32, 114, 101, 
-    103, 105, 115, 116, 101, 114, 
-     40,  98,  51,  41,  13,  10, 
-    123,  13,  10,  32,  32,  32, 
-     32, 102, 108, 111,  97, 116, 
-     52,  32, 108, 105, 103, 104, 
-    116,  80, 111, 115, 105, 116, 
-    105, 111, 110, 115,  91,  52, 
-     93,  59,  13,  10,  32,  32, 
-     32,  32, 102, 108, 111,  97, 
-    116,  52,  32, 108, 105, 103, 
-    104, 116,  67, 111, 108, 111, 
-    114, 115,  91,  52,  93,  59, 
-     13,  10,  32,  32,  32,  32, 
-    102, 108, 111,  97, 116,  52, 
-     32,  97, 108,  98, 101, 100, 
-    111,  70,  97,  99, 116, 111, 
-    114,  59,  13,  10,  32,  32, 
-     32,  32, 102, 108, 111,  97, 
-    116,  32, 109, 101, 116,  97, 
-    108, 108, 105,  99,  70,  97, 
-     99, 116, 111, 114,  59,  13, 
-     10,  32,  32,  32,  32, 102, 
-    108, 111,  97, 116,  32, 114, 
-    111, 117, 103, 104, 110, 101, 
-    115, 115,  70,  97,  99, 116, 
-    111, 114,  59,  13,  10,  32, 
-     32,  32,  32, 102, 108, 111, 
-     97, 116,  32,  97, 111,  70, 
-     97,  99, 116, 111, 114,  59, 
-     13,  10, 125,  13,  10,  13, 
-     10, 115, 116, 114, 117,  99, 
-    116,  32,  80, 105, 120, 101, 
-    108,  83, 104,  97, 100, 101, 
-    114,  73, 110, 112, 117, 116, 
-     10, 123,  10,  32,  32,  32, 
-     32, 102, 108, 111,  97, 116, 
-     51,  32, 119, 111, 114, 108, 
-    100,  80, 111, 115,  32,  58, 
-     32,  87,  79,  82,  76,  68, 
-     95,  80,  79,  83,  73,  84, 
-     73,  79,  78,  59,  10,  32, 
-     32,  32,  32, 102, 108, 111, 
-     97, 116,  51,  32, 110, 111, 
-    114, 109,  97, 108,  87,  83, 
-     32,  58,  32,  78,  79,  82, 
-     77,  65,  76,  95,  87,  83, 
-     59,  10,  32,  32,  32,  32, 
-    102, 108, 111,  97, 116,  50, 
-     32, 117, 118,  32,  58,  32, 
-     84,  69,  88,  67,  79,  79, 
-     82,  68,  48,  59,  10, 125, 
-     59,  10,  10, 102, 108, 111, 
-     97, 116,  51,  32,  71, 101, 
-    116,  78, 111, 114, 109,  97, 
-    108,  70, 114, 111, 109,  77, 
-     97, 112,  40, 102, 108, 111, 
-     97, 116,  51,  32, 110, 111, 
-    114, 109,  97, 108,  44,  32, 
-    102, 108, 111,  97, 116,  51, 
-     32, 119, 111, 114, 108, 100, 
-     80, 111, 115,  44,  32, 102, 
-    108, 111,  97, 116,  50,  32, 
-    117, 118,  41,  32, 123,  13, 
-     10,  32,  32,  32,  32, 102, 
-    108, 111,  97, 116,  51,  32, 
-    116,  97, 110, 103, 101, 110, 
-    116,  78, 111, 114, 109,  97, 
-    108,  32,  61,  32, 110, 111, 
-    114, 109,  97, 108,  84, 101, 
-    120,  46,  83,  97, 109, 112, 
-    108, 101,  40, 115,  97, 109, 
-    112, 108, 101,  84, 121, 112, 
-    101,  44,  32, 117, 118,  41, 
-     46, 114, 103,  98,  59,  13, 
-     10,  32,  32,  32,  32, 116, 
-     97, 110, 103, 101, 110, 116, 
-     78, 111, 114, 109,  97, 108, 
-     32,  61,  32, 110, 111, 114, 
-    109,  97, 108, 105, 122, 101, 
-     40, 116,  97, 110, 103, 101, 
-    110, 116,  78, 111, 114, 109, 
-     97, 108,  32,  42,  32,  50, 
-     46,  48,  32,  45,  32,  49, 
-     46,  48,  41,  59,  13,  10, 
-     13,  10,  32,  32,  32,  32, 
-    102, 108, 111,  97, 116,  51, 
-     32,  81,  49,  32,  61,  32, 
-    100, 100, 120,  40, 119, 111, 
-    114, 108, 100,  80, 111, 115, 
-     41,  59,  13,  10,  32,  32, 
-     32,  32, 102, 108, 111,  97, 
-    116,  51,  32,  81,  50,  32, 
-     61,  32, 100, 100, 121,  40, 
-    119, 111, 114, 108, 100,  80, 
-    111, 115,  41,  59,  13,  10, 
-     32,  32,  32,  32, 102, 108, 
-    111,  97, 116,  50,  32, 115, 
-    116,  49,  32,  61,  32, 100, 
-    100, 120,  40, 117, 118,  41, 
-     59,  13,  10,  32,  32,  32, 
-     32, 102, 108, 111,  97, 116, 
-     50,  32, 115, 116,  50,  32, 
-     61,  32, 100, 100, 121,  40, 
-    117, 118,  41,  59,  13,  10, 
-     13,  10,  32,  32,  32,  32, 
-     47,  47, 102, 108, 111,  97, 
-    116,  51,  32,  78, 111, 114, 
-    109,  97, 108,  32,  61,  32, 
-    110, 111, 114, 109,  97, 108, 
-    105, 122, 101,  40, 110, 111, 
-    114, 109,  97, 108,  41,  59, 
-     13,  10,  32,  32,  32,  32, 
-     47,  47, 102, 108, 111,  97, 
-    116,  51,  32,  84,  97, 110, 
-    103, 101, 110, 116,  32,  61, 
-     32, 110, 111, 114, 109,  97, 
-    108, 105, 122, 101,  40,  81, 
-     49,  32,  42,  32, 115, 116, 
-     50,  46, 121,  32,  45,  32, 
-     81,  50,  32,  42,  32, 115, 
-    116,  49,  46, 121,  41,  59, 
-     13,  10,  32,  32,  32,  32, 
-     47,  47, 102, 108, 111,  97, 
-    116,  51,  32,  66, 105, 110, 
-    111, 114, 109,  97, 108,  32, 
-     61,  32,  45, 110, 111, 114, 
-    109,  97, 108, 105, 122, 101, 
-     40,  99, 114, 111, 115, 115, 
-     40,  78, 111, 114, 109,  97, 
-    108,  44,  32,  84,  97, 110, 
-    103, 101, 110, 116,  41,  41, 
-     59,  13,  10,  13,  10,  32, 
-     32,  32,  32, 102, 108, 111, 
-     97, 116,  51,  32,  78, 111, 
-    114, 109,  97, 108,  32,  61, 
-     32, 110, 111, 114, 109,  97, 
-    108, 105, 122, 101,  40, 110, 
-    111, 114, 109,  97, 108,  41, 
-     59,  13,  10,  32,  32,  32, 
-     32, 102, 108, 111,  97, 116, 
-     51,  32,  84,  97, 110, 103, 
-    101, 110, 116,  32,  61,  32, 
-     45, 110, 111, 114, 109,  97, 
-    108, 105, 122, 101,  40,  81, 
-     49,  32,  42,  32, 115, 116, 
-     50,  46, 121,  32,  45,  32, 
-     81,  50,  32,  42,  32, 115, 
-    116,  49,  46, 121,  41,  59, 
-     13,  10,  32,  32,  32,  32, 
-    102, 108, 111,  97, 116,  51, 
-     32,  66, 105, 110, 111, 114, 
-    109,  97, 108,  32,  61,  32, 
-    110, 111, 114, 109,  97, 108, 
-    105, 122, 101,  40,  99, 114, 
-    111, 115, 115,  40,  78, 111, 
-    114, 109,  97, 108,  44,  32, 
-     84,  97, 110, 103, 101, 110, 
-    116,  41,  41,  59,  13,  10, 
-     13,  10,  32,  32,  32,  32, 
-    102, 108, 111,  97, 116,  51, 
-    120,  51,  32,  84,  66,  78, 
-     32,  61,  32, 102, 108, 111, 
-     97, 116,  51, 120,  51,  40, 
-     84,  97, 110, 103, 101, 110, 
-    116,  44,  32,  66, 105, 110, 
-    111, 114, 109,  97, 108,  44, 
-     32,  78, 111, 114, 109,  97, 
-    108,  41,  59,  13,  10,  13, 
-     10,  32,  32,  32,  32, 114, 
-    101, 116, 117, 114, 110,  32, 
-    110, 111, 114, 109,  97, 108, 
-    105, 122, 101,  40, 109, 117, 
-    108,  40, 116,  97, 110, 103, 
-    101, 110, 116,  78, 111, 114, 
-    109,  97, 108,  44,  32,  84, 
-     66,  78,  41,  41,  59,  13, 
-     10, 125,  10,  10, 102, 108, 
-    111,  97, 116,  52,  32,  80, 
-     98, 114,  80, 105, 120, 101, 
-    108,  83, 104,  97, 100, 101, 
-    114,  40,  80, 105, 120, 101, 
-    108,  83, 104,  97, 100, 101, 
-    114,  73, 110, 112, 117, 116, 
-     32,  73,  78,  41,  32,  58, 
-     32,  83,  86,  95,  84,  65, 
-     82,  71,  69,  84,  10, 123, 
-     10,  32,  32,  32,  32,  99, 
-    111, 110, 115, 116,  32, 102, 
-    108, 111,  97, 116,  51,  32, 
-     97, 108,  98, 101, 100, 111, 
-     84, 101, 120, 101, 108,  32, 
-     61,  32, 112, 111, 119,  40, 
-     97, 108,  98, 101, 100, 111, 
-     84, 101, 120,  46,  83,  97, 
-    109, 112, 108, 101,  40, 115, 
-     97, 109, 112, 108, 101,  84, 
-    121, 112, 101,  44,  32,  73, 
-     78,  46, 117, 118,  41,  46, 
-    114, 103,  98,  44,  32,  50, 
-     46,  50,  41,  59,  10,  32, 
-     32,  32,  32,  99, 111, 110, 
-    115, 116,  32, 102, 108, 111, 
-     97, 116,  50,  32, 109, 101, 
-    116,  97, 108,  82, 111, 117, 
-    103, 104, 110, 101, 115, 115, 
-     84, 101, 120, 101, 108,  32, 
-     61,  32, 109, 101, 116,  97, 
-    108,  82, 111, 117, 103, 104, 
-    110, 101, 115, 115,  84, 101, 
-    120,  46,  83,  97, 109, 112, 
-    108, 101,  40, 115,  97, 109, 
-    112, 108, 101,  84, 121, 112, 
-    101,  44,  32,  73,  78,  46, 
-    117, 118,  41,  46, 114, 103, 
-     59,  13,  10,  32,  32,  32, 
-     32,  99, 111, 110, 115, 116, 
-     32, 102, 108, 111,  97, 116, 
-     32, 109, 101, 116,  97, 108, 
-    108, 105,  99,  32,  61,  32, 
-    109, 101, 116,  97, 108,  82, 
-    111, 117, 103, 104, 110, 101, 
-    115, 115,  84, 101, 120, 101, 
-    108,  46, 114,  59,  13,  10, 
-     32,  32,  32,  32,  99, 111, 
-    110, 115, 116,  32, 102, 108, 
-    111,  97, 116,  32, 114, 111, 
-    117, 103, 104, 110, 101, 115, 
-    115,  32,  61,  32, 109, 101, 
-    116,  97, 108,  82, 111, 117, 
-    103, 104, 110, 101, 115, 115, 
-     84, 101, 120, 101, 108,  46, 
-    103,  59,  13,  10,  32,  32, 
-     32,  32,  99, 111, 110, 115, 
-    116,  32, 102, 108, 111,  97, 
-    116,  32,  97, 111,  32,  61, 
-     32,  97, 111,  84, 101, 120, 
-     46,  83,  97, 109, 112, 108, 
-    101,  40, 115,  97, 109, 112, 
-    108, 101,  84, 121, 112, 101, 
-     44,  32,  73,  78,  46, 117, 
-    118,  41,  46, 114,  59,  10, 
-     32,  32,  32,  32,  99, 111, 
-    110, 115, 116,  32, 102, 108, 
-    111,  97, 116,  51,  32, 101, 
-    109, 105, 115, 115, 105, 111, 
-    110,  84, 101, 120, 101, 108, 
-     32,  61,  32, 112, 111, 119, 
-     40, 101, 109, 105, 115, 115, 
-    105, 111, 110,  84, 101, 120, 
-     46,  83,  97, 109, 112, 108, 
-    101,  40, 115,  97, 109, 112, 
-    108, 101,  84, 121, 112, 101, 
-     44,  32,  73,  78,  46, 117, 
-    118,  41,  46, 114, 103,  98, 
-     44,  32,  50,  46,  50,  41, 
-     59,  10,  10,  32,  32,  32, 
-     32, 102, 108, 111,  97, 116, 
-     51,  32,  78,  32,  61,  32, 
-     71, 101, 116,  78, 111, 114, 
-    109,  97, 108,  70, 114, 111, 
-    109,  77,  97, 112,  40, 110, 
-    111, 114, 109,  97, 108, 105, 
-    122, 101,  40,  73,  78,  46, 
-    110, 111, 114, 109,  97, 108, 
-     87,  83,  41,  44,  32,  73, 
-     78,  46, 119, 111, 114, 108, 
-    100,  80, 111, 115,  44,  32, 
-     73,  78,  46, 117, 118,  41, 
-     59,  13,  10,  32,  32,  32, 
-     32, 102, 108, 111,  97, 116, 
-     51,  32,  86,  32,  61,  32, 
-    110, 111, 114, 109,  97, 108, 
-    105, 122, 101,  40, 101, 121, 
-    101,  80, 111, 115,  32,  45, 
-     32,  73,  78,  46, 119, 111, 
-    114, 108, 100,  80, 111, 115, 
-     41,  59,  13,  10,  32,  32, 
-     32,  32, 102, 108, 111,  97, 
-    116,  51,  32,  82,  32,  61, 
-     32, 114, 101, 102, 108, 101, 
-     99, 116,  40,  45,  86,  44, 
-     32,  78,  41,  59,  13,  10, 
-     13,  10,  32,  32,  32,  32, 
-    102, 108, 111,  97, 116,  51, 
-     32,  70,  48,  32,  61,  32, 
-    108, 101, 114, 112,  40, 102, 
-    108, 111,  97, 116,  51,  40, 
-     48,  46,  48,  52,  44,  32, 
-     48,  46,  48,  52,  44,  32, 
-     48,  46,  48,  52,  41,  44, 
-     32,  97, 108,  98, 101, 100, 
-    111,  84, 101, 120, 101, 108, 
-     46, 114, 103,  98,  44,  32, 
-    109, 101, 116,  97, 108, 108, 
-    105,  99,  41,  59,  13,  10, 
-     13,  10,  32,  32,  32,  32, 
-     47,  47,  32, 114, 101, 102, 
-    108, 101,  99, 116,  97, 110, 
-     99, 101,  32, 101, 113, 117, 
-     97, 116, 105, 111, 110,  13, 
-     10,  32,  32,  32,  32, 102, 
-    108, 111,  97, 116,  51,  32, 
-     76, 111,  32,  61,  32, 102, 
-    108, 111,  97, 116,  51,  40, 
-     48,  46,  48,  44,  32,  48, 
-     46,  48,  44,  32,  48,  46, 
-     48,  41,  59,  13,  10,  32, 
-     32,  32,  32, 102, 111, 114, 
-     32,  40, 105, 110, 116,  32, 
-    105,  32,  61,  32,  48,  59, 
-     32, 105,  32,  60,  32,  52, 
-     59,  32,  43,  43, 105,  41, 
-     32, 123,  13,  10,  32,  32, 
-     32,  32,  32,  32,  32,  32, 
-     47,  47,  32,  99,  97, 108, 
-     99, 117, 108,  97, 116, 101, 
-     32, 112, 101, 114,  45, 108, 
-    105, 103, 104, 116,  32, 114, 
-     97, 100, 105,  97, 110,  99, 
-    101,  13,  10,  32,  32,  32, 
-     32,  32,  32,  32,  32, 102, 
-    108, 111,  97, 116,  51,  32, 
-     76,  32,  61,  32, 110, 111, 
-    114, 109,  97, 108, 105, 122, 
-    101,  40, 108, 105, 103, 104, 
-    116,  80, 111, 115, 105, 116, 
-    105, 111, 110, 115,  91, 105, 
-     93,  46, 120, 121, 122,  32, 
-     45,  32,  73,  78,  46, 119, 
-    111, 114, 108, 100,  80, 111, 
-    115,  41,  59,  13,  10,  32, 
-     32,  32,  32,  32,  32,  32, 
-     32, 102, 108, 111,  97, 116, 
-     51,  32,  72,  32,  61,  32, 
-    110, 111, 114, 109,  97, 108, 
-    105, 122, 101,  40,  86,  32, 
-     43,  32,  76,  41,  59,  13, 
-     10,  32,  32,  32,  32,  32, 
-     32,  32,  32, 102, 108, 111, 
-     97, 116,  32, 100, 105, 115, 
-    116,  97, 110,  99, 101,  32, 
-     61,  32, 108, 101, 110, 103, 
-    116, 104,  40, 108, 105, 103, 
-    104, 116,  80, 111, 115, 105, 
-    116, 105, 111, 110, 115,  91, 
-    105,  93,  46, 120, 121, 122, 
-     32,  45,  32,  73,  78,  46, 
-    119, 111, 114, 108, 100,  80, 
-    111, 115,  41,  59,  13,  10, 
-     32,  32,  32,  32,  32,  32, 
-     32,  32, 102, 108, 111,  97, 
-    116,  32,  97, 116, 116, 101, 
-    110, 117,  97, 116, 105, 111, 
-    110,  32,  61,  32,  49,  46, 
-     48,  32,  47,  32,  40, 100, 
-    105, 115, 116,  97, 110,  99, 
-    101,  32,  42,  32, 100, 105, 
-    115, 116,  97, 110,  99, 101, 
-     41,  59,  13,  10,  32,  32, 
-     32,  32,  32,  32,  32,  32, 
-    102, 108, 111,  97, 116,  51, 
-     32, 114,  97, 100, 105,  97, 
-    110,  99, 101,  32,  61,  32, 
-    108, 105, 103, 104, 116,  67, 
-    111, 108, 111, 114, 115,  91, 
-    105,  93,  46, 120, 121, 122, 
-     32,  42,  32,  97, 116, 116, 
-    101, 110, 117,  97, 116, 105, 
-    111, 110,  59,  13,  10,  13, 
-     10,  32,  32,  32,  32,  32, 
-     32,  32,  32,  47,  47,  32, 
-     99, 111, 111, 107,  45, 116, 
-    111, 114, 114,  97, 110,  99, 
-    101,  32,  98, 114, 100, 102, 
-     13,  10,  32,  32,  32,  32, 
-     32,  32,  32,  32, 102, 108, 
-    111,  97, 116,  32,  78,  68, 
-     70,  32,  61,  32,  68, 105, 
-    115, 116, 114, 105,  98, 117, 
-    116, 105, 111, 110,  71,  71, 
-     88,  40,  78,  44,  32,  72, 
-     44,  32, 114, 111, 117, 103, 
-    104, 110, 101, 115, 115,  41, 
-     59,  13,  10,  32,  32,  32, 
-     32,  32,  32,  32,  32, 102, 
-    108, 111,  97, 116,  32,  71, 
-     32,  61,  32,  71, 101, 111, 
-    109, 101, 116, 114, 121,  83, 
-    109, 105, 116, 104,  40,  78, 
-     44,  32,  86,  44,  32,  76, 
-     44,  32, 114, 111, 117, 103, 
-    104, 110, 101, 115, 115,  41, 
-     59,  13,  10,  32,  32,  32, 
-     32,  32,  32,  32,  32, 102, 
-    108, 111,  97, 116,  51,  32, 
-     70,  32,  61,  32,  70, 114, 
-    101, 115, 110, 101, 108,  83, 
-     99, 104, 108, 105,  99, 107, 
-     40, 115,  97, 116, 117, 114, 
-     97, 116, 101,  40, 100, 111, 
-    116,  40,  72,  44,  32,  86, 
-     41,  41,  44,  32,  70,  48, 
-     41,  59,  13,  10,  13,  10, 
-     32,  32,  32,  32,  32,  32, 
-     32,  32, 102, 108, 111,  97, 
-    116,  51,  32, 110, 117, 109, 
-    101, 114,  97, 116, 111, 114, 
-     32,  61,  32,  78,  68,  70, 
-     32,  42,  32,  71,  32,  42, 
-     32,  70,  59,  13,  10,  32, 
-     32,  32,  32,  32,  32,  32, 
-     32, 102, 108, 111,  97, 116, 
-     32, 100, 101, 110, 111, 109, 
-    105, 110,  97, 116, 111, 114, 
-     32,  61,  32,  52,  32,  42, 
-     32, 109,  97, 120,  40, 100, 
-    111, 116,  40,  78,  44,  32, 
-     86,  41,  44,  32,  48,  46, 
-     48,  41,  32,  42,  32, 109, 
-     97, 120,  40, 100, 111, 116, 
-     40,  78,  44,  32,  76,  41, 
-     44,  32,  48,  46,  48,  41, 
-     32,  43,  32,  48,  46,  48, 
-     48,  48,  49,  59,  32,  47, 
-     47,  32,  43,  32,  48,  46, 
-     48,  48,  48,  49,  32, 116, 
-    111,  32, 112, 114, 101, 118, 
-    101, 110, 116,  32, 100, 105, 
-    118, 105, 100, 101,  32,  98, 
-    121,  32, 122, 101, 114, 111, 
-     13,  10,  32,  32,  32,  32, 
-     32,  32,  32,  32, 102, 108, 
-    111,  97, 116,  51,  32, 115, 
-    112, 101,  99, 117, 108,  97, 
-    114,  32,  61,  32, 110, 117, 
-    109, 101, 114,  97, 116, 111, 
-    114,  32,  47,  32, 100, 101, 
-    110, 111, 109, 105, 110,  97, 
-    116, 111, 114,  59,  13,  10, 
-     13,  10,  32,  32,  32,  32, 
-     32,  32,  32,  32,  47,  47, 
-     32, 107,  83,  32, 105, 115, 
-     32, 101, 113, 117,  97, 108, 
-     32, 116, 111,  32,  70, 114, 
-    101, 115, 110, 101, 108,  13, 
-     10,  32,  32,  32,  32,  32, 
-     32,  32,  32, 102, 108, 111, 
-     97, 116,  51,  32, 107,  83, 
-     32,  61,  32,  70,  59,  13, 
-     10,  32,  32,  32,  32,  32, 
-     32,  32,  32,  47,  47,  32, 
-    102, 111, 114,  32, 101, 110, 
-    101, 114, 103, 121,  32,  99, 
-    111, 110, 115, 101, 114, 118, 
-     97, 116, 105, 111, 110,  44, 
-     32, 116, 104, 101,  32, 100, 
-    105, 102, 102, 117, 115, 101, 
-     32,  97, 110, 100,  32, 115, 
-    112, 101,  99, 117, 108,  97, 
-    114,  32, 108, 105, 103, 104, 
-    116,  32,  99,  97, 110,  39, 
-    116,  13,  10,  32,  32,  32, 
-     32,  32,  32,  32,  32,  47, 
-     47,  32,  98, 101,  32,  97, 
-     98, 111, 118, 101,  32,  49, 
-     46,  48,  32,  40, 117, 110, 
-    108, 101, 115, 115,  32, 116, 
-    104, 101,  32, 115, 117, 114, 
-    102,  97,  99, 101,  32, 101, 
-    109, 105, 116, 115,  32, 108, 
-    105, 103, 104, 116,  41,  59, 
-     32, 116, 111,  32, 112, 114, 
-    101, 115, 101, 114, 118, 101, 
-     32, 116, 104, 105, 115,  13, 
-     10,  32,  32,  32,  32,  32, 
-     32,  32,  32,  47,  47,  32, 
-    114, 101, 108,  97, 116, 105, 
-    111, 110, 115, 104, 105, 112, 
-     32, 116, 104, 101,  32, 100, 
-    105, 102, 102, 117, 115, 101, 
-     32,  99, 111, 109, 112, 111, 
-    110, 101, 110, 116,  32,  40, 
-    107,  68,  41,  32, 115, 104, 
-    111, 117, 108, 100,  32, 101, 
-    113, 117,  97, 108,  32,  49, 
-     46,  48,  32,  45,  32, 107, 
-     83,  46,  13,  10,  32,  32, 
-     32,  32,  32,  32,  32,  32, 
-    102, 108, 111,  97, 116,  51, 
-     32, 107,  68,  32,  61,  32, 
-    102, 108, 111,  97, 116,  51, 
-     40,  49,  46,  48,  44,  32, 
-     49,  46,  48,  44,  32,  49, 
-     46,  48,  41,  32,  45,  32, 
-    107,  83,  59,  13,  10,  32, 
-     32,  32,  32,  32,  32,  32, 
-     32,  47,  47,  32, 109, 117, 
-    108, 116, 105, 112, 108, 121, 
-     32, 107,  68,  32,  98, 121, 
-     32, 116, 104, 101,  32, 105, 
-    110, 118, 101, 114, 115, 101, 
-     32, 109, 101, 116,  97, 108, 
-    110, 101, 115, 115,  32, 115, 
-    117,  99, 104,  32, 116, 104, 
-     97, 116,  32, 111, 110, 108, 
-    121,  32, 110, 111, 110,  45, 
-    109, 101, 116,  97, 108, 115, 
-     32,  13,  10,  32,  32,  32, 
-     32,  32,  32,  32,  32,  47, 
-     47,  32, 104,  97, 118, 101, 
-     32, 100, 105, 102, 102, 117, 
-    115, 101,  32, 108, 105, 103, 
-    104, 116, 105, 110, 103,  44, 
-     32, 111, 114,  32,  97,  32, 
-    108, 105, 110, 101,  97, 114, 
-     32,  98, 108, 101, 110, 100, 
-     32, 105, 102,  32, 112,  97, 
-    114, 116, 108, 121,  32, 109, 
-    101, 116,  97, 108,  32,  40, 
-    112, 117, 114, 101,  32, 109, 
-    101, 116,  97, 108, 115,  13, 
-     10,  32,  32,  32,  32,  32, 
-     32,  32,  32,  47,  47,  32, 
-    104,  97, 118, 101,  32, 110, 
-    111,  32, 100, 105, 102, 102, 
-    117, 115, 101,  32, 108, 105, 
-    103, 104, 116,  41,  46,  13, 
-     10,  32,  32,  32,  32,  32, 
-     32,  32,  32, 107,  68,  32, 
-     42,  61,  32,  49,  46,  48, 
-     32,  45,  32, 109, 101, 116, 
-     97, 108, 108, 105,  99,  59, 
-     13,  10,  13,  10,  32,  32, 
-     32,  32,  32,  32,  32,  32, 
-     47,  47,  32, 115,  99,  97, 
-    108, 101,  32, 108, 105, 103, 
-    104, 116,  32,  98, 121,  32, 
-     78, 100, 111, 116,  76,  13, 
-     10,  32,  32,  32,  32,  32, 
-     32,  32,  32, 102, 108, 111, 
-     97, 116,  32,  78, 100, 111, 
-    116,  76,  32,  61,  32, 109, 
-     97, 120,  40, 100, 111, 116, 
-     40,  78,  44,  32,  76,  41, 
-     44,  32,  48,  46,  48,  41, 
-     59,  13,  10,  13,  10,  32, 
-     32,  32,  32,  32,  32,  32, 
-     32,  47,  47,  32,  97, 100, 
-    100,  32, 116, 111,  32, 111, 
-    117, 116, 103, 111, 105, 110, 
-    103,  32, 114,  97, 100, 105, 
-     97, 110,  99, 101,  32,  76, 
-    111,  13,  10,  32,  32,  32, 
-     32,  32,  32,  32,  32,  76, 
-    111,  32,  43,  61,  32,  40, 
-    107,  68,  32,  42,  32,  97, 
-    108,  98, 101, 100, 111,  84, 
-    101, 120, 101, 108,  46, 114, 
-    103,  98,  32,  47,  32,  80, 
-     73,  32,  43,  32, 115, 112, 
-    101,  99, 117, 108,  97, 114, 
-     41,  32,  42,  32, 114,  97, 
-    100, 105,  97, 110,  99, 101, 
-     32,  42,  32,  78, 100, 111, 
-    116,  76,  59,  13,  10,  32, 
-     32,  32,  32, 125,  13,  10, 
-     13,  10,  32,  32,  32,  32, 
-     47,  47,  32,  97, 109,  98, 
-    105, 101, 110, 116,  32, 108, 
-    105, 103, 104, 116, 105, 110, 
-    103,  32,  40, 119, 101,  32, 
-    110, 111, 119,  32, 117, 115, 
-    101,  32,  73,  66,  76,  32, 
-     97, 115,  32, 116, 104, 101, 
-     32,  97, 109,  98, 105, 101, 
-    110, 116,  32, 116, 101, 114, 
-    109,  41,  13,  10,  32,  32, 
-     32,  32, 102, 108, 111,  97, 
-    116,  51,  32,  70,  32,  61, 
-     32,  70, 114, 101, 115, 110, 
-    101, 108,  83,  99, 104, 108, 
-    105,  99, 107,  82, 111, 117, 
-    103, 104, 110, 101, 115, 115, 
-     40, 109,  97, 120,  40, 100, 
-    111, 116,  40,  78,  44,  32, 
-     86,  41,  44,  32,  48,  46, 
-     48,  41,  44,  32,  70,  48, 
-     44,  32, 114, 111, 117, 103, 
-    104, 110, 101, 115, 115,  41, 
-     59,  13,  10,  13,  10,  32, 
-     32,  32,  32, 102, 108, 111, 
-     97, 116,  51,  32, 112, 114, 
-    101, 102, 105, 108, 116, 101, 
-    114, 101, 100,  67, 111, 108, 
-    111, 114,  32,  61,  32, 114, 
-     97, 100, 105,  97, 110,  99, 
-    101,  77,  97, 112,  46,  83, 
-     97, 109, 112, 108, 101,  40, 
-    115,  97, 109, 112, 108, 101, 
-     84, 121, 112, 101,  44,  32, 
-     82,  41,  46, 114, 103,  98, 
-     59,  32,  47,  47,  32, 114, 
-    111, 117, 103, 104, 110, 101, 
-    115, 115,  32,  42,  32,  77, 
-     65,  88,  95,  82,  69,  70, 
-     76,  69,  67,  84,  73,  79, 
-     78,  95,  76,  79,  68,  13, 
-     10,  32,  32,  32,  32,  99, 
-    111, 110, 115, 116,  32, 102, 
-    108, 111,  97, 116,  50,  32, 
-     98, 114, 100, 102,  76, 117, 
-    116,  85, 118,  32,  61,  32, 
-    102, 108, 111,  97, 116,  50, 
-     40, 109,  97, 120,  40, 100, 
-    111, 116,  40,  78,  44,  32, 
-     86,  41,  44,  32,  48,  46, 
-     48,  41,  44,  32, 114, 111, 
-    117, 103, 104, 110, 101, 115, 
-    115,  41,  59,  13,  10,  32, 
-     32,  32,  32, 102, 108, 111, 
-     97, 116,  50,  32,  98, 114, 
-    100, 102,  32,  61,  32,  98, 
-    114, 100, 102,  76,  85,  84, 
-     46,  83,  97, 109, 112, 108, 
-    101,  40, 115,  97, 109, 112, 
-    108, 101,  84, 121, 112, 101, 
-     44,  32,  98, 114, 100, 102, 
-     76, 117, 116,  85, 118,  41, 
-     46, 114, 103,  59,  13,  10, 
-     32,  32,  32,  32, 102, 108, 
-    111,  97, 116,  51,  32, 115, 
-    112, 101,  99, 117, 108,  97, 
-    114,  32,  61,  32, 112, 114, 
-    101, 102, 105, 108, 116, 101, 
-    114, 101, 100,  67, 111, 108, 
-    111, 114,  32,  42,  32,  40, 
-     70,  32,  42,  32,  98, 114, 
-    100, 102,  46, 120,  32,  43, 
-     32,  98, 114, 100, 102,  46, 
-    121,  41,  59,  13,  10,  13, 
-     10,  32,  32,  32,  32,  47, 
-     47,  32, 102, 108, 111,  97, 
-    116,  51,  32,  97, 109,  98, 
-    105, 101, 110, 116,  32,  61, 
-     32,  32,  47,  47,  32, 116, 
-    101, 120, 116, 117, 114, 101, 
-     40, 105, 114, 114,  97, 100, 
-    105,  97, 110,  99, 101,  77, 
-     97, 112,  44,  32,  78,  41, 
-     46, 114, 103,  98,  59,  13, 
-     10,  32,  32,  32,  32, 102, 
-    108, 111,  97, 116,  51,  32, 
-    107,  83,  32,  61,  32,  70, 
-    114, 101, 115, 110, 101, 108, 
-     83,  99, 104, 108, 105,  99, 
-    107,  40, 109,  97, 120,  40, 
-    100, 111, 116,  40,  78,  44, 
-     32,  86,  41,  44,  32,  48, 
-     46,  48,  41,  44,  32,  70, 
-     48,  41,  59,  13,  10,  32, 
-     32,  32,  32, 102, 108, 111, 
-     97, 116,  51,  32, 107,  68, 
-     32,  61,  32,  49,  46,  48, 
-     32,  45,  32, 107,  83,  59, 
-     13,  10,  32,  32,  32,  32, 
-    102, 108, 111,  97, 116,  51, 
-     32, 105, 114, 114,  97, 100, 
-    105,  97, 110,  99, 101,  32, 
-     61,  32, 105, 114, 114,  97, 
-    100, 105,  97, 110,  99, 101, 
-     77,  97, 112,  46,  83,  97, 
-    109, 112, 108, 101,  40, 115, 
-     97, 109, 112, 108, 101,  84, 
-    121, 112, 101,  44,  32,  78, 
-     41,  46, 114, 103,  98,  59, 
-     13,  10,  32,  32,  32,  32, 
-    102, 108, 111,  97, 116,  51, 
-     32, 100, 105, 102, 102, 117, 
-    115, 101,  32,  61,  32, 105, 
-    114, 114,  97, 100, 105,  97, 
-    110,  99, 101,  32,  42,  32, 
-     97, 108,  98, 101, 100, 111, 
-     84, 101, 120, 101, 108,  59, 
-     13,  10,  32,  32,  32,  32, 
-    102, 108, 111,  97, 116,  51, 
-     32,  97, 109,  98, 105, 101, 
-    110, 116,  32,  61,  32,  40, 
-    107,  68,  32,  42,  32, 100, 
-    105, 102, 102, 117, 115, 101, 
-     32,  43,  32, 115, 112, 101, 
-     99, 117, 108,  97, 114,  41, 
-     32,  42,  32,  97, 111,  59, 
-     13,  10,  32,  32,  32,  32, 
-     47,  47, 102, 108, 111,  97, 
-    116,  51,  32,  97, 109,  98, 
-    105, 101, 110, 116,  32,  61, 
-     32, 102, 108, 111,  97, 116, 
-     51,  40,  48,  46,  49,  51, 
-     44,  32,  48,  46,  49,  51, 
-     44,  32,  48,  46,  49,  51, 
-     41,  32,  42,  32,  97, 108, 
-     98, 101, 100, 111,  84, 101, 
-    120, 101, 108,  46, 114, 103, 
-     98,  32,  42,  32,  97, 111, 
-     59,  13,  10,  32,  32,  32, 
-     32, 102, 108, 111,  97, 116, 
-     51,  32,  99, 111, 108, 111, 
-    114,  32,  61,  32,  97, 109, 
-     98, 105, 101, 110, 116,  32, 
-     43,  32,  76, 111,  32,  43, 
-     32, 101, 109, 105, 115, 115, 
-    105, 111, 110,  84, 101, 120, 
-    101, 108,  59,  13,  10,  13, 
-     10,  32,  32,  32,  32,  99, 
-    111, 108, 111, 114,  32,  61, 
-     32,  84, 111, 110, 101,  77, 
-     97, 112,  72,  68,  82,  40, 
-     99, 111, 108, 111, 114,  41, 
-     59,  10,  32,  32,  32,  32, 
-     99, 111, 108, 111, 114,  32, 
-     61,  32,  67, 111, 114, 114, 
-    101,  99, 116,  71,  97, 109, 
-    109,  97,  40,  99, 111, 108, 
-    111, 114,  41,  59,  13,  10, 
-     13,  10,  32,  32,  32,  32, 
-    114, 101, 116, 117, 114, 110, 
-     32, 102, 108, 111,  97, 116, 
-     52,  40,  99, 111, 108, 111, 
-    114,  46, 114, 103,  98,  44, 
-     32,  49,  46,  48,  41,  59, 
-     10, 125,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0, 115, 116,  97, 116, 
-    105,  99,  32,  99, 111, 110, 
-    115, 116,  32, 102, 108, 111, 
-     97, 116,  32,  80,  73,  32, 
-     61,  32,  51,  46,  49,  52, 
-     49,  53,  57,  50,  54,  53, 
-     51,  53,  57,  59,  10,  10, 
-    105, 110, 108, 105, 110, 101, 
-     32, 102, 108, 111,  97, 116, 
-     51,  32,  84, 111, 110, 101, 
-     77,  97, 112,  72,  68,  82, 
-     40,  99, 111, 110, 115, 116, 
-     32, 102, 108, 111,  97, 116, 
-     51,  32,  99, 111, 108, 111, 
-    114,  41,  32, 123,  10,  32, 
-     32,  32,  32,  47,  47,  32, 
-     82, 101, 105, 110, 104,  97, 
-    114, 100,  32, 111, 112, 101, 
-    114,  97, 116, 111, 114,  10, 
-     32,  32,  32,  32, 114, 101, 
-    116, 117, 114, 110,  32,  99, 
-    111, 108, 111, 114,  32,  47, 
-     32,  40,  99, 111, 108, 111, 
-    114,  32,  43,  32, 102, 108, 
-    111,  97, 116,  51,  40,  49, 
-     46,  48,  44,  32,  49,  46, 
-     48,  44,  32,  49,  46,  48, 
-     41,  41,  59,  10, 125,  10, 
-     10, 105, 110, 108, 105, 110, 
-    101,  32, 102, 108, 111,  97, 
-    116,  51,  32,  67, 111, 114, 
-    114, 101,  99, 116,  71,  97, 
-    109, 109,  97,  40,  99, 111, 
-    110, 115, 116,  32, 102, 108, 
-    111,  97, 116,  51,  32,  99, 
-    111, 108, 111, 114,  41,  32, 
-    123,  10,  32,  32,  32,  32, 
-     99, 111, 110, 115, 116,  32, 
-    102, 108, 111,  97, 116,  32, 
-    112, 111, 119,  78,  32,  61, 
-     32,  49,  46,  48,  32,  47, 
-     32,  50,  46,  50,  59,  10, 
-     32,  32,  32,  32, 114, 101, 
-    116, 117, 114, 110,  32, 112, 
-    111, 119,  40,  99, 111, 108, 
-    111, 114,  44,  32, 102, 108, 
-    111,  97, 116,  51,  40, 112, 
-    111, 119,  78,  44,  32, 112, 
-    111, 119,  78,  44,  32, 112, 
-    111, 119,  78,  41,  41,  59, 
-     10, 125,  10,  10, 102, 108, 
-    111,  97, 116,  32,  68, 105, 
-    115, 116, 114, 105,  98, 117, 
-    116, 105, 111, 110,  71,  71, 
-     88,  40, 102, 108, 111,  97, 
-    116,  51,  32,  78,  44,  32, 
-    102, 108, 111,  97, 116,  51, 
-     32,  72,  44,  32, 102, 108, 
-    111,  97, 116,  32, 114, 111, 
-    117, 103, 104, 110, 101, 115, 
-    115,  41,  32, 123,  10,  32, 
-     32,  32,  32, 102, 108, 111, 
-     97, 116,  32,  97,  32,  61, 
-     32, 114, 111, 117, 103, 104, 
-    110, 101, 115, 115,  32,  42, 
-     32, 114, 111, 117, 103, 104, 
-    110, 101, 115, 115,  59,  10, 
-     32,  32,  32,  32, 102, 108, 
-    111,  97, 116,  32,  97,  50, 
-     32,  61,  32,  97,  32,  42, 
-     32,  97,  59,  10,  32,  32, 
-     32,  32, 102, 108, 111,  97, 
-    116,  32,  78, 100, 111, 116, 
-     72,  32,  61,  32, 109,  97, 
-    120,  40, 100, 111, 116,  40, 
-     78,  44,  32,  72,  41,  44, 
-     32,  48,  46,  48,  41,  59, 
-     10,  32,  32,  32,  32, 102, 
-    108, 111,  97, 116,  32,  78, 
-    100, 111, 116,  72,  50,  32, 
-     61,  32,  78, 100, 111, 116, 
-     72,  32,  42,  32,  78, 100, 
-    111, 116,  72,  59,  10,  10, 
-     32,  32,  32,  32, 102, 108, 
-    111,  97, 116,  32, 110, 117, 
-    109,  32,  61,  32,  97,  50, 
-     59,  10,  32,  32,  32,  32, 
-    102, 108, 111,  97, 116,  32, 
-    100, 101, 110, 111, 109,  32, 
-     61,  32,  40,  78, 100, 111, 
-    116,  72,  50,  32,  42,  32, 
-     40,  97,  50,  32,  45,  32, 
-     49,  46,  48,  41,  32,  43, 
-     32,  49,  46,  48,  41,  59, 
-     10,  32,  32,  32,  32, 100, 
-    101, 110, 111, 109,  32,  61, 
-     32,  80,  73,  32,  42,  32, 
-    100, 101, 110, 111, 109,  32, 
-     42,  32, 100, 101, 110, 111, 
-    109,  59,  10,  10,  32,  32, 
-     32,  32, 114, 101, 116, 117, 
-    114, 110,  32, 110, 117, 109, 
-     32,  47,  32, 100, 101, 110, 
-    111, 109,  59,  10, 125,  10, 
-     10, 102, 108, 111,  97, 116, 
-     32,  71, 101, 111, 109, 101, 
-    116, 114, 121,  83,  99, 104, 
-    108, 105,  99, 107,  71,  71, 
-     88,  40, 102, 108, 111,  97, 
-    116,  32,  78, 100, 111, 116, 
-     86,  44,  32, 102, 108, 111, 
-     97, 116,  32, 114, 111, 117, 
-    103, 104, 110, 101, 115, 115, 
-     41,  32, 123,  10,  32,  32, 
-     32,  32, 102, 108, 111,  97, 
-    116,  32, 114,  32,  61,  32, 
-     40, 114, 111, 117, 103, 104, 
-    110, 101, 115, 115,  32,  43, 
-     32,  49,  46,  48,  41,  59, 
-     10,  32,  32,  32,  32, 102, 
-    108, 111,  97, 116,  32, 107, 
-     32,  61,  32,  40, 114,  32, 
-     42,  32, 114,  41,  32,  47, 
-     32,  56,  46,  48,  59,  10, 
-     10,  32,  32,  32,  32, 102, 
-    108, 111,  97, 116,  32, 110, 
-    117, 109,  32,  61,  32,  78, 
-    100, 111, 116,  86,  59,  10, 
-     32,  32,  32,  32, 102, 108, 
-    111,  97, 116,  32, 100, 101, 
-    110, 111, 109,  32,  61,  32, 
-     78, 100, 111, 116,  86,  32, 
-     42,  32,  40,  49,  46,  48, 
-     32,  45,  32, 107,  41,  32, 
-     43,  32, 107,  59,  10,  10, 
-     32,  32,  32,  32, 114, 101, 
-    116, 117, 114, 110,  32, 110, 
-    117, 109,  32,  47,  32, 100, 
-    101, 110, 111, 109,  59,  10, 
-    125,  10,  10, 102, 108, 111, 
-     97, 116,  32,  71, 101, 111, 
-    109, 101, 116, 114, 121,  83, 
-    109, 105, 116, 104,  40, 102, 
-    108, 111,  97, 116,  51,  32, 
-     78,  44,  32, 102, 108, 111, 
-     97, 116,  51,  32,  86,  44, 
-     32, 102, 108, 111,  97, 116, 
-     51,  32,  76,  44,  32, 102, 
-    108, 111,  97, 116,  32, 114, 
-    111, 117, 103, 104, 110, 101, 
-    115, 115,  41,  32, 123,  10, 
-     32,  32,  32,  32, 102, 108, 
-    111,  97, 116,  32,  78, 100, 
-    111, 116,  86,  32,  61,  32, 
-    109,  97, 120,  40, 100, 111, 
-    116,  40,  78,  44,  32,  86, 
-     41,  44,  32,  48,  46,  48, 
-     41,  59,  10,  32,  32,  32, 
-     32, 102, 108, 111,  97, 116, 
-     32,  78, 100, 111, 116,  76, 
-     32,  61,  32, 109,  97, 120, 
-     40, 100, 111, 116,  40,  78, 
-     44,  32,  76,  41,  44,  32, 
-     48,  46,  48,  41,  59,  10, 
-     32,  32,  32,  32, 102, 108, 
-    111,  97, 116,  32, 103, 103, 
-    120,  50,  32,  61,  32,  71, 
-    101, 111, 109, 101, 116, 114, 
-    121,  83,  99, 104, 108, 105, 
-     99, 107,  71,  71,  88,  40, 
-     78, 100, 111, 116,  86,  44, 
-     32, 114, 111, 117, 103, 104, 
-    110, 101, 115, 115,  41,  59, 
-     10,  32,  32,  32,  32, 102, 
-    108, 111,  97, 116,  32, 103, 
-    103, 120,  49,  32,  61,  32, 
-     71, 101, 111, 109, 101, 116, 
-    114, 121,  83,  99, 104, 108, 
-    105,  99, 107,  71,  71,  88, 
-     40,  78, 100, 111, 116,  76, 
-     44,  32, 114, 111, 117, 103, 
-    104, 110, 101, 115, 115,  41, 
-     59,  10,  10,  32,  32,  32, 
-     32, 114, 101, 116, 117, 114, 
-    110,  32, 103, 103, 120,  49, 
-     32,  42,  32, 103, 103, 120, 
-     50,  59,  10, 125,  10,  10, 
-    102, 108, 111,  97, 116,  51, 
-     32,  70, 114, 101, 115, 110, 
-    101, 108,  83,  99, 104, 108, 
-    105,  99, 107,  40, 102, 108, 
-    111,  97, 116,  32,  99, 111, 
-    115,  84, 104, 101, 116,  97, 
-     44,  32, 102, 108, 111,  97, 
-    116,  51,  32,  70,  48,  41, 
-     32, 123,  10,  32,  32,  32, 
-     32, 114, 101, 116, 117, 114, 
-    110,  32,  70,  48,  32,  43, 
-     32,  40,  49,  46,  48,  32, 
-     45,  32,  70,  48,  41,  32, 
-     42,  32, 112, 111, 119,  40, 
-    115,  97, 116, 117, 114,  97, 
-    116, 101,  40,  49,  46,  48, 
-     32,  45,  32,  99, 111, 115, 
-     84, 104, 101, 116,  97,  41, 
-     44,  32,  53,  46,  48,  41, 
-     59,  10, 125,  10,  10, 102, 
-    108, 111,  97, 116,  51,  32, 
-     70, 114, 101, 115, 110, 101, 
-    108,  83,  99, 104, 108, 105, 
-     99, 107,  82, 111, 117, 103, 
-    104, 110, 101, 115, 115,  40, 
-    102, 108, 111,  97, 116,  32, 
-     99, 111, 115,  84, 104, 101, 
-    116,  97,  44,  32, 102, 108, 
-    111,  97, 116,  51,  32,  70, 
-     48,  44,  32, 102, 108, 111, 
-     97, 116,  32, 114, 111, 117, 
-    103, 104, 110, 101, 115, 115, 
-     41,  32, 123,  10,  32,  32, 
-     32,  32,  99, 111, 110, 115, 
-    116,  32, 102, 108, 111,  97, 
-    116,  32, 111, 110, 101,  77, 
-    105, 110, 117, 115,  82, 111, 
-    117, 103, 104, 110, 101, 115, 
-    115,  32,  61,  32,  49,  46, 
-     48,  32,  45,  32, 114, 111, 
-    117, 103, 104, 110, 101, 115, 
-    115,  59,  10,  32,  32,  32, 
-     32, 114, 101, 116, 117, 114, 
-    110,  32,  70,  48,  32,  43, 
-     32,  40, 109,  97, 120,  40, 
-    102, 108, 111,  97, 116,  51, 
-     40, 111, 110, 101,  77, 105, 
-    110, 117, 115,  82, 111, 117, 
-    103, 104, 110, 101, 115, 115, 
-     44,  32, 111, 110, 101,  77, 
-    105, 110, 117, 115,  82, 111, 
-    117, 103, 104, 110, 101, 115, 
-    115,  44,  32, 111, 110, 101, 
-     77, 105, 110, 117, 115,  82, 
-    111, 117, 103, 104, 110, 101, 
-    115, 115,  41,  44,  32,  70, 
-     48,  41,  32,  45,  32,  70, 
-     48,  41,  32,  42,  32, 112, 
-    111, 119,  40, 115,  97, 116, 
-    117, 114,  97, 116, 101,  40, 
-     49,  46,  48,  32,  45,  32, 
-     99, 111, 115,  84, 104, 101, 
-    116,  97,  41,  44,  32,  53, 
-     46,  48,  41,  59,  10, 125, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,  99,  98, 117, 102, 
-    102, 101, 114,  32,  80, 101, 
-    114,  65, 112, 112, 108, 105, 
-     99,  97, 116, 105, 111, 110, 
-     32,  58,  32, 114, 101, 103, 
-    105, 115, 116, 101, 114,  40, 
-     98,  48,  41,  32, 123,  13, 
-     10,   9, 109,  97, 116, 114, 
-    105, 120,  32, 112, 114, 111, 
-    106, 101,  99, 116, 105, 111, 
-    110,  77,  97, 116, 114, 105, 
-    120,  59,  13,  10,   9, 102, 
-    108, 111,  97, 116,  51,  32, 
-     99, 108, 105, 101, 110, 116, 
-     68,  97, 116,  97,  59,  13, 
-     10, 125,  13,  10,  13,  10, 
-     99,  98, 117, 102, 102, 101, 
-    114,  32,  80, 101, 114,  70, 
-    114,  97, 109, 101,  32,  58, 
-     32, 114, 101, 103, 105, 115, 
-    116, 101, 114,  40,  98,  49, 
-     41,  32, 123,  13,  10,   9, 
-    109,  97, 116, 114, 105, 120, 
-     32, 118, 105, 101, 119,  77, 
-     97, 116, 114, 105, 120,  59, 
-     13,  10,   9, 102, 108, 111, 
-     97, 116,  51,  32, 101, 121, 
-    101,  80, 111, 115,  59,  13, 
-     10,   9, 102, 108, 111,  97, 
-    116,  51,  32, 108, 105, 103, 
-    104, 116,  80, 111, 115,  59, 
-     13,  10, 125,  13,  10,  13, 
-     10,  99,  98, 117, 102, 102, 
-    101, 114,  32,  80, 101, 114, 
-     79,  98, 106, 101,  99, 116, 
-     32,  58,  32, 114, 101, 103, 
-    105, 115, 116, 101, 114,  40, 
-     98,  50,  41,  32, 123,  13, 
-     10,   9, 109,  97, 116, 114, 
-    105, 120,  32, 109, 111, 100, 
-    101, 108,  77,  97, 116, 114, 
-    105, 120,  59,  13,  10,   9, 
-    109,  97, 116, 114, 105, 120, 
-     32, 118, 105, 101, 119,  80, 
-    114, 111, 106, 101,  99, 116, 
-    105, 111, 110,  77,  97, 116, 
-    114, 105, 120,  59,  13,  10, 
-      9, 109,  97, 116, 114, 105, 
-    120,  32, 109, 111, 100, 101, 
-    108,  86, 105, 101, 119,  80, 
-    114, 111, 106, 101,  99, 116, 
-    105, 111, 110,  77,  97, 116, 
-    114, 105, 120,  59,  13,  10, 
-    125,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0, 254, 239, 
-    254, 239,   1,   0,   0,   0, 
-    104,  27,   0,   0,   0,  69, 
-     58,  92,  80, 114, 111, 106, 
-    101,  99, 116, 115,  92,  78, 
-    105,  99, 107, 101, 108,  92, 
-     78, 105,  99, 107, 101, 108, 
-     92,  68,  97, 116,  97,  92, 
-     83, 104,  97, 100, 101, 114, 
-    115,  92,  80,  98, 114,  80, 
-    105, 120, 101, 108,  83, 104, 
-     97, 100, 101, 114,  46, 104, 
-    108, 115, 108,   0,   0, 101, 
-     58,  92, 112, 114, 111, 106, 
-    101,  99, 116, 115,  92, 110, 
-    105,  99, 107, 101, 108,  92, 
-    110, 105,  99, 107, 101, 108, 
-     92, 100,  97, 116,  97,  92, 
-    115, 104,  97, 100, 101, 114, 
-    115,  92, 112,  98, 114, 112, 
-    105, 120, 101, 108, 115, 104, 
-     97, 100, 101, 114,  46, 104, 
-    108, 115, 108,   0,  69,  58, 
-     92,  80, 114, 111, 106, 101, 
-     99, 116, 115,  92,  78, 105, 
-     99, 107, 101, 108,  92,  78, 
-    105,  99, 107, 101, 108,  92, 
-     68,  97, 116,  97,  92,  83, 
-    104,  97, 100, 101, 114, 115, 
-     92,  80,  98, 114,  72, 101, 
-    108, 112, 101, 114,  46, 104, 
-    108, 115, 108,   0, 101,  58, 
-     92, 112, 114, 111, 106, 101, 
-     99, 116, 115,  92, 110, 105, 
-     99, 107, 101, 108,  92, 110, 
-    105,  99, 107, 101, 108,  92, 
-    100,  97, 116,  97,  92, 115, 
-    104,  97, 100, 101, 114, 115, 
-     92, 112,  98, 114, 104, 101, 
-    108, 112, 101, 114,  46, 104, 
-    108, 115, 108,   0,  69,  58, 
-     92,  80, 114, 111, 106, 101, 
-     99, 116, 115,  92,  78, 105, 
-     99, 107, 101, 108,  92,  78, 
-    105,  99, 107, 101, 108,  92, 
-     68,  97, 116,  97,  92,  83, 
-    104,  97, 100, 101, 114, 115, 
-     92,  67, 111, 109, 109, 111, 
-    110,  67, 111, 110, 115, 116, 
-     97, 110, 116,  66, 117, 102, 
-    102, 101, 114, 115,  46, 104, 
-    108, 115, 108,   0, 101,  58, 
-     92, 112, 114, 111, 106, 101, 
-     99, 116, 115,  92, 110, 105, 
-     99, 107, 101, 108,  92, 110, 
-    105,  99, 107, 101, 108,  92, 
-    100,  97, 116,  97,  92, 115, 
-    104,  97, 100, 101, 114, 115, 
-     92,  99, 111, 109, 109, 111, 
-    110,  99, 111, 110, 115, 116, 
-     97, 110, 116,  98, 117, 102, 
-    102, 101, 114, 115,  46, 104, 
-    108, 115, 108,   0,  84, 101, 
-    120, 116, 117, 114, 101,  50, 
-     68,  32,  97, 108,  98, 101, 
-    100, 111,  84, 101, 120,  32, 
-     58,  32, 114, 101, 103, 105, 
-    115, 116, 101, 114,  40, 116, 
-     48,  41,  59,  13,  10,  84, 
-    101, 120, 116, 117, 114, 101, 
-     50,  68,  32, 110, 111, 114, 
-    109,  97, 108,  84, 101, 120, 
-     32,  58,  32, 114, 101, 103, 
-    105, 115, 116, 101, 114,  40, 
-    116,  49,  41,  59,  13,  10, 
-     84, 101, 120, 116, 117, 114, 
-    101,  50,  68,  32, 109, 101, 
-    116,  97, 108,  82, 111, 117, 
-    103, 104, 110, 101, 115, 115, 
-     84, 101, 120,  32,  58,  32, 
-    114, 101, 103, 105, 115, 116, 
-    101, 114,  40, 116,  50,  41, 
-     59,  13,  10,  84, 101, 120, 
-    116, 117, 114, 101,  50,  68, 
-     32,  97, 111,  84, 101, 120, 
-     32,  58,  32, 114, 101, 103, 
-     27, 226,  48,   1, 216,   0, 
-      0,   0, 201,  62, 147, 119, 
-    251, 218, 215,   1,   1,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   3,   0, 
-      0,   0,   6,   0,   0,   0, 
-      1,   0,   0,   0,   7,   0, 
-      0,   0,   0,   0,   0,   0, 
-    174,   0,   0,   0,  40,   0, 
-      0,   0,  27, 226,  48,   1, 
-    194, 234, 171, 223, 224,   5, 
-      0,   0, 120,   0,   0,   0, 
-     60,   0,   0,   0, 174,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,  61,   0,   0,   0, 
-     40,   0,   0,   0,  27, 226, 
-     48,   1, 104, 107, 231, 170, 
-    224,  18,   0,   0,   1,   0, 
-      0,   0,  60,   0,   0,   0, 
-     61,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,  38,   1, 
-      0,   0,  40,   0,   0,   0, 
-     27, 226,  48,   1,   4, 183, 
-     45, 148,  61,   1,   0,   0, 
-    228,   0,   0,   0,  60,   0, 
-      0,   0,  38,   1,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   4,   0,   0,   0, 
-     66,   0,  60,  17,  16,   1, 
-      0,   0,   0,   1,  10,   0, 
-      1,   0,   1,   0, 124,  79, 
-     10,   0,   1,   0,   1,   0, 
-    124,  79,  77, 105,  99, 114, 
-    111, 115, 111, 102, 116,  32, 
-     40,  82,  41,  32,  72,  76, 
-     83,  76,  32,  83, 104,  97, 
-    100, 101, 114,  32,  67, 111, 
-    109, 112, 105, 108, 101, 114, 
-     32,  49,  48,  46,  49,   0, 
-      0,   0,  62,   0,  61,  17, 
-      1, 104, 108, 115, 108,  70, 
-    108,  97, 103, 115,   0,  48, 
-    120,  53,   0, 104, 108, 115, 
-    108,  84,  97, 114, 103, 101, 
-    116,   0, 112, 115,  95,  53, 
-     95,  48,   0, 104, 108, 115, 
-    108,  69, 110, 116, 114, 121, 
-      0,  80,  98, 114,  80, 105, 
-    120, 101, 108,  83, 104,  97, 
-    100, 101, 114,   0,   0,   0, 
-     54,   0,  16,  17,   0,   0, 
-      0,   0, 148,  44,   0,   0, 
-      0,   0,   0,   0,  44,  27, 
-      0,   0,   0,   0,   0,   0, 
-     44,  27,   0,   0,   7,  16, 
-      0,   0, 240,   0,   0,   0, 
-      1,   0, 160,  80,  98, 114, 
-     80, 105, 120, 101, 108,  83, 
-    104,  97, 100, 101, 114,   0, 
-      0,   0,  42,   0,  62,  17, 
-      3,  16,   0,   0,   9,   0, 
-     73,  78,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,  22,   0, 
-     80,  17,   1,   0,   5,   0, 
-      0,   0,   4,   0, 240,   0, 
-      0,   0,   1,   0,  44,  27, 
-      0,   0,   0,   0,  22,   0, 
-     80,  17,   1,   0,   5,   0, 
-      4,   0,   4,   0, 240,   0, 
-      0,   0,   1,   0,  44,  27, 
-      4,   0,   0,   0,  22,   0, 
-     80,  17,   1,   0,   5,   0, 
-      8,   0,   4,   0, 240,   0, 
-      0,   0,   1,   0,  44,  27, 
-      8,   0,   0,   0,  22,   0, 
-     80,  17,   1,   0,   5,   0, 
-     12,   0,   4,   0, 240,   0, 
-      0,   0,   1,   0,  44,  27, 
-     16,   0,   0,   0,  22,   0, 
-     80,  17,   1,   0,   5,   0, 
-     16,   0,   4,   0, 240,   0, 
-      0,   0,   1,   0,  44,  27, 
-     20,   0,   0,   0,  22,   0, 
-     80,  17,   1,   0,   5,   0, 
-     20,   0,   4,   0, 240,   0, 
-      0,   0,   1,   0,  44,  27, 
-     24,   0,   0,   0,  22,   0, 
-     80,  17,   1,   0,   5,   0, 
-     24,   0,   4,   0, 240,   0, 
-      0,   0,   1,   0,  44,  27, 
-     32,   0,   0,   0,  22,   0, 
-     80,  17,   1,   0,   5,   0, 
-     28,   0,   4,   0, 240,   0, 
-      0,   0,   1,   0,  44,  27, 
-     36,   0,   0,   0,  70,   0, 
-     62,  17,   6,  16,   0,   0, 
-    136,   0,  60,  80,  98, 114, 
-     80, 105, 120, 101, 108,  83, 
-    104,  97, 100, 101, 114,  32, 
-    114, 101, 116, 117, 114, 110, 
-     32, 118,  97, 108, 117, 101, 
-     62,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,  22,   0, 
-     80,  17,   2,   0,   5,   0, 
-      0,   0,   4,   0, 240,   0, 
-      0,   0,   1,   0,  44,  27, 
-      0,   0,   0,   0,  22,   0, 
-     80,  17,   2,   0,   5,   0, 
-      4,   0,   4,   0, 240,   0, 
-      0,   0,   1,   0,  44,  27, 
-      4,   0,   0,   0,  22,   0, 
-     80,  17,   2,   0,   5,   0, 
-      8,   0,   4,   0, 240,   0, 
-      0,   0,   1,   0,  44,  27, 
-      8,   0,   0,   0,  22,   0, 
-     80,  17,   2,   0,   5,   0, 
-     12,   0,   4,   0, 240,   0, 
-      0,   0,   1,   0,  44,  27, 
-     12,   0,   0,   0,  50,   0, 
-     62,  17,   8,  16,   0,   0, 
-      8,   0,  97, 108,  98, 101, 
-    100, 111,  84, 101, 120, 101, 
-    108,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,  22,   0,  80,  17, 
-      0,   0,   5,   0,   0,   0, 
-      4,   0, 128,   1,   0,   0, 
-      1,   0,  44,  25,   4,   0, 
-      0,   0,  22,   0,  80,  17, 
-      0,   0,   5,   0,   4,   0, 
-      4,   0, 128,   1,   0,   0, 
-      1,   0,  44,  25,   8,   0, 
-      0,   0,  22,   0,  80,  17, 
-      0,   0,   5,   0,   8,   0, 
-      4,   0, 128,   1,   0,   0, 
-      1,   0,  24,  26,  12,   0, 
-      0,   0,  58,   0,  62,  17, 
-      9,  16,   0,   0,   8,   0, 
-    109, 101, 116,  97, 108,  82, 
-    111, 117, 103, 104, 110, 101, 
-    115, 115,  84, 101, 120, 101, 
-    108,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,  22,   0,  80,  17, 
-      0,   0,   5,   0,   4,   0, 
-      4,   0, 172,   1,   0,   0, 
-      1,   0,  48,  22,  20,   0, 
-      0,   0,  22,   0,  80,  17, 
-      0,   0,   5,   0,   0,   0, 
-      4,   0, 192,   1,   0,   0, 
-      1,   0, 220,  21,  16,   0, 
-      0,   0,  46,   0,  62,  17, 
-     10,  16,   0,   0,   0,   0, 
-    109, 101, 116,  97, 108, 108, 
-    105,  99,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,  22,   0,  80,  17, 
-      0,   0,   1,   0,   0,   0, 
-      4,   0, 212,   1,   0,   0, 
-      1,   0, 200,  21,  16,   0, 
-      0,   0,  50,   0,  62,  17, 
-     10,  16,   0,   0,   0,   0, 
-    114, 111, 117, 103, 104, 110, 
-    101, 115, 115,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-     22,   0,  80,  17,   0,   0, 
-      1,   0,   0,   0,   4,   0, 
-    232,   1,   0,   0,   1,   0, 
-    244,  21,  20,   0,   0,   0, 
-     42,   0,  62,  17,  10,  16, 
-      0,   0,   0,   0,  97, 111, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,  22,   0,  80,  17, 
-      0,   0,   1,   0,   0,   0, 
-      4,   0,  40,   2,   0,   0, 
-      1,   0, 244,  25,  24,   0, 
-      0,   0,  54,   0,  62,  17, 
-      8,  16,   0,   0,   8,   0, 
-    101, 109, 105, 115, 115, 105, 
-    111, 110,  84, 101, 120, 101, 
-    108,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,  22,   0, 
-     80,  17,   0,   0,   5,   0, 
-      0,   0,   4,   0, 164,   2, 
-      0,   0,   1,   0, 120,  25, 
-     32,   0,   0,   0,  22,   0, 
-     80,  17,   0,   0,   5,   0, 
-      4,   0,   4,   0, 164,   2, 
-      0,   0,   1,   0, 120,  25, 
-     36,   0,   0,   0,  22,   0, 
-     80,  17,   0,   0,   5,   0, 
-      8,   0,   4,   0, 164,   2, 
-      0,   0,   1,   0, 120,  25, 
-     40,   0,   0,   0,  42,   0, 
-     62,  17,   0,  16,   0,   0, 
-      8,   0,  78,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-     22,   0,  80,  17,   0,   0, 
-      5,   0,   0,   0,   4,   0, 
-    112,   7,   0,   0,   1,   0, 
-     12,  19,  48,   0,   0,   0, 
-     22,   0,  80,  17,   0,   0, 
-      5,   0,   4,   0,   4,   0, 
-    112,   7,   0,   0,   1,   0, 
-     12,  19,  52,   0,   0,   0, 
-     22,   0,  80,  17,   0,   0, 
-      5,   0,   8,   0,   4,   0, 
-    112,   7,   0,   0,   1,   0, 
-     12,  19,  56,   0,   0,   0, 
-     42,   0,  62,  17,   0,  16, 
-      0,   0,   8,   0,  86,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,  22,   0,  80,  17, 
-      0,   0,   5,   0,   0,   0, 
-      4,   0, 244,   7,   0,   0, 
-      1,   0, 184,  16,  64,   0, 
-      0,   0,  22,   0,  80,  17, 
-      0,   0,   5,   0,   4,   0, 
-      4,   0, 244,   7,   0,   0, 
-      1,   0, 184,  16,  68,   0, 
-      0,   0,  22,   0,  80,  17, 
-      0,   0,   5,   0,   8,   0, 
-      4,   0, 244,   7,   0,   0, 
-      1,   0, 184,  16,  72,   0, 
-      0,   0,  42,   0,  62,  17, 
-      0,  16,   0,   0,   8,   0, 
-     82,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,  22,   0, 
-     80,  17,   0,   0,   5,   0, 
-      0,   0,   4,   0, 148,   8, 
-      0,   0,   1,   0, 188,  14, 
-     80,   0,   0,   0,  22,   0, 
-     80,  17,   0,   0,   5,   0, 
-      4,   0,   4,   0, 148,   8, 
-      0,   0,   1,   0, 188,  14, 
-     84,   0,   0,   0,  22,   0, 
-     80,  17,   0,   0,   5,   0, 
-      8,   0,   4,   0, 148,   8, 
-      0,   0,   1,   0, 188,  14, 
-     88,   0,   0,   0,  42,   0, 
-     62,  17,   0,  16,   0,   0, 
-      8,   0,  70,  48,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-     22,   0,  80,  17,   0,   0, 
-      5,   0,   0,   0,   4,   0, 
-     20,   9,   0,   0,   1,   0, 
-      8,  19,  96,   0,   0,   0, 
-     22,   0,  80,  17,   0,   0, 
-      5,   0,   4,   0,   4,   0, 
-     20,   9,   0,   0,   1,   0, 
-      8,  19, 100,   0,   0,   0, 
-     22,   0,  80,  17,   0,   0, 
-      5,   0,   8,   0,   4,   0, 
-     20,   9,   0,   0,   1,   0, 
-      8,  19, 104,   0,   0,   0, 
-     42,   0,  62,  17,   0,  16, 
-      0,   0,   8,   0,  76, 111, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,  22,   0,  80,  17, 
-      0,   0,   5,   0,   0,   0, 
-      4,   0,  52,   9,   0,   0, 
-      1,   0,  40,   0, 112,   0, 
-      0,   0,  22,   0,  80,  17, 
-      0,   0,   5,   0,   4,   0, 
-      4,   0,  52,   9,   0,   0, 
-      1,   0,  40,   0, 116,   0, 
-      0,   0,  22,   0,  80,  17, 
-      0,   0,   5,   0,   8,   0, 
-      4,   0,  52,   9,   0,   0, 
-      1,   0,  40,   0, 120,   0, 
-      0,   0,  22,   0,  80,  17, 
-      0,   0,   5,   0,   0,   0, 
-      4,   0,  92,   9,   0,   0, 
-      1,   0, 192,  18, 128,   0, 
-      0,   0,  22,   0,  80,  17, 
-      0,   0,   5,   0,   4,   0, 
-      4,   0,  92,   9,   0,   0, 
-      1,   0, 192,  18, 132,   0, 
-      0,   0,  22,   0,  80,  17, 
-      0,   0,   5,   0,   8,   0, 
-      4,   0,  92,   9,   0,   0, 
-      1,   0, 192,  18, 136,   0, 
-      0,   0,  42,   0,  62,  17, 
-    116,   0,   0,   0,   0,   0, 
-    105,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,  22,   0, 
-     80,  17,   0,   0,   1,   0, 
-      0,   0,   4,   0,  72,   9, 
-      0,   0,   1,   0,  40,   0, 
-     28,   0,   0,   0,  22,   0, 
-     80,  17,   0,   0,   1,   0, 
-      0,   0,   4,   0, 112,   9, 
-      0,   0,   1,   0, 228,  15, 
-     44,   0,   0,   0,  42,   0, 
-     62,  17,   0,  16,   0,   0, 
-      8,   0,  76,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-     22,   0,  80,  17,   0,   0, 
-      5,   0,   0,   0,   4,   0, 
-     36,  10,   0,   0,   1,   0, 
-     48,  10, 144,   0,   0,   0, 
-     22,   0,  80,  17,   0,   0, 
-      5,   0,   4,   0,   4,   0, 
-     36,  10,   0,   0,   1,   0, 
-     48,  10, 148,   0,   0,   0, 
-     22,   0,  80,  17,   0,   0, 
-      5,   0,   8,   0,   4,   0, 
-     36,  10,   0,   0,   1,   0, 
-     48,  10, 152,   0,   0,   0, 
-     42,   0,  62,  17,   0,  16, 
-      0,   0,   8,   0,  72,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,  22,   0,  80,  17, 
-      0,   0,   5,   0,   0,   0, 
-      4,   0, 140,  10,   0,   0, 
-      1,   0,  40,   6, 160,   0, 
-      0,   0,  22,   0,  80,  17, 
-      0,   0,   5,   0,   4,   0, 
-      4,   0, 140,  10,   0,   0, 
-      1,   0,  40,   6, 164,   0, 
-      0,   0,  22,   0,  80,  17, 
-      0,   0,   5,   0,   8,   0, 
-      4,   0, 140,  10,   0,   0, 
-      1,   0,  40,   6, 168,   0, 
-      0,   0,  46,   0,  62,  17, 
-     64,   0,   0,   0,   0,   0, 
-    100, 105, 115, 116,  97, 110, 
-     99, 101,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,  22,   0,  80,  17, 
-      0,   0,   1,   0,   0,   0, 
-      4,   0, 248,  10,   0,   0, 
-      1,   0,  28,   0,  60,   0, 
-      0,   0,  50,   0,  62,  17, 
-     64,   0,   0,   0,   0,   0, 
-     97, 116, 116, 101, 110, 117, 
-     97, 116, 105, 111, 110,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-     22,   0,  80,  17,   0,   0, 
-      1,   0,   0,   0,   4,   0, 
-     48,  11,   0,   0,   1,   0, 
-    104,   0,  60,   0,   0,   0, 
-     46,   0,  62,  17,   0,  16, 
-      0,   0,   8,   0, 114,  97, 
-    100, 105,  97, 110,  99, 101, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-     22,   0,  80,  17,   0,   0, 
-      5,   0,   0,   0,   4,   0, 
-     88,  11,   0,   0,   1,   0, 
-    168,   9, 176,   0,   0,   0, 
-     22,   0,  80,  17,   0,   0, 
-      5,   0,   4,   0,   4,   0, 
-     88,  11,   0,   0,   1,   0, 
-    168,   9, 180,   0,   0,   0, 
-     22,   0,  80,  17,   0,   0, 
-      5,   0,   8,   0,   4,   0, 
-     88,  11,   0,   0,   1,   0, 
-    168,   9, 184,   0,   0,   0, 
-     42,   0,  62,  17,  64,   0, 
-      0,   0,   0,   0,  78,  68, 
-     70,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,  22,   0,  80,  17, 
-      0,   0,   1,   0,   0,   0, 
-      4,   0,   8,  13,   0,   0, 
-      1,   0,  68,   5,  60,   0, 
-      0,   0,  42,   0,  62,  17, 
-     64,   0,   0,   0,   0,   0, 
-     71,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,  22,   0, 
-     80,  17,   0,   0,   1,   0, 
-      0,   0,   4,   0,  72,  16, 
-      0,   0,   1,   0,  80,   2, 
-     76,   0,   0,   0,  42,   0, 
-     62,  17,   0,  16,   0,   0, 
-      8,   0,  70,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-     22,   0,  80,  17,   0,   0, 
-      5,   0,   0,   0,   4,   0, 
-     48,  18,   0,   0,   1,   0, 
-     88,   1, 160,   0,   0,   0, 
-     22,   0,  80,  17,   0,   0, 
-      5,   0,   4,   0,   4,   0, 
-     48,  18,   0,   0,   1,   0, 
-     88,   1, 164,   0,   0,   0, 
-     22,   0,  80,  17,   0,   0, 
-      5,   0,   8,   0,   4,   0, 
-     48,  18,   0,   0,   1,   0, 
-     88,   1, 168,   0,   0,   0, 
-     50,   0,  62,  17,   0,  16, 
-      0,   0,   8,   0, 110, 117, 
-    109, 101, 114,  97, 116, 111, 
-    114,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,  22,   0, 
-     80,  17,   0,   0,   5,   0, 
-      0,   0,   4,   0, 104,  18, 
-      0,   0,   1,   0, 244,   0, 
-    192,   0,   0,   0,  22,   0, 
-     80,  17,   0,   0,   5,   0, 
-      4,   0,   4,   0, 104,  18, 
-      0,   0,   1,   0, 244,   0, 
-    196,   0,   0,   0,  22,   0, 
-     80,  17,   0,   0,   5,   0, 
-      8,   0,   4,   0, 104,  18, 
-      0,   0,   1,   0, 244,   0, 
-    200,   0,   0,   0,  50,   0, 
-     62,  17,  64,   0,   0,   0, 
-      0,   0, 100, 101, 110, 111, 
-    109, 105, 110,  97, 116, 111, 
-    114,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,  22,   0,  80,  17, 
-      0,   0,   1,   0,   0,   0, 
-      4,   0,  64,  19,   0,   0, 
-      1,   0, 136,   0,  60,   0, 
-      0,   0,  46,   0,  62,  17, 
-      0,  16,   0,   0,   8,   0, 
-    115, 112, 101,  99, 117, 108, 
-     97, 114,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,  22,   0,  80,  17, 
-      0,   0,   5,   0,   0,   0, 
-      4,   0,  92,  19,   0,   0, 
-      1,   0, 164,   1, 192,   0, 
-      0,   0,  22,   0,  80,  17, 
-      0,   0,   5,   0,   4,   0, 
-      4,   0,  92,  19,   0,   0, 
-      1,   0, 164,   1, 196,   0, 
-      0,   0,  22,   0,  80,  17, 
-      0,   0,   5,   0,   8,   0, 
-      4,   0,  92,  19,   0,   0, 
-      1,   0, 164,   1, 200,   0, 
-      0,   0,  42,   0,  62,  17, 
-      0,  16,   0,   0,   8,   0, 
-    107,  83,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,  22,   0, 
-     80,  17,   0,   0,   5,   0, 
-      0,   0,   4,   0, 112,  19, 
-      0,   0,   1,   0,  24,   0, 
-    160,   0,   0,   0,  22,   0, 
-     80,  17,   0,   0,   5,   0, 
-      4,   0,   4,   0, 112,  19, 
-      0,   0,   1,   0,  24,   0, 
-    164,   0,   0,   0,  22,   0, 
-     80,  17,   0,   0,   5,   0, 
-      8,   0,   4,   0, 112,  19, 
-      0,   0,   1,   0,  24,   0, 
-    168,   0,   0,   0,  42,   0, 
-     62,  17,   0,  16,   0,   0, 
-      8,   0, 107,  68,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-     22,   0,  80,  17,   0,   0, 
-      5,   0,   0,   0,   4,   0, 
-    176,  19,   0,   0,   1,   0, 
-     80,   1, 160,   0,   0,   0, 
-     22,   0,  80,  17,   0,   0, 
-      5,   0,   4,   0,   4,   0, 
-    176,  19,   0,   0,   1,   0, 
-     80,   1, 164,   0,   0,   0, 
-     22,   0,  80,  17,   0,   0, 
-      5,   0,   8,   0,   4,   0, 
-    176,  19,   0,   0,   1,   0, 
-     80,   1, 168,   0,   0,   0, 
-     46,   0,  62,  17,  64,   0, 
-      0,   0,   0,   0,  78, 100, 
-    111, 116,  76,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-     22,   0,  80,  17,   0,   0, 
-      1,   0,   0,   0,   4,   0, 
-     56,  20,   0,   0,   1,   0, 
-    200,   0,  60,   0,   0,   0, 
-     42,   0,  62,  17,   0,  16, 
-      0,   0,   8,   0,  70,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,  22,   0,  80,  17, 
-      0,   0,   5,   0,   0,   0, 
-      4,   0,  36,  23,   0,   0, 
-      1,   0, 232,   0, 112,   0, 
-      0,   0,  22,   0,  80,  17, 
-      0,   0,   5,   0,   4,   0, 
-      4,   0,  36,  23,   0,   0, 
-      1,   0, 232,   0, 116,   0, 
-      0,   0,  22,   0,  80,  17, 
-      0,   0,   5,   0,   8,   0, 
-      4,   0,  36,  23,   0,   0, 
-      1,   0, 232,   0, 120,   0, 
-      0,   0,  54,   0,  62,  17, 
-      0,  16,   0,   0,   8,   0, 
-    112, 114, 101, 102, 105, 108, 
-    116, 101, 114, 101, 100,  67, 
-    111, 108, 111, 114,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,  22,   0, 
-     80,  17,   0,   0,   5,   0, 
-      0,   0,   4,   0, 100,  23, 
-      0,   0,   1,   0, 184,   4, 
-     80,   0,   0,   0,  22,   0, 
-     80,  17,   0,   0,   5,   0, 
-      4,   0,   4,   0, 100,  23, 
-      0,   0,   1,   0, 184,   4, 
-     84,   0,   0,   0,  22,   0, 
-     80,  17,   0,   0,   5,   0, 
-      8,   0,   4,   0, 100,  23, 
-      0,   0,   1,   0, 184,   4, 
-     88,   0,   0,   0,  50,   0, 
-     62,  17,   9,  16,   0,   0, 
-      8,   0,  98, 114, 100, 102, 
-     76, 117, 116,  85, 118,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,  22,   0,  80,  17, 
-      0,   0,   5,   0,   0,   0, 
-      4,   0, 156,  23,   0,   0, 
-      1,   0,  64,   0,  16,   0, 
-      0,   0,  22,   0,  80,  17, 
-      0,   0,   5,   0,   4,   0, 
-      4,   0, 176,  23,   0,   0, 
-      1,   0,  44,   0,  20,   0, 
-      0,   0,  42,   0,  62,  17, 
-      1,  16,   0,   0,   8,   0, 
-     98, 114, 100, 102,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,  22,   0, 
-     80,  17,   0,   0,   5,   0, 
-      0,   0,   4,   0, 240,  23, 
-      0,   0,   1,   0,  84,   0, 
-     16,   0,   0,   0,  22,   0, 
-     80,  17,   0,   0,   5,   0, 
-      4,   0,   4,   0, 240,  23, 
-      0,   0,   1,   0,  84,   0, 
-     20,   0,   0,   0,  46,   0, 
-     62,  17,   0,  16,   0,   0, 
-      8,   0, 115, 112, 101,  99, 
-    117, 108,  97, 114,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,  22,   0, 
-     80,  17,   0,   0,   5,   0, 
-      0,   0,   4,   0,  68,  24, 
-      0,   0,   1,   0,  32,   3, 
-     16,   0,   0,   0,  22,   0, 
-     80,  17,   0,   0,   5,   0, 
-      4,   0,   4,   0,  68,  24, 
-      0,   0,   1,   0,  32,   3, 
-     20,   0,   0,   0,  22,   0, 
-     80,  17,   0,   0,   5,   0, 
-      8,   0,   4,   0,  68,  24, 
-      0,   0,   1,   0, 216,   3, 
-     28,   0,   0,   0,  42,   0, 
-     62,  17,   0,  16,   0,   0, 
-      8,   0, 107,  83,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-     22,   0,  80,  17,   0,   0, 
-      5,   0,   0,   0,   4,   0, 
-     16,  26,   0,   0,   1,   0, 
-     24,   0,  64,   0,   0,   0, 
-     22,   0,  80,  17,   0,   0, 
-      5,   0,   4,   0,   4,   0, 
-     16,  26,   0,   0,   1,   0, 
-     24,   0,  68,   0,   0,   0, 
-     22,   0,  80,  17,   0,   0, 
-      5,   0,   8,   0,   4,   0, 
-     16,  26,   0,   0,   1,   0, 
-     24,   0,  72,   0,   0,   0, 
-     42,   0,  62,  17,   0,  16, 
-      0,   0,   8,   0, 107,  68, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,  22,   0,  80,  17, 
-      0,   0,   5,   0,   0,   0, 
-      4,   0,  80,  26,   0,   0, 
-      1,   0, 204,   1,  64,   0, 
-      0,   0,  22,   0,  80,  17, 
-      0,   0,   5,   0,   4,   0, 
-      4,   0,  80,  26,   0,   0, 
-      1,   0, 204,   1,  68,   0, 
-      0,   0,  22,   0,  80,  17, 
-      0,   0,   5,   0,   8,   0, 
-      4,   0,  80,  26,   0,   0, 
-      1,   0, 204,   1,  72,   0, 
-      0,   0,  50,   0,  62,  17, 
-      0,  16,   0,   0,   8,   0, 
-    105, 114, 114,  97, 100, 105, 
-     97, 110,  99, 101,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-     22,   0,  80,  17,   0,   0, 
-      5,   0,   0,   0,   4,   0, 
-    144,  26,   0,   0,   1,   0, 
-    140,   1,  48,   0,   0,   0, 
-     22,   0,  80,  17,   0,   0, 
-      5,   0,   4,   0,   4,   0, 
-    144,  26,   0,   0,   1,   0, 
-    140,   1,  52,   0,   0,   0, 
-     22,   0,  80,  17,   0,   0, 
-      5,   0,   8,   0,   4,   0, 
-    144,  26,   0,   0,   1,   0, 
-    140,   1,  56,   0,   0,   0, 
-     46,   0,  62,  17,   0,  16, 
-      0,   0,   8,   0, 100, 105, 
-    102, 102, 117, 115, 101,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-     22,   0,  80,  17,   0,   0, 
-      5,   0,   0,   0,   4,   0, 
-    172,  26,   0,   0,   1,   0, 
-     28,   0,   0,   0,   0,   0, 
-     22,   0,  80,  17,   0,   0, 
-      5,   0,   4,   0,   4,   0, 
-    172,  26,   0,   0,   1,   0, 
-     28,   0,   4,   0,   0,   0, 
-     22,   0,  80,  17,   0,   0, 
-      5,   0,   8,   0,   4,   0, 
-    172,  26,   0,   0,   1,   0, 
-     28,   0,   8,   0,   0,   0, 
-     46,   0,  62,  17,   0,  16, 
-      0,   0,   8,   0,  97, 109, 
-     98, 105, 101, 110, 116,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-     22,   0,  80,  17,   0,   0, 
-      5,   0,   0,   0,   4,   0, 
-      0,  27,   0,   0,   1,   0, 
-     28,   0,   0,   0,   0,   0, 
-     22,   0,  80,  17,   0,   0, 
-      5,   0,   4,   0,   4,   0, 
-      0,  27,   0,   0,   1,   0, 
-     28,   0,   4,   0,   0,   0, 
-     22,   0,  80,  17,   0,   0, 
-      5,   0,   8,   0,   4,   0, 
-      0,  27,   0,   0,   1,   0, 
-     28,   0,   8,   0,   0,   0, 
-     46,   0,  62,  17,   0,  16, 
-      0,   0,   8,   0,  99, 111, 
-    108, 111, 114,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-     26,   0,  80,  17,   0,   0, 
-      5,   0,   0,   0,   4,   0, 
-     56,  27,   0,   0,   1,   0, 
-    228,   0,  72,   0, 112,   0, 
-      0,   0,   0,   0,  26,   0, 
-     80,  17,   0,   0,   5,   0, 
-      4,   0,   4,   0,  56,  27, 
-      0,   0,   1,   0, 228,   0, 
-     72,   0, 112,   0,   4,   0, 
-      0,   0,  26,   0,  80,  17, 
-      0,   0,   5,   0,   8,   0, 
-      4,   0,  56,  27,   0,   0, 
-      1,   0, 228,   0,  72,   0, 
-    112,   0,   8,   0,   0,   0, 
-     42,   0,  62,  17,  10,  16, 
-      0,   0,   0,   0,  80,  73, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,  22,   0,  80,  17, 
-      0,   0,   1,   0,   0,   0, 
-      4,   0,   4,   1,   0,   0, 
-      1,   0,  28,  20,   0,   0, 
-      0,   0, 222,   0,  77,  17, 
-    136,   0,   0,   0, 104,  24, 
-      0,   0,   0,  16,   0,   0, 
-      7,   0,   9,   5,  13,  64, 
-      6,   2,   3, 130,   4,  13, 
-     57,   6,   2,   3,  64,  13, 
-     30,   6,   4,   3, 128, 176, 
-      6,   2,   3,  20,  13,  25, 
-      6,   2,   3,  20,   6,   2, 
-      3,  20,  13,  38,   6,  12, 
-      3,  20,  13,  57,   6,   2, 
-      3,  76,  13,  56,   6,   2, 
-      3, 128, 208,  13,  55,   6, 
-      4,   3, 128, 184,  13,  46, 
-      6,   4,  12, 128, 160, 128, 
-    180,   8,   0,   9,  28,  13, 
-     59,   1, 130, 244,   6,  37, 
-      3,   0,   9,  12,  13,  63, 
-      3,  44,   9,  31,  13,  49, 
-      6,   2,   3,  20,  13,  55, 
-      3,  40,   9,  21,  13,  56, 
-      3,  60,   9,  17,  13,  29, 
-      6,   4,   3,  76,   6,   2, 
-      3,  20,   9,  18,  13,  24, 
-      6,   2,   3,  20,   6,   2, 
-      3,  20,   9,  21,  13,  37, 
-      6,  12,   3,  20,   9,  33, 
-     13,  42,   6,   2,   3,  76, 
-      9,  46,  13,  55,   3,  28, 
-      9,  33,   3,  28,   9,  23, 
-     13,  56,   3,  52,   9,  22, 
-      3,  76,   9,  33,  13,  54, 
-      6,   2,   3,  24,   9,  23, 
-     13,  55,   3, 108,   9,  14, 
-     13,  54,   6,   4,   3,  76, 
-      9,  22,  13,  44,   6,   4, 
-      3, 128, 180,   9,  12,  13, 
-     45,  12,  76,  84,  70,   0, 
-     62,  17,   8,  16,   0,   0, 
-    136,   0,  60,  71, 101, 116, 
-     78, 111, 114, 109,  97, 108, 
-     70, 114, 111, 109,  77,  97, 
-    112,  32, 114, 101, 116, 117, 
-    114, 110,  32, 118,  97, 108, 
-    117, 101,  62,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,  22,   0, 
-     80,  17,   0,   0,   5,   0, 
-      0,   0,   4,   0,  92,   7, 
-      0,   0,   1,   0,  20,   0, 
-     48,   0,   0,   0,  22,   0, 
-     80,  17,   0,   0,   5,   0, 
-      4,   0,   4,   0,  92,   7, 
-      0,   0,   1,   0,  20,   0, 
-     52,   0,   0,   0,  22,   0, 
-     80,  17,   0,   0,   5,   0, 
-      8,   0,   4,   0,  92,   7, 
-      0,   0,   1,   0,  20,   0, 
-     56,   0,   0,   0,  46,   0, 
-     62,  17,   0,  16,   0,   0, 
-      9,   0, 110, 111, 114, 109, 
-     97, 108,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,  22,   0, 
-     80,  17,   0,   0,   5,   0, 
-      8,   0,   4,   0, 244,   2, 
-      0,   0,   1,   0, 140,   1, 
-     48,   0,   0,   0,  22,   0, 
-     80,  17,   0,   0,   5,   0, 
-      0,   0,   4,   0, 244,   2, 
-      0,   0,   1,   0, 140,   1, 
-     52,   0,   0,   0,  22,   0, 
-     80,  17,   0,   0,   5,   0, 
-      4,   0,   4,   0, 244,   2, 
-      0,   0,   1,   0, 140,   1, 
-     56,   0,   0,   0,  54,   0, 
-     62,  17,   0,  16,   0,   0, 
-      8,   0, 116,  97, 110, 103, 
-    101, 110, 116,  78, 111, 114, 
-    109,  97, 108,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-     22,   0,  80,  17,   0,   0, 
-      5,   0,   0,   0,   4,   0, 
-     52,   3,   0,   0,   1,   0, 
-     60,   4,  64,   0,   0,   0, 
-     22,   0,  80,  17,   0,   0, 
-      5,   0,   4,   0,   4,   0, 
-     52,   3,   0,   0,   1,   0, 
-     60,   4,  68,   0,   0,   0, 
-     22,   0,  80,  17,   0,   0, 
-      5,   0,   8,   0,   4,   0, 
-     52,   3,   0,   0,   1,   0, 
-     60,   4,  72,   0,   0,   0, 
-     42,   0,  62,  17,   0,  16, 
-      0,   0,   8,   0,  81,  49, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,  22,   0,  80,  17, 
-      0,   0,   5,   0,   4,   0, 
-      4,   0, 248,   3,   0,   0, 
-      1,   0, 164,   0,  80,   0, 
-      0,   0,  22,   0,  80,  17, 
-      0,   0,   5,   0,   8,   0, 
-      4,   0, 248,   3,   0,   0, 
-      1,   0, 164,   0,  84,   0, 
-      0,   0,  22,   0,  80,  17, 
-      0,   0,   5,   0,   0,   0, 
-      4,   0, 248,   3,   0,   0, 
-      1,   0, 164,   0,  88,   0, 
-      0,   0,  42,   0,  62,  17, 
-      0,  16,   0,   0,   8,   0, 
-     81,  50,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,  22,   0, 
-     80,  17,   0,   0,   5,   0, 
-      4,   0,   4,   0,  12,   4, 
-      0,   0,   1,   0, 172,   0, 
-     96,   0,   0,   0,  22,   0, 
-     80,  17,   0,   0,   5,   0, 
-      8,   0,   4,   0,  12,   4, 
-      0,   0,   1,   0, 172,   0, 
-    100,   0,   0,   0,  22,   0, 
-     80,  17,   0,   0,   5,   0, 
-      0,   0,   4,   0,  12,   4, 
-      0,   0,   1,   0, 172,   0, 
-    104,   0,   0,   0,  42,   0, 
-     62,  17,   1,  16,   0,   0, 
-      8,   0, 115, 116,  49,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-     22,   0,  80,  17,   0,   0, 
-      5,   0,   4,   0,   4,   0, 
-     32,   4,   0,   0,   1,   0, 
-    232,   0,  28,   0,   0,   0, 
-     42,   0,  62,  17,   1,  16, 
-      0,   0,   8,   0, 115, 116, 
-     50,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,  22,   0,  80,  17, 
-      0,   0,   5,   0,   4,   0, 
-      4,   0,  52,   4,   0,   0, 
-      1,   0,  60,   3,  44,   0, 
-      0,   0,  46,   0,  62,  17, 
-      0,  16,   0,   0,   8,   0, 
-     78, 111, 114, 109,  97, 108, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,  22,   0,  80,  17, 
-      0,   0,   5,   0,   0,   0, 
-      4,   0, 128,   4,   0,   0, 
-      1,   0,  20,   2,  48,   0, 
-      0,   0,  22,   0,  80,  17, 
-      0,   0,   5,   0,   4,   0, 
-      4,   0, 128,   4,   0,   0, 
-      1,   0,  40,   2,  52,   0, 
-      0,   0,  22,   0,  80,  17, 
-      0,   0,   5,   0,   8,   0, 
-      4,   0, 128,   4,   0,   0, 
-      1,   0, 220,   2,  56,   0, 
-      0,   0,  46,   0,  62,  17, 
-      0,  16,   0,   0,   8,   0, 
-     84,  97, 110, 103, 101, 110, 
-    116,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,  22,   0,  80,  17, 
-      0,   0,   5,   0,   4,   0, 
-      4,   0,  80,   5,   0,   0, 
-      1,   0, 136,   1,  80,   0, 
-      0,   0,  22,   0,  80,  17, 
-      0,   0,   5,   0,   8,   0, 
-      4,   0,  80,   5,   0,   0, 
-      1,   0, 164,   1,  84,   0, 
-      0,   0,  22,   0,  80,  17, 
-      0,   0,   5,   0,   0,   0, 
-      4,   0,  80,   5,   0,   0, 
-      1,   0, 192,   1,  88,   0, 
-      0,   0,  46,   0,  62,  17, 
-      0,  16,   0,   0,   8,   0, 
-     66, 105, 110, 111, 114, 109, 
-     97, 108,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,  22,   0,  80,  17, 
-      0,   0,   5,   0,   0,   0, 
-      4,   0,   8,   6,   0,   0, 
-      1,   0, 104,   1,  96,   0, 
-      0,   0,  22,   0,  80,  17, 
-      0,   0,   5,   0,   4,   0, 
-      4,   0,   8,   6,   0,   0, 
-      1,   0, 104,   1, 100,   0, 
-      0,   0,  22,   0,  80,  17, 
-      0,   0,   5,   0,   8,   0, 
-      4,   0,   8,   6,   0,   0, 
-      1,   0, 104,   1, 104,   0, 
-      0,   0,  42,   0,  62,  17, 
-     13,  16,   0,   0,   8,   0, 
-     84,  66,  78,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,  22,   0, 
-     80,  17,   0,   0,   5,   0, 
-      0,   0,   4,   0,  28,   6, 
-      0,   0,   1,   0,  84,   1, 
-    112,   0,   0,   0,  22,   0, 
-     80,  17,   0,   0,   5,   0, 
-      4,   0,   4,   0,  48,   6, 
-      0,   0,   1,   0,  64,   1, 
-    116,   0,   0,   0,  22,   0, 
-     80,  17,   0,   0,   5,   0, 
-      8,   0,   4,   0,  68,   6, 
-      0,   0,   1,   0,  44,   1, 
-    120,   0,   0,   0,  22,   0, 
-     80,  17,   0,   0,   5,   0, 
-     12,   0,   4,   0,  88,   6, 
-      0,   0,   1,   0,  24,   1, 
-    128,   0,   0,   0,  22,   0, 
-     80,  17,   0,   0,   5,   0, 
-     16,   0,   4,   0, 108,   6, 
-      0,   0,   1,   0,   4,   1, 
-    132,   0,   0,   0,  22,   0, 
-     80,  17,   0,   0,   5,   0, 
-     20,   0,   4,   0, 128,   6, 
-      0,   0,   1,   0, 240,   0, 
-    136,   0,   0,   0,  22,   0, 
-     80,  17,   0,   0,   5,   0, 
-     24,   0,   4,   0, 148,   6, 
-      0,   0,   1,   0, 200,   0, 
-     48,   0,   0,   0,  22,   0, 
-     80,  17,   0,   0,   5,   0, 
-     28,   0,   4,   0, 168,   6, 
-      0,   0,   1,   0, 180,   0, 
-     52,   0,   0,   0,  22,   0, 
-     80,  17,   0,   0,   5,   0, 
-     32,   0,   4,   0, 188,   6, 
-      0,   0,   1,   0, 160,   0, 
-     56,   0,   0,   0,   2,   0, 
-     78,  17, 158,   0,  77,  17, 
-    136,   0,   0,   0, 136,  28, 
-      0,   0,   1,  16,   0,   0, 
-      7,   0,   9,   5,  13,  36, 
-      6,   2,   3, 138, 168,  13, 
-     21,   6,   2,   3,  28,  13, 
-     38,   6,   2,   3,  28,  13, 
-     33,   6,   2,   3,  56,  13, 
-     19,   6,   4,   3,  28,  13, 
-     46,   6,   2,   3,  20,  13, 
-     31,   6,   2,   3, 104,  13, 
-     23,   6,   4,  12,  28,  56, 
-      8,   0,   9,  15,  13,  35, 
-      1, 139, 152,   6,  19,   3, 
-      0,   9,  16,  13,  20,   6, 
-      2,   3,  28,   9,  23,  13, 
-     31,   6,   2,   3,  28,   9, 
-     19,  13,  37,   3,  28,   9, 
-     20,  13,  32,   6,   2,   3, 
-     28,   9,  11,  13,  18,   6, 
-      4,   3,  28,   9,  30,  13, 
-     37,   6,   2,   3,  20,   9, 
-     20,  13,  38,   3,  48,  13, 
-     44,   3,  28,   9,  13,  13, 
-     22,   6,   2,   3,  28,  13, 
-     30,   3,  28,   9,  12,  13, 
-     22,   6,   4,  12,  28,  28, 
-     70,   0,  62,  17,  10,  16, 
-      0,   0, 128,   0,  60,  68, 
-    105, 115, 116, 114, 105,  98, 
-    117, 116, 105, 111, 110,  71, 
-     71,  88,  32, 114, 101, 116, 
-    117, 114, 110,  32, 118,  97, 
-    108, 117, 101,  62,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-     22,   0,  80,  17,   0,   0, 
-      1,   0,   0,   0,   4,   0, 
-    244,  12,   0,   0,   1,   0, 
-     20,   0,  60,   0,   0,   0, 
-     42,   0,  62,  17,   0,  16, 
-      0,   0,   9,   0,  78,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,  22,   0,  80,  17, 
-      0,   0,   5,   0,   0,   0, 
-      4,   0, 152,  11,   0,   0, 
-      1,   0, 112,   1, 192,   0, 
-      0,   0,  22,   0,  80,  17, 
-      0,   0,   5,   0,   4,   0, 
-      4,   0, 152,  11,   0,   0, 
-      1,   0, 112,   1, 196,   0, 
-      0,   0,  22,   0,  80,  17, 
-      0,   0,   5,   0,   8,   0, 
-      4,   0, 152,  11,   0,   0, 
-      1,   0, 112,   1, 200,   0, 
-      0,   0,  42,   0,  62,  17, 
-      0,  16,   0,   0,   9,   0, 
-     72,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,  22,   0, 
-     80,  17,   0,   0,   5,   0, 
-      0,   0,   4,   0, 152,  11, 
-      0,   0,   1,   0, 112,   1, 
-    160,   0,   0,   0,  22,   0, 
-     80,  17,   0,   0,   5,   0, 
-      4,   0,   4,   0, 152,  11, 
-      0,   0,   1,   0, 112,   1, 
-    164,   0,   0,   0,  22,   0, 
-     80,  17,   0,   0,   5,   0, 
-      8,   0,   4,   0, 152,  11, 
-      0,   0,   1,   0, 112,   1, 
-    168,   0,   0,   0,  50,   0, 
-     62,  17,  64,   0,   0,   0, 
-      1,   0, 114, 111, 117, 103, 
-    104, 110, 101, 115, 115,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,  22,   0,  80,  17, 
-      0,   0,   1,   0,   0,   0, 
-      4,   0, 152,  11,   0,   0, 
-      1,   0,  28,   0,  60,   0, 
-      0,   0,  42,   0,  62,  17, 
-     64,   0,   0,   0,   0,   0, 
-     97,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,  22,   0, 
-     80,  17,   0,   0,   1,   0, 
-      0,   0,   4,   0, 180,  11, 
-      0,   0,   1,   0,  28,   0, 
-     60,   0,   0,   0,  42,   0, 
-     62,  17,  64,   0,   0,   0, 
-      0,   0,  97,  50,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-     22,   0,  80,  17,   0,   0, 
-      1,   0,   0,   0,   4,   0, 
-    208,  11,   0,   0,   1,   0, 
-     36,   1,  60,   0,   0,   0, 
-     46,   0,  62,  17,  64,   0, 
-      0,   0,   0,   0,  78, 100, 
-    111, 116,  72,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-     22,   0,  80,  17,   0,   0, 
-      1,   0,   0,   0,   4,   0, 
-      8,  12,   0,   0,   1,   0, 
-     28,   0,  76,   0,   0,   0, 
-     46,   0,  62,  17,  64,   0, 
-      0,   0,   0,   0,  78, 100, 
-    111, 116,  72,  50,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-     22,   0,  80,  17,   0,   0, 
-      1,   0,   0,   0,   4,   0, 
-     36,  12,   0,   0,   1,   0, 
-     96,   0,  76,   0,   0,   0, 
-     42,   0,  62,  17,  64,   0, 
-      0,   0,   0,   0, 110, 117, 
-    109,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,  22,   0,  80,  17, 
-      0,   0,   1,   0,   0,   0, 
-      4,   0,  56,  12,   0,   0, 
-      1,   0, 188,   0,  60,   0, 
-      0,   0,  46,   0,  62,  17, 
-     64,   0,   0,   0,   0,   0, 
-    100, 101, 110, 111, 109,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,  22,   0,  80,  17, 
-      0,   0,   1,   0,   0,   0, 
-      4,   0, 160,  12,   0,   0, 
-      1,   0, 104,   0,  76,   0, 
-      0,   0,  42,   0,  62,  17, 
-     10,  16,   0,   0,   0,   0, 
-     80,  73,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,  22,   0, 
-     80,  17,   0,   0,   1,   0, 
-      0,   0,   4,   0, 152,  11, 
-      0,   0,   1,   0, 112,   1, 
-      0,   0,   0,   0,   2,   0, 
-     78,  17, 114,   0,  77,  17, 
-    136,   0,   0,   0,  76,  37, 
-      0,   0,   2,  16,   0,   0, 
-      7,   0,   9,   5,  13,  38, 
-      6,   2,   3, 140, 108,   6, 
-      2,   3,  56,  13,  54,   6, 
-      2,   3,  56,   6,   2,   3, 
-    129,  48,  13,  23,   6,   4, 
-     12,  28, 129,  28,   8,   0, 
-      9,  23,  13,  31,   1, 141, 
-     92,   6,  11,   3,   0,   9, 
-     19,  13,  37,   3,  28,   9, 
-     23,  13,  31,   6,   2,   3, 
-     28,   9,  19,  13,  37,   3, 
-     28,   9,  18,  13,  53,   6, 
-      2,   3,  28,   9,  11,   3, 
-    129,  28,   9,  18,   6,   2, 
-      3,  20,   9,  11,   3, 129, 
-      8,   9,  12,  13,  22,   6, 
-      4,  12,  28,  20,  66,   0, 
-     62,  17,  10,  16,   0,   0, 
-    128,   0,  60,  71, 101, 111, 
-    109, 101, 116, 114, 121,  83, 
-    109, 105, 116, 104,  32, 114, 
-    101, 116, 117, 114, 110,  32, 
-    118,  97, 108, 117, 101,  62, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-     22,   0,  80,  17,   0,   0, 
-      1,   0,   0,   0,   4,   0, 
-     52,  16,   0,   0,   1,   0, 
-     20,   0,  76,   0,   0,   0, 
-     42,   0,  62,  17,   0,  16, 
-      0,   0,   9,   0,  78,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,  22,   0,  80,  17, 
-      0,   0,   5,   0,   0,   0, 
-      4,   0,  92,  13,   0,   0, 
-      1,   0, 236,   2, 192,   0, 
-      0,   0,  22,   0,  80,  17, 
-      0,   0,   5,   0,   4,   0, 
-      4,   0,  92,  13,   0,   0, 
-      1,   0, 236,   2, 196,   0, 
-      0,   0,  22,   0,  80,  17, 
-      0,   0,   5,   0,   8,   0, 
-      4,   0,  92,  13,   0,   0, 
-      1,   0, 236,   2, 200,   0, 
-      0,   0,  42,   0,  62,  17, 
-      0,  16,   0,   0,   9,   0, 
-     86,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,  22,   0, 
-     80,  17,   0,   0,   5,   0, 
-      0,   0,   4,   0,  92,  13, 
-      0,   0,   1,   0, 236,   2, 
-    208,   0,   0,   0,  22,   0, 
-     80,  17,   0,   0,   5,   0, 
-      4,   0,   4,   0,  92,  13, 
-      0,   0,   1,   0, 236,   2, 
-    212,   0,   0,   0,  22,   0, 
-     80,  17,   0,   0,   5,   0, 
-      8,   0,   4,   0,  92,  13, 
-      0,   0,   1,   0, 236,   2, 
-    216,   0,   0,   0,  42,   0, 
-     62,  17,   0,  16,   0,   0, 
-      9,   0,  76,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-     22,   0,  80,  17,   0,   0, 
-      5,   0,   0,   0,   4,   0, 
-     92,  13,   0,   0,   1,   0, 
-    236,   2, 144,   0,   0,   0, 
-     22,   0,  80,  17,   0,   0, 
-      5,   0,   4,   0,   4,   0, 
-     92,  13,   0,   0,   1,   0, 
-    236,   2, 148,   0,   0,   0, 
-     22,   0,  80,  17,   0,   0, 
-      5,   0,   8,   0,   4,   0, 
-     92,  13,   0,   0,   1,   0, 
-    236,   2, 152,   0,   0,   0, 
-     50,   0,  62,  17,  64,   0, 
-      0,   0,   1,   0, 114, 111, 
-    117, 103, 104, 110, 101, 115, 
-    115,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,  22,   0, 
-     80,  17,   0,   0,   1,   0, 
-      0,   0,   4,   0,  92,  13, 
-      0,   0,   1,   0, 212,   1, 
-     76,   0,   0,   0,  46,   0, 
-     62,  17,  64,   0,   0,   0, 
-      0,   0,  78, 100, 111, 116, 
-     86,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,  22,   0, 
-     80,  17,   0,   0,   1,   0, 
-      0,   0,   4,   0, 148,  13, 
-      0,   0,   1,   0,  84,   1, 
-     92,   0,   0,   0,  46,   0, 
-     62,  17,  64,   0,   0,   0, 
-      0,   0,  78, 100, 111, 116, 
-     76,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,  22,   0, 
-     80,  17,   0,   0,   1,   0, 
-      0,   0,   4,   0, 204,  13, 
-      0,   0,   1,   0, 124,   2, 
-    108,   0,   0,   0,  42,   0, 
-     62,  17,  64,   0,   0,   0, 
-      0,   0, 103, 103, 120,  50, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-     22,   0,  80,  17,   0,   0, 
-      1,   0,   0,   0,   4,   0, 
-    252,  14,   0,   0,   1,   0, 
-     76,   1,  92,   0,   0,   0, 
-     42,   0,  62,  17,  64,   0, 
-      0,   0,   0,   0, 103, 103, 
-    120,  49,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,  22,   0,  80,  17, 
-      0,   0,   1,   0,   0,   0, 
-      4,   0,  24,  16,   0,   0, 
-      1,   0,  28,   0,  76,   0, 
-      0,   0, 110,   0,  77,  17, 
-    140,  28,   0,   0, 152,  34, 
-      0,   0,   3,  16,   0,   0, 
-      7,   0,   9,   5,  13,  32, 
-      6,   2,   3, 141,   8,  13, 
-     28,   6,   2,   3,  28,  13, 
-     22,   6,   4,   3,  56,  13, 
-     40,   6,   2,   3,  20,  13, 
-     23,   6,   4,  12,  28, 108, 
-      8,   0,   9,  16,  13,  30, 
-      1, 141, 248,   6,  13,   3, 
-      0,  13,  20,   6,   2,   3, 
-     28,   9,  15,  13,  27,   3, 
-     28,   9,  11,  13,  21,   6, 
-      4,   3,  28,   9,  28,  13, 
-     34,   6,   2,   3,  20,   9, 
-     19,  13,  35,   3,  52,  13, 
-     39,   3,  28,   9,  12,  13, 
-     22,   6,   4,  12,  28,  28, 
-     74,   0,  62,  17,  10,  16, 
-      0,   0, 128,   0,  60,  71, 
-    101, 111, 109, 101, 116, 114, 
-    121,  83,  99, 104, 108, 105, 
-     99, 107,  71,  71,  88,  32, 
-    114, 101, 116, 117, 114, 110, 
-     32, 118,  97, 108, 117, 101, 
-     62,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,  22,   0, 
-     80,  17,   0,   0,   1,   0, 
-      0,   0,   4,   0, 232,  14, 
-      0,   0,   1,   0,  20,   0, 
-     92,   0,   0,   0,  46,   0, 
-     62,  17,  64,   0,   0,   0, 
-      1,   0,  78, 100, 111, 116, 
-     86,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,  22,   0, 
-     80,  17,   0,   0,   1,   0, 
-      0,   0,   4,   0, 248,  13, 
-      0,   0,   1,   0, 240,   0, 
-     92,   0,   0,   0,  50,   0, 
-     62,  17,  64,   0,   0,   0, 
-      1,   0, 114, 111, 117, 103, 
-    104, 110, 101, 115, 115,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,  22,   0,  80,  17, 
-      0,   0,   1,   0,   0,   0, 
-      4,   0, 248,  13,   0,   0, 
-      1,   0,   4,   1,  76,   0, 
-      0,   0,  42,   0,  62,  17, 
-     64,   0,   0,   0,   0,   0, 
-    114,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,  22,   0, 
-     80,  17,   0,   0,   1,   0, 
-      0,   0,   4,   0,  20,  14, 
-      0,   0,   1,   0,  28,   0, 
-    124,   0,   0,   0,  42,   0, 
-     62,  17,  64,   0,   0,   0, 
-      0,   0, 107,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-     22,   0,  80,  17,   0,   0, 
-      1,   0,   0,   0,   4,   0, 
-     76,  14,   0,   0,   1,   0, 
-    128,   0, 124,   0,   0,   0, 
-     42,   0,  62,  17,  64,   0, 
-      0,   0,   0,   0, 110, 117, 
-    109,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,  22,   0,  80,  17, 
-      0,   0,   1,   0,   0,   0, 
-      4,   0,  96,  14,   0,   0, 
-      1,   0, 136,   0,  92,   0, 
-      0,   0,  46,   0,  62,  17, 
-     64,   0,   0,   0,   0,   0, 
-    100, 101, 110, 111, 109,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,  22,   0,  80,  17, 
-      0,   0,   1,   0,   0,   0, 
-      4,   0, 204,  14,   0,   0, 
-      1,   0,  48,   0, 124,   0, 
-      0,   0,   2,   0,  78,  17, 
-    110,   0,  77,  17, 140,  28, 
-      0,   0,  72,  37,   0,   0, 
-      3,  16,   0,   0,   7,   0, 
-      9,   5,  13,  32,   6,   2, 
-      3, 142,  36,  13,  28,   6, 
-      2,   3,  28,  13,  22,   6, 
-      4,   3,  56,  13,  40,   6, 
-      2,   3,  20,  13,  23,   6, 
-      4,  12,  28, 108,   8,   0, 
-      9,  16,  13,  30,   1, 143, 
-     20,   6,  13,   3,   0,  13, 
-     20,   6,   2,   3,  28,   9, 
-     15,  13,  27,   3,  28,   9, 
-     11,  13,  21,   6,   4,   3, 
-     28,   9,  28,  13,  34,   6, 
-      2,   3,  20,   9,  19,  13, 
-     35,   3,  52,  13,  39,   3, 
-     28,   9,  12,  13,  22,   6, 
-      4,  12,  28,  28,  74,   0, 
-     62,  17,  10,  16,   0,   0, 
-    128,   0,  60,  71, 101, 111, 
-    109, 101, 116, 114, 121,  83, 
-     99, 104, 108, 105,  99, 107, 
-     71,  71,  88,  32, 114, 101, 
-    116, 117, 114, 110,  32, 118, 
-     97, 108, 117, 101,  62,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,  22,   0,  80,  17, 
-      0,   0,   1,   0,   0,   0, 
-      4,   0,  20,  15,   0,   0, 
-      1,   0, 240,   0,  92,   0, 
-      0,   0,  22,   0,  80,  17, 
-      0,   0,   1,   0,   0,   0, 
-      4,   0,   4,  16,   0,   0, 
-      1,   0,  20,   0,  76,   0, 
-      0,   0,  46,   0,  62,  17, 
-     64,   0,   0,   0,   1,   0, 
-     78, 100, 111, 116,  86,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,  22,   0,  80,  17, 
-      0,   0,   1,   0,   0,   0, 
-      4,   0,  20,  15,   0,   0, 
-      1,   0,   4,   1, 108,   0, 
-      0,   0,  50,   0,  62,  17, 
-     64,   0,   0,   0,   1,   0, 
-    114, 111, 117, 103, 104, 110, 
-    101, 115, 115,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-     22,   0,  80,  17,   0,   0, 
-      1,   0,   0,   0,   4,   0, 
-     20,  15,   0,   0,   1,   0, 
-     28,   0,  76,   0,   0,   0, 
-     42,   0,  62,  17,  64,   0, 
-      0,   0,   0,   0, 114,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,  22,   0,  80,  17, 
-      0,   0,   1,   0,   0,   0, 
-      4,   0,  48,  15,   0,   0, 
-      1,   0,  28,   0,  76,   0, 
-      0,   0,  42,   0,  62,  17, 
-     64,   0,   0,   0,   0,   0, 
-    107,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,  22,   0, 
-     80,  17,   0,   0,   1,   0, 
-      0,   0,   4,   0, 104,  15, 
-      0,   0,   1,   0, 128,   0, 
-     76,   0,   0,   0,  42,   0, 
-     62,  17,  64,   0,   0,   0, 
-      0,   0, 110, 117, 109,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-     22,   0,  80,  17,   0,   0, 
-      1,   0,   0,   0,   4,   0, 
-    124,  15,   0,   0,   1,   0, 
-    156,   0, 108,   0,   0,   0, 
-     46,   0,  62,  17,  64,   0, 
-      0,   0,   0,   0, 100, 101, 
-    110, 111, 109,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-     22,   0,  80,  17,   0,   0, 
-      1,   0,   0,   0,   4,   0, 
-     20,  15,   0,   0,   1,   0, 
-    128,   0, 124,   0,   0,   0, 
-     22,   0,  80,  17,   0,   0, 
-      1,   0,   0,   0,   4,   0, 
-    232,  15,   0,   0,   1,   0, 
-     28,   0,  76,   0,   0,   0, 
-      2,   0,  78,  17,   2,   0, 
-     78,  17,  66,   0,  77,  17, 
-    136,   0,   0,   0, 224,  38, 
-      0,   0,   4,  16,   0,   0, 
-      7,   0,   9,   5,  13,  64, 
-      6,   2,  12, 129, 104, 143, 
-    196,   8,   0,   9,  18,  13, 
-     25,   1, 144, 180,   3,   0, 
-      9,  43,  13,  56,   3,  64, 
-      9,  34,  13,  57,   3,  52, 
-      9,  30,  13,  63,   3,  56, 
-      9,  17,   3, 128, 132,   9, 
-     12,  12,  28,  28,  70,   0, 
-     62,  17,   8,  16,   0,   0, 
-    136,   0,  60,  70, 114, 101, 
-    115, 110, 101, 108,  83,  99, 
-    104, 108, 105,  99, 107,  32, 
-    114, 101, 116, 117, 114, 110, 
-     32, 118,  97, 108, 117, 101, 
-     62,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,  22,   0, 
-     80,  17,   0,   0,   5,   0, 
-      0,   0,   4,   0,  28,  18, 
-      0,   0,   1,   0,  20,   0, 
-    160,   0,   0,   0,  22,   0, 
-     80,  17,   0,   0,   5,   0, 
-      4,   0,   4,   0,  28,  18, 
-      0,   0,   1,   0,  20,   0, 
-    164,   0,   0,   0,  22,   0, 
-     80,  17,   0,   0,   5,   0, 
-      8,   0,   4,   0,  28,  18, 
-      0,   0,   1,   0,  20,   0, 
-    168,   0,   0,   0,  46,   0, 
-     62,  17,  64,   0,   0,   0, 
-      1,   0,  99, 111, 115,  84, 
-    104, 101, 116,  97,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,  22,   0, 
-     80,  17,   0,   0,   1,   0, 
-      0,   0,   4,   0, 180,  16, 
-      0,   0,   1,   0,  88,   0, 
-     92,   0,   0,   0,  42,   0, 
-     62,  17,   0,  16,   0,   0, 
-      9,   0,  70,  48,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-     22,   0,  80,  17,   0,   0, 
-      5,   0,   0,   0,   4,   0, 
-    180,  16,   0,   0,   1,   0, 
-    104,   1, 160,   0,   0,   0, 
-     22,   0,  80,  17,   0,   0, 
-      5,   0,   4,   0,   4,   0, 
-    180,  16,   0,   0,   1,   0, 
-    104,   1, 164,   0,   0,   0, 
-     22,   0,  80,  17,   0,   0, 
-      5,   0,   8,   0,   4,   0, 
-    180,  16,   0,   0,   1,   0, 
-    104,   1, 168,   0,   0,   0, 
-      2,   0,  78,  17,  86,   0, 
-     77,  17, 136,   0,   0,   0, 
-     48,  41,   0,   0,   5,  16, 
-      0,   0,   7,   0,   9,   5, 
-     13,  52,   6,   2,   3, 148, 
-    116,  13, 128, 133,   6,   2, 
-     12, 129, 120,  52,   8,   0, 
-      9,  37,  13,  51,   1, 149, 
-    100,  11,  48,   9,  18,  13, 
-     89,   6,   2,   3,  52,  13, 
-     94,   3,  28,   9, 112,  13, 
-    125,   3,  52,   9, 103,  13, 
-    126,   3,  52,   9,  99,  13, 
-    128, 132,   3,  56,   9,  17, 
-      3, 128, 132,   9,  12,  12, 
-     28,  28,  78,   0,  62,  17, 
-      8,  16,   0,   0, 136,   0, 
-     60,  70, 114, 101, 115, 110, 
-    101, 108,  83,  99, 104, 108, 
-    105,  99, 107,  82, 111, 117, 
-    103, 104, 110, 101, 115, 115, 
-     32, 114, 101, 116, 117, 114, 
-    110,  32, 118,  97, 108, 117, 
-    101,  62,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,  22,   0, 
-     80,  17,   0,   0,   5,   0, 
-      0,   0,   4,   0,  16,  23, 
-      0,   0,   1,   0,  20,   0, 
-    112,   0,   0,   0,  22,   0, 
-     80,  17,   0,   0,   5,   0, 
-      4,   0,   4,   0,  16,  23, 
-      0,   0,   1,   0,  20,   0, 
-    116,   0,   0,   0,  22,   0, 
-     80,  17,   0,   0,   5,   0, 
-      8,   0,   4,   0,  16,  23, 
-      0,   0,   1,   0,  20,   0, 
-    120,   0,   0,   0,  46,   0, 
-     62,  17,  64,   0,   0,   0, 
-      1,   0,  99, 111, 115,  84, 
-    104, 101, 116,  97,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,  22,   0, 
-     80,  17,   0,   0,   1,   0, 
-      0,   0,   4,   0, 100,  21, 
-      0,   0,   1,   0, 156,   0, 
-      0,   0,   0,   0,  42,   0, 
-     62,  17,   0,  16,   0,   0, 
-      9,   0,  70,  48,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-     22,   0,  80,  17,   0,   0, 
-      5,   0,   0,   0,   4,   0, 
-    100,  21,   0,   0,   1,   0, 
-    192,   1,  96,   0,   0,   0, 
-     22,   0,  80,  17,   0,   0, 
-      5,   0,   4,   0,   4,   0, 
-    100,  21,   0,   0,   1,   0, 
-    192,   1, 100,   0,   0,   0, 
-     22,   0,  80,  17,   0,   0, 
-      5,   0,   8,   0,   4,   0, 
-    100,  21,   0,   0,   1,   0, 
-    192,   1, 104,   0,   0,   0, 
-     50,   0,  62,  17,  64,   0, 
-      0,   0,   1,   0, 114, 111, 
-    117, 103, 104, 110, 101, 115, 
-    115,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,  22,   0, 
-     80,  17,   0,   0,   1,   0, 
-      0,   0,   4,   0, 100,  21, 
-      0,   0,   1,   0, 192,   1, 
-     20,   0,   0,   0,  58,   0, 
-     62,  17,  10,  16,   0,   0, 
-      0,   0, 111, 110, 101,  77, 
-    105, 110, 117, 115,  82, 111, 
-    117, 103, 104, 110, 101, 115, 
-    115,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,  22,   0, 
-     80,  17,   0,   0,   1,   0, 
-      0,   0,   4,   0, 152,  21, 
-      0,   0,   1,   0, 208,   0, 
-     28,   0,   0,   0,   2,   0, 
-     78,  17,  66,   0,  77,  17, 
-    136,   0,   0,   0, 196,  42, 
-      0,   0,   4,  16,   0,   0, 
-      7,   0,   9,   5,  13,  64, 
-      6,   2,  12, 129, 104, 151, 
-    164,   8,   0,   9,  18,  13, 
-     25,   1, 152, 148,   3,   0, 
-      9,  43,  13,  56,   3,  64, 
-      9,  34,  13,  57,   3,  52, 
-      9,  30,  13,  63,   3,  56, 
-      9,  17,   3, 128, 132,   9, 
-     12,  12,  28,  28,  70,   0, 
-     62,  17,   8,  16,   0,   0, 
-    136,   0,  60,  70, 114, 101, 
-    115, 110, 101, 108,  83,  99, 
-    104, 108, 105,  99, 107,  32, 
-    114, 101, 116, 117, 114, 110, 
-     32, 118,  97, 108, 117, 101, 
-     62,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,  22,   0, 
-     80,  17,   0,   0,   5,   0, 
-      0,   0,   4,   0, 252,  25, 
-      0,   0,   1,   0,  20,   0, 
-     64,   0,   0,   0,  22,   0, 
-     80,  17,   0,   0,   5,   0, 
-      4,   0,   4,   0, 252,  25, 
-      0,   0,   1,   0,  20,   0, 
-     68,   0,   0,   0,  22,   0, 
-     80,  17,   0,   0,   5,   0, 
-      8,   0,   4,   0, 252,  25, 
-      0,   0,   1,   0,  20,   0, 
-     72,   0,   0,   0,  46,   0, 
-     62,  17,  64,   0,   0,   0, 
-      1,   0,  99, 111, 115,  84, 
-    104, 101, 116,  97,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,  22,   0, 
-     80,  17,   0,   0,   1,   0, 
-      0,   0,   4,   0, 148,  24, 
-      0,   0,   1,   0,  88,   0, 
-      0,   0,   0,   0,  42,   0, 
-     62,  17,   0,  16,   0,   0, 
-      9,   0,  70,  48,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-     22,   0,  80,  17,   0,   0, 
-      5,   0,   0,   0,   4,   0, 
-    148,  24,   0,   0,   1,   0, 
-    124,   1,  96,   0,   0,   0, 
-     22,   0,  80,  17,   0,   0, 
-      5,   0,   4,   0,   4,   0, 
-    148,  24,   0,   0,   1,   0, 
-    124,   1, 100,   0,   0,   0, 
-     22,   0,  80,  17,   0,   0, 
-      5,   0,   8,   0,   4,   0, 
-    148,  24,   0,   0,   1,   0, 
-    124,   1, 104,   0,   0,   0, 
-      2,   0,  78,  17,  46,   0, 
-     77,  17, 136,   0,   0,   0, 
-    132,  43,   0,   0,   6,  16, 
-      0,   0,   7,   0,   9,   5, 
-     13,  51,   6,   4,  12,  68, 
-    154,  76,   8,   0,   9,  21, 
-     13,  49,   1, 155,  60,   3, 
-      0,   9,  12,  13,  50,  12, 
-     28,  40,   0,   0,  66,   0, 
-     62,  17,   8,  16,   0,   0, 
-    136,   0,  60,  84, 111, 110, 
-    101,  77,  97, 112,  72,  68, 
-     82,  32, 114, 101, 116, 117, 
-    114, 110,  32, 118,  97, 108, 
-    117, 101,  62,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-     22,   0,  80,  17,   0,   0, 
-      5,   0,   0,   0,   4,   0, 
-    128,  27,   0,   0,   1,   0, 
-      4,   0,   0,   0,   0,   0, 
-     22,   0,  80,  17,   0,   0, 
-      5,   0,   4,   0,   4,   0, 
-    128,  27,   0,   0,   1,   0, 
-      4,   0,   4,   0,   0,   0, 
-     22,   0,  80,  17,   0,   0, 
-      5,   0,   8,   0,   4,   0, 
-    128,  27,   0,   0,   1,   0, 
-      4,   0,   8,   0,   0,   0, 
-      2,   0,  78,  17,  54,   0, 
-     77,  17, 136,   0,   0,   0, 
-    144,  44,   0,   0,   7,  16, 
-      0,   0,   7,   0,   9,   5, 
-     13,  33,   6,   2,   3, 154, 
-    148,  13,  48,   6,   2,  12, 
-     68,  20,   8,   0,   9,  17, 
-     13,  32,   1, 155, 132,  11, 
-     48,   9,  12,  13,  47,   6, 
-      2,  12,  68,  20,   0,   0, 
-     66,   0,  62,  17,   8,  16, 
-      0,   0, 136,   0,  60,  67, 
-    111, 114, 114, 101,  99, 116, 
-     71,  97, 109, 109,  97,  32, 
-    114, 101, 116, 117, 114, 110, 
-     32, 118,  97, 108, 117, 101, 
-     62,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,  22,   0,  80,  17, 
-      0,   0,   5,   0,   0,   0, 
-      4,   0, 220,  27,   0,   0, 
-      1,   0,  20,   0,   0,   0, 
-      0,   0,  22,   0,  80,  17, 
-      0,   0,   5,   0,   4,   0, 
-      4,   0, 220,  27,   0,   0, 
-      1,   0,  20,   0,   4,   0, 
-      0,   0,  22,   0,  80,  17, 
-      0,   0,   5,   0,   8,   0, 
-      4,   0, 220,  27,   0,   0, 
-      1,   0,  20,   0,   8,   0, 
-      0,   0,  42,   0,  62,  17, 
-     10,  16,   0,   0,   0,   0, 
-    112, 111, 119,  78,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,  22,   0, 
-     80,  17,   0,   0,   1,   0, 
-      0,   0,   4,   0, 152,  27, 
-      0,   0,   1,   0,  88,   0, 
-     12,   0,   0,   0,   2,   0, 
-     78,  17,   2,   0,   6,   0, 
-     22,   0,  82,  17,  10,  16, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0, 255, 255, 255, 255, 
-    255, 255,  80,  73,   0,   0, 
-    244,   0,   0,   0,  72,   0, 
-      0,   0,   1,   0,   0,   0, 
-     16,   1, 199, 218, 182,  34, 
-     35, 112, 162, 170, 250, 184, 
-     55, 246, 198, 214, 140, 187, 
-      0,   0, 120,   0,   0,   0, 
-     16,   1, 243,   4, 123,  95, 
-    212, 230,  88, 130,  41, 203, 
-    197,  51, 105,  65, 190, 234, 
-      0,   0, 228,   0,   0,   0, 
-     16,   1, 118, 121, 219,  16, 
-    108,  60,  36, 183,  75, 158, 
-    242, 112, 198,  70,  53,  61, 
-      0,   0, 242,   0,   0,   0, 
-    236,  25,   0,   0,   0,   0, 
-      0,   0,   1,   0,   1,   0, 
-     28,  28,   0,   0,  24,   0, 
-      0,   0,   2,   0,   0,   0, 
-     36,   0,   0,   0, 240,   0, 
-      0,   0,   1,   0,   0, 128, 
-    240,   0,   0,   0,   1,   0, 
-      0,   0,  20,   0,  37,   0, 
-     20,   0,  37,   0,   0,   0, 
-      0,   0,  36,   2,   0,   0, 
-    188,  25,   0,   0,   4,   1, 
-      0,   0,  58,   0,   0, 128, 
-      4,   1,   0,   0,  58,   0, 
-      0,   0,  48,   1,   0,   0, 
-     58,   0,   0, 128,  48,   1, 
-      0,   0,  58,   0,   0,   0, 
-     68,   1,   0,   0,  58,   0, 
-      0, 128,  68,   1,   0,   0, 
-     58,   0,   0,   0, 108,   1, 
-      0,   0,  58,   0,   0, 128, 
-    108,   1,   0,   0,  58,   0, 
-      0,   0, 128,   1,   0,   0, 
-     59,   0,   0, 128, 128,   1, 
-      0,   0,  59,   0,   0,   0, 
-    172,   1,   0,   0,  59,   0, 
-      0, 128, 172,   1,   0,   0, 
-     59,   0,   0,   0, 192,   1, 
-      0,   0,  60,   0,   0, 128, 
-    192,   1,   0,   0,  60,   0, 
-      0,   0, 212,   1,   0,   0, 
-     61,   0,   0, 128, 212,   1, 
-      0,   0,  61,   0,   0,   0, 
-    232,   1,   0,   0,  62,   0, 
-      0, 128, 232,   1,   0,   0, 
-     62,   0,   0,   0,  20,   2, 
-      0,   0,  62,   0,   0, 128, 
-     20,   2,   0,   0,  62,   0, 
-      0,   0,  40,   2,   0,   0, 
-     63,   0,   0, 128,  40,   2, 
-      0,   0,  63,   0,   0,   0, 
-     84,   2,   0,   0,  63,   0, 
-      0, 128,  84,   2,   0,   0, 
-     63,   0,   0,   0, 104,   2, 
-      0,   0,  63,   0,   0, 128, 
-    104,   2,   0,   0,  63,   0, 
-      0,   0, 144,   2,   0,   0, 
-     63,   0,   0, 128, 144,   2, 
-      0,   0,  63,   0,   0,   0, 
-    164,   2,   0,   0,  65,   0, 
-      0, 128, 164,   2,   0,   0, 
-     65,   0,   0,   0, 168,   2, 
-      0,   0,  65,   0,   0, 128, 
-    168,   2,   0,   0,  65,   0, 
-      0,   0, 196,   2,   0,   0, 
-     65,   0,   0, 128, 196,   2, 
-      0,   0,  65,   0,   0,   0, 
-    216,   2,   0,   0,  65,   0, 
-      0, 128, 216,   2,   0,   0, 
-     65,   0,   0,   0, 244,   2, 
-      0,   0,  65,   0,   0, 128, 
-    244,   2,   0,   0,  65,   0, 
-      0,   0,  32,   3,   0,   0, 
-     65,   0,   0, 128,  32,   3, 
-      0,   0,  65,   0,   0,   0, 
-     52,   3,   0,   0,  65,   0, 
-      0, 128,  52,   3,   0,   0, 
-     65,   0,   0,   0,  92,   3, 
-      0,   0,  65,   0,   0, 128, 
-     92,   3,   0,   0,  65,   0, 
-      0,   0, 124,   3,   0,   0, 
-     65,   0,   0, 128, 124,   3, 
-      0,   0,  65,   0,   0,   0, 
-    152,   3,   0,   0,  65,   0, 
-      0, 128, 152,   3,   0,   0, 
-     65,   0,   0,   0, 180,   3, 
-      0,   0,  65,   0,   0, 128, 
-    180,   3,   0,   0,  65,   0, 
-      0,   0, 200,   3,   0,   0, 
-     65,   0,   0, 128, 200,   3, 
-      0,   0,  65,   0,   0,   0, 
-    228,   3,   0,   0,  65,   0, 
-      0, 128, 228,   3,   0,   0, 
-     65,   0,   0,   0, 248,   3, 
-      0,   0,  65,   0,   0, 128, 
-    248,   3,   0,   0,  65,   0, 
-      0,   0,  12,   4,   0,   0, 
-     65,   0,   0, 128,  12,   4, 
-      0,   0,  65,   0,   0,   0, 
-     32,   4,   0,   0,  65,   0, 
-      0, 128,  32,   4,   0,   0, 
-     65,   0,   0,   0,  52,   4, 
-      0,   0,  65,   0,   0, 128, 
-     52,   4,   0,   0,  65,   0, 
-      0,   0,  80,   4,   0,   0, 
-     65,   0,   0, 128,  80,   4, 
-      0,   0,  65,   0,   0,   0, 
-    100,   4,   0,   0,  65,   0, 
-      0, 128, 100,   4,   0,   0, 
-     65,   0,   0,   0, 128,   4, 
-      0,   0,  65,   0,   0, 128, 
-    128,   4,   0,   0,  65,   0, 
-      0,   0, 156,   4,   0,   0, 
-     65,   0,   0, 128, 156,   4, 
-      0,   0,  65,   0,   0,   0, 
-    184,   4,   0,   0,  65,   0, 
-      0, 128, 184,   4,   0,   0, 
-     65,   0,   0,   0, 208,   4, 
-      0,   0,  65,   0,   0, 128, 
-    208,   4,   0,   0,  65,   0, 
-      0,   0, 236,   4,   0,   0, 
-     65,   0,   0, 128, 236,   4, 
-      0,   0,  65,   0,   0,   0, 
-      8,   5,   0,   0,  65,   0, 
-      0, 128,   8,   5,   0,   0, 
-     65,   0,   0,   0,  28,   5, 
-      0,   0,  65,   0,   0, 128, 
-     28,   5,   0,   0,  65,   0, 
-      0,   0,  56,   5,   0,   0, 
-     65,   0,   0, 128,  56,   5, 
-      0,   0,  65,   0,   0,   0, 
-     80,   5,   0,   0,  65,   0, 
-      0, 128,  80,   5,   0,   0, 
-     65,   0,   0,   0, 108,   5, 
-      0,   0,  65,   0,   0, 128, 
-    108,   5,   0,   0,  65,   0, 
-      0,   0, 136,   5,   0,   0, 
-     65,   0,   0, 128, 136,   5, 
-      0,   0,  65,   0,   0,   0, 
-    160,   5,   0,   0,  65,   0, 
-      0, 128, 160,   5,   0,   0, 
-     65,   0,   0,   0, 188,   5, 
-      0,   0,  65,   0,   0, 128, 
-    188,   5,   0,   0,  65,   0, 
-      0,   0, 216,   5,   0,   0, 
-     65,   0,   0, 128, 216,   5, 
-      0,   0,  65,   0,   0,   0, 
-    236,   5,   0,   0,  65,   0, 
-      0, 128, 236,   5,   0,   0, 
-     65,   0,   0,   0,   8,   6, 
-      0,   0,  65,   0,   0, 128, 
-      8,   6,   0,   0,  65,   0, 
-      0,   0,  28,   6,   0,   0, 
-     65,   0,   0, 128,  28,   6, 
-      0,   0,  65,   0,   0,   0, 
-     48,   6,   0,   0,  65,   0, 
-      0, 128,  48,   6,   0,   0, 
-     65,   0,   0,   0,  68,   6, 
-      0,   0,  65,   0,   0, 128, 
-     68,   6,   0,   0,  65,   0, 
-      0,   0,  88,   6,   0,   0, 
-     65,   0,   0, 128,  88,   6, 
-      0,   0,  65,   0,   0,   0, 
-    108,   6,   0,   0,  65,   0, 
-      0, 128, 108,   6,   0,   0, 
-     65,   0,   0,   0, 128,   6, 
-      0,   0,  65,   0,   0, 128, 
-    128,   6,   0,   0,  65,   0, 
-      0,   0, 148,   6,   0,   0, 
-     65,   0,   0, 128, 148,   6, 
-      0,   0,  65,   0,   0,   0, 
-    168,   6,   0,   0,  65,   0, 
-      0, 128, 168,   6,   0,   0, 
-     65,   0,   0,   0, 188,   6, 
-      0,   0,  65,   0,   0, 128, 
-    188,   6,   0,   0,  65,   0, 
-      0,   0, 216,   6,   0,   0, 
-     65,   0,   0, 128, 216,   6, 
-      0,   0,  65,   0,   0,   0, 
-    244,   6,   0,   0,  65,   0, 
-      0, 128, 244,   6,   0,   0, 
-     65,   0,   0,   0,  16,   7, 
-      0,   0,  65,   0,   0, 128, 
-     16,   7,   0,   0,  65,   0, 
-      0,   0,  44,   7,   0,   0, 
-     65,   0,   0, 128,  44,   7, 
-      0,   0,  65,   0,   0,   0, 
-     64,   7,   0,   0,  65,   0, 
-      0, 128,  64,   7,   0,   0, 
-     65,   0,   0,   0,  92,   7, 
-      0,   0,  65,   0,   0, 128, 
-     92,   7,   0,   0,  65,   0, 
-      0,   0, 112,   7,   0,   0, 
-     66,   0,   0, 128, 112,   7, 
-      0,   0,  66,   0,   0,   0, 
-    136,   7,   0,   0,  66,   0, 
-      0, 128, 136,   7,   0,   0, 
-     66,   0,   0,   0, 168,   7, 
-      0,   0,  66,   0,   0, 128, 
-    168,   7,   0,   0,  66,   0, 
-      0,   0, 196,   7,   0,   0, 
-     66,   0,   0, 128, 196,   7, 
-      0,   0,  66,   0,   0,   0, 
-    216,   7,   0,   0,  66,   0, 
-      0, 128, 216,   7,   0,   0, 
-     66,   0,   0,   0, 244,   7, 
-      0,   0,  67,   0,   0, 128, 
-    244,   7,   0,   0,  67,   0, 
-      0,   0,  12,   8,   0,   0, 
-     67,   0,   0, 128,  12,   8, 
-      0,   0,  67,   0,   0,   0, 
-     40,   8,   0,   0,  67,   0, 
-      0, 128,  40,   8,   0,   0, 
-     67,   0,   0,   0,  68,   8, 
-      0,   0,  67,   0,   0, 128, 
-     68,   8,   0,   0,  67,   0, 
-      0,   0,  92,   8,   0,   0, 
-     67,   0,   0, 128,  92,   8, 
-      0,   0,  67,   0,   0,   0, 
-    120,   8,   0,   0,  67,   0, 
-      0, 128, 120,   8,   0,   0, 
-     67,   0,   0,   0, 148,   8, 
-      0,   0,  69,   0,   0, 128, 
-    148,   8,   0,   0,  69,   0, 
-      0,   0, 180,   8,   0,   0, 
-     69,   0,   0, 128, 180,   8, 
-      0,   0,  69,   0,   0,   0, 
-    208,   8,   0,   0,  69,   0, 
-      0, 128, 208,   8,   0,   0, 
-     69,   0,   0,   0, 236,   8, 
-      0,   0,  69,   0,   0, 128, 
-    236,   8,   0,   0,  69,   0, 
-      0,   0,  20,   9,   0,   0, 
-     72,   0,   0, 128,  20,   9, 
-      0,   0,  72,   0,   0,   0, 
-     52,   9,   0,   0,  73,   0, 
-      0, 128,  52,   9,   0,   0, 
-     73,   0,   0,   0,  72,   9, 
-      0,   0,  73,   0,   0, 128, 
-     72,   9,   0,   0,  73,   0, 
-      0,   0,  92,   9,   0,   0, 
-     73,   0,   0, 128,  92,   9, 
-      0,   0,  73,   0,   0,   0, 
-    112,   9,   0,   0,  73,   0, 
-      0, 128, 112,   9,   0,   0, 
-     73,   0,   0,   0, 116,   9, 
-      0,   0,  73,   0,   0, 128, 
-    116,   9,   0,   0,  73,   0, 
-      0,   0, 144,   9,   0,   0, 
-     73,   0,   0, 128, 144,   9, 
-      0,   0,  73,   0,   0,   0, 
-    156,   9,   0,   0,  75,   0, 
-      0, 128, 156,   9,   0,   0, 
-     75,   0,   0,   0, 180,   9, 
-      0,   0,  75,   0,   0, 128, 
-    180,   9,   0,   0,  75,   0, 
-      0,   0, 216,   9,   0,   0, 
-     75,   0,   0, 128, 216,   9, 
-      0,   0,  75,   0,   0,   0, 
-    244,   9,   0,   0,  75,   0, 
-      0, 128, 244,   9,   0,   0, 
-     75,   0,   0,   0,   8,  10, 
-      0,   0,  75,   0,   0, 128, 
-      8,  10,   0,   0,  75,   0, 
-      0,   0,  36,  10,   0,   0, 
-     76,   0,   0, 128,  36,  10, 
-      0,   0,  76,   0,   0,   0, 
-     64,  10,   0,   0,  76,   0, 
-      0, 128,  64,  10,   0,   0, 
-     76,   0,   0,   0,  92,  10, 
-      0,   0,  76,   0,   0, 128, 
-     92,  10,   0,   0,  76,   0, 
-      0,   0, 112,  10,   0,   0, 
-     76,   0,   0, 128, 112,  10, 
-      0,   0,  76,   0,   0,   0, 
-    140,  10,   0,   0,  77,   0, 
-      0, 128, 140,  10,   0,   0, 
-     77,   0,   0,   0, 164,  10, 
-      0,   0,  77,   0,   0, 128, 
-    164,  10,   0,   0,  77,   0, 
-      0,   0, 200,  10,   0,   0, 
-     77,   0,   0, 128, 200,  10, 
-      0,   0,  77,   0,   0,   0, 
-    228,  10,   0,   0,  77,   0, 
-      0, 128, 228,  10,   0,   0, 
-     77,   0,   0,   0, 248,  10, 
-      0,   0,  78,   0,   0, 128, 
-    248,  10,   0,   0,  78,   0, 
-      0,   0,  20,  11,   0,   0, 
-     78,   0,   0, 128,  20,  11, 
-      0,   0,  78,   0,   0,   0, 
-     48,  11,   0,   0,  79,   0, 
-      0, 128,  48,  11,   0,   0, 
-     79,   0,   0,   0,  88,  11, 
-      0,   0,  82,   0,   0, 128, 
-     88,  11,   0,   0,  82,   0, 
-      0,   0,  92,  11,   0,   0, 
-     82,   0,   0, 128,  92,  11, 
-      0,   0,  82,   0,   0,   0, 
-    112,  11,   0,   0,  82,   0, 
-      0, 128, 112,  11,   0,   0, 
-     82,   0,   0,   0, 132,  11, 
-      0,   0,  82,   0,   0, 128, 
-    132,  11,   0,   0,  82,   0, 
-      0,   0, 152,  11,   0,   0, 
-     82,   0,   0, 128, 152,  11, 
-      0,   0,  82,   0,   0,   0, 
-    180,  11,   0,   0,  82,   0, 
-      0, 128, 180,  11,   0,   0, 
-     82,   0,   0,   0, 208,  11, 
-      0,   0,  82,   0,   0, 128, 
-    208,  11,   0,   0,  82,   0, 
-      0,   0, 236,  11,   0,   0, 
-     82,   0,   0, 128, 236,  11, 
-      0,   0,  82,   0,   0,   0, 
-      8,  12,   0,   0,  82,   0, 
-      0, 128,   8,  12,   0,   0, 
-     82,   0,   0,   0,  36,  12, 
-      0,   0,  82,   0,   0, 128, 
-     36,  12,   0,   0,  82,   0, 
-      0,   0,  56,  12,   0,   0, 
-     82,   0,   0, 128,  56,  12, 
-      0,   0,  82,   0,   0,   0, 
-     76,  12,   0,   0,  82,   0, 
-      0, 128,  76,  12,   0,   0, 
-     82,   0,   0,   0, 104,  12, 
-      0,   0,  82,   0,   0, 128, 
-    104,  12,   0,   0,  82,   0, 
-      0,   0, 132,  12,   0,   0, 
-     82,   0,   0, 128, 132,  12, 
-      0,   0,  82,   0,   0,   0, 
-    160,  12,   0,   0,  82,   0, 
-      0, 128, 160,  12,   0,   0, 
-     82,   0,   0,   0, 188,  12, 
-      0,   0,  82,   0,   0, 128, 
-    188,  12,   0,   0,  82,   0, 
-      0,   0, 216,  12,   0,   0, 
-     82,   0,   0, 128, 216,  12, 
-      0,   0,  82,   0,   0,   0, 
-    244,  12,   0,   0,  82,   0, 
-      0, 128, 244,  12,   0,   0, 
-     82,   0,   0,   0,   8,  13, 
-      0,   0,  83,   0,   0, 128, 
-      8,  13,   0,   0,  83,   0, 
-      0,   0,  12,  13,   0,   0, 
-     83,   0,   0, 128,  12,  13, 
-      0,   0,  83,   0,   0,   0, 
-     32,  13,   0,   0,  83,   0, 
-      0, 128,  32,  13,   0,   0, 
-     83,   0,   0,   0,  52,  13, 
-      0,   0,  83,   0,   0, 128, 
-     52,  13,   0,   0,  83,   0, 
-      0,   0,  72,  13,   0,   0, 
-     83,   0,   0, 128,  72,  13, 
-      0,   0,  83,   0,   0,   0, 
-     92,  13,   0,   0,  83,   0, 
-      0, 128,  92,  13,   0,   0, 
-     83,   0,   0,   0, 120,  13, 
-      0,   0,  83,   0,   0, 128, 
-    120,  13,   0,   0,  83,   0, 
-      0,   0, 148,  13,   0,   0, 
-     83,   0,   0, 128, 148,  13, 
-      0,   0,  83,   0,   0,   0, 
-    176,  13,   0,   0,  83,   0, 
-      0, 128, 176,  13,   0,   0, 
-     83,   0,   0,   0, 204,  13, 
-      0,   0,  83,   0,   0, 128, 
-    204,  13,   0,   0,  83,   0, 
-      0,   0, 208,  13,   0,   0, 
-     83,   0,   0, 128, 208,  13, 
-      0,   0,  83,   0,   0,   0, 
-    228,  13,   0,   0,  83,   0, 
-      0, 128, 228,  13,   0,   0, 
-     83,   0,   0,   0, 248,  13, 
-      0,   0,  83,   0,   0, 128, 
-    248,  13,   0,   0,  83,   0, 
-      0,   0,  20,  14,   0,   0, 
-     83,   0,   0, 128,  20,  14, 
-      0,   0,  83,   0,   0,   0, 
-     48,  14,   0,   0,  83,   0, 
-      0, 128,  48,  14,   0,   0, 
-     83,   0,   0,   0,  76,  14, 
-      0,   0,  83,   0,   0, 128, 
-     76,  14,   0,   0,  83,   0, 
-      0,   0,  96,  14,   0,   0, 
-     83,   0,   0, 128,  96,  14, 
-      0,   0,  83,   0,   0,   0, 
-    120,  14,   0,   0,  83,   0, 
-      0, 128, 120,  14,   0,   0, 
-     83,   0,   0,   0, 148,  14, 
-      0,   0,  83,   0,   0, 128, 
-    148,  14,   0,   0,  83,   0, 
-      0,   0, 176,  14,   0,   0, 
-     83,   0,   0, 128, 176,  14, 
-      0,   0,  83,   0,   0,   0, 
-    204,  14,   0,   0,  83,   0, 
-      0, 128, 204,  14,   0,   0, 
-     83,   0,   0,   0, 232,  14, 
-      0,   0,  83,   0,   0, 128, 
-    232,  14,   0,   0,  83,   0, 
-      0,   0, 252,  14,   0,   0, 
-     83,   0,   0, 128, 252,  14, 
-      0,   0,  83,   0,   0,   0, 
-      0,  15,   0,   0,  83,   0, 
-      0, 128,   0,  15,   0,   0, 
-     83,   0,   0,   0,  20,  15, 
-      0,   0,  83,   0,   0, 128, 
-     20,  15,   0,   0,  83,   0, 
-      0,   0,  48,  15,   0,   0, 
-     83,   0,   0, 128,  48,  15, 
-      0,   0,  83,   0,   0,   0, 
-     76,  15,   0,   0,  83,   0, 
-      0, 128,  76,  15,   0,   0, 
-     83,   0,   0,   0, 104,  15, 
-      0,   0,  83,   0,   0, 128, 
-    104,  15,   0,   0,  83,   0, 
-      0,   0, 124,  15,   0,   0, 
-     83,   0,   0, 128, 124,  15, 
-      0,   0,  83,   0,   0,   0, 
-    148,  15,   0,   0,  83,   0, 
-      0, 128, 148,  15,   0,   0, 
-     83,   0,   0,   0, 176,  15, 
-      0,   0,  83,   0,   0, 128, 
-    176,  15,   0,   0,  83,   0, 
-      0,   0, 204,  15,   0,   0, 
-     83,   0,   0, 128, 204,  15, 
-      0,   0,  83,   0,   0,   0, 
-    232,  15,   0,   0,  83,   0, 
-      0, 128, 232,  15,   0,   0, 
-     83,   0,   0,   0,   4,  16, 
-      0,   0,  83,   0,   0, 128, 
-      4,  16,   0,   0,  83,   0, 
-      0,   0,  24,  16,   0,   0, 
-     83,   0,   0, 128,  24,  16, 
-      0,   0,  83,   0,   0,   0, 
-     52,  16,   0,   0,  83,   0, 
-      0, 128,  52,  16,   0,   0, 
-     83,   0,   0,   0,  72,  16, 
-      0,   0,  84,   0,   0, 128, 
-     72,  16,   0,   0,  84,   0, 
-      0,   0,  76,  16,   0,   0, 
-     84,   0,   0, 128,  76,  16, 
-      0,   0,  84,   0,   0,   0, 
-    104,  16,   0,   0,  84,   0, 
-      0, 128, 104,  16,   0,   0, 
-     84,   0,   0,   0, 132,  16, 
-      0,   0,  84,   0,   0, 128, 
-    132,  16,   0,   0,  84,   0, 
-      0,   0, 160,  16,   0,   0, 
-     84,   0,   0, 128, 160,  16, 
-      0,   0,  84,   0,   0,   0, 
-    180,  16,   0,   0,  84,   0, 
-      0, 128, 180,  16,   0,   0, 
-     84,   0,   0,   0, 204,  16, 
-      0,   0,  84,   0,   0, 128, 
-    204,  16,   0,   0,  84,   0, 
-      0,   0, 244,  16,   0,   0, 
-     84,   0,   0, 128, 244,  16, 
-      0,   0,  84,   0,   0,   0, 
-     12,  17,   0,   0,  84,   0, 
-      0, 128,  12,  17,   0,   0, 
-     84,   0,   0,   0,  40,  17, 
-      0,   0,  84,   0,   0, 128, 
-     40,  17,   0,   0,  84,   0, 
-      0,   0,  68,  17,   0,   0, 
-     84,   0,   0, 128,  68,  17, 
-      0,   0,  84,   0,   0,   0, 
-     96,  17,   0,   0,  84,   0, 
-      0, 128,  96,  17,   0,   0, 
-     84,   0,   0,   0, 116,  17, 
-      0,   0,  84,   0,   0, 128, 
-    116,  17,   0,   0,  84,   0, 
-      0,   0, 144,  17,   0,   0, 
-     84,   0,   0, 128, 144,  17, 
-      0,   0,  84,   0,   0,   0, 
-    172,  17,   0,   0,  84,   0, 
-      0, 128, 172,  17,   0,   0, 
-     84,   0,   0,   0, 200,  17, 
-      0,   0,  84,   0,   0, 128, 
-    200,  17,   0,   0,  84,   0, 
-      0,   0, 228,  17,   0,   0, 
-     84,   0,   0, 128, 228,  17, 
-      0,   0,  84,   0,   0,   0, 
-      0,  18,   0,   0,  84,   0, 
-      0, 128,   0,  18,   0,   0, 
-     84,   0,   0,   0,  28,  18, 
-      0,   0,  84,   0,   0, 128, 
-     28,  18,   0,   0,  84,   0, 
-      0,   0,  48,  18,   0,   0, 
-     86,   0,   0, 128,  48,  18, 
-      0,   0,  86,   0,   0,   0, 
-     76,  18,   0,   0,  86,   0, 
-      0, 128,  76,  18,   0,   0, 
-     86,   0,   0,   0, 104,  18, 
-      0,   0,  87,   0,   0, 128, 
-    104,  18,   0,   0,  87,   0, 
-      0,   0, 124,  18,   0,   0, 
-     87,   0,   0, 128, 124,  18, 
-      0,   0,  87,   0,   0,   0, 
-    152,  18,   0,   0,  87,   0, 
-      0, 128, 152,  18,   0,   0, 
-     87,   0,   0,   0, 180,  18, 
-      0,   0,  87,   0,   0, 128, 
-    180,  18,   0,   0,  87,   0, 
-      0,   0, 208,  18,   0,   0, 
-     87,   0,   0, 128, 208,  18, 
-      0,   0,  87,   0,   0,   0, 
-    236,  18,   0,   0,  87,   0, 
-      0, 128, 236,  18,   0,   0, 
-     87,   0,   0,   0,   8,  19, 
-      0,   0,  87,   0,   0, 128, 
-      8,  19,   0,   0,  87,   0, 
-      0,   0,  36,  19,   0,   0, 
-     87,   0,   0, 128,  36,  19, 
-      0,   0,  87,   0,   0,   0, 
-     64,  19,   0,   0,  88,   0, 
-      0, 128,  64,  19,   0,   0, 
-     88,   0,   0,   0,  92,  19, 
-      0,   0,  91,   0,   0, 128, 
-     92,  19,   0,   0,  91,   0, 
-      0,   0, 112,  19,   0,   0, 
-     95,   0,   0, 128, 112,  19, 
-      0,   0,  95,   0,   0,   0, 
-    136,  19,   0,   0,  95,   0, 
-      0, 128, 136,  19,   0,   0, 
-     95,   0,   0,   0, 176,  19, 
-      0,   0,  99,   0,   0, 128, 
-    176,  19,   0,   0,  99,   0, 
-      0,   0, 200,  19,   0,   0, 
-     99,   0,   0, 128, 200,  19, 
-      0,   0,  99,   0,   0,   0, 
-    228,  19,   0,   0,  99,   0, 
-      0, 128, 228,  19,   0,   0, 
-     99,   0,   0,   0,   0,  20, 
-      0,   0, 102,   0,   0, 128, 
-      0,  20,   0,   0, 102,   0, 
-      0,   0,  28,  20,   0,   0, 
-    102,   0,   0, 128,  28,  20, 
-      0,   0, 102,   0,   0,   0, 
-     56,  20,   0,   0, 105,   0, 
-      0, 128,  56,  20,   0,   0, 
-    105,   0,   0,   0,  84,  20, 
-      0,   0, 105,   0,   0, 128, 
-     84,  20,   0,   0, 105,   0, 
-      0,   0, 112,  20,   0,   0, 
-    105,   0,   0, 128, 112,  20, 
-      0,   0, 105,   0,   0,   0, 
-    140,  20,   0,   0, 105,   0, 
-      0, 128, 140,  20,   0,   0, 
-    105,   0,   0,   0, 168,  20, 
-      0,   0, 105,   0,   0, 128, 
-    168,  20,   0,   0, 105,   0, 
-      0,   0, 196,  20,   0,   0, 
-    105,   0,   0, 128, 196,  20, 
-      0,   0, 105,   0,   0,   0, 
-    224,  20,   0,   0, 106,   0, 
-      0, 128, 224,  20,   0,   0, 
-     73,   0,   0,   0, 252,  20, 
-      0,   0, 106,   0,   0, 128, 
-    252,  20,   0,   0, 106,   0, 
-      0,   0,   0,  21,   0,   0, 
-    109,   0,   0, 128,   0,  21, 
-      0,   0, 109,   0,   0,   0, 
-      4,  21,   0,   0, 109,   0, 
-      0, 128,   4,  21,   0,   0, 
-    109,   0,   0,   0,  32,  21, 
-      0,   0, 109,   0,   0, 128, 
-     32,  21,   0,   0, 109,   0, 
-      0,   0,  60,  21,   0,   0, 
-    109,   0,   0, 128,  60,  21, 
-      0,   0, 109,   0,   0,   0, 
-     80,  21,   0,   0, 109,   0, 
-      0, 128,  80,  21,   0,   0, 
-    109,   0,   0,   0, 100,  21, 
-      0,   0, 109,   0,   0, 128, 
-    100,  21,   0,   0, 109,   0, 
-      0,   0, 124,  21,   0,   0, 
-    109,   0,   0, 128, 124,  21, 
-      0,   0, 109,   0,   0,   0, 
-    152,  21,   0,   0, 109,   0, 
-      0, 128, 152,  21,   0,   0, 
-    109,   0,   0,   0, 180,  21, 
-      0,   0, 109,   0,   0, 128, 
-    180,  21,   0,   0, 109,   0, 
-      0,   0, 204,  21,   0,   0, 
-    109,   0,   0, 128, 204,  21, 
-      0,   0, 109,   0,   0,   0, 
-    232,  21,   0,   0, 109,   0, 
-      0, 128, 232,  21,   0,   0, 
-    109,   0,   0,   0,   0,  22, 
-      0,   0, 109,   0,   0, 128, 
-      0,  22,   0,   0, 109,   0, 
-      0,   0,  28,  22,   0,   0, 
-    109,   0,   0, 128,  28,  22, 
-      0,   0, 109,   0,   0,   0, 
-     56,  22,   0,   0, 109,   0, 
-      0, 128,  56,  22,   0,   0, 
-    109,   0,   0,   0,  84,  22, 
-      0,   0, 109,   0,   0, 128, 
-     84,  22,   0,   0, 109,   0, 
-      0,   0, 104,  22,   0,   0, 
-    109,   0,   0, 128, 104,  22, 
-      0,   0, 109,   0,   0,   0, 
-    132,  22,   0,   0, 109,   0, 
-      0, 128, 132,  22,   0,   0, 
-    109,   0,   0,   0, 160,  22, 
-      0,   0, 109,   0,   0, 128, 
-    160,  22,   0,   0, 109,   0, 
-      0,   0, 188,  22,   0,   0, 
-    109,   0,   0, 128, 188,  22, 
-      0,   0, 109,   0,   0,   0, 
-    216,  22,   0,   0, 109,   0, 
-      0, 128, 216,  22,   0,   0, 
-    109,   0,   0,   0, 244,  22, 
-      0,   0, 109,   0,   0, 128, 
-    244,  22,   0,   0, 109,   0, 
-      0,   0,  16,  23,   0,   0, 
-    109,   0,   0, 128,  16,  23, 
-      0,   0, 109,   0,   0,   0, 
-     36,  23,   0,   0, 111,   0, 
-      0, 128,  36,  23,   0,   0, 
-    111,   0,   0,   0,  80,  23, 
-      0,   0, 111,   0,   0, 128, 
-     80,  23,   0,   0, 111,   0, 
-      0,   0, 100,  23,   0,   0, 
-    112,   0,   0, 128, 100,  23, 
-      0,   0, 112,   0,   0,   0, 
-    128,  23,   0,   0, 112,   0, 
-      0, 128, 128,  23,   0,   0, 
-    112,   0,   0,   0, 156,  23, 
-      0,   0, 112,   0,   0, 128, 
-    156,  23,   0,   0, 112,   0, 
-      0,   0, 176,  23,   0,   0, 
-    113,   0,   0, 128, 176,  23, 
-      0,   0, 113,   0,   0,   0, 
-    220,  23,   0,   0, 113,   0, 
-      0, 128, 220,  23,   0,   0, 
-    113,   0,   0,   0, 240,  23, 
-      0,   0, 114,   0,   0, 128, 
-    240,  23,   0,   0, 114,   0, 
-      0,   0,  12,  24,   0,   0, 
-    114,   0,   0, 128,  12,  24, 
-      0,   0, 114,   0,   0,   0, 
-     40,  24,   0,   0, 114,   0, 
-      0, 128,  40,  24,   0,   0, 
-    114,   0,   0,   0,  68,  24, 
-      0,   0, 117,   0,   0, 128, 
-     68,  24,   0,   0, 117,   0, 
-      0,   0,  72,  24,   0,   0, 
-    117,   0,   0, 128,  72,  24, 
-      0,   0, 117,   0,   0,   0, 
-    100,  24,   0,   0, 117,   0, 
-      0, 128, 100,  24,   0,   0, 
-    117,   0,   0,   0, 128,  24, 
-      0,   0, 117,   0,   0, 128, 
-    128,  24,   0,   0, 117,   0, 
-      0,   0, 148,  24,   0,   0, 
-    117,   0,   0, 128, 148,  24, 
-      0,   0, 117,   0,   0,   0, 
-    172,  24,   0,   0, 117,   0, 
-      0, 128, 172,  24,   0,   0, 
-    117,   0,   0,   0, 212,  24, 
-      0,   0, 117,   0,   0, 128, 
-    212,  24,   0,   0, 117,   0, 
-      0,   0, 236,  24,   0,   0, 
-    117,   0,   0, 128, 236,  24, 
-      0,   0, 117,   0,   0,   0, 
-      8,  25,   0,   0, 117,   0, 
-      0, 128,   8,  25,   0,   0, 
-    117,   0,   0,   0,  36,  25, 
-      0,   0, 117,   0,   0, 128, 
-     36,  25,   0,   0, 117,   0, 
-      0,   0,  64,  25,   0,   0, 
-    117,   0,   0, 128,  64,  25, 
-      0,   0, 117,   0,   0,   0, 
-     84,  25,   0,   0, 117,   0, 
-      0, 128,  84,  25,   0,   0, 
-    117,   0,   0,   0, 112,  25, 
-      0,   0, 117,   0,   0, 128, 
-    112,  25,   0,   0, 117,   0, 
-      0,   0, 140,  25,   0,   0, 
-    117,   0,   0, 128, 140,  25, 
-      0,   0, 117,   0,   0,   0, 
-    168,  25,   0,   0, 117,   0, 
-      0, 128, 168,  25,   0,   0, 
-    117,   0,   0,   0, 196,  25, 
-      0,   0, 117,   0,   0, 128, 
-    196,  25,   0,   0, 117,   0, 
-      0,   0, 224,  25,   0,   0, 
-    117,   0,   0, 128, 224,  25, 
-      0,   0, 117,   0,   0,   0, 
-    252,  25,   0,   0, 117,   0, 
-      0, 128, 252,  25,   0,   0, 
-    117,   0,   0,   0,  16,  26, 
-      0,   0, 118,   0,   0, 128, 
-     16,  26,   0,   0, 118,   0, 
-      0,   0,  40,  26,   0,   0, 
-    118,   0,   0, 128,  40,  26, 
-      0,   0, 118,   0,   0,   0, 
-     80,  26,   0,   0, 119,   0, 
-      0, 128,  80,  26,   0,   0, 
-    119,   0,   0,   0, 124,  26, 
-      0,   0, 119,   0,   0, 128, 
-    124,  26,   0,   0, 119,   0, 
-      0,   0, 144,  26,   0,   0, 
-    120,   0,   0, 128, 144,  26, 
-      0,   0, 120,   0,   0,   0, 
-    172,  26,   0,   0, 121,   0, 
-      0, 128, 172,  26,   0,   0, 
-    121,   0,   0,   0, 200,  26, 
-      0,   0, 121,   0,   0, 128, 
-    200,  26,   0,   0, 121,   0, 
-      0,   0, 228,  26,   0,   0, 
-    121,   0,   0, 128, 228,  26, 
-      0,   0, 121,   0,   0,   0, 
-      0,  27,   0,   0, 123,   0, 
-      0, 128,   0,  27,   0,   0, 
-    123,   0,   0,   0,  28,  27, 
-      0,   0, 123,   0,   0, 128, 
-     28,  27,   0,   0, 123,   0, 
-      0,   0,  56,  27,   0,   0, 
-    125,   0,   0, 128,  56,  27, 
-      0,   0, 125,   0,   0,   0, 
-     60,  27,   0,   0, 125,   0, 
-      0, 128,  60,  27,   0,   0, 
-    125,   0,   0,   0, 100,  27, 
-      0,   0, 125,   0,   0, 128, 
-    100,  27,   0,   0, 125,   0, 
-      0,   0, 128,  27,   0,   0, 
-    126,   0,   0, 128, 128,  27, 
-      0,   0, 126,   0,   0,   0, 
-    132,  27,   0,   0, 126,   0, 
-      0, 128, 132,  27,   0,   0, 
-    126,   0,   0,   0, 152,  27, 
-      0,   0, 126,   0,   0, 128, 
-    152,  27,   0,   0, 126,   0, 
-      0,   0, 172,  27,   0,   0, 
-    126,   0,   0, 128, 172,  27, 
-      0,   0, 126,   0,   0,   0, 
-    200,  27,   0,   0, 126,   0, 
-      0, 128, 200,  27,   0,   0, 
-    126,   0,   0,   0, 220,  27, 
-      0,   0, 126,   0,   0, 128, 
-    220,  27,   0,   0, 126,   0, 
-      0,   0, 240,  27,   0,   0, 
-    128,   0,   0, 128, 240,  27, 
-      0,   0, 128,   0,   0,   0, 
-      4,  28,   0,   0, 128,   0, 
-      0, 128,   4,  28,   0,   0, 
-    128,   0,   0,   0,  24,  28, 
-      0,   0, 128,   0,   0, 128, 
-     24,  28,   0,   0, 128,   0, 
-      0,   0,   5,   0,  81,   0, 
-     36,   0,  70,   0,   5,   0, 
-     81,   0,  32,   0,  80,   0, 
-      5,   0,  81,   0,  32,   0, 
-     80,   0,   5,   0,  81,   0, 
-     32,   0,  80,   0,   5,   0, 
-     86,   0,  40,   0,  82,   0, 
-      5,   0,  86,   0,  18,   0, 
-     85,   0,   5,   0,  49,   0, 
-     17,   0,  48,   0,   5,   0, 
-     50,   0,  17,   0,  49,   0, 
-      5,   0,  55,   0,  22,   0, 
-     52,   0,   5,   0,  55,   0, 
-     17,   0,  54,   0,   5,   0, 
-     85,   0,  38,   0,  74,   0, 
-      5,   0,  85,   0,  34,   0, 
-     84,   0,   5,   0,  85,   0, 
-     34,   0,  84,   0,   5,   0, 
-     85,   0,  34,   0,  84,   0, 
-      5,   0,  76,   0,  16,   0, 
-     75,   0,   5,   0,  76,   0, 
-     33,   0,  54,   0,   5,   0, 
-     76,   0,  33,   0,  54,   0, 
-      5,   0,  76,   0,  33,   0, 
-     54,   0,   5,   0,  76,   0, 
-     16,   0,  75,   0,   5,   0, 
-     76,   0,  16,   0,  75,   0, 
-      5,   0,  76,   0,  16,   0, 
-     75,   0,   5,   0,  76,   0, 
-     16,   0,  75,   0,   5,   0, 
-     76,   0,  16,   0,  75,   0, 
-      5,   0,  76,   0,  16,   0, 
-     75,   0,   5,   0,  76,   0, 
-     16,   0,  75,   0,   5,   0, 
-     76,   0,  16,   0,  75,   0, 
-      5,   0,  76,   0,  16,   0, 
-     75,   0,   5,   0,  76,   0, 
-     16,   0,  75,   0,   5,   0, 
-     76,   0,  16,   0,  75,   0, 
-      5,   0,  76,   0,  16,   0, 
-     75,   0,   5,   0,  76,   0, 
-     16,   0,  75,   0,   5,   0, 
-     76,   0,  16,   0,  75,   0, 
-      5,   0,  76,   0,  16,   0, 
-     75,   0,   5,   0,  76,   0, 
-     16,   0,  75,   0,   5,   0, 
-     76,   0,  16,   0,  75,   0, 
-      5,   0,  76,   0,  16,   0, 
-     75,   0,   5,   0,  76,   0, 
-     16,   0,  75,   0,   5,   0, 
-     76,   0,  16,   0,  75,   0, 
-      5,   0,  76,   0,  16,   0, 
-     75,   0,   5,   0,  76,   0, 
-     16,   0,  75,   0,   5,   0, 
-     76,   0,  16,   0,  75,   0, 
-      5,   0,  76,   0,  16,   0, 
-     75,   0,   5,   0,  76,   0, 
-     16,   0,  75,   0,   5,   0, 
-     76,   0,  16,   0,  75,   0, 
-      5,   0,  76,   0,  16,   0, 
-     75,   0,   5,   0,  76,   0, 
-     16,   0,  75,   0,   5,   0, 
-     76,   0,  16,   0,  75,   0, 
-      5,   0,  76,   0,  16,   0, 
-     75,   0,   5,   0,  76,   0, 
-     16,   0,  75,   0,   5,   0, 
-     76,   0,  16,   0,  75,   0, 
-      5,   0,  76,   0,  16,   0, 
-     75,   0,   5,   0,  76,   0, 
-     16,   0,  75,   0,   5,   0, 
-     76,   0,  16,   0,  75,   0, 
-      5,   0,  76,   0,  16,   0, 
-     75,   0,   5,   0,  76,   0, 
-     16,   0,  75,   0,   5,   0, 
-     76,   0,  16,   0,  75,   0, 
-      5,   0,  76,   0,  16,   0, 
-     75,   0,   5,   0,  76,   0, 
-     16,   0,  75,   0,   5,   0, 
-     76,   0,  16,   0,  75,   0, 
-      5,   0,  76,   0,  16,   0, 
-     75,   0,   5,   0,  76,   0, 
-     16,   0,  75,   0,   5,   0, 
-     76,   0,  16,   0,  75,   0, 
-      5,   0,  76,   0,  16,   0, 
-     75,   0,   5,   0,  76,   0, 
-     12,   0,  75,   0,   5,   0, 
-     47,   0,  26,   0,  45,   0, 
-      5,   0,  47,   0,  26,   0, 
-     45,   0,   5,   0,  47,   0, 
-     16,   0,  46,   0,   5,   0, 
-     47,   0,  16,   0,  46,   0, 
-      5,   0,  47,   0,  16,   0, 
-     46,   0,   5,   0,  30,   0, 
-     24,   0,  25,   0,   5,   0, 
-     30,   0,  16,   0,  29,   0, 
-      5,   0,  30,   0,  16,   0, 
-     29,   0,   5,   0,  30,   0, 
-     16,   0,  29,   0,   5,   0, 
-     30,   0,  16,   0,  29,   0, 
-      5,   0,  30,   0,  16,   0, 
-     29,   0,   5,   0,  74,   0, 
-     17,   0,  73,   0,   5,   0, 
-     74,   0,  17,   0,  73,   0, 
-      5,   0,  74,   0,  17,   0, 
-     73,   0,   5,   0,  74,   0, 
-     17,   0,  73,   0,   5,   0, 
-     38,   0,  12,   0,  37,   0, 
-      5,   0,  31,   0,  14,   0, 
-     18,   0,   5,   0,  31,   0, 
-      5,   0,  31,   0,   5,   0, 
-     31,   0,   5,   0,  31,   0, 
-      5,   0,  31,   0,   5,   0, 
-     31,   0,   5,   0,  31,   0, 
-     21,   0,  25,   0,   5,   0, 
-     31,   0,  21,   0,  25,   0, 
-      9,   0,  66,   0,  30,   0, 
-     64,   0,   9,   0,  66,   0, 
-     30,   0,  64,   0,   9,   0, 
-     66,   0,  20,   0,  65,   0, 
-      9,   0,  66,   0,  20,   0, 
-     65,   0,   9,   0,  66,   0, 
-     20,   0,  65,   0,   9,   0, 
-     36,   0,  30,   0,  34,   0, 
-      9,   0,  36,   0,  20,   0, 
-     35,   0,   9,   0,  36,   0, 
-     20,   0,  35,   0,   9,   0, 
-     36,   0,  20,   0,  35,   0, 
-      9,   0,  69,   0,  33,   0, 
-     67,   0,   9,   0,  69,   0, 
-     33,   0,  67,   0,   9,   0, 
-     69,   0,  26,   0,  68,   0, 
-      9,   0,  69,   0,  26,   0, 
-     68,   0,   9,   0,  56,   0, 
-     36,   0,  54,   0,   9,   0, 
-     56,   0,  29,   0,  55,   0, 
-      9,   0,  59,   0,  27,   0, 
-     58,   0,   9,   0,  53,   0, 
-     21,   0,  52,   0,   9,   0, 
-     53,   0,  21,   0,  52,   0, 
-      9,   0,  53,   0,  21,   0, 
-     52,   0,   9,   0,  53,   0, 
-     21,   0,  52,   0,   9,   0, 
-     53,   0,  21,   0,  52,   0, 
-      9,   0,  53,   0,  21,   0, 
-     52,   0,   9,   0,  53,   0, 
-     21,   0,  52,   0,   9,   0, 
-     53,   0,  21,   0,  52,   0, 
-      9,   0,  53,   0,  21,   0, 
-     52,   0,   9,   0,  53,   0, 
-     21,   0,  52,   0,   9,   0, 
-     53,   0,  21,   0,  52,   0, 
-      9,   0,  53,   0,  21,   0, 
-     52,   0,   9,   0,  53,   0, 
-     21,   0,  52,   0,   9,   0, 
-     53,   0,  21,   0,  52,   0, 
-      9,   0,  53,   0,  21,   0, 
-     52,   0,   9,   0,  53,   0, 
-     21,   0,  52,   0,   9,   0, 
-     53,   0,  21,   0,  52,   0, 
-      9,   0,  53,   0,  15,   0, 
-     52,   0,   9,   0,  52,   0, 
-     19,   0,  51,   0,   9,   0, 
-     52,   0,  19,   0,  51,   0, 
-      9,   0,  52,   0,  19,   0, 
-     51,   0,   9,   0,  52,   0, 
-     19,   0,  51,   0,   9,   0, 
-     52,   0,  19,   0,  51,   0, 
-      9,   0,  52,   0,  19,   0, 
-     51,   0,   9,   0,  52,   0, 
-     19,   0,  51,   0,   9,   0, 
-     52,   0,  19,   0,  51,   0, 
-      9,   0,  52,   0,  19,   0, 
-     51,   0,   9,   0,  52,   0, 
-     19,   0,  51,   0,   9,   0, 
-     52,   0,  19,   0,  51,   0, 
-      9,   0,  52,   0,  19,   0, 
-     51,   0,   9,   0,  52,   0, 
-     19,   0,  51,   0,   9,   0, 
-     52,   0,  19,   0,  51,   0, 
-      9,   0,  52,   0,  19,   0, 
-     51,   0,   9,   0,  52,   0, 
-     19,   0,  51,   0,   9,   0, 
-     52,   0,  19,   0,  51,   0, 
-      9,   0,  52,   0,  19,   0, 
-     51,   0,   9,   0,  52,   0, 
-     19,   0,  51,   0,   9,   0, 
-     52,   0,  19,   0,  51,   0, 
-      9,   0,  52,   0,  19,   0, 
-     51,   0,   9,   0,  52,   0, 
-     19,   0,  51,   0,   9,   0, 
-     52,   0,  19,   0,  51,   0, 
-      9,   0,  52,   0,  19,   0, 
-     51,   0,   9,   0,  52,   0, 
-     19,   0,  51,   0,   9,   0, 
-     52,   0,  19,   0,  51,   0, 
-      9,   0,  52,   0,  19,   0, 
-     51,   0,   9,   0,  52,   0, 
-     19,   0,  51,   0,   9,   0, 
-     52,   0,  19,   0,  51,   0, 
-      9,   0,  52,   0,  19,   0, 
-     51,   0,   9,   0,  52,   0, 
-     19,   0,  51,   0,   9,   0, 
-     52,   0,  19,   0,  51,   0, 
-      9,   0,  52,   0,  19,   0, 
-     51,   0,   9,   0,  52,   0, 
-     19,   0,  51,   0,   9,   0, 
-     52,   0,  19,   0,  51,   0, 
-      9,   0,  52,   0,  15,   0, 
-     51,   0,   9,   0,  59,   0, 
-     20,   0,  58,   0,   9,   0, 
-     59,   0,  44,   0,  52,   0, 
-      9,   0,  59,   0,  35,   0, 
-     53,   0,   9,   0,  59,   0, 
-     35,   0,  53,   0,   9,   0, 
-     59,   0,  20,   0,  58,   0, 
-      9,   0,  59,   0,  20,   0, 
-     58,   0,   9,   0,  59,   0, 
-     20,   0,  58,   0,   9,   0, 
-     59,   0,  20,   0,  58,   0, 
-      9,   0,  59,   0,  20,   0, 
-     58,   0,   9,   0,  59,   0, 
-     20,   0,  58,   0,   9,   0, 
-     59,   0,  20,   0,  58,   0, 
-      9,   0,  59,   0,  20,   0, 
-     58,   0,   9,   0,  59,   0, 
-     20,   0,  58,   0,   9,   0, 
-     59,   0,  20,   0,  58,   0, 
-      9,   0,  59,   0,  20,   0, 
-     58,   0,   9,   0,  59,   0, 
-     20,   0,  58,   0,   9,   0, 
-     59,   0,  20,   0,  58,   0, 
-      9,   0,  59,   0,  20,   0, 
-     58,   0,   9,   0,  59,   0, 
-     16,   0,  58,   0,   9,   0, 
-     39,   0,  28,   0,  34,   0, 
-      9,   0,  39,   0,  28,   0, 
-     38,   0,   9,   0,  83,   0, 
-     29,   0,  51,   0,   9,   0, 
-     83,   0,  37,   0,  45,   0, 
-      9,   0,  83,   0,  33,   0, 
-     51,   0,   9,   0,  83,   0, 
-     29,   0,  51,   0,   9,   0, 
-     83,   0,  59,   0,  67,   0, 
-      9,   0,  83,   0,  55,   0, 
-     73,   0,   9,   0,  83,   0, 
-     29,   0,  73,   0,   9,   0, 
-     83,   0,  29,   0,  82,   0, 
-      9,   0,  50,   0,  27,   0, 
-     49,   0,   9,   0,  22,   0, 
-     16,   0,  21,   0,   9,   0, 
-     47,   0,  21,   0,  46,   0, 
-      9,   0,  47,   0,  21,   0, 
-     46,   0,   9,   0,  29,   0, 
-     15,   0,  28,   0,   9,   0, 
-     29,   0,  15,   0,  28,   0, 
-      9,   0,  29,   0,   9,   0, 
-     28,   0,   9,   0,  42,   0, 
-     27,   0,  35,   0,   9,   0, 
-     42,   0,  23,   0,  41,   0, 
-      9,   0,  72,   0,  16,   0, 
-     35,   0,   9,   0,  72,   0, 
-     16,   0,  40,   0,   9,   0, 
-     72,   0,  16,   0,  51,   0, 
-      9,   0,  72,   0,  15,   0, 
-     63,   0,   9,   0,  72,   0, 
-     15,   0,  71,   0,   9,   0, 
-     72,   0,   9,   0,  71,   0, 
-      5,   0,   5,   0,  28,   0, 
-     30,   0,   5,   0,   5,   0, 
-      5,   0,   5,   0,   5,   0, 
-     75,   0,  16,   0,  74,   0, 
-      5,   0,  75,   0,  44,   0, 
-     52,   0,   5,   0,  75,   0, 
-     40,   0,  58,   0,   5,   0, 
-     75,   0,  16,   0,  74,   0, 
-      5,   0,  75,   0,  16,   0, 
-     74,   0,   5,   0,  75,   0, 
-     16,   0,  74,   0,   5,   0, 
-     75,   0,  16,   0,  74,   0, 
-      5,   0,  75,   0,  16,   0, 
-     74,   0,   5,   0,  75,   0, 
-     16,   0,  74,   0,   5,   0, 
-     75,   0,  16,   0,  74,   0, 
-      5,   0,  75,   0,  16,   0, 
-     74,   0,   5,   0,  75,   0, 
-     16,   0,  74,   0,   5,   0, 
-     75,   0,  16,   0,  74,   0, 
-      5,   0,  75,   0,  16,   0, 
-     74,   0,   5,   0,  75,   0, 
-     16,   0,  74,   0,   5,   0, 
-     75,   0,  16,   0,  74,   0, 
-      5,   0,  75,   0,  16,   0, 
-     74,   0,   5,   0,  75,   0, 
-     16,   0,  74,   0,   5,   0, 
-     75,   0,  16,   0,  74,   0, 
-      5,   0,  75,   0,  16,   0, 
-     74,   0,   5,   0,  75,   0, 
-     16,   0,  74,   0,   5,   0, 
-     75,   0,  12,   0,  74,   0, 
-      5,   0,  68,   0,  31,   0, 
-     63,   0,   5,   0,  68,   0, 
-     12,   0,  67,   0,   5,   0, 
-     68,   0,  41,   0,  49,   0, 
-      5,   0,  68,   0,  37,   0, 
-     55,   0,   5,   0,  68,   0, 
-     18,   0,  67,   0,   5,   0, 
-     59,   0,  19,   0,  55,   0, 
-      5,   0,  59,   0,  12,   0, 
-     58,   0,   5,   0,  63,   0, 
-     43,   0,  52,   0,   5,   0, 
-     63,   0,  43,   0,  61,   0, 
-      5,   0,  63,   0,  23,   0, 
-     62,   0,   5,   0,  56,   0, 
-     17,   0,  55,   0,   5,   0, 
-     56,   0,  36,   0,  44,   0, 
-      5,   0,  56,   0,  32,   0, 
-     50,   0,   5,   0,  56,   0, 
-     17,   0,  55,   0,   5,   0, 
-     56,   0,  17,   0,  55,   0, 
-      5,   0,  56,   0,  17,   0, 
-     55,   0,   5,   0,  56,   0, 
-     17,   0,  55,   0,   5,   0, 
-     56,   0,  17,   0,  55,   0, 
-      5,   0,  56,   0,  17,   0, 
-     55,   0,   5,   0,  56,   0, 
-     17,   0,  55,   0,   5,   0, 
-     56,   0,  17,   0,  55,   0, 
-      5,   0,  56,   0,  17,   0, 
-     55,   0,   5,   0,  56,   0, 
-     17,   0,  55,   0,   5,   0, 
-     56,   0,  17,   0,  55,   0, 
-      5,   0,  56,   0,  17,   0, 
-     55,   0,   5,   0,  56,   0, 
-     17,   0,  55,   0,   5,   0, 
-     56,   0,  17,   0,  55,   0, 
-      5,   0,  56,   0,  12,   0, 
-     55,   0,   5,   0,  25,   0, 
-     17,   0,  24,   0,   5,   0, 
-     25,   0,  17,   0,  24,   0, 
-      5,   0,  64,   0,  25,   0, 
-     59,   0,   5,   0,  64,   0, 
-     12,   0,  63,   0,   5,   0, 
-     46,   0,  22,   0,  45,   0, 
-      5,   0,  52,   0,  23,   0, 
-     34,   0,   5,   0,  52,   0, 
-     23,   0,  45,   0,   5,   0, 
-     52,   0,  22,   0,  51,   0, 
-      5,   0,  48,   0,  20,   0, 
-     31,   0,   5,   0,  48,   0, 
-     20,   0,  47,   0,   5,   0, 
-     30,   0,  13,   0,  29,   0, 
-      5,   0,  30,   0,  13,   0, 
-     29,   0,   5,   0,  30,   0, 
-     13,   0,  29,   0,   5,   0, 
-     32,   0,  13,   0,  31,   0, 
-      5,   0,  32,   0,  13,   0, 
-     31,   0,   5,   0,  32,   0, 
-     13,   0,  31,   0,   5,   0, 
-     32,   0,  13,   0,  31,   0, 
-      5,   0,  32,   0,  13,   0, 
-     31,   0,   5,   0,  32,   0, 
-      5,   0,  31,   0,   5,   0, 
-     34,   0,   5,   0,  34,   0, 
-      5,   0,  34,   0,   5,   0, 
-     34,   0,   5,   0,  34,   0, 
-      5,   0,  34,   0, 246,   0, 
-      0,   0, 164,   0,   0,   0, 
-      1,   0,   0,   0,   0,  16, 
-      0,   0,   0,   0,   0,   0, 
-     34,   0,   0,   0,   0,   0, 
-      0,   0,   1,  16,   0,   0, 
-     24,   0,   0,   0,  13,   0, 
-      0,   0,   0,   0,   0,   0, 
-      2,  16,   0,   0,  24,   0, 
-      0,   0,  36,   0,   0,   0, 
-      0,   0,   0,   0,   3,  16, 
-      0,   0,  24,   0,   0,   0, 
-     26,   0,   0,   0,   0,   0, 
-      0,   0,   3,  16,   0,   0, 
-     24,   0,   0,   0,  26,   0, 
-      0,   0,   0,   0,   0,   0, 
-      4,  16,   0,   0,  24,   0, 
-      0,   0,  45,   0,   0,   0, 
-      0,   0,   0,   0,   5,  16, 
-      0,   0,  24,   0,   0,   0, 
-     49,   0,   0,   0,   0,   0, 
-      0,   0,   4,  16,   0,   0, 
-     24,   0,   0,   0,  45,   0, 
-      0,   0,   0,   0,   0,   0, 
-      6,  16,   0,   0,  24,   0, 
-      0,   0,   3,   0,   0,   0, 
-      0,   0,   0,   0,   7,  16, 
-      0,   0,  24,   0,   0,   0, 
-      8,   0,   0,   0,   0,   0, 
-      0,   0,  56,   0,   0,   0, 
-      0,   0,   0,   0,  32,   0, 
-      0,   0,  64,   0,   0,   0, 
-     96,   0,   0,   0, 136,   0, 
-      0,   0, 164,   0,   0,   0, 
-    196,   0,   0,   0, 232,   0, 
-      0,   0,   8,   1,   0,   0, 
-     36,   1,   0,   0,  68,   1, 
-      0,   0,  92,   1,   0,   0, 
-    120,   1,   0,   0, 156,   1, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,  18,   0,   1,  18, 
-      3,   0,   0,   0,  64,   0, 
-      0,   0,   0,  16,   0,   0, 
-     64,   0,   0,   0,  14,   0, 
-      8,  16,   8,  16,   0,   0, 
-     23,   0,   3,   0,  22,  16, 
-      0,   0,  10,   0,   1,  18, 
-      1,   0,   0,   0,   8,  16, 
-      0,   0,  14,   0,   8,  16, 
-      8,  16,   0,   0,  23,   0, 
-      1,   0,  24,  16,   0,   0, 
-     14,   0,  23,  21,   5,  16, 
-      0,   0,   3,   2, 128, 137, 
-      0,   0, 242, 241,  10,   0, 
-     24,  21,  26,  16,   0,   0, 
-      1,   0,   1,   0,  10,   0, 
-     24,  21,  27,  16,   0,   0, 
-      1,   0,   0,   2,  14,   0, 
-     23,  21,   5,  16,   0,   0, 
-      6,   2, 128, 137,   0,   0, 
-    242, 241,  10,   0,  24,  21, 
-     29,  16,   0,   0,   1,   0, 
-      1,   0,  10,   0,  24,  21, 
-     30,  16,   0,   0,   1,   0, 
-      0,   2,  14,   0,  23,  21, 
-      0,   0,   0,   0,  10,   2, 
-    128, 137,   0,   0, 242, 241, 
-     10,   0,  24,  21,  32,  16, 
-      0,   0,   1,   0,   1,   0, 
-     10,   0,  24,  21,  33,  16, 
-      0,   0,   1,   0,   0,   2, 
-     10,   0,  24,  21,   8,  16, 
-      0,   0,   1,   0,   0,   2, 
-     18,   0,  22,  21,   6,  16, 
-      0,   0,  34,   0,   0,   0, 
-     16,   0,   0,   0,  64,   0, 
-      0, 241,  10,   0,  24,  21, 
-     36,  16,   0,   0,   1,   0, 
-      0,   2,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,  11, 202, 
-     49,   1,  56,   0,   0,   0, 
-      0,  16,   0,   0,  38,  16, 
-      0,   0, 172,   2,   0,   0, 
-     12,   0, 255, 255,   4,   0, 
-      0,   0, 255, 255,   3,   0, 
-      0,   0,   0,   0, 152,   0, 
-      0,   0, 152,   0,   0,   0, 
-      8,   0,   0,   0, 160,   0, 
-      0,   0,   0,   0,   0,   0, 
-     22,   0,  27,  21,  64,   0, 
-      0,   0,   3,   0,   0,   0, 
-     12,   0, 102, 108, 111,  97, 
-    116,  51,   0, 243, 242, 241, 
-     22,   0,  27,  21,  64,   0, 
-      0,   0,   2,   0,   0,   0, 
-      8,   0, 102, 108, 111,  97, 
-    116,  50,   0, 243, 242, 241, 
-     58,   0,   3,  18,  13,  21, 
-      3,   0,   0,  16,   0,   0, 
-      0,   0, 119, 111, 114, 108, 
-    100,  80, 111, 115,   0, 241, 
-     13,  21,   3,   0,   0,  16, 
-      0,   0,  12,   0, 110, 111, 
-    114, 109,  97, 108,  87,  83, 
-      0, 241,  13,  21,   3,   0, 
-      1,  16,   0,   0,  24,   0, 
-    117, 118,   0, 243, 242, 241, 
-     38,   0,   5,  21,   3,   0, 
-      0,   0,   2,  16,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,  32,   0,  80, 105, 
-    120, 101, 108,  83, 104,  97, 
-    100, 101, 114,  73, 110, 112, 
-    117, 116,   0, 241,  10,   0, 
-      1,  18,   1,   0,   0,   0, 
-      3,  16,   0,   0,  22,   0, 
-     27,  21,  64,   0,   0,   0, 
-      4,   0,   0,   0,  16,   0, 
-    102, 108, 111,  97, 116,  52, 
-      0, 243, 242, 241,  10,   0, 
-     24,  21,   5,  16,   0,   0, 
-      1,   0,   1,   0,  14,   0, 
-      8,  16,   6,  16,   0,   0, 
-     23,   0,   1,   0,   4,  16, 
-      0,   0,  10,   0,  24,  21, 
-      0,  16,   0,   0,   1,   0, 
-      1,   0,  10,   0,  24,  21, 
-      1,  16,   0,   0,   1,   0, 
-      1,   0,  10,   0,  24,  21, 
-     64,   0,   0,   0,   1,   0, 
-      1,   0,  18,   0,   1,  18, 
-      3,   0,   0,   0,   0,  16, 
-      0,   0,   0,  16,   0,   0, 
-      1,  16,   0,   0,  14,   0, 
-      8,  16,   8,  16,   0,   0, 
-     23,   0,   3,   0,  11,  16, 
-      0,   0,  30,   0,  28,  21, 
-     64,   0,   0,   0,   3,   0, 
-      0,   0,   3,   0,   0,   0, 
-     12,   0,   0,   0,   0,  36, 
-      0, 102, 108, 111,  97, 116, 
-     51, 120,  51,   0,  18,   0, 
-      1,  18,   3,   0,   0,   0, 
-      0,  16,   0,   0,   0,  16, 
-      0,   0,  64,   0,   0,   0, 
-     14,   0,   8,  16,  10,  16, 
-      0,   0,  23,   0,   3,   0, 
-     14,  16,   0,   0,  22,   0, 
-      1,  18,   4,   0,   0,   0, 
-      0,  16,   0,   0,   0,  16, 
-      0,   0,   0,  16,   0,   0, 
-     64,   0,   0,   0,  14,   0, 
-      8,  16,  10,  16,   0,   0, 
-     23,   0,   4,   0,  16,  16, 
-      0,   0,  14,   0,   1,  18, 
-      2,   0,   0,   0,  64,   0, 
-      0,   0,  64,   0,   0,   0, 
-     14,   0,   8,  16,  10,  16, 
-      0,   0,  23,   0,   2,   0, 
-     18,  16,   0,   0,  14,   0, 
-      1,  18,   2,   0,   0,   0, 
-     64,   0,   0,   0,   0,  16, 
-      0,   0,  14,   0,   8,  16, 
-      8,  16,   0,   0,  23,   0, 
-      2,   0,  20,  16,   0,   0, 
-    255, 214,   0,   0, 166,  96, 
-      1,   0,  71, 194,   0,   0, 
-     91, 200,   1,   0, 213, 185, 
-      3,   0, 159, 216,   0,   0, 
-    190, 151,   2,   0, 152, 237, 
-      3,   0,   0,  16,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0, 117, 116,  10, 123, 
-     10,  32,  32,  32,  32, 102, 
-    108, 111,  97, 116,  51,  32, 
-    119, 111, 114, 108, 100,  80, 
-    111, 115,  32,  58,  32,  87, 
-     79,  82,  76,  68,  95,  80, 
-     79,  83,  73,  84,  73,  79, 
-     78,  59,  10,  32,  32,  32, 
-     32, 102, 108, 111,  97, 116, 
-     51,  32, 110, 111, 114, 109, 
-     97, 108,  87,  83,  32,  58, 
-     32,  78,  79,  82,  77,  65, 
-     76,  95,  87,  83,  59,  10, 
-     32,  32,  32,  32, 102, 108, 
-    111,  97, 116,  50,  32, 117, 
-    118,  32,  58,  32,  84,  69, 
-     88,  67,  79,  79,  82,  68, 
-     48,  59,  10, 125,  59,  10, 
-     10, 102, 108, 111,  97, 116, 
-     51,  32,  71, 101, 116,  78, 
-    111, 114, 109,  97, 108,  70, 
-    114, 111, 109,  77,  97, 112, 
-     40, 102, 108, 111,  97, 116, 
-     51,  32, 110, 111, 114, 109, 
-     97, 108,  44,  32, 102, 108, 
-    111,  97, 116,  51,  32, 119, 
-    111, 114, 108, 100,  80, 111, 
-    115,  44,  32, 102, 108, 111, 
-     97, 116,  50,  32, 117, 118, 
-     41,  32, 123,  13,  10,  32, 
-     32,  32,  32, 102, 108, 111, 
-     97, 116,  51,  32, 116,  97, 
-    110, 103, 101, 110, 116,  78, 
-    111, 114, 109,  97, 108,  32, 
-     61,  32, 110, 111, 114, 109, 
-     97, 108,  84, 101, 120,  46, 
-     83,  97, 109, 112, 108, 101, 
-     40, 115,  97, 109, 112, 108, 
-    101,  84, 121, 112, 101,  44, 
-     32, 117, 118,  41,  46, 114, 
-    103,  98,  59,  13,  10,  32, 
-     32,  32,  32, 116,  97, 110, 
-    103, 101, 110, 116,  78, 111, 
-    114, 109,  97, 108,  32,  61, 
-     32, 110, 111, 114, 109,  97, 
-    108, 105, 122, 101,  40, 116, 
-     97, 110, 103, 101, 110, 116, 
-     78, 111, 114, 109,  97, 108, 
-     32,  42,  32,  50,  46,  48, 
-     32,  45,  32,  49,  46,  48, 
-     41,  59,  13,  10,  13,  10, 
-     32,  32,  32,  32, 102, 108, 
-    111,  97, 116,  51,  32,  81, 
-     49,  32,  61,  32, 100, 100, 
-    120,  40, 119, 111, 114, 108, 
-    100,  80, 111, 115,  41,  59, 
-     13,  10,  32,  32,  32,  32, 
-    102, 108, 111,  97, 116,  51, 
-     32,  81,  50,  32,  61,  32, 
-    100, 100, 121,  40, 119, 111, 
-    114, 108, 100,  80, 111, 115, 
-     41,  59,  13,  10,  32,  32, 
-     32,  32, 102, 108, 111,  97, 
-    116,  50,  32, 115, 116,  49, 
-     32,  61,  32, 100, 100, 120, 
-     40, 117, 118,  41,  59,  13, 
-     10,  32,  32,  32,  32, 102, 
-    108, 111,  97, 116,  50,  32, 
-    115, 116,  50,  32,  61,  32, 
-    100, 100, 121,  40, 117, 118, 
-     41,  59,  13,  10,  13,  10, 
-     32,  32,  32,  32,  47,  47, 
-    102, 108, 111,  97, 116,  51, 
-     32,  78, 111, 114, 109,  97, 
-    108,  32,  61,  32, 110, 111, 
-    114, 109,  97, 108, 105, 122, 
-    101,  40, 110, 111, 114, 109, 
-     97, 108,  41,  59,  13,  10, 
-     32,  32,  32,  32,  47,  47, 
-    102, 108, 111,  97, 116,  51, 
-     32,  84,  97, 110, 103, 101, 
-    110, 116,  32,  61,  32, 110, 
-    111, 114, 109,  97, 108, 105, 
-    122, 101,  40,  81,  49,  32, 
-     42,  32, 115, 116,  50,  46, 
-    121,  32,  45,  32,  81,  50, 
-     32,  42,  32, 115, 116,  49, 
-     46, 121,  41,  59,  13,  10, 
-     32,  32,  32,  32,  47,  47, 
-    102, 108, 111,  97, 116,  51, 
-     32,  66, 105, 110, 111, 114, 
-    109,  97, 108,  32,  61,  32, 
-     45, 110, 111, 114, 109,  97, 
-    108, 105, 122, 101,  40,  99, 
-    114, 111, 115, 115,  40,  78, 
-    111, 114, 109,  97, 108,  44, 
-     32,  84,  97, 110, 103, 101, 
-    110, 116,  41,  41,  59,  13, 
-     10,  13,  10,  32,  32,  32, 
-     32, 102, 108, 111,  97, 116, 
-     51,  32,  78, 111, 114, 109, 
-     97, 108,  32,  61,  32, 110, 
-    111, 114, 109,  97, 108, 105, 
-    122, 101,  40, 110, 111, 114, 
-    109,  97, 108,  41,  59,  13, 
-     10,  32,  32,  32,  32, 102, 
-    108, 111,  97, 116,  51,  32, 
-     84,  97, 110, 103, 101, 110, 
-    116,  32,  61,  32,  45, 110, 
-    111, 114, 109,  97, 108, 105, 
-    122, 101,  40,  81,  49,  32, 
-     42,  32, 115, 116,  50,  46, 
-    121,  32,  45,  32,  81,  50, 
-     32,  42,  32, 115, 116,  49, 
-     46, 121,  41,  59,  13,  10, 
-     32,  32,  32,  32, 102, 108, 
-    111,  97, 116,  51,  32,  66, 
-    105, 110, 111, 114, 109,  97, 
-    108,  32,  61,  32, 110, 111, 
-    114, 109,  97, 108, 105, 122, 
-    101,  40,  99, 114, 111, 115, 
-    115,  40,  78, 111, 114, 109, 
-     97, 108,  44,  32,  84,  97, 
-    110, 103, 101, 110, 116,  41, 
-     41,  59,  13,  10,  13,  10, 
-     32,  32,  32,  32, 102, 108, 
-    111,  97, 116,  51, 120,  51, 
-     32,  84,  66,  78,  32,  61, 
-     32, 102, 108, 111,  97, 116, 
-     51, 120,  51,  40,  84,  97, 
-    110, 103, 101, 110, 116,  44, 
-     32,  66, 105, 110, 111, 114, 
-    109,  97, 108,  44,  32,  78, 
-    111, 114, 109,  97, 108,  41, 
-     59,  13,  10,  13,  10,  32, 
-     32,  32,  32, 114, 101, 116, 
-    117, 114, 110,  32, 110, 111, 
-    114, 109,  97, 108, 105, 122, 
-    101,  40, 109, 117, 108,  40, 
-    116,  97, 110, 103, 101, 110, 
-    116,  78, 111, 114, 109,  97, 
-    108,  44,  32,  84,  66,  78, 
-     41,  41,  59,  13,  10, 125, 
-     10,  10, 102, 108, 111,  97, 
-    116,  52,  32,  80,  98, 114, 
-     80, 105, 120, 101, 108,  83, 
-    104,  97, 100, 101, 114,  40, 
-     80, 105, 120, 101, 108,  83, 
-    104,  97, 100, 101, 114,  73, 
-    110, 112, 117, 116,  32,  73, 
-     78,  41,  32,  58,  32,  83, 
-     86,  95,  84,  65,  82,  71, 
-     69,  84,  10, 123,  10,  32, 
-     32,  32,  32,  99, 111, 110, 
-    115, 116,  32, 102, 108, 111, 
-     97, 116,  51,  32,  97, 108, 
-     98, 101, 100, 111,  84, 101, 
-    120, 101, 108,  32,  61,  32, 
-    112, 111, 119,  40,  97, 108, 
-     98, 101, 100, 111,  84, 101, 
-    120,  46,  83,  97, 109, 112, 
-    108, 101,  40, 115,  97, 109, 
-    112, 108, 101,  84, 121, 112, 
-    101,  44,  32,  73,  78,  46, 
-    117, 118,  41,  46, 114, 103, 
-     98,  44,  32,  50,  46,  50, 
-     41,  59,  10,  32,  32,  32, 
-     32,  99, 111, 110, 115, 116, 
-     32, 102, 108, 111,  97, 116, 
-     50,  32, 109, 101, 116,  97, 
-    108,  82, 111, 117, 103, 104, 
-    110, 101, 115, 115,  84, 101, 
-    120, 101, 108,  32,  61,  32, 
-    109, 101, 116,  97, 108,  82, 
-    111, 117, 103, 104, 110, 101, 
-    115, 115,  84, 101, 120,  46, 
-     83,  97, 109, 112, 108, 101, 
-     40, 115,  97, 109, 112, 108, 
-    101,  84, 121, 112, 101,  44, 
-     32,  73,  78,  46, 117, 118, 
-     41,  46, 114, 103,  59,  13, 
-     10,  32,  32,  32,  32,  99, 
-    111, 110, 115, 116,  32, 102, 
-    108, 111,  97, 116,  32, 109, 
-    101, 116,  97, 108, 108, 105, 
-     99,  32,  61,  32, 109, 101, 
-    116,  97, 108,  82, 111, 117, 
-    103, 104, 110, 101, 115, 115, 
-     84, 101, 120, 101, 108,  46, 
-    114,  59,  13,  10,  32,  32, 
-     32,  32,  99, 111, 110, 115, 
-    116,  32, 102, 108, 111,  97, 
-    116,  32, 114, 111, 117, 103, 
-    104, 110, 101, 115, 115,  32, 
-     61,  32, 109, 101, 116,  97, 
-    108,  82, 111, 117, 103, 104, 
-    110, 101, 115, 115,  84, 101, 
-    120, 101, 108,  46, 103,  59, 
-     13,  10,  32,  32,  32,  32, 
-     99, 111, 110, 115, 116,  32, 
-    102, 108, 111,  97, 116,  32, 
-     97, 111,  32,  61,  32,  97, 
-    111,  84, 101, 120,  46,  83, 
-     97, 109, 112, 108, 101,  40, 
-    115,  97, 109, 112, 108, 101, 
-     84, 121, 112, 101,  44,  32, 
-     73,  78,  46, 117, 118,  41, 
-     46, 114,  59,  10,  32,  32, 
-     32,  32,  99, 111, 110, 115, 
-    116,  32, 102, 108, 111,  97, 
-    116,  51,  32, 101, 109, 105, 
-    115, 115, 105, 111, 110,  84, 
-    101, 120, 101, 108,  32,  61, 
-     32, 112, 111, 119,  40, 101, 
-    109, 105, 115, 115, 105, 111, 
-    110,  84, 101, 120,  46,  83, 
-     97, 109, 112, 108, 101,  40, 
-    115,  97, 109, 112, 108, 101, 
-     84, 121, 112, 101,  44,  32, 
-     73,  78,  46, 117, 118,  41, 
-     46, 114, 103,  98,  44,  32, 
-     50,  46,  50,  41,  59,  10, 
-     10,  32,  32,  32,  32, 102, 
-    108, 111,  97, 116,  51,  32, 
-     78,  32,  61,  32,  71, 101, 
-    116,  78, 111, 114, 109,  97, 
-    108,  70, 114, 111, 109,  77, 
-     97, 112,  40, 110, 111, 114, 
-    109,  97, 108, 105, 122, 101, 
-     40,  73,  78,  46, 110, 111, 
-    114, 109,  97, 108,  87,  83, 
-     41,  44,  32,  73,  78,  46, 
-    119, 111, 114, 108, 100,  80, 
-    111, 115,  44,  32,  73,  78, 
-     46, 117, 118,  41,  59,  13, 
-     10,  32,  32,  32,  32, 102, 
-    108, 111,  97, 116,  51,  32, 
-     86,  32,  61,  32, 110, 111, 
-    114, 109,  97, 108, 105, 122, 
-    101,  40, 101, 121, 101,  80, 
-    111, 115,  32,  45,  32,  73, 
-     78,  46, 119, 111, 114, 108, 
-    100,  80, 111, 115,  41,  59, 
-     13,  10,  32,  32,  32,  32, 
-    102, 108, 111,  97, 116,  51, 
-     32,  82,  32,  61,  32, 114, 
-    101, 102, 108, 101,  99, 116, 
-     40,  45,  86,  44,  32,  78, 
-     41,  59,  13,  10,  13,  10, 
-     32,  32,  32,  32, 102, 108, 
-    111,  97, 116,  51,  32,  70, 
-     48,  32,  61,  32, 108, 101, 
-    114, 112,  40, 102, 108, 111, 
-     97, 116,  51,  40,  48,  46, 
-     48,  52,  44,  32,  48,  46, 
-     48,  52,  44,  32,  48,  46, 
-     48,  52,  41,  44,  32,  97, 
-    108,  98, 101, 100, 111,  84, 
-    101, 120, 101, 108,  46, 114, 
-    103,  98,  44,  32, 109, 101, 
-    116,  97, 108, 108, 105,  99, 
-     41,  59,  13,  10,  13,  10, 
-     32,  32,  32,  32,  47,  47, 
-     32, 114, 101, 102, 108, 101, 
-     99, 116,  97, 110,  99, 101, 
-     32, 101, 113, 117,  97, 116, 
-    105, 111, 110,  13,  10,  32, 
-     32,  32,  32, 102, 108, 111, 
-     97, 116,  51,  32,  76, 111, 
-     32,  61,  32, 102, 108, 111, 
-     97, 116,  51,  40,  48,  46, 
-     48,  44,  32,  48,  46,  48, 
-     44,  32,  48,  46,  48,  41, 
-     59,  13,  10,  32,  32,  32, 
-     32, 102, 111, 114,  32,  40, 
-    105, 110, 116,  32, 105,  32, 
-     61,  32,  48,  59,  32, 105, 
-     32,  60,  32,  52,  59,  32, 
-     43,  43, 105,  41,  32, 123, 
-     13,  10,  32,  32,  32,  32, 
-     32,  32,  32,  32,  47,  47, 
-     32,  99,  97, 108,  99, 117, 
-    108,  97, 116, 101,  32, 112, 
-    101, 114,  45, 108, 105, 103, 
-    104, 116,  32, 114,  97, 100, 
-    105,  97, 110,  99, 101,  13, 
-     10,  32,  32,  32,  32,  32, 
-     32,  32,  32, 102, 108, 111, 
-     97, 116,  51,  32,  76,  32, 
-     61,  32, 110, 111, 114, 109, 
-     97, 108, 105, 122, 101,  40, 
-    108, 105, 103, 104, 116,  80, 
-    111, 115, 105, 116, 105, 111, 
-    110, 115,  91, 105,  93,  46, 
-    120, 121, 122,  32,  45,  32, 
-     73,  78,  46, 119, 111, 114, 
-    108, 100,  80, 111, 115,  41, 
-     59,  13,  10,  32,  32,  32, 
-     32,  32,  32,  32,  32, 102, 
-    108, 111,  97, 116,  51,  32, 
-     72,  32,  61,  32, 110, 111, 
-    114, 109,  97, 108, 105, 122, 
-    101,  40,  86,  32,  43,  32, 
-     76,  41,  59,  13,  10,  32, 
-     32,  32,  32,  32,  32,  32, 
-     32, 102, 108, 111,  97, 116, 
-     32, 100, 105, 115, 116,  97, 
-    110,  99, 101,  32,  61,  32, 
-    108, 101, 110, 103, 116, 104, 
-     40, 108, 105, 103, 104, 116, 
-     80, 111, 115, 105, 116, 105, 
-    111, 110, 115,  91, 105,  93, 
-     46, 120, 121, 122,  32,  45, 
-     32,  73,  78,  46, 119, 111, 
-    114, 108, 100,  80, 111, 115, 
-     41,  59,  13,  10,  32,  32, 
-     32,  32,  32,  32,  32,  32, 
-    102, 108, 111,  97, 116,  32, 
-     97, 116, 116, 101, 110, 117, 
-     97, 116, 105, 111, 110,  32, 
-     61,  32,  49,  46,  48,  32, 
-     47,  32,  40, 100, 105, 115, 
-    116,  97, 110,  99, 101,  32, 
-     42,  32, 100, 105, 115, 116, 
-     97, 110,  99, 101,  41,  59, 
-     13,  10,  32,  32,  32,  32, 
-     32,  32,  32,  32, 102, 108, 
-    111,  97, 116,  51,  32, 114, 
-     97, 100, 105,  97, 110,  99, 
-    101,  32,  61,  32, 108, 105, 
-    103, 104, 116,  67, 111, 108, 
-    111, 114, 115,  91, 105,  93, 
-     46, 120, 121, 122,  32,  42, 
-     32,  97, 116, 116, 101, 110, 
-    117,  97, 116, 105, 111, 110, 
-     59,  13,  10,  13,  10,  32, 
-     32,  32,  32,  32,  32,  32, 
-     32,  47,  47,  32,  99, 111, 
-    111, 107,  45, 116, 111, 114, 
-    114,  97, 110,  99, 101,  32, 
-     98, 114, 100, 102,  13,  10, 
-     32,  32,  32,  32,  32,  32, 
-     32,  32, 102, 108, 111,  97, 
-    116,  32,  78,  68,  70,  32, 
-     61,  32,  68, 105, 115, 116, 
-    114, 105,  98, 117, 116, 105, 
-    111, 110,  71,  71,  88,  40, 
-     78,  44,  32,  72,  44,  32, 
-    114, 111, 117, 103, 104, 110, 
-    101, 115, 115,  41,  59,  13, 
-     10,  32,  32,  32,  32,  32, 
-     32,  32,  32, 102, 108, 111, 
-     97, 116,  32,  71,  32,  61, 
-     32,  71, 101, 111, 109, 101, 
-    116, 114, 121,  83, 109, 105, 
-    116, 104,  40,  78,  44,  32, 
-     86,  44,  32,  76,  44,  32, 
-    114, 111, 117, 103, 104, 110, 
-    101, 115, 115,  41,  59,  13, 
-     10,  32,  32,  32,  32,  32, 
-     32,  32,  32, 102, 108, 111, 
-     97, 116,  51,  32,  70,  32, 
-     61,  32,  70, 114, 101, 115, 
-    110, 101, 108,  83,  99, 104, 
-    108, 105,  99, 107,  40, 115, 
-     97, 116, 117, 114,  97, 116, 
-    101,  40, 100, 111, 116,  40, 
-     72,  44,  32,  86,  41,  41, 
-     44,  32,  70,  48,  41,  59, 
-     13,  10,  13,  10,  32,  32, 
-     32,  32,  32,  32,  32,  32, 
-    102, 108, 111,  97, 116,  51, 
-     32, 110, 117, 109, 101, 114, 
-     97, 116, 111, 114,  32,  61, 
-     32,  78,  68,  70,  32,  42, 
-     32,  71,  32,  42,  32,  70, 
-     59,  13,  10,  32,  32,  32, 
-     32,  32,  32,  32,  32, 102, 
-    108, 111,  97, 116,  32, 100, 
-    101, 110, 111, 109, 105, 110, 
-     97, 116, 111, 114,  32,  61, 
-     32,  52,  32,  42,  32, 109, 
-     97, 120,  40, 100, 111, 116, 
-     40,  78,  44,  32,  86,  41, 
-     44,  32,  48,  46,  48,  41, 
-     32,  42,  32, 109,  97, 120, 
-     40, 100, 111, 116,  40,  78, 
-     44,  32,  76,  41,  44,  32, 
-     48,  46,  48,  41,  32,  43, 
-     32,  48,  46,  48,  48,  48, 
-     49,  59,  32,  47,  47,  32, 
-     43,  32,  48,  46,  48,  48, 
-     48,  49,  32, 116, 111,  32, 
-    112, 114, 101, 118, 101, 110, 
-    116,  32, 100, 105, 118, 105, 
-    100, 101,  32,  98, 121,  32, 
-    122, 101, 114, 111,  13,  10, 
-     32,  32,  32,  32,  32,  32, 
-     32,  32, 102, 108, 111,  97, 
-    116,  51,  32, 115, 112, 101, 
-     99, 117, 108,  97, 114,  32, 
-     61,  32, 110, 117, 109, 101, 
-    114,  97, 116, 111, 114,  32, 
-     47,  32, 100, 101, 110, 111, 
-    109, 105, 110,  97, 116, 111, 
-    114,  59,  13,  10,  13,  10, 
-     32,  32,  32,  32,  32,  32, 
-     32,  32,  47,  47,  32, 107, 
-     83,  32, 105, 115,  32, 101, 
-    113, 117,  97, 108,  32, 116, 
-    111,  32,  70, 114, 101, 115, 
-    110, 101, 108,  13,  10,  32, 
-     32,  32,  32,  32,  32,  32, 
-     32, 102, 108, 111,  97, 116, 
-     51,  32, 107,  83,  32,  61, 
-     32,  70,  59,  13,  10,  32, 
-     32,  32,  32,  32,  32,  32, 
-     32,  47,  47,  32, 102, 111, 
-    114,  32, 101, 110, 101, 114, 
-    103, 121,  32,  99, 111, 110, 
-    115, 101, 114, 118,  97, 116, 
-    105, 111, 110,  44,  32, 116, 
-    104, 101,  32, 100, 105, 102, 
-    102, 117, 115, 101,  32,  97, 
-    110, 100,  32, 115, 112, 101, 
-     99, 117, 108,  97, 114,  32, 
-    108, 105, 103, 104, 116,  32, 
-     99,  97, 110,  39, 116,  13, 
-     10,  32,  32,  32,  32,  32, 
-     32,  32,  32,  47,  47,  32, 
-     98, 101,  32,  97,  98, 111, 
-    118, 101,  32,  49,  46,  48, 
-     32,  40, 117, 110, 108, 101, 
-    115, 115,  32, 116, 104, 101, 
-     32, 115, 117, 114, 102,  97, 
-     99, 101,  32, 101, 109, 105, 
-    116, 115,  32, 108, 105, 103, 
-    104, 116,  41,  59,  32, 116, 
-    111,  32, 112, 114, 101, 115, 
-    101, 114, 118, 101,  32, 116, 
-    104, 105, 115,  13,  10,  32, 
-     32,  32,  32,  32,  32,  32, 
-     32,  47,  47,  32, 114, 101, 
-    108,  97, 116, 105, 111, 110, 
-    115, 104, 105, 112,  32, 116, 
-    104, 101,  32, 100, 105, 102, 
-    102, 117, 115, 101,  32,  99, 
-    111, 109, 112, 111, 110, 101, 
-    110, 116,  32,  40, 107,  68, 
-     41,  32, 115, 104, 111, 117, 
-    108, 100,  32, 101, 113, 117, 
-     97, 108,  32,  49,  46,  48, 
-     32,  45,  32, 107,  83,  46, 
-     13,  10,  32,  32,  32,  32, 
-     32,  32,  32,  32, 102, 108, 
-    111,  97, 116,  51,  32, 107, 
-     68,  32,  61,  32, 102, 108, 
-    111,  97, 116,  51,  40,  49, 
-     46,  48,  44,  32,  49,  46, 
-     48,  44,  32,  49,  46,  48, 
-     41,  32,  45,  32, 107,  83, 
-     59,  13,  10,  32,  32,  32, 
-     32,  32,  32,  32,  32,  47, 
-     47,  32, 109, 117, 108, 116, 
-    105, 112, 108, 121,  32, 107, 
-     68,  32,  98, 121,  32, 116, 
-    104, 101,  32, 105, 110, 118, 
-    101, 114, 115, 101,  32, 109, 
-    101, 116,  97, 108, 110, 101, 
-    115, 115,  32, 115, 117,  99, 
-    104,  32, 116, 104,  97, 116, 
-     32, 111, 110, 108, 121,  32, 
-    110, 111, 110,  45, 109, 101, 
-    116,  97, 108, 115,  32,  13, 
-     10,  32,  32,  32,  32,  32, 
-     32,  32,  32,  47,  47,  32, 
-    104,  97, 118, 101,  32, 100, 
-    105, 102, 102, 117, 115, 101, 
-     32, 108, 105, 103, 104, 116, 
-    105, 110, 103,  44,  32, 111, 
-    114,  32,  97,  32, 108, 105, 
-    110, 101,  97, 114,  32,  98, 
-    108, 101, 110, 100,  32, 105, 
-    102,  32, 112,  97, 114, 116, 
-    108, 121,  32, 109, 101, 116, 
-     97, 108,  32,  40, 112, 117, 
-    114, 101,  32, 109, 101, 116, 
-     97, 108, 115,  13,  10,  32, 
-     32,  32,  32,  32,  32,  32, 
-     32,  47,  47,  32, 104,  97, 
-    118, 101,  32, 110, 111,  32, 
-    100, 105, 102, 102, 117, 115, 
-    101,  32, 108, 105, 103, 104, 
-    116,  41,  46,  13,  10,  32, 
-     32,  32,  32,  32,  32,  32, 
-     32, 107,  68,  32,  42,  61, 
-     32,  49,  46,  48,  32,  45, 
-     32, 109, 101, 116,  97, 108, 
-    108, 105,  99,  59,  13,  10, 
-     13,  10,  32,  32,  32,  32, 
-     32,  32,  32,  32,  47,  47, 
-     32, 115,  99,  97, 108, 101, 
-     32, 108, 105, 103, 104, 116, 
-     32,  98, 121,  32,  78, 100, 
-    111, 116,  76,  13,  10,  32, 
-     32,  32,  32,  32,  32,  32, 
-     32, 102, 108, 111,  97, 116, 
-     32,  78, 100, 111, 116,  76, 
-     32,  61,  32, 109,  97, 120, 
-     40, 100, 111, 116,  40,  78, 
-     44,  32,  76,  41,  44,  32, 
-     48,  46,  48,  41,  59,  13, 
-     10,  13,  10,  32,  32,  32, 
-     32,  32,  32,  32,  32,  47, 
-     47,  32,  97, 100, 100,  32, 
-    116, 111,  32, 111, 117, 116, 
-    103, 111, 105, 110, 103,  32, 
-    114,  97, 100, 105,  97, 110, 
-     99, 101,  32,  76, 111,  13, 
-     10,  32,  32,  32,  32,  32, 
-     32,  32,  32,  76, 111,  32, 
-     43,  61,  32,  40, 107,  68, 
-     32,  42,  32,  97, 108,  98, 
-    101, 100, 111,  84, 101, 120, 
-    101, 108,  46, 114, 103,  98, 
-     32,  47,  32,  80,  73,  32, 
-     43,  32, 115, 112, 101,  99, 
-    117, 108,  97, 114,  41,  32, 
-     42,  32, 114,  97, 100, 105, 
-     97, 110,  99, 101,  32,  42, 
-     32,  78, 100, 111, 116,  76, 
-     59,  13,  10,  32,  32,  32, 
-     32, 125,  13,  10,  13,  10, 
-     32,  32,  32,  32,  47,  47, 
-     32,  97, 109,  98, 105, 101, 
-    110, 116,  32, 108, 105, 103, 
-    104, 116, 105, 110, 103,  32, 
-     40, 119, 101,  32, 110, 111, 
-    119,  32, 117, 115, 101,  32, 
-     73,  66,  76,  32,  97, 115, 
-     32, 116, 104, 101,  32,  97, 
-    109,  98, 105, 101, 110, 116, 
-     32, 116, 101, 114, 109,  41, 
-     13,  10,  32,  32,  32,  32, 
-    102, 108, 111,  97, 116,  51, 
-     32,  70,  32,  61,  32,  70, 
-    114, 101, 115, 110, 101, 108, 
-     83,  99, 104, 108, 105,  99, 
-    107,  82, 111, 117, 103, 104, 
-    110, 101, 115, 115,  40, 109, 
-     97, 120,  40, 100, 111, 116, 
-     40,  78,  44,  32,  86,  41, 
-     44,  32,  48,  46,  48,  41, 
-     44,  32,  70,  48,  44,  32, 
-    114, 111, 117, 103, 104, 110, 
-    101, 115, 115,  41,  59,  13, 
-     10,  13,  10,  32,  32,  32, 
-     32, 102, 108, 111,  97, 116, 
-     51,  32, 112, 114, 101, 102, 
-    105, 108, 116, 101, 114, 101, 
-    100,  67, 111, 108, 111, 114, 
-     32,  61,  32, 114,  97, 100, 
-    105,  97, 110,  99, 101,  77, 
-     97, 112,  46,  83,  97, 109, 
-    112, 108, 101,  40, 115,  97, 
-    109, 112, 108, 101,  84, 121, 
-    112, 101,  44,  32,  82,  41, 
-     46, 114, 103,  98,  59,  32, 
-     47,  47,  32, 114, 111, 117, 
-    103, 104, 110, 101, 115, 115, 
-     32,  42,  32,  77,  65,  88, 
-     95,  82,  69,  70,  76,  69, 
-     67,  84,  73,  79,  78,  95, 
-     76,  79,  68,  13,  10,  32, 
-     32,  32,  32,  99, 111, 110, 
-    115, 116,  32, 102, 108, 111, 
-     97, 116,  50,  32,  98, 114, 
-    100, 102,  76, 117, 116,  85, 
-    118,  32,  61,  32, 102, 108, 
-    111,  97, 116,  50,  40, 109, 
-     97, 120,  40, 100, 111, 116, 
-     40,  78,  44,  32,  86,  41, 
-     44,  32,  48,  46,  48,  41, 
-     44,  32, 114, 111, 117, 103, 
-    104, 110, 101, 115, 115,  41, 
-     59,  13,  10,  32,  32,  32, 
-     32, 102, 108, 111,  97, 116, 
-     50,  32,  98, 114, 100, 102, 
-     32,  61,  32,  98, 114, 100, 
-    102,  76,  85,  84,  46,  83, 
-     97, 109, 112, 108, 101,  40, 
-    115,  97, 109, 112, 108, 101, 
-     84, 121, 112, 101,  44,  32, 
-     98, 114, 100, 102,  76, 117, 
-    116,  85, 118,  41,  46, 114, 
-    103,  59,  13,  10,  32,  32, 
-     32,  32, 102, 108, 111,  97, 
-    116,  51,  32, 115, 112, 101, 
-     99, 117, 108,  97, 114,  32, 
-     61,  32, 112, 114, 101, 102, 
-    105, 108, 116, 101, 114, 101, 
-    100,  67, 111, 108, 111, 114, 
-     32,  42,  32,  40,  70,  32, 
-     42,  32,  98, 114, 100, 102, 
-     46, 120,  32,  43,  32,  98, 
-    114, 100, 102,  46, 121,  41, 
-     59,  13,  10,  13,  10,  32, 
-     32,  32,  32,  47,  47,  32, 
-    102, 108, 111,  97, 116,  51, 
-     32,  97, 109,  98, 105, 101, 
-    110, 116,  32,  61,  32,  32, 
-     47,  47,  32, 116, 101, 120, 
-    116, 117, 114, 101,  40, 105, 
-    114, 114,  97, 100, 105,  97, 
-    110,  99, 101,  77,  97, 112, 
-     44,  32,  78,  41,  46, 114, 
-    103,  98,  59,  13,  10,  32, 
-     32,  32,  32, 102, 108, 111, 
-     97, 116,  51,  32, 107,  83, 
-     32,  61,  32,  70, 114, 101, 
-    115, 110, 101, 108,  83,  99, 
-    104, 108, 105,  99, 107,  40, 
-    109,  97, 120,  40, 100, 111, 
-    116,  40,  78,  44,  32,  86, 
-     41,  44,  32,  48,  46,  48, 
-     41,  44,  32,  70,  48,  41, 
-     59,  13,  10,  32,  32,  32, 
-     32, 102, 108, 111,  97, 116, 
-     51,  32, 107,  68,  32,  61, 
-     32,  49,  46,  48,  32,  45, 
-     32, 107,  83,  59,  13,  10, 
-     32,  32,  32,  32, 102, 108, 
-    111,  97, 116,  51,  32, 105, 
-    114, 114,  97, 100, 105,  97, 
-    110,  99, 101,  32,  61,  32, 
-    105, 114, 114,  97, 100, 105, 
-     97, 110,  99, 101,  77,  97, 
-    112,  46,  83,  97, 109, 112, 
-    108, 101,  40, 115,  97, 109, 
-    112, 108, 101,  84, 121, 112, 
-    101,  44,  32,  78,  41,  46, 
-    114, 103,  98,  59,  13,  10, 
-     32,  32,  32,  32, 102, 108, 
-    111,  97, 116,  51,  32, 100, 
-    105, 102, 102, 117, 115, 101, 
-     32,  61,  32, 105, 114, 114, 
-     97, 100, 105,  97, 110,  99, 
-    101,  32,  42,  32,  97, 108, 
-     98, 101, 100, 111,  84, 101, 
-    120, 101, 108,  59,  13,  10, 
-     32,  32,  32,  32, 102, 108, 
-    111,  97, 116,  51,  32,  97, 
-    109,  98, 105, 101, 110, 116, 
-     32,  61,  32,  40, 107,  68, 
-     32,  42,  32, 100, 105, 102, 
-    102, 117, 115, 101,  32,  43, 
-     32, 115, 112, 101,  99, 117, 
-    108,  97, 114,  41,  32,  42, 
-     32,  97, 111,  59,  13,  10, 
-     32,  32,  32,  32,  47,  47, 
-    102, 108, 111,  97, 116,  51, 
-     32,  97, 109,  98, 105, 101, 
-    110, 116,  32,  61,  32, 102, 
-    108, 111,  97, 116,  51,  40, 
-     48,  46,  49,  51,  44,  32, 
-     48,  46,  49,  51,  44,  32, 
-     48,  46,  49,  51,  41,  32, 
-     42,  32,  97, 108,  98, 101, 
-    100, 111,  84, 101, 120, 101, 
-    108,  46, 114, 103,  98,  32, 
-     42,  32,  97, 111,  59,  13, 
-     10,  32,  32,  32,  32, 102, 
-    108, 111,  97, 116,  51,  32, 
-     99, 111, 108, 111, 114,  32, 
-     61,  32,  97, 109,  98, 105, 
-    101, 110, 116,  32,  43,  32, 
-     76, 111,  32,  43,  32, 101, 
-    109, 105, 115, 115, 105, 111, 
-    110,  84, 101, 120, 101, 108, 
-     59,  13,  10,  13,  10,  32, 
-     32,  32,  32,  99, 111, 108, 
-    111, 114,  32,  61,  32,  84, 
-    111, 110, 101,  77,  97, 112, 
-     72,  68,  82,  40,  99, 111, 
-    108, 111, 114,  41,  59,  10, 
-     32,  32,  32,  32,  99, 111, 
-    108, 111, 114,  32,  61,  32, 
-     67, 111, 114, 114, 101,  99, 
-    116,  71,  97, 109, 109,  97, 
-     40,  99, 111, 108, 111, 114, 
-     41,  59,  13,  10,  13,  10, 
-     32,  32,  32,  32, 114, 101, 
-    116, 117, 114, 110,  32, 102, 
-    108, 111,  97, 116,  52,  40, 
-     99, 111, 108, 111, 114,  46, 
-    114, 103,  98,  44,  32,  49, 
-     46,  48,  41,  59,  10, 125, 
-      0, 115, 116,  97, 116, 105, 
-     99,  32,  99, 111, 110, 115, 
-    116,  32, 102, 108, 111,  97, 
-    116,  32,  80,  73,  32,  61, 
-     32,  51,  46,  49,  52,  49, 
-     53,  57,  50,  54,  53,  51, 
-     53,  57,  59,  10,  10, 105, 
-    110, 108, 105, 110, 101,  32, 
-    102, 108, 111,  97, 116,  51, 
-     32,  84, 111, 110, 101,  77, 
-     97, 112,  72,  68,  82,  40, 
-     99, 111, 110, 115, 116,  32, 
-    102, 108, 111,  97, 116,  51, 
-     32,  99, 111, 108, 111, 114, 
-     41,  32, 123,  10,  32,  32, 
-     32,  32,  47,  47,  32,  82, 
-    101, 105, 110, 104,  97, 114, 
-    100,  32, 111, 112, 101, 114, 
-     97, 116, 111, 114,  10,  32, 
-     32,  32,  32, 114, 101, 116, 
-    117, 114, 110,  32,  99, 111, 
-    108, 111, 114,  32,  47,  32, 
-     40,  99, 111, 108, 111, 114, 
-     32,  43,  32, 102, 108, 111, 
-     97, 116,  51,  40,  49,  46, 
-     48,  44,  32,  49,  46,  48, 
-     44,  32,  49,  46,  48,  41, 
-     41,  59,  10, 125,  10,  10, 
-    105, 110, 108, 105, 110, 101, 
-     32, 102, 108, 111,  97, 116, 
-     51,  32,  67, 111, 114, 114, 
-    101,  99, 116,  71,  97, 109, 
-    109,  97,  40,  99, 111, 110, 
-    115, 116,  32, 102, 108, 111, 
-     97, 116,  51,  32,  99, 111, 
-    108, 111, 114,  41,  32, 123, 
-     10,  32,  32,  32,  32,  99, 
-    111, 110, 115, 116,  32, 102, 
-    108, 111,  97, 116,  32, 112, 
-    111, 119,  78,  32,  61,  32, 
-     49,  46,  48,  32,  47,  32, 
-     50,  46,  50,  59,  10,  32, 
-     32,  32,  32, 114, 101, 116, 
-    117, 114, 110,  32, 112, 111, 
-    119,  40,  99, 111, 108, 111, 
-    114,  44,  32, 102, 108, 111, 
-     97, 116,  51,  40, 112, 111, 
-    119,  78,  44,  32, 112, 111, 
-    119,  78,  44,  32, 112, 111, 
-    119,  78,  41,  41,  59,  10, 
-    125,  10,  10, 102, 108, 111, 
-     97, 116,  32,  68, 105, 115, 
-    116, 114, 105,  98, 117, 116, 
-    105, 111, 110,  71,  71,  88, 
-     40, 102, 108, 111,  97, 116, 
-     51,  32,  78,  44,  32, 102, 
-    108, 111,  97, 116,  51,  32, 
-     72,  44,  32, 102, 108, 111, 
-     97, 116,  32, 114, 111, 117, 
-    103, 104, 110, 101, 115, 115, 
-     41,  32, 123,  10,  32,  32, 
-     32,  32, 102, 108, 111,  97, 
-    116,  32,  97,  32,  61,  32, 
-    114, 111, 117, 103, 104, 110, 
-    101, 115, 115,  32,  42,  32, 
-    114, 111, 117, 103, 104, 110, 
-    101, 115, 115,  59,  10,  32, 
-     32,  32,  32, 102, 108, 111, 
-     97, 116,  32,  97,  50,  32, 
-     61,  32,  97,  32,  42,  32, 
-     97,  59,  10,  32,  32,  32, 
-     32, 102, 108, 111,  97, 116, 
-     32,  78, 100, 111, 116,  72, 
-     32,  61,  32, 109,  97, 120, 
-     40, 100, 111, 116,  40,  78, 
-     44,  32,  72,  41,  44,  32, 
-     48,  46,  48,  41,  59,  10, 
-     32,  32,  32,  32, 102, 108, 
-    111,  97, 116,  32,  78, 100, 
-    111, 116,  72,  50,  32,  61, 
-     32,  78, 100, 111, 116,  72, 
-     32,  42,  32,  78, 100, 111, 
-    116,  72,  59,  10,  10,  32, 
-     32,  32,  32, 102, 108, 111, 
-     97, 116,  32, 110, 117, 109, 
-     32,  61,  32,  97,  50,  59, 
-     10,  32,  32,  32,  32, 102, 
-    108, 111,  97, 116,  32, 100, 
-    101, 110, 111, 109,  32,  61, 
-     32,  40,  78, 100, 111, 116, 
-     72,  50,  32,  42,  32,  40, 
-     97,  50,  32,  45,  32,  49, 
-     46,  48,  41,  32,  43,  32, 
-     49,  46,  48,  41,  59,  10, 
-     32,  32,  32,  32, 100, 101, 
-    110, 111, 109,  32,  61,  32, 
-     80,  73,  32,  42,  32, 100, 
-    101, 110, 111, 109,  32,  42, 
-     32, 100, 101, 110, 111, 109, 
-     59,  10,  10,  32,  32,  32, 
-     32, 114, 101, 116, 117, 114, 
-    110,  32, 110, 117, 109,  32, 
-     47,  32, 100, 101, 110, 111, 
-    109,  59,  10, 125,  10,  10, 
-    102, 108, 111,  97, 116,  32, 
-     71, 101, 111, 109, 101, 116, 
-    114, 121,  83,  99, 104, 108, 
-    105,  99, 107,  71,  71,  88, 
-     40, 102, 108, 111,  97, 116, 
-     32,  78, 100, 111, 116,  86, 
-     44,  32, 102, 108, 111,  97, 
-    116,  32, 114, 111, 117, 103, 
-    104, 110, 101, 115, 115,  41, 
-     32, 123,  10,  32,  32,  32, 
-     32, 102, 108, 111,  97, 116, 
-     32, 114,  32,  61,  32,  40, 
-    114, 111, 117, 103, 104, 110, 
-    101, 115, 115,  32,  43,  32, 
-     49,  46,  48,  41,  59,  10, 
-     32,  32,  32,  32, 102, 108, 
-    111,  97, 116,  32, 107,  32, 
-     61,  32,  40, 114,  32,  42, 
-     32, 114,  41,  32,  47,  32, 
-     56,  46,  48,  59,  10,  10, 
-     32,  32,  32,  32, 102, 108, 
-    111,  97, 116,  32, 110, 117, 
-    109,  32,  61,  32,  78, 100, 
-    111, 116,  86,  59,  10,  32, 
-     32,  32,  32, 102, 108, 111, 
-     97, 116,  32, 100, 101, 110, 
-    111, 109,  32,  61,  32,  78, 
-    100, 111, 116,  86,  32,  42, 
-     32,  40,  49,  46,  48,  32, 
-     45,  32, 107,  41,  32,  43, 
-     32, 107,  59,  10,  10,  32, 
-     32,  32,  32, 114, 101, 116, 
-    117, 114, 110,  32, 110, 117, 
-    109,  32,  47,  32, 100, 101, 
-    110, 111, 109,  59,  10, 125, 
-     10,  10, 102, 108, 111,  97, 
-    116,  32,  71, 101, 111, 109, 
-    101, 116, 114, 121,  83, 109, 
-    105, 116, 104,  40, 102, 108, 
-    111,  97, 116,  51,  32,  78, 
-     44,  32, 102, 108, 111,  97, 
-    116,  51,  32,  86,  44,  32, 
-    102, 108, 111,  97, 116,  51, 
-     32,  76,  44,  32, 102, 108, 
-    111,  97, 116,  32, 114, 111, 
-    117, 103, 104, 110, 101, 115, 
-    115,  41,  32, 123,  10,  32, 
-     32,  32,  32, 102, 108, 111, 
-     97, 116,  32,  78, 100, 111, 
-    116,  86,  32,  61,  32, 109, 
-     97, 120,  40, 100, 111, 116, 
-     40,  78,  44,  32,  86,  41, 
-     44,  32,  48,  46,  48,  41, 
-     59,  10,  32,  32,  32,  32, 
-    102, 108, 111,  97, 116,  32, 
-     78, 100, 111, 116,  76,  32, 
-     61,  32, 109,  97, 120,  40, 
-    100, 111, 116,  40,  78,  44, 
-     32,  76,  41,  44,  32,  48, 
-     46,  48,  41,  59,  10,  32, 
-     32,  32,  32, 102, 108, 111, 
-     97, 116,  32, 103, 103, 120, 
-     50,  32,  61,  32,  71, 101, 
-    111, 109, 101, 116, 114, 121, 
-     83,  99, 104, 108, 105,  99, 
-    107,  71,  71,  88,  40,  78, 
-    100, 111, 116,  86,  44,  32, 
-    114, 111, 117, 103, 104, 110, 
-    101, 115, 115,  41,  59,  10, 
-     32,  32,  32,  32, 102, 108, 
-    111,  97, 116,  32, 103, 103, 
-    120,  49,  32,  61,  32,  71, 
-    101, 111, 109, 101, 116, 114, 
-    121,  83,  99, 104, 108, 105, 
-     99, 107,  71,  71,  88,  40, 
-     78, 100, 111, 116,  76,  44, 
-     32, 114, 111, 117, 103, 104, 
-    110, 101, 115, 115,  41,  59, 
-     10,  10,  32,  32,  32,  32, 
-    114, 101, 116, 117, 114, 110, 
-     32, 103, 103, 120,  49,  32, 
-     42,  32, 103, 103, 120,  50, 
-     59,  10, 125,  10,  10, 102, 
-    108, 111,  97, 116,  51,  32, 
-     70, 114, 101, 115, 110, 101, 
-    108,  83,  99, 104, 108, 105, 
-     99, 107,  40, 102, 108, 111, 
-     97, 116,  32,  99, 111, 115, 
-     84, 104, 101, 116,  97,  44, 
-     32, 102, 108, 111,  97, 116, 
-     51,  32,  70,  48,  41,  32, 
-    123,  10,  32,  32,  32,  32, 
-    114, 101, 116, 117, 114, 110, 
-     32,  70,  48,  32,  43,  32, 
-     40,  49,  46,  48,  32,  45, 
-     32,  70,  48,  41,  32,  42, 
-     32, 112, 111, 119,  40, 115, 
-     97, 116, 117, 114,  97, 116, 
-    101,  40,  49,  46,  48,  32, 
-     45,  32,  99, 111, 115,  84, 
-    104, 101, 116,  97,  41,  44, 
-     32,  53,  46,  48,  41,  59, 
-     10, 125,  10,  10, 102, 108, 
-    111,  97, 116,  51,  32,  70, 
-    114, 101, 115, 110, 101, 108, 
-     83,  99, 104, 108, 105,  99, 
-    107,  82, 111, 117, 103, 104, 
-    110, 101, 115, 115,  40, 102, 
-    108, 111,  97, 116,  32,  99, 
-    111, 115,  84, 104, 101, 116, 
-     97,  44,  32, 102, 108, 111, 
-     97, 116,  51,  32,  70,  48, 
-     44,  32, 102, 108, 111,  97, 
-    116,  32, 114, 111, 117, 103, 
-    104, 110, 101, 115, 115,  41, 
-     32, 123,  10,  32,  32,  32, 
-     32,  99, 111, 110, 115, 116, 
-     32, 102, 108, 111,  97, 116, 
-     32, 111, 110, 101,  77, 105, 
-    110, 117, 115,  82, 111, 117, 
-    103, 104, 110, 101, 115, 115, 
-     32,  61,  32,  49,  46,  48, 
-     32,  45,  32, 114, 111, 117, 
-    103, 104, 110, 101, 115, 115, 
-     59,  10,  32,  32,  32,  32, 
-    114, 101, 116, 117, 114, 110, 
-     32,  70,  48,  32,  43,  32, 
-     40, 109,  97, 120,  40, 102, 
-    108, 111,  97, 116,  51,  40, 
-    111, 110, 101,  77, 105, 110, 
-    117, 115,  82, 111, 117, 103, 
-    104, 110, 101, 115, 115,  44, 
-     32, 111, 110, 101,  77, 105, 
-    110, 117, 115,  82, 111, 117, 
-    103, 104, 110, 101, 115, 115, 
-     44,  32, 111, 110, 101,  77, 
-    105, 110, 117, 115,  82, 111, 
-    117, 103, 104, 110, 101, 115, 
-    115,  41,  44,  32,  70,  48, 
-     41,  32,  45,  32,  70,  48, 
-     41,  32,  42,  32, 112, 111, 
-    119,  40, 115,  97, 116, 117, 
-    114,  97, 116, 101,  40,  49, 
-     46,  48,  32,  45,  32,  99, 
-    111, 115,  84, 104, 101, 116, 
-     97,  41,  44,  32,  53,  46, 
-     48,  41,  59,  10, 125,   0, 
-     99,  98, 117, 102, 102, 101, 
-    114,  32,  80, 101, 114,  65, 
-    112, 112, 108, 105,  99,  97, 
-    116, 105, 111, 110,  32,  58, 
-     32, 114, 101, 103, 105, 115, 
-    116, 101, 114,  40,  98,  48, 
-     41,  32, 123,  13,  10,   9, 
-    109,  97, 116, 114, 105, 120, 
-     32, 112, 114, 111, 106, 101, 
-     99, 116, 105, 111, 110,  77, 
-     97, 116, 114, 105, 120,  59, 
-     13,  10,   9, 102, 108, 111, 
-     97, 116,  51,  32,  99, 108, 
-    105, 101, 110, 116,  68,  97, 
-    116,  97,  59,  13,  10, 125, 
-     13,  10,  13,  10,  99,  98, 
-    117, 102, 102, 101, 114,  32, 
-     80, 101, 114,  70, 114,  97, 
-    109, 101,  32,  58,  32, 114, 
-    101, 103, 105, 115, 116, 101, 
-    114,  40,  98,  49,  41,  32, 
-    123,  13,  10,   9, 109,  97, 
-    116, 114, 105, 120,  32, 118, 
-    105, 101, 119,  77,  97, 116, 
-    114, 105, 120,  59,  13,  10, 
-      9, 102, 108, 111,  97, 116, 
-     51,  32, 101, 121, 101,  80, 
-    111, 115,  59,  13,  10,   9, 
-    102, 108, 111,  97, 116,  51, 
-     32, 108, 105, 103, 104, 116, 
-     80, 111, 115,  59,  13,  10, 
-    125,  13,  10,  13,  10,  99, 
-     98, 117, 102, 102, 101, 114, 
-     32,  80, 101, 114,  79,  98, 
-    106, 101,  99, 116,  32,  58, 
-     32, 114, 101, 103, 105, 115, 
-    116, 101, 114,  40,  98,  50, 
-     41,  32, 123,  13,  10,   9, 
-    109,  97, 116, 114, 105, 120, 
-     32, 109, 111, 100, 101, 108, 
-     77,  97, 116, 114, 105, 120, 
-     59,  13,  10,   9, 109,  97, 
-    116, 114, 105, 120,  32, 118, 
-    105, 101, 119,  80, 114, 111, 
-    106, 101,  99, 116, 105, 111, 
-    110,  77,  97, 116, 114, 105, 
-    120,  59,  13,  10,   9, 109, 
-     97, 116, 114, 105, 120,  32, 
-    109, 111, 100, 101, 108,  86, 
-    105, 101, 119,  80, 114, 111, 
-    106, 101,  99, 116, 105, 111, 
-    110,  77,  97, 116, 114, 105, 
-    120,  59,  13,  10, 125,   0, 
-     17,   0,   0,   0, 120,   0, 
-      0,   0, 174,   0,   0,   0, 
-     73,  20,   0,   0, 228,   0, 
-      0,   0,  60,   0,   0,   0, 
-     38,   1,   0,   0,  42,  26, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-    104,   1,   0,   0,   0,   0, 
-      0,   0,   1,   0,   0,   0, 
-     61,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-     10,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,  11, 202,  49,   1, 
-     56,   0,   0,   0,   0,  16, 
-      0,   0,   8,  16,   0,   0, 
-    236,   0,   0,   0,  13,   0, 
-    255, 255,   4,   0,   0,   0, 
-    255, 255,   3,   0,   0,   0, 
-      0,   0,  32,   0,   0,   0, 
-     32,   0,   0,   0,   8,   0, 
-      0,   0,  40,   0,   0,   0, 
-      0,   0,   0,   0,  30,   0, 
-      1,  22,   0,   0,   0,   0, 
-     12,  16,   0,   0,  71, 101, 
-    116,  78, 111, 114, 109,  97, 
-    108,  70, 114, 111, 109,  77, 
-     97, 112,   0, 243, 242, 241, 
-     26,   0,   1,  22,   0,   0, 
-      0,   0,  15,  16,   0,   0, 
-     68, 105, 115, 116, 114, 105, 
-     98, 117, 116, 105, 111, 110, 
-     71,  71,  88,   0,  26,   0, 
-      1,  22,   0,   0,   0,   0, 
-     17,  16,   0,   0,  71, 101, 
-    111, 109, 101, 116, 114, 121, 
-     83, 109, 105, 116, 104,   0, 
-    242, 241,  30,   0,   1,  22, 
-      0,   0,   0,   0,  19,  16, 
-      0,   0,  71, 101, 111, 109, 
-    101, 116, 114, 121,  83,  99, 
-    104, 108, 105,  99, 107,  71, 
-     71,  88,   0, 241,  26,   0, 
-      1,  22,   0,   0,   0,   0, 
-     21,  16,   0,   0,  70, 114, 
-    101, 115, 110, 101, 108,  83, 
-     99, 104, 108, 105,  99, 107, 
-      0, 241,  34,   0,   1,  22, 
-      0,   0,   0,   0,  23,  16, 
-      0,   0,  70, 114, 101, 115, 
-    110, 101, 108,  83,  99, 104, 
-    108, 105,  99, 107,  82, 111, 
-    117, 103, 104, 110, 101, 115, 
-    115,   0,  22,   0,   1,  22, 
-      0,   0,   0,   0,  25,  16, 
-      0,   0,  84, 111, 110, 101, 
-     77,  97, 112,  72,  68,  82, 
-      0, 241,  26,   0,   1,  22, 
-      0,   0,   0,   0,  25,  16, 
-      0,   0,  67, 111, 114, 114, 
-    101,  99, 116,  71,  97, 109, 
-    109,  97,   0, 243, 242, 241, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,  68,  51, 
-     68,  83,  72,  68,  82,   0, 
-     28,  28,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,  32,   0, 
-      0,  96,  32,   0,   0,   0, 
-      8,   0,   0,   0,  40,   0, 
-      0,   0,   0,   0,   0,   0, 
-     30,   0,   1,  22,   0,   0, 
-      0,   0,  12,  16,   0,   0, 
-     71, 101, 116,  78, 111, 114, 
-    109,  97, 108,  70, 114, 111, 
-    109,  77,  97, 112,   0, 243, 
-    242, 241,  26,   0,   1,  22, 
-      0,   0,   0,   0,  15,  16, 
-      0,   0,  68, 105, 115, 116, 
-    114, 105,  98, 117, 116, 105, 
-    111, 110,  71,  71,  88,   0, 
-     26,   0,   1,  22,   0,   0, 
-      0,   0,  17,  16,   0,   0, 
-     71, 101, 111, 109, 101, 116, 
-    114, 121,  83, 109, 105, 116, 
-    104,   0, 242, 241,  30,   0, 
-      1,  22,   0,   0,   0,   0, 
-     19,  16,   0,   0,  71, 101, 
-    111, 109, 101, 116, 114, 121, 
-     83,  99, 104, 108, 105,  99, 
-    107,  71,  71,  88,   0, 241, 
-     26,   0,   1,  22,   0,   0, 
-      0,   0,  21,  16,   0,   0, 
-     70, 114, 101, 115, 110, 101, 
-    108,  83,  99, 104, 108, 105, 
-     99, 107,   0, 241,  34,   0, 
-      1,  22,   0,   0,   0,   0, 
-     23,  16,   0,   0,  70, 114, 
-    101, 115, 110, 101, 108,  83, 
-     99, 104, 108, 105,  99, 107, 
-     82, 111, 117, 103, 104, 110, 
-    101, 115, 115,   0,  22,   0, 
-      1,  22,   0,   0,   0,   0, 
-     25,  16,   0,   0,  84, 111, 
-    110, 101,  77,  97, 112,  72, 
-     68,  82,   0, 241,  26,   0, 
-      1,  22,   0,   0,   0,   0, 
-     25,  16,   0,   0,  67, 111, 
-    114, 114, 101,  99, 116,  71, 
-     97, 109, 109,  97,   0, 243, 
-    242, 241,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-    255, 255, 255, 255,  26,   9, 
-     47, 241, 112,   0,   0,   0, 
-     60,   2,   0,   0, 137,   0, 
-      0,   0,   1,   0,   0,   0, 
-     33,   0,   0,   0,   1,   0, 
-      0,   0, 121,   1,   0,   0, 
-      1,   0,   0,   0,   1,   0, 
-      0,   0,   1,   0,   0,   0, 
-    233,   0,   0,   0,   1,   0, 
-      0,   0,  93,   1,   0,   0, 
-      1,   0,   0,   0, 165,   0, 
-      0,   0,   1,   0,   0,   0, 
-    157,   1,   0,   0,   1,   0, 
-      0,   0,  97,   0,   0,   0, 
-      1,   0,   0,   0,  69,   1, 
-      0,   0,   1,   0,   0,   0, 
-      9,   1,   0,   0,   1,   0, 
-      0,   0,  37,   1,   0,   0, 
-      1,   0,   0,   0, 197,   0, 
-      0,   0,   1,   0,   0,   0, 
-     65,   0,   0,   0,   1,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,  16, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   8, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0, 128,   0, 
-      0,   0,   4,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-     18,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0, 128,   0,   0,   0, 
-      0,   0, 128,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0, 128,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   2,   0,   0, 
-      0,   0,   0,   0,  64,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0, 128, 
-      4,   0,   1,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-     12,   0,   0,   0,  24,   0, 
-      0,   0,  36,   0,   0,   0, 
-     48,   0,   0,   0,  60,   0, 
-      0,   0,  72,   0,   0,   0, 
-     84,   0,   0,   0,  96,   0, 
-      0,   0, 108,   0,   0,   0, 
-    120,   0,   0,   0, 132,   0, 
-      0,   0, 144,   0,   0,   0, 
-    156,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,  30,   0, 
-     37,  17,   0,   0,   0,   0, 
-    136,   0,   0,   0,   1,   0, 
-     80,  98, 114,  80, 105, 120, 
-    101, 108,  83, 104,  97, 100, 
-    101, 114,   0,   0,   0,   0, 
-     30,   0,  81,  17,  28,  16, 
-      0,   0,   7,   0, 255, 255, 
-    255, 255,   0,   0, 255, 255, 
-    255, 255,  97, 108,  98, 101, 
-    100, 111,  84, 101, 120,   0, 
-      0,   0,  30,   0,  81,  17, 
-     28,  16,   0,   0,   7,   0, 
-    255, 255, 255, 255,   1,   0, 
-    255, 255, 255, 255, 110, 111, 
-    114, 109,  97, 108,  84, 101, 
-    120,   0,   0,   0,  38,   0, 
-     81,  17,  28,  16,   0,   0, 
-      7,   0, 255, 255, 255, 255, 
-      2,   0, 255, 255, 255, 255, 
-    109, 101, 116,  97, 108,  82, 
-    111, 117, 103, 104, 110, 101, 
-    115, 115,  84, 101, 120,   0, 
-      0,   0,  26,   0,  81,  17, 
-     28,  16,   0,   0,   7,   0, 
-    255, 255, 255, 255,   3,   0, 
-    255, 255, 255, 255,  97, 111, 
-     84, 101, 120,   0,   0,   0, 
-     30,   0,  81,  17,  28,  16, 
-      0,   0,   7,   0, 255, 255, 
-    255, 255,   4,   0, 255, 255, 
-    255, 255, 101, 109, 105, 115, 
-    115, 105, 111, 110,  84, 101, 
-    120,   0,  34,   0,  81,  17, 
-     31,  16,   0,   0,   7,   0, 
-    255, 255, 255, 255,   5,   0, 
-    255, 255, 255, 255, 105, 114, 
-    114,  97, 100, 105,  97, 110, 
-     99, 101,  77,  97, 112,   0, 
-      0,   0,  30,   0,  81,  17, 
-     31,  16,   0,   0,   7,   0, 
-    255, 255, 255, 255,   6,   0, 
-    255, 255, 255, 255, 114,  97, 
-    100, 105,  97, 110,  99, 101, 
-     77,  97, 112,   0,  26,   0, 
-     81,  17,  28,  16,   0,   0, 
-      7,   0, 255, 255, 255, 255, 
-      7,   0, 255, 255, 255, 255, 
-     98, 114, 100, 102,  76,  85, 
-     84,   0,  30,   0,  81,  17, 
-     34,  16,   0,   0,   6,   0, 
-    255, 255, 255, 255, 255, 255, 
-      0,   0, 255, 255, 115,  97, 
-    109, 112, 108, 101,  84, 121, 
-    112, 101,   0,   0,  22,   0, 
-     82,  17,  10,  16,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-    255, 255, 255, 255, 255, 255, 
-     80,  73,   0,   0,  26,   0, 
-     81,  17,  35,  16,   0,   0, 
-      8,   0,   1,   0,  64,   0, 
-    255, 255, 255, 255, 255, 255, 
-    101, 121, 101,  80, 111, 115, 
-      0,   0,  34,   0,  81,  17, 
-     37,  16,   0,   0,   8,   0, 
-      3,   0,   0,   0, 255, 255, 
-    255, 255, 255, 255, 108, 105, 
-    103, 104, 116,  80, 111, 115, 
-    105, 116, 105, 111, 110, 115, 
-      0,   0,  30,   0,  81,  17, 
-     37,  16,   0,   0,   8,   0, 
-      3,   0,  64,   0, 255, 255, 
-    255, 255, 255, 255, 108, 105, 
-    103, 104, 116,  67, 111, 108, 
-    111, 114, 115,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-     16,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0, 255, 255, 
-    255, 255,  26,   9,  47, 241, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0, 255, 255, 255, 255, 
-    119,   9,  49,   1,   1,   0, 
-      0,   0,  15,   0,  20, 142, 
-     16,   0,  20, 107,  17,   0, 
-      1,   0,  84,   0,   0,   0, 
-     32,   0,   0,   0,  44,   0, 
-      0,   0, 200,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,  22,   0,   0,   0, 
-     25,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   1,   0, 
-      0,   0,   0,   0,   0,   0, 
-     28,  28,   0,   0,  32,   0, 
-      0,  96,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   2,   0,  11,   0, 
-    176,  44,   0,   0,   0,   0, 
-      0,   0, 240,  26,   0,   0, 
-      3,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,  80,  98, 
-    114,  80, 105, 120, 101, 108, 
-     83, 104,  97, 100, 101, 114, 
-      0, 110, 111, 110, 101,   0, 
-     45, 186,  46, 241,   1,   0, 
-      0,   0,   0,   0,   0,   0, 
-     28,  28,   0,   0,  32,   0, 
-      0,  96,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   2,   0,   2,   0, 
-      7,   0,   0,   0,   0,   0, 
-      1,   0, 255, 255, 255, 255, 
-      0,   0,   0,   0,  28,  28, 
-      0,   0,   8,   2,   0,   0, 
-      0,   0,   0,   0, 255, 255, 
-    255, 255,   0,   0,   0,   0, 
-    255, 255, 255, 255,   1,   0, 
-      3,   0,   0,   0,   3,   0, 
-      0,   0,   0,   0,  59,   0, 
-      0,   0, 113,   0,   0,   0, 
-     69,  58,  92,  80, 114, 111, 
-    106, 101,  99, 116, 115,  92, 
-     78, 105,  99, 107, 101, 108, 
-     92,  78, 105,  99, 107, 101, 
-    108,  92,  68,  97, 116,  97, 
-     92,  83, 104,  97, 100, 101, 
-    114, 115,  92,  80,  98, 114, 
-     80, 105, 120, 101, 108,  83, 
-    104,  97, 100, 101, 114,  46, 
-    104, 108, 115, 108,   0,  69, 
-     58,  92,  80, 114, 111, 106, 
-    101,  99, 116, 115,  92,  78, 
-    105,  99, 107, 101, 108,  92, 
-     78, 105,  99, 107, 101, 108, 
-     92,  68,  97, 116,  97,  92, 
-     83, 104,  97, 100, 101, 114, 
-    115,  92,  80,  98, 114,  72, 
-    101, 108, 112, 101, 114,  46, 
-    104, 108, 115, 108,   0,  69, 
-     58,  92,  80, 114, 111, 106, 
-    101,  99, 116, 115,  92,  78, 
-    105,  99, 107, 101, 108,  92, 
-     78, 105,  99, 107, 101, 108, 
-     92,  68,  97, 116,  97,  92, 
-     83, 104,  97, 100, 101, 114, 
-    115,  92,  67, 111, 109, 109, 
-    111, 110,  67, 111, 110, 115, 
-    116,  97, 110, 116,  66, 117, 
-    102, 102, 101, 114, 115,  46, 
-    104, 108, 115, 108,   0,   0, 
-    254, 239, 254, 239,   1,   0, 
-      0,   0,   1,   0,   0,   0, 
-      0,   1,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255,  14, 
-      0, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0, 148,  46, 
-     49,   1, 216, 200, 147,  97, 
-      1,   0,   0,   0,  23, 224, 
-      0, 135, 254,  38, 233,  64, 
-    178,  60,   3, 229, 101,  83, 
-    229,  26, 246,   0,   0,   0, 
-     47,  76, 105, 110, 107,  73, 
-    110, 102, 111,   0,  47, 110, 
-     97, 109, 101, 115,   0,  47, 
-    115, 114,  99,  47, 104, 101, 
-     97, 100, 101, 114,  98, 108, 
-    111,  99, 107,   0,  47, 115, 
-    114,  99,  47, 102, 105, 108, 
-    101, 115,  47, 101,  58,  92, 
-    112, 114, 111, 106, 101,  99, 
-    116, 115,  92, 110, 105,  99, 
-    107, 101, 108,  92, 110, 105, 
-     99, 107, 101, 108,  92, 100, 
-     97, 116,  97,  92, 115, 104, 
-     97, 100, 101, 114, 115,  92, 
-    112,  98, 114, 112, 105, 120, 
-    101, 108, 115, 104,  97, 100, 
-    101, 114,  46, 104, 108, 115, 
-    108,   0,  47, 115, 114,  99, 
-     47, 102, 105, 108, 101, 115, 
-     47, 101,  58,  92, 112, 114, 
-    111, 106, 101,  99, 116, 115, 
-     92, 110, 105,  99, 107, 101, 
-    108,  92, 110, 105,  99, 107, 
-    101, 108,  92, 100,  97, 116, 
-     97,  92, 115, 104,  97, 100, 
-    101, 114, 115,  92, 112,  98, 
-    114, 104, 101, 108, 112, 101, 
-    114,  46, 104, 108, 115, 108, 
-      0,  47, 115, 114,  99,  47, 
-    102, 105, 108, 101, 115,  47, 
-    101,  58,  92, 112, 114, 111, 
-    106, 101,  99, 116, 115,  92, 
-    110, 105,  99, 107, 101, 108, 
-     92, 110, 105,  99, 107, 101, 
-    108,  92, 100,  97, 116,  97, 
-     92, 115, 104,  97, 100, 101, 
-    114, 115,  92,  99, 111, 109, 
-    109, 111, 110,  99, 111, 110, 
-    115, 116,  97, 110, 116,  98, 
-    117, 102, 102, 101, 114, 115, 
-     46, 104, 108, 115, 108,   0, 
-      6,   0,   0,   0,  10,   0, 
-      0,   0,   1,   0,   0,   0, 
-     62,   2,   0,   0,   0,   0, 
-      0,   0,  17,   0,   0,   0, 
-      7,   0,   0,   0,   0,   0, 
-      0,   0,   5,   0,   0,   0, 
-    104,   0,   0,   0,   9,   0, 
-      0,   0, 169,   0,   0,   0, 
-     10,   0,   0,   0,  10,   0, 
-      0,   0,   6,   0,   0,   0, 
-     34,   0,   0,   0,   8,   0, 
-      0,   0,   0,   0,   0,   0, 
-    220,  81,  51,   1,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-     18,   0,   0,   0,  32,   0, 
-      0,   0,  98,   1,   0,   0, 
-    228,   2,   0,   0, 215,   1, 
-      0,   0,  36,   1,   0,   0, 
-      0,   0,   0,   0, 192,  27, 
-      0,   0, 216,   0,   0,   0, 
-    224,  18,   0,   0, 224,   5, 
-      0,   0,  61,   1,   0,   0, 
-    220,  71,   0,   0, 160,   0, 
-      0,   0,  40,   0,   0,   0, 
-     40,   0,   0,   0, 188,   2, 
-      0,   0,  44,   0,   0,   0, 
-    188,   1,   0,   0,   3,   0, 
-      0,   0,  82,   0,   0,   0, 
-     61,   0,   0,   0,  60,   0, 
-      0,   0,  81,   0,   0,   0, 
-     75,   0,   0,   0,  22,   0, 
-      0,   0,   6,   0,   0,   0, 
-     63,   0,   0,   0,  64,   0, 
-      0,   0,  65,   0,   0,   0, 
-     66,   0,   0,   0,  67,   0, 
-      0,   0,  68,   0,   0,   0, 
-     69,   0,   0,   0,  70,   0, 
-      0,   0,  71,   0,   0,   0, 
-     72,   0,   0,   0,  73,   0, 
-      0,   0,  74,   0,   0,   0, 
-     23,   0,   0,   0,   8,   0, 
-      0,   0,   9,   0,   0,   0, 
-     10,   0,   0,   0,  11,   0, 
-      0,   0,  12,   0,   0,   0, 
-     13,   0,   0,   0,  14,   0, 
-      0,   0,  15,   0,   0,   0, 
-     16,   0,   0,   0,  17,   0, 
-      0,   0,  18,   0,   0,   0, 
-     19,   0,   0,   0,  20,   0, 
-      0,   0,  21,   0,   0,   0, 
-     24,   0,   0,   0,  25,   0, 
-      0,   0,  26,   0,   0,   0, 
-     27,   0,   0,   0,  28,   0, 
-      0,   0,  29,   0,   0,   0, 
-     30,   0,   0,   0,  31,   0, 
-      0,   0,  32,   0,   0,   0, 
-     33,   0,   0,   0,  34,   0, 
-      0,   0,  35,   0,   0,   0, 
-     36,   0,   0,   0,  37,   0, 
-      0,   0,  38,   0,   0,   0, 
-     39,   0,   0,   0,  40,   0, 
-      0,   0,  41,   0,   0,   0, 
-     42,   0,   0,   0,  43,   0, 
-      0,   0,  44,   0,   0,   0, 
-     45,   0,   0,   0,  46,   0, 
-      0,   0,  47,   0,   0,   0, 
-     48,   0,   0,   0,  49,   0, 
-      0,   0,  50,   0,   0,   0, 
-     51,   0,   0,   0,  52,   0, 
-      0,   0,  53,   0,   0,   0, 
-     54,   0,   0,   0,  55,   0, 
-      0,   0,  56,   0,   0,   0, 
-     57,   0,   0,   0,  58,   0, 
-      0,   0,  59,   0,   0,   0, 
-      7,   0,   0,   0,  62,   0, 
-      0,   0,  76,   0,   0,   0, 
-     77,   0,   0,   0,  78,   0, 
-      0,   0,  80,   0,   0,   0, 
-     79,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,  83,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0
-};
@@ -1,3090 +0,0 @@
-#if 0
-//
-// Generated by Microsoft (R) HLSL Shader Compiler 10.1
-//
-//
-// Buffer Definitions: 
-//
-// cbuffer PerFrame
-// {
-//
-//   float4x4 viewMatrix;               // Offset:    0 Size:    64 [unused]
-//   float3 eyePos;                     // Offset:   64 Size:    12
-//   float3 lightPos;                   // Offset:   80 Size:    12
-//
-// }
-//
-// cbuffer PerObject
-// {
-//
-//   float4x4 modelMatrix;              // Offset:    0 Size:    64
-//   float4x4 viewProjectionMatrix;     // Offset:   64 Size:    64 [unused]
-//   float4x4 modelViewProjectionMatrix;// Offset:  128 Size:    64
-//
-// }
-//
-//
-// Resource Bindings:
-//
-// Name                                 Type  Format         Dim      HLSL Bind  Count
-// ------------------------------ ---------- ------- ----------- -------------- ------
-// PerFrame                          cbuffer      NA          NA            cb1      1 
-// PerObject                         cbuffer      NA          NA            cb2      1 
-//
-//
-//
-// Input signature:
-//
-// Name                 Index   Mask Register SysValue  Format   Used
-// -------------------- ----- ------ -------- -------- ------- ------
-// POSITION                 0   xyz         0     NONE   float   xyz 
-// NORMAL                   0   xyz         1     NONE   float   xyz 
-// COLOR                    0   xyz         2     NONE   float   xyz 
-//
-//
-// Output signature:
-//
-// Name                 Index   Mask Register SysValue  Format   Used
-// -------------------- ----- ------ -------- -------- ------- ------
-// WORLD_POSITION           0   xyz         0     NONE   float   xyz 
-// NORMAL                   0   xyz         1     NONE   float   xyz 
-// COLOR                    0   xyzw        2     NONE   float   xyzw
-// VIEW                     0   xyz         3     NONE   float   xyz 
-// LIGHT                    0   xyz         4     NONE   float   xyz 
-// SV_POSITION              0   xyzw        5      POS   float   xyzw
-//
-vs_5_0
-dcl_globalFlags refactoringAllowed | skipOptimization
-dcl_constantbuffer CB1[6], immediateIndexed
-dcl_constantbuffer CB2[12], immediateIndexed
-dcl_input v0.xyz
-dcl_input v1.xyz
-dcl_input v2.xyz
-dcl_output o0.xyz
-dcl_output o1.xyz
-dcl_output o2.xyzw
-dcl_output o3.xyz
-dcl_output o4.xyz
-dcl_output_siv o5.xyzw, position
-dcl_temps 6
-//
-// Initial variable locations:
-//   v0.x <- IN.position.x; v0.y <- IN.position.y; v0.z <- IN.position.z; 
-//   v1.x <- IN.normal.x; v1.y <- IN.normal.y; v1.z <- IN.normal.z; 
-//   v2.x <- IN.color.x; v2.y <- IN.color.y; v2.z <- IN.color.z; 
-//   o5.x <- <SimpleVertexShader return value>.position.x; o5.y <- <SimpleVertexShader return value>.position.y; o5.z <- <SimpleVertexShader return value>.position.z; o5.w <- <SimpleVertexShader return value>.position.w; 
-//   o4.x <- <SimpleVertexShader return value>.light.x; o4.y <- <SimpleVertexShader return value>.light.y; o4.z <- <SimpleVertexShader return value>.light.z; 
-//   o3.x <- <SimpleVertexShader return value>.view.x; o3.y <- <SimpleVertexShader return value>.view.y; o3.z <- <SimpleVertexShader return value>.view.z; 
-//   o2.x <- <SimpleVertexShader return value>.color.x; o2.y <- <SimpleVertexShader return value>.color.y; o2.z <- <SimpleVertexShader return value>.color.z; o2.w <- <SimpleVertexShader return value>.color.w; 
-//   o1.x <- <SimpleVertexShader return value>.normal.x; o1.y <- <SimpleVertexShader return value>.normal.y; o1.z <- <SimpleVertexShader return value>.normal.z; 
-//   o0.x <- <SimpleVertexShader return value>.worldPos.x; o0.y <- <SimpleVertexShader return value>.worldPos.y; o0.z <- <SimpleVertexShader return value>.worldPos.z
-//
-#line 24 "E:\Projects\Nickel\Nickel\Data\Shaders\SimpleVertexShader.hlsl"
-mov r0.xyz, v0.xyzx
-mov r0.w, l(1.000000)
-dp4 r1.x, r0.xyzw, cb2[8].xyzw  // r1.x <- OUT.position.x
-dp4 r1.y, r0.xyzw, cb2[9].xyzw  // r1.y <- OUT.position.y
-dp4 r1.z, r0.xyzw, cb2[10].xyzw  // r1.z <- OUT.position.z
-dp4 r1.w, r0.xyzw, cb2[11].xyzw  // r1.w <- OUT.position.w
-
-#line 25
-dp4 r2.x, r0.xyzw, cb2[0].xyzw  // r2.x <- OUT.worldPos.x
-dp4 r2.y, r0.xyzw, cb2[1].xyzw  // r2.y <- OUT.worldPos.y
-dp4 r2.z, r0.xyzw, cb2[2].xyzw  // r2.z <- OUT.worldPos.z
-
-#line 28
-dp3 r0.x, v1.xyzx, v1.xyzx
-rsq r0.x, r0.x
-mul r0.xyz, r0.xxxx, v1.xyzx  // r0.x <- OUT.normal.x; r0.y <- OUT.normal.y; r0.z <- OUT.normal.z
-
-#line 31
-mov r3.xyz, v2.xyzx  // r3.x <- OUT.color.x; r3.y <- OUT.color.y; r3.z <- OUT.color.z
-mov r3.w, l(1.000000)  // r3.w <- OUT.color.w
-
-#line 35
-mov r4.xyz, cb1[4].xyzx  // r4.x <- OUT.view.x; r4.y <- OUT.view.y; r4.z <- OUT.view.z
-
-#line 36
-mov r5.xyz, cb1[5].xyzx  // r5.x <- OUT.light.x; r5.y <- OUT.light.y; r5.z <- OUT.light.z
-
-#line 38
-mov o2.xyzw, r3.xyzw
-mov o5.xyzw, r1.xyzw
-mov o0.xyz, r2.xyzx
-mov o1.xyz, r0.xyzx
-mov o3.xyz, r4.xyzx
-mov o4.xyz, r5.xyzx
-ret 
-// Approximately 23 instruction slots used
-#endif
-
-const BYTE g_SimpleVertexShader[] =
-{
-     68,  88,  66,  67, 232,  41, 
-    138, 234, 114, 137, 229, 113, 
-     95,   9, 110, 206,  47,  11, 
-     90,  49,   1,   0,   0,   0, 
-    136,  69,   0,   0,   6,   0, 
-      0,   0,  56,   0,   0,   0, 
-    204,   2,   0,   0,  60,   3, 
-      0,   0,  16,   4,   0,   0, 
-    228,   6,   0,   0, 128,   7, 
-      0,   0,  82,  68,  69,  70, 
-    140,   2,   0,   0,   2,   0, 
-      0,   0, 144,   0,   0,   0, 
-      2,   0,   0,   0,  60,   0, 
-      0,   0,   0,   5, 254, 255, 
-      5,   1,   0,   0,  99,   2, 
-      0,   0,  82,  68,  49,  49, 
-     60,   0,   0,   0,  24,   0, 
-      0,   0,  32,   0,   0,   0, 
-     40,   0,   0,   0,  36,   0, 
-      0,   0,  12,   0,   0,   0, 
-      0,   0,   0,   0, 124,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      1,   0,   0,   0,   1,   0, 
-      0,   0,   1,   0,   0,   0, 
-    133,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   2,   0,   0,   0, 
-      1,   0,   0,   0,   1,   0, 
-      0,   0,  80, 101, 114,  70, 
-    114,  97, 109, 101,   0,  80, 
-    101, 114,  79,  98, 106, 101, 
-     99, 116,   0, 171, 124,   0, 
-      0,   0,   3,   0,   0,   0, 
-    192,   0,   0,   0,  96,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0, 133,   0, 
-      0,   0,   3,   0,   0,   0, 
-    176,   1,   0,   0, 192,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,  56,   1, 
-      0,   0,   0,   0,   0,   0, 
-     64,   0,   0,   0,   0,   0, 
-      0,   0,  76,   1,   0,   0, 
-      0,   0,   0,   0, 255, 255, 
-    255, 255,   0,   0,   0,   0, 
-    255, 255, 255, 255,   0,   0, 
-      0,   0, 112,   1,   0,   0, 
-     64,   0,   0,   0,  12,   0, 
-      0,   0,   2,   0,   0,   0, 
-    128,   1,   0,   0,   0,   0, 
-      0,   0, 255, 255, 255, 255, 
-      0,   0,   0,   0, 255, 255, 
-    255, 255,   0,   0,   0,   0, 
-    164,   1,   0,   0,  80,   0, 
-      0,   0,  12,   0,   0,   0, 
-      2,   0,   0,   0, 128,   1, 
-      0,   0,   0,   0,   0,   0, 
-    255, 255, 255, 255,   0,   0, 
-      0,   0, 255, 255, 255, 255, 
-      0,   0,   0,   0, 118, 105, 
-    101, 119,  77,  97, 116, 114, 
-    105, 120,   0, 102, 108, 111, 
-     97, 116,  52, 120,  52,   0, 
-      3,   0,   3,   0,   4,   0, 
-      4,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,  67,   1,   0,   0, 
-    101, 121, 101,  80, 111, 115, 
-      0, 102, 108, 111,  97, 116, 
-     51,   0, 171, 171,   1,   0, 
-      3,   0,   1,   0,   3,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-    119,   1,   0,   0, 108, 105, 
-    103, 104, 116,  80, 111, 115, 
-      0, 171, 171, 171,  40,   2, 
-      0,   0,   0,   0,   0,   0, 
-     64,   0,   0,   0,   2,   0, 
-      0,   0,  76,   1,   0,   0, 
-      0,   0,   0,   0, 255, 255, 
-    255, 255,   0,   0,   0,   0, 
-    255, 255, 255, 255,   0,   0, 
-      0,   0,  52,   2,   0,   0, 
-     64,   0,   0,   0,  64,   0, 
-      0,   0,   0,   0,   0,   0, 
-     76,   1,   0,   0,   0,   0, 
-      0,   0, 255, 255, 255, 255, 
-      0,   0,   0,   0, 255, 255, 
-    255, 255,   0,   0,   0,   0, 
-     73,   2,   0,   0, 128,   0, 
-      0,   0,  64,   0,   0,   0, 
-      2,   0,   0,   0,  76,   1, 
-      0,   0,   0,   0,   0,   0, 
-    255, 255, 255, 255,   0,   0, 
-      0,   0, 255, 255, 255, 255, 
-      0,   0,   0,   0, 109, 111, 
-    100, 101, 108,  77,  97, 116, 
-    114, 105, 120,   0, 118, 105, 
-    101, 119,  80, 114, 111, 106, 
-    101,  99, 116, 105, 111, 110, 
-     77,  97, 116, 114, 105, 120, 
-      0, 109, 111, 100, 101, 108, 
-     86, 105, 101, 119,  80, 114, 
-    111, 106, 101,  99, 116, 105, 
-    111, 110,  77,  97, 116, 114, 
-    105, 120,   0,  77, 105,  99, 
-    114, 111, 115, 111, 102, 116, 
-     32,  40,  82,  41,  32,  72, 
-     76,  83,  76,  32,  83, 104, 
-     97, 100, 101, 114,  32,  67, 
-    111, 109, 112, 105, 108, 101, 
-    114,  32,  49,  48,  46,  49, 
-      0, 171,  73,  83,  71,  78, 
-    104,   0,   0,   0,   3,   0, 
-      0,   0,   8,   0,   0,   0, 
-     80,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      3,   0,   0,   0,   0,   0, 
-      0,   0,   7,   7,   0,   0, 
-     89,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      3,   0,   0,   0,   1,   0, 
-      0,   0,   7,   7,   0,   0, 
-     96,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      3,   0,   0,   0,   2,   0, 
-      0,   0,   7,   7,   0,   0, 
-     80,  79,  83,  73,  84,  73, 
-     79,  78,   0,  78,  79,  82, 
-     77,  65,  76,   0,  67,  79, 
-     76,  79,  82,   0, 171, 171, 
-     79,  83,  71,  78, 204,   0, 
-      0,   0,   6,   0,   0,   0, 
-      8,   0,   0,   0, 152,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   3,   0, 
-      0,   0,   0,   0,   0,   0, 
-      7,   8,   0,   0, 167,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   3,   0, 
-      0,   0,   1,   0,   0,   0, 
-      7,   8,   0,   0, 174,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   3,   0, 
-      0,   0,   2,   0,   0,   0, 
-     15,   0,   0,   0, 180,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   3,   0, 
-      0,   0,   3,   0,   0,   0, 
-      7,   8,   0,   0, 185,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   3,   0, 
-      0,   0,   4,   0,   0,   0, 
-      7,   8,   0,   0, 191,   0, 
-      0,   0,   0,   0,   0,   0, 
-      1,   0,   0,   0,   3,   0, 
-      0,   0,   5,   0,   0,   0, 
-     15,   0,   0,   0,  87,  79, 
-     82,  76,  68,  95,  80,  79, 
-     83,  73,  84,  73,  79,  78, 
-      0,  78,  79,  82,  77,  65, 
-     76,   0,  67,  79,  76,  79, 
-     82,   0,  86,  73,  69,  87, 
-      0,  76,  73,  71,  72,  84, 
-      0,  83,  86,  95,  80,  79, 
-     83,  73,  84,  73,  79,  78, 
-      0, 171,  83,  72,  69,  88, 
-    204,   2,   0,   0,  80,   0, 
-      1,   0, 179,   0,   0,   0, 
-    106, 136,   0,   1,  89,   0, 
-      0,   4,  70, 142,  32,   0, 
-      1,   0,   0,   0,   6,   0, 
-      0,   0,  89,   0,   0,   4, 
-     70, 142,  32,   0,   2,   0, 
-      0,   0,  12,   0,   0,   0, 
-     95,   0,   0,   3, 114,  16, 
-     16,   0,   0,   0,   0,   0, 
-     95,   0,   0,   3, 114,  16, 
-     16,   0,   1,   0,   0,   0, 
-     95,   0,   0,   3, 114,  16, 
-     16,   0,   2,   0,   0,   0, 
-    101,   0,   0,   3, 114,  32, 
-     16,   0,   0,   0,   0,   0, 
-    101,   0,   0,   3, 114,  32, 
-     16,   0,   1,   0,   0,   0, 
-    101,   0,   0,   3, 242,  32, 
-     16,   0,   2,   0,   0,   0, 
-    101,   0,   0,   3, 114,  32, 
-     16,   0,   3,   0,   0,   0, 
-    101,   0,   0,   3, 114,  32, 
-     16,   0,   4,   0,   0,   0, 
-    103,   0,   0,   4, 242,  32, 
-     16,   0,   5,   0,   0,   0, 
-      1,   0,   0,   0, 104,   0, 
-      0,   2,   6,   0,   0,   0, 
-     54,   0,   0,   5, 114,   0, 
-     16,   0,   0,   0,   0,   0, 
-     70,  18,  16,   0,   0,   0, 
-      0,   0,  54,   0,   0,   5, 
-    130,   0,  16,   0,   0,   0, 
-      0,   0,   1,  64,   0,   0, 
-      0,   0, 128,  63,  17,   0, 
-      0,   8,  18,   0,  16,   0, 
-      1,   0,   0,   0,  70,  14, 
-     16,   0,   0,   0,   0,   0, 
-     70, 142,  32,   0,   2,   0, 
-      0,   0,   8,   0,   0,   0, 
-     17,   0,   0,   8,  34,   0, 
-     16,   0,   1,   0,   0,   0, 
-     70,  14,  16,   0,   0,   0, 
-      0,   0,  70, 142,  32,   0, 
-      2,   0,   0,   0,   9,   0, 
-      0,   0,  17,   0,   0,   8, 
-     66,   0,  16,   0,   1,   0, 
-      0,   0,  70,  14,  16,   0, 
-      0,   0,   0,   0,  70, 142, 
-     32,   0,   2,   0,   0,   0, 
-     10,   0,   0,   0,  17,   0, 
-      0,   8, 130,   0,  16,   0, 
-      1,   0,   0,   0,  70,  14, 
-     16,   0,   0,   0,   0,   0, 
-     70, 142,  32,   0,   2,   0, 
-      0,   0,  11,   0,   0,   0, 
-     17,   0,   0,   8,  18,   0, 
-     16,   0,   2,   0,   0,   0, 
-     70,  14,  16,   0,   0,   0, 
-      0,   0,  70, 142,  32,   0, 
-      2,   0,   0,   0,   0,   0, 
-      0,   0,  17,   0,   0,   8, 
-     34,   0,  16,   0,   2,   0, 
-      0,   0,  70,  14,  16,   0, 
-      0,   0,   0,   0,  70, 142, 
-     32,   0,   2,   0,   0,   0, 
-      1,   0,   0,   0,  17,   0, 
-      0,   8,  66,   0,  16,   0, 
-      2,   0,   0,   0,  70,  14, 
-     16,   0,   0,   0,   0,   0, 
-     70, 142,  32,   0,   2,   0, 
-      0,   0,   2,   0,   0,   0, 
-     16,   0,   0,   7,  18,   0, 
-     16,   0,   0,   0,   0,   0, 
-     70,  18,  16,   0,   1,   0, 
-      0,   0,  70,  18,  16,   0, 
-      1,   0,   0,   0,  68,   0, 
-      0,   5,  18,   0,  16,   0, 
-      0,   0,   0,   0,  10,   0, 
-     16,   0,   0,   0,   0,   0, 
-     56,   0,   0,   7, 114,   0, 
-     16,   0,   0,   0,   0,   0, 
-      6,   0,  16,   0,   0,   0, 
-      0,   0,  70,  18,  16,   0, 
-      1,   0,   0,   0,  54,   0, 
-      0,   5, 114,   0,  16,   0, 
-      3,   0,   0,   0,  70,  18, 
-     16,   0,   2,   0,   0,   0, 
-     54,   0,   0,   5, 130,   0, 
-     16,   0,   3,   0,   0,   0, 
-      1,  64,   0,   0,   0,   0, 
-    128,  63,  54,   0,   0,   6, 
-    114,   0,  16,   0,   4,   0, 
-      0,   0,  70, 130,  32,   0, 
-      1,   0,   0,   0,   4,   0, 
-      0,   0,  54,   0,   0,   6, 
-    114,   0,  16,   0,   5,   0, 
-      0,   0,  70, 130,  32,   0, 
-      1,   0,   0,   0,   5,   0, 
-      0,   0,  54,   0,   0,   5, 
-    242,  32,  16,   0,   2,   0, 
-      0,   0,  70,  14,  16,   0, 
-      3,   0,   0,   0,  54,   0, 
-      0,   5, 242,  32,  16,   0, 
-      5,   0,   0,   0,  70,  14, 
-     16,   0,   1,   0,   0,   0, 
-     54,   0,   0,   5, 114,  32, 
-     16,   0,   0,   0,   0,   0, 
-     70,   2,  16,   0,   2,   0, 
-      0,   0,  54,   0,   0,   5, 
-    114,  32,  16,   0,   1,   0, 
-      0,   0,  70,   2,  16,   0, 
-      0,   0,   0,   0,  54,   0, 
-      0,   5, 114,  32,  16,   0, 
-      3,   0,   0,   0,  70,   2, 
-     16,   0,   4,   0,   0,   0, 
-     54,   0,   0,   5, 114,  32, 
-     16,   0,   4,   0,   0,   0, 
-     70,   2,  16,   0,   5,   0, 
-      0,   0,  62,   0,   0,   1, 
-     83,  84,  65,  84, 148,   0, 
-      0,   0,  23,   0,   0,   0, 
-      6,   0,   0,   0,   0,   0, 
-      0,   0,   9,   0,   0,   0, 
-     10,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      1,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-     12,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-     83,  80,  68,  66,   0,  62, 
-      0,   0,  77, 105,  99, 114, 
-    111, 115, 111, 102, 116,  32, 
-     67,  47,  67,  43,  43,  32, 
-     77,  83,  70,  32,  55,  46, 
-     48,  48,  13,  10,  26,  68, 
-     83,   0,   0,   0,   0,   2, 
-      0,   0,   2,   0,   0,   0, 
-     31,   0,   0,   0, 168,   0, 
-      0,   0,   0,   0,   0,   0, 
-     30,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0, 192, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-     56,   0,   0, 128, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255,   5,   0,   0,   0, 
-     32,   0,   0,   0,  60,   0, 
-      0,   0,   0,   0,   0,   0, 
-    255, 255, 255, 255,   0,   0, 
-      0,   0,   6,   0,   0,   0, 
-      5,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   3,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-    148,  46,  49,   1,  41, 162, 
-    146,  97,   1,   0,   0,   0, 
-     37, 101,  94,  85, 208, 107, 
-     76,  71, 182, 148,  10, 209, 
-    173, 204, 249,  99,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      1,   0,   0,   0,   1,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0, 220,  81,  51,   1, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,  65,  76,  59,  13, 
-     10,   9, 102, 108, 111,  97, 
-    116,  52,  32,  99, 111, 108, 
-    111, 114,  32,  58,  32,  67, 
-     79,  76,  79,  82,  59,  13, 
-     10,   9, 102, 108, 111,  97, 
-    116,  51,  32, 118, 105, 101, 
-    119,  32,  58,  32,  86,  73, 
-     69,  87,  59,  13,  10,   9, 
-    102, 108, 111,  97, 116,  51, 
-     32, 108, 105, 103, 104, 116, 
-     32,  58,  32,  76,  73,  71, 
-     72,  84,  59,  13,  10,   9, 
-    102, 108, 111,  97, 116,  52, 
-     32, 112, 111, 115, 105, 116, 
-    105, 111, 110,  32,  58,  32, 
-     83,  86,  95,  80,  79,  83, 
-     73,  84,  73,  79,  78,  59, 
-     13,  10, 125,  59,  13,  10, 
-     13,  10,  86, 101, 114, 116, 
-    101, 120,  83, 104,  97, 100, 
-    101, 114,  79, 117, 116, 112, 
-    117, 116,  32,  83, 105, 109, 
-    112, 108, 101,  86, 101, 114, 
-    116, 101, 120,  83, 104,  97, 
-    100, 101, 114,  40,  86, 101, 
-    114, 116, 101, 120,  68,  97, 
-    116,  97,  32,  73,  78,  32, 
-     41,  13,  10, 123,  13,  10, 
-     32,  32,  32,  32,  86, 101, 
-    114, 116, 101, 120,  83, 104, 
-     97, 100, 101, 114,  79, 117, 
-    116, 112, 117, 116,  32,  79, 
-     85,  84,  59,  13,  10,  13, 
-     10,  32,  32,  32,  32,  79, 
-     85,  84,  46, 112, 111, 115, 
-    105, 116, 105, 111, 110,  32, 
-     61,  32, 109, 117, 108,  40, 
-    102, 108, 111,  97, 116,  52, 
-     40,  73,  78,  46, 112, 111, 
-    115, 105, 116, 105, 111, 110, 
-     44,  32,  49,  46,  48, 102, 
-     41,  44,  32, 109, 111, 100, 
-    101, 108,  86, 105, 101, 119, 
-     80, 114, 111, 106, 101,  99, 
-    116, 105, 111, 110,  77,  97, 
-    116, 114, 105, 120,  41,  59, 
-     13,  10,   9,  79,  85,  84, 
-     46, 119, 111, 114, 108, 100, 
-     80, 111, 115,  32,  61,  32, 
-    109, 117, 108,  40, 102, 108, 
-    111,  97, 116,  52,  40,  73, 
-     78,  46, 112, 111, 115, 105, 
-    116, 105, 111, 110,  44,  32, 
-     49,  46,  48, 102,  41,  44, 
-     32, 109, 111, 100, 101, 108, 
-     77,  97, 116, 114, 105, 120, 
-     41,  46, 120, 121, 122,  59, 
-     13,  10,  13,  10,   9,  79, 
-     85,  84,  46, 110, 111, 114, 
-    109,  97, 108,  32,  61,  32, 
-    109, 117, 108,  40,  73,  78, 
-     46, 110, 111, 114, 109,  97, 
-    108,  44,  32,  40, 102, 108, 
-    111,  97, 116,  51, 120,  51, 
-     41, 109, 111, 100, 101, 108, 
-     77,  97, 116, 114, 105, 120, 
-     41,  59,  32,  47,  47,  32, 
-    119, 111, 114, 108, 100,  32, 
-    115, 112,  97,  99, 101,  32, 
-    110, 111, 114, 109,  97, 108, 
-     13,  10,   9,  79,  85,  84, 
-     46, 110, 111, 114, 109,  97, 
-    108,  32,  61,  32, 110, 111, 
-    114, 109,  97, 108, 105, 122, 
-    101,  40,  73,  78,  46, 110, 
-    111, 114, 109,  97, 108,  41, 
-     59,  13,  10,   9,  47,  47, 
-     79,  85,  84,  46, 110, 111, 
-    114, 109,  97, 108,  46, 122, 
-     32,  61,  32,  45,  79,  85, 
-     84,  46, 110, 111, 114, 109, 
-     97, 108,  46, 122,  59,  13, 
-     10,  13,  10,   9,  79,  85, 
-     84,  46,  99, 111, 108, 111, 
-    114,  32,  61,  32,  76, 232, 
-      3,   0,  43, 125,   2,   0, 
-    228, 252,   0,   0,  30, 194, 
-      2,   0, 198,  90,   0,   0, 
-    212, 200,   0,   0, 221, 143, 
-      3,   0,  49, 251,   3,   0, 
-    138, 183,   3,   0,  65,  36, 
-      1,   0, 125, 181,   2,   0, 
-    103, 159,   1,   0, 193,  33, 
-      3,   0,  65, 185,   2,   0, 
-      0,  16,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-     35, 105, 110,  99, 108, 117, 
-    100, 101,  32,  34,  67, 111, 
-    109, 109, 111, 110,  67, 111, 
-    110, 115, 116,  97, 110, 116, 
-     66, 117, 102, 102, 101, 114, 
-    115,  46, 104, 108, 115, 108, 
-     34,  13,  10,  13,  10, 115, 
-    116, 114, 117,  99, 116,  32, 
-     86, 101, 114, 116, 101, 120, 
-     68,  97, 116,  97,  13,  10, 
-    123,  13,  10,  32,  32,  32, 
-     32, 102, 108, 111,  97, 116, 
-     51,  32, 112, 111, 115, 105, 
-    116, 105, 111, 110,  32,  58, 
-     32,  80,  79,  83,  73,  84, 
-     73,  79,  78,  59,  13,  10, 
-      9, 102, 108, 111,  97, 116, 
-     51,  32, 110, 111, 114, 109, 
-     97, 108,  58,  32,  78,  79, 
-     82,  77,  65,  76,  59,  13, 
-     10,  32,  32,  32,  32, 102, 
-    108, 111,  97, 116,  51,  32, 
-     99, 111, 108, 111, 114,  58, 
-     32,  67,  79,  76,  79,  82, 
-     59,  13,  10, 125,  59,  13, 
-     10,  13,  10, 115, 116, 114, 
-    117,  99, 116,  32,  86, 101, 
-    114, 116, 101, 120,  83, 104, 
-     97, 100, 101, 114,  79, 117, 
-    116, 112, 117, 116,  13,  10, 
-    123,  13,  10,   9, 102, 108, 
-    111,  97, 116,  51,  32, 119, 
-    111, 114, 108, 100,  80, 111, 
-    115,  32,  58,  32,  87,  79, 
-     82,  76,  68,  95,  80,  79, 
-     83,  73,  84,  73,  79,  78, 
-     59,  13,  10,   9, 102, 108, 
-    111,  97, 116,  51,  32, 110, 
-    111, 114, 109,  97, 108,  32, 
-     58,  32,  78,  79,  82,  77, 
-     65,  76,  59,  13,  10,   9, 
-    102, 108, 111,  97, 116,  52, 
-     32,  99, 111, 108, 111, 114, 
-     32,  58,  32,  67,  79,  76, 
-     79,  82,  59,  13,  10,   9, 
-    102, 108, 111,  97, 116,  51, 
-     32, 118, 105, 101, 119,  32, 
-     58,  32,  86,  73,  69,  87, 
-     59,  13,  10,   9, 102, 108, 
-    111,  97, 116,  51,  32, 108, 
-    105, 103, 104, 116,  32,  58, 
-     32,  76,  73,  71,  72,  84, 
-     59,  13,  10,   9, 102, 108, 
-    111,  97, 116,  52,  32, 112, 
-    111, 115, 105, 116, 105, 111, 
-    110,  32,  58,  32,  83,  86, 
-     95,  80,  79,  83,  73,  84, 
-     73,  79,  78,  59,  13,  10, 
-    125,  59,  13,  10,  13,  10, 
-     86, 101, 114, 116, 101, 120, 
-     83, 104,  97, 100, 101, 114, 
-     79, 117, 116, 112, 117, 116, 
-     32,  83, 105, 109, 112, 108, 
-    101,  86, 101, 114, 116, 101, 
-    120,  83, 104,  97, 100, 101, 
-    114,  40,  86, 101, 114, 116, 
-    101, 120,  68,  97, 116,  97, 
-     32,  73,  78,  32,  41,  13, 
-     10, 123,  13,  10,  32,  32, 
-     32,  32,  86, 101, 114, 116, 
-    101, 120,  83, 104,  97, 100, 
-    101, 114,  79, 117, 116, 112, 
-    117, 116,  32,  79,  85,  84, 
-     59,  13,  10,  13,  10,  32, 
-     32,  32,  32,  79,  85,  84, 
-     46, 112, 111, 115, 105, 116, 
-    105, 111, 110,  32,  61,  32, 
-    109, 117, 108,  40, 102, 108, 
-    111,  97, 116,  52,  40,  73, 
-     78,  46, 112, 111, 115, 105, 
-    116, 105, 111, 110,  44,  32, 
-     49,  46,  48, 102,  41,  44, 
-     32, 109, 111, 100, 101, 108, 
-     86, 105, 101, 119,  80, 114, 
-    111, 106, 101,  99, 116, 105, 
-    111, 110,  77,  97, 116, 114, 
-    105, 120,  41,  59,  13,  10, 
-      9,  79,  85,  84,  46, 119, 
-    111, 114, 108, 100,  80, 111, 
-    115,  32,  61,  32, 109, 117, 
-    108,  40, 102, 108, 111,  97, 
-    116,  52,  40,  73,  78,  46, 
-    112, 111, 115, 105, 116, 105, 
-    111, 110,  44,  32,  49,  46, 
-     48, 102,  41,  44,  32, 109, 
-    111, 100, 101, 108,  77,  97, 
-    116, 114, 105, 120,  41,  46, 
-    120, 121, 122,  59,  13,  10, 
-     13,  10,   9,  79,  85,  84, 
-     46, 110, 111, 114, 109,  97, 
-    108,  32,  61,  32, 109, 117, 
-    108,  40,  73,  78,  46, 110, 
-    111, 114, 109,  97, 108,  44, 
-     32,  40, 102, 108, 111,  97, 
-    116,  51, 120,  51,  41, 109, 
-    111, 100, 101, 108,  77,  97, 
-    116, 114, 105, 120,  41,  59, 
-     32,  47,  47,  32, 119, 111, 
-    114, 108, 100,  32, 115, 112, 
-     97,  99, 101,  32, 110, 111, 
-    114, 109,  97, 108,  13,  10, 
-      9,  79,  85,  84,  46, 110, 
-    111, 114, 109,  97, 108,  32, 
-     61,  32, 110, 111, 114, 109, 
-     97, 108, 105, 122, 101,  40, 
-     73,  78,  46, 110, 111, 114, 
-    109,  97, 108,  41,  59,  13, 
-     10,   9,  47,  47,  79,  85, 
-     84,  46, 110, 111, 114, 109, 
-     97, 108,  46, 122,  32,  61, 
-     32,  45,  79,  85,  84,  46, 
-    110, 111, 114, 109,  97, 108, 
-     46, 122,  59,  13,  10,  13, 
-     10,   9,  79,  85,  84,  46, 
-     99, 111, 108, 111, 114,  32, 
-     61,  32, 102, 108, 111,  97, 
-    116,  52,  40,  32,  73,  78, 
-     46,  99, 111, 108, 111, 114, 
-     44,  32,  49,  46,  48, 102, 
-     32,  41,  59,  13,  10,  13, 
-     10,   9,  47,  47,  79,  85, 
-     84,  46, 118, 105, 101, 119, 
-     32,  61,  32, 110, 111, 114, 
-    109,  97, 108, 105, 122, 101, 
-     40, 101, 121, 101,  80, 111, 
-    115,  32,  45,  32,  79,  85, 
-     84,  46, 119, 111, 114, 108, 
-    100,  80, 111, 115,  41,  59, 
-     13,  10,   9,  47,  47,  79, 
-     85,  84,  46, 108, 105, 103, 
-    104, 116,  32,  61,  32, 110, 
-    111, 114, 109,  97, 108, 105, 
-    122, 101,  40, 108, 105, 103, 
-    104, 116,  80, 111, 115,  32, 
-     45,  32,  79,  85,  84,  46, 
-    119, 111, 114, 108, 100,  80, 
-    111, 115,  41,  59,  32,  47, 
-     47, 102, 108, 111,  97, 116, 
-     51,  40,  49,  48,  46,  48, 
-    102,  44,  32,  48,  46,  48, 
-    102,  44,  32,  48,  46,  48, 
-    102,  41,  59,  13,  10,   9, 
-     79,  85,  84,  46, 118, 105, 
-    101, 119,  32,  61,  32, 101, 
-    121, 101,  80, 111, 115,  59, 
-     13,  10,   9,  79,  85,  84, 
-     46, 108, 105, 103, 104, 116, 
-     32,  61,  32, 108, 105, 103, 
-    104, 116,  80, 111, 115,  59, 
-     13,  10,  13,  10,  32,  32, 
-     32,  32, 114, 101, 116, 117, 
-    114, 110,  32,  79,  85,  84, 
-     59,  13,  10, 125,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,  99,  98, 
-    117, 102, 102, 101, 114,  32, 
-     80, 101, 114,  65, 112, 112, 
-    108, 105,  99,  97, 116, 105, 
-    111, 110,  32,  58,  32, 114, 
-    101, 103, 105, 115, 116, 101, 
-    114,  40,  98,  48,  41,  32, 
-    123,  13,  10,   9, 109,  97, 
-    116, 114, 105, 120,  32, 112, 
-    114, 111, 106, 101,  99, 116, 
-    105, 111, 110,  77,  97, 116, 
-    114, 105, 120,  59,  13,  10, 
-      9, 102, 108, 111,  97, 116, 
-     51,  32,  99, 108, 105, 101, 
-    110, 116,  68,  97, 116,  97, 
-     59,  13,  10, 125,  13,  10, 
-     13,  10,  99,  98, 117, 102, 
-    102, 101, 114,  32,  80, 101, 
-    114,  70, 114,  97, 109, 101, 
-     32,  58,  32, 114, 101, 103, 
-    105, 115, 116, 101, 114,  40, 
-     98,  49,  41,  32, 123,  13, 
-     10,   9, 109,  97, 116, 114, 
-    105, 120,  32, 118, 105, 101, 
-    119,  77,  97, 116, 114, 105, 
-    120,  59,  13,  10,   9, 102, 
-    108, 111,  97, 116,  51,  32, 
-    101, 121, 101,  80, 111, 115, 
-     59,  13,  10,   9, 102, 108, 
-    111,  97, 116,  51,  32, 108, 
-    105, 103, 104, 116,  80, 111, 
-    115,  59,  13,  10, 125,  13, 
-     10,  13,  10,  99,  98, 117, 
-    102, 102, 101, 114,  32,  80, 
-    101, 114,  79,  98, 106, 101, 
-     99, 116,  32,  58,  32, 114, 
-    101, 103, 105, 115, 116, 101, 
-    114,  40,  98,  50,  41,  32, 
-    123,  13,  10,   9, 109,  97, 
-    116, 114, 105, 120,  32, 109, 
-    111, 100, 101, 108,  77,  97, 
-    116, 114, 105, 120,  59,  13, 
-     10,   9, 109,  97, 116, 114, 
-    105, 120,  32, 118, 105, 101, 
-    119,  80, 114, 111, 106, 101, 
-     99, 116, 105, 111, 110,  77, 
-     97, 116, 114, 105, 120,  59, 
-     13,  10,   9, 109,  97, 116, 
-    114, 105, 120,  32, 109, 111, 
-    100, 101, 108,  86, 105, 101, 
-    119,  80, 114, 111, 106, 101, 
-     99, 116, 105, 111, 110,  77, 
-     97, 116, 114, 105, 120,  59, 
-     13,  10, 125,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-    254, 239, 254, 239,   1,   0, 
-      0,   0,  19,   6,   0,   0, 
-      0,  69,  58,  92,  80, 114, 
-    111, 106, 101,  99, 116, 115, 
-     92,  78, 105,  99, 107, 101, 
-    108,  92,  78, 105,  99, 107, 
-    101, 108,  92,  68,  97, 116, 
-     97,  92,  83, 104,  97, 100, 
-    101, 114, 115,  92,  83, 105, 
-    109, 112, 108, 101,  86, 101, 
-    114, 116, 101, 120,  83, 104, 
-     97, 100, 101, 114,  46, 104, 
-    108, 115, 108,   0,   0, 101, 
-     58,  92, 112, 114, 111, 106, 
-    101,  99, 116, 115,  92, 110, 
-    105,  99, 107, 101, 108,  92, 
-    110, 105,  99, 107, 101, 108, 
-     92, 100,  97, 116,  97,  92, 
-    115, 104,  97, 100, 101, 114, 
-    115,  92, 115, 105, 109, 112, 
-    108, 101, 118, 101, 114, 116, 
-    101, 120, 115, 104,  97, 100, 
-    101, 114,  46, 104, 108, 115, 
-    108,   0,  69,  58,  92,  80, 
-    114, 111, 106, 101,  99, 116, 
-    115,  92,  78, 105,  99, 107, 
-    101, 108,  92,  78, 105,  99, 
-    107, 101, 108,  92,  68,  97, 
-    116,  97,  92,  83, 104,  97, 
-    100, 101, 114, 115,  92,  67, 
-    111, 109, 109, 111, 110,  67, 
-    111, 110, 115, 116,  97, 110, 
-    116,  66, 117, 102, 102, 101, 
-    114, 115,  46, 104, 108, 115, 
-    108,   0, 101,  58,  92, 112, 
-    114, 111, 106, 101,  99, 116, 
-    115,  92, 110, 105,  99, 107, 
-    101, 108,  92, 110, 105,  99, 
-    107, 101, 108,  92, 100,  97, 
-    116,  97,  92, 115, 104,  97, 
-    100, 101, 114, 115,  92,  99, 
-    111, 109, 109, 111, 110,  99, 
-    111, 110, 115, 116,  97, 110, 
-    116,  98, 117, 102, 102, 101, 
-    114, 115,  46, 104, 108, 115, 
-    108,   0,  35, 105, 110,  99, 
-    108, 117, 100, 101,  32,  34, 
-     67, 111, 109, 109, 111, 110, 
-     67, 111, 110, 115, 116,  97, 
-    110, 116,  66, 117, 102, 102, 
-    101, 114, 115,  46, 104, 108, 
-    115, 108,  34,  13,  10,  13, 
-     10, 115, 116, 114, 117,  99, 
-    116,  32,  86, 101, 114, 116, 
-    101, 120,  68,  97, 116,  97, 
-     13,  10, 123,  13,  10,  32, 
-     32,  32,  32, 102, 108, 111, 
-     97, 116,  51,  32, 112, 111, 
-    115, 105, 116, 105, 111, 110, 
-     32,  58,  32,  80,  79,  83, 
-     73,  84,  73,  79,  78,  59, 
-     13,  10,   9, 102, 108, 111, 
-     97, 116,  51,  32, 110, 111, 
-    114, 109,  97, 108,  58,  32, 
-     78,  79,  82,  77,  65,  76, 
-     59,  13,  10,  32,  32,  32, 
-     32, 102, 108, 111,  97, 116, 
-     51,  32,  99, 111, 108, 111, 
-    114,  58,  32,  67,  79,  76, 
-     79,  82,  59,  13,  10, 125, 
-     59,  13,  10,  13,  10, 115, 
-    116, 114, 117,  99, 116,  32, 
-     86, 101, 114, 116, 101, 120, 
-     83, 104,  97, 100, 101, 114, 
-     79, 117, 116, 112, 117, 116, 
-     13,  10, 123,  13,  10,   9, 
-    102, 108, 111,  97, 116,  51, 
-     32, 119, 111, 114, 108, 100, 
-     80, 111, 115,  32,  58,  32, 
-     87,  79,  82,  76,  68,  95, 
-     80,  79,  83,  73,  84,  73, 
-     79,  78,  59,  13,  10,   9, 
-    102, 108, 111,  97, 116,  51, 
-     32, 110, 111, 114, 109,  97, 
-    108,  32,  58,  32,  78,  79, 
-     82,  77,  27, 226,  48,   1, 
-    172,   0,   0,   0,  57, 175, 
-     67, 210,  75, 218, 215,   1, 
-      1,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      2,   0,   0,   0,   4,   0, 
-      0,   0,   1,   0,   0,   0, 
-      6,   0,   0,   0,   0,   0, 
-      0,   0,  65,   0,   0,   0, 
-     40,   0,   0,   0,  27, 226, 
-     48,   1, 217,  26, 144, 157, 
-    208,   3,   0,   0,   1,   0, 
-      0,   0,  64,   0,   0,   0, 
-     65,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0, 194,   0, 
-      0,   0,  40,   0,   0,   0, 
-     27, 226,  48,   1,   4, 183, 
-     45, 148,  61,   1,   0,   0, 
-    128,   0,   0,   0,  64,   0, 
-      0,   0, 194,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   4,   0, 
-      0,   0,  66,   0,  60,  17, 
-     16,   1,   0,   0,   0,   1, 
-     10,   0,   1,   0,   1,   0, 
-    124,  79,  10,   0,   1,   0, 
-      1,   0, 124,  79,  77, 105, 
-     99, 114, 111, 115, 111, 102, 
-    116,  32,  40,  82,  41,  32, 
-     72,  76,  83,  76,  32,  83, 
-    104,  97, 100, 101, 114,  32, 
-     67, 111, 109, 112, 105, 108, 
-    101, 114,  32,  49,  48,  46, 
-     49,   0,   0,   0,  66,   0, 
-     61,  17,   1, 104, 108, 115, 
-    108,  70, 108,  97, 103, 115, 
-      0,  48, 120,  53,   0, 104, 
-    108, 115, 108,  84,  97, 114, 
-    103, 101, 116,   0, 118, 115, 
-     95,  53,  95,  48,   0, 104, 
-    108, 115, 108,  69, 110, 116, 
-    114, 121,   0,  83, 105, 109, 
-    112, 108, 101,  86, 101, 114, 
-    116, 101, 120,  83, 104,  97, 
-    100, 101, 114,   0,   0,   0, 
-     58,   0,  16,  17,   0,   0, 
-      0,   0,   4,   6,   0,   0, 
-      0,   0,   0,   0,  40,   2, 
-      0,   0,   0,   0,   0,   0, 
-     40,   2,   0,   0,   8,  16, 
-      0,   0, 164,   0,   0,   0, 
-      1,   0, 160,  83, 105, 109, 
-    112, 108, 101,  86, 101, 114, 
-    116, 101, 120,  83, 104,  97, 
-    100, 101, 114,   0,   0,   0, 
-     42,   0,  62,  17,   2,  16, 
-      0,   0,   9,   0,  73,  78, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,  22,   0,  80,  17, 
-      1,   0,   5,   0,   0,   0, 
-      4,   0, 164,   0,   0,   0, 
-      1,   0,  40,   2,   0,   0, 
-      0,   0,  22,   0,  80,  17, 
-      1,   0,   5,   0,   4,   0, 
-      4,   0, 164,   0,   0,   0, 
-      1,   0,  40,   2,   4,   0, 
-      0,   0,  22,   0,  80,  17, 
-      1,   0,   5,   0,   8,   0, 
-      4,   0, 164,   0,   0,   0, 
-      1,   0,  40,   2,   8,   0, 
-      0,   0,  22,   0,  80,  17, 
-      1,   0,   5,   0,  12,   0, 
-      4,   0, 164,   0,   0,   0, 
-      1,   0,  40,   2,  16,   0, 
-      0,   0,  22,   0,  80,  17, 
-      1,   0,   5,   0,  16,   0, 
-      4,   0, 164,   0,   0,   0, 
-      1,   0,  40,   2,  20,   0, 
-      0,   0,  22,   0,  80,  17, 
-      1,   0,   5,   0,  20,   0, 
-      4,   0, 164,   0,   0,   0, 
-      1,   0,  40,   2,  24,   0, 
-      0,   0,  22,   0,  80,  17, 
-      1,   0,   5,   0,  24,   0, 
-      4,   0, 164,   0,   0,   0, 
-      1,   0,  40,   2,  32,   0, 
-      0,   0,  22,   0,  80,  17, 
-      1,   0,   5,   0,  28,   0, 
-      4,   0, 164,   0,   0,   0, 
-      1,   0,  40,   2,  36,   0, 
-      0,   0,  22,   0,  80,  17, 
-      1,   0,   5,   0,  32,   0, 
-      4,   0, 164,   0,   0,   0, 
-      1,   0,  40,   2,  40,   0, 
-      0,   0,  74,   0,  62,  17, 
-      7,  16,   0,   0, 136,   0, 
-     60,  83, 105, 109, 112, 108, 
-    101,  86, 101, 114, 116, 101, 
-    120,  83, 104,  97, 100, 101, 
-    114,  32, 114, 101, 116, 117, 
-    114, 110,  32, 118,  97, 108, 
-    117, 101,  62,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-     22,   0,  80,  17,   2,   0, 
-      5,   0,  64,   0,   4,   0, 
-    164,   0,   0,   0,   1,   0, 
-     40,   2,  80,   0,   0,   0, 
-     22,   0,  80,  17,   2,   0, 
-      5,   0,  68,   0,   4,   0, 
-    164,   0,   0,   0,   1,   0, 
-     40,   2,  84,   0,   0,   0, 
-     22,   0,  80,  17,   2,   0, 
-      5,   0,  72,   0,   4,   0, 
-    164,   0,   0,   0,   1,   0, 
-     40,   2,  88,   0,   0,   0, 
-     22,   0,  80,  17,   2,   0, 
-      5,   0,  76,   0,   4,   0, 
-    164,   0,   0,   0,   1,   0, 
-     40,   2,  92,   0,   0,   0, 
-     22,   0,  80,  17,   2,   0, 
-      5,   0,  52,   0,   4,   0, 
-    164,   0,   0,   0,   1,   0, 
-     40,   2,  64,   0,   0,   0, 
-     22,   0,  80,  17,   2,   0, 
-      5,   0,  56,   0,   4,   0, 
-    164,   0,   0,   0,   1,   0, 
-     40,   2,  68,   0,   0,   0, 
-     22,   0,  80,  17,   2,   0, 
-      5,   0,  60,   0,   4,   0, 
-    164,   0,   0,   0,   1,   0, 
-     40,   2,  72,   0,   0,   0, 
-     22,   0,  80,  17,   2,   0, 
-      5,   0,  40,   0,   4,   0, 
-    164,   0,   0,   0,   1,   0, 
-     40,   2,  48,   0,   0,   0, 
-     22,   0,  80,  17,   2,   0, 
-      5,   0,  44,   0,   4,   0, 
-    164,   0,   0,   0,   1,   0, 
-     40,   2,  52,   0,   0,   0, 
-     22,   0,  80,  17,   2,   0, 
-      5,   0,  48,   0,   4,   0, 
-    164,   0,   0,   0,   1,   0, 
-     40,   2,  56,   0,   0,   0, 
-     22,   0,  80,  17,   2,   0, 
-      5,   0,  24,   0,   4,   0, 
-    164,   0,   0,   0,   1,   0, 
-     40,   2,  32,   0,   0,   0, 
-     22,   0,  80,  17,   2,   0, 
-      5,   0,  28,   0,   4,   0, 
-    164,   0,   0,   0,   1,   0, 
-     40,   2,  36,   0,   0,   0, 
-     22,   0,  80,  17,   2,   0, 
-      5,   0,  32,   0,   4,   0, 
-    164,   0,   0,   0,   1,   0, 
-     40,   2,  40,   0,   0,   0, 
-     22,   0,  80,  17,   2,   0, 
-      5,   0,  36,   0,   4,   0, 
-    164,   0,   0,   0,   1,   0, 
-     40,   2,  44,   0,   0,   0, 
-     22,   0,  80,  17,   2,   0, 
-      5,   0,  12,   0,   4,   0, 
-    164,   0,   0,   0,   1,   0, 
-     40,   2,  16,   0,   0,   0, 
-     22,   0,  80,  17,   2,   0, 
-      5,   0,  16,   0,   4,   0, 
-    164,   0,   0,   0,   1,   0, 
-     40,   2,  20,   0,   0,   0, 
-     22,   0,  80,  17,   2,   0, 
-      5,   0,  20,   0,   4,   0, 
-    164,   0,   0,   0,   1,   0, 
-     40,   2,  24,   0,   0,   0, 
-     22,   0,  80,  17,   2,   0, 
-      5,   0,   0,   0,   4,   0, 
-    164,   0,   0,   0,   1,   0, 
-     40,   2,   0,   0,   0,   0, 
-     22,   0,  80,  17,   2,   0, 
-      5,   0,   4,   0,   4,   0, 
-    164,   0,   0,   0,   1,   0, 
-     40,   2,   4,   0,   0,   0, 
-     22,   0,  80,  17,   2,   0, 
-      5,   0,   8,   0,   4,   0, 
-    164,   0,   0,   0,   1,   0, 
-     40,   2,   8,   0,   0,   0, 
-     42,   0,  62,  17,   6,  16, 
-      0,   0,   8,   0,  79,  85, 
-     84,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,  22,   0,  80,  17, 
-      0,   0,   5,   0,  64,   0, 
-      4,   0, 236,   0,   0,   0, 
-      1,   0, 224,   1,  16,   0, 
-      0,   0,  22,   0,  80,  17, 
-      0,   0,   5,   0,  68,   0, 
-      4,   0,  12,   1,   0,   0, 
-      1,   0, 192,   1,  20,   0, 
-      0,   0,  22,   0,  80,  17, 
-      0,   0,   5,   0,  72,   0, 
-      4,   0,  44,   1,   0,   0, 
-      1,   0, 160,   1,  24,   0, 
-      0,   0,  22,   0,  80,  17, 
-      0,   0,   5,   0,  76,   0, 
-      4,   0,  76,   1,   0,   0, 
-      1,   0, 128,   1,  28,   0, 
-      0,   0,  22,   0,  80,  17, 
-      0,   0,   5,   0,   0,   0, 
-      4,   0, 108,   1,   0,   0, 
-      1,   0,  96,   1,  32,   0, 
-      0,   0,  22,   0,  80,  17, 
-      0,   0,   5,   0,   4,   0, 
-      4,   0, 140,   1,   0,   0, 
-      1,   0,  64,   1,  36,   0, 
-      0,   0,  22,   0,  80,  17, 
-      0,   0,   5,   0,   8,   0, 
-      4,   0, 172,   1,   0,   0, 
-      1,   0,  32,   1,  40,   0, 
-      0,   0,  22,   0,  80,  17, 
-      0,   0,   5,   0,  12,   0, 
-      4,   0, 248,   1,   0,   0, 
-      1,   0, 212,   0,   0,   0, 
-      0,   0,  22,   0,  80,  17, 
-      0,   0,   5,   0,  16,   0, 
-      4,   0, 248,   1,   0,   0, 
-      1,   0, 212,   0,   4,   0, 
-      0,   0,  22,   0,  80,  17, 
-      0,   0,   5,   0,  20,   0, 
-      4,   0, 248,   1,   0,   0, 
-      1,   0, 212,   0,   8,   0, 
-      0,   0,  22,   0,  80,  17, 
-      0,   0,   5,   0,  24,   0, 
-      4,   0,  12,   2,   0,   0, 
-      1,   0, 192,   0,  48,   0, 
-      0,   0,  22,   0,  80,  17, 
-      0,   0,   5,   0,  28,   0, 
-      4,   0,  12,   2,   0,   0, 
-      1,   0, 192,   0,  52,   0, 
-      0,   0,  22,   0,  80,  17, 
-      0,   0,   5,   0,  32,   0, 
-      4,   0,  12,   2,   0,   0, 
-      1,   0, 192,   0,  56,   0, 
-      0,   0,  22,   0,  80,  17, 
-      0,   0,   5,   0,  36,   0, 
-      4,   0,  32,   2,   0,   0, 
-      1,   0, 172,   0,  60,   0, 
-      0,   0,  22,   0,  80,  17, 
-      0,   0,   5,   0,  40,   0, 
-      4,   0,  56,   2,   0,   0, 
-      1,   0, 148,   0,  64,   0, 
-      0,   0,  22,   0,  80,  17, 
-      0,   0,   5,   0,  44,   0, 
-      4,   0,  56,   2,   0,   0, 
-      1,   0, 148,   0,  68,   0, 
-      0,   0,  22,   0,  80,  17, 
-      0,   0,   5,   0,  48,   0, 
-      4,   0,  56,   2,   0,   0, 
-      1,   0, 148,   0,  72,   0, 
-      0,   0,  22,   0,  80,  17, 
-      0,   0,   5,   0,  52,   0, 
-      4,   0,  80,   2,   0,   0, 
-      1,   0, 124,   0,  80,   0, 
-      0,   0,  22,   0,  80,  17, 
-      0,   0,   5,   0,  56,   0, 
-      4,   0,  80,   2,   0,   0, 
-      1,   0, 124,   0,  84,   0, 
-      0,   0,  22,   0,  80,  17, 
-      0,   0,   5,   0,  60,   0, 
-      4,   0,  80,   2,   0,   0, 
-      1,   0, 124,   0,  88,   0, 
-      0,   0,   2,   0,   6,   0, 
-    244,   0,   0,   0,  48,   0, 
-      0,   0,   1,   0,   0,   0, 
-     16,   1, 174, 194,  10,  55, 
-    138,  51, 109, 179,  33, 253, 
-    126,  99, 122, 172, 123,  19, 
-      0,   0, 128,   0,   0,   0, 
-     16,   1, 118, 121, 219,  16, 
-    108,  60,  36, 183,  75, 158, 
-    242, 112, 198,  70,  53,  61, 
-      0,   0, 242,   0,   0,   0, 
-     64,   2,   0,   0,   0,   0, 
-      0,   0,   1,   0,   1,   0, 
-    204,   2,   0,   0,   0,   0, 
-      0,   0,  46,   0,   0,   0, 
-     52,   2,   0,   0, 164,   0, 
-      0,   0,  24,   0,   0, 128, 
-    164,   0,   0,   0,  24,   0, 
-      0,   0, 184,   0,   0,   0, 
-     24,   0,   0, 128, 184,   0, 
-      0,   0,  24,   0,   0,   0, 
-    204,   0,   0,   0,  24,   0, 
-      0, 128, 204,   0,   0,   0, 
-     24,   0,   0,   0, 236,   0, 
-      0,   0,  24,   0,   0, 128, 
-    236,   0,   0,   0,  24,   0, 
-      0,   0,  12,   1,   0,   0, 
-     24,   0,   0, 128,  12,   1, 
-      0,   0,  24,   0,   0,   0, 
-     44,   1,   0,   0,  24,   0, 
-      0, 128,  44,   1,   0,   0, 
-     24,   0,   0,   0,  76,   1, 
-      0,   0,  25,   0,   0, 128, 
-     76,   1,   0,   0,  25,   0, 
-      0,   0, 108,   1,   0,   0, 
-     25,   0,   0, 128, 108,   1, 
-      0,   0,  25,   0,   0,   0, 
-    140,   1,   0,   0,  25,   0, 
-      0, 128, 140,   1,   0,   0, 
-     25,   0,   0,   0, 172,   1, 
-      0,   0,  28,   0,   0, 128, 
-    172,   1,   0,   0,  28,   0, 
-      0,   0, 200,   1,   0,   0, 
-     28,   0,   0, 128, 200,   1, 
-      0,   0,  28,   0,   0,   0, 
-    220,   1,   0,   0,  28,   0, 
-      0, 128, 220,   1,   0,   0, 
-     28,   0,   0,   0, 248,   1, 
-      0,   0,  31,   0,   0, 128, 
-    248,   1,   0,   0,  31,   0, 
-      0,   0,  12,   2,   0,   0, 
-     31,   0,   0, 128,  12,   2, 
-      0,   0,  31,   0,   0,   0, 
-     32,   2,   0,   0,  35,   0, 
-      0, 128,  32,   2,   0,   0, 
-     35,   0,   0,   0,  56,   2, 
-      0,   0,  36,   0,   0, 128, 
-     56,   2,   0,   0,  36,   0, 
-      0,   0,  80,   2,   0,   0, 
-     38,   0,   0, 128,  80,   2, 
-      0,   0,  38,   0,   0,   0, 
-    100,   2,   0,   0,  38,   0, 
-      0, 128, 100,   2,   0,   0, 
-     38,   0,   0,   0, 120,   2, 
-      0,   0,  38,   0,   0, 128, 
-    120,   2,   0,   0,  38,   0, 
-      0,   0, 140,   2,   0,   0, 
-     38,   0,   0, 128, 140,   2, 
-      0,   0,  38,   0,   0,   0, 
-    160,   2,   0,   0,  38,   0, 
-      0, 128, 160,   2,   0,   0, 
-     38,   0,   0,   0, 180,   2, 
-      0,   0,  38,   0,   0, 128, 
-    180,   2,   0,   0,  38,   0, 
-      0,   0, 200,   2,   0,   0, 
-     38,   0,   0, 128, 200,   2, 
-      0,   0,  38,   0,   0,   0, 
-      5,   0,  77,   0,  20,   0, 
-     76,   0,   5,   0,  77,   0, 
-     20,   0,  76,   0,   5,   0, 
-     77,   0,  20,   0,  76,   0, 
-      5,   0,  77,   0,  20,   0, 
-     76,   0,   5,   0,  77,   0, 
-     20,   0,  76,   0,   5,   0, 
-     77,   0,  20,   0,  76,   0, 
-      2,   0,  64,   0,  17,   0, 
-     59,   0,   2,   0,  64,   0, 
-     17,   0,  59,   0,   2,   0, 
-     64,   0,  17,   0,  59,   0, 
-      2,   0,  35,   0,  15,   0, 
-     34,   0,   2,   0,  35,   0, 
-     15,   0,  34,   0,   2,   0, 
-     35,   0,  15,   0,  34,   0, 
-      2,   0,  38,   0,   2,   0, 
-     37,   0,   2,   0,  38,   0, 
-      2,   0,  37,   0,   2,   0, 
-     19,   0,   2,   0,  18,   0, 
-      2,   0,  22,   0,   2,   0, 
-     21,   0,   5,   0,  15,   0, 
-      5,   0,  15,   0,   5,   0, 
-     15,   0,   5,   0,  15,   0, 
-      5,   0,  15,   0,   5,   0, 
-     15,   0,   5,   0,  15,   0, 
-      5,   0,  15,   0,   5,   0, 
-     15,   0,   5,   0,  15,   0, 
-      5,   0,  15,   0,   5,   0, 
-     15,   0,   5,   0,  15,   0, 
-      5,   0,  15,   0, 246,   0, 
-      0,   0,   4,   0,   0,   0, 
-      0,   0,   0,   0,  20,   0, 
-      0,   0,   0,   0,   0,   0, 
-     36,   0,   0,   0,  64,   0, 
-      0,   0,  96,   0,   0,   0, 
-    128,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,  11, 202,  49,   1, 
-     56,   0,   0,   0,   0,  16, 
-      0,   0,  14,  16,   0,   0, 
-    164,   1,   0,   0,  11,   0, 
-    255, 255,   4,   0,   0,   0, 
-    255, 255,   3,   0,   0,   0, 
-      0,   0,  56,   0,   0,   0, 
-     56,   0,   0,   0,   8,   0, 
-      0,   0,  64,   0,   0,   0, 
-      0,   0,   0,   0,  22,   0, 
-     27,  21,  64,   0,   0,   0, 
-      3,   0,   0,   0,  12,   0, 
-    102, 108, 111,  97, 116,  51, 
-      0, 243, 242, 241,  58,   0, 
-      3,  18,  13,  21,   3,   0, 
-      0,  16,   0,   0,   0,   0, 
-    112, 111, 115, 105, 116, 105, 
-    111, 110,   0, 241,  13,  21, 
-      3,   0,   0,  16,   0,   0, 
-     12,   0, 110, 111, 114, 109, 
-     97, 108,   0, 243, 242, 241, 
-     13,  21,   3,   0,   0,  16, 
-      0,   0,  24,   0,  99, 111, 
-    108, 111, 114,   0,  34,   0, 
-      5,  21,   3,   0,   0,   0, 
-      1,  16,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-     36,   0,  86, 101, 114, 116, 
-    101, 120,  68,  97, 116,  97, 
-      0, 243, 242, 241,  10,   0, 
-      1,  18,   1,   0,   0,   0, 
-      2,  16,   0,   0,  22,   0, 
-     27,  21,  64,   0,   0,   0, 
-      4,   0,   0,   0,  16,   0, 
-    102, 108, 111,  97, 116,  52, 
-      0, 243, 242, 241, 110,   0, 
-      3,  18,  13,  21,   3,   0, 
-      0,  16,   0,   0,   0,   0, 
-    119, 111, 114, 108, 100,  80, 
-    111, 115,   0, 241,  13,  21, 
-      3,   0,   0,  16,   0,   0, 
-     12,   0, 110, 111, 114, 109, 
-     97, 108,   0, 243, 242, 241, 
-     13,  21,   3,   0,   4,  16, 
-      0,   0,  24,   0,  99, 111, 
-    108, 111, 114,   0,  13,  21, 
-      3,   0,   0,  16,   0,   0, 
-     40,   0, 118, 105, 101, 119, 
-      0, 241,  13,  21,   3,   0, 
-      0,  16,   0,   0,  52,   0, 
-    108, 105, 103, 104, 116,   0, 
-     13,  21,   3,   0,   4,  16, 
-      0,   0,  64,   0, 112, 111, 
-    115, 105, 116, 105, 111, 110, 
-      0, 241,  42,   0,   5,  21, 
-      6,   0,   0,   0,   5,  16, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,  80,   0, 
-     86, 101, 114, 116, 101, 120, 
-     83, 104,  97, 100, 101, 114, 
-     79, 117, 116, 112, 117, 116, 
-      0, 243, 242, 241,  10,   0, 
-     24,  21,   6,  16,   0,   0, 
-      1,   0,   1,   0,  14,   0, 
-      8,  16,   7,  16,   0,   0, 
-     23,   0,   1,   0,   3,  16, 
-      0,   0,  10,   0,  24,  21, 
-      0,  16,   0,   0,   1,   0, 
-      1,   0,  10,   0,  24,  21, 
-      9,  16,   0,   0,   1,   0, 
-      0,   2,  30,   0,  28,  21, 
-     64,   0,   0,   0,   4,   0, 
-      0,   0,   4,   0,   0,   0, 
-     16,   0,   0,   0,   0,  64, 
-      0, 102, 108, 111,  97, 116, 
-     52, 120,  52,   0,  10,   0, 
-     24,  21,  11,  16,   0,   0, 
-      1,   0,   1,   0,  10,   0, 
-     24,  21,  12,  16,   0,   0, 
-      1,   0,   0,   2,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,  11, 202, 
-     49,   1,  56,   0,   0,   0, 
-      0,  16,   0,   0,   0,  16, 
-      0,   0,   0,   0,   0,   0, 
-     12,   0, 255, 255,   4,   0, 
-      0,   0, 255, 255,   3,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-    102, 108, 111,  97, 116,  52, 
-     40,  32,  73,  78,  46,  99, 
-    111, 108, 111, 114,  44,  32, 
-     49,  46,  48, 102,  32,  41, 
-     59,  13,  10,  13,  10,   9, 
-     47,  47,  79,  85,  84,  46, 
-    118, 105, 101, 119,  32,  61, 
-     32, 110, 111, 114, 109,  97, 
-    108, 105, 122, 101,  40, 101, 
-    121, 101,  80, 111, 115,  32, 
-     45,  32,  79,  85,  84,  46, 
-    119, 111, 114, 108, 100,  80, 
-    111, 115,  41,  59,  13,  10, 
-      9,  47,  47,  79,  85,  84, 
-     46, 108, 105, 103, 104, 116, 
-     32,  61,  32, 110, 111, 114, 
-    109,  97, 108, 105, 122, 101, 
-     40, 108, 105, 103, 104, 116, 
-     80, 111, 115,  32,  45,  32, 
-     79,  85,  84,  46, 119, 111, 
-    114, 108, 100,  80, 111, 115, 
-     41,  59,  32,  47,  47, 102, 
-    108, 111,  97, 116,  51,  40, 
-     49,  48,  46,  48, 102,  44, 
-     32,  48,  46,  48, 102,  44, 
-     32,  48,  46,  48, 102,  41, 
-     59,  13,  10,   9,  79,  85, 
-     84,  46, 118, 105, 101, 119, 
-     32,  61,  32, 101, 121, 101, 
-     80, 111, 115,  59,  13,  10, 
-      9,  79,  85,  84,  46, 108, 
-    105, 103, 104, 116,  32,  61, 
-     32, 108, 105, 103, 104, 116, 
-     80, 111, 115,  59,  13,  10, 
-     13,  10,  32,  32,  32,  32, 
-    114, 101, 116, 117, 114, 110, 
-     32,  79,  85,  84,  59,  13, 
-     10, 125,   0,  99,  98, 117, 
-    102, 102, 101, 114,  32,  80, 
-    101, 114,  65, 112, 112, 108, 
-    105,  99,  97, 116, 105, 111, 
-    110,  32,  58,  32, 114, 101, 
-    103, 105, 115, 116, 101, 114, 
-     40,  98,  48,  41,  32, 123, 
-     13,  10,   9, 109,  97, 116, 
-    114, 105, 120,  32, 112, 114, 
-    111, 106, 101,  99, 116, 105, 
-    111, 110,  77,  97, 116, 114, 
-    105, 120,  59,  13,  10,   9, 
-    102, 108, 111,  97, 116,  51, 
-     32,  99, 108, 105, 101, 110, 
-    116,  68,  97, 116,  97,  59, 
-     13,  10, 125,  13,  10,  13, 
-     10,  99,  98, 117, 102, 102, 
-    101, 114,  32,  80, 101, 114, 
-     70, 114,  97, 109, 101,  32, 
-     58,  32, 114, 101, 103, 105, 
-    115, 116, 101, 114,  40,  98, 
-     49,  41,  32, 123,  13,  10, 
-      9, 109,  97, 116, 114, 105, 
-    120,  32, 118, 105, 101, 119, 
-     77,  97, 116, 114, 105, 120, 
-     59,  13,  10,   9, 102, 108, 
-    111,  97, 116,  51,  32, 101, 
-    121, 101,  80, 111, 115,  59, 
-     13,  10,   9, 102, 108, 111, 
-     97, 116,  51,  32, 108, 105, 
-    103, 104, 116,  80, 111, 115, 
-     59,  13,  10, 125,  13,  10, 
-     13,  10,  99,  98, 117, 102, 
-    102, 101, 114,  32,  80, 101, 
-    114,  79,  98, 106, 101,  99, 
-    116,  32,  58,  32, 114, 101, 
-    103, 105, 115, 116, 101, 114, 
-     40,  98,  50,  41,  32, 123, 
-     13,  10,   9, 109,  97, 116, 
-    114, 105, 120,  32, 109, 111, 
-    100, 101, 108,  77,  97, 116, 
-    114, 105, 120,  59,  13,  10, 
-      9, 109,  97, 116, 114, 105, 
-    120,  32, 118, 105, 101, 119, 
-     80, 114, 111, 106, 101,  99, 
-    116, 105, 111, 110,  77,  97, 
-    116, 114, 105, 120,  59,  13, 
-     10,   9, 109,  97, 116, 114, 
-    105, 120,  32, 109, 111, 100, 
-    101, 108,  86, 105, 101, 119, 
-     80, 114, 111, 106, 101,  99, 
-    116, 105, 111, 110,  77,  97, 
-    116, 114, 105, 120,  59,  13, 
-     10, 125,   0,  11,   0,   0, 
-      0, 213,   4,   0,   0,  64, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   4,   1,   0,   0,   1, 
-      0,   0,   0,  65,   0,   0, 
-      0, 128,   0,   0,   0, 194, 
-      0,   0,   0,   7,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,  68,  51, 
-     68,  83,  72,  68,  82,   0, 
-    204,   2,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,  32,   0, 
-      0,  96,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-    255, 255, 255, 255,  26,   9, 
-     47, 241,  40,   0,   0,   0, 
-     24,   2,   0,   0,  37,   0, 
-      0,   0,   1,   0,   0,   0, 
-     65,   0,   0,   0,   1,   0, 
-      0,   0, 129,   0,   0,   0, 
-      1,   0,   0,   0,   1,   0, 
-      0,   0,   1,   0,   0,   0, 
-     97,   0,   0,   0,   1,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-     16,   0,   0,   0,   0,   0, 
-      1,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,  32, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,  32, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,  32,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-     12,   0,   0,   0,  24,   0, 
-      0,   0,  36,   0,   0,   0, 
-     48,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,  34,   0, 
-     37,  17,   0,   0,   0,   0, 
-    140,   0,   0,   0,   1,   0, 
-     83, 105, 109, 112, 108, 101, 
-     86, 101, 114, 116, 101, 120, 
-     83, 104,  97, 100, 101, 114, 
-      0,   0,   0,   0,  26,   0, 
-     81,  17,  10,  16,   0,   0, 
-      8,   0,   1,   0,  64,   0, 
-    255, 255, 255, 255, 255, 255, 
-    101, 121, 101,  80, 111, 115, 
-      0,   0,  30,   0,  81,  17, 
-     10,  16,   0,   0,   8,   0, 
-      1,   0,  80,   0, 255, 255, 
-    255, 255, 255, 255, 108, 105, 
-    103, 104, 116,  80, 111, 115, 
-      0,   0,   0,   0,  30,   0, 
-     81,  17,  13,  16,   0,   0, 
-      8,   0,   2,   0,   0,   0, 
-    255, 255, 255, 255, 255, 255, 
-    109, 111, 100, 101, 108,  77, 
-     97, 116, 114, 105, 120,   0, 
-     46,   0,  81,  17,  13,  16, 
-      0,   0,   8,   0,   2,   0, 
-    128,   0, 255, 255, 255, 255, 
-    255, 255, 109, 111, 100, 101, 
-    108,  86, 105, 101, 119,  80, 
-    114, 111, 106, 101,  99, 116, 
-    105, 111, 110,  77,  97, 116, 
-    114, 105, 120,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-     16,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0, 255, 255, 
-    255, 255,  26,   9,  47, 241, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0, 255, 255, 255, 255, 
-    119,   9,  49,   1,   1,   0, 
-      0,   0,  14,   0,  20, 142, 
-     15,   0,  20, 107,  16,   0, 
-      1,   0,  88,   0,   0,   0, 
-     32,   0,   0,   0,  44,   0, 
-      0,   0, 148,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,  22,   0,   0,   0, 
-     25,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   1,   0, 
-      0,   0,   0,   0,   0,   0, 
-    204,   2,   0,   0,  32,   0, 
-      0,  96,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   2,   0,  10,   0, 
-      8,   6,   0,   0,   0,   0, 
-      0,   0, 140,   2,   0,   0, 
-      2,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,  83, 105, 
-    109, 112, 108, 101,  86, 101, 
-    114, 116, 101, 120,  83, 104, 
-     97, 100, 101, 114,   0, 110, 
-    111, 110, 101,   0,  45, 186, 
-     46, 241,   1,   0,   0,   0, 
-      0,   0,   0,   0, 204,   2, 
-      0,   0,  32,   0,   0,  96, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      2,   0,   2,   0,   7,   0, 
-      0,   0,   0,   0,   1,   0, 
-    255, 255, 255, 255,   0,   0, 
-      0,   0, 204,   2,   0,   0, 
-      8,   2,   0,   0,   0,   0, 
-      0,   0, 255, 255, 255, 255, 
-      0,   0,   0,   0, 255, 255, 
-    255, 255,   1,   0,   2,   0, 
-      0,   0,   2,   0,   0,   0, 
-      0,   0,  63,   0,   0,   0, 
-     69,  58,  92,  80, 114, 111, 
-    106, 101,  99, 116, 115,  92, 
-     78, 105,  99, 107, 101, 108, 
-     92,  78, 105,  99, 107, 101, 
-    108,  92,  68,  97, 116,  97, 
-     92,  83, 104,  97, 100, 101, 
-    114, 115,  92,  83, 105, 109, 
-    112, 108, 101,  86, 101, 114, 
-    116, 101, 120,  83, 104,  97, 
-    100, 101, 114,  46, 104, 108, 
-    115, 108,   0,  69,  58,  92, 
-     80, 114, 111, 106, 101,  99, 
-    116, 115,  92,  78, 105,  99, 
-    107, 101, 108,  92,  78, 105, 
-     99, 107, 101, 108,  92,  68, 
-     97, 116,  97,  92,  83, 104, 
-     97, 100, 101, 114, 115,  92, 
-     67, 111, 109, 109, 111, 110, 
-     67, 111, 110, 115, 116,  97, 
-    110, 116,  66, 117, 102, 102, 
-    101, 114, 115,  46, 104, 108, 
-    115, 108,   0,   0,   0,   0, 
-    254, 239, 254, 239,   1,   0, 
-      0,   0,   1,   0,   0,   0, 
-      0,   1,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255,  13, 
-      0, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0, 148,  46, 
-     49,   1,  41, 162, 146,  97, 
-      1,   0,   0,   0,  37, 101, 
-     94,  85, 208, 107,  76,  71, 
-    182, 148,  10, 209, 173, 204, 
-    249,  99, 185,   0,   0,   0, 
-     47,  76, 105, 110, 107,  73, 
-    110, 102, 111,   0,  47, 110, 
-     97, 109, 101, 115,   0,  47, 
-    115, 114,  99,  47, 104, 101, 
-     97, 100, 101, 114,  98, 108, 
-    111,  99, 107,   0,  47, 115, 
-    114,  99,  47, 102, 105, 108, 
-    101, 115,  47, 101,  58,  92, 
-    112, 114, 111, 106, 101,  99, 
-    116, 115,  92, 110, 105,  99, 
-    107, 101, 108,  92, 110, 105, 
-     99, 107, 101, 108,  92, 100, 
-     97, 116,  97,  92, 115, 104, 
-     97, 100, 101, 114, 115,  92, 
-    115, 105, 109, 112, 108, 101, 
-    118, 101, 114, 116, 101, 120, 
-    115, 104,  97, 100, 101, 114, 
-     46, 104, 108, 115, 108,   0, 
-     47, 115, 114,  99,  47, 102, 
-    105, 108, 101, 115,  47, 101, 
-     58,  92, 112, 114, 111, 106, 
-    101,  99, 116, 115,  92, 110, 
-    105,  99, 107, 101, 108,  92, 
-    110, 105,  99, 107, 101, 108, 
-     92, 100,  97, 116,  97,  92, 
-    115, 104,  97, 100, 101, 114, 
-    115,  92,  99, 111, 109, 109, 
-    111, 110,  99, 111, 110, 115, 
-    116,  97, 110, 116,  98, 117, 
-    102, 102, 101, 114, 115,  46, 
-    104, 108, 115, 108,   0,   5, 
-      0,   0,   0,  10,   0,   0, 
-      0,   1,   0,   0,   0,  62, 
-      0,   0,   0,   0,   0,   0, 
-      0,  17,   0,   0,   0,   7, 
-      0,   0,   0,  34,   0,   0, 
-      0,   8,   0,   0,   0,   0, 
-      0,   0,   0,   5,   0,   0, 
-      0, 108,   0,   0,   0,   9, 
-      0,   0,   0,  10,   0,   0, 
-      0,   6,   0,   0,   0,   0, 
-      0,   0,   0, 220,  81,  51, 
-      1,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-     17,   0,   0,   0,  32,   0, 
-      0,   0,  29,   1,   0,   0, 
-    220,   1,   0,   0, 167,   1, 
-      0,   0,  56,   0,   0,   0, 
-      0,   0,   0,   0,  83,   6, 
-      0,   0, 172,   0,   0,   0, 
-    208,   3,   0,   0,  61,   1, 
-      0,   0, 172,   8,   0,   0, 
-     64,   0,   0,   0,   0,   0, 
-      0,   0,  40,   0,   0,   0, 
-     80,   2,   0,   0,  44,   0, 
-      0,   0, 176,   0,   0,   0, 
-      3,   0,   0,   0,  28,   0, 
-      0,   0,  18,   0,   0,   0, 
-     27,   0,   0,   0,  19,   0, 
-      0,   0,  11,   0,   0,   0, 
-      6,   0,   0,   0,  20,   0, 
-      0,   0,  21,   0,   0,   0, 
-     12,   0,   0,   0,   8,   0, 
-      0,   0,   9,   0,   0,   0, 
-     10,   0,   0,   0,  13,   0, 
-      0,   0,  14,   0,   0,   0, 
-     15,   0,   0,   0,  16,   0, 
-      0,   0,  17,   0,   0,   0, 
-      7,   0,   0,   0,  22,   0, 
-      0,   0,  23,   0,   0,   0, 
-     24,   0,   0,   0,  26,   0, 
-      0,   0,  25,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,  29,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0
-};
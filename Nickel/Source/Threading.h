@@ -0,0 +1,21 @@
+#pragma once
+
+#include "JobSystem.h"
+
+namespace Nickel {
+	// NOTE: splits [0, count) into at most 'chunkCount' contiguous ranges and runs fn(chunkIndex, begin, end) for each,
+	// the calling thread takes the first chunk. Chunk boundaries are deterministic so callers can index per-chunk output.
+	// The other chunks are jobs on the engine's JobSystem, a chunk may itself fan out again.
+	template <typename Fn>
+	auto ParallelForChunks(u32 count, u32 chunkCount, Fn&& fn) -> void {
+		JobSystem::Get().ParallelForChunks(count, chunkCount, std::forward<Fn>(fn));
+	}
+
+	template <typename Fn>
+	auto ParallelFor(u32 count, Fn&& fn) -> void {
+		ParallelForChunks(count, GetWorkerCount(), [&fn](u32, u32 begin, u32 end) {
+			for (u32 i = begin; i < end; i++)
+				fn(i);
+		});
+	}
+}
@@ -1,43 +1,33 @@
 #pragma once
-#include "Renderer/DX11Layer.h"
+#include "Renderer/RendererPlatformInterface.h"
 
 namespace Nickel::Renderer {
     struct VertexBuffer {
-        std::unique_ptr<ID3D11Buffer, DxDeleter> buffer;
-        //ID3D11Buffer* buffer;
-        UINT stride;
-        UINT offset;
+        BufferHandle buffer;
+        u32 stride;
+        u32 offset;
         bool isDynamic;
 
         template <typename VertexT>
-        void Create(ID3D11Device1* device, std::span<VertexT> vertexData, bool dynamic) {
-            Assert(buffer.get() == nullptr);
-            auto data = D3D11_SUBRESOURCE_DATA{ .pSysMem = vertexData.data() };
+        void Create(const PlatformInterface& gfx, std::span<VertexT> vertexData, bool dynamic) {
+            Assert(!buffer.IsValid());
+            const auto desc = BufferDesc{
+                .type = BufferType::Vertex,
+                .usage = dynamic ? BufferUsage::Dynamic : BufferUsage::Default,
+                .size = static_cast<u32>(sizeof(VertexT) * vertexData.size()),
+                .stride = sizeof(VertexT)
+            };
 
-            auto rawBuffer = DXLayer::CreateVertexBuffer(device, (sizeof(VertexT) * vertexData.size()), dynamic, &data);
-            //buffer = rawBuffer;
-            buffer = std::unique_ptr<ID3D11Buffer, DxDeleter>(rawBuffer);
+            buffer = gfx.CreateBuffer(desc, vertexData.data());
             stride = sizeof(VertexT);
             offset = 0;
             isDynamic = dynamic;
         }
 
         template <typename VertexT>
-        void Update(ID3D11DeviceContext1* ctx, std::span<VertexT const*> vertexData) {
-            auto& b = b.get();
-            if constexpr (_DEBUG) {
-                Assert(isDynamic);
-                D3D11_BUFFER_DESC buffer_desc;
-                b->GetDesc(&buffer_desc);
-                Assert(buffer_desc.Usage == D3D11_USAGE_DYNAMIC && buffer_desc.CPUAccessFlags == D3D11_CPU_ACCESS_WRITE);
-            }
-
-            D3D11_MAPPED_SUBRESOURCE mappedResource;
-            void* dataPtr;
-            ctx->Map(b, 0, D3D11_MAP_WRITE_DISCARD, 0, &mappedResource);
-            dataPtr = mappedResource.pData;
-            memcpy(dataPtr, vertexData.data(), vertexData.size());
-            ctx->Unmap(b, 0);
+        void Update(const PlatformInterface& gfx, std::span<const VertexT> vertexData) {
+            Assert(isDynamic);
+            gfx.UpdateBuffer(buffer, vertexData.data(), static_cast<u32>(vertexData.size_bytes()));
         }
     }; 
 }
\ No newline at end of file
@@ -1,4637 +0,0 @@
-#if 0
-//
-// Generated by Microsoft (R) HLSL Shader Compiler 10.1
-//
-//
-// Buffer Definitions: 
-//
-// cbuffer PerApplication
-// {
-//
-//   float4x4 projectionMatrix;         // Offset:    0 Size:    64
-//
-// }
-//
-// cbuffer PerFrame
-// {
-//
-//   float4x4 viewMatrix;               // Offset:    0 Size:    64
-//   float3 eyePos;                     // Offset:   64 Size:    12
-//   float3 lightPos;                   // Offset:   80 Size:    12
-//
-// }
-//
-// cbuffer PerObject
-// {
-//
-//   float4x4 worldMatrix;              // Offset:    0 Size:    64
-//
-// }
-//
-//
-// Resource Bindings:
-//
-// Name                                 Type  Format         Dim      HLSL Bind  Count
-// ------------------------------ ---------- ------- ----------- -------------- ------
-// PerApplication                    cbuffer      NA          NA            cb0      1 
-// PerFrame                          cbuffer      NA          NA            cb1      1 
-// PerObject                         cbuffer      NA          NA            cb2      1 
-//
-//
-//
-// Input signature:
-//
-// Name                 Index   Mask Register SysValue  Format   Used
-// -------------------- ----- ------ -------- -------- ------- ------
-// POSITION                 0   xyz         0     NONE   float   xyz 
-// NORMAL                   0   xyz         1     NONE   float   xyz 
-// COLOR                    0   xyz         2     NONE   float   xyz 
-//
-//
-// Output signature:
-//
-// Name                 Index   Mask Register SysValue  Format   Used
-// -------------------- ----- ------ -------- -------- ------- ------
-// WORLD_POSITION           0   xyz         0     NONE   float   xyz 
-// NORMAL                   0   xyz         1     NONE   float   xyz 
-// COLOR                    0   xyzw        2     NONE   float   xyzw
-// VIEW                     0   xyz         3     NONE   float   xyz 
-// LIGHT                    0   xyz         4     NONE   float   xyz 
-// SV_POSITION              0   xyzw        5      POS   float   xyzw
-//
-//
-// Constant buffer to DX9 shader constant mappings:
-//
-// Target Reg Buffer  Start Reg # of Regs        Data Conversion
-// ---------- ------- --------- --------- ----------------------
-// c1         cb0             0         4  ( FLT, FLT, FLT, FLT)
-// c5         cb1             0         6  ( FLT, FLT, FLT, FLT)
-// c11        cb2             0         4  ( FLT, FLT, FLT, FLT)
-//
-//
-// Runtime generated constant mappings:
-//
-// Target Reg                               Constant Description
-// ---------- --------------------------------------------------
-// c0                              Vertex Shader position offset
-//
-//
-// Level9 shader bytecode:
-//
-    vs_2_x
-    def c15, 1, 0, 0, 0
-    dcl_texcoord v0  // IN<0,1,2>
-    dcl_texcoord1 v1  // IN<3,4,5>
-    dcl_texcoord2 v2  // IN<6,7,8>
-
-#line 39 "E:\Projects\Nickel\Nickel\Data\Shaders\SimpleVertexShader.hlsl"
-    mov r0, c11  // PerObject::worldMatrix<0,4,8,12>
-    mul r1, r0.x, c5
-    mul r2, r0.y, c6
-    add r1, r1, r2
-    mul r2, r0.z, c7
-    add r1, r1, r2
-    mul r0, r0.w, c8
-    add r0, r0, r1
-    mov r1, c12  // PerObject::worldMatrix<1,5,9,13>
-    mul r2, r1.x, c5
-    mul r3, r1.y, c6
-    add r2, r2, r3
-    mul r3, r1.z, c7
-    add r2, r2, r3
-    mul r1, r1.w, c8
-    add r1, r1, r2
-    mov r2, c13  // PerObject::worldMatrix<2,6,10,14>
-    mul r3, r2.x, c5
-    mul r4, r2.y, c6
-    add r3, r3, r4
-    mul r4, r2.z, c7
-    add r3, r3, r4
-    mul r2, r2.w, c8
-    add r2, r2, r3
-    mov r3, c5  // PerFrame::viewMatrix<0,4,8,12>
-    mul r3, r3, c14.x
-    mov r4, c6  // PerFrame::viewMatrix<1,5,9,13>
-    mul r4, r4, c14.y
-    add r3, r3, r4
-    mov r4, c7  // PerFrame::viewMatrix<2,6,10,14>
-    mul r4, r4, c14.z
-    add r3, r3, r4
-    mov r4, c8  // PerFrame::viewMatrix<3,7,11,15>
-    mul r4, r4, c14.w
-    add r3, r3, r4
-    mul r4, r0.x, c1
-    mul r5, r0.y, c2
-    add r4, r4, r5
-    mul r5, r0.z, c3
-    add r4, r4, r5
-    mul r0, r0.w, c4
-    add r0, r0, r4
-    mul r4, r1.x, c1
-    mul r5, r1.y, c2
-    add r4, r4, r5
-    mul r5, r1.z, c3
-    add r4, r4, r5
-    mul r1, r1.w, c4
-    add r1, r1, r4
-    mul r4, r2.x, c1
-    mul r5, r2.y, c2
-    add r4, r4, r5
-    mul r5, r2.z, c3
-    add r4, r4, r5
-    mul r2, r2.w, c4
-    add r2, r2, r4
-    mul r4, r3.x, c1
-    mul r5, r3.y, c2
-    add r4, r4, r5
-    mul r5, r3.z, c3
-    add r4, r4, r5
-    mul r3, r3.w, c4
-    add r3, r3, r4
-    mov r4.x, r0.x  // ::mvp<0>
-    mov r4.y, r1.x  // ::mvp<1>
-    mov r4.z, r2.x  // ::mvp<2>
-    mov r4.w, r3.x  // ::mvp<3>
-    mov r5.x, r0.y  // ::mvp<4>
-    mov r5.y, r1.y  // ::mvp<5>
-    mov r5.z, r2.y  // ::mvp<6>
-    mov r5.w, r3.y  // ::mvp<7>
-    mov r6.x, r0.z  // ::mvp<8>
-    mov r6.y, r1.z  // ::mvp<9>
-    mov r6.z, r2.z  // ::mvp<10>
-    mov r6.w, r3.z  // ::mvp<11>
-    mov r3.x, r0.w  // ::mvp<12>
-    mov r3.y, r1.w  // ::mvp<13>
-    mov r3.z, r2.w  // ::mvp<14>
-    mov r3.w, r3.w  // ::mvp<15>
-    mul r0, v0.xyzx, c15.xxxy
-    add r0, r0, c15.yyyx
-    dp4 r0.x, r4, r0  // ::OUT<16>
-    mul r1, v0.xyzx, c15.xxxy
-    add r1, r1, c15.yyyx
-    dp4 r0.y, r5, r1  // ::OUT<17>
-    mul r1, v0.xyzx, c15.xxxy
-    add r1, r1, c15.yyyx
-    dp4 r0.z, r6, r1  // ::OUT<18>
-    mul r1, v0.xyzx, c15.xxxy
-    add r1, r1, c15.yyyx
-    dp4 r0.w, r3, r1  // ::OUT<19>
-    mul r1, v0.xyzx, c15.xxxy
-    add r1, r1, c15.yyyx
-    dp4 r1.x, r1, c11  // ::OUT<0>
-    mul r2, v0.xyzx, c15.xxxy
-    add r2, r2, c15.yyyx
-    dp4 r1.y, r2, c12  // ::OUT<1>
-    mul r2, v0.xyzx, c15.xxxy
-    add r2, r2, c15.yyyx
-    dp4 r1.z, r2, c13  // ::OUT<2>
-
-#line 44
-    dp3 r1.w, v1, v1
-    rsq r1.w, r1.w
-    mul r2.xyz, r1.w, v1  // ::OUT<3,4,5>
-
-#line 47
-    mul r3, v2.xyzx, c15.xxxy
-    add r3, r3, c15.yyyx  // ::OUT<6,7,8,9>
-
-#line 51
-    mov r4.xyz, c9  // ::OUT<10,11,12>
-    mov r5.xyz, c10  // ::OUT<13,14,15>
-    mov oT2, r3  // ::SimpleVertexShader<6,7,8,9>
-    mov oT0.xyz, r1  // ::SimpleVertexShader<0,1,2>
-    mov oT1.xyz, r2  // ::SimpleVertexShader<3,4,5>
-    mov oT3.xyz, r4  // ::SimpleVertexShader<10,11,12>
-    mov oT4.xyz, r5  // ::SimpleVertexShader<13,14,15>
-    mov r0, r0  // ::SimpleVertexShader<16,17,18,19>
-
-#line 35
-    mul r1.xy, r0.w, c0
-    add oPos.xy, r0, r1  // ::SimpleVertexShader<16,17>
-    mov oPos.zw, r0  // ::SimpleVertexShader<18,19>
-
-// approximately 116 instruction slots used
-vs_4_0
-dcl_constantbuffer CB0[4], immediateIndexed
-dcl_constantbuffer CB1[6], immediateIndexed
-dcl_constantbuffer CB2[4], immediateIndexed
-dcl_input v0.xyz
-dcl_input v1.xyz
-dcl_input v2.xyz
-dcl_output o0.xyz
-dcl_output o1.xyz
-dcl_output o2.xyzw
-dcl_output o3.xyz
-dcl_output o4.xyz
-dcl_output_siv o5.xyzw, position
-dcl_temps 7
-//
-// Initial variable locations:
-//   v0.x <- IN.position.x; v0.y <- IN.position.y; v0.z <- IN.position.z; 
-//   v1.x <- IN.normal.x; v1.y <- IN.normal.y; v1.z <- IN.normal.z; 
-//   v2.x <- IN.color.x; v2.y <- IN.color.y; v2.z <- IN.color.z; 
-//   o5.x <- <SimpleVertexShader return value>.position.x; o5.y <- <SimpleVertexShader return value>.position.y; o5.z <- <SimpleVertexShader return value>.position.z; o5.w <- <SimpleVertexShader return value>.position.w; 
-//   o4.x <- <SimpleVertexShader return value>.light.x; o4.y <- <SimpleVertexShader return value>.light.y; o4.z <- <SimpleVertexShader return value>.light.z; 
-//   o3.x <- <SimpleVertexShader return value>.view.x; o3.y <- <SimpleVertexShader return value>.view.y; o3.z <- <SimpleVertexShader return value>.view.z; 
-//   o2.x <- <SimpleVertexShader return value>.color.x; o2.y <- <SimpleVertexShader return value>.color.y; o2.z <- <SimpleVertexShader return value>.color.z; o2.w <- <SimpleVertexShader return value>.color.w; 
-//   o1.x <- <SimpleVertexShader return value>.normal.x; o1.y <- <SimpleVertexShader return value>.normal.y; o1.z <- <SimpleVertexShader return value>.normal.z; 
-//   o0.x <- <SimpleVertexShader return value>.worldPos.x; o0.y <- <SimpleVertexShader return value>.worldPos.y; o0.z <- <SimpleVertexShader return value>.worldPos.z
-//
-#line 39 "E:\Projects\Nickel\Nickel\Data\Shaders\SimpleVertexShader.hlsl"
-mul r0.xyzw, cb1[0].xyzw, cb2[0].xxxx
-mul r1.xyzw, cb1[1].xyzw, cb2[0].yyyy
-add r0.xyzw, r0.xyzw, r1.xyzw
-mul r1.xyzw, cb1[2].xyzw, cb2[0].zzzz
-add r0.xyzw, r0.xyzw, r1.xyzw
-mul r1.xyzw, cb1[3].xyzw, cb2[0].wwww
-add r0.xyzw, r0.xyzw, r1.xyzw
-mul r1.xyzw, cb1[0].xyzw, cb2[1].xxxx
-mul r2.xyzw, cb1[1].xyzw, cb2[1].yyyy
-add r1.xyzw, r1.xyzw, r2.xyzw
-mul r2.xyzw, cb1[2].xyzw, cb2[1].zzzz
-add r1.xyzw, r1.xyzw, r2.xyzw
-mul r2.xyzw, cb1[3].xyzw, cb2[1].wwww
-add r1.xyzw, r1.xyzw, r2.xyzw
-mul r2.xyzw, cb1[0].xyzw, cb2[2].xxxx
-mul r3.xyzw, cb1[1].xyzw, cb2[2].yyyy
-add r2.xyzw, r2.xyzw, r3.xyzw
-mul r3.xyzw, cb1[2].xyzw, cb2[2].zzzz
-add r2.xyzw, r2.xyzw, r3.xyzw
-mul r3.xyzw, cb1[3].xyzw, cb2[2].wwww
-add r2.xyzw, r2.xyzw, r3.xyzw
-mul r3.xyzw, cb1[0].xyzw, cb2[3].xxxx
-mul r4.xyzw, cb1[1].xyzw, cb2[3].yyyy
-add r3.xyzw, r3.xyzw, r4.xyzw
-mul r4.xyzw, cb1[2].xyzw, cb2[3].zzzz
-add r3.xyzw, r3.xyzw, r4.xyzw
-mul r4.xyzw, cb1[3].xyzw, cb2[3].wwww
-add r3.xyzw, r3.xyzw, r4.xyzw
-mul r4.xyzw, r0.xxxx, cb0[0].xyzw
-mul r5.xyzw, r0.yyyy, cb0[1].xyzw
-add r4.xyzw, r4.xyzw, r5.xyzw
-mul r5.xyzw, r0.zzzz, cb0[2].xyzw
-add r4.xyzw, r4.xyzw, r5.xyzw
-mul r0.xyzw, r0.wwww, cb0[3].xyzw
-add r0.xyzw, r0.xyzw, r4.xyzw
-mul r4.xyzw, r1.xxxx, cb0[0].xyzw
-mul r5.xyzw, r1.yyyy, cb0[1].xyzw
-add r4.xyzw, r4.xyzw, r5.xyzw
-mul r5.xyzw, r1.zzzz, cb0[2].xyzw
-add r4.xyzw, r4.xyzw, r5.xyzw
-mul r1.xyzw, r1.wwww, cb0[3].xyzw
-add r1.xyzw, r1.xyzw, r4.xyzw
-mul r4.xyzw, r2.xxxx, cb0[0].xyzw
-mul r5.xyzw, r2.yyyy, cb0[1].xyzw
-add r4.xyzw, r4.xyzw, r5.xyzw
-mul r5.xyzw, r2.zzzz, cb0[2].xyzw
-add r4.xyzw, r4.xyzw, r5.xyzw
-mul r2.xyzw, r2.wwww, cb0[3].xyzw
-add r2.xyzw, r2.xyzw, r4.xyzw
-mul r4.xyzw, r3.xxxx, cb0[0].xyzw
-mul r5.xyzw, r3.yyyy, cb0[1].xyzw
-add r4.xyzw, r4.xyzw, r5.xyzw
-mul r5.xyzw, r3.zzzz, cb0[2].xyzw
-add r4.xyzw, r4.xyzw, r5.xyzw
-mul r3.xyzw, r3.wwww, cb0[3].xyzw
-add r3.xyzw, r3.xyzw, r4.xyzw
-mov r4.x, r0.x  // r4.x <- mvp._m00
-mov r4.y, r1.x  // r4.y <- mvp._m01
-mov r4.z, r2.x  // r4.z <- mvp._m02
-mov r4.w, r3.x  // r4.w <- mvp._m03
-mov r5.x, r0.y  // r5.x <- mvp._m10
-mov r5.y, r1.y  // r5.y <- mvp._m11
-mov r5.z, r2.y  // r5.z <- mvp._m12
-mov r5.w, r3.y  // r5.w <- mvp._m13
-mov r6.x, r0.z  // r6.x <- mvp._m20
-mov r6.y, r1.z  // r6.y <- mvp._m21
-mov r6.z, r2.z  // r6.z <- mvp._m22
-mov r6.w, r3.z  // r6.w <- mvp._m23
-mov r3.x, r0.w  // r3.x <- mvp._m30
-mov r3.y, r1.w  // r3.y <- mvp._m31
-mov r3.z, r2.w  // r3.z <- mvp._m32
-mov r3.w, r3.w  // r3.w <- mvp._m33
-
-#line 40
-mov r0.xyz, v0.xyzx
-mov r0.w, l(1.000000)
-dp4 r1.x, r4.xyzw, r0.xyzw  // r1.x <- OUT.position.x
-dp4 r1.y, r5.xyzw, r0.xyzw  // r1.y <- OUT.position.y
-dp4 r1.z, r6.xyzw, r0.xyzw  // r1.z <- OUT.position.z
-dp4 r1.w, r3.xyzw, r0.xyzw  // r1.w <- OUT.position.w
-
-#line 41
-dp4 r2.x, r0.xyzw, cb2[0].xyzw  // r2.x <- OUT.worldPos.x
-dp4 r2.y, r0.xyzw, cb2[1].xyzw  // r2.y <- OUT.worldPos.y
-dp4 r2.z, r0.xyzw, cb2[2].xyzw  // r2.z <- OUT.worldPos.z
-
-#line 44
-dp3 r0.x, v1.xyzx, v1.xyzx
-rsq r0.x, r0.x
-mul r0.xyz, r0.xxxx, v1.xyzx  // r0.x <- OUT.normal.x; r0.y <- OUT.normal.y; r0.z <- OUT.normal.z
-
-#line 47
-mov r3.xyz, v2.xyzx  // r3.x <- OUT.color.x; r3.y <- OUT.color.y; r3.z <- OUT.color.z
-mov r3.w, l(1.000000)  // r3.w <- OUT.color.w
-
-#line 51
-mov r4.xyz, cb1[4].xyzx  // r4.x <- OUT.view.x; r4.y <- OUT.view.y; r4.z <- OUT.view.z
-
-#line 52
-mov r5.xyz, cb1[5].xyzx  // r5.x <- OUT.light.x; r5.y <- OUT.light.y; r5.z <- OUT.light.z
-
-#line 54
-mov o2.xyzw, r3.xyzw
-mov o5.xyzw, r1.xyzw
-mov o0.xyz, r2.xyzx
-mov o1.xyz, r0.xyzx
-mov o3.xyz, r4.xyzx
-mov o4.xyz, r5.xyzx
-ret 
-// Approximately 95 instruction slots used
-#endif
-
-const BYTE g_SimpleVertexShader[] =
-{
-     68,  88,  66,  67, 181, 206, 
-    164, 104, 219, 134, 126, 107, 
-      8, 138, 102,  77,  39, 168, 
-    201,  92,   1,   0,   0,   0, 
-     92, 100,   0,   0,   7,   0, 
-      0,   0,  60,   0,   0,   0, 
-    180,  15,   0,   0, 164,  26, 
-      0,   0, 172,  96,   0,   0, 
-     40,  97,   0,   0,  24,  99, 
-      0,   0, 136,  99,   0,   0, 
-     65, 111, 110,  57, 112,  15, 
-      0,   0, 112,  15,   0,   0, 
-      0,   2, 254, 255,  36,  15, 
-      0,   0,  76,   0,   0,   0, 
-      3,   0,  36,   0,   0,   0, 
-     72,   0,   0,   0,  72,   0, 
-      0,   0,  36,   0,   1,   0, 
-     72,   0,   0,   0,   0,   0, 
-      4,   0,   1,   0,   0,   0, 
-      0,   0,   1,   0,   0,   0, 
-      6,   0,   5,   0,   0,   0, 
-      0,   0,   2,   0,   0,   0, 
-      4,   0,  11,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      1,   2, 254, 255, 254, 255, 
-      8,   2,  68,  66,  85,  71, 
-     40,   0,   0,   0, 244,   7, 
-      0,   0,   0,   0,   0,   0, 
-      1,   0,   0,   0, 104,   0, 
-      0,   0, 120,   0,   0,   0, 
-    108,   0,   0,   0,   6,   0, 
-      0,   0, 124,   7,   0,   0, 
-     44,   4,   0,   0,  69,  58, 
-     92,  80, 114, 111, 106, 101, 
-     99, 116, 115,  92,  78, 105, 
-     99, 107, 101, 108,  92,  78, 
-    105,  99, 107, 101, 108,  92, 
-     68,  97, 116,  97,  92,  83, 
-    104,  97, 100, 101, 114, 115, 
-     92,  83, 105, 109, 112, 108, 
-    101,  86, 101, 114, 116, 101, 
-    120,  83, 104,  97, 100, 101, 
-    114,  46, 104, 108, 115, 108, 
-      0, 171,  40,   0,   0,   0, 
-      0,   0, 255, 255,  40,   8, 
-      0,   0,   0,   0, 255, 255, 
-     64,   8,   0,   0,   0,   0, 
-    255, 255,  76,   8,   0,   0, 
-      0,   0, 255, 255,  88,   8, 
-      0,   0,  39,   0,   0,   0, 
-    100,   8,   0,   0,  39,   0, 
-      0,   0, 112,   8,   0,   0, 
-     39,   0,   0,   0, 128,   8, 
-      0,   0,  39,   0,   0,   0, 
-    144,   8,   0,   0,  39,   0, 
-      0,   0, 160,   8,   0,   0, 
-     39,   0,   0,   0, 176,   8, 
-      0,   0,  39,   0,   0,   0, 
-    192,   8,   0,   0,  39,   0, 
-      0,   0, 208,   8,   0,   0, 
-     39,   0,   0,   0, 224,   8, 
-      0,   0,  39,   0,   0,   0, 
-    236,   8,   0,   0,  39,   0, 
-      0,   0, 252,   8,   0,   0, 
-     39,   0,   0,   0,  12,   9, 
-      0,   0,  39,   0,   0,   0, 
-     28,   9,   0,   0,  39,   0, 
-      0,   0,  44,   9,   0,   0, 
-     39,   0,   0,   0,  60,   9, 
-      0,   0,  39,   0,   0,   0, 
-     76,   9,   0,   0,  39,   0, 
-      0,   0,  92,   9,   0,   0, 
-     39,   0,   0,   0, 104,   9, 
-      0,   0,  39,   0,   0,   0, 
-    120,   9,   0,   0,  39,   0, 
-      0,   0, 136,   9,   0,   0, 
-     39,   0,   0,   0, 152,   9, 
-      0,   0,  39,   0,   0,   0, 
-    168,   9,   0,   0,  39,   0, 
-      0,   0, 184,   9,   0,   0, 
-     39,   0,   0,   0, 200,   9, 
-      0,   0,  39,   0,   0,   0, 
-    216,   9,   0,   0,  39,   0, 
-      0,   0, 228,   9,   0,   0, 
-     39,   0,   0,   0, 244,   9, 
-      0,   0,  39,   0,   0,   0, 
-      0,  10,   0,   0,  39,   0, 
-      0,   0,  16,  10,   0,   0, 
-     39,   0,   0,   0,  32,  10, 
-      0,   0,  39,   0,   0,   0, 
-     44,  10,   0,   0,  39,   0, 
-      0,   0,  60,  10,   0,   0, 
-     39,   0,   0,   0,  76,  10, 
-      0,   0,  39,   0,   0,   0, 
-     88,  10,   0,   0,  39,   0, 
-      0,   0, 104,  10,   0,   0, 
-     39,   0,   0,   0, 120,  10, 
-      0,   0,  39,   0,   0,   0, 
-    136,  10,   0,   0,  39,   0, 
-      0,   0, 152,  10,   0,   0, 
-     39,   0,   0,   0, 168,  10, 
-      0,   0,  39,   0,   0,   0, 
-    184,  10,   0,   0,  39,   0, 
-      0,   0, 200,  10,   0,   0, 
-     39,   0,   0,   0, 216,  10, 
-      0,   0,  39,   0,   0,   0, 
-    232,  10,   0,   0,  39,   0, 
-      0,   0, 248,  10,   0,   0, 
-     39,   0,   0,   0,   8,  11, 
-      0,   0,  39,   0,   0,   0, 
-     24,  11,   0,   0,  39,   0, 
-      0,   0,  40,  11,   0,   0, 
-     39,   0,   0,   0,  56,  11, 
-      0,   0,  39,   0,   0,   0, 
-     72,  11,   0,   0,  39,   0, 
-      0,   0,  88,  11,   0,   0, 
-     39,   0,   0,   0, 104,  11, 
-      0,   0,  39,   0,   0,   0, 
-    120,  11,   0,   0,  39,   0, 
-      0,   0, 136,  11,   0,   0, 
-     39,   0,   0,   0, 152,  11, 
-      0,   0,  39,   0,   0,   0, 
-    168,  11,   0,   0,  39,   0, 
-      0,   0, 184,  11,   0,   0, 
-     39,   0,   0,   0, 200,  11, 
-      0,   0,  39,   0,   0,   0, 
-    216,  11,   0,   0,  39,   0, 
-      0,   0, 232,  11,   0,   0, 
-     39,   0,   0,   0, 248,  11, 
-      0,   0,  39,   0,   0,   0, 
-      8,  12,   0,   0,  39,   0, 
-      0,   0,  24,  12,   0,   0, 
-     39,   0,   0,   0,  40,  12, 
-      0,   0,  39,   0,   0,   0, 
-     56,  12,   0,   0,  39,   0, 
-      0,   0,  68,  12,   0,   0, 
-     39,   0,   0,   0,  80,  12, 
-      0,   0,  39,   0,   0,   0, 
-     92,  12,   0,   0,  39,   0, 
-      0,   0, 104,  12,   0,   0, 
-     39,   0,   0,   0, 116,  12, 
-      0,   0,  39,   0,   0,   0, 
-    128,  12,   0,   0,  39,   0, 
-      0,   0, 140,  12,   0,   0, 
-     39,   0,   0,   0, 152,  12, 
-      0,   0,  39,   0,   0,   0, 
-    164,  12,   0,   0,  39,   0, 
-      0,   0, 176,  12,   0,   0, 
-     39,   0,   0,   0, 188,  12, 
-      0,   0,  39,   0,   0,   0, 
-    200,  12,   0,   0,  39,   0, 
-      0,   0, 212,  12,   0,   0, 
-     39,   0,   0,   0, 224,  12, 
-      0,   0,  39,   0,   0,   0, 
-    236,  12,   0,   0,  40,   0, 
-      0,   0, 248,  12,   0,   0, 
-     40,   0,   0,   0,   8,  13, 
-      0,   0,  40,   0,   0,   0, 
-     24,  13,   0,   0,  40,   0, 
-      0,   0,  40,  13,   0,   0, 
-     40,   0,   0,   0,  56,  13, 
-      0,   0,  40,   0,   0,   0, 
-     72,  13,   0,   0,  40,   0, 
-      0,   0,  88,  13,   0,   0, 
-     40,   0,   0,   0, 104,  13, 
-      0,   0,  40,   0,   0,   0, 
-    120,  13,   0,   0,  40,   0, 
-      0,   0, 136,  13,   0,   0, 
-     40,   0,   0,   0, 152,  13, 
-      0,   0,  40,   0,   0,   0, 
-    168,  13,   0,   0,  41,   0, 
-      0,   0, 184,  13,   0,   0, 
-     41,   0,   0,   0, 200,  13, 
-      0,   0,  41,   0,   0,   0, 
-    216,  13,   0,   0,  41,   0, 
-      0,   0, 232,  13,   0,   0, 
-     41,   0,   0,   0, 248,  13, 
-      0,   0,  41,   0,   0,   0, 
-      8,  14,   0,   0,  41,   0, 
-      0,   0,  24,  14,   0,   0, 
-     41,   0,   0,   0,  40,  14, 
-      0,   0,  41,   0,   0,   0, 
-     56,  14,   0,   0,  44,   0, 
-      0,   0,  72,  14,   0,   0, 
-     44,   0,   0,   0,  88,  14, 
-      0,   0,  44,   0,   0,   0, 
-    100,  14,   0,   0,  47,   0, 
-      0,   0, 116,  14,   0,   0, 
-     47,   0,   0,   0, 132,  14, 
-      0,   0,  51,   0,   0,   0, 
-    148,  14,   0,   0,  52,   0, 
-      0,   0, 160,  14,   0,   0, 
-     54,   0,   0,   0, 172,  14, 
-      0,   0,  54,   0,   0,   0, 
-    184,  14,   0,   0,  54,   0, 
-      0,   0, 196,  14,   0,   0, 
-     54,   0,   0,   0, 208,  14, 
-      0,   0,  54,   0,   0,   0, 
-    220,  14,   0,   0,  54,   0, 
-      0,   0, 232,  14,   0,   0, 
-     35,   0,   0,   0, 244,  14, 
-      0,   0,  35,   0,   0,   0, 
-      4,  15,   0,   0,  35,   0, 
-      0,   0,  20,  15,   0,   0, 
-     83, 105, 109, 112, 108, 101, 
-     86, 101, 114, 116, 101, 120, 
-     83, 104,  97, 100, 101, 114, 
-      0,  73,  78,   0, 112, 111, 
-    115, 105, 116, 105, 111, 110, 
-      0, 171,   1,   0,   3,   0, 
-      1,   0,   3,   0,   1,   0, 
-      0,   0,   0,   0,   0,   0, 
-    110, 111, 114, 109,  97, 108, 
-      0,  99, 111, 108, 111, 114, 
-      0, 171, 171, 171,  66,   4, 
-      0,   0,  76,   4,   0,   0, 
-     92,   4,   0,   0,  76,   4, 
-      0,   0,  99,   4,   0,   0, 
-     76,   4,   0,   0,   5,   0, 
-      0,   0,   1,   0,   9,   0, 
-      1,   0,   3,   0, 108,   4, 
-      0,   0,   1,   0,   0,   0, 
-      0,   0,   1,   0,   2,   0, 
-    255, 255,   2,   0,   0,   0, 
-      3,   0,   4,   0,   5,   0, 
-    255, 255,   3,   0,   0,   0, 
-      6,   0,   7,   0,   8,   0, 
-    255, 255,  79,  85,  84,   0, 
-    119, 111, 114, 108, 100,  80, 
-    111, 115,   0, 171, 171, 171, 
-      1,   0,   3,   0,   1,   0, 
-      4,   0,   1,   0,   0,   0, 
-      0,   0,   0,   0, 118, 105, 
-    101, 119,   0, 108, 105, 103, 
-    104, 116,   0, 171, 188,   4, 
-      0,   0,  76,   4,   0,   0, 
-     92,   4,   0,   0,  76,   4, 
-      0,   0,  99,   4,   0,   0, 
-    200,   4,   0,   0, 216,   4, 
-      0,   0,  76,   4,   0,   0, 
-    221,   4,   0,   0,  76,   4, 
-      0,   0,  66,   4,   0,   0, 
-    200,   4,   0,   0,   5,   0, 
-      0,   0,   1,   0,  20,   0, 
-      1,   0,   6,   0, 228,   4, 
-      0,   0,  85,   0,   0,   0, 
-     16,   0, 255, 255, 255, 255, 
-    255, 255,  88,   0,   0,   0, 
-    255, 255,  17,   0, 255, 255, 
-    255, 255,  91,   0,   0,   0, 
-    255, 255, 255, 255,  18,   0, 
-    255, 255,  94,   0,   0,   0, 
-    255, 255, 255, 255, 255, 255, 
-     19,   0,  97,   0,   0,   0, 
-      0,   0, 255, 255, 255, 255, 
-    255, 255, 100,   0,   0,   0, 
-    255, 255,   1,   0, 255, 255, 
-    255, 255, 103,   0,   0,   0, 
-    255, 255, 255, 255,   2,   0, 
-    255, 255, 106,   0,   0,   0, 
-      3,   0,   4,   0,   5,   0, 
-    255, 255, 108,   0,   0,   0, 
-      6,   0,   7,   0,   8,   0, 
-      9,   0, 109,   0,   0,   0, 
-     10,   0,  11,   0,  12,   0, 
-    255, 255, 110,   0,   0,   0, 
-     13,   0,  14,   0,  15,   0, 
-    255, 255,   5,   0,   0,   0, 
-      1,   0,  20,   0,   1,   0, 
-      6,   0, 228,   4,   0,   0, 
-    111,   0,   0,   0,   6,   0, 
-      7,   0,   8,   0,   9,   0, 
-    112,   0,   0,   0,   0,   0, 
-      1,   0,   2,   0, 255, 255, 
-    113,   0,   0,   0,   3,   0, 
-      4,   0,   5,   0, 255, 255, 
-    114,   0,   0,   0,  10,   0, 
-     11,   0,  12,   0, 255, 255, 
-    115,   0,   0,   0,  13,   0, 
-     14,   0,  15,   0, 255, 255, 
-    116,   0,   0,   0,  16,   0, 
-     17,   0,  18,   0,  19,   0, 
-    118,   0,   0,   0,  16,   0, 
-     17,   0, 255, 255, 255, 255, 
-    119,   0,   0,   0, 255, 255, 
-    255, 255,  18,   0,  19,   0, 
-    109, 118, 112,   0,   3,   0, 
-      3,   0,   4,   0,   4,   0, 
-      1,   0,   0,   0,   0,   0, 
-      0,   0,  67,   0,   0,   0, 
-      0,   0, 255, 255, 255, 255, 
-    255, 255,  68,   0,   0,   0, 
-    255, 255,   1,   0, 255, 255, 
-    255, 255,  69,   0,   0,   0, 
-    255, 255, 255, 255,   2,   0, 
-    255, 255,  70,   0,   0,   0, 
-    255, 255, 255, 255, 255, 255, 
-      3,   0,  71,   0,   0,   0, 
-      4,   0, 255, 255, 255, 255, 
-    255, 255,  72,   0,   0,   0, 
-    255, 255,   5,   0, 255, 255, 
-    255, 255,  73,   0,   0,   0, 
-    255, 255, 255, 255,   6,   0, 
-    255, 255,  74,   0,   0,   0, 
-    255, 255, 255, 255, 255, 255, 
-      7,   0,  75,   0,   0,   0, 
-      8,   0, 255, 255, 255, 255, 
-    255, 255,  76,   0,   0,   0, 
-    255, 255,   9,   0, 255, 255, 
-    255, 255,  77,   0,   0,   0, 
-    255, 255, 255, 255,  10,   0, 
-    255, 255,  78,   0,   0,   0, 
-    255, 255, 255, 255, 255, 255, 
-     11,   0,  79,   0,   0,   0, 
-     12,   0, 255, 255, 255, 255, 
-    255, 255,  80,   0,   0,   0, 
-    255, 255,  13,   0, 255, 255, 
-    255, 255,  81,   0,   0,   0, 
-    255, 255, 255, 255,  14,   0, 
-    255, 255,  82,   0,   0,   0, 
-    255, 255, 255, 255, 255, 255, 
-     15,   0,  80, 101, 114,  70, 
-    114,  97, 109, 101,   0, 118, 
-    105, 101, 119,  77,  97, 116, 
-    114, 105, 120,   0,   3,   0, 
-      3,   0,   4,   0,   4,   0, 
-      1,   0,   0,   0,   0,   0, 
-      0,   0,  28,   0,   0,   0, 
-      0,   0,   4,   0,   8,   0, 
-     12,   0,  30,   0,   0,   0, 
-      1,   0,   5,   0,   9,   0, 
-     13,   0,  33,   0,   0,   0, 
-      2,   0,   6,   0,  10,   0, 
-     14,   0,  36,   0,   0,   0, 
-      3,   0,   7,   0,  11,   0, 
-     15,   0,  80, 101, 114,  79, 
-     98, 106, 101,  99, 116,   0, 
-    119, 111, 114, 108, 100,  77, 
-     97, 116, 114, 105, 120,   0, 
-    171, 171,   4,   0,   0,   0, 
-      0,   0,   4,   0,   8,   0, 
-     12,   0,  12,   0,   0,   0, 
-      1,   0,   5,   0,   9,   0, 
-     13,   0,  20,   0,   0,   0, 
-      2,   0,   6,   0,  10,   0, 
-     14,   0,  44,   4,   0,   0, 
-     63,   4,   0,   0, 132,   4, 
-      0,   0,   3,   0,   0,   0, 
-    148,   4,   0,   0,   0,   0, 
-      0,   0, 184,   4,   0,   0, 
-     20,   5,   0,   0,  11,   0, 
-      0,   0,  36,   5,   0,   0, 
-      0,   0,   0,   0,  44,   4, 
-      0,   0, 168,   5,   0,   0, 
-      8,   0,   0,   0, 184,   5, 
-      0,   0,   0,   0,   0,   0, 
-     24,   6,   0,   0,  28,   6, 
-      0,   0,  16,   0,   0,   0, 
-     44,   6,   0,   0, 236,   6, 
-      0,   0, 245,   6,   0,   0, 
-      0,   7,   0,   0,   4,   0, 
-      0,   0,  16,   7,   0,   0, 
-     64,   7,   0,   0,  74,   7, 
-      0,   0,   0,   7,   0,   0, 
-      3,   0,   0,   0,  88,   7, 
-      0,   0,  77, 105,  99, 114, 
-    111, 115, 111, 102, 116,  32, 
-     40,  82,  41,  32,  72,  76, 
-     83,  76,  32,  83, 104,  97, 
-    100, 101, 114,  32,  67, 111, 
-    109, 112, 105, 108, 101, 114, 
-     32,  49,  48,  46,  49,   0, 
-     81,   0,   0,   5,  15,   0, 
-     15, 160,   0,   0, 128,  63, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-     31,   0,   0,   2,   5,   0, 
-      0, 128,   0,   0,  15, 144, 
-     31,   0,   0,   2,   5,   0, 
-      1, 128,   1,   0,  15, 144, 
-     31,   0,   0,   2,   5,   0, 
-      2, 128,   2,   0,  15, 144, 
-      1,   0,   0,   2,   0,   0, 
-     15, 128,  11,   0, 228, 160, 
-      5,   0,   0,   3,   1,   0, 
-     15, 128,   0,   0,   0, 128, 
-      5,   0, 228, 160,   5,   0, 
-      0,   3,   2,   0,  15, 128, 
-      0,   0,  85, 128,   6,   0, 
-    228, 160,   2,   0,   0,   3, 
-      1,   0,  15, 128,   1,   0, 
-    228, 128,   2,   0, 228, 128, 
-      5,   0,   0,   3,   2,   0, 
-     15, 128,   0,   0, 170, 128, 
-      7,   0, 228, 160,   2,   0, 
-      0,   3,   1,   0,  15, 128, 
-      1,   0, 228, 128,   2,   0, 
-    228, 128,   5,   0,   0,   3, 
-      0,   0,  15, 128,   0,   0, 
-    255, 128,   8,   0, 228, 160, 
-      2,   0,   0,   3,   0,   0, 
-     15, 128,   0,   0, 228, 128, 
-      1,   0, 228, 128,   1,   0, 
-      0,   2,   1,   0,  15, 128, 
-     12,   0, 228, 160,   5,   0, 
-      0,   3,   2,   0,  15, 128, 
-      1,   0,   0, 128,   5,   0, 
-    228, 160,   5,   0,   0,   3, 
-      3,   0,  15, 128,   1,   0, 
-     85, 128,   6,   0, 228, 160, 
-      2,   0,   0,   3,   2,   0, 
-     15, 128,   2,   0, 228, 128, 
-      3,   0, 228, 128,   5,   0, 
-      0,   3,   3,   0,  15, 128, 
-      1,   0, 170, 128,   7,   0, 
-    228, 160,   2,   0,   0,   3, 
-      2,   0,  15, 128,   2,   0, 
-    228, 128,   3,   0, 228, 128, 
-      5,   0,   0,   3,   1,   0, 
-     15, 128,   1,   0, 255, 128, 
-      8,   0, 228, 160,   2,   0, 
-      0,   3,   1,   0,  15, 128, 
-      1,   0, 228, 128,   2,   0, 
-    228, 128,   1,   0,   0,   2, 
-      2,   0,  15, 128,  13,   0, 
-    228, 160,   5,   0,   0,   3, 
-      3,   0,  15, 128,   2,   0, 
-      0, 128,   5,   0, 228, 160, 
-      5,   0,   0,   3,   4,   0, 
-     15, 128,   2,   0,  85, 128, 
-      6,   0, 228, 160,   2,   0, 
-      0,   3,   3,   0,  15, 128, 
-      3,   0, 228, 128,   4,   0, 
-    228, 128,   5,   0,   0,   3, 
-      4,   0,  15, 128,   2,   0, 
-    170, 128,   7,   0, 228, 160, 
-      2,   0,   0,   3,   3,   0, 
-     15, 128,   3,   0, 228, 128, 
-      4,   0, 228, 128,   5,   0, 
-      0,   3,   2,   0,  15, 128, 
-      2,   0, 255, 128,   8,   0, 
-    228, 160,   2,   0,   0,   3, 
-      2,   0,  15, 128,   2,   0, 
-    228, 128,   3,   0, 228, 128, 
-      1,   0,   0,   2,   3,   0, 
-     15, 128,   5,   0, 228, 160, 
-      5,   0,   0,   3,   3,   0, 
-     15, 128,   3,   0, 228, 128, 
-     14,   0,   0, 160,   1,   0, 
-      0,   2,   4,   0,  15, 128, 
-      6,   0, 228, 160,   5,   0, 
-      0,   3,   4,   0,  15, 128, 
-      4,   0, 228, 128,  14,   0, 
-     85, 160,   2,   0,   0,   3, 
-      3,   0,  15, 128,   3,   0, 
-    228, 128,   4,   0, 228, 128, 
-      1,   0,   0,   2,   4,   0, 
-     15, 128,   7,   0, 228, 160, 
-      5,   0,   0,   3,   4,   0, 
-     15, 128,   4,   0, 228, 128, 
-     14,   0, 170, 160,   2,   0, 
-      0,   3,   3,   0,  15, 128, 
-      3,   0, 228, 128,   4,   0, 
-    228, 128,   1,   0,   0,   2, 
-      4,   0,  15, 128,   8,   0, 
-    228, 160,   5,   0,   0,   3, 
-      4,   0,  15, 128,   4,   0, 
-    228, 128,  14,   0, 255, 160, 
-      2,   0,   0,   3,   3,   0, 
-     15, 128,   3,   0, 228, 128, 
-      4,   0, 228, 128,   5,   0, 
-      0,   3,   4,   0,  15, 128, 
-      0,   0,   0, 128,   1,   0, 
-    228, 160,   5,   0,   0,   3, 
-      5,   0,  15, 128,   0,   0, 
-     85, 128,   2,   0, 228, 160, 
-      2,   0,   0,   3,   4,   0, 
-     15, 128,   4,   0, 228, 128, 
-      5,   0, 228, 128,   5,   0, 
-      0,   3,   5,   0,  15, 128, 
-      0,   0, 170, 128,   3,   0, 
-    228, 160,   2,   0,   0,   3, 
-      4,   0,  15, 128,   4,   0, 
-    228, 128,   5,   0, 228, 128, 
-      5,   0,   0,   3,   0,   0, 
-     15, 128,   0,   0, 255, 128, 
-      4,   0, 228, 160,   2,   0, 
-      0,   3,   0,   0,  15, 128, 
-      0,   0, 228, 128,   4,   0, 
-    228, 128,   5,   0,   0,   3, 
-      4,   0,  15, 128,   1,   0, 
-      0, 128,   1,   0, 228, 160, 
-      5,   0,   0,   3,   5,   0, 
-     15, 128,   1,   0,  85, 128, 
-      2,   0, 228, 160,   2,   0, 
-      0,   3,   4,   0,  15, 128, 
-      4,   0, 228, 128,   5,   0, 
-    228, 128,   5,   0,   0,   3, 
-      5,   0,  15, 128,   1,   0, 
-    170, 128,   3,   0, 228, 160, 
-      2,   0,   0,   3,   4,   0, 
-     15, 128,   4,   0, 228, 128, 
-      5,   0, 228, 128,   5,   0, 
-      0,   3,   1,   0,  15, 128, 
-      1,   0, 255, 128,   4,   0, 
-    228, 160,   2,   0,   0,   3, 
-      1,   0,  15, 128,   1,   0, 
-    228, 128,   4,   0, 228, 128, 
-      5,   0,   0,   3,   4,   0, 
-     15, 128,   2,   0,   0, 128, 
-      1,   0, 228, 160,   5,   0, 
-      0,   3,   5,   0,  15, 128, 
-      2,   0,  85, 128,   2,   0, 
-    228, 160,   2,   0,   0,   3, 
-      4,   0,  15, 128,   4,   0, 
-    228, 128,   5,   0, 228, 128, 
-      5,   0,   0,   3,   5,   0, 
-     15, 128,   2,   0, 170, 128, 
-      3,   0, 228, 160,   2,   0, 
-      0,   3,   4,   0,  15, 128, 
-      4,   0, 228, 128,   5,   0, 
-    228, 128,   5,   0,   0,   3, 
-      2,   0,  15, 128,   2,   0, 
-    255, 128,   4,   0, 228, 160, 
-      2,   0,   0,   3,   2,   0, 
-     15, 128,   2,   0, 228, 128, 
-      4,   0, 228, 128,   5,   0, 
-      0,   3,   4,   0,  15, 128, 
-      3,   0,   0, 128,   1,   0, 
-    228, 160,   5,   0,   0,   3, 
-      5,   0,  15, 128,   3,   0, 
-     85, 128,   2,   0, 228, 160, 
-      2,   0,   0,   3,   4,   0, 
-     15, 128,   4,   0, 228, 128, 
-      5,   0, 228, 128,   5,   0, 
-      0,   3,   5,   0,  15, 128, 
-      3,   0, 170, 128,   3,   0, 
-    228, 160,   2,   0,   0,   3, 
-      4,   0,  15, 128,   4,   0, 
-    228, 128,   5,   0, 228, 128, 
-      5,   0,   0,   3,   3,   0, 
-     15, 128,   3,   0, 255, 128, 
-      4,   0, 228, 160,   2,   0, 
-      0,   3,   3,   0,  15, 128, 
-      3,   0, 228, 128,   4,   0, 
-    228, 128,   1,   0,   0,   2, 
-      4,   0,   1, 128,   0,   0, 
-      0, 128,   1,   0,   0,   2, 
-      4,   0,   2, 128,   1,   0, 
-      0, 128,   1,   0,   0,   2, 
-      4,   0,   4, 128,   2,   0, 
-      0, 128,   1,   0,   0,   2, 
-      4,   0,   8, 128,   3,   0, 
-      0, 128,   1,   0,   0,   2, 
-      5,   0,   1, 128,   0,   0, 
-     85, 128,   1,   0,   0,   2, 
-      5,   0,   2, 128,   1,   0, 
-     85, 128,   1,   0,   0,   2, 
-      5,   0,   4, 128,   2,   0, 
-     85, 128,   1,   0,   0,   2, 
-      5,   0,   8, 128,   3,   0, 
-     85, 128,   1,   0,   0,   2, 
-      6,   0,   1, 128,   0,   0, 
-    170, 128,   1,   0,   0,   2, 
-      6,   0,   2, 128,   1,   0, 
-    170, 128,   1,   0,   0,   2, 
-      6,   0,   4, 128,   2,   0, 
-    170, 128,   1,   0,   0,   2, 
-      6,   0,   8, 128,   3,   0, 
-    170, 128,   1,   0,   0,   2, 
-      3,   0,   1, 128,   0,   0, 
-    255, 128,   1,   0,   0,   2, 
-      3,   0,   2, 128,   1,   0, 
-    255, 128,   1,   0,   0,   2, 
-      3,   0,   4, 128,   2,   0, 
-    255, 128,   1,   0,   0,   2, 
-      3,   0,   8, 128,   3,   0, 
-    255, 128,   5,   0,   0,   3, 
-      0,   0,  15, 128,   0,   0, 
-     36, 144,  15,   0,  64, 160, 
-      2,   0,   0,   3,   0,   0, 
-     15, 128,   0,   0, 228, 128, 
-     15,   0,  21, 160,   9,   0, 
-      0,   3,   0,   0,   1, 128, 
-      4,   0, 228, 128,   0,   0, 
-    228, 128,   5,   0,   0,   3, 
-      1,   0,  15, 128,   0,   0, 
-     36, 144,  15,   0,  64, 160, 
-      2,   0,   0,   3,   1,   0, 
-     15, 128,   1,   0, 228, 128, 
-     15,   0,  21, 160,   9,   0, 
-      0,   3,   0,   0,   2, 128, 
-      5,   0, 228, 128,   1,   0, 
-    228, 128,   5,   0,   0,   3, 
-      1,   0,  15, 128,   0,   0, 
-     36, 144,  15,   0,  64, 160, 
-      2,   0,   0,   3,   1,   0, 
-     15, 128,   1,   0, 228, 128, 
-     15,   0,  21, 160,   9,   0, 
-      0,   3,   0,   0,   4, 128, 
-      6,   0, 228, 128,   1,   0, 
-    228, 128,   5,   0,   0,   3, 
-      1,   0,  15, 128,   0,   0, 
-     36, 144,  15,   0,  64, 160, 
-      2,   0,   0,   3,   1,   0, 
-     15, 128,   1,   0, 228, 128, 
-     15,   0,  21, 160,   9,   0, 
-      0,   3,   0,   0,   8, 128, 
-      3,   0, 228, 128,   1,   0, 
-    228, 128,   5,   0,   0,   3, 
-      1,   0,  15, 128,   0,   0, 
-     36, 144,  15,   0,  64, 160, 
-      2,   0,   0,   3,   1,   0, 
-     15, 128,   1,   0, 228, 128, 
-     15,   0,  21, 160,   9,   0, 
-      0,   3,   1,   0,   1, 128, 
-      1,   0, 228, 128,  11,   0, 
-    228, 160,   5,   0,   0,   3, 
-      2,   0,  15, 128,   0,   0, 
-     36, 144,  15,   0,  64, 160, 
-      2,   0,   0,   3,   2,   0, 
-     15, 128,   2,   0, 228, 128, 
-     15,   0,  21, 160,   9,   0, 
-      0,   3,   1,   0,   2, 128, 
-      2,   0, 228, 128,  12,   0, 
-    228, 160,   5,   0,   0,   3, 
-      2,   0,  15, 128,   0,   0, 
-     36, 144,  15,   0,  64, 160, 
-      2,   0,   0,   3,   2,   0, 
-     15, 128,   2,   0, 228, 128, 
-     15,   0,  21, 160,   9,   0, 
-      0,   3,   1,   0,   4, 128, 
-      2,   0, 228, 128,  13,   0, 
-    228, 160,   8,   0,   0,   3, 
-      1,   0,   8, 128,   1,   0, 
-    228, 144,   1,   0, 228, 144, 
-      7,   0,   0,   2,   1,   0, 
-      8, 128,   1,   0, 255, 128, 
-      5,   0,   0,   3,   2,   0, 
-      7, 128,   1,   0, 255, 128, 
-      1,   0, 228, 144,   5,   0, 
-      0,   3,   3,   0,  15, 128, 
-      2,   0,  36, 144,  15,   0, 
-     64, 160,   2,   0,   0,   3, 
-      3,   0,  15, 128,   3,   0, 
-    228, 128,  15,   0,  21, 160, 
-      1,   0,   0,   2,   4,   0, 
-      7, 128,   9,   0, 228, 160, 
-      1,   0,   0,   2,   5,   0, 
-      7, 128,  10,   0, 228, 160, 
-      1,   0,   0,   2,   2,   0, 
-     15, 224,   3,   0, 228, 128, 
-      1,   0,   0,   2,   0,   0, 
-      7, 224,   1,   0, 228, 128, 
-      1,   0,   0,   2,   1,   0, 
-      7, 224,   2,   0, 228, 128, 
-      1,   0,   0,   2,   3,   0, 
-      7, 224,   4,   0, 228, 128, 
-      1,   0,   0,   2,   4,   0, 
-      7, 224,   5,   0, 228, 128, 
-      1,   0,   0,   2,   0,   0, 
-     15, 128,   0,   0, 228, 128, 
-      5,   0,   0,   3,   1,   0, 
-      3, 128,   0,   0, 255, 128, 
-      0,   0, 228, 160,   2,   0, 
-      0,   3,   0,   0,   3, 192, 
-      0,   0, 228, 128,   1,   0, 
-    228, 128,   1,   0,   0,   2, 
-      0,   0,  12, 192,   0,   0, 
-    228, 128, 255, 255,   0,   0, 
-     83,  72,  68,  82, 232,  10, 
-      0,   0,  64,   0,   1,   0, 
-    186,   2,   0,   0,  89,   0, 
-      0,   4,  70, 142,  32,   0, 
-      0,   0,   0,   0,   4,   0, 
-      0,   0,  89,   0,   0,   4, 
-     70, 142,  32,   0,   1,   0, 
-      0,   0,   6,   0,   0,   0, 
-     89,   0,   0,   4,  70, 142, 
-     32,   0,   2,   0,   0,   0, 
-      4,   0,   0,   0,  95,   0, 
-      0,   3, 114,  16,  16,   0, 
-      0,   0,   0,   0,  95,   0, 
-      0,   3, 114,  16,  16,   0, 
-      1,   0,   0,   0,  95,   0, 
-      0,   3, 114,  16,  16,   0, 
-      2,   0,   0,   0, 101,   0, 
-      0,   3, 114,  32,  16,   0, 
-      0,   0,   0,   0, 101,   0, 
-      0,   3, 114,  32,  16,   0, 
-      1,   0,   0,   0, 101,   0, 
-      0,   3, 242,  32,  16,   0, 
-      2,   0,   0,   0, 101,   0, 
-      0,   3, 114,  32,  16,   0, 
-      3,   0,   0,   0, 101,   0, 
-      0,   3, 114,  32,  16,   0, 
-      4,   0,   0,   0, 103,   0, 
-      0,   4, 242,  32,  16,   0, 
-      5,   0,   0,   0,   1,   0, 
-      0,   0, 104,   0,   0,   2, 
-      7,   0,   0,   0,  56,   0, 
-      0,   9, 242,   0,  16,   0, 
-      0,   0,   0,   0,  70, 142, 
-     32,   0,   1,   0,   0,   0, 
-      0,   0,   0,   0,   6, 128, 
-     32,   0,   2,   0,   0,   0, 
-      0,   0,   0,   0,  56,   0, 
-      0,   9, 242,   0,  16,   0, 
-      1,   0,   0,   0,  70, 142, 
-     32,   0,   1,   0,   0,   0, 
-      1,   0,   0,   0,  86, 133, 
-     32,   0,   2,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   7, 242,   0,  16,   0, 
-      0,   0,   0,   0,  70,  14, 
-     16,   0,   0,   0,   0,   0, 
-     70,  14,  16,   0,   1,   0, 
-      0,   0,  56,   0,   0,   9, 
-    242,   0,  16,   0,   1,   0, 
-      0,   0,  70, 142,  32,   0, 
-      1,   0,   0,   0,   2,   0, 
-      0,   0, 166, 138,  32,   0, 
-      2,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   7, 
-    242,   0,  16,   0,   0,   0, 
-      0,   0,  70,  14,  16,   0, 
-      0,   0,   0,   0,  70,  14, 
-     16,   0,   1,   0,   0,   0, 
-     56,   0,   0,   9, 242,   0, 
-     16,   0,   1,   0,   0,   0, 
-     70, 142,  32,   0,   1,   0, 
-      0,   0,   3,   0,   0,   0, 
-    246, 143,  32,   0,   2,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   7, 242,   0, 
-     16,   0,   0,   0,   0,   0, 
-     70,  14,  16,   0,   0,   0, 
-      0,   0,  70,  14,  16,   0, 
-      1,   0,   0,   0,  56,   0, 
-      0,   9, 242,   0,  16,   0, 
-      1,   0,   0,   0,  70, 142, 
-     32,   0,   1,   0,   0,   0, 
-      0,   0,   0,   0,   6, 128, 
-     32,   0,   2,   0,   0,   0, 
-      1,   0,   0,   0,  56,   0, 
-      0,   9, 242,   0,  16,   0, 
-      2,   0,   0,   0,  70, 142, 
-     32,   0,   1,   0,   0,   0, 
-      1,   0,   0,   0,  86, 133, 
-     32,   0,   2,   0,   0,   0, 
-      1,   0,   0,   0,   0,   0, 
-      0,   7, 242,   0,  16,   0, 
-      1,   0,   0,   0,  70,  14, 
-     16,   0,   1,   0,   0,   0, 
-     70,  14,  16,   0,   2,   0, 
-      0,   0,  56,   0,   0,   9, 
-    242,   0,  16,   0,   2,   0, 
-      0,   0,  70, 142,  32,   0, 
-      1,   0,   0,   0,   2,   0, 
-      0,   0, 166, 138,  32,   0, 
-      2,   0,   0,   0,   1,   0, 
-      0,   0,   0,   0,   0,   7, 
-    242,   0,  16,   0,   1,   0, 
-      0,   0,  70,  14,  16,   0, 
-      1,   0,   0,   0,  70,  14, 
-     16,   0,   2,   0,   0,   0, 
-     56,   0,   0,   9, 242,   0, 
-     16,   0,   2,   0,   0,   0, 
-     70, 142,  32,   0,   1,   0, 
-      0,   0,   3,   0,   0,   0, 
-    246, 143,  32,   0,   2,   0, 
-      0,   0,   1,   0,   0,   0, 
-      0,   0,   0,   7, 242,   0, 
-     16,   0,   1,   0,   0,   0, 
-     70,  14,  16,   0,   1,   0, 
-      0,   0,  70,  14,  16,   0, 
-      2,   0,   0,   0,  56,   0, 
-      0,   9, 242,   0,  16,   0, 
-      2,   0,   0,   0,  70, 142, 
-     32,   0,   1,   0,   0,   0, 
-      0,   0,   0,   0,   6, 128, 
-     32,   0,   2,   0,   0,   0, 
-      2,   0,   0,   0,  56,   0, 
-      0,   9, 242,   0,  16,   0, 
-      3,   0,   0,   0,  70, 142, 
-     32,   0,   1,   0,   0,   0, 
-      1,   0,   0,   0,  86, 133, 
-     32,   0,   2,   0,   0,   0, 
-      2,   0,   0,   0,   0,   0, 
-      0,   7, 242,   0,  16,   0, 
-      2,   0,   0,   0,  70,  14, 
-     16,   0,   2,   0,   0,   0, 
-     70,  14,  16,   0,   3,   0, 
-      0,   0,  56,   0,   0,   9, 
-    242,   0,  16,   0,   3,   0, 
-      0,   0,  70, 142,  32,   0, 
-      1,   0,   0,   0,   2,   0, 
-      0,   0, 166, 138,  32,   0, 
-      2,   0,   0,   0,   2,   0, 
-      0,   0,   0,   0,   0,   7, 
-    242,   0,  16,   0,   2,   0, 
-      0,   0,  70,  14,  16,   0, 
-      2,   0,   0,   0,  70,  14, 
-     16,   0,   3,   0,   0,   0, 
-     56,   0,   0,   9, 242,   0, 
-     16,   0,   3,   0,   0,   0, 
-     70, 142,  32,   0,   1,   0, 
-      0,   0,   3,   0,   0,   0, 
-    246, 143,  32,   0,   2,   0, 
-      0,   0,   2,   0,   0,   0, 
-      0,   0,   0,   7, 242,   0, 
-     16,   0,   2,   0,   0,   0, 
-     70,  14,  16,   0,   2,   0, 
-      0,   0,  70,  14,  16,   0, 
-      3,   0,   0,   0,  56,   0, 
-      0,   9, 242,   0,  16,   0, 
-      3,   0,   0,   0,  70, 142, 
-     32,   0,   1,   0,   0,   0, 
-      0,   0,   0,   0,   6, 128, 
-     32,   0,   2,   0,   0,   0, 
-      3,   0,   0,   0,  56,   0, 
-      0,   9, 242,   0,  16,   0, 
-      4,   0,   0,   0,  70, 142, 
-     32,   0,   1,   0,   0,   0, 
-      1,   0,   0,   0,  86, 133, 
-     32,   0,   2,   0,   0,   0, 
-      3,   0,   0,   0,   0,   0, 
-      0,   7, 242,   0,  16,   0, 
-      3,   0,   0,   0,  70,  14, 
-     16,   0,   3,   0,   0,   0, 
-     70,  14,  16,   0,   4,   0, 
-      0,   0,  56,   0,   0,   9, 
-    242,   0,  16,   0,   4,   0, 
-      0,   0,  70, 142,  32,   0, 
-      1,   0,   0,   0,   2,   0, 
-      0,   0, 166, 138,  32,   0, 
-      2,   0,   0,   0,   3,   0, 
-      0,   0,   0,   0,   0,   7, 
-    242,   0,  16,   0,   3,   0, 
-      0,   0,  70,  14,  16,   0, 
-      3,   0,   0,   0,  70,  14, 
-     16,   0,   4,   0,   0,   0, 
-     56,   0,   0,   9, 242,   0, 
-     16,   0,   4,   0,   0,   0, 
-     70, 142,  32,   0,   1,   0, 
-      0,   0,   3,   0,   0,   0, 
-    246, 143,  32,   0,   2,   0, 
-      0,   0,   3,   0,   0,   0, 
-      0,   0,   0,   7, 242,   0, 
-     16,   0,   3,   0,   0,   0, 
-     70,  14,  16,   0,   3,   0, 
-      0,   0,  70,  14,  16,   0, 
-      4,   0,   0,   0,  56,   0, 
-      0,   8, 242,   0,  16,   0, 
-      4,   0,   0,   0,   6,   0, 
-     16,   0,   0,   0,   0,   0, 
-     70, 142,  32,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-     56,   0,   0,   8, 242,   0, 
-     16,   0,   5,   0,   0,   0, 
-     86,   5,  16,   0,   0,   0, 
-      0,   0,  70, 142,  32,   0, 
-      0,   0,   0,   0,   1,   0, 
-      0,   0,   0,   0,   0,   7, 
-    242,   0,  16,   0,   4,   0, 
-      0,   0,  70,  14,  16,   0, 
-      4,   0,   0,   0,  70,  14, 
-     16,   0,   5,   0,   0,   0, 
-     56,   0,   0,   8, 242,   0, 
-     16,   0,   5,   0,   0,   0, 
-    166,  10,  16,   0,   0,   0, 
-      0,   0,  70, 142,  32,   0, 
-      0,   0,   0,   0,   2,   0, 
-      0,   0,   0,   0,   0,   7, 
-    242,   0,  16,   0,   4,   0, 
-      0,   0,  70,  14,  16,   0, 
-      4,   0,   0,   0,  70,  14, 
-     16,   0,   5,   0,   0,   0, 
-     56,   0,   0,   8, 242,   0, 
-     16,   0,   0,   0,   0,   0, 
-    246,  15,  16,   0,   0,   0, 
-      0,   0,  70, 142,  32,   0, 
-      0,   0,   0,   0,   3,   0, 
-      0,   0,   0,   0,   0,   7, 
-    242,   0,  16,   0,   0,   0, 
-      0,   0,  70,  14,  16,   0, 
-      0,   0,   0,   0,  70,  14, 
-     16,   0,   4,   0,   0,   0, 
-     56,   0,   0,   8, 242,   0, 
-     16,   0,   4,   0,   0,   0, 
-      6,   0,  16,   0,   1,   0, 
-      0,   0,  70, 142,  32,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,  56,   0,   0,   8, 
-    242,   0,  16,   0,   5,   0, 
-      0,   0,  86,   5,  16,   0, 
-      1,   0,   0,   0,  70, 142, 
-     32,   0,   0,   0,   0,   0, 
-      1,   0,   0,   0,   0,   0, 
-      0,   7, 242,   0,  16,   0, 
-      4,   0,   0,   0,  70,  14, 
-     16,   0,   4,   0,   0,   0, 
-     70,  14,  16,   0,   5,   0, 
-      0,   0,  56,   0,   0,   8, 
-    242,   0,  16,   0,   5,   0, 
-      0,   0, 166,  10,  16,   0, 
-      1,   0,   0,   0,  70, 142, 
-     32,   0,   0,   0,   0,   0, 
-      2,   0,   0,   0,   0,   0, 
-      0,   7, 242,   0,  16,   0, 
-      4,   0,   0,   0,  70,  14, 
-     16,   0,   4,   0,   0,   0, 
-     70,  14,  16,   0,   5,   0, 
-      0,   0,  56,   0,   0,   8, 
-    242,   0,  16,   0,   1,   0, 
-      0,   0, 246,  15,  16,   0, 
-      1,   0,   0,   0,  70, 142, 
-     32,   0,   0,   0,   0,   0, 
-      3,   0,   0,   0,   0,   0, 
-      0,   7, 242,   0,  16,   0, 
-      1,   0,   0,   0,  70,  14, 
-     16,   0,   1,   0,   0,   0, 
-     70,  14,  16,   0,   4,   0, 
-      0,   0,  56,   0,   0,   8, 
-    242,   0,  16,   0,   4,   0, 
-      0,   0,   6,   0,  16,   0, 
-      2,   0,   0,   0,  70, 142, 
-     32,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,  56,   0, 
-      0,   8, 242,   0,  16,   0, 
-      5,   0,   0,   0,  86,   5, 
-     16,   0,   2,   0,   0,   0, 
-     70, 142,  32,   0,   0,   0, 
-      0,   0,   1,   0,   0,   0, 
-      0,   0,   0,   7, 242,   0, 
-     16,   0,   4,   0,   0,   0, 
-     70,  14,  16,   0,   4,   0, 
-      0,   0,  70,  14,  16,   0, 
-      5,   0,   0,   0,  56,   0, 
-      0,   8, 242,   0,  16,   0, 
-      5,   0,   0,   0, 166,  10, 
-     16,   0,   2,   0,   0,   0, 
-     70, 142,  32,   0,   0,   0, 
-      0,   0,   2,   0,   0,   0, 
-      0,   0,   0,   7, 242,   0, 
-     16,   0,   4,   0,   0,   0, 
-     70,  14,  16,   0,   4,   0, 
-      0,   0,  70,  14,  16,   0, 
-      5,   0,   0,   0,  56,   0, 
-      0,   8, 242,   0,  16,   0, 
-      2,   0,   0,   0, 246,  15, 
-     16,   0,   2,   0,   0,   0, 
-     70, 142,  32,   0,   0,   0, 
-      0,   0,   3,   0,   0,   0, 
-      0,   0,   0,   7, 242,   0, 
-     16,   0,   2,   0,   0,   0, 
-     70,  14,  16,   0,   2,   0, 
-      0,   0,  70,  14,  16,   0, 
-      4,   0,   0,   0,  56,   0, 
-      0,   8, 242,   0,  16,   0, 
-      4,   0,   0,   0,   6,   0, 
-     16,   0,   3,   0,   0,   0, 
-     70, 142,  32,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-     56,   0,   0,   8, 242,   0, 
-     16,   0,   5,   0,   0,   0, 
-     86,   5,  16,   0,   3,   0, 
-      0,   0,  70, 142,  32,   0, 
-      0,   0,   0,   0,   1,   0, 
-      0,   0,   0,   0,   0,   7, 
-    242,   0,  16,   0,   4,   0, 
-      0,   0,  70,  14,  16,   0, 
-      4,   0,   0,   0,  70,  14, 
-     16,   0,   5,   0,   0,   0, 
-     56,   0,   0,   8, 242,   0, 
-     16,   0,   5,   0,   0,   0, 
-    166,  10,  16,   0,   3,   0, 
-      0,   0,  70, 142,  32,   0, 
-      0,   0,   0,   0,   2,   0, 
-      0,   0,   0,   0,   0,   7, 
-    242,   0,  16,   0,   4,   0, 
-      0,   0,  70,  14,  16,   0, 
-      4,   0,   0,   0,  70,  14, 
-     16,   0,   5,   0,   0,   0, 
-     56,   0,   0,   8, 242,   0, 
-     16,   0,   3,   0,   0,   0, 
-    246,  15,  16,   0,   3,   0, 
-      0,   0,  70, 142,  32,   0, 
-      0,   0,   0,   0,   3,   0, 
-      0,   0,   0,   0,   0,   7, 
-    242,   0,  16,   0,   3,   0, 
-      0,   0,  70,  14,  16,   0, 
-      3,   0,   0,   0,  70,  14, 
-     16,   0,   4,   0,   0,   0, 
-     54,   0,   0,   5,  18,   0, 
-     16,   0,   4,   0,   0,   0, 
-     10,   0,  16,   0,   0,   0, 
-      0,   0,  54,   0,   0,   5, 
-     34,   0,  16,   0,   4,   0, 
-      0,   0,  10,   0,  16,   0, 
-      1,   0,   0,   0,  54,   0, 
-      0,   5,  66,   0,  16,   0, 
-      4,   0,   0,   0,  10,   0, 
-     16,   0,   2,   0,   0,   0, 
-     54,   0,   0,   5, 130,   0, 
-     16,   0,   4,   0,   0,   0, 
-     10,   0,  16,   0,   3,   0, 
-      0,   0,  54,   0,   0,   5, 
-     18,   0,  16,   0,   5,   0, 
-      0,   0,  26,   0,  16,   0, 
-      0,   0,   0,   0,  54,   0, 
-      0,   5,  34,   0,  16,   0, 
-      5,   0,   0,   0,  26,   0, 
-     16,   0,   1,   0,   0,   0, 
-     54,   0,   0,   5,  66,   0, 
-     16,   0,   5,   0,   0,   0, 
-     26,   0,  16,   0,   2,   0, 
-      0,   0,  54,   0,   0,   5, 
-    130,   0,  16,   0,   5,   0, 
-      0,   0,  26,   0,  16,   0, 
-      3,   0,   0,   0,  54,   0, 
-      0,   5,  18,   0,  16,   0, 
-      6,   0,   0,   0,  42,   0, 
-     16,   0,   0,   0,   0,   0, 
-     54,   0,   0,   5,  34,   0, 
-     16,   0,   6,   0,   0,   0, 
-     42,   0,  16,   0,   1,   0, 
-      0,   0,  54,   0,   0,   5, 
-     66,   0,  16,   0,   6,   0, 
-      0,   0,  42,   0,  16,   0, 
-      2,   0,   0,   0,  54,   0, 
-      0,   5, 130,   0,  16,   0, 
-      6,   0,   0,   0,  42,   0, 
-     16,   0,   3,   0,   0,   0, 
-     54,   0,   0,   5,  18,   0, 
-     16,   0,   3,   0,   0,   0, 
-     58,   0,  16,   0,   0,   0, 
-      0,   0,  54,   0,   0,   5, 
-     34,   0,  16,   0,   3,   0, 
-      0,   0,  58,   0,  16,   0, 
-      1,   0,   0,   0,  54,   0, 
-      0,   5,  66,   0,  16,   0, 
-      3,   0,   0,   0,  58,   0, 
-     16,   0,   2,   0,   0,   0, 
-     54,   0,   0,   5, 130,   0, 
-     16,   0,   3,   0,   0,   0, 
-     58,   0,  16,   0,   3,   0, 
-      0,   0,  54,   0,   0,   5, 
-    114,   0,  16,   0,   0,   0, 
-      0,   0,  70,  18,  16,   0, 
-      0,   0,   0,   0,  54,   0, 
-      0,   5, 130,   0,  16,   0, 
-      0,   0,   0,   0,   1,  64, 
-      0,   0,   0,   0, 128,  63, 
-     17,   0,   0,   7,  18,   0, 
-     16,   0,   1,   0,   0,   0, 
-     70,  14,  16,   0,   4,   0, 
-      0,   0,  70,  14,  16,   0, 
-      0,   0,   0,   0,  17,   0, 
-      0,   7,  34,   0,  16,   0, 
-      1,   0,   0,   0,  70,  14, 
-     16,   0,   5,   0,   0,   0, 
-     70,  14,  16,   0,   0,   0, 
-      0,   0,  17,   0,   0,   7, 
-     66,   0,  16,   0,   1,   0, 
-      0,   0,  70,  14,  16,   0, 
-      6,   0,   0,   0,  70,  14, 
-     16,   0,   0,   0,   0,   0, 
-     17,   0,   0,   7, 130,   0, 
-     16,   0,   1,   0,   0,   0, 
-     70,  14,  16,   0,   3,   0, 
-      0,   0,  70,  14,  16,   0, 
-      0,   0,   0,   0,  17,   0, 
-      0,   8,  18,   0,  16,   0, 
-      2,   0,   0,   0,  70,  14, 
-     16,   0,   0,   0,   0,   0, 
-     70, 142,  32,   0,   2,   0, 
-      0,   0,   0,   0,   0,   0, 
-     17,   0,   0,   8,  34,   0, 
-     16,   0,   2,   0,   0,   0, 
-     70,  14,  16,   0,   0,   0, 
-      0,   0,  70, 142,  32,   0, 
-      2,   0,   0,   0,   1,   0, 
-      0,   0,  17,   0,   0,   8, 
-     66,   0,  16,   0,   2,   0, 
-      0,   0,  70,  14,  16,   0, 
-      0,   0,   0,   0,  70, 142, 
-     32,   0,   2,   0,   0,   0, 
-      2,   0,   0,   0,  16,   0, 
-      0,   7,  18,   0,  16,   0, 
-      0,   0,   0,   0,  70,  18, 
-     16,   0,   1,   0,   0,   0, 
-     70,  18,  16,   0,   1,   0, 
-      0,   0,  68,   0,   0,   5, 
-     18,   0,  16,   0,   0,   0, 
-      0,   0,  10,   0,  16,   0, 
-      0,   0,   0,   0,  56,   0, 
-      0,   7, 114,   0,  16,   0, 
-      0,   0,   0,   0,   6,   0, 
-     16,   0,   0,   0,   0,   0, 
-     70,  18,  16,   0,   1,   0, 
-      0,   0,  54,   0,   0,   5, 
-    114,   0,  16,   0,   3,   0, 
-      0,   0,  70,  18,  16,   0, 
-      2,   0,   0,   0,  54,   0, 
-      0,   5, 130,   0,  16,   0, 
-      3,   0,   0,   0,   1,  64, 
-      0,   0,   0,   0, 128,  63, 
-     54,   0,   0,   6, 114,   0, 
-     16,   0,   4,   0,   0,   0, 
-     70, 130,  32,   0,   1,   0, 
-      0,   0,   4,   0,   0,   0, 
-     54,   0,   0,   6, 114,   0, 
-     16,   0,   5,   0,   0,   0, 
-     70, 130,  32,   0,   1,   0, 
-      0,   0,   5,   0,   0,   0, 
-     54,   0,   0,   5, 242,  32, 
-     16,   0,   2,   0,   0,   0, 
-     70,  14,  16,   0,   3,   0, 
-      0,   0,  54,   0,   0,   5, 
-    242,  32,  16,   0,   5,   0, 
-      0,   0,  70,  14,  16,   0, 
-      1,   0,   0,   0,  54,   0, 
-      0,   5, 114,  32,  16,   0, 
-      0,   0,   0,   0,  70,   2, 
-     16,   0,   2,   0,   0,   0, 
-     54,   0,   0,   5, 114,  32, 
-     16,   0,   1,   0,   0,   0, 
-     70,   2,  16,   0,   0,   0, 
-      0,   0,  54,   0,   0,   5, 
-    114,  32,  16,   0,   3,   0, 
-      0,   0,  70,   2,  16,   0, 
-      4,   0,   0,   0,  54,   0, 
-      0,   5, 114,  32,  16,   0, 
-      4,   0,   0,   0,  70,   2, 
-     16,   0,   5,   0,   0,   0, 
-     62,   0,   0,   1,  83,  80, 
-     68,  66,   0,  70,   0,   0, 
-     77, 105,  99, 114, 111, 115, 
-    111, 102, 116,  32,  67,  47, 
-     67,  43,  43,  32,  77,  83, 
-     70,  32,  55,  46,  48,  48, 
-     13,  10,  26,  68,  83,   0, 
-      0,   0,   0,   2,   0,   0, 
-      2,   0,   0,   0,  35,   0, 
-      0,   0, 176,   0,   0,   0, 
-      0,   0,   0,   0,  33,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0, 192, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255,  56,   0, 
-      0,   0, 252, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-      5,   0,   0,   0,  32,   0, 
-      0,   0,  60,   0,   0,   0, 
-      0,   0,   0,   0, 255, 255, 
-    255, 255,   0,   0,   0,   0, 
-      6,   0,   0,   0,   5,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   3,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0, 148,  46, 
-     49,   1,  13, 146,  50,  97, 
-      1,   0,   0,   0,  22, 207, 
-    238,  25,  69,  36,  78,  65, 
-    139,  65, 218, 163, 218, 127, 
-    147,  62,   0,   0,   0,   0, 
-      0,   0,   0,   0,   1,   0, 
-      0,   0,   1,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-    220,  81,  51,   1,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-    114, 116, 101, 120,  83, 104, 
-     97, 100, 101, 114,  79, 117, 
-    116, 112, 117, 116,  13,  10, 
-    123,  13,  10,   9, 102, 108, 
-    111,  97, 116,  51,  32, 119, 
-    111, 114, 108, 100,  80, 111, 
-    115,  32,  58,  32,  87,  79, 
-     82,  76,  68,  95,  80,  79, 
-     83,  73,  84,  73,  79,  78, 
-     59,  13,  10,   9, 102, 108, 
-    111,  97, 116,  51,  32, 110, 
-    111, 114, 109,  97, 108,  32, 
-     58,  32,  78,  79,  82,  77, 
-     65,  76,  59,  13,  10,   9, 
-    102, 108, 111,  97, 116,  52, 
-     32,  99, 111, 108, 111, 114, 
-     32,  58,  32,  67,  79,  76, 
-     79,  82,  59,  13,  10,   9, 
-    102, 108, 111,  97, 116,  51, 
-     32, 118, 105, 101, 119,  32, 
-     58,  32,  86,  73,  69,  87, 
-     59,  13,  10,   9, 102, 108, 
-    111,  97, 116,  51,  32, 108, 
-    105, 103, 104, 116,  32,  58, 
-     32,  76,  73,  71,  72,  84, 
-     59,  13,  10,   9, 102, 108, 
-    111,  97, 116,  52,  32, 112, 
-    111, 115, 105, 116, 105, 111, 
-    110,  32,  58,  32,  83,  86, 
-     95,  80,  79,  83,  73,  84, 
-     73,  79,  78,  59,  13,  10, 
-    125,  59,  13,  10,  13,  10, 
-     86, 101, 114, 116, 101, 120, 
-     83, 104,  97, 100, 101, 114, 
-     79, 117, 116, 112, 117, 116, 
-     32,  83, 105, 109, 112, 108, 
-    101,  86, 101, 114, 116, 101, 
-    120,  83, 104,  97, 100, 101, 
-    114,  40,  86, 101, 114, 116, 
-    101, 120,  68,  97, 116,  97, 
-     32,  73,  78,  32,  41,  13, 
-     10, 123,  13,  10,  32,  32, 
-     32,  32,  86, 101, 114, 116, 
-    101, 120,  83, 104,  97, 100, 
-    101, 114,  79, 117, 116, 112, 
-    117, 116,  32,  79,  85,  84, 
-     59,  13,  10,  13,  10,   9, 
-    109,  97, 116, 114, 105, 120, 
-     32, 109, 118, 112,  32,  61, 
-     32, 109, 117, 108,  40,  32, 
-    112, 114, 111, 106, 101,  99, 
-    116, 105, 111, 110,  77,  97, 
-    116, 114, 105, 120,  44,  32, 
-    109, 117, 108,  40,  32, 118, 
-    105, 101, 119,  77,  97, 116, 
-    114, 105, 120,  44,  32, 119, 
-    111, 114, 108, 100,  77,  97, 
-    116, 114, 105, 120,  32,  41, 
-     32,  41,  59,  13,  10,  32, 
-     32,  32,  32,  79,  85,  84, 
-     46, 112, 111, 115, 105, 116, 
-    105, 111, 110,  32,  61,  32, 
-    109, 117, 108,  40,  32, 109, 
-    118, 112,  44,  32, 102, 108, 
-    111,  97, 116,  52,  40,  32, 
-     73,  78,  46, 112, 111, 115, 
-    105, 116, 105, 111, 110,  44, 
-     32,  49,  46,  48, 102,  32, 
-     41,  32,  41,  59,  13,  10, 
-      9,  79,  85,  84,  46, 119, 
-    111, 114, 108, 100,  80, 111, 
-    115,  32,  61,  32, 109, 117, 
-    108,  40, 102, 108, 111,  97, 
-    116,  52,  40,  32,  73,  78, 
-     46, 112, 111, 115, 105, 116, 
-    105, 111, 110,  44,  32,  49, 
-     46,  48, 102,  32,  41,  44, 
-     32, 119, 111, 114, 108, 100, 
-     77,  97, 116, 114, 105, 120, 
-     41,  59,  13,  10,  13,  10, 
-      9,  79,  85,  84,  46, 110, 
-    111, 114, 109,  97, 108,  32, 
-     61,  32, 109, 117, 108,  40, 
-     73,  78,  46, 110, 111, 114, 
-    109,  97, 108,  44,  32,  40, 
-    102, 108,  76, 232,   3,   0, 
-     43, 125,   2,   0, 228, 252, 
-      0,   0,  30, 194,   2,   0, 
-    198,  90,   0,   0, 212, 200, 
-      0,   0, 221, 143,   3,   0, 
-     49, 251,   3,   0, 138, 183, 
-      3,   0, 103, 159,   1,   0, 
-    206,  55,   0,   0,  57, 206, 
-      1,   0,  65,  36,   1,   0, 
-     65, 185,   2,   0,   0,  16, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,  99,  98, 
-    117, 102, 102, 101, 114,  32, 
-     80, 101, 114,  65, 112, 112, 
-    108, 105,  99,  97, 116, 105, 
-    111, 110,  32,  58,  32, 114, 
-    101, 103, 105, 115, 116, 101, 
-    114,  40,  32,  98,  48,  32, 
-     41,  13,  10, 123,  13,  10, 
-     32,  32,  32,  32, 109,  97, 
-    116, 114, 105, 120,  32, 112, 
-    114, 111, 106, 101,  99, 116, 
-    105, 111, 110,  77,  97, 116, 
-    114, 105, 120,  59,  13,  10, 
-    125,  13,  10,  13,  10,  99, 
-     98, 117, 102, 102, 101, 114, 
-     32,  80, 101, 114,  70, 114, 
-     97, 109, 101,  32,  58,  32, 
-    114, 101, 103, 105, 115, 116, 
-    101, 114,  40,  32,  98,  49, 
-     32,  41,  13,  10, 123,  13, 
-     10,  32,  32,  32,  32, 109, 
-     97, 116, 114, 105, 120,  32, 
-    118, 105, 101, 119,  77,  97, 
-    116, 114, 105, 120,  59,  13, 
-     10,   9, 102, 108, 111,  97, 
-    116,  51,  32, 101, 121, 101, 
-     80, 111, 115,  59,  13,  10, 
-      9, 102, 108, 111,  97, 116, 
-     51,  32, 108, 105, 103, 104, 
-    116,  80, 111, 115,  59,  13, 
-     10, 125,  13,  10,  13,  10, 
-     99,  98, 117, 102, 102, 101, 
-    114,  32,  80, 101, 114,  79, 
-     98, 106, 101,  99, 116,  32, 
-     58,  32, 114, 101, 103, 105, 
-    115, 116, 101, 114,  40,  32, 
-     98,  50,  32,  41,  13,  10, 
-    123,  13,  10,  32,  32,  32, 
-     32, 109,  97, 116, 114, 105, 
-    120,  32, 119, 111, 114, 108, 
-    100,  77,  97, 116, 114, 105, 
-    120,  59,  13,  10, 125,  13, 
-     10,  13,  10, 115, 116, 114, 
-    117,  99, 116,  32,  86, 101, 
-    114, 116, 101, 120,  68,  97, 
-    116,  97,  13,  10, 123,  13, 
-     10,  32,  32,  32,  32, 102, 
-    108, 111,  97, 116,  51,  32, 
-    112, 111, 115, 105, 116, 105, 
-    111, 110,  32,  58,  32,  80, 
-     79,  83,  73,  84,  73,  79, 
-     78,  59,  13,  10,   9, 102, 
-    108, 111,  97, 116,  51,  32, 
-    110, 111, 114, 109,  97, 108, 
-     58,  32,  78,  79,  82,  77, 
-     65,  76,  59,  13,  10,  32, 
-     32,  32,  32, 102, 108, 111, 
-     97, 116,  51,  32,  99, 111, 
-    108, 111, 114,  58,  32,  67, 
-     79,  76,  79,  82,  59,  13, 
-     10, 125,  59,  13,  10,  13, 
-     10, 115, 116, 114, 117,  99, 
-    116,  32,  86, 101, 114, 116, 
-    101, 120,  83, 104,  97, 100, 
-    101, 114,  79, 117, 116, 112, 
-    117, 116,  13,  10, 123,  13, 
-     10,   9, 102, 108, 111,  97, 
-    116,  51,  32, 119, 111, 114, 
-    108, 100,  80, 111, 115,  32, 
-     58,  32,  87,  79,  82,  76, 
-     68,  95,  80,  79,  83,  73, 
-     84,  73,  79,  78,  59,  13, 
-     10,   9, 102, 108, 111,  97, 
-    116,  51,  32, 110, 111, 114, 
-    109,  97, 108,  32,  58,  32, 
-     78,  79,  82,  77,  65,  76, 
-     59,  13,  10,   9, 102, 108, 
-    111,  97, 116,  52,  32,  99, 
-    111, 108, 111, 114,  32,  58, 
-     32,  67,  79,  76,  79,  82, 
-     59,  13,  10,   9, 102, 108, 
-    111,  97, 116,  51,  32, 118, 
-    105, 101, 119,  32,  58,  32, 
-     86,  73,  69,  87,  59,  13, 
-     10,   9, 102, 108, 111,  97, 
-    116,  51,  32, 108, 105, 103, 
-    104, 116,  32,  58,  32,  76, 
-     73,  71,  72,  84,  59,  13, 
-     10,   9, 102, 108, 111,  97, 
-    116,  52,  32, 112, 111, 115, 
-    105, 116, 105, 111, 110,  32, 
-     58,  32,  83,  86,  95,  80, 
-     79,  83,  73,  84,  73,  79, 
-     78,  59,  13,  10, 125,  59, 
-     13,  10,  13,  10,  86, 101, 
-    114, 116, 101, 120,  83, 104, 
-     97, 100, 101, 114,  79, 117, 
-    116, 112, 117, 116,  32,  83, 
-    105, 109, 112, 108, 101,  86, 
-    101, 114, 116, 101, 120,  83, 
-    104,  97, 100, 101, 114,  40, 
-     86, 101, 114, 116, 101, 120, 
-     68,  97, 116,  97,  32,  73, 
-     78,  32,  41,  13,  10, 123, 
-     13,  10,  32,  32,  32,  32, 
-     86, 101, 114, 116, 101, 120, 
-     83, 104,  97, 100, 101, 114, 
-     79, 117, 116, 112, 117, 116, 
-     32,  79,  85,  84,  59,  13, 
-     10,  13,  10,   9, 109,  97, 
-    116, 114, 105, 120,  32, 109, 
-    118, 112,  32,  61,  32, 109, 
-    117, 108,  40,  32, 112, 114, 
-    111, 106, 101,  99, 116, 105, 
-    111, 110,  77,  97, 116, 114, 
-    105, 120,  44,  32, 109, 117, 
-    108,  40,  32, 118, 105, 101, 
-    119,  77,  97, 116, 114, 105, 
-    120,  44,  32, 119, 111, 114, 
-    108, 100,  77,  97, 116, 114, 
-    105, 120,  32,  41,  32,  41, 
-     59,  13,  10,  32,  32,  32, 
-     32,  79,  85,  84,  46, 112, 
-    111, 115, 105, 116, 105, 111, 
-    110,  32,  61,  32, 109, 117, 
-    108,  40,  32, 109, 118, 112, 
-     44,  32, 102, 108, 111,  97, 
-    116,  52,  40,  32,  73,  78, 
-     46, 112, 111, 115, 105, 116, 
-    105, 111, 110,  44,  32,  49, 
-     46,  48, 102,  32,  41,  32, 
-     41,  59,  13,  10,   9,  79, 
-     85,  84,  46, 119, 111, 114, 
-    108, 100,  80, 111, 115,  32, 
-     61,  32, 109, 117, 108,  40, 
-    102, 108, 111,  97, 116,  52, 
-     40,  32,  73,  78,  46, 112, 
-    111, 115, 105, 116, 105, 111, 
-    110,  44,  32,  49,  46,  48, 
-    102,  32,  41,  44,  32, 119, 
-    111, 114, 108, 100,  77,  97, 
-    116, 114, 105, 120,  41,  59, 
-     13,  10,  13,  10,   9,  79, 
-     85,  84,  46, 110, 111, 114, 
-    109,  97, 108,  32,  61,  32, 
-    109, 117, 108,  40,  73,  78, 
-     46, 110, 111, 114, 109,  97, 
-    108,  44,  32,  40, 102, 108, 
-    111,  97, 116,  51, 120,  51, 
-     41, 119, 111, 114, 108, 100, 
-     77,  97, 116, 114, 105, 120, 
-     41,  59,  32,  47,  47,  32, 
-    119, 111, 114, 108, 100,  32, 
-    115, 112,  97,  99, 101,  32, 
-    110, 111, 114, 109,  97, 108, 
-     13,  10,   9,  79,  85,  84, 
-     46, 110, 111, 114, 109,  97, 
-    108,  32,  61,  32, 110, 111, 
-    114, 109,  97, 108, 105, 122, 
-    101,  40,  73,  78,  46, 110, 
-    111, 114, 109,  97, 108,  41, 
-     59,  13,  10,   9,  47,  47, 
-     79,  85,  84,  46, 110, 111, 
-    114, 109,  97, 108,  46, 122, 
-     32,  61,  32,  45,  79,  85, 
-     84,  46, 110, 111, 114, 109, 
-     97, 108,  46, 122,  59,  13, 
-     10,  13,  10,   9,  79,  85, 
-     84,  46,  99, 111, 108, 111, 
-    114,  32,  61,  32, 102, 108, 
-    111,  97, 116,  52,  40,  32, 
-     73,  78,  46,  99, 111, 108, 
-    111, 114,  44,  32,  49,  46, 
-     48, 102,  32,  41,  59,  13, 
-     10,  13,  10,   9,  47,  47, 
-     79,  85,  84,  46, 118, 105, 
-    101, 119,  32,  61,  32, 110, 
-    111, 114, 109,  97, 108, 105, 
-    122, 101,  40, 101, 121, 101, 
-     80, 111, 115,  32,  45,  32, 
-     79,  85,  84,  46, 119, 111, 
-    114, 108, 100,  80, 111, 115, 
-     41,  59,  13,  10,   9,  47, 
-     47,  79,  85,  84,  46, 108, 
-    105, 103, 104, 116,  32,  61, 
-     32, 110, 111, 114, 109,  97, 
-    108, 105, 122, 101,  40, 108, 
-    105, 103, 104, 116,  80, 111, 
-    115,  32,  45,  32,  79,  85, 
-     84,  46, 119, 111, 114, 108, 
-    100,  80, 111, 115,  41,  59, 
-     32,  47,  47, 102, 108, 111, 
-     97, 116,  51,  40,  49,  48, 
-     46,  48, 102,  44,  32,  48, 
-     46,  48, 102,  44,  32,  48, 
-     46,  48, 102,  41,  59,  13, 
-     10,   9,  79,  85,  84,  46, 
-    118, 105, 101, 119,  32,  61, 
-     32, 101, 121, 101,  80, 111, 
-    115,  59,  13,  10,   9,  79, 
-     85,  84,  46, 108, 105, 103, 
-    104, 116,  32,  61,  32, 108, 
-    105, 103, 104, 116,  80, 111, 
-    115,  59,  13,  10,  13,  10, 
-     32,  32,  32,  32, 114, 101, 
-    116, 117, 114, 110,  32,  79, 
-     85,  84,  59,  13,  10, 125, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0, 254, 239, 
-    254, 239,   1,   0,   0,   0, 
-     87,   5,   0,   0,   0,  69, 
-     58,  92,  80, 114, 111, 106, 
-    101,  99, 116, 115,  92,  78, 
-    105,  99, 107, 101, 108,  92, 
-     78, 105,  99, 107, 101, 108, 
-     92,  68,  97, 116,  97,  92, 
-     83, 104,  97, 100, 101, 114, 
-    115,  92,  83, 105, 109, 112, 
-    108, 101,  86, 101, 114, 116, 
-    101, 120,  83, 104,  97, 100, 
-    101, 114,  46, 104, 108, 115, 
-    108,   0,   0, 101,  58,  92, 
-    112, 114, 111, 106, 101,  99, 
-    116, 115,  92, 110, 105,  99, 
-    107, 101, 108,  92, 110, 105, 
-     99, 107, 101, 108,  92, 100, 
-     97, 116,  97,  92, 115, 104, 
-     97, 100, 101, 114, 115,  92, 
-    115, 105, 109, 112, 108, 101, 
-    118, 101, 114, 116, 101, 120, 
-    115, 104,  97, 100, 101, 114, 
-     46, 104, 108, 115, 108,   0, 
-     99,  98, 117, 102, 102, 101, 
-    114,  32,  80, 101, 114,  65, 
-    112, 112, 108, 105,  99,  97, 
-    116, 105, 111, 110,  32,  58, 
-     32, 114, 101, 103, 105, 115, 
-    116, 101, 114,  40,  32,  98, 
-     48,  32,  41,  13,  10, 123, 
-     13,  10,  32,  32,  32,  32, 
-    109,  97, 116, 114, 105, 120, 
-     32, 112, 114, 111, 106, 101, 
-     99, 116, 105, 111, 110,  77, 
-     97, 116, 114, 105, 120,  59, 
-     13,  10, 125,  13,  10,  13, 
-     10,  99,  98, 117, 102, 102, 
-    101, 114,  32,  80, 101, 114, 
-     70, 114,  97, 109, 101,  32, 
-     58,  32, 114, 101, 103, 105, 
-    115, 116, 101, 114,  40,  32, 
-     98,  49,  32,  41,  13,  10, 
-    123,  13,  10,  32,  32,  32, 
-     32, 109,  97, 116, 114, 105, 
-    120,  32, 118, 105, 101, 119, 
-     77,  97, 116, 114, 105, 120, 
-     59,  13,  10,   9, 102, 108, 
-    111,  97, 116,  51,  32, 101, 
-    121, 101,  80, 111, 115,  59, 
-     13,  10,   9, 102, 108, 111, 
-     97, 116,  51,  32, 108, 105, 
-    103, 104, 116,  80, 111, 115, 
-     59,  13,  10, 125,  13,  10, 
-     13,  10,  99,  98, 117, 102, 
-    102, 101, 114,  32,  80, 101, 
-    114,  79,  98, 106, 101,  99, 
-    116,  32,  58,  32, 114, 101, 
-    103, 105, 115, 116, 101, 114, 
-     40,  32,  98,  50,  32,  41, 
-     13,  10, 123,  13,  10,  32, 
-     32,  32,  32, 109,  97, 116, 
-    114, 105, 120,  32, 119, 111, 
-    114, 108, 100,  77,  97, 116, 
-    114, 105, 120,  59,  13,  10, 
-    125,  13,  10,  13,  10, 115, 
-    116, 114, 117,  99, 116,  32, 
-     86, 101, 114, 116, 101, 120, 
-     68,  97, 116,  97,  13,  10, 
-    123,  13,  10,  32,  32,  32, 
-     32, 102, 108, 111,  97, 116, 
-     51,  32, 112, 111, 115, 105, 
-    116, 105, 111, 110,  32,  58, 
-     32,  80,  79,  83,  73,  84, 
-     73,  79,  78,  59,  13,  10, 
-      9, 102, 108, 111,  97, 116, 
-     51,  32, 110, 111, 114, 109, 
-     97, 108,  58,  32,  78,  79, 
-     82,  77,  65,  76,  59,  13, 
-     10,  32,  32,  32,  32, 102, 
-    108, 111,  97, 116,  51,  32, 
-     99, 111, 108, 111, 114,  58, 
-     32,  67,  79,  76,  79,  82, 
-     59,  13,  10, 125,  59,  13, 
-     10,  13,  10, 115, 116, 114, 
-    117,  99, 116,  32,  86, 101, 
-     27, 226,  48,   1, 128,   0, 
-      0,   0, 107, 103,  43, 200, 
-      9, 161, 215,   1,   1,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   1,   0, 
-      0,   0,   2,   0,   0,   0, 
-      1,   0,   0,   0,   2,   0, 
-      0,   0,   0,   0,   0,   0, 
-     65,   0,   0,   0,  40,   0, 
-      0,   0,  27, 226,  48,   1, 
-     16, 140, 253,  81, 214,   4, 
-      0,   0,   1,   0,   0,   0, 
-     64,   0,   0,   0,  65,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   4,   0,   0,   0, 
-     66,   0,  60,  17,  16,   1, 
-      0,   0,   0,   1,  10,   0, 
-      1,   0, 173,   2,  97,  74, 
-     10,   0,   1,   0, 173,   2, 
-     97,  74,  77, 105,  99, 114, 
-    111, 115, 111, 102, 116,  32, 
-     40,  82,  41,  32,  72,  76, 
-     83,  76,  32,  83, 104,  97, 
-    100, 101, 114,  32,  67, 111, 
-    109, 112, 105, 108, 101, 114, 
-     32,  49,  48,  46,  49,   0, 
-      0,   0,  78,   0,  61,  17, 
-      1, 104, 108, 115, 108,  70, 
-    108,  97, 103, 115,   0,  48, 
-    120,  53,   0, 104, 108, 115, 
-    108,  84,  97, 114, 103, 101, 
-    116,   0, 118, 115,  95,  52, 
-     95,  48,  95, 108, 101, 118, 
-    101, 108,  95,  57,  95,  51, 
-      0, 104, 108, 115, 108,  69, 
-    110, 116, 114, 121,   0,  83, 
-    105, 109, 112, 108, 101,  86, 
-    101, 114, 116, 101, 120,  83, 
-    104,  97, 100, 101, 114,   0, 
-      0,   0,   0,   0,  58,   0, 
-     16,  17,   0,   0,   0,   0, 
-    188,   7,   0,   0,   0,   0, 
-      0,   0,  56,  10,   0,   0, 
-      0,   0,   0,   0,  56,  10, 
-      0,   0,   8,  16,   0,   0, 
-    176,   0,   0,   0,   1,   0, 
-    160,  83, 105, 109, 112, 108, 
-    101,  86, 101, 114, 116, 101, 
-    120,  83, 104,  97, 100, 101, 
-    114,   0,   0,   0,  42,   0, 
-     62,  17,   2,  16,   0,   0, 
-      9,   0,  73,  78,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-     22,   0,  80,  17,   1,   0, 
-      5,   0,   0,   0,   4,   0, 
-    176,   0,   0,   0,   1,   0, 
-     56,  10,   0,   0,   0,   0, 
-     22,   0,  80,  17,   1,   0, 
-      5,   0,   4,   0,   4,   0, 
-    176,   0,   0,   0,   1,   0, 
-     56,  10,   4,   0,   0,   0, 
-     22,   0,  80,  17,   1,   0, 
-      5,   0,   8,   0,   4,   0, 
-    176,   0,   0,   0,   1,   0, 
-     56,  10,   8,   0,   0,   0, 
-     22,   0,  80,  17,   1,   0, 
-      5,   0,  12,   0,   4,   0, 
-    176,   0,   0,   0,   1,   0, 
-     56,  10,  16,   0,   0,   0, 
-     22,   0,  80,  17,   1,   0, 
-      5,   0,  16,   0,   4,   0, 
-    176,   0,   0,   0,   1,   0, 
-     56,  10,  20,   0,   0,   0, 
-     22,   0,  80,  17,   1,   0, 
-      5,   0,  20,   0,   4,   0, 
-    176,   0,   0,   0,   1,   0, 
-     56,  10,  24,   0,   0,   0, 
-     22,   0,  80,  17,   1,   0, 
-      5,   0,  24,   0,   4,   0, 
-    176,   0,   0,   0,   1,   0, 
-     56,  10,  32,   0,   0,   0, 
-     22,   0,  80,  17,   1,   0, 
-      5,   0,  28,   0,   4,   0, 
-    176,   0,   0,   0,   1,   0, 
-     56,  10,  36,   0,   0,   0, 
-     22,   0,  80,  17,   1,   0, 
-      5,   0,  32,   0,   4,   0, 
-    176,   0,   0,   0,   1,   0, 
-     56,  10,  40,   0,   0,   0, 
-     74,   0,  62,  17,   7,  16, 
-      0,   0, 136,   0,  60,  83, 
-    105, 109, 112, 108, 101,  86, 
-    101, 114, 116, 101, 120,  83, 
-    104,  97, 100, 101, 114,  32, 
-    114, 101, 116, 117, 114, 110, 
-     32, 118,  97, 108, 117, 101, 
-     62,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,  22,   0, 
-     80,  17,   2,   0,   5,   0, 
-     64,   0,   4,   0, 176,   0, 
-      0,   0,   1,   0,  56,  10, 
-     80,   0,   0,   0,  22,   0, 
-     80,  17,   2,   0,   5,   0, 
-     68,   0,   4,   0, 176,   0, 
-      0,   0,   1,   0,  56,  10, 
-     84,   0,   0,   0,  22,   0, 
-     80,  17,   2,   0,   5,   0, 
-     72,   0,   4,   0, 176,   0, 
-      0,   0,   1,   0,  56,  10, 
-     88,   0,   0,   0,  22,   0, 
-     80,  17,   2,   0,   5,   0, 
-     76,   0,   4,   0, 176,   0, 
-      0,   0,   1,   0,  56,  10, 
-     92,   0,   0,   0,  22,   0, 
-     80,  17,   2,   0,   5,   0, 
-     52,   0,   4,   0, 176,   0, 
-      0,   0,   1,   0,  56,  10, 
-     64,   0,   0,   0,  22,   0, 
-     80,  17,   2,   0,   5,   0, 
-     56,   0,   4,   0, 176,   0, 
-      0,   0,   1,   0,  56,  10, 
-     68,   0,   0,   0,  22,   0, 
-     80,  17,   2,   0,   5,   0, 
-     60,   0,   4,   0, 176,   0, 
-      0,   0,   1,   0,  56,  10, 
-     72,   0,   0,   0,  22,   0, 
-     80,  17,   2,   0,   5,   0, 
-     40,   0,   4,   0, 176,   0, 
-      0,   0,   1,   0,  56,  10, 
-     48,   0,   0,   0,  22,   0, 
-     80,  17,   2,   0,   5,   0, 
-     44,   0,   4,   0, 176,   0, 
-      0,   0,   1,   0,  56,  10, 
-     52,   0,   0,   0,  22,   0, 
-     80,  17,   2,   0,   5,   0, 
-     48,   0,   4,   0, 176,   0, 
-      0,   0,   1,   0,  56,  10, 
-     56,   0,   0,   0,  22,   0, 
-     80,  17,   2,   0,   5,   0, 
-     24,   0,   4,   0, 176,   0, 
-      0,   0,   1,   0,  56,  10, 
-     32,   0,   0,   0,  22,   0, 
-     80,  17,   2,   0,   5,   0, 
-     28,   0,   4,   0, 176,   0, 
-      0,   0,   1,   0,  56,  10, 
-     36,   0,   0,   0,  22,   0, 
-     80,  17,   2,   0,   5,   0, 
-     32,   0,   4,   0, 176,   0, 
-      0,   0,   1,   0,  56,  10, 
-     40,   0,   0,   0,  22,   0, 
-     80,  17,   2,   0,   5,   0, 
-     36,   0,   4,   0, 176,   0, 
-      0,   0,   1,   0,  56,  10, 
-     44,   0,   0,   0,  22,   0, 
-     80,  17,   2,   0,   5,   0, 
-     12,   0,   4,   0, 176,   0, 
-      0,   0,   1,   0,  56,  10, 
-     16,   0,   0,   0,  22,   0, 
-     80,  17,   2,   0,   5,   0, 
-     16,   0,   4,   0, 176,   0, 
-      0,   0,   1,   0,  56,  10, 
-     20,   0,   0,   0,  22,   0, 
-     80,  17,   2,   0,   5,   0, 
-     20,   0,   4,   0, 176,   0, 
-      0,   0,   1,   0,  56,  10, 
-     24,   0,   0,   0,  22,   0, 
-     80,  17,   2,   0,   5,   0, 
-      0,   0,   4,   0, 176,   0, 
-      0,   0,   1,   0,  56,  10, 
-      0,   0,   0,   0,  22,   0, 
-     80,  17,   2,   0,   5,   0, 
-      4,   0,   4,   0, 176,   0, 
-      0,   0,   1,   0,  56,  10, 
-      4,   0,   0,   0,  22,   0, 
-     80,  17,   2,   0,   5,   0, 
-      8,   0,   4,   0, 176,   0, 
-      0,   0,   1,   0,  56,  10, 
-      8,   0,   0,   0,  42,   0, 
-     62,  17,   6,  16,   0,   0, 
-      8,   0,  79,  85,  84,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-     22,   0,  80,  17,   0,   0, 
-      5,   0,  64,   0,   4,   0, 
-     20,   9,   0,   0,   1,   0, 
-    212,   1,  16,   0,   0,   0, 
-     22,   0,  80,  17,   0,   0, 
-      5,   0,  68,   0,   4,   0, 
-     48,   9,   0,   0,   1,   0, 
-    184,   1,  20,   0,   0,   0, 
-     22,   0,  80,  17,   0,   0, 
-      5,   0,  72,   0,   4,   0, 
-     76,   9,   0,   0,   1,   0, 
-    156,   1,  24,   0,   0,   0, 
-     22,   0,  80,  17,   0,   0, 
-      5,   0,  76,   0,   4,   0, 
-    104,   9,   0,   0,   1,   0, 
-    128,   1,  28,   0,   0,   0, 
-     22,   0,  80,  17,   0,   0, 
-      5,   0,   0,   0,   4,   0, 
-    136,   9,   0,   0,   1,   0, 
-     96,   1,  32,   0,   0,   0, 
-     22,   0,  80,  17,   0,   0, 
-      5,   0,   4,   0,   4,   0, 
-    168,   9,   0,   0,   1,   0, 
-     64,   1,  36,   0,   0,   0, 
-     22,   0,  80,  17,   0,   0, 
-      5,   0,   8,   0,   4,   0, 
-    200,   9,   0,   0,   1,   0, 
-     32,   1,  40,   0,   0,   0, 
-     22,   0,  80,  17,   0,   0, 
-      5,   0,  12,   0,   4,   0, 
-     20,  10,   0,   0,   1,   0, 
-    212,   0,   0,   0,   0,   0, 
-     22,   0,  80,  17,   0,   0, 
-      5,   0,  16,   0,   4,   0, 
-     20,  10,   0,   0,   1,   0, 
-    212,   0,   4,   0,   0,   0, 
-     22,   0,  80,  17,   0,   0, 
-      5,   0,  20,   0,   4,   0, 
-     20,  10,   0,   0,   1,   0, 
-    212,   0,   8,   0,   0,   0, 
-     22,   0,  80,  17,   0,   0, 
-      5,   0,  24,   0,   4,   0, 
-     40,  10,   0,   0,   1,   0, 
-    192,   0,  48,   0,   0,   0, 
-     22,   0,  80,  17,   0,   0, 
-      5,   0,  28,   0,   4,   0, 
-     40,  10,   0,   0,   1,   0, 
-    192,   0,  52,   0,   0,   0, 
-     22,   0,  80,  17,   0,   0, 
-      5,   0,  32,   0,   4,   0, 
-     40,  10,   0,   0,   1,   0, 
-    192,   0,  56,   0,   0,   0, 
-     22,   0,  80,  17,   0,   0, 
-      5,   0,  36,   0,   4,   0, 
-     60,  10,   0,   0,   1,   0, 
-    172,   0,  60,   0,   0,   0, 
-     22,   0,  80,  17,   0,   0, 
-      5,   0,  40,   0,   4,   0, 
-     84,  10,   0,   0,   1,   0, 
-    148,   0,  64,   0,   0,   0, 
-     22,   0,  80,  17,   0,   0, 
-      5,   0,  44,   0,   4,   0, 
-     84,  10,   0,   0,   1,   0, 
-    148,   0,  68,   0,   0,   0, 
-     22,   0,  80,  17,   0,   0, 
-      5,   0,  48,   0,   4,   0, 
-     84,  10,   0,   0,   1,   0, 
-    148,   0,  72,   0,   0,   0, 
-     22,   0,  80,  17,   0,   0, 
-      5,   0,  52,   0,   4,   0, 
-    108,  10,   0,   0,   1,   0, 
-    124,   0,  80,   0,   0,   0, 
-     22,   0,  80,  17,   0,   0, 
-      5,   0,  56,   0,   4,   0, 
-    108,  10,   0,   0,   1,   0, 
-    124,   0,  84,   0,   0,   0, 
-     22,   0,  80,  17,   0,   0, 
-      5,   0,  60,   0,   4,   0, 
-    108,  10,   0,   0,   1,   0, 
-    124,   0,  88,   0,   0,   0, 
-     42,   0,  62,  17,   9,  16, 
-      0,   0,   8,   0, 109, 118, 
-    112,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,  22,   0,  80,  17, 
-      0,   0,   5,   0,   0,   0, 
-      4,   0, 164,   7,   0,   0, 
-      1,   0, 176,   2,  64,   0, 
-      0,   0,  22,   0,  80,  17, 
-      0,   0,   5,   0,  16,   0, 
-      4,   0, 184,   7,   0,   0, 
-      1,   0, 156,   2,  68,   0, 
-      0,   0,  22,   0,  80,  17, 
-      0,   0,   5,   0,  32,   0, 
-      4,   0, 204,   7,   0,   0, 
-      1,   0, 136,   2,  72,   0, 
-      0,   0,  22,   0,  80,  17, 
-      0,   0,   5,   0,  48,   0, 
-      4,   0, 224,   7,   0,   0, 
-      1,   0,   8,   3,  76,   0, 
-      0,   0,  22,   0,  80,  17, 
-      0,   0,   5,   0,   4,   0, 
-      4,   0, 244,   7,   0,   0, 
-      1,   0, 120,   2,  80,   0, 
-      0,   0,  22,   0,  80,  17, 
-      0,   0,   5,   0,  20,   0, 
-      4,   0,   8,   8,   0,   0, 
-      1,   0, 100,   2,  84,   0, 
-      0,   0,  22,   0,  80,  17, 
-      0,   0,   5,   0,  36,   0, 
-      4,   0,  28,   8,   0,   0, 
-      1,   0,  80,   2,  88,   0, 
-      0,   0,  22,   0,  80,  17, 
-      0,   0,   5,   0,  52,   0, 
-      4,   0,  48,   8,   0,   0, 
-      1,   0, 184,   2,  92,   0, 
-      0,   0,  22,   0,  80,  17, 
-      0,   0,   5,   0,   8,   0, 
-      4,   0,  68,   8,   0,   0, 
-      1,   0, 164,   2,  96,   0, 
-      0,   0,  22,   0,  80,  17, 
-      0,   0,   5,   0,  24,   0, 
-      4,   0,  88,   8,   0,   0, 
-      1,   0, 144,   2, 100,   0, 
-      0,   0,  22,   0,  80,  17, 
-      0,   0,   5,   0,  40,   0, 
-      4,   0, 108,   8,   0,   0, 
-      1,   0, 124,   2, 104,   0, 
-      0,   0,  22,   0,  80,  17, 
-      0,   0,   5,   0,  56,   0, 
-      4,   0, 128,   8,   0,   0, 
-      1,   0, 104,   2, 108,   0, 
-      0,   0,  22,   0,  80,  17, 
-      0,   0,   5,   0,  12,   0, 
-      4,   0, 148,   8,   0,   0, 
-      1,   0, 148,   1,  48,   0, 
-      0,   0,  22,   0,  80,  17, 
-      0,   0,   5,   0,  28,   0, 
-      4,   0, 168,   8,   0,   0, 
-      1,   0, 128,   1,  52,   0, 
-      0,   0,  22,   0,  80,  17, 
-      0,   0,   5,   0,  44,   0, 
-      4,   0, 188,   8,   0,   0, 
-      1,   0, 108,   1,  56,   0, 
-      0,   0,  22,   0,  80,  17, 
-      0,   0,   5,   0,  60,   0, 
-      4,   0, 208,   8,   0,   0, 
-      1,   0, 108,   1,  60,   0, 
-      0,   0,   2,   0,   6,   0, 
-    244,   0,   0,   0,  24,   0, 
-      0,   0,   1,   0,   0,   0, 
-     16,   1, 199, 122, 100, 102, 
-    123, 234,  73, 244, 178, 150, 
-     46, 231,  58, 143, 202, 106, 
-      0,   0, 242,   0,   0,   0, 
-      0,   9,   0,   0,   0,   0, 
-      0,   0,   1,   0,   1,   0, 
-    232,  10,   0,   0,   0,   0, 
-      0,   0, 190,   0,   0,   0, 
-    244,   8,   0,   0, 176,   0, 
-      0,   0,  39,   0,   0, 128, 
-    176,   0,   0,   0,  39,   0, 
-      0,   0, 212,   0,   0,   0, 
-     39,   0,   0, 128, 212,   0, 
-      0,   0,  39,   0,   0,   0, 
-    248,   0,   0,   0,  39,   0, 
-      0, 128, 248,   0,   0,   0, 
-     39,   0,   0,   0,  20,   1, 
-      0,   0,  39,   0,   0, 128, 
-     20,   1,   0,   0,  39,   0, 
-      0,   0,  56,   1,   0,   0, 
-     39,   0,   0, 128,  56,   1, 
-      0,   0,  39,   0,   0,   0, 
-     84,   1,   0,   0,  39,   0, 
-      0, 128,  84,   1,   0,   0, 
-     39,   0,   0,   0, 120,   1, 
-      0,   0,  39,   0,   0, 128, 
-    120,   1,   0,   0,  39,   0, 
-      0,   0, 148,   1,   0,   0, 
-     39,   0,   0, 128, 148,   1, 
-      0,   0,  39,   0,   0,   0, 
-    184,   1,   0,   0,  39,   0, 
-      0, 128, 184,   1,   0,   0, 
-     39,   0,   0,   0, 220,   1, 
-      0,   0,  39,   0,   0, 128, 
-    220,   1,   0,   0,  39,   0, 
-      0,   0, 248,   1,   0,   0, 
-     39,   0,   0, 128, 248,   1, 
-      0,   0,  39,   0,   0,   0, 
-     28,   2,   0,   0,  39,   0, 
-      0, 128,  28,   2,   0,   0, 
-     39,   0,   0,   0,  56,   2, 
-      0,   0,  39,   0,   0, 128, 
-     56,   2,   0,   0,  39,   0, 
-      0,   0,  92,   2,   0,   0, 
-     39,   0,   0, 128,  92,   2, 
-      0,   0,  39,   0,   0,   0, 
-    120,   2,   0,   0,  39,   0, 
-      0, 128, 120,   2,   0,   0, 
-     39,   0,   0,   0, 156,   2, 
-      0,   0,  39,   0,   0, 128, 
-    156,   2,   0,   0,  39,   0, 
-      0,   0, 192,   2,   0,   0, 
-     39,   0,   0, 128, 192,   2, 
-      0,   0,  39,   0,   0,   0, 
-    220,   2,   0,   0,  39,   0, 
-      0, 128, 220,   2,   0,   0, 
-     39,   0,   0,   0,   0,   3, 
-      0,   0,  39,   0,   0, 128, 
-      0,   3,   0,   0,  39,   0, 
-      0,   0,  28,   3,   0,   0, 
-     39,   0,   0, 128,  28,   3, 
-      0,   0,  39,   0,   0,   0, 
-     64,   3,   0,   0,  39,   0, 
-      0, 128,  64,   3,   0,   0, 
-     39,   0,   0,   0,  92,   3, 
-      0,   0,  39,   0,   0, 128, 
-     92,   3,   0,   0,  39,   0, 
-      0,   0, 128,   3,   0,   0, 
-     39,   0,   0, 128, 128,   3, 
-      0,   0,  39,   0,   0,   0, 
-    164,   3,   0,   0,  39,   0, 
-      0, 128, 164,   3,   0,   0, 
-     39,   0,   0,   0, 192,   3, 
-      0,   0,  39,   0,   0, 128, 
-    192,   3,   0,   0,  39,   0, 
-      0,   0, 228,   3,   0,   0, 
-     39,   0,   0, 128, 228,   3, 
-      0,   0,  39,   0,   0,   0, 
-      0,   4,   0,   0,  39,   0, 
-      0, 128,   0,   4,   0,   0, 
-     39,   0,   0,   0,  36,   4, 
-      0,   0,  39,   0,   0, 128, 
-     36,   4,   0,   0,  39,   0, 
-      0,   0,  64,   4,   0,   0, 
-     39,   0,   0, 128,  64,   4, 
-      0,   0,  39,   0,   0,   0, 
-     96,   4,   0,   0,  39,   0, 
-      0, 128,  96,   4,   0,   0, 
-     39,   0,   0,   0, 128,   4, 
-      0,   0,  39,   0,   0, 128, 
-    128,   4,   0,   0,  39,   0, 
-      0,   0, 156,   4,   0,   0, 
-     39,   0,   0, 128, 156,   4, 
-      0,   0,  39,   0,   0,   0, 
-    188,   4,   0,   0,  39,   0, 
-      0, 128, 188,   4,   0,   0, 
-     39,   0,   0,   0, 216,   4, 
-      0,   0,  39,   0,   0, 128, 
-    216,   4,   0,   0,  39,   0, 
-      0,   0, 248,   4,   0,   0, 
-     39,   0,   0, 128, 248,   4, 
-      0,   0,  39,   0,   0,   0, 
-     20,   5,   0,   0,  39,   0, 
-      0, 128,  20,   5,   0,   0, 
-     39,   0,   0,   0,  52,   5, 
-      0,   0,  39,   0,   0, 128, 
-     52,   5,   0,   0,  39,   0, 
-      0,   0,  84,   5,   0,   0, 
-     39,   0,   0, 128,  84,   5, 
-      0,   0,  39,   0,   0,   0, 
-    112,   5,   0,   0,  39,   0, 
-      0, 128, 112,   5,   0,   0, 
-     39,   0,   0,   0, 144,   5, 
-      0,   0,  39,   0,   0, 128, 
-    144,   5,   0,   0,  39,   0, 
-      0,   0, 172,   5,   0,   0, 
-     39,   0,   0, 128, 172,   5, 
-      0,   0,  39,   0,   0,   0, 
-    204,   5,   0,   0,  39,   0, 
-      0, 128, 204,   5,   0,   0, 
-     39,   0,   0,   0, 232,   5, 
-      0,   0,  39,   0,   0, 128, 
-    232,   5,   0,   0,  39,   0, 
-      0,   0,   8,   6,   0,   0, 
-     39,   0,   0, 128,   8,   6, 
-      0,   0,  39,   0,   0,   0, 
-     40,   6,   0,   0,  39,   0, 
-      0, 128,  40,   6,   0,   0, 
-     39,   0,   0,   0,  68,   6, 
-      0,   0,  39,   0,   0, 128, 
-     68,   6,   0,   0,  39,   0, 
-      0,   0, 100,   6,   0,   0, 
-     39,   0,   0, 128, 100,   6, 
-      0,   0,  39,   0,   0,   0, 
-    128,   6,   0,   0,  39,   0, 
-      0, 128, 128,   6,   0,   0, 
-     39,   0,   0,   0, 160,   6, 
-      0,   0,  39,   0,   0, 128, 
-    160,   6,   0,   0,  39,   0, 
-      0,   0, 188,   6,   0,   0, 
-     39,   0,   0, 128, 188,   6, 
-      0,   0,  39,   0,   0,   0, 
-    220,   6,   0,   0,  39,   0, 
-      0, 128, 220,   6,   0,   0, 
-     39,   0,   0,   0, 252,   6, 
-      0,   0,  39,   0,   0, 128, 
-    252,   6,   0,   0,  39,   0, 
-      0,   0,  24,   7,   0,   0, 
-     39,   0,   0, 128,  24,   7, 
-      0,   0,  39,   0,   0,   0, 
-     56,   7,   0,   0,  39,   0, 
-      0, 128,  56,   7,   0,   0, 
-     39,   0,   0,   0,  84,   7, 
-      0,   0,  39,   0,   0, 128, 
-     84,   7,   0,   0,  39,   0, 
-      0,   0, 116,   7,   0,   0, 
-     39,   0,   0, 128, 116,   7, 
-      0,   0,  39,   0,   0,   0, 
-    144,   7,   0,   0,  39,   0, 
-      0, 128, 144,   7,   0,   0, 
-     39,   0,   0,   0, 164,   7, 
-      0,   0,  39,   0,   0, 128, 
-    164,   7,   0,   0,  39,   0, 
-      0,   0, 184,   7,   0,   0, 
-     39,   0,   0, 128, 184,   7, 
-      0,   0,  39,   0,   0,   0, 
-    204,   7,   0,   0,  39,   0, 
-      0, 128, 204,   7,   0,   0, 
-     39,   0,   0,   0, 224,   7, 
-      0,   0,  39,   0,   0, 128, 
-    224,   7,   0,   0,  39,   0, 
-      0,   0, 244,   7,   0,   0, 
-     39,   0,   0, 128, 244,   7, 
-      0,   0,  39,   0,   0,   0, 
-      8,   8,   0,   0,  39,   0, 
-      0, 128,   8,   8,   0,   0, 
-     39,   0,   0,   0,  28,   8, 
-      0,   0,  39,   0,   0, 128, 
-     28,   8,   0,   0,  39,   0, 
-      0,   0,  48,   8,   0,   0, 
-     39,   0,   0, 128,  48,   8, 
-      0,   0,  39,   0,   0,   0, 
-     68,   8,   0,   0,  39,   0, 
-      0, 128,  68,   8,   0,   0, 
-     39,   0,   0,   0,  88,   8, 
-      0,   0,  39,   0,   0, 128, 
-     88,   8,   0,   0,  39,   0, 
-      0,   0, 108,   8,   0,   0, 
-     39,   0,   0, 128, 108,   8, 
-      0,   0,  39,   0,   0,   0, 
-    128,   8,   0,   0,  39,   0, 
-      0, 128, 128,   8,   0,   0, 
-     39,   0,   0,   0, 148,   8, 
-      0,   0,  39,   0,   0, 128, 
-    148,   8,   0,   0,  39,   0, 
-      0,   0, 168,   8,   0,   0, 
-     39,   0,   0, 128, 168,   8, 
-      0,   0,  39,   0,   0,   0, 
-    188,   8,   0,   0,  39,   0, 
-      0, 128, 188,   8,   0,   0, 
-     39,   0,   0,   0, 208,   8, 
-      0,   0,  40,   0,   0, 128, 
-    208,   8,   0,   0,  40,   0, 
-      0,   0, 228,   8,   0,   0, 
-     40,   0,   0, 128, 228,   8, 
-      0,   0,  40,   0,   0,   0, 
-    248,   8,   0,   0,  40,   0, 
-      0, 128, 248,   8,   0,   0, 
-     40,   0,   0,   0,  20,   9, 
-      0,   0,  40,   0,   0, 128, 
-     20,   9,   0,   0,  40,   0, 
-      0,   0,  48,   9,   0,   0, 
-     40,   0,   0, 128,  48,   9, 
-      0,   0,  40,   0,   0,   0, 
-     76,   9,   0,   0,  40,   0, 
-      0, 128,  76,   9,   0,   0, 
-     40,   0,   0,   0, 104,   9, 
-      0,   0,  41,   0,   0, 128, 
-    104,   9,   0,   0,  41,   0, 
-      0,   0, 136,   9,   0,   0, 
-     41,   0,   0, 128, 136,   9, 
-      0,   0,  41,   0,   0,   0, 
-    168,   9,   0,   0,  41,   0, 
-      0, 128, 168,   9,   0,   0, 
-     41,   0,   0,   0, 200,   9, 
-      0,   0,  44,   0,   0, 128, 
-    200,   9,   0,   0,  44,   0, 
-      0,   0, 228,   9,   0,   0, 
-     44,   0,   0, 128, 228,   9, 
-      0,   0,  44,   0,   0,   0, 
-    248,   9,   0,   0,  44,   0, 
-      0, 128, 248,   9,   0,   0, 
-     44,   0,   0,   0,  20,  10, 
-      0,   0,  47,   0,   0, 128, 
-     20,  10,   0,   0,  47,   0, 
-      0,   0,  40,  10,   0,   0, 
-     47,   0,   0, 128,  40,  10, 
-      0,   0,  47,   0,   0,   0, 
-     60,  10,   0,   0,  51,   0, 
-      0, 128,  60,  10,   0,   0, 
-     51,   0,   0,   0,  84,  10, 
-      0,   0,  52,   0,   0, 128, 
-     84,  10,   0,   0,  52,   0, 
-      0,   0, 108,  10,   0,   0, 
-     54,   0,   0, 128, 108,  10, 
-      0,   0,  54,   0,   0,   0, 
-    128,  10,   0,   0,  54,   0, 
-      0, 128, 128,  10,   0,   0, 
-     54,   0,   0,   0, 148,  10, 
-      0,   0,  54,   0,   0, 128, 
-    148,  10,   0,   0,  54,   0, 
-      0,   0, 168,  10,   0,   0, 
-     54,   0,   0, 128, 168,  10, 
-      0,   0,  54,   0,   0,   0, 
-    188,  10,   0,   0,  54,   0, 
-      0, 128, 188,  10,   0,   0, 
-     54,   0,   0,   0, 208,  10, 
-      0,   0,  54,   0,   0, 128, 
-    208,  10,   0,   0,  54,   0, 
-      0,   0, 228,  10,   0,   0, 
-     54,   0,   0, 128, 228,  10, 
-      0,   0,  54,   0,   0,   0, 
-      2,   0,  70,   0,  38,   0, 
-     67,   0,   2,   0,  70,   0, 
-     38,   0,  67,   0,   2,   0, 
-     70,   0,  38,   0,  67,   0, 
-      2,   0,  70,   0,  38,   0, 
-     67,   0,   2,   0,  70,   0, 
-     38,   0,  67,   0,   2,   0, 
-     70,   0,  38,   0,  67,   0, 
-      2,   0,  70,   0,  38,   0, 
-     67,   0,   2,   0,  70,   0, 
-     38,   0,  67,   0,   2,   0, 
-     70,   0,  38,   0,  67,   0, 
-      2,   0,  70,   0,  38,   0, 
-     67,   0,   2,   0,  70,   0, 
-     38,   0,  67,   0,   2,   0, 
-     70,   0,  38,   0,  67,   0, 
-      2,   0,  70,   0,  38,   0, 
-     67,   0,   2,   0,  70,   0, 
-     38,   0,  67,   0,   2,   0, 
-     70,   0,  38,   0,  67,   0, 
-      2,   0,  70,   0,  38,   0, 
-     67,   0,   2,   0,  70,   0, 
-     38,   0,  67,   0,   2,   0, 
-     70,   0,  38,   0,  67,   0, 
-      2,   0,  70,   0,  38,   0, 
-     67,   0,   2,   0,  70,   0, 
-     38,   0,  67,   0,   2,   0, 
-     70,   0,  38,   0,  67,   0, 
-      2,   0,  70,   0,  38,   0, 
-     67,   0,   2,   0,  70,   0, 
-     38,   0,  67,   0,   2,   0, 
-     70,   0,  38,   0,  67,   0, 
-      2,   0,  70,   0,  38,   0, 
-     67,   0,   2,   0,  70,   0, 
-     38,   0,  67,   0,   2,   0, 
-     70,   0,  38,   0,  67,   0, 
-      2,   0,  70,   0,  38,   0, 
-     67,   0,   2,   0,  70,   0, 
-     15,   0,  69,   0,   2,   0, 
-     70,   0,  15,   0,  69,   0, 
-      2,   0,  70,   0,  15,   0, 
-     69,   0,   2,   0,  70,   0, 
-     15,   0,  69,   0,   2,   0, 
-     70,   0,  15,   0,  69,   0, 
-      2,   0,  70,   0,  15,   0, 
-     69,   0,   2,   0,  70,   0, 
-     15,   0,  69,   0,   2,   0, 
-     70,   0,  15,   0,  69,   0, 
-      2,   0,  70,   0,  15,   0, 
-     69,   0,   2,   0,  70,   0, 
-     15,   0,  69,   0,   2,   0, 
-     70,   0,  15,   0,  69,   0, 
-      2,   0,  70,   0,  15,   0, 
-     69,   0,   2,   0,  70,   0, 
-     15,   0,  69,   0,   2,   0, 
-     70,   0,  15,   0,  69,   0, 
-      2,   0,  70,   0,  15,   0, 
-     69,   0,   2,   0,  70,   0, 
-     15,   0,  69,   0,   2,   0, 
-     70,   0,  15,   0,  69,   0, 
-      2,   0,  70,   0,  15,   0, 
-     69,   0,   2,   0,  70,   0, 
-     15,   0,  69,   0,   2,   0, 
-     70,   0,  15,   0,  69,   0, 
-      2,   0,  70,   0,  15,   0, 
-     69,   0,   2,   0,  70,   0, 
-     15,   0,  69,   0,   2,   0, 
-     70,   0,  15,   0,  69,   0, 
-      2,   0,  70,   0,  15,   0, 
-     69,   0,   2,   0,  70,   0, 
-     15,   0,  69,   0,   2,   0, 
-     70,   0,  15,   0,  69,   0, 
-      2,   0,  70,   0,  15,   0, 
-     69,   0,   2,   0,  70,   0, 
-     15,   0,  69,   0,   2,   0, 
-     70,   0,   9,   0,  69,   0, 
-      2,   0,  70,   0,   9,   0, 
-     69,   0,   2,   0,  70,   0, 
-      9,   0,  69,   0,   2,   0, 
-     70,   0,   9,   0,  69,   0, 
-      2,   0,  70,   0,   9,   0, 
-     69,   0,   2,   0,  70,   0, 
-      9,   0,  69,   0,   2,   0, 
-     70,   0,   9,   0,  69,   0, 
-      2,   0,  70,   0,   9,   0, 
-     69,   0,   2,   0,  70,   0, 
-      9,   0,  69,   0,   2,   0, 
-     70,   0,   9,   0,  69,   0, 
-      2,   0,  70,   0,   9,   0, 
-     69,   0,   2,   0,  70,   0, 
-      9,   0,  69,   0,   2,   0, 
-     70,   0,   9,   0,  69,   0, 
-      2,   0,  70,   0,   9,   0, 
-     69,   0,   2,   0,  70,   0, 
-      9,   0,  69,   0,   2,   0, 
-     70,   0,   9,   0,  69,   0, 
-      5,   0,  59,   0,  20,   0, 
-     58,   0,   5,   0,  59,   0, 
-     20,   0,  58,   0,   5,   0, 
-     59,   0,  20,   0,  58,   0, 
-      5,   0,  59,   0,  20,   0, 
-     58,   0,   5,   0,  59,   0, 
-     20,   0,  58,   0,   5,   0, 
-     59,   0,  20,   0,  58,   0, 
-      2,   0,  62,   0,  17,   0, 
-     61,   0,   2,   0,  62,   0, 
-     17,   0,  61,   0,   2,   0, 
-     62,   0,  17,   0,  61,   0, 
-      2,   0,  35,   0,  15,   0, 
-     34,   0,   2,   0,  35,   0, 
-     15,   0,  34,   0,   2,   0, 
-     35,   0,  15,   0,  34,   0, 
-      2,   0,  38,   0,   2,   0, 
-     37,   0,   2,   0,  38,   0, 
-      2,   0,  37,   0,   2,   0, 
-     19,   0,   2,   0,  18,   0, 
-      2,   0,  22,   0,   2,   0, 
-     21,   0,   5,   0,  15,   0, 
-      5,   0,  15,   0,   5,   0, 
-     15,   0,   5,   0,  15,   0, 
-      5,   0,  15,   0,   5,   0, 
-     15,   0,   5,   0,  15,   0, 
-      5,   0,  15,   0,   5,   0, 
-     15,   0,   5,   0,  15,   0, 
-      5,   0,  15,   0,   5,   0, 
-     15,   0,   5,   0,  15,   0, 
-      5,   0,  15,   0, 246,   0, 
-      0,   0,   4,   0,   0,   0, 
-      0,   0,   0,   0,  24,   0, 
-      0,   0,   0,   0,   0,   0, 
-     36,   0,   0,   0,  76,   0, 
-      0,   0, 108,   0,   0,   0, 
-    136,   0,   0,   0, 168,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,  11, 202,  49,   1, 
-     56,   0,   0,   0,   0,  16, 
-      0,   0,  14,  16,   0,   0, 
-    164,   1,   0,   0,  10,   0, 
-    255, 255,   4,   0,   0,   0, 
-    255, 255,   3,   0,   0,   0, 
-      0,   0,  56,   0,   0,   0, 
-     56,   0,   0,   0,   8,   0, 
-      0,   0,  64,   0,   0,   0, 
-      0,   0,   0,   0,  22,   0, 
-     27,  21,  64,   0,   0,   0, 
-      3,   0,   0,   0,  12,   0, 
-    102, 108, 111,  97, 116,  51, 
-      0, 243, 242, 241,  58,   0, 
-      3,  18,  13,  21,   3,   0, 
-      0,  16,   0,   0,   0,   0, 
-    112, 111, 115, 105, 116, 105, 
-    111, 110,   0, 241,  13,  21, 
-      3,   0,   0,  16,   0,   0, 
-     12,   0, 110, 111, 114, 109, 
-     97, 108,   0, 243, 242, 241, 
-     13,  21,   3,   0,   0,  16, 
-      0,   0,  24,   0,  99, 111, 
-    108, 111, 114,   0,  34,   0, 
-      5,  21,   3,   0,   0,   0, 
-      1,  16,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-     36,   0,  86, 101, 114, 116, 
-    101, 120,  68,  97, 116,  97, 
-      0, 243, 242, 241,  10,   0, 
-      1,  18,   1,   0,   0,   0, 
-      2,  16,   0,   0,  22,   0, 
-     27,  21,  64,   0,   0,   0, 
-      4,   0,   0,   0,  16,   0, 
-    102, 108, 111,  97, 116,  52, 
-      0, 243, 242, 241, 110,   0, 
-      3,  18,  13,  21,   3,   0, 
-      0,  16,   0,   0,   0,   0, 
-    119, 111, 114, 108, 100,  80, 
-    111, 115,   0, 241,  13,  21, 
-      3,   0,   0,  16,   0,   0, 
-     12,   0, 110, 111, 114, 109, 
-     97, 108,   0, 243, 242, 241, 
-     13,  21,   3,   0,   4,  16, 
-      0,   0,  24,   0,  99, 111, 
-    108, 111, 114,   0,  13,  21, 
-      3,   0,   0,  16,   0,   0, 
-     40,   0, 118, 105, 101, 119, 
-      0, 241,  13,  21,   3,   0, 
-      0,  16,   0,   0,  52,   0, 
-    108, 105, 103, 104, 116,   0, 
-     13,  21,   3,   0,   4,  16, 
-      0,   0,  64,   0, 112, 111, 
-    115, 105, 116, 105, 111, 110, 
-      0, 241,  42,   0,   5,  21, 
-      6,   0,   0,   0,   5,  16, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,  80,   0, 
-     86, 101, 114, 116, 101, 120, 
-     83, 104,  97, 100, 101, 114, 
-     79, 117, 116, 112, 117, 116, 
-      0, 243, 242, 241,  10,   0, 
-     24,  21,   6,  16,   0,   0, 
-      1,   0,   1,   0,  14,   0, 
-      8,  16,   7,  16,   0,   0, 
-     23,   0,   1,   0,   3,  16, 
-      0,   0,  30,   0,  28,  21, 
-     64,   0,   0,   0,   4,   0, 
-      0,   0,   4,   0,   0,   0, 
-     16,   0,   0,   0,   0,  64, 
-      0, 102, 108, 111,  97, 116, 
-     52, 120,  52,   0,  10,   0, 
-     24,  21,   9,  16,   0,   0, 
-      1,   0,   1,   0,  10,   0, 
-     24,  21,  10,  16,   0,   0, 
-      1,   0,   0,   2,  10,   0, 
-     24,  21,   0,  16,   0,   0, 
-      1,   0,   1,   0,  10,   0, 
-     24,  21,  12,  16,   0,   0, 
-      1,   0,   0,   2,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,  11, 202, 
-     49,   1,  56,   0,   0,   0, 
-      0,  16,   0,   0,   0,  16, 
-      0,   0,   0,   0,   0,   0, 
-     11,   0, 255, 255,   4,   0, 
-      0,   0, 255, 255,   3,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-    111,  97, 116,  51, 120,  51, 
-     41, 119, 111, 114, 108, 100, 
-     77,  97, 116, 114, 105, 120, 
-     41,  59,  32,  47,  47,  32, 
-    119, 111, 114, 108, 100,  32, 
-    115, 112,  97,  99, 101,  32, 
-    110, 111, 114, 109,  97, 108, 
-     13,  10,   9,  79,  85,  84, 
-     46, 110, 111, 114, 109,  97, 
-    108,  32,  61,  32, 110, 111, 
-    114, 109,  97, 108, 105, 122, 
-    101,  40,  73,  78,  46, 110, 
-    111, 114, 109,  97, 108,  41, 
-     59,  13,  10,   9,  47,  47, 
-     79,  85,  84,  46, 110, 111, 
-    114, 109,  97, 108,  46, 122, 
-     32,  61,  32,  45,  79,  85, 
-     84,  46, 110, 111, 114, 109, 
-     97, 108,  46, 122,  59,  13, 
-     10,  13,  10,   9,  79,  85, 
-     84,  46,  99, 111, 108, 111, 
-    114,  32,  61,  32, 102, 108, 
-    111,  97, 116,  52,  40,  32, 
-     73,  78,  46,  99, 111, 108, 
-    111, 114,  44,  32,  49,  46, 
-     48, 102,  32,  41,  59,  13, 
-     10,  13,  10,   9,  47,  47, 
-     79,  85,  84,  46, 118, 105, 
-    101, 119,  32,  61,  32, 110, 
-    111, 114, 109,  97, 108, 105, 
-    122, 101,  40, 101, 121, 101, 
-     80, 111, 115,  32,  45,  32, 
-     79,  85,  84,  46, 119, 111, 
-    114, 108, 100,  80, 111, 115, 
-     41,  59,  13,  10,   9,  47, 
-     47,  79,  85,  84,  46, 108, 
-    105, 103, 104, 116,  32,  61, 
-     32, 110, 111, 114, 109,  97, 
-    108, 105, 122, 101,  40, 108, 
-    105, 103, 104, 116,  80, 111, 
-    115,  32,  45,  32,  79,  85, 
-     84,  46, 119, 111, 114, 108, 
-    100,  80, 111, 115,  41,  59, 
-     32,  47,  47, 102, 108, 111, 
-     97, 116,  51,  40,  49,  48, 
-     46,  48, 102,  44,  32,  48, 
-     46,  48, 102,  44,  32,  48, 
-     46,  48, 102,  41,  59,  13, 
-     10,   9,  79,  85,  84,  46, 
-    118, 105, 101, 119,  32,  61, 
-     32, 101, 121, 101,  80, 111, 
-    115,  59,  13,  10,   9,  79, 
-     85,  84,  46, 108, 105, 103, 
-    104, 116,  32,  61,  32, 108, 
-    105, 103, 104, 116,  80, 111, 
-    115,  59,  13,  10,  13,  10, 
-     32,  32,  32,  32, 114, 101, 
-    116, 117, 114, 110,  32,  79, 
-     85,  84,  59,  13,  10, 125, 
-      0,   7,   0,   0,   0,   0, 
-      0,   0,   0,  64,   0,   0, 
-      0,   1,   0,   0,   0,  65, 
-      0,   0,   0,   0,   0,   0, 
-      0, 128,   0,   0,   0,   0, 
-      0,   0,   0,   4,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,  68,  51,  68,  83, 
-     72,  68,  82,   0, 232,  10, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,  32,   0,   0,  96, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0, 255, 255, 
-    255, 255,  26,   9,  47, 241, 
-     48,   0,   0,   0,  28,   2, 
-      0,   0,  37,   0,   0,   0, 
-      1,   0,   0,   0,  77,   0, 
-      0,   0,   1,   0,   0,   0, 
-    169,   0,   0,   0,   1,   0, 
-      0,   0, 109,   0,   0,   0, 
-      1,   0,   0,   0, 137,   0, 
-      0,   0,   1,   0,   0,   0, 
-      1,   0,   0,   0,   1,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   8,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   2,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      1,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-     16,   0,   0,   0,   0,   0, 
-      1,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,  32, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-     12,   0,   0,   0,  24,   0, 
-      0,   0,  36,   0,   0,   0, 
-     48,   0,   0,   0,  60,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,  34,   0,  37,  17, 
-      0,   0,   0,   0, 152,   0, 
-      0,   0,   1,   0,  83, 105, 
-    109, 112, 108, 101,  86, 101, 
-    114, 116, 101, 120,  83, 104, 
-     97, 100, 101, 114,   0,   0, 
-      0,   0,  38,   0,  81,  17, 
-     11,  16,   0,   0,   8,   0, 
-      0,   0,   0,   0, 255, 255, 
-    255, 255, 255, 255, 112, 114, 
-    111, 106, 101,  99, 116, 105, 
-    111, 110,  77,  97, 116, 114, 
-    105, 120,   0,   0,   0,   0, 
-     30,   0,  81,  17,  11,  16, 
-      0,   0,   8,   0,   1,   0, 
-      0,   0, 255, 255, 255, 255, 
-    255, 255, 118, 105, 101, 119, 
-     77,  97, 116, 114, 105, 120, 
-      0,   0,  26,   0,  81,  17, 
-     13,  16,   0,   0,   8,   0, 
-      1,   0,  64,   0, 255, 255, 
-    255, 255, 255, 255, 101, 121, 
-    101,  80, 111, 115,   0,   0, 
-     30,   0,  81,  17,  13,  16, 
-      0,   0,   8,   0,   1,   0, 
-     80,   0, 255, 255, 255, 255, 
-    255, 255, 108, 105, 103, 104, 
-    116,  80, 111, 115,   0,   0, 
-      0,   0,  30,   0,  81,  17, 
-     11,  16,   0,   0,   8,   0, 
-      2,   0,   0,   0, 255, 255, 
-    255, 255, 255, 255, 119, 111, 
-    114, 108, 100,  77,  97, 116, 
-    114, 105, 120,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,  16,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0, 255, 255, 255, 255, 
-     26,   9,  47, 241,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-    255, 255, 255, 255, 119,   9, 
-     49,   1,   1,   0,   0,   0, 
-     13,   0,   0, 142,  14,   0, 
-     63,  92,  15,   0,   0,   0, 
-     88,   0,   0,   0,  32,   0, 
-      0,   0,  44,   0,   0,   0, 
-     76,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-     22,   0,   0,   0,  25,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   1,   0,   0,   0, 
-      0,   0,   0,   0, 232,  10, 
-      0,   0,  32,   0,   0,  96, 
-      0,   0, 147,  62,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      2,   0,   9,   0, 192,   7, 
-      0,   0,   0,   0,   0,   0, 
-     52,   9,   0,   0,   1,   0, 
-      0,   0,  88,  40, 245,   2, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,  83, 105, 109, 112, 
-    108, 101,  86, 101, 114, 116, 
-    101, 120,  83, 104,  97, 100, 
-    101, 114,   0, 110, 111, 110, 
-    101,   0,  45, 186,  46, 241, 
-      1,   0,   0,   0,   0,   0, 
-      0,   0, 232,  10,   0,   0, 
-     32,   0,   0,  96,   0,   0, 
-    147,  62,   0,   0,   0,   0, 
-      0,   0,   0,   0,   2,   0, 
-      2,   0,   7,   0,   0,   0, 
-      0,   0,   1,   0, 255, 255, 
-    255, 255,   0,   0,   0,   0, 
-    232,  10,   0,   0,   8,   2, 
-      0,   0,   0,   0,   0,   0, 
-    255, 255, 255, 255,   0,   0, 
-      0,   0, 255, 255, 255, 255, 
-      1,   0,   1,   0,   0,   0, 
-      1,   0,   0,   0,   0,   0, 
-     69,  58,  92,  80, 114, 111, 
-    106, 101,  99, 116, 115,  92, 
-     78, 105,  99, 107, 101, 108, 
-     92,  78, 105,  99, 107, 101, 
-    108,  92,  68,  97, 116,  97, 
-     92,  83, 104,  97, 100, 101, 
-    114, 115,  92,  83, 105, 109, 
-    112, 108, 101,  86, 101, 114, 
-    116, 101, 120,  83, 104,  97, 
-    100, 101, 114,  46, 104, 108, 
-    115, 108,   0,   0, 254, 239, 
-    254, 239,   1,   0,   0,   0, 
-      1,   0,   0,   0,   0,   1, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255,  12,   0, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0, 148,  46,  49,   1, 
-     13, 146,  50,  97,   1,   0, 
-      0,   0,  22, 207, 238,  25, 
-     69,  36,  78,  65, 139,  65, 
-    218, 163, 218, 127, 147,  62, 
-    108,   0,   0,   0,  47,  76, 
-    105, 110, 107,  73, 110, 102, 
-    111,   0,  47, 110,  97, 109, 
-    101, 115,   0,  47, 115, 114, 
-     99,  47, 104, 101,  97, 100, 
-    101, 114,  98, 108, 111,  99, 
-    107,   0,  47, 115, 114,  99, 
-     47, 102, 105, 108, 101, 115, 
-     47, 101,  58,  92, 112, 114, 
-    111, 106, 101,  99, 116, 115, 
-     92, 110, 105,  99, 107, 101, 
-    108,  92, 110, 105,  99, 107, 
-    101, 108,  92, 100,  97, 116, 
-     97,  92, 115, 104,  97, 100, 
-    101, 114, 115,  92, 115, 105, 
-    109, 112, 108, 101, 118, 101, 
-    114, 116, 101, 120, 115, 104, 
-     97, 100, 101, 114,  46, 104, 
-    108, 115, 108,   0,   4,   0, 
-      0,   0,   6,   0,   0,   0, 
-      1,   0,   0,   0,  30,   0, 
-      0,   0,   0,   0,   0,   0, 
-     17,   0,   0,   0,   7,   0, 
-      0,   0,  34,   0,   0,   0, 
-      8,   0,   0,   0,  10,   0, 
-      0,   0,   6,   0,   0,   0, 
-      0,   0,   0,   0,   5,   0, 
-      0,   0,   0,   0,   0,   0, 
-    220,  81,  51,   1,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,  16,   0, 
-      0,   0,  32,   0,   0,   0, 
-    200,   0,   0,   0, 220,   1, 
-      0,   0,  95,   1,   0,   0, 
-     56,   0,   0,   0,   0,   0, 
-      0,   0, 135,   5,   0,   0, 
-    128,   0,   0,   0, 214,   4, 
-      0,   0,  16,  17,   0,   0, 
-     64,   0,   0,   0,   0,   0, 
-      0,   0,  40,   0,   0,   0, 
-     92,   2,   0,   0,  44,   0, 
-      0,   0, 200,   0,   0,   0, 
-      3,   0,   0,   0,  31,   0, 
-      0,   0,  22,   0,   0,   0, 
-     30,   0,   0,   0,  23,   0, 
-      0,   0,  11,   0,   0,   0, 
-      6,   0,   0,   0,  24,   0, 
-      0,   0,  12,   0,   0,   0, 
-      8,   0,   0,   0,   9,   0, 
-      0,   0,  10,   0,   0,   0, 
-     13,   0,   0,   0,  14,   0, 
-      0,   0,  15,   0,   0,   0, 
-     16,   0,   0,   0,  17,   0, 
-      0,   0,  18,   0,   0,   0, 
-     19,   0,   0,   0,  20,   0, 
-      0,   0,  21,   0,   0,   0, 
-      7,   0,   0,   0,  25,   0, 
-      0,   0,  26,   0,   0,   0, 
-     27,   0,   0,   0,  29,   0, 
-      0,   0,  28,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-     32,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,  83,  84, 
-     65,  84, 116,   0,   0,   0, 
-     95,   0,   0,   0,   7,   0, 
-      0,   0,   0,   0,   0,   0, 
-      9,   0,   0,   0,  66,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   1,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,  28,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,  82,  68,  69,  70, 
-    232,   1,   0,   0,   3,   0, 
-      0,   0, 160,   0,   0,   0, 
-      3,   0,   0,   0,  28,   0, 
-      0,   0,   0,   4, 254, 255, 
-      5,   1,   0,   0, 192,   1, 
-      0,   0, 124,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   1,   0,   0,   0, 
-      1,   0,   0,   0, 139,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      1,   0,   0,   0,   1,   0, 
-      0,   0,   1,   0,   0,   0, 
-    148,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   2,   0,   0,   0, 
-      1,   0,   0,   0,   1,   0, 
-      0,   0,  80, 101, 114,  65, 
-    112, 112, 108, 105,  99,  97, 
-    116, 105, 111, 110,   0,  80, 
-    101, 114,  70, 114,  97, 109, 
-    101,   0,  80, 101, 114,  79, 
-     98, 106, 101,  99, 116,   0, 
-    171, 171, 124,   0,   0,   0, 
-      1,   0,   0,   0, 232,   0, 
-      0,   0,  64,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0, 139,   0,   0,   0, 
-      3,   0,   0,   0,  36,   1, 
-      0,   0,  96,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0, 148,   0,   0,   0, 
-      1,   0,   0,   0, 156,   1, 
-      0,   0,  64,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   1,   0,   0, 
-      0,   0,   0,   0,  64,   0, 
-      0,   0,   2,   0,   0,   0, 
-     20,   1,   0,   0,   0,   0, 
-      0,   0, 112, 114, 111, 106, 
-    101,  99, 116, 105, 111, 110, 
-     77,  97, 116, 114, 105, 120, 
-      0, 171, 171, 171,   3,   0, 
-      3,   0,   4,   0,   4,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0, 108,   1,   0,   0, 
-      0,   0,   0,   0,  64,   0, 
-      0,   0,   2,   0,   0,   0, 
-     20,   1,   0,   0,   0,   0, 
-      0,   0, 119,   1,   0,   0, 
-     64,   0,   0,   0,  12,   0, 
-      0,   0,   2,   0,   0,   0, 
-    128,   1,   0,   0,   0,   0, 
-      0,   0, 144,   1,   0,   0, 
-     80,   0,   0,   0,  12,   0, 
-      0,   0,   2,   0,   0,   0, 
-    128,   1,   0,   0,   0,   0, 
-      0,   0, 118, 105, 101, 119, 
-     77,  97, 116, 114, 105, 120, 
-      0, 101, 121, 101,  80, 111, 
-    115,   0, 171, 171,   1,   0, 
-      3,   0,   1,   0,   3,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0, 108, 105, 103, 104, 
-    116,  80, 111, 115,   0, 171, 
-    171, 171, 180,   1,   0,   0, 
-      0,   0,   0,   0,  64,   0, 
-      0,   0,   2,   0,   0,   0, 
-     20,   1,   0,   0,   0,   0, 
-      0,   0, 119, 111, 114, 108, 
-    100,  77,  97, 116, 114, 105, 
-    120,   0,  77, 105,  99, 114, 
-    111, 115, 111, 102, 116,  32, 
-     40,  82,  41,  32,  72,  76, 
-     83,  76,  32,  83, 104,  97, 
-    100, 101, 114,  32,  67, 111, 
-    109, 112, 105, 108, 101, 114, 
-     32,  49,  48,  46,  49,   0, 
-     73,  83,  71,  78, 104,   0, 
-      0,   0,   3,   0,   0,   0, 
-      8,   0,   0,   0,  80,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   3,   0, 
-      0,   0,   0,   0,   0,   0, 
-      7,   7,   0,   0,  89,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   3,   0, 
-      0,   0,   1,   0,   0,   0, 
-      7,   7,   0,   0,  96,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   3,   0, 
-      0,   0,   2,   0,   0,   0, 
-      7,   7,   0,   0,  80,  79, 
-     83,  73,  84,  73,  79,  78, 
-      0,  78,  79,  82,  77,  65, 
-     76,   0,  67,  79,  76,  79, 
-     82,   0, 171, 171,  79,  83, 
-     71,  78, 204,   0,   0,   0, 
-      6,   0,   0,   0,   8,   0, 
-      0,   0, 152,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   3,   0,   0,   0, 
-      0,   0,   0,   0,   7,   8, 
-      0,   0, 167,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   3,   0,   0,   0, 
-      1,   0,   0,   0,   7,   8, 
-      0,   0, 174,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   3,   0,   0,   0, 
-      2,   0,   0,   0,  15,   0, 
-      0,   0, 180,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   3,   0,   0,   0, 
-      3,   0,   0,   0,   7,   8, 
-      0,   0, 185,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   3,   0,   0,   0, 
-      4,   0,   0,   0,   7,   8, 
-      0,   0, 191,   0,   0,   0, 
-      0,   0,   0,   0,   1,   0, 
-      0,   0,   3,   0,   0,   0, 
-      5,   0,   0,   0,  15,   0, 
-      0,   0,  87,  79,  82,  76, 
-     68,  95,  80,  79,  83,  73, 
-     84,  73,  79,  78,   0,  78, 
-     79,  82,  77,  65,  76,   0, 
-     67,  79,  76,  79,  82,   0, 
-     86,  73,  69,  87,   0,  76, 
-     73,  71,  72,  84,   0,  83, 
-     86,  95,  80,  79,  83,  73, 
-     84,  73,  79,  78,   0, 171
-};
@@ -1,90 +1,109 @@
 #include "game.h"
+#include "AssetArchive.h"
+#include "JobSystem.h"
 #include "Renderer/renderer.h"
+#include "Renderer/ShaderCooker.h"
+#include "Renderer/TextureCache.h"
+#include "imgui/imgui.h"
+#include <cstddef>
 
 namespace Nickel {
 	using namespace Renderer;
 
-	auto SetPipelineState(const ID3D11DeviceContext1& cmd, D3D11_VIEWPORT* viewport, const PipelineState& pipeline) -> void {
-		ID3D11DeviceContext1& cmdQueue = const_cast<ID3D11DeviceContext1&>(cmd);
-		cmdQueue.RSSetState(pipeline.rasterizerState);
-		cmdQueue.OMSetDepthStencilState(pipeline.depthStencilState, 1);
-		// cmdQueue.OMSetBlendState() // TODO
-		cmdQueue.RSSetViewports(1, viewport); // TOOD: move to render target setup?
+	struct DrawItem {
+		const DescribedMesh* mesh;
+		Transform transform;
+		Vec3 offset;
+		const XMMATRIX* viewProjectionMatrix;
+	};
+
+	template <typename T>
+	auto CreateConstantBuffer(const PlatformInterface& gfx) -> BufferHandle {
+		static_assert(sizeof(T) % 16 == 0, "constant buffer size has to be a multiple of 16");
+		return gfx.CreateBuffer(BufferDesc{ .type = BufferType::Constant, .size = sizeof(T) }, nullptr);
 	}
 
-	auto Submit(RendererState& rs, const DXLayer::CmdQueue& cmdQueue, const DescribedMesh& mesh) -> void {
-		auto cmd = cmdQueue.queue.Get();
-		const auto program = mesh.material.program;
-		if (program == nullptr) {
-			Logger::Error("Mesh material program is null");
+	// NOTE: the archive knows the cbuffer layouts, catches the C++ block drifting away from the HLSL one
+	auto CheckConstantBufferLayout(const ShaderLibrary& shaders, const char* program, ShaderStage stage, u32 slot, u32 size) -> bool {
+		const u32 reflectedSize = shaders.GetConstantBufferSize(program, stage, slot);
+		if (reflectedSize == size)
+			return true;
+
+		Logger::Critical(std::string("'") + program + "' constant buffer " + std::to_string(slot) + " is " + std::to_string(reflectedSize) + " bytes in the shader archive but " +
+			std::to_string(size) + " in C++");
+		Assert(false);
+		return false;
+	}
+
+	auto Submit(const RendererState& rs, CommandList& list, const DescribedMesh& mesh) -> void {
+		if (!rs.materials.IsValid(mesh.material)) {
+			Logger::Error("Mesh material is null");
 			return;
 		}
 
 		const auto& gpuData = mesh.gpuData;
-		auto& mat = mesh.material;
-
-		if (mesh.gpuData.indexCount == 0) {
+		if (gpuData.indexCount == 0) {
 			Logger::Warn("Index count is 0!");
 			return;
 		}
 
-		mat.program->Bind(cmd);
-		cmd->IASetPrimitiveTopology(gpuData.topology);
-
-		const auto indexBuffer = gpuData.indexBuffer.buffer.get();
-		const auto vertexBuffer = gpuData.vertexBuffer.buffer.get();
-
-		DXLayer::SetIndexBuffer(*cmd, indexBuffer);
-		DXLayer::SetVertexBuffer(*cmd, vertexBuffer, gpuData.vertexBuffer.stride, gpuData.vertexBuffer.offset);
-
-		if (mat.textures.size() > 0) {
-			cmd->PSSetSamplers(0, 1, &mat.textures[0].samplerState);
-			for (int i = 0; i < mat.textures.size(); i++) {
-				const auto& tex = mat.textures[i];
-				cmd->PSSetShaderResources(i, 1, &tex.srv); // TODO: this just puts every texture in slot 0 - fix it
-			}
-		}
-		
-		cmd->VSSetConstantBuffers(0, ArrayCount(rs.g_d3dConstantBuffers), rs.g_d3dConstantBuffers);
-		cmd->PSSetConstantBuffers(0, ArrayCount(rs.g_d3dConstantBuffers), rs.g_d3dConstantBuffers);
+		rs.materials.Bind(list, mesh.material);
+		list.SetTopology(gpuData.topology);
 
-		const auto vertexConstantBuffer = mat.vertexConstantBuffer.buffer.Get();
-		if (vertexConstantBuffer != nullptr) {
-			Assert(mat.vertexConstantBuffer.index < D3D11_COMMONSHADER_CONSTANT_BUFFER_HW_SLOT_COUNT)
-			cmd->VSSetConstantBuffers(mat.vertexConstantBuffer.index, 1, &vertexConstantBuffer);
-		}
+		list.SetIndexBuffer(gpuData.indexBuffer.buffer, IndexFormat::U32, gpuData.indexBuffer.offset);
+		list.SetVertexBuffer(gpuData.vertexBuffer.buffer, gpuData.vertexBuffer.stride, gpuData.vertexBuffer.offset);
 
-		const auto pixelConstantBuffer = mat.pixelConstantBuffer.buffer.Get();
-		if (pixelConstantBuffer != nullptr) {
-			Assert(mat.pixelConstantBuffer.index < D3D11_COMMONSHADER_CONSTANT_BUFFER_HW_SLOT_COUNT)
-			cmd->PSSetConstantBuffers(mat.pixelConstantBuffer.index, 1, &pixelConstantBuffer);
+		for (u32 i = 0; i < ArrayCount(rs.constantBuffers); i++) {
+			list.SetConstantBuffer(ShaderStage::Vertex, i, rs.constantBuffers[i]);
+			list.SetConstantBuffer(ShaderStage::Pixel, i, rs.constantBuffers[i]);
 		}
 
-		SetPipelineState(*cmd, &rs.g_Viewport, mesh.material.pipelineState);
-		DXLayer::DrawIndexed(cmdQueue, mesh.gpuData.indexCount, 0, 0);
+		list.DrawIndexed(static_cast<u32>(gpuData.indexCount));
 	}
 
-	auto DrawModel(RendererState& rs, const Nickel::Renderer::DXLayer::CmdQueue& cmd, const DescribedMesh& mesh, Vec3 offset = {0.0, 0.0, 0.0}) -> void { // TODO: const Material* overrideMat = nullptr
-		auto c = cmd.queue.Get();
-		Assert(c != nullptr);
-
-		// update:
-		const auto t = mesh.transform;
-		const auto& pos = t.position + offset;
+	auto DrawModel(const RendererState& rs, CommandList& list, const DrawItem& item) -> void { // TODO: const Material* overrideMat = nullptr
+		const auto& t = item.transform;
+		const auto& pos = t.position + item.offset;
 		auto worldMat = XMMatrixScaling(t.scale.x, t.scale.y, t.scale.z)
 			* XMMatrixRotationRollPitchYawFromVector(FXMVECTOR{ t.rotation.x, t.rotation.y, t.rotation.z })
 			* XMMatrixTranslation(pos.x, pos.y, pos.z);
 
-		const auto& viewProjectionMatrix = rs.mainCamera.get()->GetViewProjectionMatrix();
+		const auto& viewProjectionMatrix = *item.viewProjectionMatrix;
 
 		PerObjectBufferData data;
 		data.modelMatrix = XMMatrixTranspose(worldMat);
 		data.viewProjectionMatrix = XMMatrixTranspose(viewProjectionMatrix);
 		data.modelViewProjectionMatrix = XMMatrixTranspose(worldMat * viewProjectionMatrix);
 
-		c->UpdateSubresource1(rs.g_d3dConstantBuffers[(u32)ConstantBufferType::CB_Object], 0, nullptr, &data, 0, 0, 0);
+		list.UpdateBuffer(rs.constantBuffers[(u32)ConstantBufferType::CB_Object], data);
 
-		Submit(rs, cmd, mesh);		
+		Submit(rs, list, *item.mesh);
+	}
+
+	auto DrawPolylines(const RendererState& rs, CommandList& list, const XMMATRIX& viewProjectionMatrix) -> void {
+		// NOTE: the points are already in world space
+		PerObjectBufferData data;
+		data.modelMatrix = XMMatrixIdentity();
+		data.viewProjectionMatrix = XMMatrixTranspose(viewProjectionMatrix);
+		data.modelViewProjectionMatrix = data.viewProjectionMatrix;
+
+		list.UpdateBuffer(rs.constantBuffers[(u32)ConstantBufferType::CB_Object], data);
+		for (u32 i = 0; i < ArrayCount(rs.constantBuffers); i++)
+			list.SetConstantBuffer(ShaderStage::Vertex, i, rs.constantBuffers[i]);
+
+		rs.polylines.Draw(list);
+	}
+
+	// NOTE: imported models are uploaded from their arena as they are, see MeshVertex
+	static_assert(sizeof(MeshVertex) == sizeof(VertexPosUV) && offsetof(MeshVertex, normal) == offsetof(VertexPosUV, Normal) && offsetof(MeshVertex, uv) == offsetof(VertexPosUV, UV));
+
+	// NOTE: a line per import with every stage, the upload is the render thread's part
+	auto LogModelImport(const std::string& name, const ModelImportStats& stats, std::chrono::steady_clock::time_point uploadStart) -> void {
+		const f64 uploadMilliseconds = std::chrono::duration<f64, std::milli>(std::chrono::steady_clock::now() - uploadStart).count();
+		const char* importer = stats.importer == ModelImporter::Native ? "native glTF" : "assimp";
+		Logger::Info("Imported " + name + " with " + importer + ": parsed in " + std::to_string(stats.parseMilliseconds) + " ms (" + std::to_string(stats.sceneBytes >> 10) + " KB source), converted in " +
+			std::to_string(stats.convertMilliseconds) + " ms (" + std::to_string(stats.arenaBytes >> 10) + " KB arena, " + std::to_string(stats.peakBytes >> 10) + " KB peak), uploaded in " +
+			std::to_string(uploadMilliseconds) + " ms");
 	}
 
 	auto GetVertexPosUVFromModelData(MeshData* data) -> std::vector<VertexPosUV> {
@@ -132,10 +151,14 @@ namespace Nickel {
 		return result;
 	}
 
-	auto Nickel::LoadObjMeshData(MeshData& meshData, const std::string& path) -> void {
+	auto LoadObjMeshData(MeshData& meshData, const std::string& path) -> void {
+		AssetData file;
+		if (!ReadAsset(path, file))
+			return;
+
+		// NOTE: the parser only reads through the pointer
 		auto loader = ObjLoader();
-		ObjFileMemory objFile = loader.DEBUG_ReadEntireFile(path.c_str());
-		loader.LoadObjMesh(objFile, meshData);
+		loader.LoadObjMesh(ObjFileMemory{ .data = const_cast<u8*>(file.bytes.data()), .size = file.bytes.size() }, meshData);
 	}
 
 	auto LoadBunnyMesh(MeshData& meshData) -> void {
@@ -151,158 +174,194 @@ namespace Nickel {
 		LoadObjMeshData(meshData, path);
 	}
 
+	// NOTE: time to first frame and until every asynchronous load is resident, counted from Initialize
+	static std::chrono::steady_clock::time_point initializeStart;
+	static bool firstFrameLogged = false;
+	static bool loadsResidentLogged = false;
+
+	constexpr u64 TextureBudgetBytes = 128ull << 20; // NOTE: streamed textures only, the helmet's five maps need 107 MB with every mip
+
 	auto Initialize(GameMemory* memory, RendererState* rs) -> void {
+		initializeStart = std::chrono::steady_clock::now();
 		Assert(memory != nullptr);
 		Assert(rs != nullptr);
-		Assert(rs->device);
-		Assert(rs->cmdQueue.queue);
+		Assert(rs->backbuffer.IsValid());
+
+		// NOTE: the first use makes the calling thread the main thread, main thread jobs only run there
+		JobSystem::Get();
 
-		ID3D11Device1* device = rs->device.Get();
+		// NOTE: a Data.pak built with the headless -pack stands in for the loose files under Data/, whatever it lacks is
+		// still read from Data/. Without one everything loads loose, and edits to Data/ are hot reloaded
+		const bool packed = AssetExists(AssetArchivePath) && MountAssetArchive(AssetArchivePath, AssetMountPoint);
+
+		const auto& gfx = rs->gfx;
 		auto resourceManager = ResourceManager::GetInstance();
-		resourceManager->Init(device);
+		resourceManager->Init(gfx, rs->pipelineCache);
+		if (!packed)
+			resourceManager->EnableHotReload(AssetMountPoint);
+		resourceManager->EnableStreaming(TextureStreamingDesc{ .budgetBytes = TextureBudgetBytes });
 
 		rs->mainCamera = std::make_unique<Camera>(45.0f, 1.5f, 0.1f, 100.0f);
 
-		background.Create(device);
+		// NOTE: re-cooks the archive when FxCompile left newer bytecode behind, shipped data only has the archive
+		if (!ShaderCooker::CookIfStale(ShaderCooker::ManifestPath, ShaderCooker::SourceShaderDir, ShaderCooker::CompiledShaderDir, ShaderArchivePath) || !rs->shaders.Open(ShaderArchivePath)) {
+			Logger::Critical("Failed to load the shader archive");
+			Assert(false);
+		}
 
-		rs->defaultDepthStencilBuffer = DXLayer::CreateDepthStencilTexture(device, rs->backbufferWidth, rs->backbufferHeight);
-		Assert(rs->defaultDepthStencilBuffer != nullptr);
-		rs->defaultDepthStencilView = DXLayer::CreateDepthStencilView(device, rs->defaultDepthStencilBuffer);
+		background.Create(gfx, rs->shaders, rs->pipelineCache, rs->materials);
+		rs->debugDraw.Create(gfx, rs->shaders, rs->pipelineCache);
 
 		// Create the constant buffers for the variables defined in the vertex shader.
-		rs->g_d3dConstantBuffers[(u32)ConstantBufferType::CB_Appliation] = DXLayer::CreateConstantBuffer(device, sizeof(PerApplicationData));
-		rs->g_d3dConstantBuffers[(u32)ConstantBufferType::CB_Object] = DXLayer::CreateConstantBuffer(device, sizeof(PerObjectBufferData));
-		rs->g_d3dConstantBuffers[(u32)ConstantBufferType::CB_Frame] = DXLayer::CreateConstantBuffer(device, sizeof(PerFrameBufferData));
-
-		// Create shader programs
-		rs->pbrProgram.Create(rs->device.Get(), std::span{ g_PbrVertexShader }, std::span{ g_PbrPixelShader });
-		rs->lineProgram.Create(rs->device.Get(), std::span{ g_LineVertexShader }, std::span{ g_ColorPixelShader });
-		rs->simpleProgram.Create(rs->device.Get(), std::span{ g_SimpleVertexShader }, std::span{ g_SimplePixelShader });
-		rs->textureProgram.Create(rs->device.Get(), std::span{ g_TexVertexShader }, std::span{ g_TexPixelShader });
-
-		rs->albedoTexture = resourceManager->LoadTexture(L"Data/Models/DamagedHelmet/Default_albedo.jpg");
-		rs->normalTexture = resourceManager->LoadTexture(L"Data/Models/DamagedHelmet/Default_normal.jpg");
-		rs->aoTexture = resourceManager->LoadTexture(L"Data/Models/DamagedHelmet/Default_AO.jpg");
-		rs->metalRoughnessTexture = resourceManager->LoadTexture(L"Data/Models/DamagedHelmet/Default_metalRoughness.jpg");
-		rs->emissiveTexture = resourceManager->LoadTexture(L"Data/Models/DamagedHelmet/Default_emissive.jpg");
-
-		//rs->albedoTexture = resourceManager->LoadTexture(L"Data/Models/HornetHelmet/textures/03___Default_baseColor.jpg");
-		//rs->normalTexture = resourceManager->LoadTexture(L"Data/Models/HornetHelmet/textures/03___Default_normal.jpg");
-		//rs->aoTexture = resourceManager->LoadTexture(L"Data/Models/HornetHelmet/Default_AO.jpg");
-		//rs->metalRoughnessTexture = resourceManager->LoadTexture(L"Data/Models/HornetHelmet/textures/03___Default_metallicRoughness.png");
-		//rs->emissiveTexture = resourceManager->LoadTexture(L"Data/Models/HornetHelmet/textures/03___Default_emissive.jpg");
-
-		rs->debugBoxTexture = resourceManager->LoadTexture(L"Data/Models/BoxTextured/CesiumLogoFlat.png");
-
-		rs->matCapTexture = resourceManager->LoadTexture(L"Data/Textures/matcap.jpg");
-
-		const wchar_t* radianceFacePaths[6] = {
-			L"Data/Textures/skybox/radianceCubemap/output_pmrem_posx.hdr",
-			L"Data/Textures/skybox/radianceCubemap/output_pmrem_negx.hdr",
-			L"Data/Textures/skybox/radianceCubemap/output_pmrem_posy.hdr",
-			L"Data/Textures/skybox/radianceCubemap/output_pmrem_negy.hdr",
-			L"Data/Textures/skybox/radianceCubemap/output_pmrem_posz.hdr",
-			L"Data/Textures/skybox/radianceCubemap/output_pmrem_negz.hdr"
+		rs->constantBuffers[(u32)ConstantBufferType::CB_Appliation] = CreateConstantBuffer<PerApplicationData>(gfx);
+		rs->constantBuffers[(u32)ConstantBufferType::CB_Object] = CreateConstantBuffer<PerObjectBufferData>(gfx);
+		rs->constantBuffers[(u32)ConstantBufferType::CB_Frame] = CreateConstantBuffer<PerFrameBufferData>(gfx);
+
+		rs->commandLists = std::vector<CommandList>(GetWorkerCount());
+
+		// Create shader programs, the PBR and line variants are picked once their material's inputs are known
+		rs->simpleProgram = rs->shaders.GetProgram(gfx, "Simple");
+		rs->textureProgram = rs->shaders.GetProgram(gfx, "Texture");
+
+		// NOTE: decoded on the workers, the materials bind the placeholder color until ProcessCompletedLoads swaps the data in.
+		// Textures with a role are cooked to BC on the first run and come from the texture cache after that. A missing
+		// file gets no texture at all, the PBR variant is picked from which maps exist before anything finished loading
+		auto LoadTexture = [resourceManager](const std::string& path, std::array<u8, 4> placeholder = { 255, 255, 255, 255 }, TextureRole role = TextureRole::Raw) {
+			if (!AssetExists(path)) {
+				Logger::Warn("Texture not found: " + path);
+				return Texture{ .sampler = resourceManager->GetDefaultSampler() };
+			}
+
+			return Texture{ .texture = resourceManager->LoadTextureAsync(path, placeholder, role), .sampler = resourceManager->GetDefaultSampler() };
+		};
+
+		rs->albedoTexture = LoadTexture("Data/Models/DamagedHelmet/Default_albedo.jpg", { 255, 255, 255, 255 }, TextureRole::Albedo);
+		rs->normalTexture = LoadTexture("Data/Models/DamagedHelmet/Default_normal.jpg", { 128, 128, 255, 255 }, TextureRole::Normal);
+		rs->aoTexture = LoadTexture("Data/Models/DamagedHelmet/Default_AO.jpg", { 255, 255, 255, 255 }, TextureRole::Occlusion);
+		rs->metalRoughnessTexture = LoadTexture("Data/Models/DamagedHelmet/Default_metalRoughness.jpg", { 0, 255, 0, 255 }, TextureRole::MetalRoughness);
+		rs->emissiveTexture = LoadTexture("Data/Models/DamagedHelmet/Default_emissive.jpg", { 0, 0, 0, 255 }, TextureRole::Emissive);
+
+		//rs->albedoTexture = LoadTexture("Data/Models/HornetHelmet/textures/03___Default_baseColor.jpg");
+		//rs->normalTexture = LoadTexture("Data/Models/HornetHelmet/textures/03___Default_normal.jpg");
+		//rs->aoTexture = LoadTexture("Data/Models/HornetHelmet/Default_AO.jpg");
+		//rs->metalRoughnessTexture = LoadTexture("Data/Models/HornetHelmet/textures/03___Default_metallicRoughness.png");
+		//rs->emissiveTexture = LoadTexture("Data/Models/HornetHelmet/textures/03___Default_emissive.jpg");
+
+		rs->debugBoxTexture = LoadTexture("Data/Models/BoxTextured/CesiumLogoFlat.png");
+
+		rs->matCapTexture = LoadTexture("Data/Textures/matcap.jpg", { 128, 128, 128, 255 });
+
+		const std::string radianceFacePaths[6] = {
+			"Data/Textures/skybox/radianceCubemap/output_pmrem_posx.hdr",
+			"Data/Textures/skybox/radianceCubemap/output_pmrem_negx.hdr",
+			"Data/Textures/skybox/radianceCubemap/output_pmrem_posy.hdr",
+			"Data/Textures/skybox/radianceCubemap/output_pmrem_negy.hdr",
+			"Data/Textures/skybox/radianceCubemap/output_pmrem_posz.hdr",
+			"Data/Textures/skybox/radianceCubemap/output_pmrem_negz.hdr"
 		};
-		rs->radianceTexture = DXLayer::CreateCubeMap(device, radianceFacePaths);
-		rs->brdfLUT = resourceManager->LoadTexture(L"Data/Textures/brdfLUT.jpg");
-
-		auto defaultDepthStencilState = DXLayer::CreateDepthStencilState(device, true, D3D11_DEPTH_WRITE_MASK_ALL, D3D11_COMPARISON_LESS, false);
-		auto defaultRasterizerState = DXLayer::CreateDefaultRasterizerState(device);
-
-		D3D11_RENDER_TARGET_BLEND_DESC1 blendDescription = { 0 };
-		D3D11_BLEND_DESC1 stateDesc = { 0 };
-		stateDesc.AlphaToCoverageEnable = false;
-		stateDesc.IndependentBlendEnable = true;
-		for (int i = 0; i < ArrayCount(stateDesc.RenderTarget); i++) {
-			stateDesc.RenderTarget[i] = blendDescription;
+		const auto radianceImage = resourceManager->LoadCubeMapImage(radianceFacePaths);
+
+		{ // NOTE: specular IBL, the GGX mip chain and the split sum LUT come from the texture cache after the first run
+			PrefilterStats radianceStats{}, lutStats{};
+			const auto radianceMap = radianceImage.IsValid() ? CreateRadianceMap(gfx, radianceImage, TextureCacheDir, PrefilterDesc{}, &radianceStats) : TextureHandle{};
+			rs->radianceTexture = Texture{ .texture = radianceMap, .sampler = resourceManager->GetDefaultSampler() };
+			rs->brdfLUT = Texture{ .texture = CreateBrdfLut(gfx, TextureCacheDir, BrdfLutDesc{}, &lutStats), .sampler = resourceManager->GetDefaultSampler() };
+			Logger::Info(std::string(radianceStats.cached ? "Loaded " : "Prefiltered ") + std::to_string(radianceStats.mipCount) + " radiance mips in " + std::to_string(radianceStats.milliseconds) + " ms");
+			Logger::Info(std::string(lutStats.cached ? "Loaded" : "Integrated") + " the BRDF LUT in " + std::to_string(lutStats.milliseconds) + " ms");
+		}
+
+		{ // NOTE: diffuse IBL, the environment projected into SH instead of a convolved irradiance cube map
+			SHProjectionStats shStats{};
+			const auto irradiance = ConvolveIrradianceSH(ProjectCubemapSH(radianceImage, &shStats));
+			const auto shaderData = MakeIrradianceShaderData(irradiance);
+			rs->irradianceBuffer = gfx.CreateBuffer(BufferDesc{ .type = BufferType::Constant, .size = sizeof(IrradianceShaderData) }, &shaderData);
+			Logger::Info("Projected " + std::to_string(shStats.texelCount) + " environment texels into SH in " + std::to_string(shStats.milliseconds) + " ms");
 		}
 
-		// TODO: this is only dummy test code
-		ID3D11BlendState1* state;
-		device->CreateBlendState1(&stateDesc, &state);
-		const FLOAT blendFactor[4] = { 0 };
-		// rs->cmdQueue.queue->OMSetBlendState(state, blendFactor, 0);
+		// TODO: blend states aren't part of the platform interface yet
 
 		// materials
 		{
-			auto& simpleMat = rs->simpleMat;
-			simpleMat = Material{
-				.program = &rs->simpleProgram,
-				.pipelineState = PipelineState{
-					.rasterizerState = defaultRasterizerState,
-					.depthStencilState = defaultDepthStencilState
-				},
-			};
+			const auto simpleTemplate = rs->materials.CreateTemplate(gfx, rs->pipelineCache, MaterialTemplateDesc{ .pipeline = PipelineStateDesc{ .program = rs->simpleProgram } });
+			rs->simpleMat = rs->materials.CreateInstance(gfx, MaterialInstanceDesc{ .materialTemplate = simpleTemplate });
 		}
 		
-		
-		// simpleMat.constantBuffer = DXLayer::CreateConstantBuffer(device, )
 		{
-			auto& textureMat = rs->textureMat;
-			textureMat = Material{
-				.program = &rs->textureProgram,
-				.pipelineState = PipelineState{
-					.rasterizerState = defaultRasterizerState,
-					.depthStencilState = defaultDepthStencilState
-				}
-			};
-			textureMat.textures = std::vector<DXLayer::TextureDX11>(1);
-			textureMat.textures[0] = rs->albedoTexture;
+			const auto textureTemplate = rs->materials.CreateTemplate(gfx, rs->pipelineCache, MaterialTemplateDesc{
+				.pipeline = PipelineStateDesc{ .program = rs->textureProgram },
+				.textureCount = 1
+			});
+			rs->textureMat = rs->materials.CreateInstance(gfx, MaterialInstanceDesc{
+				.materialTemplate = textureTemplate,
+				.textures = std::span{ &rs->albedoTexture.texture, 1 },
+				.samplers = std::span{ &rs->albedoTexture.sampler, 1 }
+			});
 		}
 
 		{ // PBR mat
-			auto& pbrMat = rs->pbrMat;
-			pbrMat = Material{
-				.program = &rs->pbrProgram,
-				.pipelineState = PipelineState{
-					.rasterizerState = defaultRasterizerState,
-					.depthStencilState = defaultDepthStencilState
-				},
-				.pixelConstantBuffer = {
-					.buffer = DXLayer::CreateConstantBuffer(device, sizeof(PbrPixelBufferData)),
-					.index = 3
-				}
+			const Texture textures[] = {
+				rs->albedoTexture,
+				rs->normalTexture,
+				rs->metalRoughnessTexture,
+				rs->aoTexture,
+				rs->emissiveTexture,
+				background.texture, // NOTE: t5 isn't read anymore, kept so the slots after it stay put
+				rs->radianceTexture,
+				rs->brdfLUT
 			};
-			pbrMat.textures = std::vector<DXLayer::TextureDX11>(8);
-			pbrMat.textures[0] = rs->albedoTexture;
-			pbrMat.textures[1] = rs->normalTexture;
-			pbrMat.textures[2] = rs->metalRoughnessTexture;
-			pbrMat.textures[3] = rs->aoTexture;
-			pbrMat.textures[4] = rs->emissiveTexture;
-			pbrMat.textures[5] = background.texture;
-			pbrMat.textures[6] = rs->radianceTexture;
-			pbrMat.textures[7] = rs->brdfLUT;
+
+			TextureHandle textureHandles[ArrayCount(textures)];
+			SamplerHandle samplerHandles[ArrayCount(textures)];
+			for (u32 i = 0; i < ArrayCount(textures); i++) {
+				textureHandles[i] = textures[i].texture;
+				samplerHandles[i] = textures[i].sampler;
+			}
 
 			PbrPixelBufferData bufferData{
-				.lightPositions = {XMFLOAT4(0.0f, 0.0f, 0.0f, 0), XMFLOAT4(0.0f, 0.0f, 0.0f, 0), XMFLOAT4(0.0f, 0.0f, 0.0f, 0), XMFLOAT4(0.0f, 0.0f, 0.0f, 0)},
-				.lightColors = {XMFLOAT4(0.1f, 0.1f, 0.6f, 0), XMFLOAT4(1.0f, 0.0f, 0.0f, 0), XMFLOAT4(0.0f, 1.0f, 0.0f, 0), XMFLOAT4(0.4f, 0.4f, 0.4f, 0)},
 				.albedoFactor = XMFLOAT4(0.2f, 0.05f, 0.75f, 0.0f),
 				.metallic = 0.0f,
 				.roughness = 0.4f,
 				.ao = 0.5f
 			};
-			pbrMat.pixelConstantBuffer.Update(rs->cmdQueue.queue.Get(), bufferData);
+
+			// NOTE: maps the material doesn't have are left out of the shader instead of sampling a dummy texture. A map that
+			// exists but fails to decode keeps its placeholder, a neutral value (flat normal, no emission, full AO)
+			rs->pbrKey = PbrPermutation::Key(rs->normalTexture.texture.IsValid(), rs->emissiveTexture.texture.IsValid(), rs->aoTexture.texture.IsValid());
+			rs->pbrProgram = rs->shaders.GetProgram(gfx, "Pbr", rs->pbrKey);
+
+			CheckConstantBufferLayout(rs->shaders, "Pbr", ShaderStage::Pixel, 3, sizeof(PbrPixelBufferData));
+			CheckConstantBufferLayout(rs->shaders, "Pbr", ShaderStage::Pixel, ClusterConstantSlot, sizeof(ClusterShaderData));
+			CheckConstantBufferLayout(rs->shaders, "Pbr", ShaderStage::Pixel, IrradianceConstantSlot, sizeof(IrradianceShaderData));
+			const auto pbrTemplate = rs->materials.CreateTemplate(gfx, rs->pipelineCache, MaterialTemplateDesc{
+				.pipeline = PipelineStateDesc{ .program = rs->pbrProgram },
+				.parameterStage = ShaderStage::Pixel,
+				.parameterSlot = 3,
+				.parameterSize = sizeof(PbrPixelBufferData),
+				.textureCount = ArrayCount(textures)
+			});
+			rs->pbrMat = rs->materials.CreateInstance(gfx, MaterialInstanceDesc{
+				.materialTemplate = pbrTemplate,
+				.textures = textureHandles,
+				.samplers = samplerHandles,
+				.parameters = &bufferData
+			});
 		}
 
 		if (!LoadContent(rs))
 			Logger::Error("Content couldn't be loaded");
 
 		// set projection matrix
-		RECT clientRect;
-		GetClientRect(rs->g_WindowHandle, &clientRect);
-
-		float clientWidth = static_cast<float>(clientRect.right - clientRect.left);
-		float clientHeight = static_cast<float>(clientRect.bottom - clientRect.top);
+		const f32 clientWidth = static_cast<f32>(rs->backbufferWidth);
+		const f32 clientHeight = static_cast<f32>(rs->backbufferHeight);
 
-		const f32 aspectRatio = static_cast<f32>(clientWidth) / clientHeight;
+		const f32 aspectRatio = clientWidth / clientHeight;
 		const auto& projectionMatrix = rs->mainCamera.get()->GetProjectionMatrix();
 		auto data = PerApplicationData{
 			.projectionMatrix = XMMatrixTranspose(projectionMatrix),
 			.clientData = XMFLOAT3(clientWidth,clientHeight,aspectRatio)
 		};
 
-		rs->cmdQueue.queue->UpdateSubresource1(rs->g_d3dConstantBuffers[(u32)ConstantBufferType::CB_Appliation], 0, nullptr, &data, 0, 0, 0);
+		UpdateBuffer(gfx, rs->constantBuffers[(u32)ConstantBufferType::CB_Appliation], data);
 	}
 
 	static f32 previousMouseX = 0.5f;
@@ -310,12 +369,38 @@ namespace Nickel {
 	static XMFLOAT4 light1Pos = { 0.0, 0.0, 0.0, 0.0 };
 	static XMFLOAT4 light2Pos = { 0.0, 0.0, 0.0, 0.0 };
 	static XMFLOAT4 light3Pos = { 0.0, 0.0, 0.0, 0.0 };
-	static XMFLOAT4 light4Pos = { 0.0, 0.0, 0.0, 0.0 };
 	static f32 timer = 0.0f;
-	const FLOAT clearColor[4] = { 0.13333f, 0.13333f, 0.13333f, 1.0f };
+	static std::vector<DrawItem> frameDrawItems;
+	const f32 clearColor[4] = { 0.13333f, 0.13333f, 0.13333f, 1.0f };
 	auto UpdateAndRender(GameMemory* memory, RendererState* rs, GameInput* input) -> void {
 		// GameState* gs = (GameState*)memory;
 
+		JobSystem::Get().RunMainThreadJobs();
+
+		auto resourceManager = ResourceManager::GetInstance();
+		resourceManager->ProcessCompletedLoads(rs->materials);
+		if (!loadsResidentLogged && resourceManager->GetPendingLoadCount() == 0) {
+			const auto& stats = resourceManager->GetLoadStats();
+			Logger::Info(std::to_string(stats.requested) + " asynchronous loads resident " + std::to_string(std::chrono::duration<f64, std::milli>(std::chrono::steady_clock::now() - initializeStart).count()) +
+				" ms after Initialize, " + std::to_string(stats.failed) + " failed, " + std::to_string(stats.decodeMilliseconds) + " ms decoding, " + std::to_string(stats.uploadMilliseconds) + " ms uploading");
+			Logger::Info("Texture cooker: " + std::to_string(stats.texturesCooked) + " textures, " + std::to_string(stats.cookedCacheHits) + " from the cache, " +
+				std::to_string(stats.cookedBytes >> 10) + " KB instead of " + std::to_string(stats.uncompressedBytes >> 10) + " KB as RGBA8");
+			const auto cache = resourceManager->GetCacheStats();
+			Logger::Info("Asset cache: " + std::to_string(cache.residentTextures) + " textures (" + std::to_string(cache.residentBytes >> 10) + " KB) and " + std::to_string(cache.residentModels) + " models resident, " +
+				std::to_string(cache.pathHits) + " path hits, " + std::to_string(cache.contentHits) + " content hits, " + std::to_string(cache.misses) + " misses, " + std::to_string(cache.bytesSaved >> 10) + " KB saved");
+			const auto streaming = resourceManager->GetStreamingStats();
+			Logger::Info("Texture streaming: " + std::to_string(streaming.textureCount) + " textures, " + std::to_string(streaming.residentBytes >> 10) + " of " + std::to_string(streaming.budgetBytes >> 10) + " KB resident");
+			// NOTE: the startup burst is over, the decoder's pooled buffers would only sit there
+			const auto pool = GetImageBufferPoolStats();
+			Logger::Info("Image decoder: " + std::to_string(pool.allocations) + " buffers allocated, " + std::to_string(pool.reuses) + " reused, " + std::to_string(pool.retainedBytes >> 10) + " KB released");
+			TrimImageBufferPool();
+			const auto& reader = resourceManager->GetFileReader();
+			const auto& reads = reader.GetStats();
+			Logger::Info("File reads: " + std::to_string(reads.reads) + " files (" + std::to_string(reads.bytes >> 10) + " KB) over " + reader.GetBackendName() + " in " + std::to_string(reads.batches) +
+				" batches, " + std::to_string(reads.failed) + " failed, " + std::to_string(reads.reads > 0 ? reads.milliseconds / reads.reads : 0.0) + " ms average latency");
+			loadsResidentLogged = true;
+		}
+
 		timer += 0.01f;
 		if (timer > 1000.0f)
 			timer -= 1000.0f;
@@ -331,42 +416,46 @@ namespace Nickel {
 		frameData.cameraPosition = XMFLOAT3(camera.position.x, camera.position.y, camera.position.z);
 		frameData.lightPosition = lightPos;
 
-		auto& cmd = rs->cmdQueue;
-		auto& queue = *cmd.queue.Get();
-
-		queue.UpdateSubresource1(rs->g_d3dConstantBuffers[(u32)ConstantBufferType::CB_Frame], 0, nullptr, &frameData, 0, 0, 0);
+		const auto& gfx = rs->gfx;
+		UpdateBuffer(gfx, rs->constantBuffers[(u32)ConstantBufferType::CB_Frame], frameData);
 
 		//light1Pos = XMFLOAT4(3.0f*cos(timer), 3.0f*sin(timer), 0.0, 0.0);
 		Vec3 newLightPos = { camera.position.x, camera.position.y-2.0f, static_cast<f32>(-4.0f + sin(timer) * 5.0f) };
-		light4Pos = XMFLOAT4(newLightPos.x, newLightPos.y, newLightPos.z, 0.0f);
 		rs->debugCube.transform.position = newLightPos;
 
+		// NOTE: culled against the view the frame's constants were built from, the shader finds its cluster with that view matrix
+		auto& lighting = rs->lighting;
+		lighting.Clear();
+		lighting.AddPointLight(PointLight{ .position = { light1Pos.x, light1Pos.y, light1Pos.z }, .range = 20.0f, .color = { 50.0f * 0.0392f, 50.0f * 0.0392f, 50.0f * 0.0512f } });
+		lighting.AddPointLight(PointLight{ .position = { light2Pos.x, light2Pos.y, light2Pos.z }, .range = 5.0f, .color = { 0.0392f, 0.0392f, 0.0512f } });
+		lighting.AddPointLight(PointLight{ .position = { light3Pos.x, light3Pos.y, light3Pos.z }, .range = 5.0f, .color = { 0.0392f, 0.0392f, 0.0512f } });
+		lighting.AddPointLight(PointLight{ .position = newLightPos, .range = 40.0f, .color = { 200.0f, 200.0f, 200.0f } });
+		lighting.Cull(MakeClusterView(camera));
+
+		// NOTE: immediate mode, everything added here is drawn once this frame and dropped after the upload
+		auto& debugDraw = rs->debugDraw;
+		debugDraw.Grid(Vec3{ 0.0f, 0.0f, 0.0f }, 10.0f, 10, DebugColor::Gray);
+		debugDraw.Axes(Vec3{ 0.0f, 0.0f, 0.0f }, 1.0f, DebugDepth::Overlay);
+		for (const auto& light : lighting.GetLights())
+			debugDraw.Sphere(Vec3{ light.position[0], light.position[1], light.position[2] }, 0.25f, DebugColor::Yellow, 12);
+
 		PbrPixelBufferData bufferData{
-			.lightPositions = {light1Pos, light2Pos, light3Pos, light4Pos},
-			.lightColors = {XMFLOAT4(50.0f * 0.0392f, 50.0f * 0.0392f, 50.0f * 0.0512f, 0), XMFLOAT4(0.0392f, 0.0392f, 0.0512f, 0), XMFLOAT4(0.0392f, 0.0392f, 0.0512f, 0), XMFLOAT4(200.0f, 200.0f, 200.0f, 0)},
 			.albedoFactor = XMFLOAT4(0.2f, 0.05f, 0.75f, 0.0f),
 			.metallic = 0.6f,
 			.roughness = 0.4f,
 			.ao = 1.0f
 		};
-		rs->pbrMat.pixelConstantBuffer.Update(rs->cmdQueue.queue.Get(), bufferData);
+		rs->materials.SetParameters(rs->pbrMat, bufferData);
 
 		// RENDER ---------------------------
-		Assert(rs->defaultRenderTargetView != nullptr);
-		Assert(rs->defaultDepthStencilView != nullptr);
-		DXLayer::SetRenderTarget(queue, &rs->defaultRenderTargetView, rs->defaultDepthStencilView);
-		queue.RSSetViewports(1, &rs->g_Viewport);
-
-		DXLayer::ClearFlag clearFlag = DXLayer::ClearFlag::CLEAR_COLOR | DXLayer::ClearFlag::CLEAR_DEPTH;
-		DXLayer::Clear(rs->cmdQueue, static_cast<u32>(clearFlag), rs->defaultRenderTargetView, rs->defaultDepthStencilView, clearColor, 1.0f, 0);
-
-		ImGui_ImplDX11_NewFrame();
-		ImGui_ImplWin32_NewFrame();
-		ImGui::NewFrame();
+		Assert(rs->backbuffer.IsValid());
 
-		ImGui::Begin("Hello imgui    ");
-		ImGui::Text("Lorem Ipsum     ");
-		ImGui::End();
+		// NOTE: the platform layer owns the ImGui frame, there is none when running headless
+		if (ImGui::GetCurrentContext() != nullptr) {
+			ImGui::Begin("Hello imgui    ");
+			ImGui::Text("Lorem Ipsum     ");
+			ImGui::End();
+		}
 		
 		/*
 		DescribedMesh meshes[3];
@@ -396,22 +485,22 @@ namespace Nickel {
 		// rs->bunny.transform.rotation.y += 0.005;
 		// rs->skybox.transform.rotation.y += 0.0005;
 
-		for (auto& line : rs->lines)
-			if (line.material.program != nullptr)
-				DrawModel(*rs, cmd, line);
+		// NOTE: gather first (this is where per-draw mutation happens), then record in parallel
+		const XMMATRIX sceneViewProjection = camera.GetViewProjectionMatrix();
+		auto& drawItems = frameDrawItems;
+		drawItems.clear();
 
 		for (int y = -2; y <= 2; y++) {
 			for (int x = -2; x <= 2; x++) {
 				for (int i = 0; i < rs->bunny.size(); i++) {
-					const auto t = rs->bunny[i].transform;
 					rs->bunny[i].transform.rotation.y += 0.0004f;
-					DrawModel(*rs, cmd, rs->bunny[i], {x * 3.0f, y * 3.0f, -4.0f});
+					drawItems.push_back(DrawItem{ &rs->bunny[i], rs->bunny[i].transform, {x * 3.0f, y * 3.0f, -4.0f}, &sceneViewProjection });
 				}
 			}
 		}
 
-		DrawModel(*rs, cmd, rs->debugCube);
-		// DrawModel(*rs, cmd, rs->debugBoxTextured);
+		drawItems.push_back(DrawItem{ &rs->debugCube, rs->debugCube.transform, {}, &sceneViewProjection });
+		// drawItems.push_back(DrawItem{ &rs->debugBoxTextured, rs->debugBoxTextured.transform, {}, &sceneViewProjection });
 
 		f32 dtMouseX = input->normalizedMouseX - previousMouseX;
 		f32 dtMouseY = input->normalizedMouseY - previousMouseY;
@@ -419,7 +508,77 @@ namespace Nickel {
 		camera.lookAtPosition.y += dtMouseY * 50.0f;
 		camera.RecalculateMatrices();
 
-		DrawModel(*rs, cmd, background.skyboxMesh);
+		const XMMATRIX skyboxViewProjection = camera.GetViewProjectionMatrix();
+		drawItems.push_back(DrawItem{ &background.skyboxMesh, background.skyboxMesh.transform, {}, &skyboxViewProjection });
+
+		{ // NOTE: every visible helmet asks for the mip its size on screen needs, the streamer keeps the finest
+			const Texture* helmetTextures[] = { &rs->albedoTexture, &rs->normalTexture, &rs->metalRoughnessTexture, &rs->aoTexture, &rs->emissiveTexture };
+			const f32 pixelsPerUnit = rs->viewport.height / (2.0f * std::tan(camera.fov * 0.5f));
+			for (const auto& item : drawItems) {
+				if (item.mesh->material != rs->pbrMat || item.mesh->boundingRadius <= 0.0f)
+					continue;
+
+				const Vec3 toCamera = item.transform.position + item.offset - camera.position;
+				const f32 distance = std::max(std::sqrt(toCamera.x * toCamera.x + toCamera.y * toCamera.y + toCamera.z * toCamera.z), camera.nearClip);
+				const f32 screenPixels = 2.0f * item.mesh->boundingRadius * pixelsPerUnit / distance;
+				for (const auto* texture : helmetTextures)
+					resourceManager->ReportTextureUse(texture->texture, screenPixels);
+			}
+			resourceManager->UpdateStreaming(rs->materials);
+		}
+
+		// NOTE: parameter blocks changed this frame reach the GPU once, before any list references them
+		rs->materials.UploadDirty(gfx);
+		rs->lighting.Upload(gfx);
+		rs->debugDraw.Upload(gfx, sceneViewProjection);
+		rs->debugDraw.Clear();
+		rs->polylines.Upload(gfx); // NOTE: no-op unless lines were added since the last frame
+
+		auto& graph = rs->frameGraph;
+		graph.Reset();
+
+		const u32 width = rs->backbufferWidth;
+		const u32 height = rs->backbufferHeight;
+		const u32 samples = rs->backbufferSampleCount;
+		const auto backbuffer = graph.ImportRenderTarget("Backbuffer", rs->backbuffer, RenderTargetDesc{ .width = width, .height = height, .sampleCount = samples });
+		const auto sceneDepth = graph.CreateDepthTarget("SceneDepth", DepthTargetDesc{ .width = width, .height = height, .sampleCount = samples });
+
+		graph.AddPass("Scene", [&](RenderPassBuilder& pass) {
+			pass.WriteColor(backbuffer, LoadOp::Clear, clearColor);
+			pass.WriteDepth(sceneDepth, LoadOp::Clear, 1.0f);
+		}, [rs, &sceneViewProjection](RenderPassContext& ctx) {
+			RecordParallel(std::span{ rs->commandLists }, static_cast<u32>(frameDrawItems.size()), [&](CommandList& list, u32 begin, u32 end) {
+				// NOTE: every list has to be self-contained, deferred contexts start with cleared state
+				list.SetRenderTarget(ctx.colorTarget, ctx.depthTarget);
+				list.SetViewport(ctx.viewport);
+				rs->lighting.Bind(list);
+				list.SetConstantBuffer(ShaderStage::Pixel, IrradianceConstantSlot, rs->irradianceBuffer);
+				for (u32 i = begin; i < end; i++)
+					DrawModel(*rs, list, frameDrawItems[i]);
+			});
+
+			ctx.gfx.Submit(rs->commandLists);
+
+			// NOTE: recorded into the pass list, which is submitted after the workers' lists
+			DrawPolylines(*rs, ctx.commands, sceneViewProjection);
+		});
+
+		// NOTE: after the scene so depth tested lines see its depth, one draw per depth mode
+		graph.AddPass("DebugDraw", [&](RenderPassBuilder& pass) {
+			pass.WriteColor(backbuffer);
+			pass.WriteDepth(sceneDepth);
+		}, [rs](RenderPassContext& ctx) {
+			rs->debugDraw.Draw(ctx.commands);
+		});
+
+		if (graph.Compile())
+			graph.Execute(gfx);
+
+		if (!firstFrameLogged) {
+			Logger::Info("First frame " + std::to_string(std::chrono::duration<f64, std::milli>(std::chrono::steady_clock::now() - initializeStart).count()) +
+				" ms after Initialize, " + std::to_string(resourceManager->GetPendingLoadCount()) + " loads still pending");
+			firstFrameLogged = true;
+		}
 
 		// DrawBunny(cmd, rs, rs->pipelineStates[0]);
 
@@ -430,193 +589,33 @@ namespace Nickel {
 		// rs->g_WorldMatrix = XMMatrixMultiply(XMMatrixIdentity(), XMMatrixScaling(0.5f, 0.5f, 0.5f));
 		// rs->g_WorldMatrix *= XMMatrixTranslation(radius * cos(XMConvertToRadians(180.0f)), 0.0f, radius * sin(XMConvertToRadians(180.0f)));
 		// DrawSuzanne(cmd, rs, rs->pipelineStates[1]);
-		
-		ImGui::Render();
-		ImGui_ImplDX11_RenderDrawData(ImGui::GetDrawData());
-		rs->swapChain->Present(1, 0);
+
 
 		previousMouseX = input->normalizedMouseX;
 		previousMouseY = input->normalizedMouseY;
 	}
 
-	auto CreateLineIndices(u32 length) -> std::vector<u32> {
-		auto indices = std::vector<u32>(length*6);
-
-		u32 c = 0;
-		u32 index = 0;
-
-		for (u32 j = 0; j < length; j++) {
-			auto i = index;
-			indices[c++] = i + 0;
-			indices[c++] = i + 1;
-			indices[c++] = i + 2;
-			indices[c++] = i + 2;
-			indices[c++] = i + 1;
-			indices[c++] = i + 3;
-			index += 2;
-		}
-
-		return indices;
-	}
-
-	auto DuplicateLineVertices(std::span<Vec3> vertices, bool mirror = false) -> std::vector<Vec3> {
-		Assert(vertices.data() != nullptr && vertices.size() >= 0);
-		auto result = std::vector<Vec3>();
-		for (const auto& v : vertices) {
-			const auto outV = mirror ? Vec3(-v.x, -v.y, -v.z) : v;
-			result.push_back(outV);
-			result.push_back(v);
-		}
-		return result;
-	}
-
-	auto DuplicateLineVertices(std::span<i32> vertices, bool mirror = false) -> std::vector<i32> {
-		Assert(vertices.data() != nullptr && vertices.size() >= 0);
-		auto result = std::vector<i32>();
-		for (const auto& v : vertices) {
-			const auto outV = mirror ? -v : v;
-			result.push_back(outV);
-			result.push_back(v);
-		}
-		return result;
-	}
-
-	auto Clamp(u32 val, u32 min, u32 max) {
-		if (val < min)
-			val = min;
-		else if (val > max)
-			val = max;
-
-		return val;
-	}
-
-	/*
-	auto GenerateLineInDir(Vec3 startPos, Vec3 pointOffset, Vec3 dir, u32 pointCount) -> std::vector<Vec3> {
-		auto result = std::vector<Vec3>(pointCount);
-		const f32 len = std::sqrt(pointOffset.x * pointOffset.x + pointOffset.y * pointOffset.y + pointOffset.z * pointOffset.z);
-		const auto dirNormalized = Vec3{
-			pointOffset.x / len,
-			pointOffset.y / len,
-			pointOffset.z / len,
-		};
-		for (u32 i = 0; i < pointCount; i++) {
-			auto val = Vec3{ startPos.x + (dirNormalized.x*pointOffset.x*i) , startPos.y + (dirNormalized.y*pointOffset.y*i), startPos.z + (dirNormalized.z*pointOffset.z*i) };
-			result[i] = val;
-		}
-
-		return result;
-	}
-	*/
-
-	auto GenerateLine(RendererState* rs, std::vector<Vec3> vertexData, DescribedMesh& describedMesh) -> void {
-		auto device = rs->device.Get();
-
-		//each pair has a mirrored direction 
-		auto dirs = std::vector<i32>(vertexData.size());
-		for (int i = 0; i < vertexData.size(); i++) {
-			dirs[i] = 1;
-		}
-		auto direction = DuplicateLineVertices(std::span{ dirs }, true);
-		auto positions = DuplicateLineVertices(std::span{ vertexData });
-
-		auto prevs = std::vector<Vec3>(vertexData.size());
-		for (u32 i = 0; i < vertexData.size(); i++) {
-			u32 idx = Clamp(i - 1, 0, prevs.size() - 1);
-			prevs[i] = vertexData[idx];
-		}
-		auto previousVertex = DuplicateLineVertices(std::span{ prevs });
-
-		auto nexts = std::vector<Vec3>(vertexData.size());
-		for (u32 i = 0; i < vertexData.size(); i++) {
-			u32 idx = Clamp(i + 1, 0, nexts.size() - 1);
-			nexts[i] = vertexData[idx];
-		}
-		auto nextVertex = DuplicateLineVertices(std::span{ nexts });
-
-		//
-		auto vertexFormatData = std::vector<LineVertexData>();
-		for (int i = 0; i < direction.size(); i++) {
-			auto vertex = LineVertexData{
-				.position = XMFLOAT3(positions[i].x, positions[i].y, positions[i].z),
-				.previous = XMFLOAT3(previousVertex[i].x, previousVertex[i].y, previousVertex[i].z),
-				.next = XMFLOAT3(nextVertex[i].x, nextVertex[i].y, nextVertex[i].z),
-				.direction = XMFLOAT3(direction[i], direction[i], direction[i])
-			};
-			vertexFormatData.push_back(vertex);
-		}
-
-		auto indexData = CreateLineIndices(vertexData.size());
-
-		const u32 indexCount = indexData.size();
-		const u32 vertexCount = vertexFormatData.size() - 6;
-
-		describedMesh.transform.scale = {1.0f, 1.0f, 1.0f};
-		describedMesh.transform.position = { 0.0f, 0.0f, 0.0f };
-		describedMesh.gpuData = GPUMeshData{
-			.vertexCount = vertexCount,
-			.indexCount = indexCount,
-			.topology = D3D11_PRIMITIVE_TOPOLOGY::D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST
-		};
-		describedMesh.gpuData.indexBuffer.Create(device, std::span(indexData));
-		describedMesh.gpuData.vertexBuffer.Create<LineVertexData>(device, std::span(vertexFormatData), false);
-		describedMesh.material = rs->lineMat;
-		//line.mesh = meshData; // TODO: is this useless?
-	}
-
-	auto GenerateLinePoints(Vec3 from, Vec3 to, u32 pointCount) -> std::vector<Vec3> {
-		auto result = std::vector<Vec3>();
-		for (i32 i = 0; i <= pointCount; i++) {
-			result.push_back(Vec3::Lerp(from, to, static_cast<f32>(i) / pointCount));
-		}
-
-		return result;
-	}
-
 	auto LoadContent(RendererState* rs) -> bool {
 		Assert(rs != nullptr);
-		Assert(rs->device != nullptr);
-		Assert(rs->cmdQueue.queue != nullptr);
 
-		auto device = rs->device.Get();
+		const auto& gfx = rs->gfx;
 		auto resourceManager = ResourceManager::GetInstance();
 
-		{ // convert vertex data to be LineVertexData compatible
-			auto defaultDepthStencilState = DXLayer::CreateDepthStencilState(device, true, D3D11_DEPTH_WRITE_MASK_ALL, D3D11_COMPARISON_LESS, false);
-			auto rasterizerDesc = DXLayer::GetDefaultRasterizerDescription();
-			rasterizerDesc.CullMode = D3D11_CULL_MODE::D3D11_CULL_NONE;
-			//rasterizerDesc.FillMode = D3D11_FILL_MODE::D3D11_FILL_WIREFRAME;
-			auto defaultRasterizerState = DXLayer::CreateRasterizerState(device, rasterizerDesc);
-			auto& lineMat = rs->lineMat;
-			lineMat = Material{
-				.program = &rs->lineProgram,
-				.pipelineState = PipelineState{
-					.rasterizerState = defaultRasterizerState,
-					.depthStencilState = defaultDepthStencilState
-				},
-				.vertexConstantBuffer = {
-					.buffer = DXLayer::CreateConstantBuffer(device, sizeof(LineBufferData)),
-					.index = 3
+		{ // NOTE: thick screen space polylines, the ground grid is debug draw lines now
+			// NOTE: LinePermutation::MiterJoin for mitered joins
+			if (rs->polylines.Create(gfx, rs->shaders, rs->pipelineCache, LinePermutation::Default)) {
+				CheckConstantBufferLayout(rs->shaders, "Line", ShaderStage::Vertex, LineConstantSlot, sizeof(LineShaderData));
+
+				// NOTE: a helix around the helmets, points are only stored once so long trajectories stay cheap
+				constexpr u32 helixPoints = 4096;
+				std::vector<Vec3> helix(helixPoints);
+				for (u32 i = 0; i < helixPoints; i++) {
+					const f32 t = static_cast<f32>(i) / static_cast<f32>(helixPoints - 1);
+					const f32 angle = t * 16.0f * XM_PI;
+					helix[i] = Vec3{ 8.0f * std::cos(angle), -6.0f + 12.0f * t, -4.0f + 8.0f * std::sin(angle) };
 				}
-			};
-			LineBufferData bufferData{
-				.thickness = 0.04f,
-				.miter = 0
-			};
-			lineMat.vertexConstantBuffer.Update(rs->cmdQueue.queue.Get(), bufferData);
-
-			const auto pointOffset = Vec3{ 0.5f, 0.0f, 0.5f };
-			// auto line1 = GenerateLineInDir(Vec3{ 0.0, 0.0, 0.0 }, pointOffset, Vec3{ 0.0, 0.0, 1.0 }, 10);
 
-			u32 lineIdx = 0;
-			const u32 linePointsCount = 100;
-			for (i32 x = -5; x <= 5; x++, lineIdx++) {
-				const auto xOffset = static_cast<f32>(x) * 2.0f;
-				GenerateLine(rs, GenerateLinePoints(Vec3{ xOffset, 0.0, -10.0 }, Vec3{ xOffset, 0.0, 10.0 }, linePointsCount), rs->lines[lineIdx]);
-			}
-				
-			for (i32 y = -5; y <= 5; y++, lineIdx++) {
-				const auto yOffset = static_cast<f32>(y) * 2.0f;
-				GenerateLine(rs, GenerateLinePoints(Vec3{ -10.0, 0.0, yOffset }, Vec3{ 10.0, 0.0, yOffset }, linePointsCount), rs->lines[lineIdx]);
+				rs->polylines.Add(helix, Vec4{ 0.9f, 0.9f, 0.9f, 1.0f }, 0.04f);
 			}
 		}
 
@@ -626,47 +625,41 @@ namespace Nickel {
 			//MeshData meshData;
 			// LoadBunnyMesh(meshData);
 			//const auto& meshData = *resourceManager->LoadModel("Data/Models/backpack/backpack.obj");
-			const auto& meshData = *resourceManager->LoadModel("Data/Models/DamagedHelmet/DamagedHelmet.gltf");
 			//const auto& meshData = *resourceManager->LoadModel("Data/Models/HornetHelmet/scene.gltf");
-			auto& bunny = rs->bunny;
-			bunny = std::vector<DescribedMesh>(meshData.size());
-			for (int i = 0; i < meshData.size(); i++) {
-				const auto& submesh = meshData[i];
-
-				const u64 vertexCount = submesh.v.size();
-				const u64 indexCount = submesh.i.size();
-
-				auto vertexFormatData = std::vector<VertexPosUV>(vertexCount);
-				{
-					for (int i = 0; i < vertexCount; i++) {
-						const auto& v = submesh.v[i];
-						vertexFormatData[i] = VertexPosUV{
-							.Position = XMFLOAT3(v.position.x, v.position.y, v.position.z),
-							.Normal = XMFLOAT3(v.normal.x, v.normal.y, v.normal.z),
-							.UV = XMFLOAT2(v.uv[0].x, v.uv[0].y)
-						};
-					}
+			// NOTE: nothing is drawn until the submeshes are decoded, the meshes are created on the render thread
+			resourceManager->LoadModelAsync("Data/Models/DamagedHelmet/DamagedHelmet.gltf", [rs](const ImportedModel& model) {
+				const auto& gfx = rs->gfx;
+				const auto uploadStart = std::chrono::steady_clock::now();
+				auto& bunny = rs->bunny;
+				// NOTE: runs again when the file is hot reloaded, the previous meshes go first
+				for (const auto& mesh : bunny) {
+					gfx.DestroyBuffer(mesh.gpuData.vertexBuffer.buffer);
+					gfx.DestroyBuffer(mesh.gpuData.indexBuffer.buffer);
 				}
+				bunny = std::vector<DescribedMesh>(model.submeshes.size());
+				for (u32 i = 0; i < model.submeshes.size(); i++) {
+					const auto& submesh = model.submeshes[i];
+					bunny[i] = DescribedMesh{
+						.transform = {
+							.position = { 1.0f, 1.0f, 1.0f },
+							.scale = {1.1f, 1.1f, 1.1f},
+							.rotation = {XMConvertToRadians(-60.0f), 0.0f, 0.0f}
+						},
+						.gpuData = GPUMeshData{
+							.vertexCount = submesh.vertices.size(),
+							.indexCount = submesh.indices.size(),
+							.topology = PrimitiveTopology::TriangleList
+						},
+						.material = rs->pbrMat,
+						.boundingRadius = submesh.boundingRadius * 1.1f
+					};
 
-				bunny[i] = DescribedMesh{
-					.transform = {
-						.position = { 1.0f, 1.0f, 1.0f },
-						.scale = {1.1f, 1.1f, 1.1f},
-						.rotation = {XMConvertToRadians(-60.0f), 0.0f, 0.0f}
-					},
-					.mesh = submesh, // TODO: is this useless?
-					.gpuData = GPUMeshData{
-						.vertexCount = vertexCount,
-						.indexCount = indexCount,
-						.topology = D3D11_PRIMITIVE_TOPOLOGY::D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST
-					},
-					.material = rs->pbrMat
-				};
+					bunny[i].gpuData.indexBuffer.Create(gfx, submesh.indices);
+					bunny[i].gpuData.vertexBuffer.Create(gfx, submesh.vertices, false);
+				}
 
-				auto x = submesh.i;
-				bunny[i].gpuData.indexBuffer.Create(device, std::span(x));
-				bunny[i].gpuData.vertexBuffer.Create<VertexPosUV>(device, std::span(vertexFormatData), false);
-			}
+				LogModelImport("DamagedHelmet", model.stats, uploadStart);
+			});
 		}
 		
 		{ // Suzanne
@@ -682,8 +675,8 @@ namespace Nickel {
 				//.vertexCount = vertexCount,
 				//.indexCount = indexCount
 			//};
-			//gpuMeshData.indexBuffer.Create(device, std::span(meshData.i));
-			//gpuMeshData.vertexBuffer.Create<VertexPosColor>(device, std::span(vertexFormatData), false);
+			//gpuMeshData.indexBuffer.Create(gfx, std::span(meshData.i));
+			//gpuMeshData.vertexBuffer.Create<VertexPosColor>(gfx, std::span(vertexFormatData), false);
 		}
 
 		{ // Test Cube
@@ -718,55 +711,41 @@ namespace Nickel {
 				.vertexCount = vertexCount,
 				.indexCount = indexCount
 			};
-			cube.gpuData.indexBuffer.Create(device, std::span(indices));
-			cube.gpuData.vertexBuffer.Create<VertexPosColor>(device, std::span(vertexData), false);
+			cube.gpuData.indexBuffer.Create(gfx, std::span(indices));
+			cube.gpuData.vertexBuffer.Create<VertexPosColor>(gfx, std::span(vertexData), false);
 			cube.material = rs->simpleMat;
 		}
 
 		{
-			const auto& meshData = *resourceManager->LoadModel("Data/Models/BoxTextured/BoxTextured.gltf");
-			const auto& submesh = meshData[0];
-
-			const u64 vertexCount = submesh.v.size();
-			const u64 indexCount = submesh.i.size();
-
-			auto vertexFormatData = std::vector<VertexPosUV>(vertexCount);
-			{
-				for (int i = 0; i < vertexCount; i++) {
-					const auto& v = submesh.v[i];
-					vertexFormatData[i] = VertexPosUV{
-						.Position = XMFLOAT3(v.position.x, v.position.y, v.position.z),
-						.Normal = XMFLOAT3(v.normal.x, v.normal.y, v.normal.z),
-						.UV = XMFLOAT2(v.uv[0].x, v.uv[0].y)
-					};
+			resourceManager->LoadModelAsync("Data/Models/BoxTextured/BoxTextured.gltf", [rs](const ImportedModel& model) {
+				const auto& gfx = rs->gfx;
+				const auto uploadStart = std::chrono::steady_clock::now();
+				const auto& submesh = model.submeshes[0];
+
+				auto& box = rs->debugBoxTextured;
+				if (box.gpuData.vertexBuffer.buffer.IsValid()) {
+					gfx.DestroyBuffer(box.gpuData.vertexBuffer.buffer);
+					gfx.DestroyBuffer(box.gpuData.indexBuffer.buffer);
 				}
-			}
-
-			auto& box = rs->debugBoxTextured;
-			box = DescribedMesh{
-				.transform = {
-					.position = { 1.0f, 1.0f, 1.0f },
-					.scale = {4.1f, 4.1f, 4.1f}
-				},
-				.mesh = submesh, // TODO: is this useless?
-				.gpuData = GPUMeshData{
-					.vertexCount = vertexCount,
-					.indexCount = indexCount,
-					.topology = D3D11_PRIMITIVE_TOPOLOGY::D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST
-				},
-				.material = rs->textureMat
-			};
+				box = DescribedMesh{
+					.transform = {
+						.position = { 1.0f, 1.0f, 1.0f },
+						.scale = {4.1f, 4.1f, 4.1f}
+					},
+					.gpuData = GPUMeshData{
+						.vertexCount = submesh.vertices.size(),
+						.indexCount = submesh.indices.size(),
+						.topology = PrimitiveTopology::TriangleList
+					},
+					.material = rs->textureMat
+				};
 
-			auto x = submesh.i;
-			box.gpuData.indexBuffer.Create(device, std::span(x));
-			box.gpuData.vertexBuffer.Create<VertexPosUV>(device, std::span(vertexFormatData), false);
+				box.gpuData.indexBuffer.Create(gfx, submesh.indices);
+				box.gpuData.vertexBuffer.Create(gfx, submesh.vertices, false);
+				LogModelImport("BoxTextured", model.stats, uploadStart);
+			});
 		}
 
 		return true;
 	}
-
-	auto SetDefaultPass(const DXLayer::CmdQueue& cmd, ID3D11RenderTargetView* const* renderTargetView, ID3D11DepthStencilView& depthStencilView) -> void {
-		Assert(cmd.queue != nullptr);
-		cmd.queue->OMSetRenderTargets(1, renderTargetView, &depthStencilView);
-	}
 }
\ No newline at end of file
@@ -0,0 +1,695 @@
+#if !defined(_WIN32)
+#include "platform.h"
+#include "AssetArchive.h"
+#include "AssetPacker.h"
+#include "AsyncFileIO.h"
+#include "game.h"
+#include "Renderer/Null/NullCore.h"
+#include "Renderer/Software/SoftwareCore.h"
+#include "Renderer/ClusteredLighting.h"
+#include "Renderer/EquirectConversion.h"
+#include "Renderer/ImageDecoder.h"
+#include "Renderer/TextureCompression.h"
+#include "Renderer/TextureCooker.h"
+#include "Renderer/TextureStreaming.h"
+#include "JobSystem.h"
+#include "ResourceManager.h"
+#include "Camera.h"
+#include "stb/stb_image.h"
+
+#include <algorithm>
+#include <bit>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <random>
+#include <string>
+#include <vector>
+#include <fcntl.h>
+#include <unistd.h>
+
+// NOTE: CPU light culling alone, random point and spot lights in front of the game's default camera
+static auto RunClusterBenchmark() -> void {
+	using namespace Nickel::Renderer;
+	constexpr u32 Iterations = 50;
+
+	const Nickel::Camera camera(45.0f, 1.5f, 0.1f, 100.0f);
+	const auto view = MakeClusterView(camera);
+	printf("cluster culling: %u workers, grid %ux%ux%u\n", Nickel::GetWorkerCount(), ClusterGridDesc{}.tilesX, ClusterGridDesc{}.tilesY, ClusterGridDesc{}.slices);
+
+	for (u32 lightCount = 256; lightCount <= 16384; lightCount *= 2) {
+		std::mt19937 random(lightCount);
+		std::uniform_real_distribution<f32> x(-25.0f, 25.0f), y(-2.0f, 12.0f), z(-5.0f, 60.0f), range(1.0f, 4.0f), unit(-1.0f, 1.0f);
+
+		ClusteredLighting lighting;
+		for (u32 i = 0; i < lightCount; i++) {
+			const Nickel::Vec3 position = { x(random), y(random), z(random) };
+			if (i % 4 != 3) {
+				lighting.AddPointLight(PointLight{ .position = position, .range = range(random), .color = { 1.0f, 1.0f, 1.0f } });
+				continue;
+			}
+
+			Nickel::Vec3 direction = { unit(random), -1.0f, unit(random) };
+			direction = direction * (1.0f / std::sqrt(direction.x * direction.x + direction.y * direction.y + direction.z * direction.z));
+			lighting.AddSpotLight(SpotLight{ .position = position, .range = range(random) * 2.0f, .color = { 1.0f, 1.0f, 1.0f }, .direction = direction, .innerAngle = 0.3f, .outerAngle = 0.6f });
+		}
+
+		lighting.Cull(view); // NOTE: warm up, the first call sizes the scratch lists
+
+		f64 total = 0.0, best = 1e9;
+		for (u32 i = 0; i < Iterations; i++) {
+			lighting.Cull(view);
+			total += lighting.GetStats().cullMilliseconds;
+			best = std::min(best, lighting.GetStats().cullMilliseconds);
+		}
+
+		const auto& stats = lighting.GetStats();
+		printf("%6u lights: %.3f ms avg, %.3f ms min, %u indices, %u/%u clusters lit, at most %u lights per cluster\n",
+			lightCount, total / Iterations, best, stats.indexCount, stats.occupiedClusters, stats.clusterCount, stats.maxLightsPerCluster);
+	}
+}
+
+// NOTE: an 8K x 4K procedural panorama into 2048^2 faces with both filters, then the box filtered mips on top
+static auto RunEquirectBenchmark() -> void {
+	using namespace Nickel::Renderer;
+	constexpr u32 Iterations = 5;
+
+	EquirectImage panorama{ .width = 8192, .height = 4096 };
+	panorama.texels.resize(static_cast<u64>(panorama.width) * panorama.height * 4);
+	for (u32 y = 0; y < panorama.height; y++) {
+		for (u32 x = 0; x < panorama.width; x++) {
+			f32* texel = panorama.texels.data() + (static_cast<u64>(y) * panorama.width + x) * 4;
+			texel[0] = static_cast<f32>(x) / panorama.width;
+			texel[1] = static_cast<f32>(y) / panorama.height;
+			texel[2] = static_cast<f32>((x / 64 + y / 64) % 2) * 8.0f;
+			texel[3] = 1.0f;
+		}
+	}
+
+	printf("equirect conversion: %ux%u panorama, %u workers\n", panorama.width, panorama.height, Nickel::GetWorkerCount());
+
+	for (const auto filter : { EquirectFilter::Bilinear, EquirectFilter::Bicubic }) {
+		const EquirectConversionDesc desc = { .filter = filter };
+		CubemapImage image = ConvertEquirectToCubemap(panorama, desc); // NOTE: warm up, faults in the face allocations once
+
+		EquirectConversionStats stats{};
+		f64 total = 0.0, best = 1e9;
+		for (u32 i = 0; i < Iterations; i++) {
+			image = ConvertEquirectToCubemap(panorama, desc, &stats);
+			total += stats.milliseconds;
+			best = std::min(best, stats.milliseconds);
+		}
+
+		const auto mipStart = std::chrono::steady_clock::now();
+		const auto mips = BuildMipChain(image);
+		const auto mipMilliseconds = std::chrono::duration<f64, std::milli>(std::chrono::steady_clock::now() - mipStart).count();
+
+		printf("%s: %u^2 faces, %.3f ms avg, %.3f ms min, %.1f Mtexels/s, %zu mips in %.3f ms\n", filter == EquirectFilter::Bicubic ? "bicubic " : "bilinear",
+			image.size, total / Iterations, best, static_cast<f64>(stats.texelCount) / (best * 1000.0), mips.size(), mipMilliseconds);
+	}
+}
+
+// NOTE: cooks a synthetic 2K texture for every role, no cache involved. Quality is the PSNR of the decoded top mip
+// against the source over the channels the role keeps
+static auto RunTextureCookBenchmark() -> void {
+	using namespace Nickel::Renderer;
+	constexpr u32 Size = 2048;
+
+	std::mt19937 random(7);
+	std::uniform_int_distribution<i32> noise(-6, 6);
+	std::vector<u8> color(static_cast<u64>(Size) * Size * 4), normal(color.size());
+	for (u32 y = 0; y < Size; y++) {
+		for (u32 x = 0; x < Size; x++) {
+			u8* texel = color.data() + (static_cast<u64>(y) * Size + x) * 4;
+			const i32 checker = ((x / 96 + y / 96) % 2) * 60;
+			texel[0] = static_cast<u8>(std::clamp(static_cast<i32>(x * 180 / Size) + checker + noise(random), 0, 255));
+			texel[1] = static_cast<u8>(std::clamp(static_cast<i32>(y * 180 / Size) + checker + noise(random), 0, 255));
+			texel[2] = static_cast<u8>(std::clamp(120 + noise(random) * 4, 0, 255));
+			texel[3] = 255;
+
+			const f32 nx = 0.5f * std::sin(x * 0.05f), ny = 0.5f * std::cos(y * 0.03f);
+			const f32 scale = 1.0f / std::sqrt(nx * nx + ny * ny + 1.0f);
+			u8* n = normal.data() + (static_cast<u64>(y) * Size + x) * 4;
+			n[0] = static_cast<u8>(std::lround((nx * scale * 0.5f + 0.5f) * 255.0f));
+			n[1] = static_cast<u8>(std::lround((ny * scale * 0.5f + 0.5f) * 255.0f));
+			n[2] = static_cast<u8>(std::lround((scale * 0.5f + 0.5f) * 255.0f));
+			n[3] = 255;
+		}
+	}
+
+	printf("texture cooking: %u^2 source, %u workers\n", Size, Nickel::GetWorkerCount());
+	for (const auto role : { TextureRole::Albedo, TextureRole::Normal, TextureRole::MetalRoughness, TextureRole::Occlusion, TextureRole::Emissive }) {
+		const auto& source = role == TextureRole::Normal ? normal : color;
+		const auto start = std::chrono::steady_clock::now();
+		TextureCooker::CookedTexture cooked;
+		TextureCooker::Cook(source.data(), Size, Size, role, cooked);
+		const auto milliseconds = std::chrono::duration<f64, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+		std::vector<u8> decoded(source.size());
+		DecompressBlocks(cooked.desc.format, cooked.mips[0].data(), Size, Size, decoded.data());
+		const u32 channels = role == TextureRole::Normal ? 2 : cooked.desc.format == TextureFormat::BC1_UNORM ? 3 : 4;
+		f64 error = 0.0;
+		for (u64 i = 0; i < source.size(); i += 4) {
+			for (u32 c = 0; c < channels; c++)
+				error += (source[i + c] - decoded[i + c]) * (source[i + c] - decoded[i + c]);
+		}
+		const f64 meanError = error / (static_cast<f64>(source.size()) / 4 * channels);
+
+		u64 cookedBytes = 0;
+		for (const auto& mip : cooked.mips)
+			cookedBytes += mip.size();
+		const u64 uncompressedBytes = static_cast<u64>(Size) * Size * 4 * 4 / 3;
+		printf("%-15s %u mips in %.3f ms, %.2f dB, %.1f MB instead of %.1f MB (%.1fx)\n", TextureCooker::GetRoleName(role), cooked.desc.mipLevels, milliseconds,
+			10.0 * std::log10(255.0 * 255.0 / std::max(meanError, 1e-9)), cookedBytes / 1048576.0, uncompressedBytes / 1048576.0, static_cast<f64>(uncompressedBytes) / cookedBytes);
+	}
+}
+
+// NOTE: the startup images, the six HDR radiance faces as RGBA32F and the five helmet textures as RGBA8, decoded the
+// way the loaders used to (stb_image one file at a time, converting to RGBA itself), one file at a time through the
+// image decoder (only the conversions are parallel) and as two batches with every file at once
+static auto RunImageDecodeBenchmark() -> void {
+	using namespace Nickel::Renderer;
+	constexpr u32 Repeats = 3;
+
+	std::vector<std::string> faces, textures;
+	for (const char* face : { "posx", "negx", "posy", "negy", "posz", "negz" })
+		faces.push_back(std::string("Data/Textures/skybox/radianceCubemap/output_pmrem_") + face + ".hdr");
+	for (const char* texture : { "albedo", "normal", "AO", "metalRoughness", "emissive" })
+		textures.push_back(std::string("Data/Models/DamagedHelmet/Default_") + texture + ".jpg");
+
+	const auto milliseconds = [](auto start) { return std::chrono::duration<f64, std::milli>(std::chrono::steady_clock::now() - start).count(); };
+
+	f64 serialStb = 1e30, serialDecoder = 1e30, batched = 1e30;
+	u64 sourceBytes = 0, decodedBytes = 0;
+	for (u32 repeat = 0; repeat < Repeats; repeat++) {
+		auto start = std::chrono::steady_clock::now();
+		for (const auto& path : faces) {
+			i32 width, height, channels;
+			f32* texels = stbi_loadf(path.c_str(), &width, &height, &channels, STBI_rgb_alpha);
+			if (texels == nullptr) {
+				printf("can't load %s, run from the directory with Data\n", path.c_str());
+				return;
+			}
+			stbi_image_free(texels);
+		}
+		for (const auto& path : textures) {
+			i32 width, height, channels;
+			stbi_image_free(stbi_load(path.c_str(), &width, &height, &channels, STBI_rgb_alpha));
+		}
+		serialStb = std::min(serialStb, milliseconds(start));
+
+		start = std::chrono::steady_clock::now();
+		for (const auto& path : faces) {
+			DecodedImage image;
+			DecodeImage(path, TextureFormat::RGBA32_FLOAT, image);
+		}
+		for (const auto& path : textures) {
+			DecodedImage image;
+			DecodeImage(path, TextureFormat::RGBA8_UNORM, image);
+		}
+		serialDecoder = std::min(serialDecoder, milliseconds(start));
+
+		start = std::chrono::steady_clock::now();
+		std::vector<DecodedImage> faceImages(faces.size()), textureImages(textures.size());
+		ImageDecodeStats faceStats{}, textureStats{};
+		DecodeImages(faces, TextureFormat::RGBA32_FLOAT, faceImages, &faceStats);
+		DecodeImages(textures, TextureFormat::RGBA8_UNORM, textureImages, &textureStats);
+		batched = std::min(batched, milliseconds(start));
+		sourceBytes = faceStats.sourceBytes + textureStats.sourceBytes;
+		decodedBytes = faceStats.decodedBytes + textureStats.decodedBytes;
+	}
+
+	const auto pool = GetImageBufferPoolStats();
+	printf("image decoding: %zu files, %.1f MB to %.1f MB, %u workers, best of %u\n", faces.size() + textures.size(), sourceBytes / 1048576.0, decodedBytes / 1048576.0,
+		Nickel::GetWorkerCount(), Repeats);
+	printf("stb_image one at a time %.3f ms, decoder one at a time %.3f ms (%.2fx), all at once %.3f ms (%.2fx)\n", serialStb, serialDecoder, serialStb / serialDecoder,
+		batched, serialStb / batched);
+	printf("buffer pool: %llu allocated, %llu reused\n", static_cast<unsigned long long>(pool.allocations), static_cast<unsigned long long>(pool.reuses));
+	TrimImageBufferPool();
+}
+
+// NOTE: every glTF model in Data imported through the native loader and through assimp, best of a few runs each. The
+// vertex counts can differ, assimp joins identical vertices and the native loader keeps the file's
+static auto RunGltfImportBenchmark() -> void {
+	using namespace Nickel;
+	constexpr u32 Repeats = 5;
+	const char* paths[] = {
+		"Data/Models/DamagedHelmet/DamagedHelmet.gltf",
+		"Data/Models/BoxTextured/BoxTextured.gltf",
+		"Data/Models/HornetHelmet/scene.gltf"
+	};
+
+	const auto resources = Renderer::ResourceManager::GetInstance();
+	printf("glTF import, best of %u\n", Repeats);
+	for (const char* path : paths) {
+		ModelImportStats best[2] = {};
+		u64 vertexCounts[2] = {}, indexCounts[2] = {};
+		for (u32 i = 0; i < 2; i++) {
+			const auto importer = i == 0 ? ModelImporter::Native : ModelImporter::Assimp;
+			f64 bestMilliseconds = 1e30;
+			for (u32 repeat = 0; repeat < Repeats; repeat++) {
+				ImportedModel model;
+				if (!resources->ImportModel(path, model, importer)) {
+					printf("can't import %s, run from the directory with Data\n", path);
+					return;
+				}
+
+				const f64 milliseconds = model.stats.parseMilliseconds + model.stats.convertMilliseconds;
+				if (milliseconds < bestMilliseconds) {
+					bestMilliseconds = milliseconds;
+					best[i] = model.stats;
+				}
+
+				vertexCounts[i] = indexCounts[i] = 0;
+				for (const auto& submesh : model.submeshes) {
+					vertexCounts[i] += submesh.vertices.size();
+					indexCounts[i] += submesh.indices.size();
+				}
+			}
+		}
+
+		const f64 native = best[0].parseMilliseconds + best[0].convertMilliseconds;
+		const f64 assimp = best[1].parseMilliseconds + best[1].convertMilliseconds;
+		printf("%s\n", path);
+		for (u32 i = 0; i < 2; i++) {
+			printf("  %-7s %8.3f ms (parse %8.3f, convert %7.3f), %7llu vertices, %7llu indices, %6llu KB peak\n", i == 0 ? "native" : "assimp",
+				best[i].parseMilliseconds + best[i].convertMilliseconds, best[i].parseMilliseconds, best[i].convertMilliseconds,
+				static_cast<unsigned long long>(vertexCounts[i]), static_cast<unsigned long long>(indexCounts[i]), static_cast<unsigned long long>(best[i].peakBytes >> 10));
+		}
+		printf("  native is %.1fx faster\n", assimp / native);
+	}
+}
+
+// NOTE: packs the directory, then reads every asset back through the mounted archive and as a loose file and checks
+// they're equal. The times are with a warm file cache, what the archive saves on a cold start is the opens and seeks
+static auto RunAssetPack(const char* sourceDir, const char* archivePath) -> bool {
+	using namespace Nickel;
+	AssetPacker::PackStats stats{};
+	if (!AssetPacker::Pack(sourceDir, archivePath, &stats))
+		return false;
+
+	printf("packed %u files, %.1f MB into %.1f MB (%u compressed) in %.1f ms\n", stats.files, stats.sourceBytes / 1048576.0, stats.archiveBytes / 1048576.0,
+		stats.compressed, stats.milliseconds);
+
+	AssetArchive archive;
+	if (!archive.Open(archivePath))
+		return false;
+
+	std::vector<std::string> paths;
+	for (const auto& entry : archive.GetEntries())
+		paths.push_back((std::filesystem::path(sourceDir) / archive.GetPath(entry)).generic_string());
+	archive.Close();
+	std::sort(paths.begin(), paths.end());
+
+	const auto milliseconds = [](auto start) { return std::chrono::duration<f64, std::milli>(std::chrono::steady_clock::now() - start).count(); };
+	auto start = std::chrono::steady_clock::now();
+	std::vector<AssetData> loose(paths.size());
+	for (u32 i = 0; i < paths.size(); i++) {
+		if (!ReadAsset(paths[i], loose[i]))
+			return false;
+	}
+	const f64 looseMilliseconds = milliseconds(start);
+
+	start = std::chrono::steady_clock::now();
+	if (!MountAssetArchive(archivePath, sourceDir))
+		return false;
+
+	u32 mismatches = 0;
+	for (u32 i = 0; i < paths.size(); i++) {
+		AssetData packed;
+		if (!ReadAsset(paths[i], packed) || packed.file.IsOpen() || !std::ranges::equal(packed.bytes, loose[i].bytes))
+			mismatches++;
+	}
+	const f64 packedMilliseconds = milliseconds(start);
+	UnmountAssetArchives();
+
+	printf("read back: %zu loose files %.2f ms, from the archive %.2f ms (mount included), %u mismatches\n", paths.size(), looseMilliseconds, packedMilliseconds, mismatches);
+	return mismatches == 0;
+}
+
+// NOTE: every file under 'dir' read in blocks, blocking one read at a time and through the async reader at growing
+// queue depths. The files are dropped from the page cache before each run so the numbers are the disk's, a run that
+// can't drop them (a file system ignoring the hint) measures memory copies instead
+static auto RunIoBenchmark(const char* dir, u32 maxQueueDepth) -> bool {
+	using namespace Nickel;
+	constexpr u64 BlockSize = 256 << 10;
+
+	struct Block {
+		u32 file;
+		u64 offset;
+		u64 size;
+		u64 destination;
+	};
+
+	std::vector<std::string> paths;
+	std::error_code error;
+	for (auto it = std::filesystem::recursive_directory_iterator(dir, error); !error && it != std::filesystem::recursive_directory_iterator(); it.increment(error)) {
+		if (it->is_regular_file(error) && it->file_size(error) > 0)
+			paths.push_back(it->path().string());
+	}
+
+	std::vector<Block> blocks;
+	u64 totalBytes = 0;
+	for (u32 i = 0; i < paths.size(); i++) {
+		const u64 size = std::filesystem::file_size(paths[i], error);
+		for (u64 offset = 0; offset < size; offset += BlockSize) {
+			blocks.push_back(Block{ .file = i, .offset = offset, .size = std::min(BlockSize, size - offset), .destination = totalBytes });
+			totalBytes += blocks.back().size;
+		}
+	}
+
+	if (blocks.empty()) {
+		printf("io bench: no files under %s\n", dir);
+		return false;
+	}
+
+	const auto dropCache = [&]() {
+		for (const auto& path : paths) {
+			const int file = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+			if (file >= 0) {
+				posix_fadvise(file, 0, 0, POSIX_FADV_DONTNEED);
+				close(file);
+			}
+		}
+	};
+
+	// NOTE: written before the runs, page faults on the destination aren't part of the numbers
+	std::vector<u8> reference(totalBytes), destination(totalBytes);
+	printf("io bench: %zu files, %.1f MB in %zu reads of up to %llu KB\n", paths.size(), totalBytes / 1048576.0, blocks.size(), static_cast<unsigned long long>(BlockSize >> 10));
+
+	bool matched = true;
+	const auto run = [&](IoBackend backend, u32 queueDepth) {
+		dropCache();
+		auto& target = backend == IoBackend::Blocking ? reference : destination;
+		std::fill(target.begin(), target.end(), u8(0));
+
+		const auto start = std::chrono::steady_clock::now();
+		AsyncFileReader reader;
+		reader.Init(queueDepth, backend);
+		std::vector<AsyncFile> files(paths.size());
+		for (u32 i = 0; i < paths.size(); i++)
+			reader.Open(paths[i].c_str(), files[i]);
+
+		for (u32 i = 0; i < blocks.size(); i++) {
+			const auto& block = blocks[i];
+			if (files[block.file].IsOpen())
+				reader.QueueRead(files[block.file], block.offset, std::span{ target.data() + block.destination, block.size }, i);
+		}
+
+		std::vector<IoCompletion> completions;
+		completions.reserve(blocks.size());
+		while (reader.GetPendingCount() > 0)
+			reader.Poll(completions, true);
+		const f64 milliseconds = std::chrono::duration<f64, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+		std::vector<f64> latencies;
+		u32 failed = 0;
+		for (const auto& completion : completions) {
+			latencies.push_back(completion.milliseconds);
+			failed += completion.failed ? 1 : 0;
+		}
+		std::sort(latencies.begin(), latencies.end());
+
+		const auto percentile = [&](f64 p) { return latencies.empty() ? 0.0 : latencies[std::min(static_cast<size_t>(p * latencies.size()), latencies.size() - 1)]; };
+		const auto& stats = reader.GetStats();
+		const bool same = backend == IoBackend::Blocking || reference == destination;
+		matched = matched && same && failed == 0 && completions.size() == blocks.size();
+		printf("%-16s depth %3u: %8.1f MB/s, %8.2f ms, latency avg %.3f p50 %.3f p99 %.3f ms, %llu batches, %u failed%s\n", reader.GetBackendName(), queueDepth,
+			totalBytes / 1048576.0 / (milliseconds / 1000.0), milliseconds, stats.reads > 0 ? stats.milliseconds / stats.reads : 0.0, percentile(0.5), percentile(0.99),
+			static_cast<unsigned long long>(stats.batches), failed, same ? "" : ", data differs from the blocking reads");
+	};
+
+	run(IoBackend::Blocking, 1);
+	for (u32 queueDepth = 1; queueDepth <= maxQueueDepth; queueDepth *= 4)
+		run(DefaultIoBackend, queueDepth);
+
+	return matched;
+}
+
+// NOTE: the same four workloads on 1 thread and doubling up to every hardware thread. A compute bound parallel for,
+// a flood of empty jobs for the scheduling overhead, stages of small jobs that each wait for the stage before and
+// jobs that run and wait for their own jobs, one of them more than a thread's job ring holds
+static auto RunJobBenchmark() -> void {
+	using Nickel::JobSystem;
+	using Nickel::JobCounter;
+	constexpr u32 ItemCount = 1 << 20;
+	constexpr u32 EmptyJobCount = 100000;
+	constexpr u32 StageCount = 64;
+	constexpr u32 JobsPerStage = 256;
+	constexpr u32 OuterJobCount = 64;
+	constexpr u32 InnerJobCount = 100;
+	constexpr u32 FloodJobCount = 3000;
+
+	std::vector<f32> items(ItemCount);
+	std::vector<u32> threadCounts;
+	for (u32 count = 1; count < Nickel::GetWorkerCount(); count *= 2)
+		threadCounts.push_back(count);
+	threadCounts.push_back(Nickel::GetWorkerCount());
+
+	const auto milliseconds = [](auto start) { return std::chrono::duration<f64, std::milli>(std::chrono::steady_clock::now() - start).count(); };
+
+	f64 baseline[4] = {};
+	for (const u32 threadCount : threadCounts) {
+		JobSystem jobs(threadCount);
+
+		for (u32 i = 0; i < ItemCount; i++)
+			items[i] = static_cast<f32>(i);
+
+		auto start = std::chrono::steady_clock::now();
+		jobs.ParallelFor(std::span{ items }, 1024, [](f32& item) {
+			for (u32 i = 0; i < 32; i++)
+				item = std::sqrt(item * 1.0001f + 1.0f);
+		});
+		const f64 parallelFor = milliseconds(start);
+
+		std::atomic<u32> ran = 0;
+		start = std::chrono::steady_clock::now();
+		{
+			JobCounter counter;
+			for (u32 i = 0; i < EmptyJobCount; i++)
+				jobs.Run([&ran]() { ran.fetch_add(1, std::memory_order_relaxed); }, &counter);
+			jobs.Wait(counter);
+		}
+		const f64 emptyJobs = milliseconds(start);
+
+		start = std::chrono::steady_clock::now();
+		{
+			JobCounter stages[StageCount];
+			for (u32 stage = 0; stage < StageCount; stage++) {
+				for (u32 i = 0; i < JobsPerStage; i++)
+					jobs.Run([&ran]() { ran.fetch_add(1, std::memory_order_relaxed); }, &stages[stage], stage > 0 ? &stages[stage - 1] : nullptr);
+			}
+			jobs.Wait(stages[StageCount - 1]);
+		}
+		const f64 dependentJobs = milliseconds(start);
+
+		ran = 0;
+		start = std::chrono::steady_clock::now();
+		{
+			JobCounter outer;
+			const auto spawn = [&jobs, &ran](u32 count) {
+				JobCounter inner;
+				for (u32 i = 0; i < count; i++)
+					jobs.Run([&ran]() { ran.fetch_add(1, std::memory_order_relaxed); }, &inner);
+				jobs.Wait(inner);
+			};
+			for (u32 i = 0; i < OuterJobCount; i++)
+				jobs.Run([&spawn]() { spawn(InnerJobCount); }, &outer);
+			jobs.Run([&spawn]() { spawn(FloodJobCount); }, &outer);
+			jobs.Wait(outer);
+		}
+		const f64 nestedJobs = milliseconds(start);
+		if (ran.load() != OuterJobCount * InnerJobCount + FloodJobCount)
+			printf("nested jobs ran %u of %u\n", ran.load(), OuterJobCount * InnerJobCount + FloodJobCount);
+
+		if (threadCount == 1) {
+			baseline[0] = parallelFor;
+			baseline[1] = emptyJobs;
+			baseline[2] = dependentJobs;
+			baseline[3] = nestedJobs;
+		}
+
+		const auto stats = jobs.GetStats();
+		printf("%2u threads: parallel for %.3f ms (%.2fx), %u empty jobs %.3f ms (%.2fx), %ux%u dependent jobs %.3f ms (%.2fx), %ux%u+%u nested jobs %.3f ms (%.2fx), %llu stolen\n",
+			threadCount, parallelFor, baseline[0] / parallelFor, EmptyJobCount, emptyJobs, baseline[1] / emptyJobs, StageCount, JobsPerStage, dependentJobs,
+			baseline[2] / dependentJobs, OuterJobCount, InnerJobCount, FloodJobCount, nestedJobs, baseline[3] / nestedJobs, static_cast<unsigned long long>(stats.jobsStolen));
+	}
+}
+
+// NOTE: the streaming policy alone against a simulated budget. A camera flies down a corridor of 256 textured objects,
+// fetches land a few frames after they're issued, and the residency is checked against the budget every frame
+static auto RunStreamingSimulation() -> void {
+	using namespace Nickel::Renderer;
+	constexpr u32 TextureCount = 256;
+	constexpr u32 FrameCount = 1200;
+	constexpr u32 FetchLatency = 3; // NOTE: frames from issuing a fetch to its data being on the GPU
+	constexpr f32 Spacing = 4.0f, ObjectSize = 2.0f, ViewDistance = 60.0f;
+	constexpr f32 PixelsPerUnit = 720.0f / (2.0f * 0.41421f); // NOTE: 720 lines, 45 degree vertical field of view
+
+	TextureStreamer streamer(TextureStreamingDesc{ .budgetBytes = 96ull << 20 });
+	std::vector<StreamedTextureHandle> textures(TextureCount);
+	std::vector<u32> sizes(TextureCount);
+	u64 fullBytes = 0;
+	for (u32 i = 0; i < TextureCount; i++) {
+		sizes[i] = 1024u << (i % 3);
+		textures[i] = streamer.Register(sizes[i], sizes[i], std::bit_width(sizes[i]), TextureFormat::RGBA8_UNORM);
+		fullBytes += static_cast<u64>(sizes[i]) * sizes[i] * 4 * 4 / 3;
+	}
+	printf("texture streaming: %u textures, %.1f MB with every mip, %.1f MB budget\n", TextureCount, fullBytes / 1048576.0, streamer.GetStats().budgetBytes / 1048576.0);
+
+	std::vector<std::pair<u32, StreamedTextureHandle>> inFlight; // NOTE: landing frame, texture
+	u32 overBudgetFrames = 0;
+	f64 mipGap = 0.0;
+	u64 visibleUses = 0;
+	for (u32 frame = 0; frame < FrameCount; frame++) {
+		for (auto it = inFlight.begin(); it != inFlight.end();) {
+			if (it->first > frame) {
+				++it;
+				continue;
+			}
+			streamer.CompleteFetch(it->second);
+			it = inFlight.erase(it);
+		}
+
+		// NOTE: objects line both walls, the camera moves forward and back once over the run
+		const f32 cameraZ = (frame < FrameCount / 2 ? frame : FrameCount - frame) * (TextureCount / 2 * Spacing) / (FrameCount / 2);
+		for (u32 i = 0; i < TextureCount; i++) {
+			const f32 distance = std::abs(static_cast<f32>(i / 2) * Spacing - cameraZ) + 1.5f;
+			if (distance > ViewDistance)
+				continue;
+
+			const f32 wanted = ComputeStreamingMip(sizes[i], ObjectSize * PixelsPerUnit / distance);
+			streamer.RequestMip(textures[i], wanted);
+			mipGap += std::max(static_cast<f32>(streamer.GetResidentMip(textures[i])) - std::floor(wanted), 0.0f);
+			visibleUses++;
+		}
+
+		for (const auto& request : streamer.Update()) {
+			if (request.action == StreamingAction::Fetch)
+				inFlight.emplace_back(frame + FetchLatency, request.texture);
+		}
+
+		const auto stats = streamer.GetStats();
+		if (stats.residentBytes + stats.pendingBytes > stats.budgetBytes)
+			overBudgetFrames++;
+
+		if ((frame + 1) % 200 == 0) {
+			printf("frame %4u: %6.1f MB resident, %5.1f MB pending, %6.1f MB wanted, %u fetches (%.1f MB), %u evictions, %u deferred\n", frame + 1,
+				stats.residentBytes / 1048576.0, stats.pendingBytes / 1048576.0, stats.wantedBytes / 1048576.0, stats.fetches, stats.fetchedBytes / 1048576.0,
+				stats.evictions, stats.deferred);
+		}
+	}
+
+	printf("%u frames over budget, visible textures %.2f mips coarser than wanted on average\n", overBudgetFrames, mipGap / std::max<u64>(visibleUses, 1));
+}
+
+// Headless entry point: runs the whole Initialize/LoadContent/UpdateAndRender path on the null backend,
+// no window and no GPU needed. Exits with 1 when the backend reported validation errors.
+// With -software the frames are rasterized on the CPU instead and -out saves the last one as a .bmp.
+// -cluster-bench only times the CPU light culling for 256 to 16k lights and exits.
+// -equirect-bench only times the 8K panorama to cube map conversion and exits.
+// -texcook-bench only times cooking a 2K texture for every role, with the quality and size, and exits.
+// -decode-bench only times decoding the startup cube map faces and textures, serially and in parallel, and exits.
+// -gltf-bench only times importing the glTF models with the native loader and with assimp and exits.
+// -pack [dir] [archive] packs Data (or dir) into Data.pak (or archive) for Initialize to mount, verifies it and exits.
+// -io-bench [dir] [depth] only reads every file under Data (or dir) cold, blocking and asynchronously at queue depths
+// 1, 4, 16... up to depth (64), prints bandwidth and read latency and exits.
+// -jobs-bench only measures how the job system scales from 1 to every hardware thread and exits.
+// -streaming-sim only runs the texture streaming policy against a simulated budget and exits.
+// usage: Nickel [frameCount] [-software] [-out image.bmp] [-cluster-bench] [-equirect-bench] [-texcook-bench] [-decode-bench] [-gltf-bench] [-pack [dir] [archive]] [-io-bench [dir] [depth]] [-jobs-bench] [-streaming-sim]
+auto main(int argc, char** argv) -> int {
+	u32 frameCount = 100;
+	bool software = false;
+	const char* outPath = nullptr;
+	for (int i = 1; i < argc; i++) {
+		if (std::strcmp(argv[i], "-software") == 0)
+			software = true;
+		else if (std::strcmp(argv[i], "-out") == 0 && i + 1 < argc)
+			outPath = argv[++i];
+		else if (std::strcmp(argv[i], "-cluster-bench") == 0) {
+			RunClusterBenchmark();
+			return 0;
+		} else if (std::strcmp(argv[i], "-equirect-bench") == 0) {
+			RunEquirectBenchmark();
+			return 0;
+		} else if (std::strcmp(argv[i], "-texcook-bench") == 0) {
+			RunTextureCookBenchmark();
+			return 0;
+		} else if (std::strcmp(argv[i], "-decode-bench") == 0) {
+			RunImageDecodeBenchmark();
+			return 0;
+		} else if (std::strcmp(argv[i], "-gltf-bench") == 0) {
+			RunGltfImportBenchmark();
+			return 0;
+		} else if (std::strcmp(argv[i], "-pack") == 0) {
+			const char* sourceDir = i + 1 < argc ? argv[i + 1] : Nickel::AssetMountPoint;
+			const char* archivePath = i + 2 < argc ? argv[i + 2] : Nickel::AssetArchivePath;
+			return RunAssetPack(sourceDir, archivePath) ? 0 : 1;
+		} else if (std::strcmp(argv[i], "-io-bench") == 0) {
+			const char* dir = i + 1 < argc ? argv[i + 1] : Nickel::AssetMountPoint;
+			const u32 queueDepth = i + 2 < argc ? static_cast<u32>(std::strtoul(argv[i + 2], nullptr, 10)) : 64;
+			return RunIoBenchmark(dir, std::max(queueDepth, 1u)) ? 0 : 1;
+		} else if (std::strcmp(argv[i], "-jobs-bench") == 0) {
+			RunJobBenchmark();
+			return 0;
+		} else if (std::strcmp(argv[i], "-streaming-sim") == 0) {
+			RunStreamingSimulation();
+			return 0;
+		} else
+			frameCount = static_cast<u32>(std::strtoul(argv[i], nullptr, 10));
+	}
+
+	const auto platform = software ? GraphicsPlatform::Software : GraphicsPlatform::Null;
+	RendererState rs = Nickel::Renderer::Initialize(platform, nullptr, GLOBAL_WINDOW_WIDTH, GLOBAL_WINDOW_HEIGHT);
+
+	GameMemory gameMemory{};
+	Nickel::Initialize(&gameMemory, &rs);
+	gameMemory.isInitialized = true;
+
+	GameInput input{ .normalizedMouseX = 0.5f, .normalizedMouseY = 0.5f, .dt = 1.0f / 60.0f };
+
+	const auto start = std::chrono::steady_clock::now();
+	for (u32 i = 0; i < frameCount; i++) {
+		Nickel::UpdateAndRender(&gameMemory, &rs, &input);
+		rs.gfx.Present();
+	}
+	const auto elapsed = std::chrono::duration<f64, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+	printf("%s\n", rs.frameGraph.FormatReport().c_str());
+
+	if (software) {
+		const auto& stats = Nickel::Renderer::Software::Core::GetStats();
+		const auto& last = stats.lastFrame;
+		printf("frames: %llu, %.3f ms/frame, %u workers, %s\n", static_cast<unsigned long long>(stats.frameCount), frameCount > 0 ? elapsed / frameCount : 0.0,
+			stats.workerCount, stats.avx2 ? "AVX2" : "scalar");
+		printf("last frame: %u lists, %u draws (%u skipped), %llu primitives, %llu culled, %llu clipped, %llu binned, %llu pixels shaded, %u flushes\n",
+			last.commandLists, last.draws, last.skippedDraws, static_cast<unsigned long long>(last.raster.primitives), static_cast<unsigned long long>(last.raster.trianglesCulled),
+			static_cast<unsigned long long>(last.raster.trianglesClipped), static_cast<unsigned long long>(last.raster.trianglesBinned),
+			static_cast<unsigned long long>(last.raster.pixelsShaded), last.raster.flushes);
+
+		const bool saved = outPath == nullptr || Nickel::Renderer::Software::Core::SaveBackbuffer(outPath);
+		if (outPath != nullptr)
+			printf(saved ? "saved %s\n" : "failed to save %s\n", outPath);
+
+		Nickel::Renderer::Shutdown(rs);
+		return saved ? 0 : 1;
+	}
+
+	const auto& stats = Nickel::Renderer::Null::Core::GetStats();
+	const auto& last = stats.lastFrame;
+	printf("frames: %llu, %.3f ms/frame\n", static_cast<unsigned long long>(stats.frameCount), frameCount > 0 ? elapsed / frameCount : 0.0);
+	printf("last frame: %u lists, %u commands, %u draws, %u primitives, %u state changes, %u buffer updates (%llu bytes)\n",
+		last.commandLists, last.commands, last.draws, last.primitives, last.stateChanges, last.bufferUpdates, static_cast<unsigned long long>(last.bufferUploadBytes));
+	printf("resources: %u buffers (%llu bytes), %u textures (%llu bytes), %u programs\n",
+		stats.liveBuffers, static_cast<unsigned long long>(stats.bufferMemory), stats.liveTextures, static_cast<unsigned long long>(stats.textureMemory), stats.livePrograms);
+	printf("validation errors: %u\n", stats.validationErrors);
+
+	const bool valid = stats.validationErrors == 0;
+	Nickel::Renderer::Shutdown(rs);
+
+	return valid ? 0 : 1;
+}
+#endif
\ No newline at end of file
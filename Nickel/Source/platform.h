@@ -3,19 +3,18 @@
 #include <stddef.h>
 #include <utility>
 #include <type_traits>
+#if defined(_MSC_VER)
 #include <intrin.h>
+#endif
 #include <source_location>
 #include <string>
 #include <sstream>
 #include <span>
 #include <variant>
+#include <cstdlib>
 
 #include "Logger.h"
 
-#include "imgui/imgui.h";
-#include "imgui/imgui_impl_win32.h";
-#include "imgui/imgui_impl_dx11.h"
-
 inline auto GetSourceLocation(const std::source_location& loc) -> std::string {
 	std::ostringstream result("file: ", std::ios_base::ate);
 	result << loc.file_name() << std::endl
@@ -26,7 +25,7 @@ inline auto GetSourceLocation(const std::source_location& loc) -> std::string {
 }
 
 // TODO: change to normal procedure - make a platform universal MessageBox
-#if defined(_DEBUG)
+#if defined(_DEBUG) && defined(_WIN32)
 #define Assert(expr) {  \
 		if (!(expr)) {      \
 			MessageBox(nullptr, GetSourceLocation(std::source_location::current()).c_str(), TEXT("Assertion Failed"), MB_OK); \
@@ -34,6 +33,13 @@ inline auto GetSourceLocation(const std::source_location& loc) -> std::string {
 			*(int *)0 = 0;  \
 		}                   \
 	}
+#elif defined(_DEBUG)
+#define Assert(expr) {  \
+		if (!(expr)) {      \
+			Nickel::Logger::Critical("Assertion Failed\n" + GetSourceLocation(std::source_location::current())); \
+			std::abort();   \
+		}                   \
+	}
 #else
 #define Assert(expr) {}
 #endif
@@ -1,6 +1,11 @@
 #include "Windows.h"
 #include "platform.h"
 #include "game.h"
+#include "Renderer/Direct3D11/D3D11Core.h"
+
+#include "imgui/imgui.h"
+#include "imgui/imgui_impl_win32.h"
+#include "imgui/imgui_impl_dx11.h"
 //#include "Renderer/renderer.h"
 
 static bool running = true;
@@ -248,13 +253,13 @@ auto AllocateGameMemory(GameMemory& gameMemory, Win32State& win32State) -> void
 	gameMemory.temporaryStorage = (reinterpret_cast<u8*>(gameMemory.permanentStorage) + gameMemory.permanentStorageSize);
 }
 
-auto InitializeImGui(HWND wndHandle, const RendererState& rs) -> void {
+auto InitializeImGui(HWND wndHandle) -> void {
 	IMGUI_CHECKVERSION();
 	ImGui::CreateContext();
 	ImGuiIO& io = ImGui::GetIO(); (void)io;
 	ImGui::StyleColorsDark();
 	ImGui_ImplWin32_Init(wndHandle);
-	ImGui_ImplDX11_Init(rs.device.Get(), rs.cmdQueue.queue.Get());
+	ImGui_ImplDX11_Init(Nickel::Renderer::DXLayer::Core::GetDevice(), Nickel::Renderer::DXLayer::Core::GetContext());
 
 	ImGuiStyle* style = &ImGui::GetStyle();
 	ImVec4* colors = style->Colors;
@@ -336,8 +341,20 @@ auto WinMain(HINSTANCE hInstance, HINSTANCE hPrevInstance, LPSTR lpCmdLine, int
 	Assert(clientWidth  == GLOBAL_WINDOW_WIDTH);
 	Assert(clientHeight == GLOBAL_WINDOW_HEIGHT);
 
-	RendererState rs = Nickel::Renderer::Initialize(wndHandle, clientWidth, clientHeight);
-	InitializeImGui(wndHandle, rs);
+	// NOTE: "-null" runs the whole frame path on the headless backend, nothing is drawn
+	// "-software" draws with the CPU rasterizer, there's no ImGui on either since its backend is D3D11 only
+	const bool headless = lpCmdLine != nullptr && strstr(lpCmdLine, "-null") != nullptr;
+	const bool software = !headless && lpCmdLine != nullptr && strstr(lpCmdLine, "-software") != nullptr;
+	auto platform = Nickel::Renderer::GraphicsPlatform::Direct3D11;
+	if (headless)
+		platform = Nickel::Renderer::GraphicsPlatform::Null;
+	else if (software)
+		platform = Nickel::Renderer::GraphicsPlatform::Software;
+	const bool imgui = platform == Nickel::Renderer::GraphicsPlatform::Direct3D11;
+
+	RendererState rs = Nickel::Renderer::Initialize(platform, wndHandle, clientWidth, clientHeight);
+	if (imgui)
+		InitializeImGui(wndHandle);
 
 	GameMemory gameMemory{};
 	Win32State win32State{};
@@ -390,14 +407,31 @@ auto WinMain(HINSTANCE hInstance, HINSTANCE hPrevInstance, LPSTR lpCmdLine, int
 		newInput->normalizedMouseY = mouseY / (clientWidth-1);
 
 		Win32ProcessPendingMessages(newKeyboardController);
+
+		if (imgui) {
+			ImGui_ImplDX11_NewFrame();
+			ImGui_ImplWin32_NewFrame();
+			ImGui::NewFrame();
+		}
+
 		Nickel::UpdateAndRender(&gameMemory, &rs, newInput);
 
+		if (imgui) {
+			ImGui::Render();
+			ImGui_ImplDX11_RenderDrawData(ImGui::GetDrawData());
+		}
+		rs.gfx.Present();
+
 		std::swap(newInput, oldInput);
 	}
 
-	ImGui_ImplDX11_Shutdown();
-	ImGui_ImplWin32_Shutdown();
-	ImGui::DestroyContext();
+	if (imgui) {
+		ImGui_ImplDX11_Shutdown();
+		ImGui_ImplWin32_Shutdown();
+		ImGui::DestroyContext();
+	}
+
+	Nickel::Renderer::Shutdown(rs);
 
 	spdlog::drop_all(); // Under VisualStudio, this must be called before main finishes to workaround a known VS issue
 }
\ No newline at end of file